@@ -0,0 +1,90 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Headless batch mode. Generates every game in games/ without the editor*
+//
+
+#include <stdio.h>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <filesystem>
+#include <algorithm>
+
+#include "generate.h"
+#include "data.h"
+
+
+int main(int argc, char** argv)
+{
+    if (argc != 4) // Minimum effort validation
+    {
+        fprintf(stderr, "Usage: ap_gen_tool_batch python_py_out_dir cpp_py_out_dir poptracker_data_dir\n  i.e: ap_gen_tool_batch C:/github/Archipelago/worlds C:/github/apdoom/src/archipelago C:/github/apdoom/data/poptracker\n");
+        return 1;
+    }
+
+    std::string py_worlds_dir = argv[1];
+    std::string cpp_dir = argv[2];
+    std::string pop_tracker_dir = argv[3];
+
+    // Loading reads the WADs into the shared games map, keep it on this thread
+    init_data(false);
+
+    std::vector<game_t*> batch;
+    for (auto& kv : games)
+    {
+        auto game = &kv.second;
+        if (!load(game))
+        {
+            fprintf(stderr, "Cannot load data/%s.json\n", game->name.c_str());
+            return 1;
+        }
+        std::filesystem::create_directories(std::filesystem::path(py_worlds_dir) / game->world);
+        batch.push_back(game);
+    }
+    std::filesystem::create_directories(cpp_dir);
+    std::filesystem::create_directories(pop_tracker_dir);
+
+    // Games only read each other's data, so each worker takes the next one
+    // until they are all done.
+    std::atomic<size_t> next_game(0);
+    std::atomic<int> failed(0);
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, (unsigned int)batch.size());
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            for (size_t j = next_game++; j < batch.size(); j = next_game++)
+            {
+                if (generate(batch[j], py_worlds_dir, cpp_dir, pop_tracker_dir) != 0)
+                    failed++;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    if (failed)
+    {
+        fprintf(stderr, "%i game(s) failed to generate\n", failed.load());
+        return 1;
+    }
+
+    printf("Generated %i game(s)\n", (int)batch.size());
+    return 0;
+}
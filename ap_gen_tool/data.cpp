@@ -5,12 +5,14 @@
 #include <onut/Json.h>
 #include <onut/Log.h>
 #include <json/json.h>
+#include <filesystem>
+#include <string.h>
 
 
 std::map<std::string, game_t> games;
 
 
-void init_data()
+void init_data(bool load_icons)
 {
     auto game_json_files = onut::findAllFiles("./games/", "json", false);
     for (const auto& game_json_file : game_json_files)
@@ -147,7 +149,7 @@ void init_data()
         game.item_requirements.insert(game.item_requirements.end(), game.progressions.begin(), game.progressions.end());
         game.item_requirements.insert(game.item_requirements.end(), game.unique_progressions.begin(), game.unique_progressions.end());
 
-        init_maps(game);
+        init_maps(game, load_icons);
 
         games[game.name] = game;
     }
@@ -202,3 +204,395 @@ const std::string& get_level_name(const level_index_t& idx)
     if (idx.map < 0 || idx.map >= (int)game->episodes[idx.ep].size()) return nullptr;
     return game->episodes[idx.ep][idx.map].name;
 }
+
+
+// Binary copy of data/*.json, used to open a game without parsing its JSON.
+// The JSON stays the real data (it's what goes in git), the .bin is only
+// trusted while it was made from a JSON of the same size and time.
+#define STATE_CACHE_MAGIC 0x53475041 // "APGS"
+#define STATE_CACHE_VERSION 1
+
+
+static std::string state_json_filename(const game_t* game)
+{
+    return "data/" + game->name + ".json";
+}
+
+
+static std::string state_cache_filename(const game_t* game)
+{
+    return "data/" + game->name + ".bin";
+}
+
+
+static bool get_state_json_key(const game_t* game, uint64_t& size, int64_t& time)
+{
+    std::error_code ec;
+    auto filename = state_json_filename(game);
+    size = (uint64_t)std::filesystem::file_size(filename, ec);
+    if (ec) return false;
+    time = (int64_t)std::filesystem::last_write_time(filename, ec).time_since_epoch().count();
+    return !ec;
+}
+
+
+struct state_writer_t
+{
+    std::vector<uint8_t> data;
+
+    void u32(uint32_t v) { for (int i = 0; i < 4; ++i) data.push_back((uint8_t)(v >> (i * 8))); }
+    void u64(uint64_t v) { for (int i = 0; i < 8; ++i) data.push_back((uint8_t)(v >> (i * 8))); }
+    void i32(int v) { u32((uint32_t)v); }
+    void f32(float v) { uint32_t u; memcpy(&u, &v, 4); u32(u); }
+    void str(const std::string& s) { u32((uint32_t)s.size()); data.insert(data.end(), s.begin(), s.end()); }
+
+    void rules(const rule_region_t& rules)
+    {
+        i32(rules.x);
+        i32(rules.y);
+        u32((uint32_t)rules.connections.size());
+        for (const auto& connection : rules.connections)
+        {
+            i32(connection.target_region);
+            u32((uint32_t)connection.requirements_or.size());
+            for (auto req : connection.requirements_or) i32(req);
+            u32((uint32_t)connection.requirements_and.size());
+            for (auto req : connection.requirements_and) i32(req);
+        }
+    }
+};
+
+
+struct state_reader_t
+{
+    const std::vector<uint8_t>& data;
+    size_t pos = 0;
+    bool ok = true;
+
+    state_reader_t(const std::vector<uint8_t>& data) : data(data) {}
+
+    uint64_t bytes(int n)
+    {
+        if (pos + n > data.size()) { ok = false; return 0; }
+        uint64_t v = 0;
+        for (int i = 0; i < n; ++i) v |= (uint64_t)data[pos++] << (i * 8);
+        return v;
+    }
+    uint32_t u32() { return (uint32_t)bytes(4); }
+    uint64_t u64() { return bytes(8); }
+    int i32() { return (int)u32(); }
+    float f32() { uint32_t u = u32(); float v; memcpy(&v, &u, 4); return v; }
+    uint32_t count() { uint32_t n = u32(); if (n > data.size() - pos) { ok = false; return 0; } return n; }
+    std::string str()
+    {
+        uint32_t n = count();
+        std::string s((const char*)data.data() + pos, n);
+        pos += n;
+        return s;
+    }
+
+    rule_region_t rules()
+    {
+        rule_region_t rules;
+        rules.x = i32();
+        rules.y = i32();
+        for (uint32_t i = 0, n = count(); i < n && ok; ++i)
+        {
+            rule_connection_t connection;
+            connection.target_region = i32();
+            for (uint32_t j = 0, m = count(); j < m && ok; ++j) connection.requirements_or.push_back(i32());
+            for (uint32_t j = 0, m = count(); j < m && ok; ++j) connection.requirements_and.push_back(i32());
+            rules.connections.push_back(connection);
+        }
+        return rules;
+    }
+};
+
+
+void save_state_cache(game_t* game)
+{
+    uint64_t json_size;
+    int64_t json_time;
+    if (!get_state_json_key(game, json_size, json_time)) return;
+
+    state_writer_t w;
+    w.u32(STATE_CACHE_MAGIC);
+    w.u32(STATE_CACHE_VERSION);
+    w.u64(json_size);
+    w.u64((uint64_t)json_time);
+
+    int map_count = 0;
+    for (const auto& episode : game->episodes)
+        map_count += (int)episode.size();
+    w.u32((uint32_t)map_count);
+
+    for (int ep = 0; ep < (int)game->episodes.size(); ++ep)
+    {
+        for (int lvl = 0; lvl < (int)game->episodes[ep].size(); ++lvl)
+        {
+            const auto& state = game->episodes[ep][lvl].state;
+            w.i32(ep);
+            w.i32(lvl);
+
+            w.u32((uint32_t)state.bbs.size());
+            for (const auto& bb : state.bbs)
+            {
+                w.i32(bb.x1); w.i32(bb.y1); w.i32(bb.x2); w.i32(bb.y2); w.i32(bb.region);
+            }
+
+            w.u32((uint32_t)state.regions.size());
+            for (const auto& region : state.regions)
+            {
+                w.str(region.name);
+                w.f32(region.tint.r); w.f32(region.tint.g); w.f32(region.tint.b); w.f32(region.tint.a);
+                w.u32((uint32_t)region.sectors.size());
+                for (auto sector : region.sectors) w.i32(sector);
+                w.rules(region.rules);
+            }
+
+            w.u32((uint32_t)state.accesses.size());
+            for (auto access : state.accesses) w.i32(access);
+
+            w.u32((uint32_t)state.locations.size());
+            for (const auto& kv : state.locations)
+            {
+                w.i32(kv.first);
+                w.u32((kv.second.death_logic ? 1 : 0) | (kv.second.unreachable ? 2 : 0) | (kv.second.check_sanity ? 4 : 0));
+                w.str(kv.second.name);
+                w.str(kv.second.description);
+            }
+
+            w.rules(state.world_rules);
+            w.rules(state.exit_rules);
+        }
+    }
+
+    FILE* f = fopen(state_cache_filename(game).c_str(), "wb");
+    if (!f) return;
+    fwrite(w.data.data(), 1, w.data.size(), f);
+    fclose(f);
+}
+
+
+static bool load_state_cache(game_t* game)
+{
+    uint64_t json_size;
+    int64_t json_time;
+    if (!get_state_json_key(game, json_size, json_time)) return false;
+
+    FILE* f = fopen(state_cache_filename(game).c_str(), "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    std::vector<uint8_t> data((size_t)ftell(f));
+    fseek(f, 0, SEEK_SET);
+    data.resize(fread(data.data(), 1, data.size(), f));
+    fclose(f);
+
+    state_reader_t r(data);
+    if (r.u32() != STATE_CACHE_MAGIC || r.u32() != STATE_CACHE_VERSION) return false;
+    if (r.u64() != json_size || (int64_t)r.u64() != json_time) return false; // JSON changed since
+
+    // Read everything before touching the game, so a bad file changes nothing
+    std::vector<std::pair<meta_t*, map_state_t>> states;
+    for (uint32_t i = 0, n = r.u32(); i < n && r.ok; ++i)
+    {
+        int ep = r.i32();
+        int lvl = r.i32();
+        auto meta = get_meta({game->name, ep, lvl});
+        if (!meta) return false;
+
+        map_state_t state;
+        for (uint32_t j = 0, m = r.count(); j < m && r.ok; ++j)
+        {
+            bb_t bb;
+            bb.x1 = r.i32(); bb.y1 = r.i32(); bb.x2 = r.i32(); bb.y2 = r.i32(); bb.region = r.i32();
+            state.bbs.push_back(bb);
+        }
+
+        for (uint32_t j = 0, m = r.count(); j < m && r.ok; ++j)
+        {
+            region_t region;
+            region.name = r.str();
+            region.tint.r = r.f32(); region.tint.g = r.f32(); region.tint.b = r.f32(); region.tint.a = r.f32();
+            for (uint32_t k = 0, o = r.count(); k < o && r.ok; ++k) region.sectors.insert(r.i32());
+            region.rules = r.rules();
+            state.regions.push_back(region);
+        }
+
+        for (uint32_t j = 0, m = r.count(); j < m && r.ok; ++j)
+            state.accesses.insert(r.i32());
+
+        state.check_sanity_count = 0;
+        for (uint32_t j = 0, m = r.count(); j < m && r.ok; ++j)
+        {
+            int index = r.i32();
+            uint32_t flags = r.u32();
+            location_t location;
+            location.death_logic = (flags & 1) != 0;
+            location.unreachable = (flags & 2) != 0;
+            location.check_sanity = (flags & 4) != 0;
+            if (location.check_sanity) state.check_sanity_count++;
+            location.name = r.str();
+            location.description = r.str();
+            state.locations[index] = location;
+        }
+
+        state.world_rules = r.rules();
+        state.exit_rules = r.rules();
+        states.push_back({meta, std::move(state)});
+    }
+    if (!r.ok) return false;
+
+    for (auto& kv : states)
+    {
+        auto meta = kv.first;
+        auto map = &meta->map;
+        meta->state = std::move(kv.second);
+        meta->view.cam_pos = Vector2((float)(map->bb[2] + map->bb[0]) / 2, -(float)(map->bb[3] + map->bb[1]) / 2);
+    }
+    return true;
+}
+
+
+static rule_region_t deserialize_rules(const Json::Value& json)
+{
+    rule_region_t rules;
+
+    rules.x = json.get("x", 0).asInt();
+    rules.y = json.get("y", 0).asInt();
+
+    const auto& connections_json = json["connections"];
+    for (const auto& connection_json : connections_json)
+    {
+        rule_connection_t connection;
+
+        connection.target_region = connection_json.get("target_region", -1).asInt();
+        
+        {
+            const auto& requirements_json = connection_json["requirements_or"];
+            for (const auto& requirement_json : requirements_json)
+            {
+                connection.requirements_or.push_back(requirement_json.asInt());
+            }
+        }
+        {
+            const auto& requirements_json = connection_json["requirements_and"];
+            for (const auto& requirement_json : requirements_json)
+            {
+                connection.requirements_and.push_back(requirement_json.asInt());
+            }
+        }
+
+        rules.connections.push_back(connection);
+    }
+
+    return rules;
+}
+
+
+bool load(game_t* game)
+{
+    if (load_state_cache(game)) return true;
+
+    Json::Value json;
+    std::string filename = state_json_filename(game);
+    if (!onut::loadJson(json, filename)) return false;
+
+    Json::Value json_maps = json["maps"];
+
+    for (const auto& _map_json : json_maps)
+    {
+        int ep = _map_json["ep"].asInt();
+        int lvl = _map_json["map"].asInt();
+        if (ep == 0 && lvl >= (int)game->episodes[ep].size())
+        {
+            // Could be in DOOM2's old format, remap it
+            for (auto& episode : game->episodes)
+            {
+                if (lvl < (int)episode.size())
+                {
+                    break;
+                }
+                lvl -= (int)episode.size();
+                ++ep;
+            }
+        }
+        auto meta = get_meta({game->name, ep, lvl});
+        auto _map_state = &meta->state;
+
+        const auto& bbs_json = _map_json["bbs"];
+        for (const auto& bb_json : bbs_json)
+        {
+            _map_state->bbs.push_back({
+                bb_json[0].asInt(),
+                bb_json[1].asInt(),
+                bb_json[2].asInt(),
+                bb_json[3].asInt(),
+                bb_json.isValidIndex(4) ? bb_json[4].asInt() : -1,
+            });
+        }
+
+        const auto& regions_json = _map_json["regions"];
+        for (const auto& region_json : regions_json)
+        {
+            region_t region;
+
+            region.name = region_json.get("name", "BAD_NAME").asString();
+            onut::deserializeFloat4(&region.tint.r, region_json["tint"]);
+
+            const auto& sectors_json = region_json["sectors"];
+            for (const auto& sector_json : sectors_json)
+                region.sectors.insert(sector_json.asInt());
+
+            region.rules = deserialize_rules(region_json["rules"]);
+
+            _map_state->regions.push_back(region);
+        }
+
+        const auto& accesses_json = _map_json["accesses"];
+        for (const auto& access_json : accesses_json)
+        {
+            _map_state->accesses.insert(access_json.asInt());
+        }
+
+        // Default locations from maps
+        auto map = &meta->map;
+        for (int i = 0; i < (int)map->things.size(); ++i)
+        {
+            const auto& thing = map->things[i];
+            if (thing.flags & 0x0010) continue; // Thing is not in single player
+            if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
+            {
+                location_t location;
+                _map_state->locations[i] = location;
+            }
+        }
+            
+        const auto& locations_json = _map_json["locations"];
+        for (const auto& location_json : locations_json)
+        {
+            location_t location;
+            int index = location_json["index"].asInt();
+            const auto& thing = map->things[index];
+            if (thing.flags & 0x0010) continue; // Thing is not in single player
+            if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
+            {
+                location.death_logic = location_json["death_logic"].asBool();
+                location.unreachable = location_json["unreachable"].asBool();
+                location.check_sanity = location_json["check_sanity"].asBool();
+                if (location.check_sanity) _map_state->check_sanity_count++;
+                location.name = location_json["name"].asString();
+                location.description = location_json["description"].asString();
+                _map_state->locations[index] = location;
+            }
+        }
+
+        _map_state->world_rules = deserialize_rules(_map_json["world_rules"]);
+        _map_state->exit_rules = deserialize_rules(_map_json["exit_rules"]);
+
+        meta->view.cam_pos = Vector2((float)(map->bb[2] + map->bb[0]) / 2, -(float)(map->bb[3] + map->bb[1]) / 2);
+    }
+
+    save_state_cache(game);
+    return true;
+}
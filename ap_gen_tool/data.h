@@ -8,7 +8,10 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <deque>
+#include <memory>
 #include "maps.h"
+#include "logic.h"
 
 
 struct rule_connection_t
@@ -169,10 +172,32 @@ struct map_view_t
 };
 
 
+// One undo point. Sections an edit didn't touch share their copy with the
+// previous point, so a point only holds what changed.
+struct map_snapshot_t
+{
+    Vector2 pos;
+    float angle = 0.0f;
+    int selected_bb = -1;
+    int selected_region = -1;
+    int selected_location = -1;
+    bool different = false;
+    int check_sanity_count = 0;
+    std::shared_ptr<const std::vector<bb_t>> bbs;
+    std::vector<std::shared_ptr<const region_t>> regions;
+    std::shared_ptr<const rule_region_t> world_rules;
+    std::shared_ptr<const rule_region_t> exit_rules;
+    std::shared_ptr<const std::set<int>> accesses;
+    std::shared_ptr<const std::map<int, location_t>> locations;
+    size_t size = 0; // Roughly what this point added, in bytes
+};
+
+
 struct map_history_t
 {
-    std::vector<map_state_t> history;
+    std::deque<map_snapshot_t> history;
     int history_point = 0;
+    size_t size = 0;
 };
 
 
@@ -183,7 +208,8 @@ struct meta_t // Bad name, but everything about a level
     map_state_t state; // What we play with
     map_state_t state_new; // For diffing
     map_view_t view; // Camera zoom/position
-    map_history_t history; // History of map_state_t for undo/redo (It's infinite!)
+    map_history_t history; // History of map_state_t for undo/redo
+    map_logic_t logic; // Reachability of state, solved again on every edit
 };
 
 
@@ -263,7 +289,9 @@ enum class active_source_t
 extern std::map<std::string, game_t> games;
 
 
-void init_data();
+void init_data(bool load_icons = true); // Icons need a renderer
+bool load(game_t* game); // Level states from data/*.json
+void save_state_cache(game_t* game); // After writing data/*.json
 game_t* get_game(const level_index_t& idx);
 meta_t* get_meta(const level_index_t& idx, active_source_t source = active_source_t::current);
 map_state_t* get_state(const level_index_t& idx, active_source_t source = active_source_t::current);
@@ -23,6 +23,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include <filesystem>
 #include <json/json.h>
 #include <onut/onut.h>
 #include <onut/Strings.h>
@@ -31,6 +32,7 @@
 #include "maps.h"
 #include "generate.h"
 #include "data.h"
+#include "poptracker.h"
 
 #include <algorithm>
 
@@ -103,17 +105,18 @@ struct level_t
     map_state_t* map_state = nullptr;
 };
 
-int64_t item_id_base = 350000;
-int64_t item_next_id = item_id_base;
-int64_t location_next_id = 351000;
+// Per thread, so the batch mode can generate several games at once
+static thread_local int64_t item_id_base = 350000;
+static thread_local int64_t item_next_id = item_id_base;
+static thread_local int64_t location_next_id = 351000;
 
-int total_item_count = 0;
-int total_loc_count = 0;
-std::vector<ap_item_t> ap_items;
-std::vector<ap_location_t> ap_locations;
-std::map<std::string, std::set<std::string>> item_name_groups;
-std::map<uintptr_t, std::map<int, int64_t>> level_to_keycards;
-std::map<std::string, ap_item_t*> item_map;
+static thread_local int total_item_count = 0;
+static thread_local int total_loc_count = 0;
+static thread_local std::vector<ap_item_t> ap_items;
+static thread_local std::vector<ap_location_t> ap_locations;
+static thread_local std::map<std::string, std::set<std::string>> item_name_groups;
+static thread_local std::map<uintptr_t, std::map<int, int64_t>> level_to_keycards;
+static thread_local std::map<std::string, ap_item_t*> item_map;
 
 
 const char* get_doom_type_name(int doom_type);
@@ -267,7 +270,49 @@ std::string convert_quoted_str(const std::string& str)
 }
 
 
-// This is a mess. Many refactors. Sorry...
+// Outputs are written next to their file first, and only replace it when
+// their content changed, so an unchanged _def.h keeps its timestamp and
+// doesn't rebuild apdoom.
+static FILE* open_output(const std::string& path)
+{
+    return fopen((path + ".new").c_str(), "w");
+}
+
+
+static bool read_text_file(const std::string& path, std::string& content)
+{
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return false;
+    char buf[4096];
+    size_t read;
+    while ((read = fread(buf, 1, sizeof(buf), f)) > 0)
+        content.append(buf, read);
+    fclose(f);
+    return true;
+}
+
+
+static void close_output(FILE* fout, const std::string& path)
+{
+    fclose(fout);
+
+    std::string new_path = path + ".new";
+    std::string content, existing;
+    std::error_code ec;
+    if (read_text_file(path, existing) &&
+        read_text_file(new_path, content) &&
+        existing == content)
+    {
+        std::filesystem::remove(new_path, ec);
+        OLog("Unchanged: " + path);
+        return;
+    }
+
+    std::filesystem::rename(new_path, path, ec);
+    if (ec) OLogE("Cannot write file: " + path);
+}
+
+
 int generate(game_t* game)
 {
     OLog("AP Gen Tool");
@@ -278,7 +323,14 @@ int generate(game_t* game)
         return 1;
     }
 
-    std::string py_out_dir = OArguments[0] + "\\" + game->world + "\\";
+    return generate(game, OArguments[0], OArguments[1], OArguments[2]);
+}
+
+
+// This is a mess. Many refactors. Sorry...
+int generate(game_t* game, const std::string& py_worlds_dir, const std::string& cpp_dir, const std::string& pop_tracker_dir)
+{
+    std::string py_out_dir = (std::filesystem::path(py_worlds_dir) / game->world / "").string();
     item_id_base = game->item_ids;
     item_next_id = item_id_base;
     location_next_id = game->loc_ids;
@@ -291,8 +343,8 @@ int generate(game_t* game)
     level_to_keycards.clear();
     item_map.clear();
 
-    std::string cpp_out_dir = OArguments[1] + std::string("\\");
-    std::string pop_tracker_data_dir = OArguments[2] + std::string("\\");
+    std::string cpp_out_dir = (std::filesystem::path(cpp_dir) / "").string();
+    std::string pop_tracker_data_dir = (std::filesystem::path(pop_tracker_dir) / "").string();
 
     ap_locations.reserve(1000);
     ap_items.reserve(1000);
@@ -502,7 +554,8 @@ int generate(game_t* game)
     //---------------------------------------------
     // Items
     {
-        FILE* fout = fopen((py_out_dir + "Items.py").c_str(), "w");
+        std::string out_path = py_out_dir + "Items.py";
+        FILE* fout = open_output(out_path);
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from BaseClasses import ItemClassification\n\
 from typing import TypedDict, Dict, Set \n\
@@ -554,12 +607,13 @@ class ItemDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "}\n");
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // Generate Regions.py from regions.json (Manually entered data)
     {
-        FILE* fout = fopen((py_out_dir + "Regions.py").c_str(), "w");
+        std::string out_path = py_out_dir + "Regions.py";
+        FILE* fout = open_output(out_path);
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import List\n");
         fprintf(fout, "from BaseClasses import TypedDict\n\n");
@@ -655,12 +709,13 @@ class ItemDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "]\n");
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
     
     // Locations
     {
-        FILE* fout = fopen((py_out_dir + "Locations.py").c_str(), "w");
+        std::string out_path = py_out_dir + "Locations.py";
+        FILE* fout = open_output(out_path);
 
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import Dict, TypedDict, List, Set \n\
@@ -738,12 +793,13 @@ class LocationDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "]\n");
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // Maps
     {
-        FILE* fout = fopen((py_out_dir + "Maps.py").c_str(), "w");
+        std::string out_path = py_out_dir + "Maps.py";
+        FILE* fout = open_output(out_path);
 
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import List\n\n\n");
@@ -755,20 +811,22 @@ class LocationDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "\n]\n");
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // Now generate apdoom_def.h so the game can map the IDs
     {
-        FILE* fout = fopen((cpp_out_dir + "ap" + game->codename + "_def.h").c_str(), "w");
+        std::string out_path = cpp_out_dir + "ap" + game->codename + "_def.h";
+        FILE* fout = open_output(out_path);
         
         fprintf(fout, "// This file is auto generated. More info: https://github.com/Daivuk/apdoom\n");
         fprintf(fout, "#pragma once\n\n");
         fprintf(fout, "#include \"apdoom.h\"\n");
-        fprintf(fout, "#include \"apdoom_def_types.h\"\n");
-        fprintf(fout, "#include <map>\n");
-        fprintf(fout, "#include <string>\n");
-        fprintf(fout, "#include <vector>\n\n\n");
+        fprintf(fout, "#include \"apdoom_def_types.h\"\n\n\n");
+
+        // Everything below is emitted as flat constexpr arrays so the game
+        // doesn't pay for building containers at startup. The tables are
+        // sorted, apdoom.cpp binary searches them.
 
         std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> location_table;
         for (const auto& loc : ap_locations)
@@ -777,53 +835,49 @@ class LocationDict(TypedDict, total=False): \n\
         }
 
         // locations
-        fprintf(fout, "const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> ap_%s_location_table = {\n", game->codename.c_str());
+        fprintf(fout, "// Sorted by ep, map, index\n");
+        fprintf(fout, "constexpr ap_location_def_t ap_%s_location_table[] = {\n", game->codename.c_str());
         for (const auto& kv1 : location_table)
         {
-            fprintf(fout, "    {%i, {\n", kv1.first);
             for (const auto& kv2 : kv1.second)
             {
-                fprintf(fout, "        {%i, {\n", kv2.first);
                 for (const auto& kv3 : kv2.second)
                 {
-                    fprintf(fout, "            {%i, %lli},\n", kv3.first, kv3.second);
+                    fprintf(fout, "    {%i, %i, %i, %lli},\n", kv1.first, kv2.first, kv3.first, kv3.second);
                 }
-                fprintf(fout, "        }},\n");
             }
-            fprintf(fout, "    }},\n");
         }
         fprintf(fout, "};\n\n\n");
 
         // items
-        fprintf(fout, "// Map item id\n");
-        fprintf(fout, "const std::map<int64_t, ap_item_t> ap_%s_item_table = {\n", game->codename.c_str());
+        std::vector<const ap_item_t*> sorted_items;
         for (const auto& item : ap_items)
+            sorted_items.push_back(&item);
+        std::sort(sorted_items.begin(), sorted_items.end(), [](const ap_item_t* a, const ap_item_t* b) { return a->id < b->id; });
+
+        fprintf(fout, "// Map item id, sorted by id\n");
+        fprintf(fout, "constexpr ap_item_def_t ap_%s_item_table[] = {\n", game->codename.c_str());
+        for (auto item : sorted_items)
         {
-            fprintf(fout, "    {%llu, {%i, %i, %i}},\n", item.id, item.doom_type, item.idx.ep + 1, item.idx.map + 1);
+            fprintf(fout, "    {%llu, {%i, %i, %i}},\n", item->id, item->doom_type, item->idx.ep + 1, item->idx.map + 1);
         }
         fprintf(fout, "};\n\n\n");
 
-        // Level infos
-        fprintf(fout, "std::vector<std::vector<ap_level_info_t>> ap_%s_level_infos = \n", game->codename.c_str());
-        fprintf(fout, "{\n");
+        // Things of every level go into one packed array, levels point into it
+        std::vector<int> thing_offsets;
+        std::vector<int> sanity_check_counts;
+        int thing_offset = 0;
+        fprintf(fout, "// Things of every level, packed back to back\n");
+        fprintf(fout, "constexpr ap_thing_info_t ap_%s_thing_infos[] = {\n", game->codename.c_str());
         for (int ep = 0; ep < game->ep_count; ++ep)
         {
-            fprintf(fout, "    {\n");
             int map = 0;
             for (const auto& meta : game->episodes[ep])
             {
                 auto level = get_level({game->name, ep, map});
-                fprintf(fout, "        {\"%s\", {%s, %s, %s}, {%i, %i, %i}, %i, %i, {\n", 
-                        level->name.c_str(),
-                        level->keys[0] ? "true" : "false", 
-                        level->keys[1] ? "true" : "false", 
-                        level->keys[2] ? "true" : "false", 
-                        level->use_skull[0] ? 1 : 0, 
-                        level->use_skull[1] ? 1 : 0, 
-                        level->use_skull[2] ? 1 : 0, 
-                        level->location_count,
-                        (int)level->map->things.size());
+                fprintf(fout, "    // %s\n", level->name.c_str());
                 int idx = 0;
+                int sanity_check_count = 0;
                 for (const auto& thing : level->map->things)
                 {
                     bool check_sanity = false;
@@ -838,36 +892,79 @@ class LocationDict(TypedDict, total=False): \n\
                             break;
                         }
                     }
-                    fprintf(fout, "            {%i, %i, %i, %i},\n", thing.type, idx, check_sanity ? 1 : 0, unreachable ? 1 : 0);
+                    if (check_sanity) ++sanity_check_count;
+                    fprintf(fout, "    {%i, %i, %i, %i},\n", thing.type, idx, check_sanity ? 1 : 0, unreachable ? 1 : 0);
                     ++idx;
                 }
-                fprintf(fout, "        }},\n");
+                thing_offsets.push_back(thing_offset);
+                sanity_check_counts.push_back(sanity_check_count);
+                thing_offset += idx;
                 ++map;
             }
-            fprintf(fout, "    },\n");
         }
         fprintf(fout, "};\n\n\n");
 
-        // Item sprites (Used by notification icons)
-        fprintf(fout, "const std::map<int, std::string> ap_%s_type_sprites = {\n", game->codename.c_str());
+        // Level infos
+        int level_i = 0;
+        for (int ep = 0; ep < game->ep_count; ++ep)
+        {
+            fprintf(fout, "constexpr ap_level_info_t ap_%s_level_infos_ep%i[] = {\n", game->codename.c_str(), ep + 1);
+            int map = 0;
+            for (const auto& meta : game->episodes[ep])
+            {
+                auto level = get_level({game->name, ep, map});
+                fprintf(fout, "    {\"%s\", {%s, %s, %s}, {%i, %i, %i}, %i, %i, ap_%s_thing_infos + %i, %i},\n", 
+                        level->name.c_str(),
+                        level->keys[0] ? "true" : "false", 
+                        level->keys[1] ? "true" : "false", 
+                        level->keys[2] ? "true" : "false", 
+                        level->use_skull[0] ? 1 : 0, 
+                        level->use_skull[1] ? 1 : 0, 
+                        level->use_skull[2] ? 1 : 0, 
+                        level->location_count,
+                        (int)level->map->things.size(),
+                        game->codename.c_str(),
+                        thing_offsets[level_i],
+                        sanity_check_counts[level_i]);
+                ++level_i;
+                ++map;
+            }
+            fprintf(fout, "};\n\n\n");
+        }
+        fprintf(fout, "constexpr ap_episode_info_t ap_%s_level_infos[] = {\n", game->codename.c_str());
+        for (int ep = 0; ep < game->ep_count; ++ep)
+        {
+            fprintf(fout, "    {ap_%s_level_infos_ep%i, %i},\n", game->codename.c_str(), ep + 1, (int)game->episodes[ep].size());
+        }
+        fprintf(fout, "};\n\n\n");
+
+        // Item sprites (Used by notification icons). First one wins if a
+        // doom type shows up more than once.
+        std::map<int, std::string> type_sprites;
         for (const auto& item : game->progressions)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->fillers)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->unique_progressions)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->unique_fillers)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->keys)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.item.doom_type, item.item.sprite.c_str());
+            type_sprites.insert({item.item.doom_type, item.item.sprite});
+
+        fprintf(fout, "// Sorted by doom type\n");
+        fprintf(fout, "constexpr ap_type_sprite_t ap_%s_type_sprites[] = {\n", game->codename.c_str());
+        for (const auto& kv : type_sprites)
+            fprintf(fout, "    {%i, \"%s\"},\n", kv.first, kv.second.c_str());
         fprintf(fout, "};\n");
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // We generate some stuff for doom also, C header.
     {
-        FILE* fout = fopen((cpp_out_dir + "ap" + game->codename + "_c_def.h").c_str(), "w");
+        std::string out_path = cpp_out_dir + "ap" + game->codename + "_c_def.h";
+        FILE* fout = open_output(out_path);
         
         fprintf(fout, "// This file is auto generated. More info: https://github.com/Daivuk/apdoom\n");
         fprintf(fout, "#ifndef _AP_%s_C_DEF_\n", game->codename.c_str());
@@ -889,12 +986,13 @@ class LocationDict(TypedDict, total=False): \n\
         fprintf(fout, "}\n\n");
 
         fprintf(fout, "#endif\n");
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // Generate Rules.py from regions.json (Manually entered data)
     {
-        FILE* fout = fopen((py_out_dir + "Rules.py").c_str(), "w");
+        std::string out_path = py_out_dir + "Rules.py";
+        FILE* fout = open_output(out_path);
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import TYPE_CHECKING\n");
         fprintf(fout, "from worlds.generic.Rules import set_rule\n\n");
@@ -1037,12 +1135,13 @@ class LocationDict(TypedDict, total=False): \n\
             fprintf(fout, "        set_episode%i_rules(player, multiworld, pro)\n", ep + 1);
         }
 
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
     // Generate location CSV that will be used for names
     {
-        FILE* fout = fopen((pop_tracker_data_dir + game->codename + "_location_names.csv").c_str(), "w");
+        std::string out_path = pop_tracker_data_dir + game->codename + "_location_names.csv";
+        FILE* fout = open_output(out_path);
 
         fprintf(fout, "Map,Type,Index,Name,Description\n");
 
@@ -1064,10 +1163,32 @@ class LocationDict(TypedDict, total=False): \n\
                 fprintf(fout, "%s,\n", escape_csv(location.description).c_str());
             }
         }
-        fclose(fout);
+        close_output(fout, out_path);
     }
 
-    // TODO: Pop tracker logic
+    // Pop tracker map images, locations and layout
+    {
+        std::vector<poptracker_level_t> poptracker_levels;
+        for (auto level : levels)
+        {
+            poptracker_level_t poptracker_level;
+            poptracker_level.id = game->codename + "_e" + std::to_string(level->idx.ep + 1) + "m" + std::to_string(level->idx.map + 1);
+            poptracker_level.name = level->name;
+            poptracker_level.ep = level->idx.ep;
+            poptracker_level.map = level->map;
+            poptracker_level.map_state = level->map_state;
+            for (const auto& loc : ap_locations)
+                if (loc.idx == level->idx)
+                    poptracker_level.locations.push_back({loc.name, loc.doom_thing_index});
+            poptracker_levels.push_back(poptracker_level);
+        }
+
+        if (!export_poptracker(game, poptracker_levels, pop_tracker_data_dir))
+        {
+            for (auto level : levels) delete level;
+            return 1;
+        }
+    }
 
     // Clean up
     for (auto level : levels) delete level;
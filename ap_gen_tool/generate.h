@@ -1,7 +1,11 @@
 #pragma once
 
 
+#include <string>
+
+
 struct game_t;
 
 
-int generate(game_t* game);
+int generate(game_t* game); // Output directories come from the command line
+int generate(game_t* game, const std::string& py_worlds_dir, const std::string& cpp_dir, const std::string& pop_tracker_dir);
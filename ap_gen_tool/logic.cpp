@@ -0,0 +1,146 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Level reachability, so logic mistakes show up while editing instead of
+// when running the Archipelago generator*
+//
+
+#include "logic.h"
+#include "data.h"
+#include "maps.h"
+
+#include <bitset>
+#include <chrono>
+
+
+#define MAX_LOGIC_ITEMS 256
+
+typedef std::bitset<MAX_LOGIC_ITEMS> item_set_t;
+
+
+static bool is_pro_connection(const rule_connection_t& connection)
+{
+    for (auto req : connection.requirements_and)
+        if (req == -2)
+            return true;
+    return false;
+}
+
+
+static bool has_item(const game_t* game, const item_set_t& items, int doom_type)
+{
+    for (int i = 0, len = (int)game->item_requirements.size(); i < len && i < MAX_LOGIC_ITEMS; ++i)
+        if (game->item_requirements[i].doom_type == doom_type)
+            return items[i];
+    return false; // Not an item, can't be had
+}
+
+
+// Negative requirements are flags, not items
+static bool can_pass(const game_t* game, const item_set_t& items, const rule_connection_t& connection)
+{
+    for (auto req : connection.requirements_and)
+        if (req >= 0 && !has_item(game, items, req))
+            return false;
+
+    bool any_or = false;
+    for (auto req : connection.requirements_or)
+    {
+        if (req < 0) continue;
+        if (has_item(game, items, req)) return true;
+        any_or = true;
+    }
+    return !any_or;
+}
+
+
+// Grows the set of regions reachable from the hub with items until nothing
+// new opens up.
+static std::vector<bool> solve_regions(const game_t* game, const map_state_t* map_state, const item_set_t& items, bool& exit_reachable)
+{
+    int region_count = (int)map_state->regions.size();
+    std::vector<bool> reachable(region_count, false);
+    std::vector<int> open;
+    exit_reachable = false;
+
+    auto follow = [&](const rule_region_t& rules)
+    {
+        for (const auto& connection : rules.connections)
+        {
+            if (is_pro_connection(connection)) continue;
+            if (!can_pass(game, items, connection)) continue;
+
+            int target = connection.target_region;
+            if (target == -2)
+                exit_reachable = true;
+            else if (target >= 0 && target < region_count && !reachable[target])
+            {
+                reachable[target] = true;
+                open.push_back(target);
+            }
+        }
+    };
+
+    follow(map_state->world_rules);
+    while (!open.empty())
+    {
+        int region = open.back();
+        open.pop_back();
+        follow(map_state->regions[region].rules);
+    }
+
+    return reachable;
+}
+
+
+void solve_logic(const game_t* game, map_t* map, const map_state_t* map_state, map_logic_t& logic)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Region of each sector. Like generate(), the last region listing a
+    // sector gets its locations.
+    std::vector<int> sector_regions(map->sectors.size(), -1);
+    for (int i = 0, len = (int)map_state->regions.size(); i < len; ++i)
+        for (auto sector : map_state->regions[i].sectors)
+            if (sector >= 0 && sector < (int)sector_regions.size())
+                sector_regions[sector] = i;
+
+    item_set_t all_items;
+    all_items.set();
+    bool sphere1_exit;
+    logic.reachable_regions = solve_regions(game, map_state, all_items, logic.exit_reachable);
+    auto sphere1_regions = solve_regions(game, map_state, item_set_t(), sphere1_exit);
+
+    logic.unreachable.clear();
+    logic.sphere1.clear();
+    for (const auto& kv : map_state->locations)
+    {
+        if (kv.second.unreachable) continue; // Taken out of the pool already
+        int index = kv.first;
+        if (index < 0 || index >= (int)map->things.size()) continue;
+
+        const auto& thing = map->things[index];
+        auto subsector = point_in_subsector(thing.x, thing.y, map);
+        int region = -1;
+        if (subsector && subsector->sector >= 0 && subsector->sector < (int)sector_regions.size())
+            region = sector_regions[subsector->sector];
+        if (region == -1 || !logic.reachable_regions[region])
+            logic.unreachable.insert(index);
+        else if (sphere1_regions[region])
+            logic.sphere1.insert(index);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    logic.solve_ms = std::chrono::duration<double, std::milli>(end - start).count();
+}
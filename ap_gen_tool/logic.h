@@ -0,0 +1,24 @@
+#pragma once
+
+#include <set>
+#include <vector>
+
+
+struct game_t;
+struct map_t;
+struct map_state_t;
+
+
+// Where a level's logic leads, worked out from its regions and connections
+// the same way Rules.py will be. Standard logic, pro connections are left out.
+struct map_logic_t
+{
+    std::set<int> unreachable; // Location things that no items can reach
+    std::set<int> sphere1; // Location things reachable without any item
+    std::vector<bool> reachable_regions; // With every item
+    bool exit_reachable = false;
+    double solve_ms = 0.0;
+};
+
+
+void solve_logic(const game_t* game, map_t* map, const map_state_t* map_state, map_logic_t& logic);
@@ -8,6 +8,9 @@
 
 #include <stdio.h>
 #include <algorithm>
+#include <unordered_map>
+#include <atomic>
+#include <thread>
 
 #include "data.h"
 #include "defs.h"
@@ -70,18 +73,26 @@ struct post_t
 };
 
 
+// The whole WAD is read in one go, lumps are then copied out of memory
+static bool lump_in_wad(const map_directory_t &dir_entry, const std::vector<uint8_t> &wad)
+{
+    return dir_entry.offset >= 0 && dir_entry.size >= 0 &&
+           (size_t)dir_entry.offset + (size_t)dir_entry.size <= wad.size();
+}
+
+
 template<typename T>
 static bool try_load_lump(const char *lump_name, 
-                          FILE *f, 
+                          const std::vector<uint8_t> &wad, 
                           const map_directory_t &dir_entry, 
                           std::vector<T> &elements)
 {
     if (strncmp(dir_entry.name, lump_name, 8) == 0)
     {
+        if (!lump_in_wad(dir_entry, wad)) return false;
         auto count = dir_entry.size / sizeof(T);
         elements.resize(count);
-        fseek(f, dir_entry.offset, SEEK_SET);
-        fread(elements.data(), sizeof(T), count, f);
+        memcpy(elements.data(), wad.data() + dir_entry.offset, count * sizeof(T));
         return true;
     }
     return false;
@@ -204,34 +215,42 @@ static void triangulate_sector(const std::vector<wall_t>& map_walls, map_t* map,
 {
     auto& sector = map->sectors[sectori];
 
-    std::vector<int> wall_idx_remaining(sector.walls.size());
-    for (int i = 0, len = (int)sector.walls.size(); i < len; ++i)
-        wall_idx_remaining[i] = i;
+    int wall_count = (int)sector.walls.size();
+
+    // Walls ending at each vertex, in wall order. Walls are taken in the same
+    // order as a scan of the remaining walls would, without the rescans.
+    std::unordered_map<int, std::vector<int>> walls_to_vertex;
+    for (int i = 0; i < wall_count; ++i)
+        walls_to_vertex[map_walls[sector.walls[i]].v2].push_back(i);
+    std::unordered_map<int, int> next_to_vertex; // First candidate not checked yet
+    std::vector<bool> used(wall_count, false);
+    int remaining = wall_count;
+    int next_start = 0;
 
     // Build loops
     std::vector<std::vector<int>> loops;
-    while (wall_idx_remaining.size() >= 3)
+    while (remaining >= 3)
     {
         // Pick first line, and try to build a loop
-        std::vector<int> loop = { wall_idx_remaining[0] };
-        wall_idx_remaining.erase(wall_idx_remaining.begin());
+        while (used[next_start]) ++next_start;
+        std::vector<int> loop = { next_start };
+        used[next_start] = true;
+        --remaining;
         while (true)
         {
             auto previous = loop[(int)loop.size() - 1];
-            bool found = false;
-            for (int i = 0, len = (int)wall_idx_remaining.size(); i < len; ++i)
-            {
-                auto idx = wall_idx_remaining[i];
-                const auto &wall = map_walls[sector.walls[idx]];
-                if (map_walls[sector.walls[previous]].v1 == wall.v2)
-                {
-                    loop.push_back(idx);
-                    wall_idx_remaining.erase(wall_idx_remaining.begin() + i);
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) break;
+            auto v = map_walls[sector.walls[previous]].v1;
+            auto it = walls_to_vertex.find(v);
+            if (it == walls_to_vertex.end()) break;
+            const auto& candidates = it->second;
+            int& next = next_to_vertex[v];
+            while (next < (int)candidates.size() && used[candidates[next]]) ++next;
+            if (next == (int)candidates.size()) break;
+
+            auto idx = candidates[next];
+            loop.push_back(idx);
+            used[idx] = true;
+            --remaining;
         }
 
         if (loop.size() >= 3)
@@ -304,47 +323,57 @@ static void triangulate_sector(const std::vector<wall_t>& map_walls, map_t* map,
 }
 
 
-std::vector<uint8_t> load_lump(const std::vector<map_directory_t>& directory, const char* lump_name, FILE* f)
+std::vector<uint8_t> load_lump(const std::vector<map_directory_t>& directory, const char* lump_name, const std::vector<uint8_t>& wad)
 {
     for (const auto& dir_entry : directory)
     {
         if (strncmp(dir_entry.name, lump_name, 8) == 0)
         {
-            std::vector<uint8_t> ret;
-            ret.resize(dir_entry.size);
-            fseek(f, dir_entry.offset, SEEK_SET);
-            fread(ret.data(), 1, dir_entry.size, f);
-            return ret;
+            if (!lump_in_wad(dir_entry, wad)) return {};
+            auto begin = wad.begin() + dir_entry.offset;
+            return std::vector<uint8_t>(begin, begin + dir_entry.size);
         }
     }
     return {};
 }
 
 
-OTextureRef load_sprite(const std::vector<map_directory_t>& directory, const char* lump_name, FILE* f, const uint8_t* pal)
+struct decoded_sprite_t
+{
+    std::vector<uint8_t> rgba;
+    int width = 0;
+    int height = 0;
+};
+
+
+// Safe to run on any thread, only the texture creation needs the renderer
+static void decode_sprite(const std::vector<map_directory_t>& directory, const char* lump_name, const std::vector<uint8_t>& wad, const uint8_t* pal, decoded_sprite_t& sprite)
 {
-    auto raw_data = load_lump(directory, lump_name, f);
-    if (raw_data.empty()) return nullptr;
+    auto raw_data = load_lump(directory, lump_name, wad);
+    if (raw_data.size() < sizeof(patch_header_t)) return;
 
     patch_header_t header;
     memcpy(&header, raw_data.data(), sizeof(patch_header_t));
-    uint32_t* columnofs = new uint32_t[header.width * sizeof(uint32_t)];
-    memcpy(columnofs, raw_data.data() + sizeof(patch_header_t), header.width * sizeof(uint32_t));
+    if (raw_data.size() < sizeof(patch_header_t) + header.width * sizeof(uint32_t)) return;
+    const uint8_t* columnofs = raw_data.data() + sizeof(patch_header_t);
 
     std::vector<uint8_t> img_data;
     img_data.resize(header.width * header.height * 4);
 
     for (int x = 0; x < header.width; ++x)
     {
-        int offset = columnofs[x];
-        while (raw_data[offset] != 0xFF)
+        uint32_t offset;
+        memcpy(&offset, columnofs + x * sizeof(uint32_t), sizeof(uint32_t));
+        while (offset < raw_data.size() && raw_data[offset] != 0xFF)
         {
             post_t post;
+            if (offset + sizeof(post_t) > raw_data.size()) break;
             memcpy(&post, &raw_data[offset], sizeof(post_t));
             offset += 3;
-            for (int j = 0; j < post.length; ++j, ++offset)
+            for (int j = 0; j < post.length && offset < raw_data.size(); ++j, ++offset)
             {
                 int y = post.topdelta + j;
+                if (y >= header.height) continue;
                 int idx = raw_data[offset] * 3;
                 int k = y * header.width * 4 + x * 4;
                 img_data[k + 0] = pal[idx + 0];
@@ -356,8 +385,9 @@ OTextureRef load_sprite(const std::vector<map_directory_t>& directory, const cha
         }
     }
 
-    delete[] columnofs;
-    return OTexture::createFromData(img_data.data(), {header.width, header.height}, false);
+    sprite.rgba = std::move(img_data);
+    sprite.width = header.width;
+    sprite.height = header.height;
 }
 
 
@@ -512,20 +542,150 @@ Color get_color_for_line_type(int special)
 }
 
 
-void init_wad(const char* filename, game_t& game)
+// Everything derived from the map lumps: BSP, walls, triangles and arrows
+static void build_map(map_t* map)
+{
+    map->sectors.resize(map->map_sectors.size());
+    map->subsectors.resize(map->map_subsectors.size());
+    map->nodes.resize(map->map_nodes.size());
+    for (int j = 0, lenj = (int)map->map_nodes.size(); j < lenj; ++j)
+    {
+        map->nodes[j].x = (int16_t)map->map_nodes[j].x << 16;
+        map->nodes[j].y = (int16_t)map->map_nodes[j].y << 16;
+        map->nodes[j].dx = (int16_t)map->map_nodes[j].dx << 16;
+        map->nodes[j].dy = (int16_t)map->map_nodes[j].dy << 16;
+        for (int jj = 0; jj < 2; ++jj)
+        {
+            map->nodes[j].children[jj] = (uint16_t)(int16_t)map->map_nodes[j].children[jj];
+            if (map->nodes[j].children[jj] == NO_INDEX)
+                map->nodes[j].children[jj] = -1;
+            else if (map->nodes[j].children[jj] & NF_SUBSECTOR_VANILLA)
+            {
+                map->nodes[j].children[jj] &= ~NF_SUBSECTOR_VANILLA;
+                if (map->nodes[j].children[jj] >= (int)map->map_subsectors.size())
+                    map->nodes[j].children[jj] = 0;
+                map->nodes[j].children[jj] |= NF_SUBSECTOR;
+            }
+            for (int k = 0; k < 4; ++k)
+                map->nodes[j].bbox[jj][k] = (int16_t)map->map_nodes[j].bbox[jj][k] << 16;
+        }
+    }
+
+    map->segs.resize(map->map_segs.size());
+    for (int j = 0, lenj = (int)map->map_segs.size(); j < lenj; ++j)
+    {
+        const auto& map_seg = map->map_segs[j];
+        auto& seg = map->segs[j];
+        int side = map_seg.side;
+        seg.sidedef = (&(map->linedefs[map_seg.linedef].front_sidedef))[side];
+        seg.front_sector = map->sidedefs[seg.sidedef].sector;
+    }
+
+    // Assign sector to subsector
+    for (int j = 0, lenj = (int)map->map_subsectors.size(); j < lenj; ++j)
+    {
+        const auto& seg = map->segs[map->map_subsectors[j].firstseg];
+        //const auto& map_sidedef = map->sidedefs[seg.sidedef];
+        map->subsectors[j].sector = seg.front_sector;
+    }
+
+    map->bb[0] = map->vertexes[0].x;
+    map->bb[1] = map->vertexes[0].y;
+    map->bb[2] = map->vertexes[0].x;
+    map->bb[3] = map->vertexes[0].y;
+    for (int v = 1, vlen = (int)map->vertexes.size(); v < vlen; ++v)
+    {
+        map->bb[0] = std::min(map->bb[0], map->vertexes[v].x);
+        map->bb[1] = std::min(map->bb[1], map->vertexes[v].y);
+        map->bb[2] = std::max(map->bb[2], map->vertexes[v].x);
+        map->bb[3] = std::max(map->bb[3], map->vertexes[v].y);
+    }
+
+    // Create "walls" used in triangulation step
+    std::vector<wall_t> map_walls;
+    for (int j = 0; j < (int)map->linedefs.size(); ++j)
+    {
+        const auto &linedef = map->linedefs[j];
+
+        if (linedef.front_sidedef != -1)
+            create_wall(map_walls, map, j, linedef.front_sidedef);
+        if (linedef.back_sidedef != -1)
+            create_wall(map_walls, map, j, linedef.back_sidedef);
+    }
+
+    // Triangulate
+    for (int j = 0; j < (int)map->sectors.size(); ++j)
+    {
+        triangulate_sector(map_walls, map, j);
+    }
+
+    // Create arrows
+    for (int j = 0; j < (int)map->linedefs.size(); ++j)
+    {
+        const auto& line_def = map->linedefs[j];
+        if (line_def.special_type != 0 && line_def.sector_tag != 0)
+        {
+            arrow_t arrow;
+            arrow.color = get_color_for_line_type(line_def.special_type);
+            const auto& v1 = map->vertexes[line_def.start_vertex];
+            const auto& v2 = map->vertexes[line_def.end_vertex];
+            arrow.from = {
+                (float)(v1.x + v2.x) * 0.5f,
+                -(float)(v1.y + v2.y) * 0.5f
+            };
+            for (int k = 0; k < (int)map->map_sectors.size(); ++k)
+            {
+                const auto& map_sector = map->map_sectors[k];
+                if (map_sector.tag == line_def.sector_tag)
+                {
+                    Vector2 bbmin, bbmax;
+                    const auto& sector = map->sectors[k];
+                    if (sector.vertices.empty()) continue;
+                    bbmin = {
+                        (float)map->vertexes[sector.vertices[0]].x,
+                        -(float)map->vertexes[sector.vertices[0]].y
+                    };
+                    bbmax = bbmin;
+                    for (int l = 1; l < (int)sector.vertices.size(); ++l)
+                    {
+                        Vector2 pt = {
+                            (float)map->vertexes[sector.vertices[l]].x,
+                            -(float)map->vertexes[sector.vertices[l]].y
+                        };
+                        bbmin = onut::min(bbmin, pt);
+                        bbmax = onut::max(bbmax, pt);
+                    }
+                    arrow.to = (bbmin + bbmax) * 0.5f;
+                    map->arrows.push_back(arrow);
+                }
+            }
+        }
+    }
+}
+
+
+void init_wad(const char* filename, game_t& game, bool load_icons)
 {
-    // Load DOOM.WAD
+    // Load DOOM.WAD, all of it
     FILE* f = fopen(filename, "rb");
     if (!f)
     {
         onut::showMessageBox("Error", std::string("Cannot open file: ") + filename);
         exit(1); // Hard kill
     }
+    fseek(f, 0, SEEK_END);
+    std::vector<uint8_t> wad((size_t)ftell(f));
+    fseek(f, 0, SEEK_SET);
+    wad.resize(fread(wad.data(), 1, wad.size(), f));
+    fclose(f);
     
     // Read header
     map_header_t header;
-    fread(&header, sizeof(header), 1, f);
-    if (strncmp(header.identification, "PWAD", 4) != 0 && strncmp(header.identification, "IWAD", 4) != 0)
+    if (wad.size() < sizeof(header)) memset(&header, 0, sizeof(header));
+    else memcpy(&header, wad.data(), sizeof(header));
+    if ((strncmp(header.identification, "PWAD", 4) != 0 && strncmp(header.identification, "IWAD", 4) != 0) ||
+        header.num_lumps < 0 || header.directory_offset < 0 ||
+        (size_t)header.directory_offset + (size_t)header.num_lumps * sizeof(map_directory_t) > wad.size())
     {
         onut::showMessageBox("Error", std::string("Invalid IWAD or PWAD: ") + filename);
         exit(1); // Hard kill
@@ -533,12 +693,12 @@ void init_wad(const char* filename, game_t& game)
     
     // Read directory
     std::vector<map_directory_t> directory(header.num_lumps);
-    fseek(f, header.directory_offset, SEEK_SET);
-    fread(directory.data(), sizeof(map_directory_t), header.num_lumps, f);
+    memcpy(directory.data(), wad.data() + header.directory_offset, header.num_lumps * sizeof(map_directory_t));
 
     bool is_doom2 = game.codename == "doom2";
 
     // loop directory and find levels, then load them all. YOLO
+    std::vector<map_t*> loaded_maps;
     for (int i = 0, len = (int)directory.size(); i < len; ++i)
     {
         const auto &dir_entry = directory[i];
@@ -590,175 +750,129 @@ void init_wad(const char* filename, game_t& game)
             for (; i < len; ++i)
             {
                 const auto &dir_entry = directory[i];
-                try_load_lump("THINGS", f, dir_entry, map->things);
-                try_load_lump("LINEDEFS", f, dir_entry, map->linedefs);
-                try_load_lump("SIDEDEFS", f, dir_entry, map->sidedefs);
-                try_load_lump("VERTEXES", f, dir_entry, map->vertexes);
-                try_load_lump("SECTORS", f, dir_entry, map->map_sectors);
-                try_load_lump("SSECTORS", f, dir_entry, map->map_subsectors);
-                try_load_lump("NODES", f, dir_entry, map->map_nodes);
-                try_load_lump("SEGS", f, dir_entry, map->map_segs);
+                try_load_lump("THINGS", wad, dir_entry, map->things);
+                try_load_lump("LINEDEFS", wad, dir_entry, map->linedefs);
+                try_load_lump("SIDEDEFS", wad, dir_entry, map->sidedefs);
+                try_load_lump("VERTEXES", wad, dir_entry, map->vertexes);
+                try_load_lump("SECTORS", wad, dir_entry, map->map_sectors);
+                try_load_lump("SSECTORS", wad, dir_entry, map->map_subsectors);
+                try_load_lump("NODES", wad, dir_entry, map->map_nodes);
+                try_load_lump("SEGS", wad, dir_entry, map->map_segs);
                 if (strncmp(dir_entry.name, "BLOCKMAP", 8) == 0)
                 {
                     break;
                 }
             }
 
-            map->sectors.resize(map->map_sectors.size());
-            map->subsectors.resize(map->map_subsectors.size());
-            map->nodes.resize(map->map_nodes.size());
-            for (int j = 0, lenj = (int)map->map_nodes.size(); j < lenj; ++j)
-            {
-                map->nodes[j].x = (int16_t)map->map_nodes[j].x << 16;
-                map->nodes[j].y = (int16_t)map->map_nodes[j].y << 16;
-                map->nodes[j].dx = (int16_t)map->map_nodes[j].dx << 16;
-                map->nodes[j].dy = (int16_t)map->map_nodes[j].dy << 16;
-                for (int jj = 0; jj < 2; ++jj)
-                {
-                    map->nodes[j].children[jj] = (uint16_t)(int16_t)map->map_nodes[j].children[jj];
-                    if (map->nodes[j].children[jj] == NO_INDEX)
-                        map->nodes[j].children[jj] = -1;
-                    else if (map->nodes[j].children[jj] & NF_SUBSECTOR_VANILLA)
-                    {
-                        map->nodes[j].children[jj] &= ~NF_SUBSECTOR_VANILLA;
-                        if (map->nodes[j].children[jj] >= (int)map->map_subsectors.size())
-                            map->nodes[j].children[jj] = 0;
-                        map->nodes[j].children[jj] |= NF_SUBSECTOR;
-                    }
-                    for (int k = 0; k < 4; ++k)
-                        map->nodes[j].bbox[jj][k] = (int16_t)map->map_nodes[j].bbox[jj][k] << 16;
-                }
-            }
-
-            map->segs.resize(map->map_segs.size());
-            for (int j = 0, lenj = (int)map->map_segs.size(); j < lenj; ++j)
-            {
-                const auto& map_seg = map->map_segs[j];
-                auto& seg = map->segs[j];
-                int side = map_seg.side;
-                seg.sidedef = (&(map->linedefs[map_seg.linedef].front_sidedef))[side];
-                seg.front_sector = map->sidedefs[seg.sidedef].sector;
-            }
+            if (std::find(loaded_maps.begin(), loaded_maps.end(), map) == loaded_maps.end())
+                loaded_maps.push_back(map);
+        }
+    }
 
-            // Assign sector to subsector
-            for (int j = 0, lenj = (int)map->map_subsectors.size(); j < lenj; ++j)
-            {
-                const auto& seg = map->segs[map->map_subsectors[j].firstseg];
-                //const auto& map_sidedef = map->sidedefs[seg.sidedef];
-                map->subsectors[j].sector = seg.front_sector;
-            }
+    // Maps only touch their own data here, so they are built concurrently
+    {
+        std::atomic<size_t> next_map(0);
+        unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+        thread_count = std::min(thread_count, (unsigned int)loaded_maps.size());
 
-            map->bb[0] = map->vertexes[0].x;
-            map->bb[1] = map->vertexes[0].y;
-            map->bb[2] = map->vertexes[0].x;
-            map->bb[3] = map->vertexes[0].y;
-            for (int v = 1, vlen = (int)map->vertexes.size(); v < vlen; ++v)
+        std::vector<std::thread> workers;
+        for (unsigned int j = 0; j < thread_count; ++j)
+        {
+            workers.emplace_back([&]()
             {
-                map->bb[0] = std::min(map->bb[0], map->vertexes[v].x);
-                map->bb[1] = std::min(map->bb[1], map->vertexes[v].y);
-                map->bb[2] = std::max(map->bb[2], map->vertexes[v].x);
-                map->bb[3] = std::max(map->bb[3], map->vertexes[v].y);
-            }
+                for (size_t k = next_map++; k < loaded_maps.size(); k = next_map++)
+                    build_map(loaded_maps[k]);
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+    }
 
-            // Create "walls" used in triangulation step
-            std::vector<wall_t> map_walls;
-            for (int j = 0; j < (int)map->linedefs.size(); ++j)
-            {
-                const auto &linedef = map->linedefs[j];
+    for (auto map : loaded_maps)
+    {
+        // Count checks
+        map->check_count = 0;
+        map->location_cells_w = (map->bb[2] - map->bb[0] + 64) / LOCATION_CELL_SIZE + 1;
+        map->location_cells_h = (map->bb[3] - map->bb[1] + 64) / LOCATION_CELL_SIZE + 1;
+        map->location_cells.clear();
+        map->location_cells.resize(map->location_cells_w * map->location_cells_h);
+        for (int j = 0, len = (int)map->things.size(); j < len; ++j)
+        {
+            const auto& thing = map->things[j];
+
+            // Count total thing count (Consider UV difficulty)
+            if (thing.flags & 0x0004)
+                game.total_doom_types[thing.type]++;
+
+            if (thing.flags & 0x0010) continue; // Thing is not in single player
+            auto it = game.location_doom_types.find(thing.type);
+            if (it == game.location_doom_types.end()) continue;
+            map->check_count++;
+
+            int cx1 = std::max(0, (thing.x - 32 - (map->bb[0] - 32)) / LOCATION_CELL_SIZE);
+            int cy1 = std::max(0, (thing.y - 32 - (map->bb[1] - 32)) / LOCATION_CELL_SIZE);
+            int cx2 = std::min(map->location_cells_w - 1, (thing.x + 32 - (map->bb[0] - 32)) / LOCATION_CELL_SIZE);
+            int cy2 = std::min(map->location_cells_h - 1, (thing.y + 32 - (map->bb[1] - 32)) / LOCATION_CELL_SIZE);
+            for (int cy = cy1; cy <= cy2; ++cy)
+                for (int cx = cx1; cx <= cx2; ++cx)
+                    map->location_cells[cy * map->location_cells_w + cx].push_back(j);
+        }
+    }
 
-                if (linedef.front_sidedef != -1)
-                    create_wall(map_walls, map, j, linedef.front_sidedef);
-                if (linedef.back_sidedef != -1)
-                    create_wall(map_walls, map, j, linedef.back_sidedef);
-            }
+    // Load palette
+    auto pal = load_lump(directory, "PLAYPAL", wad);
+    if (pal.size() < 256 * 3) return;
 
-            // Triangulate
-            for (int j = 0; j < (int)map->sectors.size(); ++j)
-            {
-                triangulate_sector(map_walls, map, j);
-            }
+    // Load sprites for item requirements. Decoding is spread over threads,
+    // the textures are then created here.
+    if (load_icons)
+    {
+        std::vector<decoded_sprite_t> sprites(game.item_requirements.size());
+        std::atomic<size_t> next_sprite(0);
+        unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+        thread_count = std::min(thread_count, (unsigned int)sprites.size());
 
-            // Create arrows
-            for (int j = 0; j < (int)map->linedefs.size(); ++j)
+        std::vector<std::thread> workers;
+        for (unsigned int i = 0; i < thread_count; ++i)
+        {
+            workers.emplace_back([&]()
             {
-                const auto& line_def = map->linedefs[j];
-                if (line_def.special_type != 0 && line_def.sector_tag != 0)
+                for (size_t j = next_sprite++; j < sprites.size(); j = next_sprite++)
                 {
-                    arrow_t arrow;
-                    arrow.color = get_color_for_line_type(line_def.special_type);
-                    const auto& v1 = map->vertexes[line_def.start_vertex];
-                    const auto& v2 = map->vertexes[line_def.end_vertex];
-                    arrow.from = {
-                        (float)(v1.x + v2.x) * 0.5f,
-                        -(float)(v1.y + v2.y) * 0.5f
-                    };
-                    for (int k = 0; k < (int)map->map_sectors.size(); ++k)
-                    {
-                        const auto& map_sector = map->map_sectors[k];
-                        if (map_sector.tag == line_def.sector_tag)
-                        {
-                            Vector2 bbmin, bbmax;
-                            const auto& sector = map->sectors[k];
-                            if (sector.vertices.empty()) continue;
-                            bbmin = {
-                                (float)map->vertexes[sector.vertices[0]].x,
-                                -(float)map->vertexes[sector.vertices[0]].y
-                            };
-                            bbmax = bbmin;
-                            for (int l = 1; l < (int)sector.vertices.size(); ++l)
-                            {
-                                Vector2 pt = {
-                                    (float)map->vertexes[sector.vertices[l]].x,
-                                    -(float)map->vertexes[sector.vertices[l]].y
-                                };
-                                bbmin = onut::min(bbmin, pt);
-                                bbmax = onut::max(bbmax, pt);
-                            }
-                            arrow.to = (bbmin + bbmax) * 0.5f;
-                            map->arrows.push_back(arrow);
-                        }
-                    }
+                    const auto& sprite_name = game.item_requirements[j].sprite;
+                    if (sprite_name != "")
+                        decode_sprite(directory, sprite_name.c_str(), wad, pal.data(), sprites[j]);
                 }
-            }
-
-            // Count checks
-            map->check_count = 0;
-            for (int j = 0, len = (int)map->things.size(); j < len; ++j)
-            {
-                const auto& thing = map->things[j];
-
-                // Count total thing count (Consider UV difficulty)
-                if (thing.flags & 0x0004)
-                    game.total_doom_types[thing.type]++;
-
-                if (thing.flags & 0x0010) continue; // Thing is not in single player
-                auto it = game.location_doom_types.find(thing.type);
-                if (it == game.location_doom_types.end()) continue;
-                map->check_count++;
-            }
+            });
         }
-    }
+        for (auto& worker : workers)
+            worker.join();
 
-    // Load palette
-    auto pal = load_lump(directory, "PLAYPAL", f);
-
-    // Load sprites for item requirements
-    for (auto& item_requirement : game.item_requirements)
-    {
-        if (item_requirement.sprite != "")
+        for (int i = 0, len = (int)sprites.size(); i < len; ++i)
         {
-            item_requirement.icon = load_sprite(directory, item_requirement.sprite.c_str(), f, pal.data());
+            const auto& sprite = sprites[i];
+            if (sprite.rgba.empty()) continue;
+            game.item_requirements[i].icon = OTexture::createFromData(sprite.rgba.data(), {sprite.width, sprite.height}, false);
         }
     }
+}
 
-    // close file
-    fclose(f);
+
+void init_maps(game_t& game, bool load_icons)
+{
+    init_wad(game.wad_name.c_str(), game, load_icons);
 }
 
 
-void init_maps(game_t& game)
+const std::vector<int>* location_cell_at(int x, int y, const map_t* map)
 {
-    init_wad(game.wad_name.c_str(), game);
+    x -= map->bb[0] - 32;
+    y -= map->bb[1] - 32;
+    if (x < 0 || y < 0) return nullptr;
+    x /= LOCATION_CELL_SIZE;
+    y /= LOCATION_CELL_SIZE;
+    if (x >= map->location_cells_w || y >= map->location_cells_h) return nullptr;
+    return &map->location_cells[y * map->location_cells_w + x];
 }
 
 
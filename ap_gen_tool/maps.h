@@ -6,6 +6,9 @@
 #include <onut/Vector2.h>
 
 
+#define LOCATION_CELL_SIZE 256 // Map units
+
+
 struct map_thing_t
 {
     int16_t x;
@@ -150,11 +153,18 @@ struct map_t
     int16_t bb[4];
     std::vector<arrow_t>            arrows;
     int check_count;
+
+    // Location things bucketed by their 64x64 pick box, for picking. Cells
+    // list thing indices in order.
+    std::vector<std::vector<int>>   location_cells;
+    int location_cells_w = 0;
+    int location_cells_h = 0;
 };
 
 
 struct game_t;
 
-void init_maps(game_t& game);
+void init_maps(game_t& game, bool load_icons = true);
 int sector_at(int x, int y, map_t* map);
 subsector_t* point_in_subsector(int x, int y, map_t* map);
+const std::vector<int>* location_cell_at(int x, int y, const map_t* map); // nullptr off the map
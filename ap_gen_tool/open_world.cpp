@@ -15,6 +15,8 @@
 #include <imgui/imgui.h>
 
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 #include "maps.h"
@@ -187,42 +189,6 @@ Json::Value serialize_rules(const rule_region_t& rules)
 }
 
 
-rule_region_t deserialize_rules(const Json::Value& json)
-{
-    rule_region_t rules;
-
-    rules.x = json.get("x", 0).asInt();
-    rules.y = json.get("y", 0).asInt();
-
-    const auto& connections_json = json["connections"];
-    for (const auto& connection_json : connections_json)
-    {
-        rule_connection_t connection;
-
-        connection.target_region = connection_json.get("target_region", -1).asInt();
-        
-        {
-            const auto& requirements_json = connection_json["requirements_or"];
-            for (const auto& requirement_json : requirements_json)
-            {
-                connection.requirements_or.push_back(requirement_json.asInt());
-            }
-        }
-        {
-            const auto& requirements_json = connection_json["requirements_and"];
-            for (const auto& requirement_json : requirements_json)
-            {
-                connection.requirements_and.push_back(requirement_json.asInt());
-            }
-        }
-
-        rules.connections.push_back(connection);
-    }
-
-    return rules;
-}
-
-
 void save(game_t* game)
 {
     Json::Value _json;
@@ -307,129 +273,168 @@ void save(game_t* game)
 
     std::string filename = "data/" + game->name + ".json";
     onut::saveJson(_json, filename, false);
+    save_state_cache(game);
 }
 
 
-void load(game_t* game)
+void update_window_title()
 {
-    Json::Value json;
-    std::string filename = "data/" + game->name + ".json";
-    if (!onut::loadJson(json, filename))
-    {
-        onut::showMessageBox("Warning", "Warning: File not found. (If you just created this game, then it's fine. Otherwise, scream).\n" + filename);
-        return;
-    }
+    oWindow->setCaption(get_meta(active_level)->name.c_str());
+}
 
-    Json::Value json_maps = json["maps"];
 
-    for (const auto& _map_json : json_maps)
-    {
-        int ep = _map_json["ep"].asInt();
-        int lvl = _map_json["map"].asInt();
-        if (ep == 0 && lvl >= (int)game->episodes[ep].size())
-        {
-            // Could be in DOOM2's old format, remap it
-            for (auto& episode : game->episodes)
-            {
-                if (lvl < (int)episode.size())
-                {
-                    break;
-                }
-                lvl -= (int)episode.size();
-                ++ep;
-            }
-        }
-        auto meta = get_meta({game->name, ep, lvl});
-        auto _map_state = &meta->state;
+// Undo/Redo shit
+#define MAX_HISTORY_SIZE (64 * 1024 * 1024) // Oldest points are dropped past this
 
-        const auto& bbs_json = _map_json["bbs"];
-        for (const auto& bb_json : bbs_json)
-        {
-            _map_state->bbs.push_back({
-                bb_json[0].asInt(),
-                bb_json[1].asInt(),
-                bb_json[2].asInt(),
-                bb_json[3].asInt(),
-                bb_json.isValidIndex(4) ? bb_json[4].asInt() : -1,
-            });
-        }
 
-        const auto& regions_json = _map_json["regions"];
-        for (const auto& region_json : regions_json)
-        {
-            region_t region;
+static size_t approx_size(const std::vector<bb_t>& bbs)
+{
+    return sizeof(bbs) + bbs.size() * sizeof(bb_t);
+}
 
-            region.name = region_json.get("name", "BAD_NAME").asString();
-            onut::deserializeFloat4(&region.tint.r, region_json["tint"]);
+static size_t approx_size(const rule_region_t& rules)
+{
+    size_t size = sizeof(rules);
+    for (const auto& connection : rules.connections)
+        size += sizeof(connection) + (connection.requirements_or.size() + connection.requirements_and.size()) * sizeof(int);
+    return size;
+}
 
-            const auto& sectors_json = region_json["sectors"];
-            for (const auto& sector_json : sectors_json)
-                region.sectors.insert(sector_json.asInt());
+static size_t approx_size(const region_t& region)
+{
+    return sizeof(region) + region.name.size() + region.sectors.size() * 32 + approx_size(region.rules);
+}
 
-            region.rules = deserialize_rules(region_json["rules"]);
+static size_t approx_size(const std::set<int>& accesses)
+{
+    return sizeof(accesses) + accesses.size() * 32;
+}
 
-            _map_state->regions.push_back(region);
-        }
+static size_t approx_size(const std::map<int, location_t>& locations)
+{
+    size_t size = sizeof(locations);
+    for (const auto& kv : locations)
+        size += 32 + sizeof(kv) + kv.second.name.size() + kv.second.description.size();
+    return size;
+}
 
-        const auto& accesses_json = _map_json["accesses"];
-        for (const auto& access_json : accesses_json)
-        {
-            _map_state->accesses.insert(access_json.asInt());
-        }
 
-        // Default locations from maps
-        auto map = &meta->map;
-        for (int i = 0; i < (int)map->things.size(); ++i)
-        {
-            const auto& thing = map->things[i];
-            if (thing.flags & 0x0010) continue; // Thing is not in single player
-            if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
-            {
-                location_t location;
-                _map_state->locations[i] = location;
-            }
-        }
-            
-        const auto& locations_json = _map_json["locations"];
-        for (const auto& location_json : locations_json)
+// Reuses prev if value didn't change, otherwise copies it
+template<typename T, typename Eq>
+static std::shared_ptr<const T> share_section(const std::shared_ptr<const T>& prev, const T& value, size_t& size, Eq eq)
+{
+    if (prev && eq(*prev, value)) return prev;
+    size += approx_size(value);
+    return std::make_shared<const T>(value);
+}
+
+template<typename T>
+static std::shared_ptr<const T> share_section(const std::shared_ptr<const T>& prev, const T& value, size_t& size)
+{
+    return share_section(prev, value, size, [](const T& a, const T& b) { return a == b; });
+}
+
+
+static bool same_locations(const std::map<int, location_t>& a, const std::map<int, location_t>& b)
+{
+    // location_t's == doesn't look at check_sanity
+    return a == b && std::equal(a.begin(), a.end(), b.begin(),
+        [](const std::pair<const int, location_t>& x, const std::pair<const int, location_t>& y)
         {
-            location_t location;
-            int index = location_json["index"].asInt();
-            const auto& thing = map->things[index];
-            if (thing.flags & 0x0010) continue; // Thing is not in single player
-            if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
-            {
-                location.death_logic = location_json["death_logic"].asBool();
-                location.unreachable = location_json["unreachable"].asBool();
-                location.check_sanity = location_json["check_sanity"].asBool();
-                if (location.check_sanity) _map_state->check_sanity_count++;
-                location.name = location_json["name"].asString();
-                location.description = location_json["description"].asString();
-                _map_state->locations[index] = location;
-            }
-        }
+            return x.second.check_sanity == y.second.check_sanity;
+        });
+}
 
-        _map_state->world_rules = deserialize_rules(_map_json["world_rules"]);
-        _map_state->exit_rules = deserialize_rules(_map_json["exit_rules"]);
 
-        meta->view.cam_pos = Vector2((float)(map->bb[2] + map->bb[0]) / 2, -(float)(map->bb[3] + map->bb[1]) / 2);
-    }
+static bool same_content(const map_snapshot_t& a, const map_snapshot_t& b)
+{
+    return a.bbs == b.bbs &&
+           a.regions == b.regions &&
+           a.world_rules == b.world_rules &&
+           a.exit_rules == b.exit_rules &&
+           a.accesses == b.accesses &&
+           a.locations == b.locations;
 }
 
 
-void update_window_title()
+// Every edit goes through push_undo(), so the level's logic is solved again
+// from here.
+static void update_logic()
 {
-    oWindow->setCaption(get_meta(active_level)->name.c_str());
+    auto meta = get_meta(active_level);
+    if (!meta) return;
+    solve_logic(get_game(active_level), &meta->map, map_state, meta->logic);
 }
 
 
-// Undo/Redo shit
 void push_undo()
 {
     if (map_history->history_point < (int)map_history->history.size() - 1)
+    {
+        for (auto it = map_history->history.begin() + (map_history->history_point + 1); it != map_history->history.end(); ++it)
+            map_history->size -= it->size;
         map_history->history.erase(map_history->history.begin() + (map_history->history_point + 1), map_history->history.end());
-    map_history->history.push_back(*map_state);
+    }
+
+    const map_snapshot_t* prev = map_history->history.empty() ? nullptr : &map_history->history.back();
+
+    map_snapshot_t snapshot;
+    snapshot.pos = map_state->pos;
+    snapshot.angle = map_state->angle;
+    snapshot.selected_bb = map_state->selected_bb;
+    snapshot.selected_region = map_state->selected_region;
+    snapshot.selected_location = map_state->selected_location;
+    snapshot.different = map_state->different;
+    snapshot.check_sanity_count = map_state->check_sanity_count;
+    snapshot.bbs = share_section(prev ? prev->bbs : nullptr, map_state->bbs, snapshot.size);
+    for (int i = 0; i < (int)map_state->regions.size(); ++i)
+        snapshot.regions.push_back(share_section(
+            prev && i < (int)prev->regions.size() ? prev->regions[i] : nullptr,
+            map_state->regions[i], snapshot.size));
+    snapshot.world_rules = share_section(prev ? prev->world_rules : nullptr, map_state->world_rules, snapshot.size);
+    snapshot.exit_rules = share_section(prev ? prev->exit_rules : nullptr, map_state->exit_rules, snapshot.size);
+    snapshot.accesses = share_section(prev ? prev->accesses : nullptr, map_state->accesses, snapshot.size);
+    snapshot.locations = share_section(prev ? prev->locations : nullptr, map_state->locations, snapshot.size, same_locations);
+
+    // Nothing but selection changed (i.e. clicking around), fold it into the
+    // last point instead of growing the history.
+    if (prev && same_content(*prev, snapshot))
+    {
+        snapshot.size = prev->size;
+        map_history->history.back() = snapshot;
+        update_logic();
+        return;
+    }
+
+    map_history->size += snapshot.size;
+    map_history->history.push_back(snapshot);
+    while (map_history->size > MAX_HISTORY_SIZE && map_history->history.size() > 1)
+    {
+        map_history->size -= map_history->history.front().size;
+        map_history->history.pop_front();
+    }
     map_history->history_point = (int)map_history->history.size() - 1;
+    update_logic();
+}
+
+
+static void restore_undo(const map_snapshot_t& snapshot)
+{
+    map_state->pos = snapshot.pos;
+    map_state->angle = snapshot.angle;
+    map_state->selected_bb = snapshot.selected_bb;
+    map_state->selected_region = snapshot.selected_region;
+    map_state->selected_location = snapshot.selected_location;
+    map_state->different = snapshot.different;
+    map_state->check_sanity_count = snapshot.check_sanity_count;
+    map_state->bbs = *snapshot.bbs;
+    map_state->regions.clear();
+    for (const auto& region : snapshot.regions)
+        map_state->regions.push_back(*region);
+    map_state->world_rules = *snapshot.world_rules;
+    map_state->exit_rules = *snapshot.exit_rules;
+    map_state->accesses = *snapshot.accesses;
+    map_state->locations = *snapshot.locations;
 }
 
 
@@ -449,6 +454,8 @@ void select_map(game_t* game, int ep, int map)
     update_window_title();
     if (map_history->history.empty())
         push_undo();
+    else
+        update_logic();
 }
 
 
@@ -457,7 +464,8 @@ void undo()
     if (map_history->history_point > 0)
     {
         map_history->history_point--;
-        *map_state = map_history->history[map_history->history_point];
+        restore_undo(map_history->history[map_history->history_point]);
+        update_logic();
 
         map_state->check_sanity_count = 0;
         for (const auto& loc : map_state->locations)
@@ -471,7 +479,8 @@ void redo()
     if (map_history->history_point < (int)map_history->history.size() - 1)
     {
         map_history->history_point++;
-        *map_state = map_history->history[map_history->history_point];
+        restore_undo(map_history->history[map_history->history_point]);
+        update_logic();
     }
 }
 
@@ -548,7 +557,8 @@ void init()
     for (auto& kv : games)
     {
         auto game = &kv.second;
-        load(game);
+        if (!load(game))
+            onut::showMessageBox("Warning", "Warning: File not found. (If you just created this game, then it's fine. Otherwise, scream).\ndata/" + game->name + ".json");
     }
     //load("regions_new.json", &metas_new);
 
@@ -779,25 +789,19 @@ int get_bb_at(const Vector2& pos, float zoom, int &edge)
 int get_loc_at(const Vector2& pos)
 {
     auto map = get_map(active_level);
-    auto game = get_game(active_level);
 
-    int index = 0;
-    for (const auto& thing : map->things)
+    // Only the locations whose box overlaps this cell
+    auto cell = location_cell_at((int)std::floor(pos.x), (int)std::floor(-pos.y), map);
+    if (!cell) return -1;
+
+    for (auto index : *cell)
     {
-        if (thing.flags & 0x0010)
-        {
-            ++index;
-            continue; // Thing is not in single player
-        }
-        if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
+        const auto& thing = map->things[index];
+        Rect rect((float)thing.x - 32.0f, (float)-thing.y - 32.0f, 64.0f, 64.0f);
+        if (rect.Contains(pos))
         {
-            Rect rect((float)thing.x - 32.0f, (float)-thing.y - 32.0f, 64.0f, 64.0f);
-            if (rect.Contains(pos))
-            {
-                return index;
-            }
+            return index;
         }
-        ++index;
     }
 
     return -1;
@@ -1339,16 +1343,17 @@ void draw_guides()
 }
 
 
-region_t* get_region_for_sector(map_state_t* map_state, int sector)
+// Region of each sector, in one pass over the regions' sector sets
+static void get_sector_regions(map_state_t* map_state, int sector_count, std::vector<region_t*>& sector_regions)
 {
-    for (auto& region : map_state->regions)
+    sector_regions.assign(sector_count, nullptr);
+    for (int i = (int)map_state->regions.size() - 1; i >= 0; --i)
     {
-        if (region.sectors.count(sector))
-        {
-            return &region;
-        }
+        auto& region = map_state->regions[i];
+        for (auto sector : region.sectors)
+            if (sector >= 0 && sector < sector_count)
+                sector_regions[sector] = &region; // First region wins
     }
-    return nullptr;
 }
 
 
@@ -1538,10 +1543,141 @@ void draw_rules()
 }
 
 
-void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool draw_tools)
+// What draw_level() needs from a map that never changes, so a frame walks
+// flat arrays instead of classifying every line and thing again.
+struct level_draw_cache_t
 {
+    std::vector<Vector2> line_points; // 2 per linedef
+    std::vector<Color> line_colors;
+    std::vector<Color> line_tool_colors; // With doors and exits colored
+    std::vector<Vector2> sector_points; // Triangle lists
+    std::vector<int> sector_first_point; // Per sector, plus one past the end
+    std::vector<int> location_things;
+    std::vector<Vector2> player_starts;
+    std::vector<Vector2> wings;
+};
+
+static std::map<const map_t*, level_draw_cache_t> level_draw_caches;
+
+
+static Color get_line_tool_color(const game_t* game, const map_linedefs_t& line, Color color)
+{
+    bool is_heretic = game->codename == "heretic";
+    if (is_heretic)
+    {
+        if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
+            color = game->key_colors[1];
+        else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
+            color = game->key_colors[0];
+        else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
+            color = game->key_colors[2];
+    }
+    else
+    {
+        if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
+            color = game->key_colors[2];
+        else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
+            color = game->key_colors[1];
+        else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
+            color = game->key_colors[0];
+    }
+
+    if (line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
+        line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+        line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE ||
+        line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+        line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE ||
+        line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE_FAST ||
+        line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE ||
+        line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+        line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
+        line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_FAST ||
+        line.special_type == LT_D1_DOOR_OPEN_STAY ||
+        line.special_type == LT_D1_DOOR_OPEN_STAY_FAST ||
+        line.special_type == LT_SR_DOOR_OPEN_STAY ||
+        line.special_type == LT_SR_DOOR_OPEN_STAY_FAST ||
+        line.special_type == LT_S1_DOOR_OPEN_STAY ||
+        line.special_type == LT_S1_DOOR_OPEN_STAY_FAST ||
+        line.special_type == LT_GR_DOOR_OPEN_STAY ||
+        line.special_type == LT_SR_DOOR_CLOSE_STAY ||
+        line.special_type == LT_SR_DOOR_CLOSE_STAY_FAST ||
+        line.special_type == LT_S1_DOOR_CLOSE_STAY ||
+        line.special_type == LT_S1_DOOR_CLOSE_STAY_FAST)
+        color = Color(0, 1, 1);
+    else if (line.special_type == LT_S1_EXIT_LEVEL ||
+        line.special_type == LT_W1_EXIT_LEVEL ||
+        line.special_type == LT_S1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL ||
+        line.special_type == LT_W1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL)
+        color = Color(0, 0.5f, 1);
+
+    return color;
+}
+
+
+static const level_draw_cache_t& get_level_draw_cache(const game_t* game, const map_t* map)
+{
+    auto it = level_draw_caches.find(map);
+    if (it != level_draw_caches.end()) return it->second;
+
+    auto& cache = level_draw_caches[map];
+
     Color bound_color(1.0f);
     Color step_color(0.35f);
+    for (const auto& line : map->linedefs)
+    {
+        Color color = bound_color;
+        if (line.back_sidedef != -1) color = step_color;
+        cache.line_points.push_back(Vector2(map->vertexes[line.start_vertex].x, -map->vertexes[line.start_vertex].y));
+        cache.line_points.push_back(Vector2(map->vertexes[line.end_vertex].x, -map->vertexes[line.end_vertex].y));
+        cache.line_colors.push_back(color);
+        cache.line_tool_colors.push_back(get_line_tool_color(game, line, color));
+    }
+
+    for (const auto& sector : map->sectors)
+    {
+        cache.sector_first_point.push_back((int)cache.sector_points.size());
+        for (auto v : sector.vertices)
+            cache.sector_points.push_back(Vector2(map->vertexes[v].x, -map->vertexes[v].y));
+    }
+    cache.sector_first_point.push_back((int)cache.sector_points.size());
+
+    bool is_heretic = game->codename == "heretic";
+    for (int i = 0; i < (int)map->things.size(); ++i)
+    {
+        const auto& thing = map->things[i];
+        if (thing.flags & 0x0010) continue; // Thing is not in single player
+        if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
+            cache.location_things.push_back(i);
+        else if (thing.type == 1) // Player start
+            cache.player_starts.push_back(Vector2(thing.x, -thing.y));
+        else if (thing.type == 83 && is_heretic) // Wings
+            cache.wings.push_back(Vector2(thing.x, -thing.y));
+    }
+
+    return cache;
+}
+
+
+void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool draw_tools)
+{
     Color bb_color(0.5f);
 
     auto pb = oPrimitiveBatch.get();
@@ -1549,6 +1685,7 @@ void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool
     auto game = get_game(idx);
     auto map = get_map(idx);
     auto map_state = get_state(idx, active_source);
+    const auto& cache = get_level_draw_cache(game, map);
     oRenderer->renderStates.backFaceCull = false;
 
     auto transform = 
@@ -1559,26 +1696,17 @@ void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool
     // Sectors
     if (draw_tools)
     {
+        static std::vector<region_t*> sector_regions;
+        get_sector_regions(map_state, (int)map->sectors.size(), sector_regions);
+
         pb->begin(OPrimitiveTriangleList, nullptr, transform);
-        int i = 0;
-        for (const auto& sector : map->sectors)
+        for (int i = 0, len = (int)map->sectors.size(); i < len; ++i)
         {
-            region_t* region = get_region_for_sector(map_state, i);
-            if (region)
-            {
-                Color color = region->tint * 0.5f;
-                for (int i = 0, len = (int)sector.vertices.size(); i < len; i += 3)
-                {
-                    const auto& v1 = map->vertexes[sector.vertices[i + 0]];
-                    const auto& v2 = map->vertexes[sector.vertices[i + 1]];
-                    const auto& v3 = map->vertexes[sector.vertices[i + 2]];
-
-                    pb->draw(Vector2(v1.x, -v1.y), color);
-                    pb->draw(Vector2(v2.x, -v2.y), color);
-                    pb->draw(Vector2(v3.x, -v3.y), color);
-                }
-            }
-            ++i;
+            region_t* region = sector_regions[i];
+            if (!region) continue;
+            Color color = region->tint * 0.5f;
+            for (int j = cache.sector_first_point[i], end = cache.sector_first_point[i + 1]; j < end; ++j)
+                pb->draw(cache.sector_points[j], color);
         }
         pb->end();
     }
@@ -1593,97 +1721,24 @@ void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool
     //pb->draw(Vector2(map->bb[2], -map->bb[1]), bb_color); pb->draw(Vector2(map->bb[0], -map->bb[1]), bb_color);
 
     // Geometry
-    int i = 0;
-    bool is_heretic = game->codename == "heretic";
-    for (const auto& line : map->linedefs)
+    const auto& line_colors = draw_tools ? cache.line_tool_colors : cache.line_colors;
+    bool highlight_sector = draw_tools && tool == tool_t::region && mouse_hover_sector != -1;
+    for (int i = 0, len = (int)map->linedefs.size(); i < len; ++i)
     {
-        Color color = bound_color;
-        if (line.back_sidedef != -1) color = step_color;
+        Color color = line_colors[i];
 
-        if (draw_tools)
+        if (highlight_sector)
         {
-            if (is_heretic)
-            {
-                if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
-                    color = game->key_colors[1];
-                else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
-                    color = game->key_colors[0];
-                else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
-                    color = game->key_colors[2];
-            }
-            else
+            const auto& line = map->linedefs[i];
+            if ((line.back_sidedef != -1 && map->sidedefs[line.back_sidedef].sector == mouse_hover_sector) ||
+                (line.front_sidedef != -1 && map->sidedefs[line.front_sidedef].sector == mouse_hover_sector))
             {
-                if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
-                    color = game->key_colors[2];
-                else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
-                    color = game->key_colors[1];
-                else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
-                    color = game->key_colors[0];
-            }
-
-            if (line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
-                line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
-                line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_D1_DOOR_OPEN_STAY ||
-                line.special_type == LT_D1_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_SR_DOOR_OPEN_STAY ||
-                line.special_type == LT_SR_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_S1_DOOR_OPEN_STAY ||
-                line.special_type == LT_S1_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_GR_DOOR_OPEN_STAY ||
-                line.special_type == LT_SR_DOOR_CLOSE_STAY ||
-                line.special_type == LT_SR_DOOR_CLOSE_STAY_FAST ||
-                line.special_type == LT_S1_DOOR_CLOSE_STAY ||
-                line.special_type == LT_S1_DOOR_CLOSE_STAY_FAST)
                 color = Color(0, 1, 1);
-            else if (line.special_type == LT_S1_EXIT_LEVEL ||
-                line.special_type == LT_W1_EXIT_LEVEL ||
-                line.special_type == LT_S1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL ||
-                line.special_type == LT_W1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL)
-                color = Color(0, 0.5f, 1);
-        }
-
-        if (draw_tools && tool == tool_t::region)
-        {
-            if (mouse_hover_sector != -1)
-            {
-                if ((line.back_sidedef != -1 && map->sidedefs[line.back_sidedef].sector == mouse_hover_sector) ||
-                    (line.front_sidedef != -1 && map->sidedefs[line.front_sidedef].sector == mouse_hover_sector))
-                {
-                    color = Color(0, 1, 1);
-                }
             }
         }
-        
-        pb->draw(Vector2(map->vertexes[line.start_vertex].x, -map->vertexes[line.start_vertex].y), color);
-        pb->draw(Vector2(map->vertexes[line.end_vertex].x, -map->vertexes[line.end_vertex].y), color);
 
-        ++i;
+        pb->draw(cache.line_points[i * 2 + 0], color);
+        pb->draw(cache.line_points[i * 2 + 1], color);
     }
 
     // Arrows
@@ -1762,32 +1817,29 @@ void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool
     // Items
     sb->begin(transform);
     oRenderer->renderStates.sampleFiltering = OFilterNearest;
-    i = -1;
-    for (const auto& thing : map->things)
+    const auto& logic = get_meta(idx, active_source)->logic;
+    for (auto i : cache.location_things)
     {
-        ++i;
-        if (thing.flags & 0x0010) continue; // Thing is not in single player
-        if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
-        {
-            //ap_deathlogic_icon
-            if (map_state->locations[i].death_logic)
-                sb->drawSprite(ap_deathlogic_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 1.0f);
-            else
-                sb->drawSprite(ap_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 2.0f);
-            if (map_state->locations[i].unreachable)
-                sb->drawSprite(ap_unreachable_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 1.0f);
-            else if (map_state->locations[i].check_sanity)
-                sb->drawSprite(ap_check_sanity_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 1.0f);
-        }
-        else if (thing.type == 1) // Player start
-        {
-            sb->drawSprite(ap_player_start_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 2.5f);
-        }
-        else if (thing.type == 83 && game->codename == "heretic") // Wings
-        {
-            sb->drawSprite(ap_wing_icon, Vector2(thing.x, -thing.y), Color::White, 0.0f, 2.5f);
-        }
+        Vector2 thing_pos(map->things[i].x, -map->things[i].y);
+        const auto& location = map_state->locations[i];
+
+        if (draw_tools && logic.unreachable.count(i))
+            sb->drawOutterOutlineRect(Rect(thing_pos.x - 32.0f, thing_pos.y - 32.0f, 64.0f, 64.0f), 4.0f / map_view->cam_zoom, Color(1, 0, 1));
+
+        //ap_deathlogic_icon
+        if (location.death_logic)
+            sb->drawSprite(ap_deathlogic_icon, thing_pos, Color::White, 0.0f, 1.0f);
+        else
+            sb->drawSprite(ap_icon, thing_pos, Color::White, 0.0f, 2.0f);
+        if (location.unreachable)
+            sb->drawSprite(ap_unreachable_icon, thing_pos, Color::White, 0.0f, 1.0f);
+        else if (location.check_sanity)
+            sb->drawSprite(ap_check_sanity_icon, thing_pos, Color::White, 0.0f, 1.0f);
     }
+    for (const auto& player_start : cache.player_starts)
+        sb->drawSprite(ap_player_start_icon, player_start, Color::White, 0.0f, 2.5f);
+    for (const auto& wing : cache.wings)
+        sb->drawSprite(ap_wing_icon, wing, Color::White, 0.0f, 2.5f);
     sb->end();
 }
 
@@ -2187,6 +2239,11 @@ void renderUI()
             auto map = get_map(active_level);
             auto game = get_game(active_level);
             ImGui::Text("Check count: %i", map->check_count);
+            const auto& logic = get_meta(active_level)->logic;
+            ImGui::Text("Logic: %i unreachable, %i in sphere 1, exit %s",
+                        (int)logic.unreachable.size(), (int)logic.sphere1.size(),
+                        logic.exit_reachable ? "reachable" : "UNREACHABLE");
+            ImGui::Text("Solved in %.3f ms", logic.solve_ms);
             ImGui::Separator();
             int index = 0;
             for (const auto& thing : map->things)
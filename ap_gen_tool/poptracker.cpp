@@ -0,0 +1,552 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *PopTracker map images and pack JSON, rendered without a window so the
+// batch mode can make them too*
+//
+
+#include "poptracker.h"
+#include "data.h"
+#include "maps.h"
+
+#include <stdio.h>
+#include <cinttypes>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <filesystem>
+#include <json/json.h>
+#include <onut/Log.h>
+
+
+#define MAP_IMAGE_SIZE 1024 // Pixels, along the longest side of the level
+#define MAP_IMAGE_MARGIN 16
+#define LOCATION_SIZE 16
+
+
+struct rgb_t
+{
+    uint8_t r, g, b;
+};
+
+
+static rgb_t to_rgb(const Color& color)
+{
+    return {
+        (uint8_t)(std::clamp(color.r, 0.0f, 1.0f) * 255.0f),
+        (uint8_t)(std::clamp(color.g, 0.0f, 1.0f) * 255.0f),
+        (uint8_t)(std::clamp(color.b, 0.0f, 1.0f) * 255.0f)
+    };
+}
+
+
+// Map units to image pixels. Doom's y goes up, the image's goes down.
+struct map_transform_t
+{
+    float scale;
+    int x, y; // Map position of the image's top left, margin excluded
+    int w, h;
+
+    map_transform_t(const map_t* map)
+    {
+        int map_w = std::max(1, map->bb[2] - map->bb[0]);
+        int map_h = std::max(1, map->bb[3] - map->bb[1]);
+        scale = (float)(MAP_IMAGE_SIZE - MAP_IMAGE_MARGIN * 2) / (float)std::max(map_w, map_h);
+        x = map->bb[0];
+        y = map->bb[3];
+        w = (int)(map_w * scale) + MAP_IMAGE_MARGIN * 2 + 1;
+        h = (int)(map_h * scale) + MAP_IMAGE_MARGIN * 2 + 1;
+    }
+
+    Vector2 operator()(int map_x, int map_y) const
+    {
+        return {
+            MAP_IMAGE_MARGIN + (float)(map_x - x) * scale,
+            MAP_IMAGE_MARGIN + (float)(y - map_y) * scale
+        };
+    }
+};
+
+
+struct image_t
+{
+    int w, h;
+    std::vector<rgb_t> pixels;
+
+    image_t(int in_w, int in_h) : w(in_w), h(in_h), pixels(in_w * in_h, rgb_t{0, 0, 0}) {}
+
+    void set(int x, int y, rgb_t color)
+    {
+        if (x >= 0 && y >= 0 && x < w && y < h)
+            pixels[y * w + x] = color;
+    }
+};
+
+
+static float edge(const Vector2& a, const Vector2& b, float x, float y)
+{
+    return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+}
+
+
+// Pixels whose center is inside, whichever way the triangle winds
+static void fill_triangle(image_t& image, const Vector2& a, const Vector2& b, const Vector2& c, rgb_t color)
+{
+    int x1 = std::max(0, (int)std::floor(std::min({a.x, b.x, c.x})));
+    int y1 = std::max(0, (int)std::floor(std::min({a.y, b.y, c.y})));
+    int x2 = std::min(image.w - 1, (int)std::ceil(std::max({a.x, b.x, c.x})));
+    int y2 = std::min(image.h - 1, (int)std::ceil(std::max({a.y, b.y, c.y})));
+
+    for (int y = y1; y <= y2; ++y)
+    {
+        for (int x = x1; x <= x2; ++x)
+        {
+            float px = (float)x + 0.5f;
+            float py = (float)y + 0.5f;
+            float w0 = edge(b, c, px, py);
+            float w1 = edge(c, a, px, py);
+            float w2 = edge(a, b, px, py);
+            if ((w0 >= 0 && w1 >= 0 && w2 >= 0) || (w0 <= 0 && w1 <= 0 && w2 <= 0))
+                image.pixels[y * image.w + x] = color;
+        }
+    }
+}
+
+
+static void draw_line(image_t& image, const Vector2& a, const Vector2& b, rgb_t color)
+{
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    int steps = (int)std::ceil(std::max(std::fabs(dx), std::fabs(dy)));
+    if (steps == 0)
+    {
+        image.set((int)a.x, (int)a.y, color);
+        return;
+    }
+    for (int i = 0; i <= steps; ++i)
+    {
+        float t = (float)i / (float)steps;
+        image.set((int)(a.x + dx * t), (int)(a.y + dy * t), color);
+    }
+}
+
+
+static void draw_marker(image_t& image, const Vector2& pos, rgb_t color)
+{
+    int cx = (int)pos.x;
+    int cy = (int)pos.y;
+    for (int y = -3; y <= 3; ++y)
+        for (int x = -3; x <= 3; ++x)
+            image.set(cx + x, cy + y, (x == -3 || x == 3 || y == -3 || y == 3) ? rgb_t{0, 0, 0} : color);
+}
+
+
+static void render_level(image_t& image, const map_transform_t& transform, const poptracker_level_t& level)
+{
+    const map_t* map = level.map;
+
+    // Sectors in a region take its tint, like in the editor
+    std::vector<Color> sector_colors(map->sectors.size(), Color(0.6f));
+    for (const auto& region : level.map_state->regions)
+        for (auto sector : region.sectors)
+            if (sector >= 0 && sector < (int)sector_colors.size())
+                sector_colors[sector] = region.tint;
+
+    for (int i = 0; i < (int)map->sectors.size(); ++i)
+    {
+        const auto& vertices = map->sectors[i].vertices;
+        float light = 0.25f + 0.35f * (float)map->map_sectors[i].light_level / 255.0f;
+        rgb_t color = to_rgb(sector_colors[i] * light);
+        for (int v = 0; v + 2 < (int)vertices.size(); v += 3)
+        {
+            const auto& v0 = map->vertexes[vertices[v]];
+            const auto& v1 = map->vertexes[vertices[v + 1]];
+            const auto& v2 = map->vertexes[vertices[v + 2]];
+            fill_triangle(image, transform(v0.x, v0.y), transform(v1.x, v1.y), transform(v2.x, v2.y), color);
+        }
+    }
+
+    // Steps first, so walls win where they overlap
+    const rgb_t bound_color = to_rgb(Color(1.0f));
+    const rgb_t step_color = to_rgb(Color(0.35f));
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const auto& line : map->linedefs)
+        {
+            bool is_step = line.back_sidedef != -1;
+            if (is_step != (pass == 0)) continue;
+            const auto& v1 = map->vertexes[line.start_vertex];
+            const auto& v2 = map->vertexes[line.end_vertex];
+            draw_line(image, transform(v1.x, v1.y), transform(v2.x, v2.y), is_step ? step_color : bound_color);
+        }
+    }
+
+    const rgb_t location_color = to_rgb(Color(1, 1, 0));
+    for (const auto& location : level.locations)
+    {
+        if (location.thing < 0) continue;
+        const auto& thing = map->things[location.thing];
+        draw_marker(image, transform(thing.x, thing.y), location_color);
+    }
+}
+
+
+//
+// PNG, compressed with fixed Huffman codes and matches against the pixel
+// to the left and the one above. Map images are mostly flat colors, so
+// that's nearly all the compressing there is to have.
+//
+
+struct bit_writer_t
+{
+    std::string& out;
+    uint32_t bits = 0;
+    int count = 0;
+
+    bit_writer_t(std::string& in_out) : out(in_out) {}
+
+    void put(uint32_t value, int n)
+    {
+        bits |= value << count;
+        count += n;
+        while (count >= 8)
+        {
+            out.push_back((char)(bits & 0xFF));
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+
+    // Huffman codes go most significant bit first
+    void put_code(uint32_t code, int n)
+    {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; ++i)
+            reversed |= ((code >> i) & 1) << (n - 1 - i);
+        put(reversed, n);
+    }
+
+    void flush()
+    {
+        if (count > 0) out.push_back((char)(bits & 0xFF));
+        bits = 0;
+        count = 0;
+    }
+};
+
+
+static void put_litlen(bit_writer_t& writer, int value)
+{
+    if (value <= 143) writer.put_code(0x30 + value, 8);
+    else if (value <= 255) writer.put_code(0x190 + value - 144, 9);
+    else if (value <= 279) writer.put_code(value - 256, 7);
+    else writer.put_code(0xC0 + value - 280, 8);
+}
+
+
+static void put_match(bit_writer_t& writer, int length, int distance)
+{
+    static const int length_base[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const int length_extra[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const int distance_base[] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    static const int distance_extra[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    int code = 28;
+    while (length_base[code] > length) --code;
+    put_litlen(writer, 257 + code);
+    writer.put(length - length_base[code], length_extra[code]);
+
+    code = 29;
+    while (distance_base[code] > distance) --code;
+    writer.put_code(code, 5);
+    writer.put(distance - distance_base[code], distance_extra[code]);
+}
+
+
+static void deflate(std::string& out, const std::string& data, int stride)
+{
+    const int size = (int)data.size();
+    const int distances[] = {3, stride}; // Left pixel, pixel above
+
+    bit_writer_t writer(out);
+    writer.put(1, 1); // Last block
+    writer.put(1, 2); // Fixed Huffman codes
+
+    for (int i = 0; i < size;)
+    {
+        int best_length = 0;
+        int best_distance = 0;
+        for (int distance : distances)
+        {
+            if (distance > i || distance > 32768) continue;
+            int length = 0;
+            int max_length = std::min(258, size - i);
+            while (length < max_length && data[i + length] == data[i + length - distance])
+                ++length;
+            if (length > best_length)
+            {
+                best_length = length;
+                best_distance = distance;
+            }
+        }
+
+        if (best_length >= 3)
+        {
+            put_match(writer, best_length, best_distance);
+            i += best_length;
+        }
+        else
+        {
+            put_litlen(writer, (uint8_t)data[i]);
+            ++i;
+        }
+    }
+
+    put_litlen(writer, 256); // End of block
+    writer.flush();
+}
+
+
+static uint32_t crc32(const std::string& data, size_t offset)
+{
+    static uint32_t table[256];
+    static std::once_flag table_once;
+    std::call_once(table_once, []()
+    {
+        for (uint32_t n = 0; n < 256; ++n)
+        {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+    });
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = offset; i < data.size(); ++i)
+        crc = table[(crc ^ (uint8_t)data[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+
+static void put_be32(std::string& out, uint32_t value)
+{
+    out.push_back((char)(value >> 24));
+    out.push_back((char)(value >> 16));
+    out.push_back((char)(value >> 8));
+    out.push_back((char)value);
+}
+
+
+static void put_chunk(std::string& png, const char* type, const std::string& data)
+{
+    put_be32(png, (uint32_t)data.size());
+    size_t start = png.size();
+    png.append(type, 4);
+    png.append(data);
+    put_be32(png, crc32(png, start));
+}
+
+
+static std::string encode_png(const image_t& image)
+{
+    // Rows of RGB, each after a filter byte of 0
+    const int stride = image.w * 3 + 1;
+    std::string raw;
+    raw.reserve((size_t)stride * image.h);
+    for (int y = 0; y < image.h; ++y)
+    {
+        raw.push_back(0);
+        for (int x = 0; x < image.w; ++x)
+        {
+            const auto& pixel = image.pixels[y * image.w + x];
+            raw.push_back((char)pixel.r);
+            raw.push_back((char)pixel.g);
+            raw.push_back((char)pixel.b);
+        }
+    }
+
+    std::string zlib = {0x78, 0x01};
+    deflate(zlib, raw, stride);
+
+    uint32_t a = 1, b = 0;
+    for (char c : raw)
+    {
+        a = (a + (uint8_t)c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_be32(zlib, (b << 16) | a);
+
+    std::string header;
+    put_be32(header, (uint32_t)image.w);
+    put_be32(header, (uint32_t)image.h);
+    header.push_back(8); // Bit depth
+    header.push_back(2); // RGB
+    header.push_back(0); // Compression
+    header.push_back(0); // Filter
+    header.push_back(0); // No interlace
+
+    std::string png = "\x89PNG\r\n\x1a\n";
+    put_chunk(png, "IHDR", header);
+    put_chunk(png, "IDAT", zlib);
+    put_chunk(png, "IEND", "");
+    return png;
+}
+
+
+// Same as generate's outputs: unchanged files keep their timestamp
+static bool write_file(const std::string& path, const std::string& content)
+{
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f)
+    {
+        std::string existing;
+        char buf[4096];
+        size_t read;
+        while ((read = fread(buf, 1, sizeof(buf), f)) > 0)
+            existing.append(buf, read);
+        fclose(f);
+        if (existing == content)
+        {
+            OLog("Unchanged: " + path);
+            return true;
+        }
+    }
+
+    std::string new_path = path + ".new";
+    f = fopen(new_path.c_str(), "wb");
+    if (!f)
+    {
+        OLogE("Cannot write file: " + path);
+        return false;
+    }
+    bool written = fwrite(content.data(), 1, content.size(), f) == content.size();
+    written = fclose(f) == 0 && written;
+
+    std::error_code ec;
+    if (written) std::filesystem::rename(new_path, path, ec);
+    if (!written || ec)
+    {
+        std::filesystem::remove(new_path, ec);
+        OLogE("Cannot write file: " + path);
+        return false;
+    }
+    return true;
+}
+
+
+bool export_poptracker(const game_t* game, const std::vector<poptracker_level_t>& levels, const std::string& out_dir)
+{
+    std::filesystem::path root = std::filesystem::path(out_dir) / game->codename;
+    std::error_code ec;
+    std::filesystem::create_directories(root / "images" / "maps", ec);
+    std::filesystem::create_directories(root / "maps", ec);
+    std::filesystem::create_directories(root / "locations", ec);
+    std::filesystem::create_directories(root / "layouts", ec);
+
+    // Levels only read their own map, so each worker takes the next one
+    // until they are all done.
+    std::atomic<size_t> next_level(0);
+    std::atomic<int> failed(0);
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, (unsigned int)std::max((size_t)1, levels.size()));
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < thread_count; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            for (size_t j = next_level++; j < levels.size(); j = next_level++)
+            {
+                const auto& level = levels[j];
+                map_transform_t transform(level.map);
+                image_t image(transform.w, transform.h);
+                render_level(image, transform, level);
+                if (!write_file((root / "images" / "maps" / (level.id + ".png")).string(), encode_png(image)))
+                    failed++;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    Json::Value maps_json(Json::arrayValue);
+    Json::Value locations_json(Json::arrayValue);
+    Json::Value episode_tabs(Json::arrayValue);
+
+    for (const auto& level : levels)
+    {
+        map_transform_t transform(level.map);
+
+        Json::Value map_json;
+        map_json["name"] = level.id;
+        map_json["location_size"] = LOCATION_SIZE;
+        map_json["location_border_thickness"] = 1;
+        map_json["img"] = "images/maps/" + level.id + ".png";
+        maps_json.append(map_json);
+
+        Json::Value level_json;
+        level_json["name"] = level.name;
+        level_json["children"] = Json::Value(Json::arrayValue);
+        for (const auto& location : level.locations)
+        {
+            Json::Value section_json;
+            section_json["name"] = location.name;
+            section_json["item_count"] = 1;
+
+            Json::Value location_json;
+            location_json["name"] = location.name;
+            location_json["sections"].append(section_json);
+            if (location.thing >= 0)
+            {
+                const auto& thing = level.map->things[location.thing];
+                auto pos = transform(thing.x, thing.y);
+                Json::Value map_location_json;
+                map_location_json["map"] = level.id;
+                map_location_json["x"] = (int)pos.x;
+                map_location_json["y"] = (int)pos.y;
+                location_json["map_locations"].append(map_location_json);
+            }
+            level_json["children"].append(location_json);
+        }
+        locations_json.append(level_json);
+
+        // A tab per episode, holding a tab per level
+        while ((int)episode_tabs.size() <= level.ep)
+        {
+            Json::Value episode_tab;
+            episode_tab["title"] = "Episode " + std::to_string(episode_tabs.size() + 1);
+            episode_tab["content"]["type"] = "tabbed";
+            episode_tab["content"]["tabs"] = Json::Value(Json::arrayValue);
+            episode_tabs.append(episode_tab);
+        }
+        Json::Value level_tab;
+        level_tab["title"] = level.name;
+        level_tab["content"]["type"] = "map";
+        level_tab["content"]["maps"].append(level.id);
+        episode_tabs[level.ep]["content"]["tabs"].append(level_tab);
+    }
+
+    Json::Value layout_json;
+    layout_json["tracker_default"]["type"] = "tabbed";
+    layout_json["tracker_default"]["tabs"] = episode_tabs;
+
+    if (!write_file((root / "maps" / "maps.json").string(), maps_json.toStyledString())) failed++;
+    if (!write_file((root / "locations" / "locations.json").string(), locations_json.toStyledString())) failed++;
+    if (!write_file((root / "layouts" / "tracker.json").string(), layout_json.toStyledString())) failed++;
+
+    return failed == 0;
+}
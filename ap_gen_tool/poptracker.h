@@ -0,0 +1,35 @@
+#pragma once
+
+
+#include <string>
+#include <vector>
+
+
+struct game_t;
+struct map_t;
+struct map_state_t;
+
+
+struct poptracker_location_t
+{
+    std::string name; // As the Archipelago location is named
+    int thing = -1; // Index in map_t::things, -1 if it has no place on the map (Exit)
+};
+
+
+struct poptracker_level_t
+{
+    std::string id; // File and map name, i.e. "doom_e1m1"
+    std::string name;
+    int ep = 0;
+    const map_t* map = nullptr;
+    const map_state_t* map_state = nullptr;
+    std::vector<poptracker_location_t> locations;
+};
+
+
+// Renders every level to images/maps/<id>.png and writes the maps, locations
+// and layout JSON of a PopTracker pack under out_dir. Levels are rendered on
+// worker threads and only read from. Files whose content didn't change are
+// left alone. Returns false if a file couldn't be written.
+bool export_poptracker(const game_t* game, const std::vector<poptracker_level_t>& levels, const std::string& out_dir);
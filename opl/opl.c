@@ -514,3 +514,47 @@ void OPL_AdjustCallbacks(float value)
     }
 }
 
+void OPL_SetOutputVolume(int volume)
+{
+    if (driver == &opl_sdl_driver)
+    {
+        OPL_SDL_SetOutputVolume(volume);
+    }
+}
+
+int OPL_StartCapture(void)
+{
+    if (driver == &opl_sdl_driver)
+    {
+        return OPL_SDL_StartCapture();
+    }
+
+    return 0;
+}
+
+void OPL_StopCapture(void)
+{
+    if (driver == &opl_sdl_driver)
+    {
+        OPL_SDL_StopCapture();
+    }
+}
+
+int16_t *OPL_GetCapture(unsigned int *nsamples, unsigned int *rate)
+{
+    if (driver == &opl_sdl_driver)
+    {
+        return OPL_SDL_GetCapture(nsamples, rate);
+    }
+
+    return NULL;
+}
+
+void OPL_CancelCapture(void)
+{
+    if (driver == &opl_sdl_driver)
+    {
+        OPL_SDL_CancelCapture();
+    }
+}
+
@@ -149,5 +149,31 @@ void OPL_Delay(uint64_t us);
 
 void OPL_SetPaused(int paused);
 
+// Scale the output of the software emulator (0 - 128). Has no effect
+// on real hardware.
+
+void OPL_SetOutputVolume(int volume);
+
+// Start recording the output of the software emulator into memory.
+// Returns zero if the current driver cannot record its output.
+
+int OPL_StartCapture(void);
+
+// Stop recording. This is intended to be called from a callback, so
+// that the recording ends exactly at the point the callback fires.
+// Otherwise OPL_Lock() must be held.
+
+void OPL_StopCapture(void);
+
+// If a recording has been stopped, return it as interleaved 16-bit
+// stereo samples at the given rate; the caller frees the buffer.
+// Returns NULL if no finished recording is available.
+
+int16_t *OPL_GetCapture(unsigned int *nsamples, unsigned int *rate);
+
+// Discard any recording, finished or not.
+
+void OPL_CancelCapture(void);
+
 #endif
 
@@ -178,7 +178,6 @@ static const Bit8u ch_slot[18] = {
 // Envelope generator
 //
 
-typedef Bit16s(*envelope_sinfunc)(Bit16u phase, Bit16u envelope);
 typedef void(*envelope_genfunc)(opl3_slot *slott);
 
 static Bit16s OPL3_EnvelopeCalcExp(Bit32u level)
@@ -327,17 +326,6 @@ static Bit16s OPL3_EnvelopeCalcSin7(Bit16u phase, Bit16u envelope)
     return OPL3_EnvelopeCalcExp(out + (envelope << 3)) ^ neg;
 }
 
-static const envelope_sinfunc envelope_sin[8] = {
-    OPL3_EnvelopeCalcSin0,
-    OPL3_EnvelopeCalcSin1,
-    OPL3_EnvelopeCalcSin2,
-    OPL3_EnvelopeCalcSin3,
-    OPL3_EnvelopeCalcSin4,
-    OPL3_EnvelopeCalcSin5,
-    OPL3_EnvelopeCalcSin6,
-    OPL3_EnvelopeCalcSin7
-};
-
 enum envelope_gen_num
 {
     envelope_gen_num_attack = 0,
@@ -662,7 +650,21 @@ static void OPL3_SlotWriteE0(opl3_slot *slot, Bit8u data)
 
 static void OPL3_SlotGenerate(opl3_slot *slot)
 {
-    slot->out = envelope_sin[slot->reg_wf](slot->pg_phase_out + *slot->mod, slot->eg_out);
+    Bit16u phase = slot->pg_phase_out + *slot->mod;
+
+    // A switch rather than envelope_sin[], so that the waveforms can be
+    // inlined into the per-sample loop.
+    switch (slot->reg_wf)
+    {
+        case 0: slot->out = OPL3_EnvelopeCalcSin0(phase, slot->eg_out); break;
+        case 1: slot->out = OPL3_EnvelopeCalcSin1(phase, slot->eg_out); break;
+        case 2: slot->out = OPL3_EnvelopeCalcSin2(phase, slot->eg_out); break;
+        case 3: slot->out = OPL3_EnvelopeCalcSin3(phase, slot->eg_out); break;
+        case 4: slot->out = OPL3_EnvelopeCalcSin4(phase, slot->eg_out); break;
+        case 5: slot->out = OPL3_EnvelopeCalcSin5(phase, slot->eg_out); break;
+        case 6: slot->out = OPL3_EnvelopeCalcSin6(phase, slot->eg_out); break;
+        default: slot->out = OPL3_EnvelopeCalcSin7(phase, slot->eg_out); break;
+    }
 }
 
 static void OPL3_SlotCalcFB(opl3_slot *slot)
@@ -1175,6 +1177,17 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
     chip->writebuf_samplecnt++;
 }
 
+void OPL3_GenerateBlock(opl3_chip *chip, Bit16s *buf, Bit32u numsamples)
+{
+    Bit32u i;
+
+    for (i = 0; i < numsamples; i++)
+    {
+        OPL3_Generate(chip, buf);
+        buf += 2;
+    }
+}
+
 void OPL3_GenerateResampled(opl3_chip *chip, Bit16s *buf)
 {
     while (chip->samplecnt >= chip->rateratio)
@@ -1365,13 +1378,72 @@ void OPL3_WriteRegBuffered(opl3_chip *chip, Bit16u reg, Bit8u v)
     chip->writebuf_last = (chip->writebuf_last + 1) % OPL_WRITEBUF_SIZE;
 }
 
+// Chip rate samples are generated OPL3_BLOCK_SIZE at a time and then
+// resampled, which gives the same output as calling
+// OPL3_GenerateResampled for each sample.
+
 void OPL3_GenerateStream(opl3_chip *chip, Bit16s *sndptr, Bit32u numsamples)
 {
+    Bit16s block[OPL3_BLOCK_SIZE * 2];
+    Bit16s *in;
+    Bit32u outcount, blockcount, need;
+    Bit32s samplecnt, cnt;
     Bit32u i;
 
-    for(i = 0; i < numsamples; i++)
+    while (numsamples > 0)
     {
-        OPL3_GenerateResampled(chip, sndptr);
-        sndptr += 2;
+        // Work out how many output samples one block can cover.
+        samplecnt = chip->samplecnt;
+        outcount = 0;
+        blockcount = 0;
+
+        while (outcount < numsamples)
+        {
+            need = 0;
+            for (cnt = samplecnt; cnt >= chip->rateratio; cnt -= chip->rateratio)
+            {
+                need++;
+            }
+            if (blockcount + need > OPL3_BLOCK_SIZE)
+            {
+                break;
+            }
+            blockcount += need;
+            samplecnt = cnt + (1 << RSM_FRAC);
+            outcount++;
+        }
+
+        // Only at absurdly low output rates
+        if (outcount == 0)
+        {
+            OPL3_GenerateResampled(chip, sndptr);
+            sndptr += 2;
+            numsamples--;
+            continue;
+        }
+
+        OPL3_GenerateBlock(chip, block, blockcount);
+
+        in = block;
+        for (i = 0; i < outcount; i++)
+        {
+            while (chip->samplecnt >= chip->rateratio)
+            {
+                chip->oldsamples[0] = chip->samples[0];
+                chip->oldsamples[1] = chip->samples[1];
+                chip->samples[0] = in[0];
+                chip->samples[1] = in[1];
+                in += 2;
+                chip->samplecnt -= chip->rateratio;
+            }
+            sndptr[0] = (Bit16s)((chip->oldsamples[0] * (chip->rateratio - chip->samplecnt)
+                                + chip->samples[0] * chip->samplecnt) / chip->rateratio);
+            sndptr[1] = (Bit16s)((chip->oldsamples[1] * (chip->rateratio - chip->samplecnt)
+                                + chip->samples[1] * chip->samplecnt) / chip->rateratio);
+            chip->samplecnt += 1 << RSM_FRAC;
+            sndptr += 2;
+        }
+
+        numsamples -= outcount;
     }
 }
@@ -141,7 +141,12 @@ struct _opl3_chip {
     opl3_writebuf writebuf[OPL_WRITEBUF_SIZE];
 };
 
+// Chip rate samples generated per pass by OPL3_GenerateStream. Must
+// be more than the chip rate over the lowest output rate.
+#define OPL3_BLOCK_SIZE 512
+
 void OPL3_Generate(opl3_chip *chip, Bit16s *buf);
+void OPL3_GenerateBlock(opl3_chip *chip, Bit16s *buf, Bit32u numsamples);
 void OPL3_GenerateResampled(opl3_chip *chip, Bit16s *buf);
 void OPL3_Reset(opl3_chip *chip, Bit32u samplerate);
 void OPL3_WriteReg(opl3_chip *chip, Bit16u reg, Bit8u v);
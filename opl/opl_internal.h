@@ -66,6 +66,14 @@ extern opl_driver_t opl_win32_driver;
 #endif
 extern opl_driver_t opl_sdl_driver;
 
+// Output scaling and recording are only available from the emulator.
+
+void OPL_SDL_SetOutputVolume(int volume);
+int OPL_SDL_StartCapture(void);
+void OPL_SDL_StopCapture(void);
+int16_t *OPL_SDL_GetCapture(unsigned int *nsamples, unsigned int *rate);
+void OPL_SDL_CancelCapture(void);
+
 
 #endif /* #ifndef OPL_INTERNAL_H */
 
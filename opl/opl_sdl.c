@@ -82,6 +82,19 @@ static int opl_opl3mode;
 
 static uint8_t *mix_buffer = NULL;
 
+// Volume the emulator output is mixed at.
+
+static int output_volume = SDL_MIX_MAXVOLUME;
+
+// Recording of the emulator output; see OPL_StartCapture(). All of
+// this is protected by callback_mutex.
+
+#define CAPTURE_MAX_SECONDS (10 * 60)
+
+static int16_t *capture_buffer = NULL;
+static unsigned int capture_len, capture_size;
+static int capture_active, capture_finished;
+
 // Register number that was written.
 
 static int register_num = 0;
@@ -158,6 +171,44 @@ static void AdvanceTime(unsigned int nsamples)
     SDL_UnlockMutex(callback_queue_mutex);
 }
 
+// Append the contents of mix_buffer to the recording, giving up if it
+// grows too long.
+
+static void CaptureSamples(unsigned int nsamples)
+{
+    int16_t *new_buffer;
+    unsigned int new_size;
+
+    if (capture_len + nsamples > capture_size)
+    {
+        new_size = capture_size > 0 ? capture_size * 2 : mixing_freq * 30;
+
+        if (new_size > (unsigned int) mixing_freq * CAPTURE_MAX_SECONDS)
+        {
+            new_size = mixing_freq * CAPTURE_MAX_SECONDS;
+        }
+
+        new_buffer = NULL;
+
+        if (capture_len + nsamples <= new_size)
+        {
+            new_buffer = realloc(capture_buffer, new_size * 4);
+        }
+
+        if (new_buffer == NULL)
+        {
+            OPL_SDL_CancelCapture();
+            return;
+        }
+
+        capture_buffer = new_buffer;
+        capture_size = new_size;
+    }
+
+    memcpy(capture_buffer + capture_len * 2, mix_buffer, nsamples * 4);
+    capture_len += nsamples;
+}
+
 // Call the OPL emulator code to fill the specified buffer.
 
 static void FillBuffer(uint8_t *buffer, unsigned int nsamples)
@@ -171,7 +222,16 @@ static void FillBuffer(uint8_t *buffer, unsigned int nsamples)
     // (to avoid overflows etc.)
     OPL3_GenerateStream(&opl_chip, (Bit16s *) mix_buffer, nsamples);
     SDL_MixAudioFormat(buffer, mix_buffer, AUDIO_S16SYS, nsamples * 4,
-                       SDL_MIX_MAXVOLUME);
+                       output_volume);
+
+    SDL_LockMutex(callback_mutex);
+
+    if (capture_active && !opl_sdl_paused)
+    {
+        CaptureSamples(nsamples);
+    }
+
+    SDL_UnlockMutex(callback_mutex);
 }
 
 // Callback function to fill a new sound buffer:
@@ -250,6 +310,7 @@ static void OPL_SDL_Shutdown(void)
 
     if (callback_mutex != NULL)
     {
+        OPL_SDL_CancelCapture();
         SDL_DestroyMutex(callback_mutex);
         callback_mutex = NULL;
     }
@@ -493,6 +554,66 @@ static void OPL_SDL_SetPaused(int paused)
     opl_sdl_paused = paused;
 }
 
+void OPL_SDL_SetOutputVolume(int volume)
+{
+    SDL_LockMutex(callback_mutex);
+    output_volume = volume;
+    SDL_UnlockMutex(callback_mutex);
+}
+
+int OPL_SDL_StartCapture(void)
+{
+    SDL_LockMutex(callback_mutex);
+    OPL_SDL_CancelCapture();
+    capture_active = 1;
+    SDL_UnlockMutex(callback_mutex);
+
+    return 1;
+}
+
+void OPL_SDL_StopCapture(void)
+{
+    if (capture_active)
+    {
+        capture_active = 0;
+        capture_finished = 1;
+    }
+}
+
+int16_t *OPL_SDL_GetCapture(unsigned int *nsamples, unsigned int *rate)
+{
+    int16_t *result = NULL;
+
+    SDL_LockMutex(callback_mutex);
+
+    if (capture_finished && capture_len > 0)
+    {
+        result = capture_buffer;
+        *nsamples = capture_len;
+        *rate = mixing_freq;
+        capture_buffer = NULL;
+        capture_len = 0;
+        capture_size = 0;
+        capture_finished = 0;
+    }
+
+    SDL_UnlockMutex(callback_mutex);
+
+    return result;
+}
+
+void OPL_SDL_CancelCapture(void)
+{
+    SDL_LockMutex(callback_mutex);
+    free(capture_buffer);
+    capture_buffer = NULL;
+    capture_len = 0;
+    capture_size = 0;
+    capture_active = 0;
+    capture_finished = 0;
+    SDL_UnlockMutex(callback_mutex);
+}
+
 static void OPL_SDL_AdjustCallbacks(float factor)
 {
     SDL_LockMutex(callback_queue_mutex);
@@ -15,6 +15,9 @@
 //     OPL timer thread.
 //     Once started using OPL_Timer_StartThread, the thread sleeps,
 //     waking up to invoke callbacks set using OPL_Timer_SetCallback.
+//     The thread waits on a condition variable, so it is woken early
+//     when the queue changes and does not wake at all while there is
+//     nothing to do.
 //
 
 #include "SDL.h"
@@ -30,6 +33,7 @@ typedef enum
 } thread_state_t;
 
 static SDL_Thread *timer_thread = NULL;
+static SDL_threadID timer_thread_id;
 static thread_state_t timer_thread_state;
 static uint64_t current_time;
 
@@ -38,9 +42,10 @@ static uint64_t current_time;
 static int opl_timer_paused;
 
 // Offset in microseconds to adjust time due to the fact that playback
-// was paused.
+// was paused, and the time at which the current pause started.
 
 static uint64_t pause_offset = 0;
+static uint64_t pause_start;
 
 // Queue of callbacks waiting to be invoked.
 // The callback queue mutex is held while the callback queue structure
@@ -49,115 +54,125 @@ static uint64_t pause_offset = 0;
 static opl_callback_queue_t *callback_queue;
 static SDL_mutex *callback_queue_mutex;
 
+// Signalled whenever the timer thread may need to wake up earlier than
+// it planned to: a callback was added or rescheduled, playback was
+// paused or unpaused, or the thread is being stopped.
+
+static SDL_cond *callback_queue_cond;
+
 // The timer mutex is held while timer callback functions are being
 // invoked, so that the calling code can prevent clashes.
 
 static SDL_mutex *timer_mutex;
 
-// Returns true if there is a callback at the head of the queue ready
-// to be invoked.  Otherwise, next_time is set to the time when the
-// timer thread must wake up again to check.
+// Returns the current time in microseconds, using the high resolution
+// performance counter rather than the millisecond tick count.
 
-static int CallbackWaiting(uint64_t *next_time)
+static uint64_t GetTimeUS(void)
 {
-    // If paused, just wait in 50ms increments until unpaused.
-    // Update pause_offset so after we unpause, the callback 
-    // times will be right.
+    uint64_t counter = SDL_GetPerformanceCounter();
+    uint64_t freq = SDL_GetPerformanceFrequency();
 
-    if (opl_timer_paused)
-    {
-        *next_time = current_time + 50 * OPL_MS;
-        pause_offset += 50 * OPL_MS;
-        return 0;
-    }
+    // Split the conversion so that it does not overflow.
+
+    return (counter / freq) * OPL_SECOND
+         + (counter % freq) * OPL_SECOND / freq;
+}
 
-    // If there are no queued callbacks, sleep for 50ms at a time
-    // until a callback is added.
+// Sleep until the given time, or until the condition variable is
+// signalled. Called with the callback queue mutex held.
 
-    if (OPL_Queue_IsEmpty(callback_queue))
+static void WaitUntil(uint64_t next_time)
+{
+    uint64_t now = GetTimeUS();
+
+    if (next_time > now)
     {
-        *next_time = current_time + 50 * OPL_MS;
-        return 0;
-    }
+        // Round up, so that we don't wake just before the deadline
+        // and have to go straight back to sleep.
 
-    // Read the time of the first callback in the queue.
-    // If the time for the callback has not yet arrived,
-    // we must sleep until the callback time.
+        SDL_CondWaitTimeout(callback_queue_cond, callback_queue_mutex,
+                            (Uint32) ((next_time - now + OPL_MS - 1) / OPL_MS));
+    }
+}
 
-    *next_time = OPL_Queue_Peek(callback_queue) + pause_offset;
+// Callbacks set from inside a callback are relative to the time that
+// callback was scheduled for; anyone else is scheduling from now.
+// Called with the callback queue mutex held.
 
-    return *next_time <= current_time;
+static void UpdateCurrentTime(void)
+{
+    if (SDL_ThreadID() != timer_thread_id)
+    {
+        current_time = GetTimeUS();
+    }
 }
 
-static uint64_t GetNextTime(void)
+static int ThreadFunction(void *unused)
 {
     opl_callback_t callback;
     void *callback_data;
     uint64_t next_time;
-    int have_callback;
-
-    // Keep running through callbacks until there are none ready to
-    // run. When we run out of callbacks, next_time will be set.
+    uint64_t now;
 
-    do
-    {
-        SDL_LockMutex(callback_queue_mutex);
+    SDL_LockMutex(callback_queue_mutex);
 
-        // Check if the callback at the head of the list is ready to
-        // be invoked.  If so, pop from the head of the queue.
+    // Keep running until OPL_Timer_StopThread is called.
 
-        have_callback = CallbackWaiting(&next_time);
+    while (timer_thread_state == THREAD_STATE_RUNNING)
+    {
+        // If paused or there is nothing queued, sleep until we are
+        // told that something has changed.
 
-        if (have_callback)
+        if (opl_timer_paused || OPL_Queue_IsEmpty(callback_queue))
         {
-            OPL_Queue_Pop(callback_queue, &callback, &callback_data);
+            SDL_CondWait(callback_queue_cond, callback_queue_mutex);
+            current_time = GetTimeUS();
+            continue;
         }
 
-        SDL_UnlockMutex(callback_queue_mutex);
+        // Read the time of the first callback in the queue.
+        // If the time for the callback has not yet arrived,
+        // we must sleep until the callback time.
 
-        // Now invoke the callback, if we have one.
-        // The timer mutex is held while the callback is invoked.
+        next_time = OPL_Queue_Peek(callback_queue) + pause_offset;
 
-        if (have_callback)
+        if (next_time > current_time)
         {
-            SDL_LockMutex(timer_mutex);
-            callback(callback_data);
-            SDL_UnlockMutex(timer_mutex);
-        }
-    } while (have_callback);
+            now = GetTimeUS();
 
-    return next_time;
-}
+            if (next_time > now)
+            {
+                WaitUntil(next_time);
+                now = GetTimeUS();
+            }
 
-static int ThreadFunction(void *unused)
-{
-    uint64_t next_time;
-    uint64_t now;
+            // The callback runs at the time it was scheduled for, even
+            // if we woke a little late, so that timing errors don't
+            // accumulate from one callback to the next. If we were
+            // woken early, go round again as the queue has changed.
 
-    // Keep running until OPL_Timer_StopThread is called.
-
-    while (timer_thread_state == THREAD_STATE_RUNNING)
-    {
-        // Get the next time that we must sleep until, and
-        // wait until that time.
+            current_time = now < next_time ? now : next_time;
+            continue;
+        }
 
-        next_time = GetNextTime();
-        now = SDL_GetTicks() * OPL_MS;
+        OPL_Queue_Pop(callback_queue, &callback, &callback_data);
+        SDL_UnlockMutex(callback_queue_mutex);
 
-        if (next_time > now)
-        {
-            SDL_Delay((next_time - now) / OPL_MS);
-        }
+        // Now invoke the callback.
+        // The timer mutex is held while the callback is invoked.
 
-        // Update the current time.
+        SDL_LockMutex(timer_mutex);
+        callback(callback_data);
+        SDL_UnlockMutex(timer_mutex);
 
         SDL_LockMutex(callback_queue_mutex);
-        current_time = next_time;
-        SDL_UnlockMutex(callback_queue_mutex);
     }
 
     timer_thread_state = THREAD_STATE_STOPPED;
 
+    SDL_UnlockMutex(callback_queue_mutex);
+
     return 0;
 }
 
@@ -166,11 +181,13 @@ static void InitResources(void)
     callback_queue = OPL_Queue_Create();
     timer_mutex = SDL_CreateMutex();
     callback_queue_mutex = SDL_CreateMutex();
+    callback_queue_cond = SDL_CreateCond();
 }
 
 static void FreeResources(void)
 {
     OPL_Queue_Destroy(callback_queue);
+    SDL_DestroyCond(callback_queue_cond);
     SDL_DestroyMutex(callback_queue_mutex);
     SDL_DestroyMutex(timer_mutex);
 }
@@ -180,7 +197,7 @@ int OPL_Timer_StartThread(void)
     InitResources();
 
     timer_thread_state = THREAD_STATE_RUNNING;
-    current_time = SDL_GetTicks();
+    current_time = GetTimeUS();
     opl_timer_paused = 0;
     pause_offset = 0;
 
@@ -194,17 +211,20 @@ int OPL_Timer_StartThread(void)
         return 0;
     }
 
+    timer_thread_id = SDL_GetThreadID(timer_thread);
+
     return 1;
 }
 
 void OPL_Timer_StopThread(void)
 {
+    SDL_LockMutex(callback_queue_mutex);
     timer_thread_state = THREAD_STATE_STOPPING;
+    SDL_CondSignal(callback_queue_cond);
+    SDL_UnlockMutex(callback_queue_mutex);
 
-    while (timer_thread_state != THREAD_STATE_STOPPED)
-    {
-        SDL_Delay(1);
-    }
+    SDL_WaitThread(timer_thread, NULL);
+    timer_thread = NULL;
 
     FreeResources();
 }
@@ -212,8 +232,10 @@ void OPL_Timer_StopThread(void)
 void OPL_Timer_SetCallback(uint64_t us, opl_callback_t callback, void *data)
 {
     SDL_LockMutex(callback_queue_mutex);
+    UpdateCurrentTime();
     OPL_Queue_Push(callback_queue, callback, data,
                    current_time + us - pause_offset);
+    SDL_CondSignal(callback_queue_cond);
     SDL_UnlockMutex(callback_queue_mutex);
 }
 
@@ -227,7 +249,9 @@ void OPL_Timer_ClearCallbacks(void)
 void OPL_Timer_AdjustCallbacks(float factor)
 {
     SDL_LockMutex(callback_queue_mutex);
+    UpdateCurrentTime();
     OPL_Queue_AdjustCallbacks(callback_queue, current_time, factor);
+    SDL_CondSignal(callback_queue_cond);
     SDL_UnlockMutex(callback_queue_mutex);
 }
 
@@ -244,7 +268,21 @@ void OPL_Timer_Unlock(void)
 void OPL_Timer_SetPaused(int paused)
 {
     SDL_LockMutex(callback_queue_mutex);
+
+    // Keep track of how long we were paused for, so that after we
+    // unpause, the callback times will be right.
+
+    if (paused && !opl_timer_paused)
+    {
+        pause_start = GetTimeUS();
+    }
+    else if (!paused && opl_timer_paused)
+    {
+        pause_offset += GetTimeUS() - pause_start;
+    }
+
     opl_timer_paused = paused;
+    SDL_CondSignal(callback_queue_cond);
     SDL_UnlockMutex(callback_queue_mutex);
 }
 
@@ -15,6 +15,7 @@
 //    PC speaker interface.
 //
 
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -55,27 +56,172 @@ static int current_freq;
 
 static int phase_offset = 0;
 
+// Tones are played from blocks of samples starting at phase 0, made the
+// first time each frequency is played. A tone held for longer than a
+// block carries on with samples made one at a time.
+
+#define TONE_BLOCK_TIME 125 /* ms */
+#define NUM_TONE_BLOCKS 64
+
+typedef struct
+{
+    int freq;
+    Sint16 *samples;
+} tone_block_t;
+
+static tone_block_t tone_blocks[NUM_TONE_BLOCKS];
+static int next_tone_block;
+static int tone_block_len;
+static const Sint16 *current_block;
+
+// Correction for the step of a square wave at phase 0, for phase t of
+// a period that is dt long in samples (PolyBLEP).
+
+static double SquareStep(double t, double dt)
+{
+    if (t < dt)
+    {
+        t /= dt;
+        return t + t - t * t - 1.0;
+    }
+    else if (t > 1.0 - dt)
+    {
+        t = (t - 1.0) / dt;
+        return t * t + t + t + 1.0;
+    }
+
+    return 0.0;
+}
+
+// Band-limited square wave: no harmonics above half the mixing rate
+// folding back as the whistling of the plain square wave.
+
+static Sint16 ToneSample(int freq, int phase)
+{
+    const double dt = (double) freq / mixing_freq;
+    double t, value;
+
+    if (dt >= 0.5)
+    {
+        // Above what can be played at all
+
+        return 0;
+    }
+
+    t = fmod(phase * dt, 1.0);
+    value = t < 0.5 ? 1.0 : -1.0;
+    value += SquareStep(t, dt);
+    value -= SquareStep(fmod(t + 0.5, 1.0), dt);
+
+    return (Sint16) (value * SQUARE_WAVE_AMP);
+}
+
+static const Sint16 *GetToneBlock(int freq)
+{
+    tone_block_t *block;
+    int i;
+
+    for (i = 0; i < NUM_TONE_BLOCKS; ++i)
+    {
+        if (tone_blocks[i].samples != NULL && tone_blocks[i].freq == freq)
+        {
+            return tone_blocks[i].samples;
+        }
+    }
+
+    block = &tone_blocks[next_tone_block];
+    next_tone_block = (next_tone_block + 1) % NUM_TONE_BLOCKS;
+
+    if (block->samples == NULL)
+    {
+        block->samples = malloc(tone_block_len * sizeof(*block->samples));
+
+        if (block->samples == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    block->freq = freq;
+
+    for (i = 0; i < tone_block_len; ++i)
+    {
+        block->samples[i] = ToneSample(freq, i);
+    }
+
+    return block->samples;
+}
+
+static void FreeToneBlocks(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_TONE_BLOCKS; ++i)
+    {
+        free(tone_blocks[i].samples);
+        tone_blocks[i].samples = NULL;
+    }
+
+    next_tone_block = 0;
+    current_block = NULL;
+}
+
+// Add nsamples of the current tone to the stereo stream
+
+static void MixTone(Sint16 *ptr, int nsamples)
+{
+    int i;
+
+    if (current_block != NULL && phase_offset < tone_block_len)
+    {
+        const Sint16 *src = current_block + phase_offset;
+        int n = tone_block_len - phase_offset;
+
+        if (n > nsamples)
+        {
+            n = nsamples;
+        }
+
+        for (i = 0; i < n; ++i)
+        {
+            ptr[0] += src[i];
+            ptr[1] += src[i];
+            ptr += 2;
+        }
+
+        phase_offset += n;
+        nsamples -= n;
+    }
+
+    for (i = 0; i < nsamples; ++i)
+    {
+        const Sint16 value = ToneSample(current_freq, phase_offset);
+
+        ptr[0] += value;
+        ptr[1] += value;
+        ptr += 2;
+        ++phase_offset;
+    }
+}
+
 // Mixer function that does the PC speaker emulation
 
 static void PCSound_Mix_Callback(int chan, void *stream, int len, void *udata)
 {
-    Sint16 *leftptr;
-    Sint16 *rightptr;
-    Sint16 this_value;
+    Sint16 *ptr;
     int frequency;
-    int i;
     int nsamples;
+    int n;
 
     // Number of samples is quadrupled, because of 16-bit and stereo
 
     nsamples = len / 4;
 
-    leftptr = (Sint16 *) stream;
-    rightptr = ((Sint16 *) stream) + 1;
+    ptr = (Sint16 *) stream;
     
-    // Fill the output buffer
+    // Fill the output buffer, a tone at a time
 
-    for (i=0; i<nsamples; ++i)
+    while (nsamples > 0)
     {
         // Has this sound expired? If so, invoke the callback to get 
         // the next frequency.
@@ -90,50 +236,24 @@ static void PCSound_Mix_Callback(int chan, void *stream, int len, void *udata)
             {
                 current_freq = frequency;
                 phase_offset = 0;
+                current_block = frequency != 0 ? GetToneBlock(frequency) : NULL;
             }
 
             current_remaining = (current_remaining * mixing_freq) / 1000;
         }
 
-        // Set the value for this sample.
-        
-        if (current_freq == 0)
-        {
-            // Silence
-
-            this_value = 0;
-        }
-        else 
-        {
-            int frac;
-
-            // Determine whether we are at a peak or trough in the current
-            // sound.  Multiply by 2 so that frac % 2 will give 0 or 1 
-            // depending on whether we are at a peak or trough.
+        n = current_remaining < nsamples ? current_remaining : nsamples;
 
-            frac = (phase_offset * current_freq * 2) / mixing_freq;
+        // Nothing to add for silence
 
-            if ((frac % 2) == 0) 
-            {
-                this_value = SQUARE_WAVE_AMP;
-            }
-            else
-            {
-                this_value = -SQUARE_WAVE_AMP;
-            }
-
-            ++phase_offset;
+        if (current_freq != 0)
+        {
+            MixTone(ptr, n);
         }
 
-        --current_remaining;
-
-        // Use the same value for the left and right channels.
-
-        *leftptr += this_value;
-        *rightptr += this_value;
-
-        leftptr += 2;
-        rightptr += 2;
+        current_remaining -= n;
+        nsamples -= n;
+        ptr += 2 * n;
     }
 }
 
@@ -147,12 +267,22 @@ static int SDLIsInitialized(void)
 
 static void PCSound_SDL_Shutdown(void)
 {
+    // The mixer may carry on without us, and mustn't call back into
+    // tone blocks that are about to be freed.
+
+    if (SDLIsInitialized())
+    {
+        Mix_UnregisterEffect(MIX_CHANNEL_POST, PCSound_Mix_Callback);
+    }
+
     if (sdl_was_initialized)
     {
         Mix_CloseAudio();
         SDL_QuitSubSystem(SDL_INIT_AUDIO);
         sdl_was_initialized = 0;
     }
+
+    FreeToneBlocks();
 }
 
 // Calculate slice size, based on MAX_SOUND_SLICE_TIME.
@@ -234,6 +364,7 @@ static int PCSound_SDL_Init(pcsound_callback_func callback_func)
     callback = callback_func;
     current_freq = 0;
     current_remaining = 0;
+    tone_block_len = (mixing_freq * TONE_BLOCK_TIME) / 1000;
 
     Mix_RegisterEffect(MIX_CHANNEL_POST, PCSound_Mix_Callback, NULL, NULL);
 
@@ -0,0 +1,116 @@
+// [AP] Shared AP message line queue. The lines live in a ring buffer, so
+// taking one off doesn't move the rest of the queue, and each message is
+// measured in a single pass while it's wrapped.
+
+#include "ap_msgqueue.h"
+#include <string.h>
+
+
+static char ap_msg_queue[AP_MSG_MAXQUEUE][AP_MSG_MAXLINELENGTH + 1];
+static int ap_msg_queue_head = 0;
+static int ap_msg_queue_count = 0;
+
+
+static void ap_msgqueue_add_line(const char* line, int len)
+{
+    char* dest;
+
+    if (ap_msg_queue_count >= AP_MSG_MAXQUEUE)
+        return; // No more room
+
+    dest = ap_msg_queue[(ap_msg_queue_head + ap_msg_queue_count) % AP_MSG_MAXQUEUE];
+    memcpy(dest, line, len);
+    dest[len] = '\0';
+    ap_msg_queue_count++;
+}
+
+
+void ap_msgqueue_add(const char* message, int max_width, ap_msg_measure_t measure)
+{
+    int len = strlen(message);
+
+    int i = 0;
+    int j = 0;
+    char baked_line[AP_MSG_MAXLINELENGTH + 1];
+    int word_start = 0;
+
+    // Width of message[i, j), and where the measuring got to
+    int w = 0;
+    int k = 0;
+
+    baked_line[AP_MSG_MAXLINELENGTH] = '\0';
+
+    while (i < len)
+    {
+        if (message[j] == ' ')
+        {
+            word_start = j;
+        }
+        if (message[j] != '\n')
+        {
+            while (k < j)
+            {
+                int advance = 1;
+                w += measure(message + k, &advance);
+                k += advance;
+            }
+            if (w >= max_width && word_start == i)
+            {
+                if (j > i && word_start == i) --j;
+            }
+            else
+            {
+                if (w < max_width && (j - i) + 2 < AP_MSG_MAXLINELENGTH && j < len)
+                {
+                    j++;
+                    continue;
+                }
+                // A word too long for a line is cut rather than wrapped
+                if (j < len && word_start > i) j = word_start;
+            }
+        }
+        else
+        {
+            j++;
+            word_start = j;
+        }
+        memcpy(baked_line + 2, message + i, j - i);
+        baked_line[0] = '~'; baked_line[1] = '2'; // Always make sure to use white
+        ap_msgqueue_add_line(baked_line, (j - i) + 2);
+        i = j;
+        word_start = j;
+        while (message[i] == ' ')
+        {
+            i++;
+            j++;
+            word_start++;
+        }
+        w = 0;
+        k = i;
+    }
+}
+
+
+int ap_msgqueue_count(void)
+{
+    return ap_msg_queue_count;
+}
+
+
+int ap_msgqueue_pop(char* line)
+{
+    if (!ap_msg_queue_count)
+        return 0;
+
+    memcpy(line, ap_msg_queue[ap_msg_queue_head], AP_MSG_MAXLINELENGTH + 1);
+    ap_msg_queue_head = (ap_msg_queue_head + 1) % AP_MSG_MAXQUEUE;
+    ap_msg_queue_count--;
+    return 1;
+}
+
+
+void ap_msgqueue_clear(void)
+{
+    ap_msg_queue_head = 0;
+    ap_msg_queue_count = 0;
+}
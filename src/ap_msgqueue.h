@@ -0,0 +1,25 @@
+#ifndef __APMSGQUEUE_H__
+#define __APMSGQUEUE_H__
+
+// [AP] Queue of word wrapped AP message lines, shared by the games' HUD
+// message code. Messages are laid out once, when they arrive; the HUD then
+// only pops ready made lines.
+
+#define AP_MSG_MAXLINELENGTH 80
+#define AP_MSG_MAXQUEUE 500
+
+// Returns the width of the glyph or color escape at text, and how many
+// characters it spans in *advance.
+typedef int (*ap_msg_measure_t)(const char *text, int *advance);
+
+void ap_msgqueue_add(const char *message, int max_width,
+                     ap_msg_measure_t measure);
+int ap_msgqueue_count(void);
+
+// Copies the oldest line to line, which must hold AP_MSG_MAXLINELENGTH + 1
+// characters, and removes it from the queue.
+int ap_msgqueue_pop(char *line);
+
+void ap_msgqueue_clear(void);
+
+#endif
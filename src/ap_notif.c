@@ -0,0 +1,155 @@
+// [AP] Shared by all the games that link against apdoom. Only the text
+// drawing differs between them, so it is passed in.
+
+#include "ap_notif.h"
+#include "apdoom.h"
+#include "v_video.h"
+#include "w_wad.h"
+#include "z_zone.h"
+#include "i_video.h"
+#include "m_memory.h"
+#include <stdlib.h>
+#include <string.h>
+#include "i_swap.h"
+
+
+#define ICON_BLOCK_SIZE (AP_NOTIF_SIZE - 4)
+#define ICON_ATLAS_SLOTS 128
+#define ICON_MAX_HEIGHT 512
+
+// Scaled down icons, one block per sprite lump. icon_slots maps a lump number
+// to its block (+1, so 0 means not decoded yet).
+static pixel_t icon_atlas[ICON_ATLAS_SLOTS][ICON_BLOCK_SIZE * ICON_BLOCK_SIZE];
+static short* icon_slots = NULL;
+static int icon_atlas_count = 0;
+
+
+// Unpacks one column of patch into column, 0 where there are no posts
+static void decode_icon_column(patch_t* patch, int x, pixel_t* column_pixels)
+{
+    column_t* column = (column_t *)((byte *)patch + LONG(patch->columnofs[x]));
+    int height = patch->height < ICON_MAX_HEIGHT ? patch->height : ICON_MAX_HEIGHT;
+
+    memset(column_pixels, 0, height);
+
+    // step through the posts in a column
+    while (column->topdelta != 0xff)
+    {
+        byte* source = (byte *)column + 3;
+
+        for (int y = 0; y < column->length; ++y)
+        {
+            int k = y + column->topdelta;
+            if (k < height)
+                column_pixels[k] = source[y];
+        }
+
+        column = (column_t *)((byte *)column + column->length + 4);
+    }
+}
+
+
+static void build_icon(patch_t* patch, pixel_t* pixels)
+{
+    pixel_t column_pixels[ICON_MAX_HEIGHT];
+    int height = patch->height < ICON_MAX_HEIGHT ? patch->height : ICON_MAX_HEIGHT;
+
+    // Scale down the patch into the icon block, sampling a column at a time
+    int max_size = patch->width > patch->height ? patch->width : patch->height;
+    float scale = 1.0f;
+    if (max_size > ICON_BLOCK_SIZE)
+        scale = (float)max_size / (float)ICON_BLOCK_SIZE;
+    int offsetx = (patch->width - (int)((float)ICON_BLOCK_SIZE * scale)) / 2;
+    int offsety = (patch->height - (int)((float)ICON_BLOCK_SIZE * scale)) / 2;
+    for (int dstx = 0; dstx < ICON_BLOCK_SIZE; ++dstx)
+    {
+        int srcx = (int)((float)dstx * scale) + offsetx;
+        if (srcx < 0 || srcx >= patch->width)
+        {
+            for (int dsty = 0; dsty < ICON_BLOCK_SIZE; ++dsty)
+                pixels[dsty * ICON_BLOCK_SIZE + dstx] = 0;
+            continue; // Outside source patch
+        }
+
+        decode_icon_column(patch, srcx, column_pixels);
+        for (int dsty = 0; dsty < ICON_BLOCK_SIZE; ++dsty)
+        {
+            int srcy = (int)((float)dsty * scale) + offsety;
+            pixels[dsty * ICON_BLOCK_SIZE + dstx] =
+                (srcy < 0 || srcy >= height) ? 0 : column_pixels[srcy];
+        }
+    }
+}
+
+
+static size_t icon_bytes(void)
+{
+    return icon_atlas_count * sizeof(icon_atlas[0]);
+}
+
+
+static pixel_t* get_icon(int lump)
+{
+    if (lump < 0)
+        return NULL;
+
+    if (!icon_slots)
+    {
+        // Untouched slots of the atlas cost nothing, only decoded icons
+        M_AddMemoryUser("notification icons", icon_bytes, NULL);
+        icon_slots = Z_Malloc(numlumps * sizeof(*icon_slots), PU_STATIC, NULL);
+        memset(icon_slots, 0, numlumps * sizeof(*icon_slots));
+    }
+
+    if (icon_slots[lump])
+        return icon_atlas[icon_slots[lump] - 1];
+
+    if (icon_atlas_count == ICON_ATLAS_SLOTS)
+        return NULL; // Atlas is full
+
+    pixel_t* pixels = icon_atlas[icon_atlas_count++];
+    icon_slots[lump] = icon_atlas_count;
+    build_icon(W_CacheLumpNum(lump, PU_CACHE), pixels);
+    return pixels;
+}
+
+
+void ap_notif_precache(void)
+{
+    const char* sprite;
+
+    for (int i = 0; (sprite = ap_get_type_sprite(i)) != NULL; ++i)
+        get_icon(W_CheckNumForName(sprite));
+}
+
+
+void ap_notif_draw(ap_notif_text_func_t draw_text)
+{
+    int notif_count;
+    const ap_notification_icon_t* notifs = ap_get_notification_icons(&notif_count);
+
+    for (int i = 0; i < notif_count; ++i)
+    {
+        const ap_notification_icon_t* notif = notifs + i;
+        if (notif->state == AP_NOTIF_STATE_PENDING) continue;
+
+        pixel_t* icon = get_icon(W_CheckNumForName(notif->sprite));
+        if (!icon) continue;
+
+        int center_y = 172 + notif->y;
+
+        V_DrawPatch(notif->x - AP_NOTIF_SIZE / 2 - WIDESCREENDELTA, 
+                    center_y - AP_NOTIF_SIZE / 2, 
+                    W_CacheLumpName("NOTIFBG", PU_CACHE));
+        V_DrawScaledBlockTransparency(
+            notif->x - ICON_BLOCK_SIZE / 2 - WIDESCREENDELTA,
+            center_y - ICON_BLOCK_SIZE / 2,
+            ICON_BLOCK_SIZE, ICON_BLOCK_SIZE,
+            icon);
+
+        if (notif->text[0])
+            draw_text(notif->text,
+                      notif->x + AP_NOTIF_SIZE / 2 + 3 - WIDESCREENDELTA,
+                      center_y - 5);
+    }
+}
@@ -0,0 +1,12 @@
+#ifndef __APNOTIF_H__
+#define __APNOTIF_H__
+
+typedef void (*ap_notif_text_func_t)(const char *text, int x, int y);
+
+void ap_notif_draw(ap_notif_text_func_t draw_text);
+
+// Decodes the icon of every item type up front, so receiving an item doesn't
+// have to.
+void ap_notif_precache(void);
+
+#endif
@@ -24,6 +24,9 @@
 #endif
 #else
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 
@@ -33,12 +36,21 @@
 #include "Archipelago.h"
 #include <json/json.h>
 #include <memory.h>
+#include <cstddef>
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <thread>
 #include <vector>
+#include <map>
+#include <string>
 #include <fstream>
 #include <sstream>
 #include <set>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
 
 
 #if defined(_WIN32)
@@ -171,6 +183,129 @@ enum class ap_game_t
 };
 
 
+// Lock-free single producer / single consumer ring. Holds N - 1 entries.
+template<typename T, size_t N>
+struct ap_spsc_ring_t
+{
+	T slots[N];
+	std::atomic<size_t> head{0}; // Consumer side
+	std::atomic<size_t> tail{0}; // Producer side
+
+	bool push(const T& value)
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		size_t next = (t + 1) % N;
+		if (next == head.load(std::memory_order_acquire)) return false; // Full
+		slots[t] = value;
+		tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& out)
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		if (h == tail.load(std::memory_order_acquire)) return false; // Empty
+		out = std::move(slots[h]);
+		head.store((h + 1) % N, std::memory_order_release);
+		return true;
+	}
+};
+
+
+#define AP_MESSAGES_PER_TIC 4 // Chat/HUD lines handed to the game per tic
+#define AP_ITEMS_PER_TIC 8 // Items given to the player per tic
+#define AP_ITEMS_PER_BATCH 64 // Items given per tic when the game takes them in batches
+#define AP_NOTIF_MAX 256 // Received items wait in the queue while this many icons are up
+#define AP_BURST_SHOWN 3 // Item lines shown as they come during a burst, the rest are summed up
+#define AP_BURST_GAP_MS 500 // A burst ends after this long without an item line
+#define AP_MESSAGE_LOG_MAX 512 // Lines kept by apdoom_get_message_log_line
+#define AP_SCOUTS_IN_FLIGHT 4 // LocationScouts requests, one level each, waiting on a reply at once
+#define AP_SCOUT_TIMEOUT_MS 10000
+#define AP_SYNC_INTERVAL_MS 30000 // Level state goes to the server's DataStorage at most this often, and at level exits
+
+
+enum ap_hint_kind_t
+{
+	AP_HINT_MAP,
+	AP_HINT_BLUE,
+	AP_HINT_YELLOW,
+	AP_HINT_RED,
+	AP_HINT_GREEN,
+	AP_HINT_COUNT
+};
+
+
+struct ap_hint_targets_t
+{
+	std::string hints[AP_HINT_COUNT]; // Full "!hint ..." lines, empty if the game doesn't have it
+};
+
+
+enum class ap_net_message_kind_t
+{
+	other,
+	item_recv, // player is who sent it
+	item_send // player is who got it
+};
+
+
+struct ap_net_message_t
+{
+	std::string text; // Already colored
+	ap_net_message_kind_t kind = ap_net_message_kind_t::other;
+	std::string player;
+};
+
+
+// Item lines that arrived close together, on !release or !collect
+struct ap_message_burst_t
+{
+	int64_t last_ms = 0;
+	int shown = 0;
+	int hidden_recv = 0;
+	int hidden_send = 0;
+	std::set<std::string> recv_from;
+	std::set<std::string> send_to;
+};
+
+
+// An item or location id from the AP library's thread, with when it came in
+struct ap_timed_id_t
+{
+	int64_t id;
+	int64_t received_ms;
+};
+
+
+// What a LocationScouts request for one level came back with
+struct ap_scout_reply_t
+{
+	int level = -1; // Level state index
+	std::vector<int64_t> progression;
+};
+
+
+// Where a location id lives in the location table
+struct ap_location_ref_t
+{
+	int ep; // 1-based
+	int map; // 1-based
+	int index; // Thing index, -1 for level exit
+};
+
+
+// What receiving an item does, resolved once in apdoom_init
+struct ap_item_desc_t
+{
+	const ap_item_def_t* def; // nullptr for unused ids
+	int key; // keys[] slot, -1 if it's not a key
+	int weapon; // weapon_owned[] slot, -1 if it's not a weapon
+	int level; // Level state index, -1 if the item isn't tied to a level
+	char sprite[9]; // Notification icon, empty for none
+	char notif_text[64]; // "(E1M1)" for level specific items, otherwise empty
+};
+
+
 ap_state_t ap_state;
 int ap_is_in_game = 0;
 int ap_episode_count = -1;
@@ -183,14 +318,76 @@ static int ap_inventory_count = -1;
 static int max_map_count = -1;
 static ap_settings_t ap_settings;
 static AP_RoomInfo ap_room_info;
-static std::vector<int64_t> ap_item_queue; // We queue when we're in the menu.
+static std::deque<int64_t> ap_item_queue; // We queue when we're in the menu.
+static std::deque<int64_t> ap_item_queue_times; // When each queued item arrived, in ms. -1 for items restored from a save
+static ap_item_stats_t ap_item_stats;
+static std::deque<int> ap_scout_queue; // Level state indices still to scout
+static std::vector<std::pair<int, int64_t>> ap_scouts_in_flight; // Level state index, when it was sent
 static bool ap_was_connected = false; // Got connected at least once. That means the state is valid
 static std::set<int64_t> ap_progressive_locations;
+static std::vector<std::vector<bool>> ap_progression_bits; // [level state][thing index], what apdoom_is_location_progression reads
+static std::vector<std::vector<bool>> ap_check_bits; // [level state][thing index], checks[] only keeps the first AP_CHECK_MAX for old saves
 static bool ap_initialized = false;
 static std::vector<std::string> ap_cached_messages;
+static ap_message_burst_t ap_message_burst;
+static std::deque<std::string> ap_message_log; // Every line, including the ones a burst summed up
 static std::string ap_save_dir_name;
-static std::vector<ap_notification_icon_t> ap_notification_icons;
+static ap_notification_icon_t ap_notification_icons[AP_NOTIF_MAX]; // Fixed storage, the renderer reads it directly
+static int ap_notification_icon_count = 0;
 static bool ap_check_sanity = false;
+static std::vector<ap_location_ref_t> ap_location_refs; // Reverse lookup, [loc id - ap_location_id_base], ep 0 for unused ids
+static int64_t ap_location_id_base = 0;
+static std::vector<ap_item_desc_t> ap_item_descs; // [item id - ap_item_id_base], def nullptr for unused ids
+static int64_t ap_item_id_base = 0;
+static std::vector<std::vector<int64_t>> ap_location_ids; // [level state][thing index], -1 if it's not a location
+static std::vector<int64_t> ap_exit_location_ids; // [level state], -1 if the level has no exit location
+static std::unordered_map<std::string, ap_hint_targets_t> ap_hint_targets; // "E1M1"/"MAP01" -> expanded hints, built once in apdoom_init
+static Json::Value ap_say_packet; // Reused for every outbound Say
+static Json::FastWriter ap_say_writer;
+
+// Network thread. It drains and formats AP messages, and the AP callbacks
+// hand received items over, so none of that runs on the render path.
+static std::thread ap_net_thread;
+static std::atomic<bool> ap_net_thread_running{false};
+static ap_spsc_ring_t<ap_net_message_t, 1024> ap_message_ring; // net thread -> game
+static ap_spsc_ring_t<ap_timed_id_t, 4096> ap_item_ring; // AP item callback -> game
+static ap_spsc_ring_t<ap_timed_id_t, 4096> ap_location_ring; // AP location callback -> game
+static ap_spsc_ring_t<ap_scout_reply_t, 64> ap_scout_ring; // AP location info callback -> game
+static std::atomic<bool> ap_events_pending{false}; // Set with every push above, so a quiet tic costs one load
+static std::atomic<int64_t> ap_deathlink_received_ms{0}; // Non zero while a DeathLink waits, set by the net thread
+static std::atomic<bool> ap_deathlink_clear{false}; // The game is done with it, the net thread clears it in the library
+static AP_GetServerDataRequest ap_sync_request; // The one Get at connect, filled in by the AP library
+static std::string ap_sync_reply;
+static bool ap_sync_ready = false; // The server's copy was merged, so Sets can't overwrite newer progress
+static std::vector<std::string> ap_sync_sent; // [level state], what the server has for it
+static int64_t ap_sync_last_ms = 0;
+static std::thread ap_flood_thread; // Stands in for the net thread while replaying, see ap_settings_t::flood_items
+static std::atomic<bool> ap_flood_running{false};
+
+// Record / replay log, see apdoom_record()
+int ap_log_tic = 0;
+static FILE* ap_record_file = nullptr;
+static std::mutex ap_record_mutex;
+static std::vector<std::string> ap_record_pending; // From the AP library's thread, written out on the game thread
+static bool ap_recorded_death = false;
+static std::ifstream ap_replay_file;
+static bool ap_replaying = false;
+static bool ap_replay_death = false;
+static bool ap_replay_has_next = false; // The next line is read into these, waiting for its tic
+static int ap_replay_next_tic;
+static char ap_replay_next_type;
+static std::string ap_replay_next_arg;
+
+// Tracker block, see ap_tracker_block_t
+static ap_tracker_block_t* ap_tracker_block = nullptr;
+static ap_tracker_block_t ap_tracker_staging; // Built here, then copied in one go to keep the odd window short
+static std::atomic<bool> ap_tracker_checks_dirty{true}; // set_loc_checked runs on the AP library's thread too
+static int ap_tracker_x = 0;
+static int ap_tracker_y = 0;
+static int ap_tracker_angle = 0;
+#ifdef _WIN32
+static HANDLE ap_tracker_mapping = nullptr;
+#endif
 
 
 void f_itemclr();
@@ -213,7 +410,34 @@ void f_episode5(int);
 void f_two_ways_keydoors(int);
 void load_state();
 void save_state();
+static void load_state_json(const Json::Value& json);
+static Json::Value serialize_state();
+static bool replay_open(const char* filename);
+static void replay_tic();
+static void record_event(char type, const std::string& arg);
+static void record_pending_event(char type, const std::string& arg);
+static void journal_open(bool truncate);
+static bool journal_replay();
+static void journal_state();
+static void journal_compact();
+static void snapshot_save();
+static bool snapshot_load();
 void APSend(std::string msg);
+static void start_net_thread();
+static void stop_net_thread();
+static void start_flood_thread();
+static void sync_request();
+static void sync_poll();
+static void sync_levels(bool force);
+static void stop_flood_thread();
+static void drain_event_rings();
+static void receive_location(int64_t loc_id, int64_t received_ms);
+static void build_item_descs();
+static void send_location_scouts();
+static void end_message_burst();
+static void tracker_open();
+static void tracker_close();
+static void tracker_publish();
 
 
 static int get_original_music_for_level(int ep, int map)
@@ -254,32 +478,33 @@ static int get_original_music_for_level(int ep, int map)
 }
 
 
-static std::vector<std::vector<ap_level_info_t>>& get_level_info_table()
+static ap_table_t<ap_episode_info_t> get_level_info_table()
 {
 	switch (ap_game)
 	{
-		case ap_game_t::doom: return ap_doom_level_infos;
-		case ap_game_t::doom2: return ap_doom2_level_infos;
-		case ap_game_t::heretic: return ap_heretic_level_infos;
+		case ap_game_t::doom: return ap_make_table(ap_doom_level_infos);
+		case ap_game_t::doom2: return ap_make_table(ap_doom2_level_infos);
+		case ap_game_t::heretic: return ap_make_table(ap_heretic_level_infos);
 	}
+	return {nullptr, 0};
 }
 
 
 int ap_get_map_count(int ep)
 {
 	--ep;
-	auto& level_info_table = get_level_info_table();
+	auto level_info_table = get_level_info_table();
 	if (ep < 0 || ep >= (int)level_info_table.size()) return -1;
-	return (int)level_info_table[ep].size();
+	return level_info_table[ep].map_count;
 }
 
 
-ap_level_info_t* ap_get_level_info(ap_level_index_t idx)
+const ap_level_info_t* ap_get_level_info(ap_level_index_t idx)
 {
-	auto& level_info_table = get_level_info_table();
+	auto level_info_table = get_level_info_table();
 	if (idx.ep < 0 || idx.ep >= (int)level_info_table.size()) return nullptr;
-	if (idx.map < 0 || idx.map >= (int)level_info_table[idx.ep].size()) return nullptr;
-	return &level_info_table[idx.ep][idx.map];
+	if (idx.map < 0 || idx.map >= level_info_table[idx.ep].map_count) return nullptr;
+	return &level_info_table[idx.ep].level_infos[idx.map];
 }
 
 
@@ -289,25 +514,162 @@ ap_level_state_t* ap_get_level_state(ap_level_index_t idx)
 }
 
 
-static const std::map<int64_t, ap_item_t>& get_item_type_table()
+static ap_table_t<ap_item_def_t> get_item_type_table()
 {
 	switch (ap_game)
 	{
-		case ap_game_t::doom: return ap_doom_item_table;
-		case ap_game_t::doom2: return ap_doom2_item_table;
-		case ap_game_t::heretic: return ap_heretic_item_table;
+		case ap_game_t::doom: return ap_make_table(ap_doom_item_table);
+		case ap_game_t::doom2: return ap_make_table(ap_doom2_item_table);
+		case ap_game_t::heretic: return ap_make_table(ap_heretic_item_table);
 	}
+	return {nullptr, 0};
 }
 
 
-static const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>>& get_location_table()
+static ap_table_t<ap_location_def_t> get_location_table()
 {
 	switch (ap_game)
 	{
-		case ap_game_t::doom: return ap_doom_location_table;
-		case ap_game_t::doom2: return ap_doom2_location_table;
-		case ap_game_t::heretic: return ap_heretic_location_table;
+		case ap_game_t::doom: return ap_make_table(ap_doom_location_table);
+		case ap_game_t::doom2: return ap_make_table(ap_doom2_location_table);
+		case ap_game_t::heretic: return ap_make_table(ap_heretic_location_table);
+	}
+	return {nullptr, 0};
+}
+
+
+static void build_location_refs()
+{
+	auto loc_table = get_location_table();
+
+	// The generator hands out location ids in a row, so offsetting by the
+	// lowest one gives a table without holes.
+	ap_location_refs.clear();
+	if (loc_table.size() == 0) return;
+	int64_t min_id = loc_table[0].loc_id;
+	int64_t max_id = loc_table[0].loc_id;
+	for (const auto& loc : loc_table)
+	{
+		min_id = std::min(min_id, loc.loc_id);
+		max_id = std::max(max_id, loc.loc_id);
+	}
+	ap_location_id_base = min_id;
+	ap_location_refs.assign((size_t)(max_id - min_id + 1), ap_location_ref_t{0, 0, -1});
+	for (const auto& loc : loc_table)
+		ap_location_refs[loc.loc_id - min_id] = {loc.ep, loc.map, loc.index};
+}
+
+
+static const ap_location_ref_t* get_location_ref(int64_t loc_id)
+{
+	if (loc_id < ap_location_id_base || loc_id - ap_location_id_base >= (int64_t)ap_location_refs.size())
+		return nullptr;
+	const auto& ref = ap_location_refs[loc_id - ap_location_id_base];
+	if (ref.ep == 0) return nullptr;
+	return &ref;
+}
+
+
+static void build_hint_targets()
+{
+	auto level_info_table = get_level_info_table();
+	int doom2_map = 1;
+
+	ap_hint_targets.clear();
+	for (int ep = 0; ep < (int)level_info_table.size(); ++ep)
+	{
+		for (int map = 0; map < level_info_table[ep].map_count; ++map)
+		{
+			const ap_level_info_t& level_info = level_info_table[ep].level_infos[map];
+			std::string level_name = level_info.name;
+			char short_name[16];
+			if (ap_game == ap_game_t::doom2)
+				snprintf(short_name, sizeof(short_name), "MAP%02d", doom2_map++);
+			else
+				snprintf(short_name, sizeof(short_name), "E%iM%i", ep + 1, map + 1);
+
+			ap_hint_targets_t& targets = ap_hint_targets[short_name];
+			switch (ap_game)
+			{
+				case ap_game_t::doom:
+				case ap_game_t::doom2:
+					targets.hints[AP_HINT_MAP] = "!hint " + level_name + " - Computer area map";
+					targets.hints[AP_HINT_BLUE] = "!hint " + level_name + " - Blue " + (level_info.use_skull[0] ? "skull key" : "keycard");
+					targets.hints[AP_HINT_YELLOW] = "!hint " + level_name + " - Yellow " + (level_info.use_skull[1] ? "skull key" : "keycard");
+					targets.hints[AP_HINT_RED] = "!hint " + level_name + " - Red " + (level_info.use_skull[2] ? "skull key" : "keycard");
+					break;
+				case ap_game_t::heretic:
+					targets.hints[AP_HINT_MAP] = "!hint " + level_name + " - Map scroll";
+					targets.hints[AP_HINT_BLUE] = "!hint " + level_name + " - Blue key";
+					targets.hints[AP_HINT_YELLOW] = "!hint " + level_name + " - Yellow key";
+					targets.hints[AP_HINT_GREEN] = "!hint " + level_name + " - Green key";
+					break;
+			}
+		}
+	}
+}
+
+
+// One bit and one id per location thing, so level load and pickups don't
+// search anything
+static void build_location_bits()
+{
+	ap_progression_bits.assign(ap_episode_count * max_map_count, std::vector<bool>());
+	ap_location_ids.assign(ap_episode_count * max_map_count, std::vector<int64_t>());
+	ap_exit_location_ids.assign(ap_episode_count * max_map_count, -1);
+	for (const auto& loc : get_location_table())
+	{
+		int level = (loc.ep - 1) * max_map_count + (loc.map - 1);
+		if (loc.index < 0)
+		{
+			ap_exit_location_ids[level] = loc.loc_id;
+			continue;
+		}
+		auto& bits = ap_progression_bits[level];
+		if ((int)bits.size() <= loc.index)
+			bits.resize(loc.index + 1, false);
+		auto& ids = ap_location_ids[level];
+		if ((int)ids.size() <= loc.index)
+			ids.resize(loc.index + 1, -1);
+		ids[loc.index] = loc.loc_id;
+	}
+	ap_check_bits = ap_progression_bits;
+}
+
+
+static void set_location_progression(int64_t loc_id)
+{
+	ap_progressive_locations.insert(loc_id);
+
+	auto ref_ptr = get_location_ref(loc_id);
+	if (!ref_ptr || ref_ptr->index < 0) return;
+
+	const auto& ref = *ref_ptr;
+	ap_progression_bits[(ref.ep - 1) * max_map_count + (ref.map - 1)][ref.index] = true;
+}
+
+
+static bool get_location_id(ap_level_index_t idx, int index, int64_t& loc_id)
+{
+	if (idx.ep < 0 || idx.ep >= ap_episode_count || idx.map < 0 || idx.map >= max_map_count)
+		return false;
+
+	int level = idx.ep * max_map_count + idx.map;
+	int64_t id = -1;
+	if (index < 0)
+	{
+		id = ap_exit_location_ids[level];
 	}
+	else
+	{
+		const auto& ids = ap_location_ids[level];
+		if (index < (int)ids.size())
+			id = ids[index];
+	}
+	if (id < 0) return false;
+
+	loc_id = id;
+	return true;
 }
 
 
@@ -359,18 +721,26 @@ const int* get_max_ammos()
 
 int validate_doom_location(ap_level_index_t idx, int index)
 {
-    ap_level_info_t* level_info = ap_get_level_info(idx);
+    const ap_level_info_t* level_info = ap_get_level_info(idx);
     if (index >= level_info->thing_count) return 0;
 	if (level_info->thing_infos[index].unreachable) return 0;
     return level_info->thing_infos[index].check_sanity == 0 || ap_state.check_sanity == 1;
 }
 
 
+static std::chrono::steady_clock::time_point ap_connect_start_time;
+
+
 int apdoom_init(ap_settings_t* settings)
+{
+	return apdoom_init_start(settings) && apdoom_init_finish();
+}
+
+
+int apdoom_init_start(ap_settings_t* settings)
 {
 	printf("%s\n", APDOOM_VERSION_FULL_TEXT);
 
-	ap_notification_icons.reserve(4096); // 1MB. A bit exessive, but I got a crash with invalid strings and I cannot figure out why. Let's not take any chances...
 	memset(&ap_state, 0, sizeof(ap_state));
 
 	if (strcmp(settings->game, "DOOM 1993") == 0)
@@ -403,13 +773,17 @@ int apdoom_init(ap_settings_t* settings)
 		return 0;
 	}
 
-	const auto& level_info_table = get_level_info_table();
+	build_location_refs();
+	build_hint_targets();
+
+	auto level_info_table = get_level_info_table();
 	ap_episode_count = (int)level_info_table.size();
 	max_map_count = 0; // That's really the map count
 	for (const auto& episode_level_info : level_info_table)
 	{
-		max_map_count = max(max_map_count, (int)episode_level_info.size());
+		max_map_count = max(max_map_count, episode_level_info.map_count);
 	}
+	build_item_descs();
 
 	printf("APDOOM: Initializing Game: \"%s\", Server: %s, Slot: %s\n", settings->game, settings->ip, settings->player_name);
 
@@ -447,15 +821,9 @@ int apdoom_init(ap_settings_t* settings)
 			{
 				ap_state.level_states[ep * max_map_count + map].checks[k] = -1;
 			}
-			auto level_info = ap_get_level_info(ap_level_index_t{ep, map});
-			level_info->sanity_check_count = 0;
-			for (int k = 0; k < level_info->thing_count; ++k)
-			{
-				if (level_info->thing_infos[k].check_sanity)
-					level_info->sanity_check_count++;
-			}
 		}
 	}
+	build_location_bits();
 
 	ap_settings = *settings;
 
@@ -472,84 +840,136 @@ int apdoom_init(ap_settings_t* settings)
 	if (ap_settings.override_reset_level_on_death)
 		ap_state.reset_level_on_death = ap_settings.reset_level_on_death;
 
-	AP_NetworkVersion version = {0, 4, 1};
-	AP_SetClientVersion(&version);
-    AP_Init(ap_settings.ip, ap_settings.game, ap_settings.player_name, ap_settings.passwd);
-	AP_SetDeathLinkSupported(ap_settings.force_deathlink_off ? false : true);
-	AP_SetItemClearCallback(f_itemclr);
-	AP_SetItemRecvCallback(f_itemrecv);
-	AP_SetLocationCheckedCallback(f_locrecv);
-	AP_SetLocationInfoCallback(f_locinfo);
-	AP_RegisterSlotDataIntCallback("goal", f_goal);
-	AP_RegisterSlotDataIntCallback("difficulty", f_difficulty);
-	AP_RegisterSlotDataIntCallback("random_monsters", f_random_monsters);
-	AP_RegisterSlotDataIntCallback("random_pickups", f_random_items);
-	AP_RegisterSlotDataIntCallback("random_music", f_random_music);
-	AP_RegisterSlotDataIntCallback("flip_levels", f_flip_levels);
-	AP_RegisterSlotDataIntCallback("check_sanity", f_check_sanity);
-	AP_RegisterSlotDataIntCallback("reset_level_on_death", f_reset_level_on_death);
-	AP_RegisterSlotDataIntCallback("episode1", f_episode1);
-	AP_RegisterSlotDataIntCallback("episode2", f_episode2);
-	AP_RegisterSlotDataIntCallback("episode3", f_episode3);
-	AP_RegisterSlotDataIntCallback("episode4", f_episode4);
-	AP_RegisterSlotDataIntCallback("episode5", f_episode5);
-	AP_RegisterSlotDataIntCallback("two_ways_keydoors", f_two_ways_keydoors);
-    AP_Start();
-
-	// Block DOOM until connection succeeded or failed
-	auto start_time = std::chrono::steady_clock::now();
-	while (true)
-	{
-		bool should_break = false;
-		switch (AP_GetConnectionStatus())
+	if (ap_settings.replay_log)
+	{
+		// Offline, nothing is sent and the saves are left alone
+		if (!replay_open(ap_settings.replay_log))
+			return 0;
+	}
+	else
+	{
+		AP_NetworkVersion version = {0, 4, 1};
+		AP_SetClientVersion(&version);
+	    AP_Init(ap_settings.ip, ap_settings.game, ap_settings.player_name, ap_settings.passwd);
+		AP_SetDeathLinkSupported(ap_settings.force_deathlink_off ? false : true);
+		AP_SetItemClearCallback(f_itemclr);
+		AP_SetItemRecvCallback(f_itemrecv);
+		AP_SetLocationCheckedCallback(f_locrecv);
+		AP_SetLocationInfoCallback(f_locinfo);
+		AP_RegisterSlotDataIntCallback("goal", f_goal);
+		AP_RegisterSlotDataIntCallback("difficulty", f_difficulty);
+		AP_RegisterSlotDataIntCallback("random_monsters", f_random_monsters);
+		AP_RegisterSlotDataIntCallback("random_pickups", f_random_items);
+		AP_RegisterSlotDataIntCallback("random_music", f_random_music);
+		AP_RegisterSlotDataIntCallback("flip_levels", f_flip_levels);
+		AP_RegisterSlotDataIntCallback("check_sanity", f_check_sanity);
+		AP_RegisterSlotDataIntCallback("reset_level_on_death", f_reset_level_on_death);
+		AP_RegisterSlotDataIntCallback("episode1", f_episode1);
+		AP_RegisterSlotDataIntCallback("episode2", f_episode2);
+		AP_RegisterSlotDataIntCallback("episode3", f_episode3);
+		AP_RegisterSlotDataIntCallback("episode4", f_episode4);
+		AP_RegisterSlotDataIntCallback("episode5", f_episode5);
+		AP_RegisterSlotDataIntCallback("two_ways_keydoors", f_two_ways_keydoors);
+	    AP_Start();
+		start_net_thread();
+		ap_connect_start_time = std::chrono::steady_clock::now();
+	}
+
+	return 1;
+}
+
+
+static int ap_connect_elapsed_ms()
+{
+	return (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - ap_connect_start_time).count();
+}
+
+
+int apdoom_init_finish()
+{
+	if (!ap_settings.replay_log)
+	{
+		int timeout_s = ap_settings.connect_timeout > 0 ? ap_settings.connect_timeout : AP_DEFAULT_CONNECT_TIMEOUT;
+		int startup_ms = ap_connect_elapsed_ms(); // How much of the handshake the engine startup covered
+		int reported_s = 0;
+		bool reported_connected = false;
+
+		// Block DOOM until connection succeeded or failed
+		while (true)
 		{
-			case AP_ConnectionStatus::Authenticated:
+			bool should_break = false;
+			int elapsed_ms = ap_connect_elapsed_ms();
+			switch (AP_GetConnectionStatus())
 			{
-				printf("APDOOM: Authenticated\n");
-				AP_GetRoomInfo(&ap_room_info);
-
-				printf("APDOOM: Room Info:\n");
-				printf("  Network Version: %i.%i.%i\n", ap_room_info.version.major, ap_room_info.version.minor, ap_room_info.version.build);
-				printf("  Tags:\n");
-				for (const auto& tag : ap_room_info.tags)
-					printf("    %s\n", tag.c_str());
-				printf("  Password required: %s\n", ap_room_info.password_required ? "true" : "false");
-				printf("  Permissions:\n");
-				for (const auto& permission : ap_room_info.permissions)
-					printf("    %s = %i:\n", permission.first.c_str(), permission.second);
-				printf("  Hint cost: %i\n", ap_room_info.hint_cost);
-				printf("  Location check points: %i\n", ap_room_info.location_check_points);
-				printf("  Data package checksums:\n");
-				for (const auto& kv : ap_room_info.datapackage_checksums)
-					printf("    %s = %s:\n", kv.first.c_str(), kv.second.c_str());
-				printf("  Seed name: %s\n", ap_room_info.seed_name.c_str());
-				printf("  Time: %f\n", ap_room_info.time);
+				case AP_ConnectionStatus::Connected:
+					if (!reported_connected)
+					{
+						printf("APDOOM: Connected after %i ms, waiting for the slot\n", elapsed_ms);
+						reported_connected = true;
+					}
+					break;
+				case AP_ConnectionStatus::Authenticated:
+				{
+					printf("APDOOM: Authenticated after %i ms (%i ms spent waiting on it)\n",
+						elapsed_ms, elapsed_ms > startup_ms ? elapsed_ms - startup_ms : 0);
+					AP_GetRoomInfo(&ap_room_info);
+
+					printf("APDOOM: Room Info:\n");
+					printf("  Network Version: %i.%i.%i\n", ap_room_info.version.major, ap_room_info.version.minor, ap_room_info.version.build);
+					printf("  Tags:\n");
+					for (const auto& tag : ap_room_info.tags)
+						printf("    %s\n", tag.c_str());
+					printf("  Password required: %s\n", ap_room_info.password_required ? "true" : "false");
+					printf("  Permissions:\n");
+					for (const auto& permission : ap_room_info.permissions)
+						printf("    %s = %i:\n", permission.first.c_str(), permission.second);
+					printf("  Hint cost: %i\n", ap_room_info.hint_cost);
+					printf("  Location check points: %i\n", ap_room_info.location_check_points);
+					printf("  Data package checksums:\n");
+					for (const auto& kv : ap_room_info.datapackage_checksums)
+						printf("    %s = %s:\n", kv.first.c_str(), kv.second.c_str());
+					printf("  Seed name: %s\n", ap_room_info.seed_name.c_str());
+					printf("  Time: %f\n", ap_room_info.time);
 				
-				ap_was_connected = true;
-				ap_save_dir_name = "AP_" + ap_room_info.seed_name + "_" + string_to_hex(ap_settings.player_name);
+					ap_was_connected = true;
+					ap_save_dir_name = "AP_" + ap_room_info.seed_name + "_" + string_to_hex(ap_settings.player_name);
 
-				// Create a directory where saves will go for this AP seed.
-				printf("APDOOM: Save directory: %s\n", ap_save_dir_name.c_str());
-				if (!AP_FileExists(ap_save_dir_name.c_str()))
-				{
-					printf("  Doesn't exist, creating...\n");
-					AP_MakeDirectory(ap_save_dir_name.c_str());
-				}
+					// Create a directory where saves will go for this AP seed.
+					printf("APDOOM: Save directory: %s\n", ap_save_dir_name.c_str());
+					if (!AP_FileExists(ap_save_dir_name.c_str()))
+					{
+						printf("  Doesn't exist, creating...\n");
+						AP_MakeDirectory(ap_save_dir_name.c_str());
+					}
 
-				load_state();
-				should_break = true;
-				break;
+					load_state();
+					if (journal_replay())
+						journal_open(false);
+					else
+						journal_compact(); // Don't append after a torn or invalid journal
+					sync_request();
+					should_break = true;
+					break;
+				}
+				case AP_ConnectionStatus::ConnectionRefused:
+					printf("APDOOM: Failed to connect, connection refused\n");
+					stop_net_thread();
+					return 0;
+			}
+			if (should_break) break;
+			drain_event_rings();
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			if (elapsed_ms / 1000 > reported_s)
+			{
+				reported_s = elapsed_ms / 1000;
+				printf("APDOOM: Still connecting to %s (%is/%is)\n", ap_settings.ip, reported_s, timeout_s);
 			}
-			case AP_ConnectionStatus::ConnectionRefused:
-				printf("APDOOM: Failed to connect, connection refused\n");
+			if (elapsed_ms >= timeout_s * 1000)
+			{
+				printf("APDOOM: Failed to connect, timeout %is\n", timeout_s);
+				stop_net_thread();
 				return 0;
-		}
-		if (should_break) break;
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
-		if (std::chrono::steady_clock::now() - start_time > std::chrono::seconds(10))
-		{
-			printf("APDOOM: Failed to connect, timeout 10s\n");
-			return 0;
+			}
 		}
 	}
 
@@ -645,84 +1065,100 @@ int apdoom_init(ap_settings_t* settings)
 		}
 	}
 
-	// Scout locations to see which are progressive
-	if (ap_progressive_locations.empty())
+	// Scout locations to see which are progressive. Levels the save already
+	// knows progression for are skipped. The rest go out a level at a time
+	// as replies come back, starting with the one we left off in, so
+	// nothing here waits on the network.
+	if (!ap_replaying)
 	{
-		std::vector<int64_t> location_scouts;
-
-		const auto& loc_table = get_location_table();
-		for (const auto& kv1 : loc_table)
+		int current_level = (ap_state.ep > 0 && ap_state.map > 0) ? (ap_state.ep - 1) * max_map_count + (ap_state.map - 1) : -1;
+		for (int ep = 0; ep < ap_episode_count; ++ep)
 		{
-			if (!ap_state.episodes[kv1.first - 1])
-				continue;
-			for (const auto& kv2 : kv1.second)
+			if (!ap_state.episodes[ep]) continue;
+			int map_count = ap_get_map_count(ep + 1);
+			for (int map = 0; map < map_count; ++map)
 			{
-				for (const auto& kv3 : kv2.second)
-				{
-					if (kv3.first == -1) continue;
-					if (kv3.second == 371349)
-					{
-						int tmp;
-						tmp = 5;
-					}
-					if (validate_doom_location({kv1.first - 1, kv2.first - 1}, kv3.first))
-					{
-						location_scouts.push_back(kv3.second);
-					}
-				}
+				int level = ep * max_map_count + map;
+				const auto& bits = ap_progression_bits[level];
+				if (std::find(bits.begin(), bits.end(), true) != bits.end())
+					continue;
+				if (level == current_level)
+					ap_scout_queue.push_front(level);
+				else
+					ap_scout_queue.push_back(level);
 			}
 		}
-		
-		printf("APDOOM: Scouting for %i locations...\n", (int)location_scouts.size());
-		AP_SendLocationScouts(location_scouts, 0);
 
-		// Wait for location infos
-		start_time = std::chrono::steady_clock::now();
-		while (ap_progressive_locations.empty())
-		{
-			apdoom_update();
-		
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
-			if (std::chrono::steady_clock::now() - start_time > std::chrono::seconds(10))
-			{
-				printf("APDOOM: Timeout waiting for LocationScouts. 10s\n  Do you have a VPN active?\n  Checks will all look non-progression.");
-				break;
-			}
-		}
-	}
-	else
-	{
-		printf("APDOOM: Scout locations cached loaded\n");
+		if (ap_scout_queue.empty())
+			printf("APDOOM: Scout locations cached loaded\n");
+		else
+			printf("APDOOM: Scouting %i levels in the background\n", (int)ap_scout_queue.size());
+		send_location_scouts();
 	}
 	
 	printf("APDOOM: Initialized\n");
 	ap_initialized = true;
+	if (ap_settings.tracker_export)
+		tracker_open();
+	if (ap_settings.flood_items > 0 || ap_settings.flood_locations > 0 || ap_settings.flood_messages > 0)
+		start_flood_thread();
 	return 1;
 }
 
 
 static bool is_loc_checked(ap_level_index_t idx, int index)
 {
+	if (index < 0) return false;
+	if (idx.ep < 0 || idx.ep >= ap_episode_count || idx.map < 0 || idx.map >= max_map_count) return false;
+
+	const auto& bits = ap_check_bits[idx.ep * max_map_count + idx.map];
+	return index < (int)bits.size() && bits[index];
+}
+
+
+static void set_loc_checked(ap_level_index_t idx, int index)
+{
+	if (index < 0 || is_loc_checked(idx, index)) return;
+
+	auto& bits = ap_check_bits[idx.ep * max_map_count + idx.map];
+	if (index >= (int)bits.size())
+		bits.resize(index + 1, false);
+	bits[index] = true;
+	ap_tracker_checks_dirty = true;
+
 	auto level_state = ap_get_level_state(idx);
-	for (int i = 0; i < level_state->check_count; ++i)
-	{
-		if (level_state->checks[i] == index) return true;
-	}
-	return false;
+	if (level_state->check_count < AP_CHECK_MAX)
+		level_state->checks[level_state->check_count] = index;
+	level_state->check_count++;
+}
+
+
+int apdoom_is_location_checked(ap_level_index_t idx, int index)
+{
+	return is_loc_checked(idx, index) ? 1 : 0;
 }
 
 
 void apdoom_shutdown()
 {
+	stop_net_thread();
+	stop_flood_thread();
+	tracker_close();
 	if (ap_was_connected)
-		save_state();
+		journal_compact();
+	std::lock_guard<std::mutex> lock(ap_record_mutex);
+	if (ap_record_file)
+	{
+		fclose(ap_record_file);
+		ap_record_file = nullptr;
+	}
 }
 
 
 void apdoom_save_state()
 {
 	if (ap_was_connected)
-		save_state();
+		journal_state();
 }
 
 
@@ -790,17 +1226,37 @@ void load_state()
 {
 	printf("APDOOM: Load sate\n");
 
+	if (snapshot_load())
+		return;
+
 	std::string filename = ap_save_dir_name + "/apstate.json";
-	std::ifstream f(filename);
+	std::ifstream f(filename, std::ios::binary);
 	if (!f.is_open())
 	{
 		printf("  None found.\n");
 		return; // Could be no state yet, that's fine
 	}
-	Json::Value json;
-	f >> json;
+
+	// Read in one go and parse from memory, rather than through the stream
+	std::string text((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
 	f.close();
 
+	Json::Value json;
+	Json::CharReaderBuilder builder;
+	std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+	std::string errors;
+	if (!reader->parse(text.data(), text.data() + text.size(), &json, &errors))
+	{
+		printf("  Failed to parse: %s\n", errors.c_str());
+		return;
+	}
+
+	load_state_json(json);
+}
+
+
+static void load_state_json(const Json::Value& json)
+{
 	// Player state
 	json_get_int(json["player"]["health"], ap_state.player_state.health);
 	json_get_int(json["player"]["armor_points"], ap_state.player_state.armor_points);
@@ -867,6 +1323,13 @@ void load_state()
 			json_get_bool_or(json["episodes"][i][j]["unlocked"], level_state->unlocked);
 			json_get_bool_or(json["episodes"][i][j]["special"], level_state->special);
 
+			for (const auto& json_prog : json["episodes"][i][j]["progression"])
+			{
+				int64_t loc_id = 0;
+				if (get_location_id(ap_level_index_t{i, j}, json_prog.asInt(), loc_id))
+					set_location_progression(loc_id);
+			}
+
 			//int k = 0;
 			//for (const auto& json_check : json["episodes"][i][j]["checks"])
 			//{
@@ -879,6 +1342,7 @@ void load_state()
 	for (const auto& item_id_json : json["item_queue"])
 	{
 		ap_item_queue.push_back(item_id_json.asInt64());
+		ap_item_queue_times.push_back(-1);
 	}
 
 	json_get_int(json["ep"], ap_state.ep);
@@ -899,9 +1363,10 @@ void load_state()
 	printf("  Episode: %i\n", ap_state.ep);
 	printf("  Map: %i\n", ap_state.map);
 
+	// Older saves kept a flat list of location ids
 	for (const auto& prog_json : json["progressive_locations"])
 	{
-		ap_progressive_locations.insert(prog_json.asInt64());
+		set_location_progression(prog_json.asInt64());
 	}
 	
 	json_get_bool_or(json["victory"], ap_state.victory);
@@ -925,14 +1390,24 @@ static Json::Value serialize_level(int ep, int map)
 	json_level["special"] = level_state->special;
 
 	Json::Value json_checks(Json::arrayValue);
-	for (int k = 0; k < AP_CHECK_MAX; ++k)
+	const auto& check_bits = ap_check_bits[(ep - 1) * max_map_count + (map - 1)];
+	for (int k = 0; k < (int)check_bits.size(); ++k)
 	{
-		if (level_state->checks[k] == -1)
-			continue;
-		json_checks.append(level_state->checks[k]);
+		if (check_bits[k])
+			json_checks.append(k);
 	}
 	json_level["checks"] = json_checks;
 
+	// Progression items (So we don't scout everytime we connect)
+	Json::Value json_progression(Json::arrayValue);
+	const auto& bits = ap_progression_bits[(ep - 1) * max_map_count + (map - 1)];
+	for (int k = 0; k < (int)bits.size(); ++k)
+	{
+		if (bits[k])
+			json_progression.append(k);
+	}
+	json_level["progression"] = json_progression;
+
 	return json_level;
 }
 
@@ -967,6 +1442,15 @@ void save_state()
 		return; // Ok that's bad. we won't save player state
 	}
 
+	f << serialize_state();
+	f.close();
+
+	snapshot_save();
+}
+
+
+static Json::Value serialize_state()
+{
 	// Player state
 	Json::Value json;
 	Json::Value json_player;
@@ -1035,410 +1519,1098 @@ void save_state()
 		json["enabled_episodes"][i++] = ap_state.episodes[i] ? true : false;
 	json["map"] = ap_state.map;
 
-	// Progression items (So we don't scout everytime we connect)
-	for (auto loc_id : ap_progressive_locations)
-	{
-		json["progressive_locations"].append(loc_id);
-	}
-
 	json["victory"] = ap_state.victory;
 
 	json["version"] = APDOOM_VERSION_FULL_TEXT;
 
-	f << json;
+	return json;
 }
 
 
-void f_itemclr()
+//
+// State journal
+//
+// apstate.json is a full snapshot. Between snapshots, apdoom_save_state()
+// only appends what changed since the last save to apstate.journal, so a
+// save costs O(change) instead of rebuilding and rewriting the whole JSON.
+// On load the journal is replayed over the snapshot. Once the journal grows
+// past AP_JOURNAL_COMPACT_SIZE (or on shutdown) it is folded back into the
+// snapshot and truncated.
+//
+
+#define AP_JOURNAL_MAGIC 0x314A5041 // "APJ1"
+#define AP_JOURNAL_COMPACT_SIZE (64 * 1024)
+
+enum : uint8_t
 {
-	// Not sure what use this would have here.
-}
+	AP_JOURNAL_LEVEL_FLAG = 1, // arg = ap_journal_level_flag_t, value = flag value
+	AP_JOURNAL_CHECK, // value = thing index
+	AP_JOURNAL_POSITION, // ep, map = ap_state.ep, ap_state.map
+	AP_JOURNAL_VICTORY, // value = ap_state.victory
+	AP_JOURNAL_PLAYER, // value = number of int32 that follows
+	AP_JOURNAL_ITEM_QUEUE, // value = number of int64 that follows, replaces the queue
+	AP_JOURNAL_PROGRESSIVE, // value = number of int64 that follows, added to the set
+	AP_JOURNAL_EPISODE, // arg = episode, value = enabled
+};
 
+enum ap_journal_level_flag_t : uint8_t
+{
+	AP_JOURNAL_FLAG_COMPLETED,
+	AP_JOURNAL_FLAG_KEY0,
+	AP_JOURNAL_FLAG_KEY1,
+	AP_JOURNAL_FLAG_KEY2,
+	AP_JOURNAL_FLAG_HAS_MAP,
+	AP_JOURNAL_FLAG_UNLOCKED,
+	AP_JOURNAL_FLAG_SPECIAL,
+	AP_JOURNAL_FLAG_COUNT
+};
 
-static const std::map<int, int> doom_keys_map = {{5, 0}, {40, 0}, {6, 1}, {39, 1}, {13, 2}, {38, 2}};
-static const std::map<int, int> doom2_keys_map = {{5, 0}, {40, 0}, {6, 1}, {39, 1}, {13, 2}, {38, 2}};
-static const std::map<int, int> heretic_keys_map = {{80, 0}, {73, 1}, {79, 2}};
+struct ap_journal_record_t
+{
+	uint8_t type;
+	uint8_t ep; // 0-based
+	uint8_t map; // 0-based
+	uint8_t arg;
+	int32_t value;
+};
 
 
-const std::map<int, int>& get_keys_map()
+// What the snapshot + journal on disk currently hold
+struct ap_journal_shadow_t
 {
-	switch (ap_game)
-	{
-		case ap_game_t::doom: return doom_keys_map;
-		case ap_game_t::doom2: return doom2_keys_map;
-		case ap_game_t::heretic: return heretic_keys_map;
-	}
+	std::vector<ap_level_state_t> level_states;
+	std::vector<int> player;
+	std::vector<int> episodes;
+	std::deque<int64_t> item_queue;
+	std::set<int64_t> progressive_locations;
+	std::vector<std::vector<bool>> check_bits;
+	int ep = 0;
+	int map = 0;
+	int victory = 0;
+};
+
+
+static FILE* ap_journal_file = nullptr;
+static long ap_journal_size = 0;
+static ap_journal_shadow_t ap_journal_shadow;
+
+
+static std::string journal_filename()
+{
+	return ap_save_dir_name + "/apstate.journal";
 }
 
 
-int get_map_doom_type()
+static int* level_flag_ptr(ap_level_state_t* level_state, int flag)
 {
-	switch (ap_game)
+	switch (flag)
 	{
-		case ap_game_t::doom: return 2026;
-		case ap_game_t::doom2: return 2026;
-		case ap_game_t::heretic: return 35;
+		case AP_JOURNAL_FLAG_COMPLETED: return &level_state->completed;
+		case AP_JOURNAL_FLAG_KEY0: return &level_state->keys[0];
+		case AP_JOURNAL_FLAG_KEY1: return &level_state->keys[1];
+		case AP_JOURNAL_FLAG_KEY2: return &level_state->keys[2];
+		case AP_JOURNAL_FLAG_HAS_MAP: return &level_state->has_map;
+		case AP_JOURNAL_FLAG_UNLOCKED: return &level_state->unlocked;
+		case AP_JOURNAL_FLAG_SPECIAL: return &level_state->special;
 	}
+	return nullptr;
 }
 
 
-static const std::map<int, int> doom_weapons_map = {{2001, 2}, {2002, 3}, {2003, 4}, {2004, 5}, {2006, 6}, {2005, 7}};
-static const std::map<int, int> doom2_weapons_map = {{2001, 2}, {2002, 3}, {2003, 4}, {2004, 5}, {2006, 6}, {2005, 7}, {82, 8}};
-static const std::map<int, int> heretic_weapons_map = {{2005, 7}, {2001, 2}, {53, 3}, {2003, 5}, {2002, 6}, {2004, 4}};
-
-
-const std::map<int, int>& get_weapons_map()
+// Player state flattened, in the same order the JSON stores it
+static std::vector<int> flatten_player_state()
 {
-	switch (ap_game)
+	const auto& p = ap_state.player_state;
+	std::vector<int> out = {
+		p.health, p.armor_points, p.armor_type, p.backpack,
+		p.ready_weapon, p.kill_count, p.item_count, p.secret_count
+	};
+	out.insert(out.end(), p.powers, p.powers + ap_powerup_count);
+	out.insert(out.end(), p.weapon_owned, p.weapon_owned + ap_weapon_count);
+	out.insert(out.end(), p.ammo, p.ammo + ap_ammo_count);
+	out.insert(out.end(), p.max_ammo, p.max_ammo + ap_ammo_count);
+	for (int i = 0; i < ap_inventory_count; ++i)
 	{
-		case ap_game_t::doom: return doom_weapons_map;
-		case ap_game_t::doom2: return doom2_weapons_map;
-		case ap_game_t::heretic: return heretic_weapons_map;
+		out.push_back(p.inventory[i].type);
+		out.push_back(p.inventory[i].count);
 	}
+	return out;
 }
 
 
-const std::map<int, std::string>& get_sprites()
+static bool unflatten_player_state(const std::vector<int>& in)
 {
-	switch (ap_game)
+	auto& p = ap_state.player_state;
+	size_t expected = 8 + ap_powerup_count + ap_weapon_count + ap_ammo_count * 2 + ap_inventory_count * 2;
+	if (in.size() != expected) return false;
+
+	const int* v = in.data();
+	p.health = *v++;
+	p.armor_points = *v++;
+	p.armor_type = *v++;
+	p.backpack = *v++;
+	p.ready_weapon = *v++;
+	p.kill_count = *v++;
+	p.item_count = *v++;
+	p.secret_count = *v++;
+	for (int i = 0; i < ap_powerup_count; ++i) p.powers[i] = *v++;
+	for (int i = 0; i < ap_weapon_count; ++i) p.weapon_owned[i] = *v++;
+	for (int i = 0; i < ap_ammo_count; ++i) p.ammo[i] = *v++;
+	for (int i = 0; i < ap_ammo_count; ++i) p.max_ammo[i] = *v++;
+	for (int i = 0; i < ap_inventory_count; ++i)
 	{
-		case ap_game_t::doom: return ap_doom_type_sprites;
-		case ap_game_t::doom2: return ap_doom2_type_sprites;
-		case ap_game_t::heretic: return ap_heretic_type_sprites;
+		p.inventory[i].type = *v++;
+		p.inventory[i].count = *v++;
 	}
+	return true;
 }
 
 
-std::string get_exmx_name(const std::string& name)
+static void journal_update_shadow()
 {
-	auto pos = name.find_first_of('(');
-	if (pos == std::string::npos) return name;
-	return name.substr(pos);
+	auto& shadow = ap_journal_shadow;
+	shadow.level_states.assign(ap_state.level_states, ap_state.level_states + ap_episode_count * max_map_count);
+	shadow.player = flatten_player_state();
+	shadow.episodes.assign(ap_state.episodes, ap_state.episodes + ap_episode_count);
+	shadow.item_queue = ap_item_queue;
+	shadow.progressive_locations = ap_progressive_locations;
+	shadow.check_bits = ap_check_bits;
+	shadow.ep = ap_state.ep;
+	shadow.map = ap_state.map;
+	shadow.victory = ap_state.victory;
 }
 
 
-void f_itemrecv(int64_t item_id, int player_id, bool notify_player)
+static void journal_open(bool truncate)
 {
-	const auto& item_type_table = get_item_type_table();
-	auto it = item_type_table.find(item_id);
-	if (it == item_type_table.end())
-		return; // Skip
-	ap_item_t item = it->second;
-	ap_level_index_t idx = {item.ep - 1, item.map - 1};
-	ap_level_info_t* level_info = ap_get_level_info(idx);
-
-	std::string notif_text;
-
-	auto level_state = ap_get_level_state(idx);
-
-	// Key?
-	const auto& keys_map = get_keys_map();
-	auto key_it = keys_map.find(item.doom_type);
-	if (key_it != keys_map.end())
+	if (ap_journal_file)
 	{
-		level_state->keys[key_it->second] = 1;
-		notif_text = get_exmx_name(level_info->name);
+		fclose(ap_journal_file);
+		ap_journal_file = nullptr;
 	}
 
-	// Map?
-	if (item.doom_type == get_map_doom_type())
+	std::string filename = journal_filename();
+	ap_journal_file = AP_fopen(filename.c_str(), truncate ? "wb" : "ab");
+	if (!ap_journal_file)
 	{
-		level_state->has_map = 1;
-		notif_text = get_exmx_name(level_info->name);
+		printf("APDOOM: Failed to open state journal, falling back to full saves.\n");
+		return;
 	}
 
-	// Backpack?
-	if (item.doom_type == 8)
+	fseek(ap_journal_file, 0, SEEK_END);
+	ap_journal_size = ftell(ap_journal_file);
+	if (ap_journal_size == 0)
 	{
-		ap_state.player_state.backpack = 1;
-		auto max_ammos = get_max_ammos();
-		for (int i = 0; i < ap_ammo_count; ++i)
-			ap_state.player_state.max_ammo[i] = max_ammos[i] * 2;
+		uint32_t magic = AP_JOURNAL_MAGIC;
+		fwrite(&magic, sizeof(magic), 1, ap_journal_file);
+		ap_journal_size = sizeof(magic);
 	}
 
-	// Weapon?
-	const auto& weapons_map = get_weapons_map();
-	auto weapon_it = weapons_map.find(item.doom_type);
-	if (weapon_it != weapons_map.end())
-		ap_state.player_state.weapon_owned[weapon_it->second] = 1;
-
-	// Ignore inventory items, the game will add them up
-
-	// Is it a level?
-	if (item.doom_type == -1)
-	{
-		level_state->unlocked = 1;
-		notif_text = get_exmx_name(level_info->name);
-	}
+	journal_update_shadow();
+}
 
-	// Level complete?
-	if (item.doom_type == -2)
-		level_state->completed = 1;
 
+static void journal_write(uint8_t type, int ep, int map, int arg, int32_t value, const void* payload = nullptr, size_t payload_size = 0)
+{
+	ap_journal_record_t record = {type, (uint8_t)ep, (uint8_t)map, (uint8_t)arg, value};
+	fwrite(&record, sizeof(record), 1, ap_journal_file);
+	if (payload_size)
+		fwrite(payload, payload_size, 1, ap_journal_file);
+	ap_journal_size += (long)(sizeof(record) + payload_size);
+}
 
-	if (!notify_player) return;
 
-	if (!ap_is_in_game)
+static void journal_state()
+{
+	if (!ap_journal_file)
 	{
-		ap_item_queue.push_back(item_id);
+		save_state();
 		return;
 	}
 
-	// Give item to player
-	ap_settings.give_item_callback(item.doom_type, item.ep, item.map);
+	auto& shadow = ap_journal_shadow;
 
-	// Add notification icon
-	const auto& sprite_map = get_sprites();
-	auto sprite_it = sprite_map.find(item.doom_type);
-	if (sprite_it != sprite_map.end())
+	// Level states
+	for (int ep = 0; ep < ap_episode_count; ++ep)
 	{
-		ap_notification_icon_t notif;
-		snprintf(notif.sprite, 9, "%s", sprite_it->second.c_str());
-		notif.t = 0;
-		notif.text[0] = '\0'; // For now
-		if (notif_text != "")
+		int map_count = ap_get_map_count(ep + 1);
+		for (int map = 0; map < map_count; ++map)
 		{
-			snprintf(notif.text, 260, "%s", notif_text.c_str());
-		}
-		notif.xf = AP_NOTIF_SIZE / 2 + AP_NOTIF_PADDING;
-		notif.yf = -200.0f + AP_NOTIF_SIZE / 2;
-		notif.state = AP_NOTIF_STATE_PENDING;
-		notif.velx = 0.0f;
-		notif.vely = 0.0f;
-		notif.x = (int)notif.xf;
-		notif.y = (int)notif.yf;
-		ap_notification_icons.push_back(notif);
-	}
-}
+			auto level_state = ap_get_level_state(ap_level_index_t{ep, map});
+			auto& old_state = shadow.level_states[ep * max_map_count + map];
 
+			for (int flag = 0; flag < AP_JOURNAL_FLAG_COUNT; ++flag)
+			{
+				int value = *level_flag_ptr(level_state, flag);
+				if (value != *level_flag_ptr(&old_state, flag))
+					journal_write(AP_JOURNAL_LEVEL_FLAG, ep, map, flag, value);
+			}
 
-bool find_location(int64_t loc_id, int &ep, int &map, int &index)
-{
-	ep = -1;
-	map = -1;
-	index = -1;
-
-	const auto& loc_table = get_location_table();
-	for (const auto& loc_map_table : loc_table)
-	{
-		for (const auto& loc_index_table : loc_map_table.second)
-		{
-			for (const auto& loc_index : loc_index_table.second)
+			// Checks only ever get added
+			if (old_state.check_count != level_state->check_count)
 			{
-				if (loc_index.second == loc_id)
+				const auto& bits = ap_check_bits[ep * max_map_count + map];
+				const auto& old_bits = shadow.check_bits[ep * max_map_count + map];
+				for (int i = 0; i < (int)bits.size(); ++i)
 				{
-					ep = loc_map_table.first;
-					map = loc_index_table.first;
-					index = loc_index.first;
-					break;
+					if (bits[i] && (i >= (int)old_bits.size() || !old_bits[i]))
+						journal_write(AP_JOURNAL_CHECK, ep, map, 0, i);
 				}
 			}
-			if (ep != -1) break;
 		}
-		if (ep != -1) break;
 	}
-	return (ep > 0);
-}
 
+	// Player
+	auto player = flatten_player_state();
+	if (player != shadow.player)
+		journal_write(AP_JOURNAL_PLAYER, 0, 0, 0, (int32_t)player.size(), player.data(), player.size() * sizeof(int));
 
-void f_locrecv(int64_t loc_id)
-{
-	// Find where this location is
-	int ep = -1;
-	int map = -1;
-	int index = -1;
-	if (!find_location(loc_id, ep, map, index))
+	// Episodes
+	for (int ep = 0; ep < ap_episode_count; ++ep)
+		if (ap_state.episodes[ep] != shadow.episodes[ep])
+			journal_write(AP_JOURNAL_EPISODE, 0, 0, ep, ap_state.episodes[ep]);
+
+	// Item queue
+	if (ap_item_queue != shadow.item_queue)
 	{
-		printf("APDOOM: In f_locrecv, loc id not found: %i\n", (int)loc_id);
-		return; // Loc not found
+		std::vector<int64_t> item_queue(ap_item_queue.begin(), ap_item_queue.end());
+		journal_write(AP_JOURNAL_ITEM_QUEUE, 0, 0, 0, (int32_t)item_queue.size(), item_queue.data(), item_queue.size() * sizeof(int64_t));
 	}
 
-	ap_level_index_t idx = {ep - 1, map - 1};
+	// Progressive locations only ever grow
+	if (ap_progressive_locations.size() != shadow.progressive_locations.size())
+	{
+		std::vector<int64_t> added;
+		for (auto loc_id : ap_progressive_locations)
+			if (shadow.progressive_locations.find(loc_id) == shadow.progressive_locations.end())
+				added.push_back(loc_id);
+		journal_write(AP_JOURNAL_PROGRESSIVE, 0, 0, 0, (int32_t)added.size(), added.data(), added.size() * sizeof(int64_t));
+	}
 
-	// Make sure we didn't already check it
-	if (is_loc_checked(idx, index)) return;
-	if (index < 0) return;
+	if (ap_state.ep != shadow.ep || ap_state.map != shadow.map)
+		journal_write(AP_JOURNAL_POSITION, ap_state.ep, ap_state.map, 0, 0);
 
-	auto level_state = ap_get_level_state(idx);
-	level_state->checks[level_state->check_count] = index;
-	level_state->check_count++;
-}
+	if (ap_state.victory != shadow.victory)
+		journal_write(AP_JOURNAL_VICTORY, 0, 0, 0, ap_state.victory);
 
+	fflush(ap_journal_file);
+	journal_update_shadow();
 
-void f_locinfo(std::vector<AP_NetworkItem> loc_infos)
-{
-	for (const auto& loc_info : loc_infos)
-	{
-		if (loc_info.flags & 1)
-			ap_progressive_locations.insert(loc_info.location);
-	}
+	if (ap_journal_size > AP_JOURNAL_COMPACT_SIZE)
+		journal_compact();
 }
 
 
-void f_goal(int goal)
+static void journal_compact()
 {
-	ap_state.goal = goal;
+	save_state();
+	journal_open(true);
 }
 
 
-void f_difficulty(int difficulty)
+// Reads a whole file, in one go
+static bool read_file(const std::string& filename, std::vector<uint8_t>& out)
 {
-	if (ap_settings.override_skill)
-		return;
+	FILE* f = AP_fopen(filename.c_str(), "rb");
+	if (!f) return false;
 
-	ap_state.difficulty = difficulty;
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	out.resize(size > 0 ? (size_t)size : 0);
+	bool ok = size >= 0 && (out.empty() || fread(out.data(), 1, out.size(), f) == out.size());
+	fclose(f);
+	return ok;
 }
 
 
-void f_random_monsters(int random_monsters)
+// Applies a run of journal records, from apstate.journal or apstate.bin.
+// Returns how many were applied. end, if given, is set past the last
+// complete record.
+static int journal_apply(const uint8_t* data, size_t size, size_t* end = nullptr)
 {
-	if (ap_settings.override_monster_rando)
-		return;
+	size_t pos = 0;
+	size_t record_end = 0;
+	int record_count = 0;
+	ap_journal_record_t record;
+	while (size - pos >= sizeof(record))
+	{
+		memcpy(&record, data + pos, sizeof(record));
+		pos += sizeof(record);
 
-	ap_state.random_monsters = random_monsters;
+		// A record cut short by a crash ends the replay
+		std::vector<int> ints;
+		std::vector<int64_t> int64s;
+		if (record.type == AP_JOURNAL_PLAYER)
+		{
+			if (record.value < 0 || (size - pos) / sizeof(int) < (size_t)record.value) break;
+			ints.resize(record.value);
+			if (record.value) memcpy(ints.data(), data + pos, ints.size() * sizeof(int));
+			pos += ints.size() * sizeof(int);
+		}
+		else if (record.type == AP_JOURNAL_ITEM_QUEUE || record.type == AP_JOURNAL_PROGRESSIVE)
+		{
+			if (record.value < 0 || (size - pos) / sizeof(int64_t) < (size_t)record.value) break;
+			int64s.resize(record.value);
+			if (record.value) memcpy(int64s.data(), data + pos, int64s.size() * sizeof(int64_t));
+			pos += int64s.size() * sizeof(int64_t);
+		}
+
+		bool valid_level = record.ep < ap_episode_count && record.map < ap_get_map_count(record.ep + 1);
+
+		switch (record.type)
+		{
+			case AP_JOURNAL_LEVEL_FLAG:
+				if (valid_level && record.arg < AP_JOURNAL_FLAG_COUNT)
+					*level_flag_ptr(ap_get_level_state(ap_level_index_t{record.ep, record.map}), record.arg) = record.value;
+				break;
+			case AP_JOURNAL_CHECK:
+				if (valid_level)
+					set_loc_checked(ap_level_index_t{record.ep, record.map}, record.value);
+				break;
+			case AP_JOURNAL_POSITION:
+				ap_state.ep = record.ep;
+				ap_state.map = record.map;
+				break;
+			case AP_JOURNAL_VICTORY:
+				ap_state.victory = record.value;
+				break;
+			case AP_JOURNAL_PLAYER:
+				unflatten_player_state(ints);
+				break;
+			case AP_JOURNAL_ITEM_QUEUE:
+				ap_item_queue.assign(int64s.begin(), int64s.end());
+				ap_item_queue_times.assign(int64s.size(), -1);
+				break;
+			case AP_JOURNAL_PROGRESSIVE:
+				for (auto loc_id : int64s)
+					set_location_progression(loc_id);
+				break;
+			case AP_JOURNAL_EPISODE:
+				if (record.arg < ap_episode_count)
+					ap_state.episodes[record.arg] = record.value;
+				break;
+		}
+		++record_count;
+		record_end = pos;
+	}
+
+	if (end) *end = record_end;
+	return record_count;
 }
 
 
-void f_random_items(int random_items)
+// False if the journal can't be appended to as it is: its magic is wrong,
+// or a crash left half a record at its end.
+static bool journal_replay()
 {
-	if (ap_settings.override_item_rando)
-		return;
+	std::vector<uint8_t> data;
+	if (!read_file(journal_filename(), data)) return true; // No journal, the snapshot is all there is
 
-	ap_state.random_items = random_items;
+	uint32_t magic = 0;
+	if (data.size() >= sizeof(magic))
+		memcpy(&magic, data.data(), sizeof(magic));
+	if (magic != AP_JOURNAL_MAGIC)
+	{
+		printf("APDOOM: Ignoring invalid state journal\n");
+		return false;
+	}
+
+	size_t end = 0;
+	int record_count = journal_apply(data.data() + sizeof(magic), data.size() - sizeof(magic), &end);
+	printf("  Replayed %i journal records\n", record_count);
+	if (end != data.size() - sizeof(magic))
+	{
+		printf("APDOOM: State journal ends in a partial record, compacting\n");
+		return false;
+	}
+	return true;
 }
 
 
-void f_random_music(int random_music)
+//
+// Binary snapshot
+//
+// apstate.bin holds the same state as apstate.json, as a run of journal
+// records, and is written next to it. Loading it is a checksum and a
+// replay with no parsing, so load_state prefers it. apstate.json stays
+// the fallback, and what older versions read.
+//
+
+#define AP_SNAPSHOT_MAGIC 0x31535041 // "APS1"
+#define AP_SNAPSHOT_VERSION 1
+
+struct ap_snapshot_header_t
 {
-	if (ap_settings.override_music_rando)
-		return;
+	uint32_t magic;
+	uint32_t version;
+	uint32_t size; // Bytes of records that follow
+	uint32_t checksum; // FNV-1a of the records
+	int32_t episode_count;
+	int32_t map_count; // max_map_count
+};
 
-	ap_state.random_music = random_music;
+
+static std::string snapshot_filename()
+{
+	return ap_save_dir_name + "/apstate.bin";
 }
 
 
-void f_flip_levels(int flip_levels)
+static uint32_t snapshot_checksum(const uint8_t* data, size_t size)
 {
-	if (ap_settings.override_flip_levels)
-		return;
-
-	ap_state.flip_levels = flip_levels;
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < size; ++i)
+		hash = (hash ^ data[i]) * 16777619u;
+	return hash;
 }
 
 
-void f_check_sanity(int check_sanity)
+static void snapshot_pack(std::vector<uint8_t>& out, uint8_t type, int ep, int map, int arg, int32_t value, const void* payload = nullptr, size_t payload_size = 0)
 {
-	ap_state.check_sanity = check_sanity;
+	ap_journal_record_t record = {type, (uint8_t)ep, (uint8_t)map, (uint8_t)arg, value};
+	const uint8_t* bytes = (const uint8_t*)&record;
+	out.insert(out.end(), bytes, bytes + sizeof(record));
+	if (payload_size)
+		out.insert(out.end(), (const uint8_t*)payload, (const uint8_t*)payload + payload_size);
 }
 
 
-void f_reset_level_on_death(int reset_level_on_death)
+static void snapshot_save()
 {
-	if (ap_settings.override_reset_level_on_death)
-		return;
+	std::vector<uint8_t> out(sizeof(ap_snapshot_header_t));
 
-	ap_state.reset_level_on_death = reset_level_on_death;
+	auto player = flatten_player_state();
+	snapshot_pack(out, AP_JOURNAL_PLAYER, 0, 0, 0, (int32_t)player.size(), player.data(), player.size() * sizeof(int));
+	for (int ep = 0; ep < ap_episode_count; ++ep)
+		snapshot_pack(out, AP_JOURNAL_EPISODE, 0, 0, ep, ap_state.episodes[ep]);
+
+	for (int ep = 0; ep < ap_episode_count; ++ep)
+	{
+		int map_count = ap_get_map_count(ep + 1);
+		for (int map = 0; map < map_count; ++map)
+		{
+			auto level_state = ap_get_level_state(ap_level_index_t{ep, map});
+			for (int flag = 0; flag < AP_JOURNAL_FLAG_COUNT; ++flag)
+				snapshot_pack(out, AP_JOURNAL_LEVEL_FLAG, ep, map, flag, *level_flag_ptr(level_state, flag));
+
+			const auto& bits = ap_check_bits[ep * max_map_count + map];
+			for (int i = 0; i < (int)bits.size(); ++i)
+				if (bits[i])
+					snapshot_pack(out, AP_JOURNAL_CHECK, ep, map, 0, i);
+		}
+	}
+
+	std::vector<int64_t> item_queue(ap_item_queue.begin(), ap_item_queue.end());
+	snapshot_pack(out, AP_JOURNAL_ITEM_QUEUE, 0, 0, 0, (int32_t)item_queue.size(), item_queue.data(), item_queue.size() * sizeof(int64_t));
+	std::vector<int64_t> progressive(ap_progressive_locations.begin(), ap_progressive_locations.end());
+	snapshot_pack(out, AP_JOURNAL_PROGRESSIVE, 0, 0, 0, (int32_t)progressive.size(), progressive.data(), progressive.size() * sizeof(int64_t));
+	snapshot_pack(out, AP_JOURNAL_POSITION, ap_state.ep, ap_state.map, 0, 0);
+	snapshot_pack(out, AP_JOURNAL_VICTORY, 0, 0, 0, ap_state.victory);
+
+	ap_snapshot_header_t header;
+	header.magic = AP_SNAPSHOT_MAGIC;
+	header.version = AP_SNAPSHOT_VERSION;
+	header.size = (uint32_t)(out.size() - sizeof(header));
+	header.checksum = snapshot_checksum(out.data() + sizeof(header), header.size);
+	header.episode_count = ap_episode_count;
+	header.map_count = max_map_count;
+	memcpy(out.data(), &header, sizeof(header));
+
+	// Written aside and moved over, so a crash never leaves half of one.
+	// If that fails, the stale one must not shadow apstate.json.
+	std::string filename = snapshot_filename();
+	std::string temp_filename = filename + ".tmp";
+	FILE* f = AP_fopen(temp_filename.c_str(), "wb");
+	bool ok = f && fwrite(out.data(), 1, out.size(), f) == out.size();
+	if (f && fclose(f) != 0)
+		ok = false;
+#ifdef _WIN32
+	ok = ok && MoveFileExA(temp_filename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+	ok = ok && rename(temp_filename.c_str(), filename.c_str()) == 0;
+#endif
+	if (!ok)
+	{
+		printf("APDOOM: Failed to write %s\n", filename.c_str());
+		remove(temp_filename.c_str());
+		remove(filename.c_str());
+	}
 }
 
 
-void f_episode1(int ep)
+static bool snapshot_load()
 {
-	ap_state.episodes[0] = ep;
+	std::vector<uint8_t> data;
+	if (!read_file(snapshot_filename(), data)) return false;
+
+	ap_snapshot_header_t header;
+	if (data.size() < sizeof(header)) return false;
+	memcpy(&header, data.data(), sizeof(header));
+	if (header.magic != AP_SNAPSHOT_MAGIC || header.version != AP_SNAPSHOT_VERSION ||
+		header.size != data.size() - sizeof(header) ||
+		header.episode_count != ap_episode_count || header.map_count != max_map_count ||
+		header.checksum != snapshot_checksum(data.data() + sizeof(header), header.size))
+	{
+		printf("  Ignoring invalid apstate.bin\n");
+		return false;
+	}
+
+	int record_count = journal_apply(data.data() + sizeof(header), header.size);
+	printf("  Loaded %i snapshot records\n", record_count);
+	printf("  Episode: %i\n", ap_state.ep);
+	printf("  Map: %i\n", ap_state.map);
+	printf("  Victory state: %s\n", ap_state.victory ? "true" : "false");
+	return true;
 }
 
 
-void f_episode2(int ep)
+void f_itemclr()
 {
-	ap_state.episodes[1] = ep;
+	// Not sure what use this would have here.
 }
 
 
-void f_episode3(int ep)
+static const std::map<int, int> doom_keys_map = {{5, 0}, {40, 0}, {6, 1}, {39, 1}, {13, 2}, {38, 2}};
+static const std::map<int, int> doom2_keys_map = {{5, 0}, {40, 0}, {6, 1}, {39, 1}, {13, 2}, {38, 2}};
+static const std::map<int, int> heretic_keys_map = {{80, 0}, {73, 1}, {79, 2}};
+
+
+const std::map<int, int>& get_keys_map()
 {
-	ap_state.episodes[2] = ep;
+	switch (ap_game)
+	{
+		case ap_game_t::doom: return doom_keys_map;
+		case ap_game_t::doom2: return doom2_keys_map;
+		case ap_game_t::heretic: return heretic_keys_map;
+	}
 }
 
 
-void f_episode4(int ep)
+int get_map_doom_type()
 {
-	ap_state.episodes[3] = ep;
+	switch (ap_game)
+	{
+		case ap_game_t::doom: return 2026;
+		case ap_game_t::doom2: return 2026;
+		case ap_game_t::heretic: return 35;
+	}
 }
 
 
-void f_episode5(int ep)
+static const std::map<int, int> doom_weapons_map = {{2001, 2}, {2002, 3}, {2003, 4}, {2004, 5}, {2006, 6}, {2005, 7}};
+static const std::map<int, int> doom2_weapons_map = {{2001, 2}, {2002, 3}, {2003, 4}, {2004, 5}, {2006, 6}, {2005, 7}, {82, 8}};
+static const std::map<int, int> heretic_weapons_map = {{2005, 7}, {2001, 2}, {53, 3}, {2003, 5}, {2002, 6}, {2004, 4}};
+
+
+const std::map<int, int>& get_weapons_map()
 {
-	ap_state.episodes[4] = ep;
+	switch (ap_game)
+	{
+		case ap_game_t::doom: return doom_weapons_map;
+		case ap_game_t::doom2: return doom2_weapons_map;
+		case ap_game_t::heretic: return heretic_weapons_map;
+	}
 }
 
 
-void f_two_ways_keydoors(int two_ways_keydoors)
+ap_table_t<ap_type_sprite_t> get_sprites()
 {
-	ap_state.two_ways_keydoors = two_ways_keydoors;
+	switch (ap_game)
+	{
+		case ap_game_t::doom: return ap_make_table(ap_doom_type_sprites);
+		case ap_game_t::doom2: return ap_make_table(ap_doom2_type_sprites);
+		case ap_game_t::heretic: return ap_make_table(ap_heretic_type_sprites);
+	}
+	return {nullptr, 0};
 }
 
 
-const char* apdoom_get_seed()
+std::string get_exmx_name(const std::string& name)
 {
-	return ap_save_dir_name.c_str();
+	auto pos = name.find_first_of('(');
+	if (pos == std::string::npos) return name;
+	return name.substr(pos);
 }
 
 
-void apdoom_check_location(ap_level_index_t idx, int index)
+// One entry per item id, so receiving an item is an index and not map lookups
+static void build_item_descs()
 {
-	int64_t id = 0;
-	const auto& loc_table = get_location_table();
+	auto item_table = get_item_type_table();
 
-	auto it1 = loc_table.find(idx.ep + 1);
-	if (it1 == loc_table.end()) return;
+	ap_item_descs.clear();
+	if (item_table.size() == 0) return;
+	int64_t min_id = item_table[0].id;
+	int64_t max_id = item_table[0].id;
+	for (const auto& item_def : item_table)
+	{
+		min_id = std::min(min_id, item_def.id);
+		max_id = std::max(max_id, item_def.id);
+	}
+	ap_item_id_base = min_id;
+	ap_item_descs.assign((size_t)(max_id - min_id + 1), ap_item_desc_t{nullptr, -1, -1, -1, "", ""});
 
-	auto it2 = it1->second.find(idx.map + 1);
-	if (it2 == it1->second.end()) return;
+	const auto& keys_map = get_keys_map();
+	const auto& weapons_map = get_weapons_map();
+	auto sprites = get_sprites();
+	for (const auto& item_def : item_table)
+	{
+		const ap_item_t& item = item_def.item;
+		ap_item_desc_t& desc = ap_item_descs[item_def.id - min_id];
 
-	auto it3 = it2->second.find(index);
-	if (it3 == it2->second.end()) return;
+		desc.def = &item_def;
 
-	id = it3->second;
+		auto key_it = keys_map.find(item.doom_type);
+		if (key_it != keys_map.end())
+			desc.key = key_it->second;
 
-	if (index >= 0)
-	{
-		if (is_loc_checked(idx, index))
+		auto weapon_it = weapons_map.find(item.doom_type);
+		if (weapon_it != weapons_map.end())
+			desc.weapon = weapon_it->second;
+
+		ap_level_index_t idx = {item.ep - 1, item.map - 1};
+		const ap_level_info_t* level_info = ap_get_level_info(idx);
+		if (level_info)
 		{
-			printf("APDOOM: Location already checked\n");
-		}
-		else
-		{ // We get back from AP
-			//auto level_state = ap_get_level_state(ep, map);
-			//level_state->checks[level_state->check_count] = index;
-			//level_state->check_count++;
+			desc.level = idx.ep * max_map_count + idx.map;
+
+			// Level specific items show which level they belong to
+			if (desc.key != -1 || item.doom_type == get_map_doom_type() || item.doom_type == -1)
+				snprintf(desc.notif_text, sizeof(desc.notif_text), "%s", get_exmx_name(level_info->name).c_str());
 		}
+
+		const char* sprite = ap_find_type_sprite(sprites, item.doom_type);
+		if (sprite)
+			snprintf(desc.sprite, sizeof(desc.sprite), "%s", sprite);
 	}
-	AP_SendItem(id);
 }
 
 
-int apdoom_is_location_progression(ap_level_index_t idx, int index)
+static const ap_item_desc_t* get_item_desc(int64_t item_id)
 {
-	const auto& loc_table = get_location_table();
-
-	auto it1 = loc_table.find(idx.ep + 1);
-	if (it1 == loc_table.end()) return 0;
-
-	auto it2 = it1->second.find(idx.map + 1);
-	if (it2 == it1->second.end()) return 0;
+	if (item_id < ap_item_id_base || item_id - ap_item_id_base >= (int64_t)ap_item_descs.size())
+		return nullptr;
+	const auto& desc = ap_item_descs[item_id - ap_item_id_base];
+	if (!desc.def) return nullptr;
+	return &desc;
+}
 
-	auto it3 = it2->second.find(index);
-	if (it3 == it2->second.end()) return 0;
 
-	int64_t id = it3->second;
+// Runs on the game thread, the state side was already applied by f_itemrecv
+// Adds the notification icon for an item the player was just given
+static void add_item_notification(const ap_item_desc_t& desc)
+{
+	if (desc.sprite[0] == '\0' || ap_notification_icon_count >= AP_NOTIF_MAX)
+		return;
 
-	return (ap_progressive_locations.find(id) != ap_progressive_locations.end()) ? 1 : 0;
+	ap_notification_icon_t& notif = ap_notification_icons[ap_notification_icon_count++];
+	memcpy(notif.sprite, desc.sprite, sizeof(notif.sprite));
+	memcpy(notif.text, desc.notif_text, sizeof(desc.notif_text));
+	notif.t = 0;
+	notif.xf = AP_NOTIF_SIZE / 2 + AP_NOTIF_PADDING;
+	notif.yf = -200.0f + AP_NOTIF_SIZE / 2;
+	notif.state = AP_NOTIF_STATE_PENDING;
+	notif.velx = 0.0f;
+	notif.vely = 0.0f;
+	notif.x = (int)notif.xf;
+	notif.y = (int)notif.yf;
 }
 
-void apdoom_complete_level(ap_level_index_t idx)
+
+static void give_item(int64_t item_id)
 {
-	//if (ap_state.level_states[ep - 1][map - 1].completed) return; // Already completed
-    ap_get_level_state(idx)->completed = 1;
-	apdoom_check_location(idx, -1); // -1 is complete location
+	auto desc = get_item_desc(item_id);
+	if (!desc)
+		return; // Skip
+
+	record_event('g', std::to_string(item_id));
+	const ap_item_t& item = desc->def->item;
+	ap_settings.give_item_callback(item.doom_type, item.ep, item.map);
+	add_item_notification(*desc);
+}
+
+
+static void give_items(const ap_item_desc_t* const* descs, int batch_count)
+{
+	if (batch_count == 0)
+		return;
+
+	ap_item_t batch[AP_ITEMS_PER_BATCH];
+	for (int i = 0; i < batch_count; ++i)
+		batch[i] = descs[i]->def->item;
+
+	ap_settings.give_items_callback(batch, batch_count);
+	for (int i = 0; i < batch_count; ++i)
+		add_item_notification(*descs[i]);
+}
+
+
+static int64_t ap_now_ms()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+// Takes the oldest item off the queue, and counts how long it waited there
+static int64_t pop_queued_item()
+{
+	int64_t item_id = ap_item_queue.front();
+	int64_t received = ap_item_queue_times.empty() ? -1 : ap_item_queue_times.front();
+
+	ap_item_queue.pop_front();
+	if (!ap_item_queue_times.empty())
+		ap_item_queue_times.pop_front();
+
+	if (received >= 0)
+	{
+		int latency = (int)(ap_now_ms() - received);
+		ap_item_stats.latency_total_ms += latency;
+		ap_item_stats.latency_max_ms = std::max(ap_item_stats.latency_max_ms, latency);
+		ap_item_stats.latency_count++;
+	}
+	ap_item_stats.items_given++;
+	return item_id;
+}
+
+
+// Gives up to AP_ITEMS_PER_BATCH queued items through a single give_items_callback call
+static void give_item_batch()
+{
+	const ap_item_desc_t* batch[AP_ITEMS_PER_BATCH];
+	int batch_count = 0;
+	while (batch_count < AP_ITEMS_PER_BATCH && !ap_item_queue.empty() && ap_notification_icon_count + batch_count < AP_NOTIF_MAX)
+	{
+		auto item_id = pop_queued_item();
+		auto desc = get_item_desc(item_id);
+		if (!desc)
+			continue; // Skip
+		record_event('g', std::to_string(item_id));
+		batch[batch_count++] = desc;
+	}
+	give_items(batch, batch_count);
+}
+
+
+// Called from the AP library's thread
+void f_itemrecv(int64_t item_id, int player_id, bool notify_player)
+{
+	record_pending_event('r', std::to_string(item_id));
+
+	auto desc = get_item_desc(item_id);
+	if (!desc)
+		return; // Skip
+	const ap_item_t& item = desc->def->item;
+
+	// Key, map, level unlocked, level complete?
+	if (desc->level != -1)
+	{
+		auto level_state = &ap_state.level_states[desc->level];
+		if (desc->key != -1)
+			level_state->keys[desc->key] = 1;
+		if (item.doom_type == get_map_doom_type())
+			level_state->has_map = 1;
+		if (item.doom_type == -1)
+			level_state->unlocked = 1;
+		if (item.doom_type == -2)
+			level_state->completed = 1;
+	}
+
+	// Backpack?
+	if (item.doom_type == 8)
+	{
+		ap_state.player_state.backpack = 1;
+		auto max_ammos = get_max_ammos();
+		for (int i = 0; i < ap_ammo_count; ++i)
+			ap_state.player_state.max_ammo[i] = max_ammos[i] * 2;
+	}
+
+	// Weapon?
+	if (desc->weapon != -1)
+		ap_state.player_state.weapon_owned[desc->weapon] = 1;
+
+	// Ignore inventory items, the game will add them up
+
+
+	if (!notify_player) return;
+
+	// The game thread gives it in apdoom_update(), once we're in game
+	while (!ap_item_ring.push(ap_timed_id_t{item_id, ap_now_ms()}))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ap_events_pending = true;
+}
+
+
+bool find_location(int64_t loc_id, int &ep, int &map, int &index)
+{
+	auto ref = get_location_ref(loc_id);
+	if (!ref)
+	{
+		ep = -1;
+		map = -1;
+		index = -1;
+		return false;
+	}
+
+	ep = ref->ep;
+	map = ref->map;
+	index = ref->index;
+	return (ep > 0);
+}
+
+
+// Called from the AP library's thread, the game thread marks it checked
+void f_locrecv(int64_t loc_id)
+{
+	while (!ap_location_ring.push(ap_timed_id_t{loc_id, ap_now_ms()}))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ap_events_pending = true;
+}
+
+
+static void receive_location(int64_t loc_id, int64_t received_ms)
+{
+	record_event('l', std::to_string(loc_id));
+
+	if (received_ms >= 0)
+	{
+		int latency = (int)(ap_now_ms() - received_ms);
+		ap_item_stats.locations++;
+		ap_item_stats.location_latency_max_ms = std::max(ap_item_stats.location_latency_max_ms, latency);
+	}
+
+	// Find where this location is
+	int ep = -1;
+	int map = -1;
+	int index = -1;
+	if (!find_location(loc_id, ep, map, index))
+	{
+		printf("APDOOM: In receive_location, loc id not found: %i\n", (int)loc_id);
+		return; // Loc not found
+	}
+
+	ap_level_index_t idx = {ep - 1, map - 1};
+
+	set_loc_checked(idx, index);
+}
+
+
+// Called from the AP library's thread, once per scouted level
+void f_locinfo(std::vector<AP_NetworkItem> loc_infos)
+{
+	ap_scout_reply_t reply;
+	for (const auto& loc_info : loc_infos)
+	{
+		auto ref = get_location_ref(loc_info.location);
+		if (ref && reply.level < 0)
+			reply.level = (ref->ep - 1) * max_map_count + (ref->map - 1);
+		if (loc_info.flags & 1)
+			reply.progression.push_back(loc_info.location);
+	}
+
+	while (!ap_scout_ring.push(reply))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ap_events_pending = true;
+}
+
+
+// Keeps up to AP_SCOUTS_IN_FLIGHT levels being scouted. The level being
+// played jumps the queue.
+static void send_location_scouts()
+{
+	int64_t now_ms = ap_now_ms();
+
+	for (size_t i = 0; i < ap_scouts_in_flight.size();)
+	{
+		if (now_ms - ap_scouts_in_flight[i].second > AP_SCOUT_TIMEOUT_MS)
+		{
+			int level = ap_scouts_in_flight[i].first;
+			const ap_level_info_t* level_info = ap_get_level_info(ap_level_index_t{level / max_map_count, level % max_map_count});
+			printf("APDOOM: Timeout scouting %s\n  Do you have a VPN active?\n  Its checks will look non-progression.\n", level_info ? level_info->name : "?");
+			ap_scouts_in_flight.erase(ap_scouts_in_flight.begin() + i);
+		}
+		else
+			++i;
+	}
+
+	if (ap_state.ep > 0 && ap_state.map > 0 && !ap_scout_queue.empty())
+	{
+		int current_level = (ap_state.ep - 1) * max_map_count + (ap_state.map - 1);
+		auto it = std::find(ap_scout_queue.begin(), ap_scout_queue.end(), current_level);
+		if (it != ap_scout_queue.end() && it != ap_scout_queue.begin())
+		{
+			ap_scout_queue.erase(it);
+			ap_scout_queue.push_front(current_level);
+		}
+	}
+
+	while ((int)ap_scouts_in_flight.size() < AP_SCOUTS_IN_FLIGHT && !ap_scout_queue.empty())
+	{
+		int level = ap_scout_queue.front();
+		ap_scout_queue.pop_front();
+
+		ap_level_index_t idx = {level / max_map_count, level % max_map_count};
+		std::vector<int64_t> location_scouts;
+		const auto& ids = ap_location_ids[level];
+		for (int index = 0; index < (int)ids.size(); ++index)
+			if (ids[index] >= 0 && validate_doom_location(idx, index))
+				location_scouts.push_back(ids[index]);
+		if (location_scouts.empty())
+			continue;
+
+		AP_SendLocationScouts(location_scouts, 0);
+		ap_scouts_in_flight.push_back({level, now_ms});
+	}
+}
+
+
+void f_goal(int goal)
+{
+	ap_state.goal = goal;
+}
+
+
+void f_difficulty(int difficulty)
+{
+	if (ap_settings.override_skill)
+		return;
+
+	ap_state.difficulty = difficulty;
+}
+
+
+void f_random_monsters(int random_monsters)
+{
+	if (ap_settings.override_monster_rando)
+		return;
+
+	ap_state.random_monsters = random_monsters;
+}
+
+
+void f_random_items(int random_items)
+{
+	if (ap_settings.override_item_rando)
+		return;
+
+	ap_state.random_items = random_items;
+}
+
+
+void f_random_music(int random_music)
+{
+	if (ap_settings.override_music_rando)
+		return;
+
+	ap_state.random_music = random_music;
+}
+
+
+void f_flip_levels(int flip_levels)
+{
+	if (ap_settings.override_flip_levels)
+		return;
+
+	ap_state.flip_levels = flip_levels;
+}
+
+
+void f_check_sanity(int check_sanity)
+{
+	ap_state.check_sanity = check_sanity;
+}
+
+
+void f_reset_level_on_death(int reset_level_on_death)
+{
+	if (ap_settings.override_reset_level_on_death)
+		return;
+
+	ap_state.reset_level_on_death = reset_level_on_death;
+}
+
+
+void f_episode1(int ep)
+{
+	ap_state.episodes[0] = ep;
+}
+
+
+void f_episode2(int ep)
+{
+	ap_state.episodes[1] = ep;
+}
+
+
+void f_episode3(int ep)
+{
+	ap_state.episodes[2] = ep;
+}
+
+
+void f_episode4(int ep)
+{
+	ap_state.episodes[3] = ep;
+}
+
+
+void f_episode5(int ep)
+{
+	ap_state.episodes[4] = ep;
+}
+
+
+void f_two_ways_keydoors(int two_ways_keydoors)
+{
+	ap_state.two_ways_keydoors = two_ways_keydoors;
+}
+
+
+const char* apdoom_get_seed()
+{
+	return ap_save_dir_name.c_str();
+}
+
+
+void apdoom_check_location(ap_level_index_t idx, int index)
+{
+	int64_t id = 0;
+	if (!get_location_id(idx, index, id)) return;
+
+	if (index >= 0)
+	{
+		if (is_loc_checked(idx, index))
+		{
+			printf("APDOOM: Location already checked\n");
+		}
+		else
+		{ // We get back from AP
+			//auto level_state = ap_get_level_state(ep, map);
+			//level_state->checks[level_state->check_count] = index;
+			//level_state->check_count++;
+		}
+	}
+	if (!ap_replaying)
+		AP_SendItem(id);
+}
+
+
+int apdoom_is_location_progression(ap_level_index_t idx, int index)
+{
+	if (index < 0) return 0;
+	if (idx.ep < 0 || idx.ep >= ap_episode_count || idx.map < 0 || idx.map >= max_map_count) return 0;
+
+	const auto& bits = ap_progression_bits[idx.ep * max_map_count + idx.map];
+	if (index >= (int)bits.size()) return 0;
+	return bits[index] ? 1 : 0;
+}
+
+void apdoom_complete_level(ap_level_index_t idx)
+{
+	//if (ap_state.level_states[ep - 1][map - 1].completed) return; // Already completed
+    ap_get_level_state(idx)->completed = 1;
+	apdoom_check_location(idx, -1); // -1 is complete location
+	sync_levels(true);
 }
 
 
@@ -1448,10 +2620,10 @@ ap_level_index_t ap_make_level_index(int ep /* 1-based */, int map /* 1-based */
 
 	// In Doom2, every map is ep = 1
 	ap_level_index_t ret = { 0, map - 1 };
-	const auto& table = get_level_info_table();
-	while (ret.map >= (int)table[ret.ep].size())
+	auto table = get_level_info_table();
+	while (ret.map >= table[ret.ep].map_count)
 	{
-		ret.map -= (int)table[ret.ep].size();
+		ret.map -= table[ret.ep].map_count;
 		ret.ep++;
 	}
 
@@ -1470,10 +2642,10 @@ int ap_index_to_map(ap_level_index_t idx)
 {
 	if (ap_game != ap_game_t::doom2) return idx.map + 1;
 
-	const auto& table = get_level_info_table();
+	auto table = get_level_info_table();
 	for (int ep = 0; ep < idx.ep; ++ep)
 	{
-		idx.map += (int)table[ep].size();
+		idx.map += table[ep].map_count;
 	}
 	return idx.map + 1;
 }
@@ -1508,7 +2680,8 @@ void apdoom_check_victory()
 
 	ap_state.victory = 1;
 
-	AP_StoryComplete();
+	if (!ap_replaying)
+		AP_StoryComplete();
 	ap_settings.victory_callback();
 }
 
@@ -1518,159 +2691,814 @@ void apdoom_send_message(const char* msg)
 	std::string smsg = msg;
 	if (strnicmp(msg, "!hint ", 6) == 0)
 	{
-		// Make the hint easier.
-		// Find an E#M# in the text
-		for (size_t i = 6; i < smsg.size() - 4; ++i)
+		// Make the hint easier. Split the rest of the line into words, one
+		// of them naming the level (E#M# or MAP##) and one the thing wanted.
+		const ap_hint_targets_t* targets = nullptr;
+		int kinds = 0;
+		std::string word;
+		for (const char* c = msg + 6; ; ++c)
 		{
-			ap_level_info_t* level_info = nullptr;
-
-			if (toupper(smsg[i]) == 'E' &&
-				toupper(smsg[i + 2]) == 'M' &&
-				(smsg[i + 1] - '0') >= 1 && (smsg[i + 1] - '0') <= 9 &&
-				(smsg[i + 3] - '0') >= 1 && (smsg[i + 3] - '0') <= 9)
+			if (isalnum((unsigned char)*c))
 			{
-				// Find the level name
-				int ep = smsg[i + 1] - '1';
-				int map = smsg[i + 3] - '1';
-				level_info = ap_get_level_info(ap_level_index_t{ep, map});
+				word += (char)toupper((unsigned char)*c);
+				continue;
 			}
 
-			if (toupper(smsg[i]) == 'M' &&
-				toupper(smsg[i + 1]) == 'A' &&
-				toupper(smsg[i + 2]) == 'P' &&
-				(smsg[i + 3] - '0') >= 0 && (smsg[i + 3] - '0') <= 3 &&
-				(smsg[i + 4] - '0') >= 0 && (smsg[i + 4] - '0') <= 9)
+			if (!word.empty())
 			{
-				// Find the level name
-				int ep = 1;
-				int map = smsg[i + 4] + (smsg[i + 3] - '0') * 10;
-				level_info = ap_get_level_info(ap_make_level_index(ep, map));
+				if (word == "MAP") kinds |= 1 << AP_HINT_MAP;
+				else if (word == "BLUE") kinds |= 1 << AP_HINT_BLUE;
+				else if (word == "YELLOW") kinds |= 1 << AP_HINT_YELLOW;
+				else if (word == "RED") kinds |= 1 << AP_HINT_RED;
+				else if (word == "GREEN") kinds |= 1 << AP_HINT_GREEN;
+				else if (!targets)
+				{
+					auto it = ap_hint_targets.find(word);
+					if (it != ap_hint_targets.end())
+						targets = &it->second;
+				}
+				word.clear();
 			}
 
-			if (level_info)
-			{
-				std::string level_name = level_info->name;
+			if (*c == '\0')
+				break;
+		}
 
-				// Check what it's looking for. Computer area map? map scroll?
-				if (smsg.find("map") != std::string::npos || smsg.find("MAP") != std::string::npos)
+		// First match wins, in this order. Leave the message alone if the
+		// game has no such thing.
+		if (targets)
+		{
+			for (int kind = 0; kind < AP_HINT_COUNT; ++kind)
+			{
+				if (kinds & (1 << kind))
 				{
-					switch (ap_game)
-					{
-						case ap_game_t::doom:
-						case ap_game_t::doom2:
-							smsg = "!hint " + level_name + " - Computer area map";
-							break;
-						case ap_game_t::heretic:
-							smsg = "!hint " + level_name + " - Map scroll";
-							break;
-					}
+					if (!targets->hints[kind].empty())
+						smsg = targets->hints[kind];
+					break;
 				}
-				else if (smsg.find("blue") != std::string::npos || smsg.find("BLUE") != std::string::npos)
+			}
+		}
+	}
+
+	if (ap_replaying)
+		return;
+
+	ap_say_packet[0]["cmd"] = "Say";
+	ap_say_packet[0]["text"] = smsg;
+	APSend(ap_say_writer.write(ap_say_packet));
+}
+
+
+void ap_rng_seed(ap_rng_t* rng, unsigned long long seed)
+{
+	// Expand the seed with splitmix64, xoshiro must not start all zero
+	for (int i = 0; i < 4; i += 2)
+	{
+		uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		z ^= z >> 31;
+		rng->s[i] = (uint32_t)z;
+		rng->s[i + 1] = (uint32_t)(z >> 32);
+	}
+}
+
+
+static inline uint32_t rng_rotl(uint32_t x, int k)
+{
+	return (x << k) | (x >> (32 - k));
+}
+
+
+unsigned int ap_rng_next(ap_rng_t* rng)
+{
+	uint32_t* s = rng->s;
+	uint32_t result = rng_rotl(s[1] * 5, 7) * 9;
+	uint32_t t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rng_rotl(s[3], 11);
+
+	return result;
+}
+
+
+int ap_rng_range(ap_rng_t* rng, int n)
+{
+	if (n <= 0) return 0;
+	return (int)(((uint64_t)ap_rng_next(rng) * (uint32_t)n) >> 32);
+}
+
+
+void apdoom_on_death()
+{
+	if (!ap_replaying)
+		AP_DeathLinkSend();
+}
+
+
+void apdoom_clear_death()
+{
+	if (ap_replaying)
+	{
+		ap_replay_death = false;
+		return;
+	}
+	ap_deathlink_clear = true;
+}
+
+
+int apdoom_should_die()
+{
+	if (ap_replaying)
+		return ap_replay_death ? 1 : 0;
+
+	int64_t received_ms = ap_deathlink_received_ms.load();
+	bool pending = received_ms != 0 && !ap_deathlink_clear;
+	if (pending && !ap_recorded_death)
+	{
+		record_event('d', "");
+		ap_item_stats.deathlinks++;
+		ap_item_stats.deathlink_latency_max_ms = std::max(ap_item_stats.deathlink_latency_max_ms, (int)(ap_now_ms() - received_ms));
+	}
+	ap_recorded_death = pending;
+	return pending ? 1 : 0;
+}
+
+
+const ap_notification_icon_t* ap_get_notification_icons(int* count)
+{
+	*count = ap_notification_icon_count;
+	return ap_notification_icons;
+}
+
+
+const char* ap_get_type_sprite(int index)
+{
+	auto sprites = get_sprites();
+	if (index < 0 || index >= (int)sprites.size()) return nullptr;
+	return sprites[index].sprite;
+}
+
+
+int ap_get_highest_episode()
+{
+	int highest = 0;
+	for (int i = 0; i < ap_episode_count; ++i)
+		if (ap_state.episodes[i])
+			highest = i;
+	return highest;
+}
+
+
+int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index)
+{
+	const ap_level_info_t* level_info = ap_get_level_info(idx);
+    if (index >= level_info->thing_count) return -1;
+	if (level_info->thing_infos[index].doom_type != doom_type) return -1;
+	if (level_info->thing_infos[index].unreachable) return 0;
+    return level_info->thing_infos[index].check_sanity == 0 || ap_state.check_sanity == 1;
+}
+
+
+static void net_thread_main()
+{
+	while (ap_net_thread_running)
+	{
+		while (AP_IsMessagePending())
+		{
+			AP_Message* msg = AP_GetLatestMessage();
+
+			ap_net_message_t net_msg;
+			std::string& colored_msg = net_msg.text;
+
+			switch (msg->type)
+			{
+				case AP_MessageType::ItemSend:
 				{
-					switch (ap_game)
-					{
-						case ap_game_t::doom:
-						case ap_game_t::doom2:
-							smsg = "!hint " + level_name + " - Blue " + (level_info->use_skull[0] ? "skull key" : "keycard");
-							break;
-						case ap_game_t::heretic:
-							smsg = "!hint " + level_name + " - Blue key";
-							break;
-					}
+					AP_ItemSendMessage* o_msg = static_cast<AP_ItemSendMessage*>(msg);
+					colored_msg = "~9" + o_msg->item + "~2 was sent to ~4" + o_msg->recvPlayer;
+					net_msg.kind = ap_net_message_kind_t::item_send;
+					net_msg.player = o_msg->recvPlayer;
+					break;
 				}
-				else if (smsg.find("yellow") != std::string::npos || smsg.find("YELLOW") != std::string::npos)
+				case AP_MessageType::ItemRecv:
 				{
-					switch (ap_game)
-					{
-						case ap_game_t::doom:
-						case ap_game_t::doom2:
-							smsg = "!hint " + level_name + " - Yellow " + (level_info->use_skull[1] ? "skull key" : "keycard");
-							break;
-						case ap_game_t::heretic:
-							smsg = "!hint " + level_name + " - Yellow key";
-							break;
-					}
+					AP_ItemRecvMessage* o_msg = static_cast<AP_ItemRecvMessage*>(msg);
+					colored_msg = "~2Received ~9" + o_msg->item + "~2 from ~4" + o_msg->sendPlayer;
+					net_msg.kind = ap_net_message_kind_t::item_recv;
+					net_msg.player = o_msg->sendPlayer;
+					break;
 				}
-				else if (smsg.find("red") != std::string::npos || smsg.find("RED") != std::string::npos)
+				case AP_MessageType::Hint:
 				{
-					switch (ap_game)
-					{
-						case ap_game_t::doom:
-						case ap_game_t::doom2:
-							smsg = "!hint " + level_name + " - Red " + (level_info->use_skull[0] ? "skull key" : "keycard");
-							break;
-						case ap_game_t::heretic:
-							break;
-					}
+					AP_HintMessage* o_msg = static_cast<AP_HintMessage*>(msg);
+					colored_msg = "~9" + o_msg->item + "~2 from ~4" + o_msg->sendPlayer + "~2 to ~4" + o_msg->recvPlayer + "~2 at ~3" + o_msg->location + (o_msg->checked ? " (Checked)" : " (Unchecked)");
+					break;
 				}
-				else if (smsg.find("green") != std::string::npos || smsg.find("GREEN") != std::string::npos)
+				default:
 				{
-					switch (ap_game)
-					{
-						case ap_game_t::doom:
-						case ap_game_t::doom2:
-							break;
-						case ap_game_t::heretic:
-							smsg = "!hint " + level_name + " - Green key";
-							break;
-					}
+					colored_msg = "~2" + msg->text;
+					break;
 				}
+			}
+
+			printf("APDOOM: %s\n", msg->text.c_str());
+
+			while (!ap_message_ring.push(net_msg) && ap_net_thread_running)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			AP_ClearLatestMessage();
+			ap_events_pending = true;
+		}
+
+		// DeathLink is polled here, so the game only reads an atomic
+		if (ap_deathlink_clear)
+		{
+			AP_DeathLinkClear();
+			ap_deathlink_received_ms = 0;
+			ap_deathlink_clear = false;
+		}
+		else if (ap_deathlink_received_ms == 0 && AP_DeathLinkPending())
+		{
+			ap_deathlink_received_ms = ap_now_ms();
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+}
+
+
+static void start_net_thread()
+{
+	ap_net_thread_running = true;
+	ap_net_thread = std::thread(net_thread_main);
+}
+
+
+static void stop_net_thread()
+{
+	if (!ap_net_thread.joinable()) return;
+	ap_net_thread_running = false;
+	ap_net_thread.join();
+}
+
+
+//
+// Server sync
+//
+// apstate.json only lives in the seed's directory, so the level states are
+// also kept in the server's DataStorage, under a key of their own for the
+// seed and slot. At connect one Get fetches it and it's merged into what
+// was loaded, the same way a save is: flags and checks only ever get set.
+// After that, a Set with an "update" operation carries only the levels
+// that changed since the last one, at most every AP_SYNC_INTERVAL_MS and
+// at every level exit. Nothing is sent before the Get came back, or the
+// server's copy could lose progress made on another PC.
+//
+
+static std::string sync_key()
+{
+	return ap_save_dir_name + "_levels";
+}
+
+
+static std::string sync_level_name(int level)
+{
+	return std::to_string(level / max_map_count + 1) + "_" + std::to_string(level % max_map_count + 1);
+}
+
+
+static Json::Value serialize_sync_level(int level)
+{
+	const ap_level_state_t& level_state = ap_state.level_states[level];
+
+	Json::Value json_level;
+	json_level["c"] = level_state.completed;
+	json_level["k"].append(level_state.keys[0]);
+	json_level["k"].append(level_state.keys[1]);
+	json_level["k"].append(level_state.keys[2]);
+	json_level["m"] = level_state.has_map;
+	json_level["u"] = level_state.unlocked;
+	json_level["f"] = level_state.flipped;
+
+	Json::Value json_checks(Json::arrayValue);
+	const auto& check_bits = ap_check_bits[level];
+	for (int k = 0; k < (int)check_bits.size(); ++k)
+		if (check_bits[k])
+			json_checks.append(k);
+	json_level["x"] = json_checks;
+
+	return json_level;
+}
+
+
+static void sync_request()
+{
+	ap_sync_ready = false;
+	ap_sync_sent.assign(ap_episode_count * max_map_count, std::string());
+	ap_sync_reply.clear();
+
+	ap_sync_request.status = AP_RequestStatus::Pending;
+	ap_sync_request.key = sync_key();
+	ap_sync_request.value = &ap_sync_reply;
+	ap_sync_request.type = AP_DataType::Raw;
+	AP_GetServerData(&ap_sync_request);
+}
+
+
+static void sync_poll()
+{
+	if (ap_sync_ready || ap_sync_request.status == AP_RequestStatus::Pending)
+		return;
+
+	Json::Value json;
+	Json::CharReaderBuilder builder;
+	std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+	std::string errors;
+	if (ap_sync_request.status == AP_RequestStatus::Done &&
+		reader->parse(ap_sync_reply.data(), ap_sync_reply.data() + ap_sync_reply.size(), &json, &errors) &&
+		json.isObject())
+	{
+		Json::FastWriter writer;
+		int merged = 0;
+		for (int ep = 0; ep < ap_episode_count; ++ep)
+		{
+			int map_count = ap_get_map_count(ep + 1);
+			for (int map = 0; map < map_count; ++map)
+			{
+				int level = ep * max_map_count + map;
+				const Json::Value& json_level = json[sync_level_name(level)];
+				if (!json_level.isObject())
+					continue;
+
+				auto level_state = &ap_state.level_states[level];
+				json_get_bool_or(json_level["c"], level_state->completed);
+				for (int k = 0; k < 3; ++k)
+					json_get_bool_or(json_level["k"][k], level_state->keys[k]);
+				json_get_bool_or(json_level["m"], level_state->has_map);
+				json_get_bool_or(json_level["u"], level_state->unlocked);
+				json_get_bool_or(json_level["f"], level_state->flipped);
+				for (const auto& json_check : json_level["x"])
+					if (json_check.isInt())
+						set_loc_checked({ep, map}, json_check.asInt());
+
+				ap_sync_sent[level] = writer.write(json_level);
+				++merged;
+			}
+		}
+		printf("APDOOM: Merged %i level states from the server\n", merged);
+	}
+
+	// Without a reply the server's copy is taken to be empty
+	ap_sync_ready = true;
+	ap_sync_last_ms = ap_now_ms();
+}
+
+
+static void sync_levels(bool force)
+{
+	if (!ap_sync_ready || ap_replaying)
+		return;
+
+	int64_t now_ms = ap_now_ms();
+	if (!force && now_ms - ap_sync_last_ms < AP_SYNC_INTERVAL_MS)
+		return;
+	ap_sync_last_ms = now_ms;
+
+	Json::FastWriter writer;
+	Json::Value delta(Json::objectValue);
+	for (int ep = 0; ep < ap_episode_count; ++ep)
+	{
+		int map_count = ap_get_map_count(ep + 1);
+		for (int map = 0; map < map_count; ++map)
+		{
+			int level = ep * max_map_count + map;
+			Json::Value json_level = serialize_sync_level(level);
+			std::string text = writer.write(json_level);
+			if (text == ap_sync_sent[level])
+				continue;
+
+			ap_sync_sent[level] = text;
+			delta[sync_level_name(level)] = json_level;
+		}
+	}
+	if (delta.empty())
+		return;
+
+	Json::Value packet;
+	packet[0]["cmd"] = "Set";
+	packet[0]["key"] = sync_key();
+	packet[0]["default"] = Json::Value(Json::objectValue);
+	packet[0]["want_reply"] = false;
+	packet[0]["operations"][0]["operation"] = "update";
+	packet[0]["operations"][0]["value"] = delta;
+	APSend(writer.write(packet));
+}
+
+
+//
+// Flood
+//
+// Benchmarks the client's receiving side without a busy multiworld. On
+// top of a replay, a thread takes the AP library's place and pushes
+// flood_items items through f_itemrecv(), flood_locations locations
+// through f_locrecv() and flood_messages chat lines into the message
+// ring, as fast as the rings take them. The game side drains them the
+// same way it does when connected, and apdoom_take_item_stats() reports
+// the latencies, queue depths and apdoom_update() times. The rings only
+// have one producer, so there is no flood while connected.
+//
+
+static int64_t ap_now_us()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+static void flood_thread_main()
+{
+	// Items that complete a level are left out so the flood can't end the game
+	std::vector<int64_t> item_ids;
+	for (const auto& item_def : get_item_type_table())
+		if (item_def.item.doom_type != -2)
+			item_ids.push_back(item_def.id);
+	auto loc_table = get_location_table();
+
+	int item_total = item_ids.empty() ? 0 : ap_settings.flood_items;
+	int location_total = loc_table.size() == 0 ? 0 : ap_settings.flood_locations;
+	int message_total = ap_settings.flood_messages;
+	int items = 0, locations = 0, messages = 0;
+	long long recv_total_us = 0;
+	int recv_max_us = 0;
+	int64_t start_us = ap_now_us();
+
+	while (ap_flood_running && (items < item_total || locations < location_total || messages < message_total))
+	{
+		if (items < item_total)
+		{
+			int64_t call_us = ap_now_us();
+			f_itemrecv(item_ids[items % item_ids.size()], 0, true);
+			int us = (int)(ap_now_us() - call_us);
+			recv_total_us += us;
+			recv_max_us = std::max(recv_max_us, us);
+			++items;
+		}
+
+		if (locations < location_total)
+		{
+			f_locrecv(loc_table[locations % loc_table.size()].loc_id);
+			++locations;
+		}
+
+		if (messages < message_total)
+		{
+			ap_net_message_t net_msg;
+			net_msg.text = "Flood message " + std::to_string(messages + 1);
+			while (!ap_message_ring.push(net_msg) && ap_flood_running)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			ap_events_pending = true;
+			++messages;
+		}
+	}
+
+	printf("APDOOM: Flood sent %i items, %i locations and %i messages in %.1f ms, f_itemrecv avg %.1f us, worst %i us\n",
+		items, locations, messages, (ap_now_us() - start_us) / 1000.0,
+		items > 0 ? (double)recv_total_us / items : 0.0, recv_max_us);
+}
+
+
+static void start_flood_thread()
+{
+	if (!ap_replaying)
+	{
+		printf("APDOOM: Flood needs a replay, the AP library's thread owns the rings while connected\n");
+		return;
+	}
+
+	ap_flood_running = true;
+	ap_flood_thread = std::thread(flood_thread_main);
+}
+
+
+static void stop_flood_thread()
+{
+	if (!ap_flood_thread.joinable()) return;
+	ap_flood_running = false;
+	ap_flood_thread.join();
+}
 
+
+// Received items wait in ap_item_queue (saved with the state) until we're in game
+static void drain_event_rings()
+{
+	ap_timed_id_t timed;
+	while (ap_item_ring.pop(timed))
+	{
+		ap_item_queue.push_back(timed.id);
+		ap_item_queue_times.push_back(timed.received_ms);
+	}
+	while (ap_location_ring.pop(timed))
+		receive_location(timed.id, timed.received_ms);
+
+	ap_scout_reply_t reply;
+	bool scouted = false;
+	while (ap_scout_ring.pop(reply))
+	{
+		for (auto loc_id : reply.progression)
+			set_location_progression(loc_id);
+		for (size_t i = 0; i < ap_scouts_in_flight.size(); ++i)
+		{
+			if (ap_scouts_in_flight[i].first == reply.level)
+			{
+				ap_scouts_in_flight.erase(ap_scouts_in_flight.begin() + i);
 				break;
 			}
 		}
+		scouted = true;
 	}
+	if (scouted && ap_initialized)
+		send_location_scouts(); // Next ones go out as soon as a reply is in
+	ap_item_stats.queue_depth_max = std::max(ap_item_stats.queue_depth_max, (int)ap_item_queue.size());
+}
 
-	Json::Value say_packet;
-	say_packet[0]["cmd"] = "Say";
-	say_packet[0]["text"] = smsg;
-	Json::FastWriter writer;
-	APSend(writer.write(say_packet));
+
+void apdoom_take_item_stats(ap_item_stats_t* stats)
+{
+	*stats = ap_item_stats;
+	stats->queue_depth = (int)ap_item_queue.size();
+	memset(&ap_item_stats, 0, sizeof(ap_item_stats));
 }
 
 
-void apdoom_on_death()
+//
+// Record / replay
+//
+// apdoom_record() starts a text log next to a demo. It opens with the
+// slot settings and a state snapshot, then has one "<tic> <type> <arg>"
+// line per thing AP handed the game:
+//   r <item id>   state side of f_itemrecv
+//   l <loc id>    receive_location
+//   g <item id>   item given to the player
+//   m <text>      message
+//   d             deathlink seen by the game
+// The tic is ap_log_tic, which the game advances with the demo. With
+// ap_settings_t::replay_log, apdoom_init() loads that instead of
+// connecting and apdoom_update() hands the game the same things on the
+// same tics, so the demo plays back in sync without a server. Events
+// from the AP library's thread are logged at the next apdoom_update().
+//
+
+#define AP_LOG_MAGIC "APLOG 1"
+
+static void record_event(char type, const std::string& arg)
 {
-	AP_DeathLinkSend();
+	if (!ap_record_file)
+		return;
+
+	std::string line = arg;
+	for (auto& c : line)
+		if (c == '\n' || c == '\r')
+			c = ' ';
+	fprintf(ap_record_file, "%i %c %s\n", ap_log_tic, type, line.c_str());
 }
 
 
-void apdoom_clear_death()
+static void record_pending_event(char type, const std::string& arg)
 {
-	AP_DeathLinkClear();
+	std::lock_guard<std::mutex> lock(ap_record_mutex);
+	if (!ap_record_file)
+		return;
+
+	ap_record_pending.push_back(std::string(1, type) + " " + arg);
 }
 
 
-int apdoom_should_die()
+void apdoom_record(const char* filename)
 {
-	return AP_DeathLinkPending() ? 1 : 0;
+	if (ap_replaying || !ap_initialized)
+		return;
+
+	FILE* f = AP_fopen(filename, "w");
+	if (!f)
+	{
+		printf("APDOOM: Failed to open AP log %s\n", filename);
+		return;
+	}
+
+	fprintf(f, "%s\n", AP_LOG_MAGIC);
+	fprintf(f, "dir %s\n", ap_save_dir_name.c_str());
+	fprintf(f, "slot %i %i %i %i %i %i %i %i %i\n",
+		ap_state.goal, ap_state.difficulty, ap_state.random_monsters,
+		ap_state.random_items, ap_state.random_music, ap_state.flip_levels,
+		ap_state.check_sanity, ap_state.reset_level_on_death, ap_state.two_ways_keydoors);
+	fprintf(f, "episodes %i", ap_episode_count);
+	for (int i = 0; i < ap_episode_count; ++i)
+		fprintf(f, " %i", ap_state.episodes[i]);
+	fprintf(f, "\n");
+	Json::FastWriter writer;
+	fprintf(f, "state %s", writer.write(serialize_state()).c_str());
+	fflush(f);
+
+	printf("APDOOM: Recording AP log %s\n", filename);
+
+	std::lock_guard<std::mutex> lock(ap_record_mutex);
+	if (ap_record_file)
+		fclose(ap_record_file);
+	ap_record_file = f;
+	ap_record_pending.clear();
+	ap_recorded_death = false;
+	ap_log_tic = 0;
 }
 
 
-const ap_notification_icon_t* ap_get_notification_icons(int* count)
+static bool replay_header_line(const char* key, std::istringstream& out)
 {
-	*count = (int)ap_notification_icons.size();
-	return ap_notification_icons.data();
+	std::string line;
+	size_t key_len = strlen(key);
+	if (!std::getline(ap_replay_file, line) || line.compare(0, key_len, key) != 0 || line.size() <= key_len)
+	{
+		printf("APDOOM: Replay log is missing \"%s\"\n", key);
+		return false;
+	}
+	out.str(line.substr(key_len + 1));
+	out.clear();
+	return true;
 }
 
 
-int ap_get_highest_episode()
+static void replay_load_state(const Json::Value& json)
 {
-	int highest = 0;
+	load_state_json(json);
+
+	// The server sends these when connecting, they're only in the snapshot
 	for (int i = 0; i < ap_episode_count; ++i)
-		if (ap_state.episodes[i])
-			highest = i;
-	return highest;
+	{
+		int map_count = ap_get_map_count(i + 1);
+		for (int j = 0; j < map_count; ++j)
+			for (const auto& json_check : json["episodes"][i][j]["checks"])
+				set_loc_checked(ap_level_index_t{i, j}, json_check.asInt());
+	}
+
+	// Items are given as logged
+	ap_item_queue.clear();
+	ap_item_queue_times.clear();
 }
 
 
-int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index)
+static bool replay_open(const char* filename)
 {
-	ap_level_info_t* level_info = ap_get_level_info(idx);
-    if (index >= level_info->thing_count) return -1;
-	if (level_info->thing_infos[index].doom_type != doom_type) return -1;
-	if (level_info->thing_infos[index].unreachable) return 0;
-    return level_info->thing_infos[index].check_sanity == 0 || ap_state.check_sanity == 1;
+	ap_replay_file.open(filename);
+	if (!ap_replay_file.is_open())
+	{
+		printf("APDOOM: Failed to open replay log %s\n", filename);
+		return false;
+	}
+
+	std::string line;
+	if (!std::getline(ap_replay_file, line) || line != AP_LOG_MAGIC)
+	{
+		printf("APDOOM: %s is not an AP log\n", filename);
+		return false;
+	}
+
+	std::istringstream in;
+	if (!replay_header_line("dir", in))
+		return false;
+	std::getline(in, ap_save_dir_name);
+
+	if (!replay_header_line("slot", in))
+		return false;
+	in >> ap_state.goal >> ap_state.difficulty >> ap_state.random_monsters
+	   >> ap_state.random_items >> ap_state.random_music >> ap_state.flip_levels
+	   >> ap_state.check_sanity >> ap_state.reset_level_on_death >> ap_state.two_ways_keydoors;
+
+	if (!replay_header_line("episodes", in))
+		return false;
+	int episode_count = 0;
+	in >> episode_count;
+	for (int i = 0; i < episode_count && i < ap_episode_count; ++i)
+		in >> ap_state.episodes[i];
+
+	if (!replay_header_line("state", in))
+		return false;
+	Json::Value json;
+	in >> json;
+	replay_load_state(json);
+
+	printf("APDOOM: Replaying %s, save directory %s\n", filename, ap_save_dir_name.c_str());
+	ap_replaying = true;
+	return true;
+}
+
+
+// Reads the next event into ap_replay_next_*, unless one is already
+// waiting there. False at the end of the log.
+static bool replay_next_event()
+{
+	std::string line;
+	while (!ap_replay_has_next && std::getline(ap_replay_file, line))
+	{
+		std::istringstream in(line);
+		if (!(in >> ap_replay_next_tic >> ap_replay_next_type))
+			continue;
+		in.get(); // Separator
+		std::getline(in, ap_replay_next_arg);
+		ap_replay_has_next = true;
+	}
+	return ap_replay_has_next;
+}
+
+
+static void replay_tic()
+{
+	std::vector<int64_t> given;
+
+	while (replay_next_event())
+	{
+		if (ap_replay_next_tic > ap_log_tic)
+			break;
+		ap_replay_has_next = false;
+
+		switch (ap_replay_next_type)
+		{
+			case 'r':
+				f_itemrecv(strtoll(ap_replay_next_arg.c_str(), nullptr, 10), 0, false);
+				break;
+			case 'l':
+				receive_location(strtoll(ap_replay_next_arg.c_str(), nullptr, 10), -1);
+				break;
+			case 'g':
+				given.push_back(strtoll(ap_replay_next_arg.c_str(), nullptr, 10));
+				break;
+			case 'm':
+				ap_settings.message_callback(ap_replay_next_arg.c_str());
+				break;
+			case 'd':
+				ap_replay_death = true;
+				break;
+		}
+	}
+
+	if (ap_settings.give_items_callback)
+	{
+		const ap_item_desc_t* batch[AP_ITEMS_PER_BATCH];
+		int batch_count = 0;
+		for (auto item_id : given)
+		{
+			auto desc = get_item_desc(item_id);
+			if (!desc)
+				continue;
+			batch[batch_count++] = desc;
+			if (batch_count == AP_ITEMS_PER_BATCH)
+			{
+				give_items(batch, batch_count);
+				batch_count = 0;
+			}
+		}
+		give_items(batch, batch_count);
+	}
+	else
+	{
+		for (auto item_id : given)
+			give_item(item_id);
+	}
+}
+
+
+char* apdoom_save_keyframe()
+{
+	Json::FastWriter writer;
+	return strdup(writer.write(serialize_state()).c_str());
+}
+
+
+void apdoom_load_keyframe(const char* state, int log_tic)
+{
+	if (!ap_replaying)
+		return;
+
+	Json::Value json;
+	Json::CharReaderBuilder builder;
+	std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+	std::string errors;
+	if (!reader->parse(state, state + strlen(state), &json, &errors))
+	{
+		printf("APDOOM: Bad keyframe state: %s\n", errors.c_str());
+		return;
+	}
+	replay_load_state(json);
+
+	// The keyframe was taken in G_Ticker, after apdoom_update() handed
+	// over that tic's events, so those are in the state already.
+	while (replay_next_event() && ap_replay_next_tic <= log_tic)
+		ap_replay_has_next = false;
+	ap_replay_death = false;
+	ap_log_tic = log_tic;
 }
 
 
@@ -1697,99 +3525,187 @@ int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index)
     (byte *) &cr_red2blue, // 7 (BLUE) items
     (byte *) &cr_red2green // 8 (DARK EDGE GREEN)
 */
-void apdoom_update()
+// Hands the game what came in from AP since last tic
+static void deliver_message(const std::string& colored_msg)
+{
+	if (ap_initialized)
+	{
+		record_event('m', colored_msg);
+		ap_settings.message_callback(colored_msg.c_str());
+	}
+	else
+		ap_cached_messages.push_back(colored_msg);
+}
+
+
+static void log_message(const std::string& colored_msg)
+{
+	if (ap_message_log.size() >= AP_MESSAGE_LOG_MAX)
+		ap_message_log.pop_front();
+	ap_message_log.push_back(colored_msg);
+}
+
+
+// The first few item lines of a burst go through as they are, the rest
+// are only counted. Returns true if the line was counted.
+static bool hide_burst_message(const ap_net_message_t& net_msg, int64_t now_ms)
+{
+	auto& burst = ap_message_burst;
+
+	if (burst.shown && now_ms - burst.last_ms > AP_BURST_GAP_MS)
+		end_message_burst();
+	burst.last_ms = now_ms;
+
+	if (burst.shown < AP_BURST_SHOWN)
+	{
+		++burst.shown;
+		return false;
+	}
+
+	if (net_msg.kind == ap_net_message_kind_t::item_recv)
+	{
+		++burst.hidden_recv;
+		burst.recv_from.insert(net_msg.player);
+	}
+	else
+	{
+		++burst.hidden_send;
+		burst.send_to.insert(net_msg.player);
+	}
+	return true;
+}
+
+
+static std::string burst_summary(const char* verb, int count, const char* preposition, size_t player_count)
+{
+	return std::string("~2") + verb + " ~9" + std::to_string(count) + (count == 1 ? " more item" : " more items") +
+		"~2 " + preposition + " ~4" + std::to_string(player_count) + (player_count == 1 ? " player" : " players");
+}
+
+
+static void end_message_burst()
+{
+	auto& burst = ap_message_burst;
+
+	if (burst.hidden_recv)
+		deliver_message(burst_summary("Received", burst.hidden_recv, "from", burst.recv_from.size()));
+	if (burst.hidden_send)
+		deliver_message(burst_summary("Sent", burst.hidden_send, "to", burst.send_to.size()));
+	burst = ap_message_burst_t();
+}
+
+
+static void receive_tic()
 {
+	if (ap_record_file)
+	{
+		std::lock_guard<std::mutex> lock(ap_record_mutex);
+		for (const auto& line : ap_record_pending)
+			fprintf(ap_record_file, "%i %s\n", ap_log_tic, line.c_str());
+		ap_record_pending.clear();
+	}
+
 	if (ap_initialized)
 	{
 		if (!ap_cached_messages.empty())
 		{
 			for (const auto& cached_msg : ap_cached_messages)
+			{
+				record_event('m', cached_msg);
 				ap_settings.message_callback(cached_msg.c_str());
+			}
 			ap_cached_messages.clear();
 		}
 	}
 
-	while (AP_IsMessagePending())
+	int64_t now_ms = ap_now_ms();
+	if (ap_events_pending.exchange(false))
 	{
-		AP_Message* msg = AP_GetLatestMessage();
-
-		std::string colored_msg;
-
-		switch (msg->type)
+		// Messages were formatted on the network thread. Lines a burst sums
+		// up don't count against the per tic limit.
+		ap_net_message_t net_msg;
+		int i = 0;
+		while ((!ap_initialized || i < AP_MESSAGES_PER_TIC) && ap_message_ring.pop(net_msg))
 		{
-			case AP_MessageType::ItemSend:
-			{
-				AP_ItemSendMessage* o_msg = static_cast<AP_ItemSendMessage*>(msg);
-				colored_msg = "~9" + o_msg->item + "~2 was sent to ~4" + o_msg->recvPlayer;
-				break;
-			}
-			case AP_MessageType::ItemRecv:
-			{
-				AP_ItemRecvMessage* o_msg = static_cast<AP_ItemRecvMessage*>(msg);
-				colored_msg = "~2Received ~9" + o_msg->item + "~2 from ~4" + o_msg->sendPlayer;
-				break;
-			}
-			case AP_MessageType::Hint:
-			{
-				AP_HintMessage* o_msg = static_cast<AP_HintMessage*>(msg);
-				colored_msg = "~9" + o_msg->item + "~2 from ~4" + o_msg->sendPlayer + "~2 to ~4" + o_msg->recvPlayer + "~2 at ~3" + o_msg->location + (o_msg->checked ? " (Checked)" : " (Unchecked)");
-				break;
-			}
-			default:
+			log_message(net_msg.text);
+			if (net_msg.kind == ap_net_message_kind_t::other || !hide_burst_message(net_msg, now_ms))
 			{
-				colored_msg = "~2" + msg->text;
-				break;
+				deliver_message(net_msg.text);
+				++i;
 			}
 		}
+		if (i == AP_MESSAGES_PER_TIC)
+			ap_events_pending = true; // There may be more for the next tic
 
-		printf("APDOOM: %s\n", msg->text.c_str());
-
-		if (ap_initialized)
-			ap_settings.message_callback(colored_msg.c_str());
-		else
-			ap_cached_messages.push_back(colored_msg);
-
-		AP_ClearLatestMessage();
+		drain_event_rings();
+	}
+	if (ap_initialized && (!ap_scouts_in_flight.empty() || !ap_scout_queue.empty()))
+		send_location_scouts(); // For timeouts, and the level being played jumping the queue
+	if (ap_initialized && ap_was_connected)
+	{
+		sync_poll();
+		sync_levels(false);
 	}
+	if (ap_message_burst.shown && now_ms - ap_message_burst.last_ms > AP_BURST_GAP_MS)
+		end_message_burst();
 
 	// Check if we're in game, then dequeue the items
 	if (ap_is_in_game)
 	{
-		while (!ap_item_queue.empty())
+		if (ap_settings.give_items_callback)
 		{
-			auto item_id = ap_item_queue.front();
-			ap_item_queue.erase(ap_item_queue.begin());
-			f_itemrecv(item_id, 0, true);
+			give_item_batch();
 		}
+		else
+		{
+			for (int i = 0; i < AP_ITEMS_PER_TIC && !ap_item_queue.empty() && ap_notification_icon_count < AP_NOTIF_MAX; ++i)
+			{
+				give_item(pop_queued_item());
+			}
+		}
+	}
+}
+
+
+void apdoom_update()
+{
+	int64_t update_start_us = ap_now_us();
+
+	if (ap_replaying)
+	{
+		replay_tic();
+		if (ap_flood_thread.joinable())
+			receive_tic(); // The flood comes in through the rings
 	}
+	else
+		receive_tic();
 
-	// Update notification icons
+	// Update notification icons. Finished ones are compacted out in place,
+	// so the array handed to the renderer never moves.
 	float previous_y = 2.0f;
-	for (auto it = ap_notification_icons.begin(); it != ap_notification_icons.end();)
+	int live_count = ap_notification_icon_count;
+	int kept = 0;
+	for (int i = 0; i < ap_notification_icon_count; ++i)
 	{
-		auto& notification_icon = *it;
+		auto& notification_icon = ap_notification_icons[i];
+		bool keep = true;
 
 		if (notification_icon.state == AP_NOTIF_STATE_PENDING && previous_y > -100.0f)
 		{
 			notification_icon.state = AP_NOTIF_STATE_DROPPING;
 		}
-		if (notification_icon.state == AP_NOTIF_STATE_PENDING)
-		{
-			++it;
-			continue;
-		}
 
 		if (notification_icon.state == AP_NOTIF_STATE_DROPPING)
 		{
-			notification_icon.vely += 0.15f + (float)(ap_notification_icons.size() / 4) * 0.25f;
+			notification_icon.vely += 0.15f + (float)(live_count / 4) * 0.25f;
 			if (notification_icon.vely > 8.0f) notification_icon.vely = 8.0f;
 			notification_icon.yf += notification_icon.vely;
 			if (notification_icon.yf >= previous_y - AP_NOTIF_SIZE - AP_NOTIF_PADDING)
 			{
 				notification_icon.yf = previous_y - AP_NOTIF_SIZE - AP_NOTIF_PADDING;
-				notification_icon.vely *= -0.3f / ((float)(ap_notification_icons.size() / 4) * 0.05f + 1.0f);
+				notification_icon.vely *= -0.3f / ((float)(live_count / 4) * 0.05f + 1.0f);
 
-				notification_icon.t += ap_notification_icons.size() / 4 + 1; // Faster the more we have queued (4 can display on screen)
+				notification_icon.t += live_count / 4 + 1; // Faster the more we have queued (4 can display on screen)
 				if (notification_icon.t > 350 * 3 / 4) // ~7.5sec
 				{
 					notification_icon.state = AP_NOTIF_STATE_HIDING;
@@ -1799,19 +3715,193 @@ void apdoom_update()
 
 		if (notification_icon.state == AP_NOTIF_STATE_HIDING)
 		{
-			notification_icon.velx -= 0.14f + (float)(ap_notification_icons.size() / 4) * 0.1f;
+			notification_icon.velx -= 0.14f + (float)(live_count / 4) * 0.1f;
 			notification_icon.xf += notification_icon.velx;
 			if (notification_icon.xf < -AP_NOTIF_SIZE / 2)
 			{
-				it = ap_notification_icons.erase(it);
-				continue;
+				keep = false;
+				--live_count;
 			}
 		}
 
-		notification_icon.x = (int)notification_icon.xf;
-		notification_icon.y = (int)notification_icon.yf;
-		previous_y = notification_icon.yf;
+		if (keep && notification_icon.state != AP_NOTIF_STATE_PENDING)
+		{
+			notification_icon.x = (int)notification_icon.xf;
+			notification_icon.y = (int)notification_icon.yf;
+			previous_y = notification_icon.yf;
+		}
+
+		if (keep)
+		{
+			if (kept != i)
+				ap_notification_icons[kept] = notification_icon;
+			++kept;
+		}
+	}
+	ap_notification_icon_count = kept;
+
+	if (ap_tracker_block)
+		tracker_publish();
+
+	if (ap_record_file)
+		fflush(ap_record_file);
+
+	int update_us = (int)(ap_now_us() - update_start_us);
+	ap_item_stats.updates++;
+	ap_item_stats.update_total_us += update_us;
+	ap_item_stats.update_max_us = std::max(ap_item_stats.update_max_us, update_us);
+}
+
+
+int apdoom_get_message_log_count()
+{
+	return (int)ap_message_log.size();
+}
+
+
+const char* apdoom_get_message_log_line(int index)
+{
+	if (index < 0 || index >= (int)ap_message_log.size()) return nullptr;
+	return ap_message_log[index].c_str();
+}
+
+
+void apdoom_set_player_position(int x, int y, int angle)
+{
+	ap_tracker_x = x;
+	ap_tracker_y = y;
+	ap_tracker_angle = angle;
+}
+
+
+static void tracker_open()
+{
+	const size_t size = sizeof(ap_tracker_block_t);
+	void* view = nullptr;
+#ifdef _WIN32
+	ap_tracker_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)size, "Local\\" AP_TRACKER_NAME);
+	if (ap_tracker_mapping)
+	{
+		view = MapViewOfFile(ap_tracker_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+		if (!view)
+		{
+			CloseHandle(ap_tracker_mapping);
+			ap_tracker_mapping = nullptr;
+		}
+	}
+#else
+	int fd = shm_open("/" AP_TRACKER_NAME, O_CREAT | O_RDWR, 0644);
+	if (fd >= 0)
+	{
+		if (ftruncate(fd, (off_t)size) == 0)
+		{
+			view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (view == MAP_FAILED)
+				view = nullptr;
+		}
+		close(fd); // The mapping keeps it alive
+	}
+#endif
+	if (!view)
+	{
+		printf("APDOOM: Failed to create the tracker block \"%s\"\n", AP_TRACKER_NAME);
+		return;
+	}
+
+	memset(&ap_tracker_staging, 0, sizeof(ap_tracker_staging));
+	ap_tracker_staging.magic = AP_TRACKER_MAGIC;
+	ap_tracker_staging.version = AP_TRACKER_VERSION;
+	ap_tracker_staging.size = (uint32_t)size;
+	snprintf(ap_tracker_staging.game, sizeof(ap_tracker_staging.game), "%s", ap_settings.game);
+	ap_tracker_staging.episode_count = ap_episode_count;
+	ap_tracker_staging.map_count = max_map_count;
+	ap_tracker_staging.location_id_base = ap_location_id_base;
+	ap_tracker_staging.location_count = std::min((int)ap_location_refs.size(), AP_TRACKER_MAX_LOCATIONS);
+
+	// A previous run may have left its block behind, pick up where its
+	// sequence was so readers see the change.
+	ap_tracker_block = (ap_tracker_block_t*)view;
+	ap_tracker_staging.sequence = ap_tracker_block->sequence & ~1u;
+	ap_tracker_checks_dirty = true;
+	printf("APDOOM: Publishing the tracker block \"%s\"\n", AP_TRACKER_NAME);
+}
+
+
+static void tracker_close()
+{
+	if (!ap_tracker_block) return;
+#ifdef _WIN32
+	UnmapViewOfFile(ap_tracker_block);
+	CloseHandle(ap_tracker_mapping);
+	ap_tracker_mapping = nullptr;
+#else
+	munmap(ap_tracker_block, sizeof(ap_tracker_block_t));
+	shm_unlink("/" AP_TRACKER_NAME);
+#endif
+	ap_tracker_block = nullptr;
+}
+
+
+static void tracker_publish()
+{
+	auto& staging = ap_tracker_staging;
+
+	staging.ep = ap_state.ep;
+	staging.map = ap_state.map;
+	staging.in_game = ap_is_in_game;
+	staging.victory = ap_state.victory;
+	staging.player_x = ap_tracker_x;
+	staging.player_y = ap_tracker_y;
+	staging.player_angle = ap_tracker_angle;
+
+	// Checks only come in a few at a time, so the bits are only gathered
+	// again when one did
+	if (ap_tracker_checks_dirty.exchange(false))
+	{
+		memset(staging.checked, 0, sizeof(staging.checked));
+		for (int level = 0; level < ap_episode_count * max_map_count; ++level)
+		{
+			const auto& bits = ap_check_bits[level];
+			const auto& ids = ap_location_ids[level];
+			for (int index = 0; index < (int)bits.size() && index < (int)ids.size(); ++index)
+			{
+				int64_t bit = ids[index] - ap_location_id_base;
+				if (bits[index] && ids[index] >= 0 && bit < staging.location_count)
+					staging.checked[bit / 32] |= 1u << (bit % 32);
+			}
+		}
+	}
 
-		++it;
+	int level_count = std::min(ap_episode_count * max_map_count, AP_TRACKER_MAX_LEVELS);
+	for (int i = 0; i < level_count; ++i)
+	{
+		const auto& level_state = ap_state.level_states[i];
+		auto& level = staging.levels[i];
+		level.completed = level_state.completed ? 1 : 0;
+		level.has_map = level_state.has_map ? 1 : 0;
+		level.unlocked = level_state.unlocked ? 1 : 0;
+		level.flipped = level_state.flipped ? 1 : 0;
+		for (int k = 0; k < 3; ++k)
+			level.keys[k] = level_state.keys[k] ? 1 : 0;
+		level.check_count = level_state.check_count;
+
+		// Exits aren't in ap_check_bits, completing the level is the check
+		int64_t bit = ap_exit_location_ids[i] - ap_location_id_base;
+		if (level_state.completed && ap_exit_location_ids[i] >= 0 && bit < staging.location_count)
+			staging.checked[bit / 32] |= 1u << (bit % 32);
 	}
+
+	// Seqlock write. Single writer, so plain stores with fences are enough
+	uint32_t sequence = staging.sequence + 1;
+	ap_tracker_block->sequence = sequence;
+	std::atomic_thread_fence(std::memory_order_release);
+	staging.sequence = sequence;
+	const size_t body = offsetof(ap_tracker_block_t, game);
+	ap_tracker_block->magic = staging.magic;
+	ap_tracker_block->version = staging.version;
+	ap_tracker_block->size = staging.size;
+	memcpy((char*)ap_tracker_block + body, (const char*)&staging + body, sizeof(staging) - body);
+	std::atomic_thread_fence(std::memory_order_release);
+	staging.sequence = sequence + 1;
+	ap_tracker_block->sequence = sequence + 1;
 }
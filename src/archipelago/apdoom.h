@@ -19,6 +19,9 @@
 #define _APDOOM_
 
 
+#include <stdint.h>
+
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -36,8 +39,7 @@ extern "C"
 #define APDOOM_VERSION_FULL_TEXT "APDOOM " APDOOM_VERSION_TEXT
 
 
-#define AP_CHECK_MAX 64 // Arbitrary number
-#define AP_MAX_THING 1024 // Twice more than current max for every level
+#define AP_CHECK_MAX 64 // Only bounds ap_level_state_t::checks, see apdoom_is_location_checked
 
 
 typedef struct
@@ -49,6 +51,14 @@ typedef struct
 } ap_thing_info_t;
 
 
+typedef struct
+{
+    int doom_type;
+    int ep; // If doom_type is a keycard
+    int map; // If doom_type is a keycard
+} ap_item_t;
+
+
 typedef struct
 {
     const char* name;
@@ -56,7 +66,7 @@ typedef struct
     int use_skull[3];
     int check_count;
     int thing_count;
-    ap_thing_info_t thing_infos[AP_MAX_THING];
+    const ap_thing_info_t* thing_infos; // thing_count entries, into the game's packed thing table
     int sanity_check_count;
 
 } ap_level_info_t;
@@ -69,7 +79,7 @@ typedef struct
     int check_count;
     int has_map;
     int unlocked;
-    int checks[AP_CHECK_MAX];
+    int checks[AP_CHECK_MAX]; // First AP_CHECK_MAX checks, for old saves. check_count can be higher
     int special; // Berzerk or Wings
     int flipped;
     int music;
@@ -132,6 +142,7 @@ typedef struct
     const char* passwd;
     void (*message_callback)(const char*);
     void (*give_item_callback)(int doom_type, int ep, int map);
+    void (*give_items_callback)(const ap_item_t* items, int count); // Optional, gives a whole tic's worth of items at once
     void (*victory_callback)();
 
     int override_skill; int skill;
@@ -141,8 +152,14 @@ typedef struct
     int override_flip_levels; int flip_levels;
     int force_deathlink_off;
     int override_reset_level_on_death; int reset_level_on_death;
+    const char* replay_log; // If set, don't connect. State and everything AP hands the game come from a log written by apdoom_record()
+    int connect_timeout; // Seconds to wait for the slot before giving up, 0 for AP_DEFAULT_CONNECT_TIMEOUT
+    int tracker_export; // Publish ap_tracker_block_t in shared memory, see below
+    int flood_items, flood_locations, flood_messages; // With replay_log, synthetic traffic through the AP callbacks for benchmarking. Changes the replayed state
 } ap_settings_t;
 
+#define AP_DEFAULT_CONNECT_TIMEOUT 10
+
 
 #define AP_NOTIF_STATE_PENDING 0
 #define AP_NOTIF_STATE_DROPPING 1
@@ -173,26 +190,126 @@ typedef struct
 
 extern ap_state_t ap_state;
 extern int ap_is_in_game; // Don't give items when in menu (Or when dead on the ground).
+extern int ap_log_tic; // What the record/replay log is keyed on. The game advances it once per demo tic
 extern int ap_episode_count;
 
 
 int apdoom_init(ap_settings_t* settings);
+
+// apdoom_init in two halves. The first sets up the state and starts
+// connecting in the background, the second waits for the slot data. The
+// engine's own startup can run in between, as long as it doesn't read
+// ap_state.
+int apdoom_init_start(ap_settings_t* settings);
+int apdoom_init_finish();
+
+// How received items fared since the last call. Latency is from the AP
+// library handing the item over to it being given, so it includes time
+// spent waiting in the queue while out of a level. Items restored from a
+// save aren't timed.
+typedef struct
+{
+    int items_given;
+    int queue_depth; // Right now
+    int queue_depth_max;
+    int latency_count;
+    long long latency_total_ms;
+    int latency_max_ms;
+    int locations; // Checked locations that came back from AP, timed from the callback to being marked
+    int location_latency_max_ms;
+    int deathlinks; // Timed from the network thread seeing it to the game reading it
+    int deathlink_latency_max_ms;
+    int updates; // apdoom_update() calls, and the time spent in them
+    long long update_total_us;
+    int update_max_us;
+} ap_item_stats_t;
+
+void apdoom_take_item_stats(ap_item_stats_t* stats);
+
+// State published for local trackers when ap_settings_t::tracker_export is
+// set. The block lives in shared memory named AP_TRACKER_NAME ("Local\\"
+// prefixed on Windows, "/" prefixed elsewhere) and is rewritten once per
+// tic. Readers must not lock or write it. To read: load sequence, skip if
+// it's odd, copy the block, then load sequence again and retry if it
+// changed. Locations are AP location ids, as in data/poptracker.
+#define AP_TRACKER_NAME "apdoom_tracker"
+#define AP_TRACKER_MAGIC 0x54445041 // "APDT"
+#define AP_TRACKER_VERSION 1
+#define AP_TRACKER_MAX_LEVELS 64
+#define AP_TRACKER_MAX_LOCATIONS 2048
+
+typedef struct
+{
+    uint8_t completed;
+    uint8_t has_map;
+    uint8_t unlocked;
+    uint8_t flipped;
+    uint8_t keys[3];
+    uint8_t reserved;
+    int32_t check_count;
+} ap_tracker_level_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size; // sizeof(ap_tracker_block_t)
+    volatile uint32_t sequence; // Odd while the game is writing
+    char game[32]; // ap_settings_t::game
+    int32_t episode_count;
+    int32_t map_count; // levels[] is [ep * map_count + map], 0-based
+    int32_t ep; // 1-based, the level being played or the last one
+    int32_t map;
+    int32_t in_game;
+    int32_t victory;
+    int32_t player_x; // Map units
+    int32_t player_y;
+    int32_t player_angle; // Degrees, anticlockwise from east
+    int32_t reserved;
+    int64_t location_id_base;
+    int32_t location_count; // Bits used in checked[]
+    uint32_t checked[AP_TRACKER_MAX_LOCATIONS / 32]; // Bit (loc id - location_id_base)
+    ap_tracker_level_t levels[AP_TRACKER_MAX_LEVELS];
+} ap_tracker_block_t;
+
+void apdoom_set_player_position(int x, int y, int angle); // Once per tic, for the tracker block
 void apdoom_shutdown();
 void apdoom_save_state();
 void apdoom_check_location(ap_level_index_t idx, int index);
 int apdoom_is_location_progression(ap_level_index_t idx, int index);
+int apdoom_is_location_checked(ap_level_index_t idx, int index);
 void apdoom_check_victory();
 void apdoom_update();
+void apdoom_record(const char* filename); // Snapshot the state and log what AP hands the game from now on, for replay_log
+char* apdoom_save_keyframe(); // The state as a string, for a demo keyframe. Free with free()
+void apdoom_load_keyframe(const char* state, int log_tic); // While replaying, back to a keyframe taken during tic log_tic
 const char* apdoom_get_seed();
 void apdoom_send_message(const char* msg);
+
+// Every AP message line received, oldest first, including the item lines
+// that only made it to the HUD as part of a "Received N more items" summary
+int apdoom_get_message_log_count();
+const char* apdoom_get_message_log_line(int index); // NULL past the end
 void apdoom_complete_level(ap_level_index_t idx);
 ap_level_state_t* ap_get_level_state(ap_level_index_t idx); // 1-based
-ap_level_info_t* ap_get_level_info(ap_level_index_t idx); // 1-based
+const ap_level_info_t* ap_get_level_info(ap_level_index_t idx); // 1-based
 const ap_notification_icon_t* ap_get_notification_icons(int* count);
+const char* ap_get_type_sprite(int index); // NULL past the last one
 int ap_get_highest_episode();
 int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index);
 int ap_get_map_count(int ep);
 
+// Level randomization PRNG (xoshiro128**). Self-contained, so a level's
+// shuffle only depends on its seed and not on who else called rand().
+typedef struct
+{
+    unsigned int s[4];
+} ap_rng_t;
+
+void ap_rng_seed(ap_rng_t* rng, unsigned long long seed);
+unsigned int ap_rng_next(ap_rng_t* rng);
+int ap_rng_range(ap_rng_t* rng, int n); // [0, n)
+
 // Deathlink stuff
 void apdoom_on_death();
 void apdoom_clear_death();
@@ -3,571 +3,489 @@
 
 #include "apdoom.h"
 #include "apdoom_def_types.h"
-#include <map>
-#include <string>
-#include <vector>
 
 
-const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> ap_doom_location_table = {
-    {1, {
-        {1, {
-            {-1, 351331},
-            {13, 351000},
-            {68, 351001},
-            {98, 351002},
-        }},
-        {2, {
-            {-1, 351337},
-            {4, 351003},
-            {5, 351004},
-            {20, 351005},
-            {22, 351006},
-            {25, 351007},
-            {41, 351008},
-            {43, 351009},
-            {53, 351010},
-            {119, 351011},
-            {139, 351012},
-            {200, 351013},
-        }},
-        {3, {
-            {-1, 351345},
-            {8, 351014},
-            {9, 351015},
-            {18, 351016},
-            {19, 351017},
-            {64, 351018},
-            {77, 351019},
-            {85, 351020},
-            {107, 351021},
-            {109, 351022},
-            {112, 351023},
-            {259, 351024},
-            {260, 351025},
-            {261, 351026},
-            {265, 351027},
-            {323, 351028},
-        }},
-        {4, {
-            {-1, 351323},
-            {11, 351029},
-            {39, 351030},
-            {61, 351031},
-            {62, 351032},
-            {63, 351033},
-            {64, 351034},
-            {100, 351035},
-            {107, 351036},
-            {129, 351037},
-        }},
-        {5, {
-            {-1, 351340},
-            {4, 351038},
-            {10, 351039},
-            {11, 351040},
-            {60, 351041},
-            {75, 351042},
-            {83, 351043},
-            {167, 351044},
-            {169, 351045},
-            {173, 351046},
-            {174, 351047},
-            {176, 351048},
-            {206, 351049},
-            {208, 351050},
-            {279, 351051},
-            {280, 351052},
-            {282, 351053},
-        }},
-        {6, {
-            {-1, 351321},
-            {4, 351054},
-            {5, 351055},
-            {9, 351056},
-            {10, 351057},
-            {22, 351058},
-            {23, 351059},
-            {24, 351060},
-            {63, 351061},
-            {64, 351062},
-            {81, 351063},
-            {82, 351064},
-            {123, 351065},
-            {124, 351066},
-            {131, 351067},
-            {214, 351068},
-            {291, 351069},
-            {381, 351070},
-            {392, 351071},
-            {395, 351072},
-        }},
-        {7, {
-            {-1, 351324},
-            {18, 351073},
-            {20, 351074},
-            {21, 351075},
-            {25, 351076},
-            {26, 351077},
-            {27, 351078},
-            {53, 351079},
-            {87, 351080},
-            {122, 351081},
-            {309, 351082},
-            {310, 351083},
-            {311, 351084},
-            {312, 351085},
-            {314, 351086},
-            {337, 351087},
-        }},
-        {8, {
-            {-1, 351339},
-            {15, 351088},
-            {49, 351089},
-            {52, 351090},
-            {53, 351091},
-            {65, 351092},
-            {70, 351093},
-            {94, 351094},
-        }},
-        {9, {
-            {-1, 351335},
-            {13, 351095},
-            {20, 351096},
-            {87, 351097},
-            {139, 351098},
-            {172, 351099},
-            {188, 351100},
-            {222, 351101},
-            {223, 351102},
-            {225, 351103},
-        }},
-    }},
-    {2, {
-        {1, {
-            {-1, 351326},
-            {44, 351104},
-            {51, 351105},
-            {54, 351106},
-            {57, 351107},
-            {83, 351108},
-            {84, 351109},
-            {86, 351110},
-            {99, 351111},
-        }},
-        {2, {
-            {-1, 351325},
-            {8, 351112},
-            {9, 351113},
-            {20, 351114},
-            {66, 351115},
-            {80, 351116},
-            {81, 351117},
-            {100, 351118},
-            {109, 351119},
-            {125, 351120},
-            {127, 351121},
-            {138, 351122},
-            {143, 351123},
-            {144, 351124},
-            {153, 351125},
-            {160, 351126},
-            {161, 351127},
-            {165, 351128},
-            {250, 351129},
-            {291, 351130},
-        }},
-        {3, {
-            {-1, 351341},
-            {12, 351131},
-            {37, 351132},
-            {40, 351133},
-            {57, 351134},
-            {67, 351135},
-            {87, 351136},
-            {90, 351137},
-            {110, 351138},
-            {113, 351139},
-            {221, 351140},
-            {223, 351141},
-        }},
-        {4, {
-            {-1, 351327},
-            {7, 351142},
-            {8, 351143},
-            {39, 351144},
-            {40, 351145},
-            {74, 351146},
-            {86, 351147},
-            {107, 351148},
-            {109, 351149},
-            {129, 351150},
-            {130, 351151},
-            {159, 351152},
-            {174, 351153},
-            {175, 351154},
-            {186, 351155},
-            {189, 351156},
-            {244, 351157},
-        }},
-        {5, {
-            {-1, 351322},
-            {3, 351158},
-            {53, 351159},
-            {57, 351160},
-            {69, 351161},
-            {79, 351162},
-            {109, 351163},
-            {176, 351164},
-            {197, 351165},
-            {233, 351166},
-            {256, 351167},
-        }},
-        {6, {
-            {-1, 351330},
-            {10, 351168},
-            {13, 351169},
-            {26, 351170},
-            {39, 351171},
-            {48, 351172},
-            {49, 351173},
-            {57, 351174},
-            {125, 351175},
-            {142, 351176},
-            {143, 351177},
-            {173, 351178},
-            {217, 351179},
-            {220, 351180},
-            {230, 351181},
-            {232, 351182},
-            {286, 351183},
-            {320, 351184},
-        }},
-        {7, {
-            {-1, 351343},
-            {29, 351185},
-            {49, 351186},
-            {79, 351187},
-            {94, 351188},
-            {128, 351189},
-            {131, 351190},
-            {140, 351191},
-            {141, 351192},
-            {142, 351193},
-            {146, 351194},
-            {160, 351195},
-            {174, 351196},
-            {199, 351197},
-            {200, 351198},
-            {201, 351199},
-            {203, 351200},
-        }},
-        {8, {
-            {-1, 351344},
-            {16, 351201},
-            {17, 351202},
-            {18, 351203},
-            {36, 351204},
-        }},
-        {9, {
-            {-1, 351329},
-            {18, 351205},
-            {27, 351206},
-            {28, 351207},
-            {29, 351208},
-            {30, 351209},
-            {31, 351210},
-            {32, 351211},
-            {33, 351212},
-            {34, 351213},
-            {35, 351214},
-            {36, 351215},
-            {44, 351216},
-        }},
-    }},
-    {3, {
-        {1, {
-            {-1, 351332},
-            {20, 351217},
-            {46, 351218},
-        }},
-        {2, {
-            {-1, 351342},
-            {32, 351219},
-            {37, 351220},
-            {76, 351221},
-            {77, 351222},
-            {80, 351223},
-            {88, 351224},
-            {154, 351225},
-            {181, 351226},
-            {182, 351227},
-        }},
-        {3, {
-            {-1, 351338},
-            {11, 351228},
-            {14, 351229},
-            {22, 351230},
-            {23, 351231},
-            {26, 351232},
-            {49, 351233},
-            {66, 351234},
-            {73, 351235},
-            {85, 351236},
-            {88, 351237},
-            {92, 351238},
-            {113, 351239},
-            {118, 351240},
-            {183, 351241},
-        }},
-        {4, {
-            {-1, 351333},
-            {5, 351242},
-            {15, 351243},
-            {17, 351244},
-            {46, 351245},
-            {51, 351246},
-            {87, 351247},
-            {100, 351248},
-            {114, 351249},
-            {121, 351250},
-            {134, 351251},
-            {160, 351252},
-            {170, 351253},
-            {182, 351254},
-            {206, 351255},
-            {220, 351256},
-            {242, 351257},
-            {243, 351258},
-            {318, 351259},
-        }},
-        {5, {
-            {-1, 351346},
-            {54, 351260},
-            {55, 351261},
-            {86, 351262},
-            {87, 351263},
-            {89, 351264},
-            {90, 351265},
-            {126, 351266},
-            {129, 351267},
-            {133, 351268},
-            {180, 351269},
-            {187, 351270},
-            {190, 351271},
-            {218, 351272},
-            {285, 351273},
-        }},
-        {6, {
-            {-1, 351336},
-            {38, 351274},
-            {53, 351275},
-            {90, 351276},
-            {100, 351277},
-            {103, 351278},
-            {104, 351279},
-            {105, 351280},
-            {168, 351281},
-            {180, 351282},
-            {206, 351283},
-            {207, 351284},
-            {249, 351285},
-            {250, 351286},
-            {251, 351287},
-            {267, 351288},
-            {273, 351289},
-            {326, 351290},
-        }},
-        {7, {
-            {-1, 351334},
-            {22, 351291},
-            {49, 351292},
-            {51, 351293},
-            {57, 351294},
-            {60, 351295},
-            {65, 351296},
-            {67, 351297},
-            {69, 351298},
-            {83, 351299},
-            {112, 351300},
-            {128, 351301},
-        }},
-        {8, {
-            {-1, 351328},
-            {7, 351302},
-            {8, 351303},
-            {34, 351304},
-        }},
-        {9, {
-            {-1, 351347},
-            {20, 351305},
-            {46, 351306},
-            {99, 351307},
-            {101, 351308},
-            {108, 351309},
-            {114, 351310},
-            {120, 351311},
-            {121, 351312},
-            {122, 351313},
-            {135, 351314},
-            {138, 351315},
-            {139, 351316},
-            {140, 351317},
-            {141, 351318},
-            {143, 351319},
-            {188, 351320},
-        }},
-    }},
-    {4, {
-        {1, {
-            {-1, 351354},
-            {6, 351348},
-            {23, 351349},
-            {33, 351350},
-            {47, 351351},
-            {90, 351352},
-            {97, 351353},
-        }},
-        {2, {
-            {-1, 351367},
-            {5, 351355},
-            {10, 351356},
-            {14, 351357},
-            {17, 351358},
-            {20, 351359},
-            {29, 351360},
-            {46, 351361},
-            {93, 351362},
-            {126, 351363},
-            {151, 351364},
-            {167, 351365},
-            {217, 351366},
-        }},
-        {3, {
-            {-1, 351384},
-            {9, 351368},
-            {21, 351369},
-            {22, 351370},
-            {23, 351371},
-            {25, 351372},
-            {27, 351373},
-            {28, 351374},
-            {29, 351375},
-            {38, 351376},
-            {39, 351377},
-            {94, 351378},
-            {157, 351379},
-            {178, 351380},
-            {254, 351381},
-            {299, 351382},
-            {304, 351383},
-        }},
-        {4, {
-            {-1, 351393},
-            {9, 351385},
-            {15, 351386},
-            {16, 351387},
-            {56, 351388},
-            {61, 351389},
-            {68, 351390},
-            {115, 351391},
-            {116, 351392},
-        }},
-        {5, {
-            {-1, 351405},
-            {17, 351394},
-            {20, 351395},
-            {21, 351396},
-            {31, 351397},
-            {137, 351398},
-            {140, 351399},
-            {155, 351400},
-            {177, 351401},
-            {193, 351402},
-            {199, 351403},
-            {256, 351404},
-        }},
-        {6, {
-            {-1, 351422},
-            {30, 351406},
-            {39, 351407},
-            {47, 351408},
-            {48, 351409},
-            {49, 351410},
-            {54, 351411},
-            {56, 351412},
-            {77, 351413},
-            {78, 351414},
-            {89, 351415},
-            {99, 351416},
-            {102, 351417},
-            {256, 351418},
-            {278, 351419},
-            {292, 351420},
-            {293, 351421},
-        }},
-        {7, {
-            {-1, 351445},
-            {1, 351423},
-            {33, 351424},
-            {58, 351425},
-            {61, 351426},
-            {76, 351427},
-            {77, 351428},
-            {87, 351429},
-            {122, 351430},
-            {156, 351431},
-            {172, 351432},
-            {173, 351433},
-            {174, 351434},
-            {182, 351435},
-            {186, 351436},
-            {190, 351437},
-            {196, 351438},
-            {217, 351439},
-            {235, 351440},
-            {236, 351441},
-            {237, 351442},
-            {243, 351443},
-            {248, 351444},
-        }},
-        {8, {
-            {-1, 351463},
-            {80, 351446},
-            {81, 351447},
-            {85, 351448},
-            {100, 351449},
-            {101, 351450},
-            {102, 351451},
-            {146, 351452},
-            {148, 351453},
-            {180, 351454},
-            {186, 351455},
-            {187, 351456},
-            {192, 351457},
-            {292, 351458},
-            {304, 351459},
-            {310, 351460},
-            {311, 351461},
-            {312, 351462},
-        }},
-        {9, {
-            {-1, 351473},
-            {6, 351464},
-            {37, 351465},
-            {40, 351466},
-            {119, 351467},
-            {149, 351468},
-            {151, 351469},
-            {220, 351470},
-            {235, 351471},
-            {246, 351472},
-        }},
-    }},
+// Sorted by ep, map, index
+constexpr ap_location_def_t ap_doom_location_table[] = {
+    {1, 1, -1, 351331},
+    {1, 1, 13, 351000},
+    {1, 1, 68, 351001},
+    {1, 1, 98, 351002},
+    {1, 2, -1, 351337},
+    {1, 2, 4, 351003},
+    {1, 2, 5, 351004},
+    {1, 2, 20, 351005},
+    {1, 2, 22, 351006},
+    {1, 2, 25, 351007},
+    {1, 2, 41, 351008},
+    {1, 2, 43, 351009},
+    {1, 2, 53, 351010},
+    {1, 2, 119, 351011},
+    {1, 2, 139, 351012},
+    {1, 2, 200, 351013},
+    {1, 3, -1, 351345},
+    {1, 3, 8, 351014},
+    {1, 3, 9, 351015},
+    {1, 3, 18, 351016},
+    {1, 3, 19, 351017},
+    {1, 3, 64, 351018},
+    {1, 3, 77, 351019},
+    {1, 3, 85, 351020},
+    {1, 3, 107, 351021},
+    {1, 3, 109, 351022},
+    {1, 3, 112, 351023},
+    {1, 3, 259, 351024},
+    {1, 3, 260, 351025},
+    {1, 3, 261, 351026},
+    {1, 3, 265, 351027},
+    {1, 3, 323, 351028},
+    {1, 4, -1, 351323},
+    {1, 4, 11, 351029},
+    {1, 4, 39, 351030},
+    {1, 4, 61, 351031},
+    {1, 4, 62, 351032},
+    {1, 4, 63, 351033},
+    {1, 4, 64, 351034},
+    {1, 4, 100, 351035},
+    {1, 4, 107, 351036},
+    {1, 4, 129, 351037},
+    {1, 5, -1, 351340},
+    {1, 5, 4, 351038},
+    {1, 5, 10, 351039},
+    {1, 5, 11, 351040},
+    {1, 5, 60, 351041},
+    {1, 5, 75, 351042},
+    {1, 5, 83, 351043},
+    {1, 5, 167, 351044},
+    {1, 5, 169, 351045},
+    {1, 5, 173, 351046},
+    {1, 5, 174, 351047},
+    {1, 5, 176, 351048},
+    {1, 5, 206, 351049},
+    {1, 5, 208, 351050},
+    {1, 5, 279, 351051},
+    {1, 5, 280, 351052},
+    {1, 5, 282, 351053},
+    {1, 6, -1, 351321},
+    {1, 6, 4, 351054},
+    {1, 6, 5, 351055},
+    {1, 6, 9, 351056},
+    {1, 6, 10, 351057},
+    {1, 6, 22, 351058},
+    {1, 6, 23, 351059},
+    {1, 6, 24, 351060},
+    {1, 6, 63, 351061},
+    {1, 6, 64, 351062},
+    {1, 6, 81, 351063},
+    {1, 6, 82, 351064},
+    {1, 6, 123, 351065},
+    {1, 6, 124, 351066},
+    {1, 6, 131, 351067},
+    {1, 6, 214, 351068},
+    {1, 6, 291, 351069},
+    {1, 6, 381, 351070},
+    {1, 6, 392, 351071},
+    {1, 6, 395, 351072},
+    {1, 7, -1, 351324},
+    {1, 7, 18, 351073},
+    {1, 7, 20, 351074},
+    {1, 7, 21, 351075},
+    {1, 7, 25, 351076},
+    {1, 7, 26, 351077},
+    {1, 7, 27, 351078},
+    {1, 7, 53, 351079},
+    {1, 7, 87, 351080},
+    {1, 7, 122, 351081},
+    {1, 7, 309, 351082},
+    {1, 7, 310, 351083},
+    {1, 7, 311, 351084},
+    {1, 7, 312, 351085},
+    {1, 7, 314, 351086},
+    {1, 7, 337, 351087},
+    {1, 8, -1, 351339},
+    {1, 8, 15, 351088},
+    {1, 8, 49, 351089},
+    {1, 8, 52, 351090},
+    {1, 8, 53, 351091},
+    {1, 8, 65, 351092},
+    {1, 8, 70, 351093},
+    {1, 8, 94, 351094},
+    {1, 9, -1, 351335},
+    {1, 9, 13, 351095},
+    {1, 9, 20, 351096},
+    {1, 9, 87, 351097},
+    {1, 9, 139, 351098},
+    {1, 9, 172, 351099},
+    {1, 9, 188, 351100},
+    {1, 9, 222, 351101},
+    {1, 9, 223, 351102},
+    {1, 9, 225, 351103},
+    {2, 1, -1, 351326},
+    {2, 1, 44, 351104},
+    {2, 1, 51, 351105},
+    {2, 1, 54, 351106},
+    {2, 1, 57, 351107},
+    {2, 1, 83, 351108},
+    {2, 1, 84, 351109},
+    {2, 1, 86, 351110},
+    {2, 1, 99, 351111},
+    {2, 2, -1, 351325},
+    {2, 2, 8, 351112},
+    {2, 2, 9, 351113},
+    {2, 2, 20, 351114},
+    {2, 2, 66, 351115},
+    {2, 2, 80, 351116},
+    {2, 2, 81, 351117},
+    {2, 2, 100, 351118},
+    {2, 2, 109, 351119},
+    {2, 2, 125, 351120},
+    {2, 2, 127, 351121},
+    {2, 2, 138, 351122},
+    {2, 2, 143, 351123},
+    {2, 2, 144, 351124},
+    {2, 2, 153, 351125},
+    {2, 2, 160, 351126},
+    {2, 2, 161, 351127},
+    {2, 2, 165, 351128},
+    {2, 2, 250, 351129},
+    {2, 2, 291, 351130},
+    {2, 3, -1, 351341},
+    {2, 3, 12, 351131},
+    {2, 3, 37, 351132},
+    {2, 3, 40, 351133},
+    {2, 3, 57, 351134},
+    {2, 3, 67, 351135},
+    {2, 3, 87, 351136},
+    {2, 3, 90, 351137},
+    {2, 3, 110, 351138},
+    {2, 3, 113, 351139},
+    {2, 3, 221, 351140},
+    {2, 3, 223, 351141},
+    {2, 4, -1, 351327},
+    {2, 4, 7, 351142},
+    {2, 4, 8, 351143},
+    {2, 4, 39, 351144},
+    {2, 4, 40, 351145},
+    {2, 4, 74, 351146},
+    {2, 4, 86, 351147},
+    {2, 4, 107, 351148},
+    {2, 4, 109, 351149},
+    {2, 4, 129, 351150},
+    {2, 4, 130, 351151},
+    {2, 4, 159, 351152},
+    {2, 4, 174, 351153},
+    {2, 4, 175, 351154},
+    {2, 4, 186, 351155},
+    {2, 4, 189, 351156},
+    {2, 4, 244, 351157},
+    {2, 5, -1, 351322},
+    {2, 5, 3, 351158},
+    {2, 5, 53, 351159},
+    {2, 5, 57, 351160},
+    {2, 5, 69, 351161},
+    {2, 5, 79, 351162},
+    {2, 5, 109, 351163},
+    {2, 5, 176, 351164},
+    {2, 5, 197, 351165},
+    {2, 5, 233, 351166},
+    {2, 5, 256, 351167},
+    {2, 6, -1, 351330},
+    {2, 6, 10, 351168},
+    {2, 6, 13, 351169},
+    {2, 6, 26, 351170},
+    {2, 6, 39, 351171},
+    {2, 6, 48, 351172},
+    {2, 6, 49, 351173},
+    {2, 6, 57, 351174},
+    {2, 6, 125, 351175},
+    {2, 6, 142, 351176},
+    {2, 6, 143, 351177},
+    {2, 6, 173, 351178},
+    {2, 6, 217, 351179},
+    {2, 6, 220, 351180},
+    {2, 6, 230, 351181},
+    {2, 6, 232, 351182},
+    {2, 6, 286, 351183},
+    {2, 6, 320, 351184},
+    {2, 7, -1, 351343},
+    {2, 7, 29, 351185},
+    {2, 7, 49, 351186},
+    {2, 7, 79, 351187},
+    {2, 7, 94, 351188},
+    {2, 7, 128, 351189},
+    {2, 7, 131, 351190},
+    {2, 7, 140, 351191},
+    {2, 7, 141, 351192},
+    {2, 7, 142, 351193},
+    {2, 7, 146, 351194},
+    {2, 7, 160, 351195},
+    {2, 7, 174, 351196},
+    {2, 7, 199, 351197},
+    {2, 7, 200, 351198},
+    {2, 7, 201, 351199},
+    {2, 7, 203, 351200},
+    {2, 8, -1, 351344},
+    {2, 8, 16, 351201},
+    {2, 8, 17, 351202},
+    {2, 8, 18, 351203},
+    {2, 8, 36, 351204},
+    {2, 9, -1, 351329},
+    {2, 9, 18, 351205},
+    {2, 9, 27, 351206},
+    {2, 9, 28, 351207},
+    {2, 9, 29, 351208},
+    {2, 9, 30, 351209},
+    {2, 9, 31, 351210},
+    {2, 9, 32, 351211},
+    {2, 9, 33, 351212},
+    {2, 9, 34, 351213},
+    {2, 9, 35, 351214},
+    {2, 9, 36, 351215},
+    {2, 9, 44, 351216},
+    {3, 1, -1, 351332},
+    {3, 1, 20, 351217},
+    {3, 1, 46, 351218},
+    {3, 2, -1, 351342},
+    {3, 2, 32, 351219},
+    {3, 2, 37, 351220},
+    {3, 2, 76, 351221},
+    {3, 2, 77, 351222},
+    {3, 2, 80, 351223},
+    {3, 2, 88, 351224},
+    {3, 2, 154, 351225},
+    {3, 2, 181, 351226},
+    {3, 2, 182, 351227},
+    {3, 3, -1, 351338},
+    {3, 3, 11, 351228},
+    {3, 3, 14, 351229},
+    {3, 3, 22, 351230},
+    {3, 3, 23, 351231},
+    {3, 3, 26, 351232},
+    {3, 3, 49, 351233},
+    {3, 3, 66, 351234},
+    {3, 3, 73, 351235},
+    {3, 3, 85, 351236},
+    {3, 3, 88, 351237},
+    {3, 3, 92, 351238},
+    {3, 3, 113, 351239},
+    {3, 3, 118, 351240},
+    {3, 3, 183, 351241},
+    {3, 4, -1, 351333},
+    {3, 4, 5, 351242},
+    {3, 4, 15, 351243},
+    {3, 4, 17, 351244},
+    {3, 4, 46, 351245},
+    {3, 4, 51, 351246},
+    {3, 4, 87, 351247},
+    {3, 4, 100, 351248},
+    {3, 4, 114, 351249},
+    {3, 4, 121, 351250},
+    {3, 4, 134, 351251},
+    {3, 4, 160, 351252},
+    {3, 4, 170, 351253},
+    {3, 4, 182, 351254},
+    {3, 4, 206, 351255},
+    {3, 4, 220, 351256},
+    {3, 4, 242, 351257},
+    {3, 4, 243, 351258},
+    {3, 4, 318, 351259},
+    {3, 5, -1, 351346},
+    {3, 5, 54, 351260},
+    {3, 5, 55, 351261},
+    {3, 5, 86, 351262},
+    {3, 5, 87, 351263},
+    {3, 5, 89, 351264},
+    {3, 5, 90, 351265},
+    {3, 5, 126, 351266},
+    {3, 5, 129, 351267},
+    {3, 5, 133, 351268},
+    {3, 5, 180, 351269},
+    {3, 5, 187, 351270},
+    {3, 5, 190, 351271},
+    {3, 5, 218, 351272},
+    {3, 5, 285, 351273},
+    {3, 6, -1, 351336},
+    {3, 6, 38, 351274},
+    {3, 6, 53, 351275},
+    {3, 6, 90, 351276},
+    {3, 6, 100, 351277},
+    {3, 6, 103, 351278},
+    {3, 6, 104, 351279},
+    {3, 6, 105, 351280},
+    {3, 6, 168, 351281},
+    {3, 6, 180, 351282},
+    {3, 6, 206, 351283},
+    {3, 6, 207, 351284},
+    {3, 6, 249, 351285},
+    {3, 6, 250, 351286},
+    {3, 6, 251, 351287},
+    {3, 6, 267, 351288},
+    {3, 6, 273, 351289},
+    {3, 6, 326, 351290},
+    {3, 7, -1, 351334},
+    {3, 7, 22, 351291},
+    {3, 7, 49, 351292},
+    {3, 7, 51, 351293},
+    {3, 7, 57, 351294},
+    {3, 7, 60, 351295},
+    {3, 7, 65, 351296},
+    {3, 7, 67, 351297},
+    {3, 7, 69, 351298},
+    {3, 7, 83, 351299},
+    {3, 7, 112, 351300},
+    {3, 7, 128, 351301},
+    {3, 8, -1, 351328},
+    {3, 8, 7, 351302},
+    {3, 8, 8, 351303},
+    {3, 8, 34, 351304},
+    {3, 9, -1, 351347},
+    {3, 9, 20, 351305},
+    {3, 9, 46, 351306},
+    {3, 9, 99, 351307},
+    {3, 9, 101, 351308},
+    {3, 9, 108, 351309},
+    {3, 9, 114, 351310},
+    {3, 9, 120, 351311},
+    {3, 9, 121, 351312},
+    {3, 9, 122, 351313},
+    {3, 9, 135, 351314},
+    {3, 9, 138, 351315},
+    {3, 9, 139, 351316},
+    {3, 9, 140, 351317},
+    {3, 9, 141, 351318},
+    {3, 9, 143, 351319},
+    {3, 9, 188, 351320},
+    {4, 1, -1, 351354},
+    {4, 1, 6, 351348},
+    {4, 1, 23, 351349},
+    {4, 1, 33, 351350},
+    {4, 1, 47, 351351},
+    {4, 1, 90, 351352},
+    {4, 1, 97, 351353},
+    {4, 2, -1, 351367},
+    {4, 2, 5, 351355},
+    {4, 2, 10, 351356},
+    {4, 2, 14, 351357},
+    {4, 2, 17, 351358},
+    {4, 2, 20, 351359},
+    {4, 2, 29, 351360},
+    {4, 2, 46, 351361},
+    {4, 2, 93, 351362},
+    {4, 2, 126, 351363},
+    {4, 2, 151, 351364},
+    {4, 2, 167, 351365},
+    {4, 2, 217, 351366},
+    {4, 3, -1, 351384},
+    {4, 3, 9, 351368},
+    {4, 3, 21, 351369},
+    {4, 3, 22, 351370},
+    {4, 3, 23, 351371},
+    {4, 3, 25, 351372},
+    {4, 3, 27, 351373},
+    {4, 3, 28, 351374},
+    {4, 3, 29, 351375},
+    {4, 3, 38, 351376},
+    {4, 3, 39, 351377},
+    {4, 3, 94, 351378},
+    {4, 3, 157, 351379},
+    {4, 3, 178, 351380},
+    {4, 3, 254, 351381},
+    {4, 3, 299, 351382},
+    {4, 3, 304, 351383},
+    {4, 4, -1, 351393},
+    {4, 4, 9, 351385},
+    {4, 4, 15, 351386},
+    {4, 4, 16, 351387},
+    {4, 4, 56, 351388},
+    {4, 4, 61, 351389},
+    {4, 4, 68, 351390},
+    {4, 4, 115, 351391},
+    {4, 4, 116, 351392},
+    {4, 5, -1, 351405},
+    {4, 5, 17, 351394},
+    {4, 5, 20, 351395},
+    {4, 5, 21, 351396},
+    {4, 5, 31, 351397},
+    {4, 5, 137, 351398},
+    {4, 5, 140, 351399},
+    {4, 5, 155, 351400},
+    {4, 5, 177, 351401},
+    {4, 5, 193, 351402},
+    {4, 5, 199, 351403},
+    {4, 5, 256, 351404},
+    {4, 6, -1, 351422},
+    {4, 6, 30, 351406},
+    {4, 6, 39, 351407},
+    {4, 6, 47, 351408},
+    {4, 6, 48, 351409},
+    {4, 6, 49, 351410},
+    {4, 6, 54, 351411},
+    {4, 6, 56, 351412},
+    {4, 6, 77, 351413},
+    {4, 6, 78, 351414},
+    {4, 6, 89, 351415},
+    {4, 6, 99, 351416},
+    {4, 6, 102, 351417},
+    {4, 6, 256, 351418},
+    {4, 6, 278, 351419},
+    {4, 6, 292, 351420},
+    {4, 6, 293, 351421},
+    {4, 7, -1, 351445},
+    {4, 7, 1, 351423},
+    {4, 7, 33, 351424},
+    {4, 7, 58, 351425},
+    {4, 7, 61, 351426},
+    {4, 7, 76, 351427},
+    {4, 7, 77, 351428},
+    {4, 7, 87, 351429},
+    {4, 7, 122, 351430},
+    {4, 7, 156, 351431},
+    {4, 7, 172, 351432},
+    {4, 7, 173, 351433},
+    {4, 7, 174, 351434},
+    {4, 7, 182, 351435},
+    {4, 7, 186, 351436},
+    {4, 7, 190, 351437},
+    {4, 7, 196, 351438},
+    {4, 7, 217, 351439},
+    {4, 7, 235, 351440},
+    {4, 7, 236, 351441},
+    {4, 7, 237, 351442},
+    {4, 7, 243, 351443},
+    {4, 7, 248, 351444},
+    {4, 8, -1, 351463},
+    {4, 8, 80, 351446},
+    {4, 8, 81, 351447},
+    {4, 8, 85, 351448},
+    {4, 8, 100, 351449},
+    {4, 8, 101, 351450},
+    {4, 8, 102, 351451},
+    {4, 8, 146, 351452},
+    {4, 8, 148, 351453},
+    {4, 8, 180, 351454},
+    {4, 8, 186, 351455},
+    {4, 8, 187, 351456},
+    {4, 8, 192, 351457},
+    {4, 8, 292, 351458},
+    {4, 8, 304, 351459},
+    {4, 8, 310, 351460},
+    {4, 8, 311, 351461},
+    {4, 8, 312, 351462},
+    {4, 9, -1, 351473},
+    {4, 9, 6, 351464},
+    {4, 9, 37, 351465},
+    {4, 9, 40, 351466},
+    {4, 9, 119, 351467},
+    {4, 9, 149, 351468},
+    {4, 9, 151, 351469},
+    {4, 9, 220, 351470},
+    {4, 9, 235, 351471},
+    {4, 9, 246, 351472},
 };
 
 
-// Map item id
-const std::map<int64_t, ap_item_t> ap_doom_item_table = {
+// Map item id, sorted by id
+constexpr ap_item_def_t ap_doom_item_table[] = {
     {350000, {-1, 1, 1}},
     {350001, {2026, 1, 1}},
     {350002, {-1, 1, 2}},
@@ -762,8774 +680,8791 @@ const std::map<int64_t, ap_item_t> ap_doom_item_table = {
 };
 
 
-std::vector<std::vector<ap_level_info_t>> ap_doom_level_infos = 
-{
-    {
-        {"Hangar (E1M1)", {false, false, false}, {0, 0, 0}, 3, 143, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {48, 4, 0},
-            {48, 5, 0},
-            {2028, 6, 0},
-            {2028, 7, 0},
-            {3001, 8, 0},
-            {3001, 9, 0},
-            {3004, 10, 0},
-            {3004, 11, 0},
-            {3004, 12, 0},
-            {2019, 13, 0},
-            {3004, 14, 0},
-            {3004, 15, 0},
-            {3001, 16, 0},
-            {3004, 17, 0},
-            {3004, 18, 0},
-            {2012, 19, 0},
-            {2007, 20, 0},
-            {2007, 21, 0},
-            {2008, 22, 0},
-            {2014, 23, 0},
-            {2014, 24, 0},
-            {2014, 25, 0},
-            {2014, 26, 0},
-            {2015, 27, 0},
-            {2015, 28, 0},
-            {2015, 29, 0},
-            {2015, 30, 0},
-            {2014, 31, 0},
-            {2014, 32, 0},
-            {2015, 33, 0},
-            {2015, 34, 0},
-            {2035, 35, 0},
-            {2035, 36, 0},
-            {2035, 37, 0},
-            {2014, 38, 0},
-            {2014, 39, 0},
-            {2028, 40, 0},
-            {2028, 41, 0},
-            {2008, 42, 0},
-            {2008, 43, 0},
-            {2028, 44, 0},
-            {2028, 45, 0},
-            {2028, 46, 0},
-            {2028, 47, 0},
-            {2035, 48, 0},
-            {2035, 49, 0},
-            {2035, 50, 0},
-            {2014, 51, 0},
-            {2014, 52, 0},
-            {2014, 53, 0},
-            {2014, 54, 0},
-            {2014, 55, 0},
-            {2015, 56, 0},
-            {2015, 57, 0},
-            {2015, 58, 0},
-            {2015, 59, 0},
-            {2015, 60, 0},
-            {35, 61, 0},
-            {35, 62, 0},
-            {3001, 63, 0},
-            {2011, 64, 0},
-            {2012, 65, 0},
-            {2049, 66, 0},
-            {2048, 67, 0},
-            {2018, 68, 0},
-            {11, 69, 0},
-            {11, 70, 0},
-            {11, 71, 0},
-            {11, 72, 0},
-            {11, 73, 0},
-            {2003, 74, 0},
-            {2046, 75, 0},
-            {2046, 76, 0},
-            {2046, 77, 0},
-            {2002, 78, 0},
-            {2048, 79, 0},
-            {2048, 80, 0},
-            {2048, 81, 0},
-            {2048, 82, 0},
-            {2048, 83, 0},
-            {2049, 84, 0},
-            {2049, 85, 0},
-            {2049, 86, 0},
-            {3004, 87, 0},
-            {3004, 88, 0},
-            {9, 89, 0},
-            {9, 90, 0},
-            {2015, 91, 0},
-            {2015, 92, 0},
-            {2015, 93, 0},
-            {2015, 94, 0},
-            {2015, 95, 0},
-            {2015, 96, 0},
-            {2049, 97, 0},
-            {2001, 98, 0},
-            {2012, 99, 0},
-            {9, 100, 0},
-            {9, 101, 0},
-            {9, 102, 0},
-            {9, 103, 0},
-            {9, 104, 0},
-            {9, 105, 0},
-            {9, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {9, 109, 0},
-            {9, 110, 0},
-            {9, 111, 0},
-            {9, 112, 0},
-            {9, 113, 0},
-            {10, 114, 0},
-            {15, 115, 0},
-            {24, 116, 0},
-            {10, 117, 0},
-            {15, 118, 0},
-            {15, 119, 0},
-            {24, 120, 0},
-            {24, 121, 0},
-            {24, 122, 0},
-            {15, 123, 0},
-            {12, 124, 0},
-            {12, 125, 0},
-            {24, 126, 0},
-            {24, 127, 0},
-            {24, 128, 0},
-            {2049, 129, 0},
-            {2015, 130, 0},
-            {2015, 131, 0},
-            {2015, 132, 0},
-            {2015, 133, 0},
-            {2015, 134, 0},
-            {2015, 135, 0},
-            {2015, 136, 0},
-            {2015, 137, 0},
-            {2023, 138, 0},
-            {2035, 139, 0},
-            {2035, 140, 0},
-            {2035, 141, 0},
-            {2001, 142, 0},
-        }},
-        {"Nuclear Plant (E1M2)", {false, false, true}, {0, 0, 0}, 11, 262, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {2005, 4, 0},
-            {2001, 5, 0},
-            {2049, 6, 0},
-            {3004, 7, 0},
-            {3004, 8, 0},
-            {3004, 9, 0},
-            {3004, 10, 0},
-            {3004, 11, 0},
-            {3004, 12, 0},
-            {3004, 13, 0},
-            {3004, 14, 0},
-            {3004, 15, 0},
-            {3004, 16, 0},
-            {3004, 17, 0},
-            {3004, 18, 0},
-            {2015, 19, 0},
-            {2018, 20, 0},
-            {2012, 21, 0},
-            {2013, 22, 0},
-            {2014, 23, 0},
-            {2015, 24, 0},
-            {2002, 25, 0},
-            {2015, 26, 0},
-            {2015, 27, 0},
-            {3004, 28, 0},
-            {3004, 29, 0},
-            {3004, 30, 0},
-            {3001, 31, 0},
-            {2007, 32, 0},
-            {2007, 33, 0},
-            {2015, 34, 0},
-            {2015, 35, 0},
-            {2014, 36, 0},
-            {3004, 37, 0},
-            {2008, 38, 0},
-            {2011, 39, 0},
-            {2011, 40, 0},
-            {13, 41, 0},
-            {2012, 42, 0},
-            {2018, 43, 0},
-            {2012, 44, 0},
-            {2049, 45, 0},
-            {3001, 46, 0},
-            {3001, 47, 0},
-            {3001, 48, 0},
-            {3001, 49, 0},
-            {3004, 50, 0},
-            {3004, 51, 0},
-            {3004, 52, 0},
-            {2019, 53, 0},
-            {2012, 54, 0},
-            {2011, 55, 0},
-            {2015, 56, 0},
-            {3001, 57, 0},
-            {3001, 58, 0},
-            {3001, 59, 0},
-            {2049, 60, 0},
-            {3001, 61, 0},
-            {2015, 62, 0},
-            {2014, 63, 0},
-            {2014, 64, 0},
-            {2014, 65, 0},
-            {3004, 66, 0},
-            {3004, 67, 0},
-            {3004, 68, 0},
-            {3004, 69, 0},
-            {3004, 70, 0},
-            {3004, 71, 0},
-            {3004, 72, 0},
-            {3004, 73, 0},
-            {3001, 74, 0},
-            {3001, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3004, 78, 0},
-            {3004, 79, 0},
-            {3004, 80, 0},
-            {3004, 81, 0},
-            {3004, 82, 0},
-            {3004, 83, 0},
-            {3004, 84, 0},
-            {3004, 85, 0},
-            {3004, 86, 0},
-            {3004, 87, 0},
-            {3004, 88, 0},
-            {3004, 89, 0},
-            {3004, 90, 0},
-            {3004, 91, 0},
-            {3004, 92, 0},
-            {3004, 93, 0},
-            {3004, 94, 0},
-            {3004, 95, 0},
-            {3004, 96, 0},
-            {2014, 97, 0},
-            {2014, 98, 0},
-            {2007, 99, 0},
-            {2008, 100, 0},
-            {2011, 101, 0},
-            {2011, 102, 0},
-            {2008, 103, 0},
-            {2015, 104, 0},
-            {2015, 105, 0},
-            {2014, 106, 0},
-            {2014, 107, 0},
-            {2014, 108, 0},
-            {2014, 109, 0},
-            {2015, 110, 0},
-            {2015, 111, 0},
-            {2014, 112, 0},
-            {2014, 113, 0},
-            {2012, 114, 0},
-            {2014, 115, 0},
-            {2015, 116, 0},
-            {3001, 117, 0},
-            {2028, 118, 0},
-            {2018, 119, 0},
-            {2015, 120, 0},
-            {2014, 121, 0},
-            {2015, 122, 0},
-            {2014, 123, 0},
-            {2015, 124, 0},
-            {2014, 125, 0},
-            {2014, 126, 0},
-            {2014, 127, 0},
-            {48, 128, 0},
-            {48, 129, 0},
-            {2011, 130, 0},
-            {3004, 131, 0},
-            {3004, 132, 0},
-            {3004, 133, 0},
-            {3004, 134, 0},
-            {3004, 135, 0},
-            {3001, 136, 0},
-            {2012, 137, 0},
-            {2008, 138, 0},
-            {8, 139, 0},
-            {3001, 140, 0},
-            {3001, 141, 0},
-            {2012, 142, 0},
-            {2048, 143, 0},
-            {2012, 144, 0},
-            {2048, 145, 0},
-            {2012, 146, 0},
-            {2012, 147, 0},
-            {2008, 148, 0},
-            {2007, 149, 0},
-            {3001, 150, 0},
-            {3004, 151, 0},
-            {2008, 152, 0},
-            {2008, 153, 0},
-            {2008, 154, 0},
-            {2008, 155, 0},
-            {2008, 156, 0},
-            {2008, 157, 0},
-            {2008, 158, 0},
-            {2008, 159, 0},
-            {2007, 160, 0},
-            {2007, 161, 0},
-            {2007, 162, 0},
-            {2048, 163, 0},
-            {2048, 164, 0},
-            {2007, 165, 0},
-            {2007, 166, 0},
-            {2007, 167, 0},
-            {2012, 168, 0},
-            {2007, 169, 0},
-            {2007, 170, 0},
-            {2048, 171, 0},
-            {2048, 172, 0},
-            {2048, 173, 0},
-            {2048, 174, 0},
-            {2048, 175, 0},
-            {2048, 176, 0},
-            {2048, 177, 0},
-            {2048, 178, 0},
-            {2048, 179, 0},
-            {2048, 180, 0},
-            {2015, 181, 0},
-            {2015, 182, 0},
-            {2015, 183, 0},
-            {2015, 184, 0},
-            {2003, 185, 0},
-            {2046, 186, 0},
-            {2046, 187, 0},
-            {2046, 188, 0},
-            {2046, 189, 0},
-            {2014, 190, 0},
-            {2014, 191, 0},
-            {9, 192, 0},
-            {9, 193, 0},
-            {9, 194, 0},
-            {9, 195, 0},
-            {9, 196, 0},
-            {9, 197, 0},
-            {9, 198, 0},
-            {9, 199, 0},
-            {8, 200, 0},
-            {2035, 201, 0},
-            {2035, 202, 0},
-            {2035, 203, 0},
-            {2035, 204, 0},
-            {2035, 205, 0},
-            {2035, 206, 0},
-            {2035, 207, 0},
-            {2035, 208, 0},
-            {2035, 209, 0},
-            {2035, 210, 0},
-            {2035, 211, 0},
-            {2035, 212, 0},
-            {2035, 213, 0},
-            {2035, 214, 0},
-            {2035, 215, 0},
-            {2035, 216, 0},
-            {2035, 217, 0},
-            {2035, 218, 0},
-            {2035, 219, 0},
-            {2035, 220, 0},
-            {2035, 221, 0},
-            {2035, 222, 0},
-            {2035, 223, 0},
-            {2035, 224, 0},
-            {11, 225, 0},
-            {11, 226, 0},
-            {11, 227, 0},
-            {11, 228, 0},
-            {11, 229, 0},
-            {11, 230, 0},
-            {11, 231, 0},
-            {11, 232, 0},
-            {11, 233, 0},
-            {11, 234, 0},
-            {3004, 235, 0},
-            {3004, 236, 0},
-            {15, 237, 0},
-            {15, 238, 0},
-            {24, 239, 0},
-            {24, 240, 0},
-            {24, 241, 0},
-            {12, 242, 0},
-            {12, 243, 0},
-            {10, 244, 0},
-            {10, 245, 0},
-            {10, 246, 0},
-            {10, 247, 0},
-            {10, 248, 0},
-            {15, 249, 0},
-            {15, 250, 0},
-            {15, 251, 0},
-            {24, 252, 0},
-            {10, 253, 0},
-            {15, 254, 0},
-            {15, 255, 0},
-            {24, 256, 0},
-            {10, 257, 0},
-            {15, 258, 0},
-            {12, 259, 0},
-            {10, 260, 0},
-            {10, 261, 0},
-        }},
-        {"Toxin Refinery (E1M3)", {true, true, false}, {0, 0, 0}, 15, 380, {
-            {1, 0, 0},
-            {3, 1, 0},
-            {2, 2, 0},
-            {4, 3, 0},
-            {2014, 4, 0},
-            {2015, 5, 0},
-            {2015, 6, 0},
-            {2007, 7, 0},
-            {2018, 8, 0},
-            {2013, 9, 0},
-            {2014, 10, 0},
-            {2014, 11, 0},
-            {2014, 12, 0},
-            {2015, 13, 0},
-            {2014, 14, 0},
-            {2015, 15, 0},
-            {2015, 16, 0},
-            {2012, 17, 0},
-            {6, 18, 0},
-            {5, 19, 0},
-            {2014, 20, 0},
-            {2014, 21, 0},
-            {2049, 22, 0},
-            {2049, 23, 0},
-            {48, 24, 0},
-            {48, 25, 0},
-            {48, 26, 0},
-            {48, 27, 0},
-            {48, 28, 0},
-            {48, 29, 0},
-            {48, 30, 0},
-            {48, 31, 0},
-            {48, 32, 0},
-            {2028, 33, 0},
-            {2028, 34, 0},
-            {2028, 35, 0},
-            {2028, 36, 0},
-            {2035, 37, 0},
-            {2035, 38, 0},
-            {2035, 39, 0},
-            {2035, 40, 0},
-            {2035, 41, 0},
-            {2035, 42, 0},
-            {3004, 43, 0},
-            {3004, 44, 0},
-            {3004, 45, 0},
-            {3004, 46, 0},
-            {9, 47, 0},
-            {9, 48, 0},
-            {9, 49, 0},
-            {2012, 50, 0},
-            {2012, 51, 0},
-            {2035, 52, 0},
-            {2035, 53, 0},
-            {2035, 54, 0},
-            {2035, 55, 0},
-            {2035, 56, 0},
-            {2035, 57, 0},
-            {3002, 58, 0},
-            {2008, 59, 0},
-            {2007, 60, 0},
-            {2007, 61, 0},
-            {2011, 62, 0},
-            {2011, 63, 0},
-            {2001, 64, 0},
-            {3004, 65, 0},
-            {3004, 66, 0},
-            {3001, 67, 0},
-            {9, 68, 0},
-            {9, 69, 0},
-            {2049, 70, 0},
-            {2035, 71, 0},
-            {3001, 72, 0},
-            {3001, 73, 0},
-            {3001, 74, 0},
-            {9, 75, 0},
-            {2035, 76, 0},
-            {2001, 77, 0},
-            {2008, 78, 0},
-            {2007, 79, 0},
-            {2011, 80, 0},
-            {2014, 81, 0},
-            {2014, 82, 0},
-            {2014, 83, 0},
-            {2015, 84, 0},
-            {2018, 85, 0},
-            {2014, 86, 0},
-            {2014, 87, 0},
-            {2014, 88, 0},
-            {2015, 89, 0},
-            {2015, 90, 0},
-            {2015, 91, 0},
-            {2015, 92, 0},
-            {2015, 93, 0},
-            {2015, 94, 0},
-            {2015, 95, 0},
-            {2015, 96, 0},
-            {2015, 97, 0},
-            {2015, 98, 0},
-            {2015, 99, 0},
-            {3001, 100, 0},
-            {3001, 101, 0},
-            {3001, 102, 0},
-            {3004, 103, 0},
-            {2014, 104, 0},
-            {2014, 105, 0},
-            {2007, 106, 0},
-            {2003, 107, 0},
-            {2046, 108, 0},
-            {2002, 109, 0},
-            {2048, 110, 0},
-            {2048, 111, 0},
-            {8, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {3001, 115, 0},
-            {9, 116, 0},
-            {2012, 117, 0},
-            {2012, 118, 0},
-            {2012, 119, 0},
-            {2011, 120, 0},
-            {2011, 121, 0},
-            {2048, 122, 0},
-            {2008, 123, 0},
-            {2008, 124, 0},
-            {2008, 125, 0},
-            {3001, 126, 0},
-            {3001, 127, 0},
-            {9, 128, 0},
-            {9, 129, 0},
-            {3002, 130, 0},
-            {58, 131, 0},
-            {3002, 132, 0},
-            {2008, 133, 0},
-            {2008, 134, 0},
-            {2035, 135, 0},
-            {2035, 136, 0},
-            {2035, 137, 0},
-            {2035, 138, 0},
-            {2014, 139, 0},
-            {2014, 140, 0},
-            {2014, 141, 0},
-            {2014, 142, 0},
-            {2014, 143, 0},
-            {2014, 144, 0},
-            {2015, 145, 0},
-            {2015, 146, 0},
-            {2015, 147, 0},
-            {2015, 148, 0},
-            {2015, 149, 0},
-            {2015, 150, 0},
-            {2008, 151, 0},
-            {2008, 152, 0},
-            {2008, 153, 0},
-            {2014, 154, 0},
-            {2014, 155, 0},
-            {2014, 156, 0},
-            {2014, 157, 0},
-            {2011, 158, 0},
-            {3001, 159, 0},
-            {3004, 160, 0},
-            {3004, 161, 0},
-            {3004, 162, 0},
-            {9, 163, 0},
-            {9, 164, 0},
-            {9, 165, 0},
-            {3001, 166, 0},
-            {2012, 167, 0},
-            {2011, 168, 0},
-            {2008, 169, 0},
-            {3001, 170, 0},
-            {3001, 171, 0},
-            {3004, 172, 0},
-            {3004, 173, 0},
-            {9, 174, 0},
-            {3002, 175, 0},
-            {3002, 176, 0},
-            {2008, 177, 0},
-            {2007, 178, 0},
-            {2011, 179, 0},
-            {2035, 180, 0},
-            {2035, 181, 0},
-            {2035, 182, 0},
-            {9, 183, 0},
-            {9, 184, 0},
-            {9, 185, 0},
-            {3004, 186, 0},
-            {3002, 187, 0},
-            {2035, 188, 0},
-            {3004, 189, 0},
-            {3004, 190, 0},
-            {3001, 191, 0},
-            {3001, 192, 0},
-            {3001, 193, 0},
-            {3001, 194, 0},
-            {2035, 195, 0},
-            {2014, 196, 0},
-            {2014, 197, 0},
-            {2015, 198, 0},
-            {2015, 199, 0},
-            {2028, 200, 0},
-            {2049, 201, 0},
-            {2048, 202, 0},
-            {2012, 203, 0},
-            {2008, 204, 0},
-            {2007, 205, 0},
-            {2007, 206, 0},
-            {2014, 207, 0},
-            {2014, 208, 0},
-            {2015, 209, 0},
-            {2015, 210, 0},
-            {2015, 211, 0},
-            {2015, 212, 0},
-            {3002, 213, 0},
-            {3001, 214, 0},
-            {2012, 215, 0},
-            {2014, 216, 0},
-            {2014, 217, 0},
-            {2014, 218, 0},
-            {2014, 219, 0},
-            {48, 220, 0},
-            {48, 221, 0},
-            {3004, 222, 0},
-            {3004, 223, 0},
-            {3004, 224, 0},
-            {3004, 225, 0},
-            {9, 226, 0},
-            {9, 227, 0},
-            {9, 228, 0},
-            {3001, 229, 0},
-            {3001, 230, 0},
-            {3001, 231, 0},
-            {3001, 232, 0},
-            {3001, 233, 0},
-            {2035, 234, 0},
-            {2035, 235, 0},
-            {2008, 236, 0},
-            {2008, 237, 0},
-            {2012, 238, 0},
-            {2014, 239, 0},
-            {2014, 240, 0},
-            {2014, 241, 0},
-            {2014, 242, 0},
-            {2015, 243, 0},
-            {2015, 244, 0},
-            {2015, 245, 0},
-            {2015, 246, 0},
-            {3001, 247, 0},
-            {3001, 248, 0},
-            {9, 249, 0},
-            {9, 250, 0},
-            {9, 251, 0},
-            {9, 252, 0},
-            {3004, 253, 0},
-            {3004, 254, 0},
-            {3004, 255, 0},
-            {3004, 256, 0},
-            {3004, 257, 0},
-            {2012, 258, 0},
-            {2013, 259, 0},
-            {2024, 260, 0},
-            {2005, 261, 0},
-            {2046, 262, 0},
-            {2012, 263, 0},
-            {2012, 264, 0},
-            {2019, 265, 0},
-            {2014, 266, 0},
-            {2014, 267, 0},
-            {2014, 268, 0},
-            {2014, 269, 0},
-            {2015, 270, 0},
-            {2015, 271, 0},
-            {2015, 272, 0},
-            {2015, 273, 0},
-            {2014, 274, 0},
-            {2014, 275, 0},
-            {2015, 276, 0},
-            {2015, 277, 0},
-            {2015, 278, 0},
-            {2015, 279, 0},
-            {2015, 280, 0},
-            {2014, 281, 0},
-            {2014, 282, 0},
-            {2035, 283, 0},
-            {2035, 284, 0},
-            {2035, 285, 0},
-            {2011, 286, 0},
-            {2011, 287, 0},
-            {2011, 288, 0},
-            {2011, 289, 0},
-            {3001, 290, 0},
-            {3001, 291, 0},
-            {3001, 292, 0},
-            {3001, 293, 0},
-            {3001, 294, 0},
-            {9, 295, 0},
-            {9, 296, 0},
-            {9, 297, 0},
-            {9, 298, 0},
-            {3004, 299, 0},
-            {3004, 300, 0},
-            {3004, 301, 0},
-            {3004, 302, 0},
-            {9, 303, 0},
-            {9, 304, 0},
-            {9, 305, 0},
-            {9, 306, 0},
-            {9, 307, 0},
-            {3001, 308, 0},
-            {2012, 309, 0},
-            {2011, 310, 0},
-            {2008, 311, 0},
-            {2008, 312, 0},
-            {2007, 313, 0},
-            {2007, 314, 0},
-            {2014, 315, 0},
-            {2014, 316, 0},
-            {2014, 317, 0},
-            {2015, 318, 0},
-            {2015, 319, 0},
-            {2049, 320, 0},
-            {2048, 321, 0},
-            {2028, 322, 0},
-            {2018, 323, 0},
-            {2012, 324, 0},
-            {3001, 325, 0},
-            {9, 326, 0},
-            {9, 327, 0},
-            {3001, 328, 0},
-            {9, 329, 0},
-            {9, 330, 0},
-            {3001, 331, 0},
-            {3001, 332, 0},
-            {3001, 333, 0},
-            {3001, 334, 0},
-            {3001, 335, 0},
-            {3001, 336, 0},
-            {3001, 337, 0},
-            {9, 338, 0},
-            {9, 339, 0},
-            {9, 340, 0},
-            {9, 341, 0},
-            {9, 342, 0},
-            {9, 343, 0},
-            {9, 344, 0},
-            {9, 345, 0},
-            {3001, 346, 0},
-            {3001, 347, 0},
-            {9, 348, 0},
-            {9, 349, 0},
-            {3001, 350, 0},
-            {3001, 351, 0},
-            {9, 352, 0},
-            {58, 353, 0},
-            {2011, 354, 0},
-            {11, 355, 0},
-            {11, 356, 0},
-            {11, 357, 0},
-            {11, 358, 0},
-            {11, 359, 0},
-            {11, 360, 0},
-            {11, 361, 0},
-            {11, 362, 0},
-            {11, 363, 0},
-            {15, 364, 0},
-            {24, 365, 0},
-            {10, 366, 0},
-            {12, 367, 0},
-            {10, 368, 0},
-            {15, 369, 0},
-            {24, 370, 0},
-            {24, 371, 0},
-            {15, 372, 0},
-            {10, 373, 0},
-            {10, 374, 0},
-            {12, 375, 0},
-            {15, 376, 0},
-            {15, 377, 0},
-            {24, 378, 0},
-            {2046, 379, 0},
-        }},
-        {"Command Control (E1M4)", {true, true, false}, {0, 0, 0}, 9, 254, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3001, 4, 0},
-            {3001, 5, 0},
-            {2014, 6, 0},
-            {2014, 7, 0},
-            {2014, 8, 0},
-            {2014, 9, 0},
-            {2014, 10, 0},
-            {2002, 11, 0},
-            {9, 12, 0},
-            {9, 13, 0},
-            {9, 14, 0},
-            {2008, 15, 0},
-            {2008, 16, 0},
-            {2007, 17, 0},
-            {2007, 18, 0},
-            {2008, 19, 0},
-            {2007, 20, 0},
-            {2007, 21, 0},
-            {2048, 22, 0},
-            {2011, 23, 0},
-            {2046, 24, 0},
-            {2014, 25, 0},
-            {2014, 26, 0},
-            {2014, 27, 0},
-            {2014, 28, 0},
-            {2014, 29, 0},
-            {2014, 30, 0},
-            {2014, 31, 0},
-            {2014, 32, 0},
-            {2014, 33, 0},
-            {2014, 34, 0},
-            {2014, 35, 0},
-            {2014, 36, 0},
-            {2014, 37, 0},
-            {2014, 38, 0},
-            {2018, 39, 0},
-            {2012, 40, 0},
-            {3004, 41, 0},
-            {3004, 42, 0},
-            {3004, 43, 0},
-            {3004, 44, 0},
-            {3004, 45, 0},
-            {2048, 46, 0},
-            {2007, 47, 0},
-            {2008, 48, 0},
-            {2007, 49, 0},
-            {9, 50, 0},
-            {3004, 51, 0},
-            {3004, 52, 0},
-            {3004, 53, 0},
-            {3004, 54, 0},
-            {3004, 55, 0},
-            {2049, 56, 0},
-            {2012, 57, 0},
-            {3001, 58, 0},
-            {3001, 59, 0},
-            {3001, 60, 0},
-            {6, 61, 0},
-            {5, 62, 0},
-            {2013, 63, 0},
-            {2003, 64, 0},
-            {2007, 65, 0},
-            {2010, 66, 0},
-            {2025, 67, 0},
-            {2015, 68, 0},
-            {2015, 69, 0},
-            {2015, 70, 0},
-            {2015, 71, 0},
-            {2015, 72, 0},
-            {2015, 73, 0},
-            {2015, 74, 0},
-            {2012, 75, 0},
-            {2011, 76, 0},
-            {2011, 77, 0},
-            {2008, 78, 0},
-            {3004, 79, 0},
-            {3001, 80, 0},
-            {3002, 81, 0},
-            {3002, 82, 0},
-            {3002, 83, 0},
-            {3001, 84, 0},
-            {3001, 85, 0},
-            {3004, 86, 0},
-            {3001, 87, 0},
-            {3001, 88, 0},
-            {2025, 89, 0},
-            {3001, 90, 0},
-            {3001, 91, 0},
-            {2011, 92, 0},
-            {2012, 93, 0},
-            {2014, 94, 0},
-            {2048, 95, 0},
-            {2048, 96, 0},
-            {2007, 97, 0},
-            {2008, 98, 0},
-            {2008, 99, 0},
-            {2019, 100, 0},
-            {3001, 101, 0},
-            {3001, 102, 0},
-            {2011, 103, 0},
-            {2011, 104, 0},
-            {2011, 105, 0},
-            {2011, 106, 0},
-            {8, 107, 0},
-            {3001, 108, 0},
-            {3002, 109, 0},
-            {3001, 110, 0},
-            {3001, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {3004, 115, 0},
-            {3004, 116, 0},
-            {3004, 117, 0},
-            {9, 118, 0},
-            {3004, 119, 0},
-            {9, 120, 0},
-            {3004, 121, 0},
-            {3004, 122, 0},
-            {3002, 123, 0},
-            {9, 124, 0},
-            {9, 125, 0},
-            {2014, 126, 0},
-            {2014, 127, 0},
-            {2014, 128, 0},
-            {2001, 129, 0},
-            {3001, 130, 0},
-            {3001, 131, 0},
-            {3001, 132, 0},
-            {3001, 133, 0},
-            {2007, 134, 0},
-            {2011, 135, 0},
-            {2028, 136, 0},
-            {2028, 137, 0},
-            {2028, 138, 0},
-            {2028, 139, 0},
-            {3001, 140, 0},
-            {3001, 141, 0},
-            {3002, 142, 0},
-            {3002, 143, 0},
-            {3001, 144, 0},
-            {3002, 145, 0},
-            {3002, 146, 0},
-            {2007, 147, 0},
-            {2007, 148, 0},
-            {9, 149, 0},
-            {9, 150, 0},
-            {9, 151, 0},
-            {3001, 152, 0},
-            {3001, 153, 0},
-            {3001, 154, 0},
-            {3001, 155, 0},
-            {3001, 156, 0},
-            {3001, 157, 0},
-            {3002, 158, 0},
-            {9, 159, 0},
-            {9, 160, 0},
-            {3001, 161, 0},
-            {3001, 162, 0},
-            {9, 163, 0},
-            {3004, 164, 0},
-            {3004, 165, 0},
-            {3004, 166, 0},
-            {9, 167, 0},
-            {3002, 168, 0},
-            {3001, 169, 0},
-            {2014, 170, 0},
-            {2014, 171, 0},
-            {2015, 172, 0},
-            {2015, 173, 0},
-            {2015, 174, 0},
-            {2015, 175, 0},
-            {2015, 176, 0},
-            {2015, 177, 0},
-            {2015, 178, 0},
-            {2014, 179, 0},
-            {2014, 180, 0},
-            {2014, 181, 0},
-            {2014, 182, 0},
-            {2014, 183, 0},
-            {11, 184, 0},
-            {11, 185, 0},
-            {11, 186, 0},
-            {11, 187, 0},
-            {11, 188, 0},
-            {11, 189, 0},
-            {11, 190, 0},
-            {11, 191, 0},
-            {11, 192, 0},
-            {2046, 193, 0},
-            {3004, 194, 0},
-            {3004, 195, 0},
-            {9, 196, 0},
-            {9, 197, 0},
-            {9, 198, 0},
-            {2012, 199, 0},
-            {2001, 200, 0},
-            {2035, 201, 0},
-            {2035, 202, 0},
-            {2035, 203, 0},
-            {2035, 204, 0},
-            {2035, 205, 0},
-            {2035, 206, 0},
-            {2035, 207, 0},
-            {2035, 208, 0},
-            {2035, 209, 0},
-            {2035, 210, 0},
-            {2035, 211, 0},
-            {2035, 212, 0},
-            {2035, 213, 0},
-            {2035, 214, 0},
-            {2035, 215, 0},
-            {2035, 216, 0},
-            {2035, 217, 0},
-            {2035, 218, 0},
-            {2035, 219, 0},
-            {2035, 220, 0},
-            {2035, 221, 0},
-            {2035, 222, 0},
-            {2035, 223, 0},
-            {2035, 224, 0},
-            {2035, 225, 0},
-            {2035, 226, 0},
-            {2035, 227, 0},
-            {2035, 228, 0},
-            {2035, 229, 0},
-            {2035, 230, 0},
-            {2035, 231, 0},
-            {2035, 232, 0},
-            {15, 233, 0},
-            {24, 234, 0},
-            {24, 235, 0},
-            {12, 236, 0},
-            {24, 237, 0},
-            {10, 238, 0},
-            {15, 239, 0},
-            {24, 240, 0},
-            {12, 241, 0},
-            {24, 242, 0},
-            {10, 243, 0},
-            {15, 244, 0},
-            {10, 245, 0},
-            {24, 246, 0},
-            {10, 247, 0},
-            {24, 248, 0},
-            {10, 249, 0},
-            {12, 250, 0},
-            {12, 251, 0},
-            {12, 252, 0},
-            {15, 253, 0},
-        }},
-        {"Phobos Lab (E1M5)", {true, true, false}, {0, 0, 0}, 16, 293, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {5, 4, 0},
-            {2014, 5, 0},
-            {2014, 6, 0},
-            {2014, 7, 0},
-            {2015, 8, 0},
-            {2014, 9, 0},
-            {6, 10, 0},
-            {2019, 11, 0},
-            {2015, 12, 0},
-            {2015, 13, 0},
-            {2015, 14, 0},
-            {2012, 15, 0},
-            {2015, 16, 0},
-            {2014, 17, 0},
-            {2015, 18, 0},
-            {2012, 19, 0},
-            {2012, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {2015, 23, 0},
-            {2015, 24, 0},
-            {2045, 25, 0},
-            {35, 26, 0},
-            {35, 27, 0},
-            {3004, 28, 0},
-            {3004, 29, 0},
-            {9, 30, 0},
-            {9, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3004, 34, 0},
-            {3004, 35, 0},
-            {3004, 36, 0},
-            {3004, 37, 0},
-            {9, 38, 0},
-            {9, 39, 0},
-            {2025, 40, 0},
-            {2008, 41, 0},
-            {2007, 42, 0},
-            {3004, 43, 0},
-            {3004, 44, 0},
-            {3001, 45, 0},
-            {3001, 46, 0},
-            {3001, 47, 0},
-            {3001, 48, 0},
-            {3002, 49, 0},
-            {9, 50, 0},
-            {3004, 51, 0},
-            {9, 52, 0},
-            {9, 53, 0},
-            {3004, 54, 0},
-            {3002, 55, 0},
-            {9, 56, 0},
-            {3004, 57, 0},
-            {3004, 58, 0},
-            {2007, 59, 0},
-            {2003, 60, 0},
-            {2046, 61, 0},
-            {2008, 62, 0},
-            {2008, 63, 0},
-            {2008, 64, 0},
-            {58, 65, 0},
-            {9, 66, 0},
-            {3004, 67, 0},
-            {3004, 68, 0},
-            {3004, 69, 0},
-            {3004, 70, 0},
-            {3004, 71, 0},
-            {3004, 72, 0},
-            {3004, 73, 0},
-            {9, 74, 0},
-            {2001, 75, 0},
-            {2049, 76, 0},
-            {2008, 77, 0},
-            {9, 78, 0},
-            {3001, 79, 0},
-            {9, 80, 0},
-            {2008, 81, 0},
-            {2008, 82, 0},
-            {2001, 83, 0},
-            {2035, 84, 0},
-            {2035, 85, 0},
-            {2035, 86, 0},
-            {2035, 87, 0},
-            {2035, 88, 0},
-            {2035, 89, 0},
-            {2035, 90, 0},
-            {2035, 91, 0},
-            {2035, 92, 0},
-            {2035, 93, 0},
-            {2035, 94, 0},
-            {2035, 95, 0},
-            {2035, 96, 0},
-            {2035, 97, 0},
-            {2035, 98, 0},
-            {2035, 99, 0},
-            {2035, 100, 0},
-            {2035, 101, 0},
-            {3001, 102, 0},
-            {3001, 103, 0},
-            {3004, 104, 0},
-            {3004, 105, 0},
-            {3004, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {58, 109, 0},
-            {3001, 110, 0},
-            {3001, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {9, 115, 0},
-            {9, 116, 0},
-            {3002, 117, 0},
-            {3002, 118, 0},
-            {2035, 119, 0},
-            {2035, 120, 0},
-            {3002, 121, 0},
-            {9, 122, 0},
-            {9, 123, 0},
-            {3004, 124, 0},
-            {2008, 125, 0},
-            {3001, 126, 0},
-            {3002, 127, 0},
-            {3004, 128, 0},
-            {3004, 129, 0},
-            {3002, 130, 0},
-            {3002, 131, 0},
-            {3002, 132, 0},
-            {9, 133, 0},
-            {9, 134, 0},
-            {9, 135, 0},
-            {9, 136, 0},
-            {9, 137, 0},
-            {9, 138, 0},
-            {2011, 139, 0},
-            {2012, 140, 0},
-            {2012, 141, 0},
-            {2011, 142, 0},
-            {2011, 143, 0},
-            {2011, 144, 0},
-            {2011, 145, 0},
-            {2011, 146, 0},
-            {2011, 147, 0},
-            {2011, 148, 0},
-            {3004, 149, 0},
-            {3004, 150, 0},
-            {3004, 151, 0},
-            {9, 152, 0},
-            {9, 153, 0},
-            {9, 154, 0},
-            {9, 155, 0},
-            {9, 156, 0},
-            {9, 157, 0},
-            {9, 158, 0},
-            {9, 159, 0},
-            {2012, 160, 0},
-            {58, 161, 0},
-            {2008, 162, 0},
-            {2008, 163, 0},
-            {2008, 164, 0},
-            {2011, 165, 0},
-            {2011, 166, 0},
-            {2005, 167, 0},
-            {2003, 168, 0},
-            {2013, 169, 0},
-            {2015, 170, 0},
-            {2048, 171, 0},
-            {2015, 172, 0},
-            {2002, 173, 0},
-            {8, 174, 0},
-            {2011, 175, 0},
-            {2026, 176, 0},
-            {3002, 177, 0},
-            {3002, 178, 0},
-            {3002, 179, 0},
-            {58, 180, 0},
-            {2012, 181, 0},
-            {2012, 182, 0},
-            {2012, 183, 0},
-            {2012, 184, 0},
-            {2012, 185, 0},
-            {2012, 186, 0},
-            {2012, 187, 0},
-            {2012, 188, 0},
-            {2012, 189, 0},
-            {2012, 190, 0},
-            {2012, 191, 0},
-            {2012, 192, 0},
-            {2012, 193, 0},
-            {2012, 194, 0},
-            {2012, 195, 0},
-            {2012, 196, 0},
-            {2012, 197, 0},
-            {2012, 198, 0},
-            {2012, 199, 0},
-            {2012, 200, 0},
-            {2012, 201, 0},
-            {2012, 202, 0},
-            {2010, 203, 0},
-            {2010, 204, 0},
-            {2010, 205, 0},
-            {2019, 206, 0},
-            {2048, 207, 0},
-            {2001, 208, 0},
-            {2008, 209, 0},
-            {2035, 210, 0},
-            {2035, 211, 0},
-            {2015, 212, 0},
-            {2015, 213, 0},
-            {2015, 214, 0},
-            {2015, 215, 0},
-            {11, 216, 0},
-            {11, 217, 0},
-            {11, 218, 0},
-            {11, 219, 0},
-            {11, 220, 0},
-            {11, 221, 0},
-            {11, 222, 0},
-            {11, 223, 0},
-            {2011, 224, 0},
-            {2011, 225, 0},
-            {2011, 226, 0},
-            {2011, 227, 0},
-            {3001, 228, 0},
-            {3001, 229, 0},
-            {9, 230, 0},
-            {2008, 231, 0},
-            {2008, 232, 0},
-            {3001, 233, 0},
-            {3001, 234, 0},
-            {3001, 235, 0},
-            {3001, 236, 0},
-            {9, 237, 0},
-            {9, 238, 0},
-            {9, 239, 0},
-            {58, 240, 0},
-            {9, 241, 0},
-            {9, 242, 0},
-            {9, 243, 0},
-            {9, 244, 0},
-            {58, 245, 0},
-            {9, 246, 0},
-            {58, 247, 0},
-            {58, 248, 0},
-            {2035, 249, 0},
-            {2035, 250, 0},
-            {9, 251, 0},
-            {9, 252, 0},
-            {9, 253, 0},
-            {9, 254, 0},
-            {9, 255, 0},
-            {3001, 256, 0},
-            {3001, 257, 0},
-            {3001, 258, 0},
-            {3001, 259, 0},
-            {3001, 260, 0},
-            {3001, 261, 0},
-            {3001, 262, 0},
-            {3001, 263, 0},
-            {58, 264, 0},
-            {58, 265, 0},
-            {58, 266, 0},
-            {58, 267, 0},
-            {58, 268, 0},
-            {58, 269, 0},
-            {2008, 270, 0},
-            {2008, 271, 0},
-            {2008, 272, 0},
-            {2011, 273, 0},
-            {2011, 274, 0},
-            {2035, 275, 0},
-            {2035, 276, 0},
-            {2035, 277, 0},
-            {2035, 278, 0},
-            {2018, 279, 0},
-            {2018, 280, 0},
-            {14, 281, 0},
-            {2024, 282, 0},
-            {2046, 283, 0},
-            {2012, 284, 0},
-            {2012, 285, 0},
-            {2014, 286, 0},
-            {2014, 287, 0},
-            {2014, 288, 0},
-            {2014, 289, 0},
-            {2014, 290, 0},
-            {2014, 291, 0},
-            {2049, 292, 0},
-        }},
-        {"Central Processing (E1M6)", {true, true, true}, {0, 0, 0}, 19, 463, {
-            {2, 0, 0},
-            {3, 1, 0},
-            {4, 2, 0},
-            {1, 3, 0},
-            {2013, 4, 0},
-            {5, 5, 0},
-            {3001, 6, 0},
-            {3001, 7, 0},
-            {3002, 8, 0},
-            {13, 9, 0},
-            {6, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {9, 14, 0},
-            {9, 15, 0},
-            {3002, 16, 0},
-            {3002, 17, 0},
-            {3002, 18, 0},
-            {58, 19, 0},
-            {2035, 20, 0},
-            {2012, 21, 0},
-            {2024, 22, 0},
-            {2002, 23, 0},
-            {8, 24, 0},
-            {2035, 25, 0},
-            {2035, 26, 0},
-            {2035, 27, 0},
-            {2035, 28, 0},
-            {2035, 29, 0},
-            {2035, 30, 0},
-            {2035, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3001, 37, 0},
-            {3001, 38, 0},
-            {3001, 39, 0},
-            {58, 40, 0},
-            {58, 41, 0},
-            {58, 42, 0},
-            {58, 43, 0},
-            {9, 44, 0},
-            {9, 45, 0},
-            {9, 46, 0},
-            {9, 47, 0},
-            {9, 48, 0},
-            {3004, 49, 0},
-            {3004, 50, 0},
-            {3004, 51, 0},
-            {3004, 52, 0},
-            {3004, 53, 0},
-            {2012, 54, 0},
-            {2012, 55, 0},
-            {2008, 56, 0},
-            {2008, 57, 0},
-            {2048, 58, 0},
-            {2049, 59, 0},
-            {2008, 60, 0},
-            {2048, 61, 0},
-            {2048, 62, 0},
-            {2003, 63, 0},
-            {2001, 64, 0},
-            {2049, 65, 0},
-            {2012, 66, 0},
-            {2012, 67, 0},
-            {2011, 68, 0},
-            {2011, 69, 0},
-            {2011, 70, 0},
-            {2011, 71, 0},
-            {2011, 72, 0},
-            {2011, 73, 0},
-            {3004, 74, 0},
-            {3004, 75, 0},
-            {3004, 76, 0},
-            {9, 77, 0},
-            {9, 78, 0},
-            {58, 79, 0},
-            {2012, 80, 0},
-            {2019, 81, 0},
-            {2018, 82, 0},
-            {2011, 83, 0},
-            {2008, 84, 0},
-            {2015, 85, 0},
-            {2014, 86, 0},
-            {2015, 87, 0},
-            {9, 88, 0},
-            {3002, 89, 0},
-            {3002, 90, 0},
-            {58, 91, 0},
-            {3001, 92, 0},
-            {3001, 93, 0},
-            {3001, 94, 0},
-            {3001, 95, 0},
-            {3004, 96, 0},
-            {9, 97, 0},
-            {2008, 98, 0},
-            {2008, 99, 0},
-            {2008, 100, 0},
-            {2008, 101, 0},
-            {2008, 102, 0},
-            {2008, 103, 0},
-            {3001, 104, 0},
-            {3001, 105, 0},
-            {3001, 106, 0},
-            {3004, 107, 0},
-            {9, 108, 0},
-            {3001, 109, 0},
-            {3001, 110, 0},
-            {3001, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {9, 115, 0},
-            {9, 116, 0},
-            {9, 117, 0},
-            {9, 118, 0},
-            {2049, 119, 0},
-            {2008, 120, 0},
-            {2008, 121, 0},
-            {2048, 122, 0},
-            {8, 123, 0},
-            {2026, 124, 0},
-            {2008, 125, 0},
-            {2008, 126, 0},
-            {2008, 127, 0},
-            {2008, 128, 0},
-            {2046, 129, 0},
-            {2046, 130, 0},
-            {2024, 131, 0},
-            {2045, 132, 0},
-            {2015, 133, 0},
-            {2015, 134, 0},
-            {2014, 135, 0},
-            {2014, 136, 0},
-            {2015, 137, 0},
-            {2015, 138, 0},
-            {2014, 139, 0},
-            {2014, 140, 0},
-            {2014, 141, 0},
-            {2007, 142, 0},
-            {2007, 143, 0},
-            {2007, 144, 0},
-            {2025, 145, 0},
-            {2015, 146, 0},
-            {2015, 147, 0},
-            {2015, 148, 0},
-            {9, 149, 0},
-            {3004, 150, 0},
-            {9, 151, 0},
-            {2008, 152, 0},
-            {2008, 153, 0},
-            {2011, 154, 0},
-            {2011, 155, 0},
-            {3004, 156, 0},
-            {3004, 157, 0},
-            {9, 158, 0},
-            {9, 159, 0},
-            {2014, 160, 0},
-            {2015, 161, 0},
-            {2014, 162, 0},
-            {2015, 163, 0},
-            {2011, 164, 0},
-            {2011, 165, 0},
-            {2012, 166, 0},
-            {2011, 167, 0},
-            {58, 168, 0},
-            {3004, 169, 0},
-            {3004, 170, 0},
-            {3004, 171, 0},
-            {3004, 172, 0},
-            {9, 173, 0},
-            {9, 174, 0},
-            {2008, 175, 0},
-            {2008, 176, 0},
-            {2025, 177, 0},
-            {2012, 178, 0},
-            {2011, 179, 0},
-            {2048, 180, 0},
-            {3004, 181, 0},
-            {3004, 182, 0},
-            {3004, 183, 0},
-            {9, 184, 0},
-            {3002, 185, 0},
-            {9, 186, 0},
-            {9, 187, 0},
-            {9, 188, 0},
-            {3001, 189, 0},
-            {3001, 190, 0},
-            {2011, 191, 0},
-            {2012, 192, 0},
-            {2011, 193, 0},
-            {3001, 194, 0},
-            {3001, 195, 0},
-            {3001, 196, 0},
-            {2049, 197, 0},
-            {35, 198, 0},
-            {35, 199, 0},
-            {2028, 200, 0},
-            {2028, 201, 0},
-            {2028, 202, 0},
-            {2028, 203, 0},
-            {2028, 204, 0},
-            {2028, 205, 0},
-            {2028, 206, 0},
-            {2028, 207, 0},
-            {2028, 208, 0},
-            {2028, 209, 0},
-            {3001, 210, 0},
-            {3001, 211, 0},
-            {3001, 212, 0},
-            {3001, 213, 0},
-            {2018, 214, 0},
-            {2012, 215, 0},
-            {2012, 216, 0},
-            {2012, 217, 0},
-            {3001, 218, 0},
-            {3001, 219, 0},
-            {9, 220, 0},
-            {3004, 221, 0},
-            {3004, 222, 0},
-            {9, 223, 0},
-            {58, 224, 0},
-            {3002, 225, 0},
-            {2012, 226, 0},
-            {2011, 227, 0},
-            {2007, 228, 0},
-            {2007, 229, 0},
-            {2007, 230, 0},
-            {2008, 231, 0},
-            {2048, 232, 0},
-            {2035, 233, 0},
-            {2035, 234, 0},
-            {2035, 235, 0},
-            {2035, 236, 0},
-            {2035, 237, 0},
-            {3001, 238, 0},
-            {3001, 239, 0},
-            {3001, 240, 0},
-            {3001, 241, 0},
-            {3001, 242, 0},
-            {3002, 243, 0},
-            {3002, 244, 0},
-            {3002, 245, 0},
-            {3002, 246, 0},
-            {9, 247, 0},
-            {9, 248, 0},
-            {9, 249, 0},
-            {9, 250, 0},
-            {2035, 251, 0},
-            {2035, 252, 0},
-            {2035, 253, 0},
-            {9, 254, 0},
-            {9, 255, 0},
-            {2010, 256, 0},
-            {2008, 257, 0},
-            {2008, 258, 0},
-            {2007, 259, 0},
-            {2007, 260, 0},
-            {2007, 261, 0},
-            {2012, 262, 0},
-            {2011, 263, 0},
-            {2011, 264, 0},
-            {2011, 265, 0},
-            {48, 266, 0},
-            {48, 267, 0},
-            {48, 268, 0},
-            {58, 269, 0},
-            {58, 270, 0},
-            {58, 271, 0},
-            {2035, 272, 0},
-            {2012, 273, 0},
-            {2014, 274, 0},
-            {2014, 275, 0},
-            {2014, 276, 0},
-            {2014, 277, 0},
-            {2015, 278, 0},
-            {2015, 279, 0},
-            {2015, 280, 0},
-            {2015, 281, 0},
-            {2015, 282, 0},
-            {2015, 283, 0},
-            {2015, 284, 0},
-            {2015, 285, 0},
-            {2015, 286, 0},
-            {2015, 287, 0},
-            {2014, 288, 0},
-            {2014, 289, 0},
-            {2014, 290, 0},
-            {2018, 291, 0},
-            {3001, 292, 0},
-            {9, 293, 0},
-            {9, 294, 0},
-            {3002, 295, 0},
-            {3002, 296, 0},
-            {3002, 297, 0},
-            {3001, 298, 0},
-            {9, 299, 0},
-            {9, 300, 0},
-            {9, 301, 0},
-            {2008, 302, 0},
-            {2011, 303, 0},
-            {2014, 304, 0},
-            {2014, 305, 0},
-            {2014, 306, 0},
-            {2025, 307, 0},
-            {2014, 308, 0},
-            {2014, 309, 0},
-            {2015, 310, 0},
-            {2015, 311, 0},
-            {2015, 312, 0},
-            {2015, 313, 0},
-            {2015, 314, 0},
-            {2015, 315, 0},
-            {2015, 316, 0},
-            {2015, 317, 0},
-            {2015, 318, 0},
-            {2015, 319, 0},
-            {2015, 320, 0},
-            {2015, 321, 0},
-            {2015, 322, 0},
-            {2015, 323, 0},
-            {2015, 324, 0},
-            {2015, 325, 0},
-            {2015, 326, 0},
-            {2015, 327, 0},
-            {2015, 328, 0},
-            {2015, 329, 0},
-            {2015, 330, 0},
-            {2015, 331, 0},
-            {2015, 332, 0},
-            {2015, 333, 0},
-            {2015, 334, 0},
-            {2015, 335, 0},
-            {2015, 336, 0},
-            {2015, 337, 0},
-            {2015, 338, 0},
-            {2015, 339, 0},
-            {2015, 340, 0},
-            {2015, 341, 0},
-            {2015, 342, 0},
-            {2015, 343, 0},
-            {2015, 344, 0},
-            {2015, 345, 0},
-            {2015, 346, 0},
-            {2015, 347, 0},
-            {2015, 348, 0},
-            {2015, 349, 0},
-            {2015, 350, 0},
-            {2015, 351, 0},
-            {2015, 352, 0},
-            {2014, 353, 0},
-            {2014, 354, 0},
-            {2014, 355, 0},
-            {2014, 356, 0},
-            {2014, 357, 0},
-            {2014, 358, 0},
-            {2014, 359, 0},
-            {2014, 360, 0},
-            {2014, 361, 0},
-            {2014, 362, 0},
-            {2014, 363, 0},
-            {2014, 364, 0},
-            {2014, 365, 0},
-            {2014, 366, 0},
-            {3001, 367, 0},
-            {3001, 368, 0},
-            {3001, 369, 0},
-            {2012, 370, 0},
-            {2012, 371, 0},
-            {2012, 372, 0},
-            {2049, 373, 0},
-            {2049, 374, 0},
-            {2049, 375, 0},
-            {2035, 376, 0},
-            {2014, 377, 0},
-            {2014, 378, 0},
-            {2014, 379, 0},
-            {2014, 380, 0},
-            {2018, 381, 0},
-            {2011, 382, 0},
-            {2035, 383, 0},
-            {2035, 384, 0},
-            {3001, 385, 0},
-            {3001, 386, 0},
-            {3001, 387, 0},
-            {3001, 388, 0},
-            {3001, 389, 0},
-            {2012, 390, 0},
-            {2012, 391, 0},
-            {2013, 392, 0},
-            {2049, 393, 0},
-            {2048, 394, 0},
-            {8, 395, 0},
-            {2014, 396, 0},
-            {2014, 397, 0},
-            {2014, 398, 0},
-            {2014, 399, 0},
-            {2014, 400, 0},
-            {2046, 401, 0},
-            {2046, 402, 0},
-            {58, 403, 0},
-            {2035, 404, 0},
-            {2035, 405, 0},
-            {2035, 406, 0},
-            {2035, 407, 0},
-            {58, 408, 0},
-            {58, 409, 0},
-            {58, 410, 0},
-            {9, 411, 0},
-            {9, 412, 0},
-            {9, 413, 0},
-            {9, 414, 0},
-            {3002, 415, 0},
-            {3001, 416, 0},
-            {2012, 417, 0},
-            {2012, 418, 0},
-            {2008, 419, 0},
-            {2008, 420, 0},
-            {2010, 421, 0},
-            {58, 422, 0},
-            {58, 423, 0},
-            {58, 424, 0},
-            {3001, 425, 0},
-            {3001, 426, 0},
-            {3001, 427, 0},
-            {3001, 428, 0},
-            {9, 429, 0},
-            {9, 430, 0},
-            {9, 431, 0},
-            {3002, 432, 0},
-            {3002, 433, 0},
-            {3002, 434, 0},
-            {3002, 435, 0},
-            {9, 436, 0},
-            {9, 437, 0},
-            {9, 438, 0},
-            {58, 439, 0},
-            {58, 440, 0},
-            {58, 441, 0},
-            {2012, 442, 0},
-            {2012, 443, 0},
-            {2049, 444, 0},
-            {9, 445, 0},
-            {9, 446, 0},
-            {9, 447, 0},
-            {9, 448, 0},
-            {9, 449, 0},
-            {9, 450, 0},
-            {9, 451, 0},
-            {11, 452, 0},
-            {11, 453, 0},
-            {11, 454, 0},
-            {11, 455, 0},
-            {11, 456, 0},
-            {11, 457, 0},
-            {11, 458, 0},
-            {11, 459, 0},
-            {11, 460, 0},
-            {11, 461, 0},
-            {11, 462, 0},
-        }},
-        {"Computer Station (E1M7)", {true, true, true}, {0, 0, 0}, 15, 358, {
-            {3, 0, 0},
-            {2, 1, 0},
-            {4, 2, 0},
-            {1, 3, 0},
-            {2028, 4, 0},
-            {2028, 5, 0},
-            {2028, 6, 0},
-            {2028, 7, 0},
-            {2028, 8, 0},
-            {2028, 9, 0},
-            {2028, 10, 0},
-            {9, 11, 0},
-            {9, 12, 0},
-            {9, 13, 0},
-            {9, 14, 0},
-            {2012, 15, 0},
-            {2049, 16, 0},
-            {2048, 17, 0},
-            {2002, 18, 0},
-            {2048, 19, 0},
-            {2026, 20, 0},
-            {2013, 21, 0},
-            {2025, 22, 0},
-            {2028, 23, 0},
-            {2028, 24, 0},
-            {6, 25, 0},
-            {5, 26, 0},
-            {13, 27, 0},
-            {9, 28, 0},
-            {9, 29, 0},
-            {9, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {2049, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {9, 37, 0},
-            {9, 38, 0},
-            {2048, 39, 0},
-            {9, 40, 0},
-            {2007, 41, 0},
-            {2007, 42, 0},
-            {2008, 43, 0},
-            {9, 44, 0},
-            {3002, 45, 0},
-            {3001, 46, 0},
-            {3002, 47, 0},
-            {2008, 48, 0},
-            {2008, 49, 0},
-            {3001, 50, 0},
-            {3004, 51, 0},
-            {9, 52, 0},
-            {2005, 53, 0},
-            {2028, 54, 0},
-            {2028, 55, 0},
-            {2028, 56, 0},
-            {2028, 57, 0},
-            {2028, 58, 0},
-            {2028, 59, 0},
-            {3001, 60, 0},
-            {3001, 61, 0},
-            {3004, 62, 0},
-            {3004, 63, 0},
-            {9, 64, 0},
-            {9, 65, 0},
-            {9, 66, 0},
-            {9, 67, 0},
-            {9, 68, 0},
-            {9, 69, 0},
-            {2008, 70, 0},
-            {2008, 71, 0},
-            {2011, 72, 0},
-            {2012, 73, 0},
-            {3001, 74, 0},
-            {9, 75, 0},
-            {9, 76, 0},
-            {3001, 77, 0},
-            {3004, 78, 0},
-            {9, 79, 0},
-            {9, 80, 0},
-            {3001, 81, 0},
-            {3004, 82, 0},
-            {3004, 83, 0},
-            {3004, 84, 0},
-            {3004, 85, 0},
-            {3004, 86, 0},
-            {2001, 87, 0},
-            {3004, 88, 0},
-            {3004, 89, 0},
-            {3001, 90, 0},
-            {3001, 91, 0},
-            {3001, 92, 0},
-            {3004, 93, 0},
-            {3004, 94, 0},
-            {3004, 95, 0},
-            {3004, 96, 0},
-            {3004, 97, 0},
-            {3004, 98, 0},
-            {3004, 99, 0},
-            {9, 100, 0},
-            {2011, 101, 0},
-            {2011, 102, 0},
-            {3004, 103, 0},
-            {3004, 104, 0},
-            {3004, 105, 0},
-            {3004, 106, 0},
-            {3004, 107, 0},
-            {3004, 108, 0},
-            {2046, 109, 0},
-            {2012, 110, 0},
-            {2012, 111, 0},
-            {2035, 112, 0},
-            {2035, 113, 0},
-            {2035, 114, 0},
-            {2035, 115, 0},
-            {2035, 116, 0},
-            {2035, 117, 0},
-            {2035, 118, 0},
-            {2035, 119, 0},
-            {48, 120, 0},
-            {48, 121, 0},
-            {2001, 122, 0},
-            {2008, 123, 0},
-            {2008, 124, 0},
-            {3004, 125, 0},
-            {3004, 126, 0},
-            {3004, 127, 0},
-            {3004, 128, 0},
-            {3001, 129, 0},
-            {3001, 130, 0},
-            {3001, 131, 0},
-            {3001, 132, 0},
-            {3001, 133, 0},
-            {3001, 134, 0},
-            {9, 135, 0},
-            {9, 136, 0},
-            {9, 137, 0},
-            {2007, 138, 0},
-            {2007, 139, 0},
-            {2049, 140, 0},
-            {2010, 141, 0},
-            {2010, 142, 0},
-            {2011, 143, 0},
-            {2011, 144, 0},
-            {3004, 145, 0},
-            {3004, 146, 0},
-            {9, 147, 0},
-            {3004, 148, 0},
-            {3004, 149, 0},
-            {2011, 150, 0},
-            {35, 151, 0},
-            {2008, 152, 0},
-            {3001, 153, 0},
-            {3001, 154, 0},
-            {3001, 155, 0},
-            {9, 156, 0},
-            {9, 157, 0},
-            {9, 158, 0},
-            {2011, 159, 0},
-            {2007, 160, 0},
-            {3001, 161, 0},
-            {3001, 162, 0},
-            {9, 163, 0},
-            {9, 164, 0},
-            {3004, 165, 0},
-            {3004, 166, 0},
-            {3004, 167, 0},
-            {9, 168, 0},
-            {3004, 169, 0},
-            {3004, 170, 0},
-            {3001, 171, 0},
-            {3001, 172, 0},
-            {3001, 173, 0},
-            {2011, 174, 0},
-            {2011, 175, 0},
-            {3001, 176, 0},
-            {3001, 177, 0},
-            {3004, 178, 0},
-            {3004, 179, 0},
-            {3004, 180, 0},
-            {3004, 181, 0},
-            {3004, 182, 0},
-            {2035, 183, 0},
-            {2035, 184, 0},
-            {2035, 185, 0},
-            {2035, 186, 0},
-            {2035, 187, 0},
-            {2008, 188, 0},
-            {2008, 189, 0},
-            {3001, 190, 0},
-            {3001, 191, 0},
-            {3001, 192, 0},
-            {2012, 193, 0},
-            {2012, 194, 0},
-            {2012, 195, 0},
-            {3001, 196, 0},
-            {3001, 197, 0},
-            {3001, 198, 0},
-            {2012, 199, 0},
-            {2012, 200, 0},
-            {3002, 201, 0},
-            {9, 202, 0},
-            {3004, 203, 0},
-            {3004, 204, 0},
-            {3002, 205, 0},
-            {3002, 206, 0},
-            {2012, 207, 0},
-            {9, 208, 0},
-            {9, 209, 0},
-            {9, 210, 0},
-            {3004, 211, 0},
-            {3004, 212, 0},
-            {3004, 213, 0},
-            {3002, 214, 0},
-            {2048, 215, 0},
-            {9, 216, 0},
-            {9, 217, 0},
-            {9, 218, 0},
-            {3002, 219, 0},
-            {2048, 220, 0},
-            {2035, 221, 0},
-            {2035, 222, 0},
-            {2035, 223, 0},
-            {2035, 224, 0},
-            {2011, 225, 0},
-            {3001, 226, 0},
-            {2035, 227, 0},
-            {2014, 228, 0},
-            {2014, 229, 0},
-            {2014, 230, 0},
-            {2015, 231, 0},
-            {2015, 232, 0},
-            {2015, 233, 0},
-            {2015, 234, 0},
-            {2015, 235, 0},
-            {2015, 236, 0},
-            {2015, 237, 0},
-            {2015, 238, 0},
-            {2015, 239, 0},
-            {2015, 240, 0},
-            {2015, 241, 0},
-            {2015, 242, 0},
-            {2014, 243, 0},
-            {2014, 244, 0},
-            {2015, 245, 0},
-            {2015, 246, 0},
-            {2015, 247, 0},
-            {2015, 248, 0},
-            {2015, 249, 0},
-            {2015, 250, 0},
-            {2015, 251, 0},
-            {2015, 252, 0},
-            {2015, 253, 0},
-            {2015, 254, 0},
-            {2015, 255, 0},
-            {2015, 256, 0},
-            {2015, 257, 0},
-            {2014, 258, 0},
-            {2014, 259, 0},
-            {2014, 260, 0},
-            {2014, 261, 0},
-            {2014, 262, 0},
-            {2015, 263, 0},
-            {2015, 264, 0},
-            {2014, 265, 0},
-            {2014, 266, 0},
-            {2014, 267, 0},
-            {2014, 268, 0},
-            {2014, 269, 0},
-            {2014, 270, 0},
-            {2014, 271, 0},
-            {2014, 272, 0},
-            {2014, 273, 0},
-            {2015, 274, 0},
-            {2015, 275, 0},
-            {2015, 276, 0},
-            {2015, 277, 0},
-            {2015, 278, 0},
-            {2015, 279, 0},
-            {2015, 280, 0},
-            {2014, 281, 0},
-            {2014, 282, 0},
-            {2015, 283, 0},
-            {2015, 284, 0},
-            {2015, 285, 0},
-            {2014, 286, 0},
-            {2014, 287, 0},
-            {2014, 288, 0},
-            {2014, 289, 0},
-            {2014, 290, 0},
-            {2014, 291, 0},
-            {2014, 292, 0},
-            {2014, 293, 0},
-            {2014, 294, 0},
-            {2014, 295, 0},
-            {2014, 296, 0},
-            {2014, 297, 0},
-            {2015, 298, 0},
-            {2015, 299, 0},
-            {2015, 300, 0},
-            {2015, 301, 0},
-            {2015, 302, 0},
-            {2015, 303, 0},
-            {2015, 304, 0},
-            {2015, 305, 0},
-            {2015, 306, 0},
-            {2015, 307, 0},
-            {2015, 308, 0},
-            {2003, 309, 0},
-            {2018, 310, 0},
-            {2018, 311, 0},
-            {2019, 312, 0},
-            {2046, 313, 0},
-            {8, 314, 0},
-            {2035, 315, 0},
-            {2035, 316, 0},
-            {9, 317, 0},
-            {9, 318, 0},
-            {58, 319, 0},
-            {3001, 320, 0},
-            {2008, 321, 0},
-            {2008, 322, 0},
-            {9, 323, 0},
-            {9, 324, 0},
-            {9, 325, 0},
-            {9, 326, 0},
-            {9, 327, 0},
-            {9, 328, 0},
-            {9, 329, 0},
-            {9, 330, 0},
-            {9, 331, 0},
-            {9, 332, 0},
-            {9, 333, 0},
-            {9, 334, 0},
-            {9, 335, 0},
-            {9, 336, 0},
-            {2024, 337, 0},
-            {2012, 338, 0},
-            {2012, 339, 0},
-            {2012, 340, 0},
-            {2012, 341, 0},
-            {2012, 342, 0},
-            {2012, 343, 0},
-            {2012, 344, 0},
-            {2019, 345, 0},
-            {2028, 346, 0},
-            {2028, 347, 0},
-            {11, 348, 0},
-            {11, 349, 0},
-            {11, 350, 0},
-            {11, 351, 0},
-            {11, 352, 0},
-            {11, 353, 0},
-            {11, 354, 0},
-            {11, 355, 0},
-            {11, 356, 0},
-            {11, 357, 0},
-        }},
-        {"Phobos Anomaly (E1M8)", {false, false, false}, {0, 0, 0}, 7, 126, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {2011, 4, 0},
-            {2011, 5, 0},
-            {3002, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3002, 9, 0},
-            {3002, 10, 0},
-            {3002, 11, 0},
-            {3002, 12, 0},
-            {3002, 13, 0},
-            {3002, 14, 0},
-            {2013, 15, 0},
-            {2011, 16, 0},
-            {2011, 17, 0},
-            {2011, 18, 0},
-            {2011, 19, 0},
-            {2011, 20, 0},
-            {2011, 21, 0},
-            {2011, 22, 0},
-            {2011, 23, 0},
-            {2035, 24, 0},
-            {2035, 25, 0},
-            {2035, 26, 0},
-            {2035, 27, 0},
-            {2035, 28, 0},
-            {2035, 29, 0},
-            {2035, 30, 0},
-            {2035, 31, 0},
-            {2035, 32, 0},
-            {2035, 33, 0},
-            {2035, 34, 0},
-            {2035, 35, 0},
-            {2035, 36, 0},
-            {2035, 37, 0},
-            {2035, 38, 0},
-            {2035, 39, 0},
-            {2035, 40, 0},
-            {2035, 41, 0},
-            {2035, 42, 0},
-            {2035, 43, 0},
-            {3002, 44, 0},
-            {3002, 45, 0},
-            {3002, 46, 0},
-            {3002, 47, 0},
-            {3002, 48, 0},
-            {2001, 49, 0},
-            {2049, 50, 0},
-            {2049, 51, 0},
-            {2001, 52, 0},
-            {2018, 53, 0},
-            {2012, 54, 0},
-            {2011, 55, 0},
-            {46, 56, 0},
-            {46, 57, 0},
-            {3003, 58, 0},
-            {3003, 59, 0},
-            {2049, 60, 0},
-            {2048, 61, 0},
-            {2048, 62, 0},
-            {2048, 63, 0},
-            {2048, 64, 0},
-            {2002, 65, 0},
-            {2049, 66, 0},
-            {2012, 67, 0},
-            {2048, 68, 0},
-            {2012, 69, 0},
-            {2024, 70, 0},
-            {2035, 71, 0},
-            {2035, 72, 0},
-            {2035, 73, 0},
-            {2035, 74, 0},
-            {2035, 75, 0},
-            {2035, 76, 0},
-            {58, 77, 0},
-            {58, 78, 0},
-            {58, 79, 0},
-            {58, 80, 0},
-            {58, 81, 0},
-            {58, 82, 0},
-            {58, 83, 0},
-            {58, 84, 0},
-            {58, 85, 0},
-            {58, 86, 0},
-            {2048, 87, 0},
-            {46, 88, 0},
-            {46, 89, 0},
-            {46, 90, 0},
-            {46, 91, 0},
-            {2035, 92, 0},
-            {2035, 93, 0},
-            {2026, 94, 0},
-            {2048, 95, 0},
-            {11, 96, 0},
-            {11, 97, 0},
-            {11, 98, 0},
-            {11, 99, 0},
-            {11, 100, 0},
-            {11, 101, 0},
-            {11, 102, 0},
-            {11, 103, 0},
-            {11, 104, 0},
-            {14, 105, 0},
-            {3002, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {3001, 109, 0},
-            {3001, 110, 0},
-            {9, 111, 0},
-            {9, 112, 0},
-            {2048, 113, 0},
-            {2048, 114, 0},
-            {2048, 115, 0},
-            {2048, 116, 0},
-            {2048, 117, 0},
-            {3002, 118, 0},
-            {3002, 119, 0},
-            {3002, 120, 0},
-            {3001, 121, 0},
-            {3001, 122, 0},
-            {3001, 123, 0},
-            {9, 124, 0},
-            {9, 125, 0},
-        }},
-        {"Military Base (E1M9)", {true, true, true}, {0, 0, 0}, 9, 237, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3001, 4, 0},
-            {3001, 5, 0},
-            {3001, 6, 0},
-            {3001, 7, 0},
-            {3001, 8, 0},
-            {3001, 9, 0},
-            {3001, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {6, 13, 0},
-            {9, 14, 0},
-            {9, 15, 0},
-            {3001, 16, 0},
-            {3001, 17, 0},
-            {3002, 18, 0},
-            {3002, 19, 0},
-            {13, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {9, 25, 0},
-            {9, 26, 0},
-            {9, 27, 0},
-            {9, 28, 0},
-            {9, 29, 0},
-            {2011, 30, 0},
-            {2011, 31, 0},
-            {2008, 32, 0},
-            {2007, 33, 0},
-            {2007, 34, 0},
-            {2035, 35, 0},
-            {2035, 36, 0},
-            {3002, 37, 0},
-            {3002, 38, 0},
-            {3002, 39, 0},
-            {3002, 40, 0},
-            {3002, 41, 0},
-            {3002, 42, 0},
-            {3002, 43, 0},
-            {3002, 44, 0},
-            {2049, 45, 0},
-            {2048, 46, 0},
-            {2012, 47, 0},
-            {2028, 48, 0},
-            {2028, 49, 0},
-            {35, 50, 0},
-            {3001, 51, 0},
-            {3001, 52, 0},
-            {3001, 53, 0},
-            {9, 54, 0},
-            {9, 55, 0},
-            {9, 56, 0},
-            {9, 57, 0},
-            {9, 58, 0},
-            {2035, 59, 0},
-            {2035, 60, 0},
-            {2035, 61, 0},
-            {2035, 62, 0},
-            {2035, 63, 0},
-            {2035, 64, 0},
-            {2035, 65, 0},
-            {2035, 66, 0},
-            {2035, 67, 0},
-            {2035, 68, 0},
-            {2035, 69, 0},
-            {2035, 70, 0},
-            {2014, 71, 0},
-            {2014, 72, 0},
-            {2014, 73, 0},
-            {2014, 74, 0},
-            {2014, 75, 0},
-            {2014, 76, 0},
-            {2015, 77, 0},
-            {2015, 78, 0},
-            {2015, 79, 0},
-            {2015, 80, 0},
-            {2015, 81, 0},
-            {2015, 82, 0},
-            {46, 83, 0},
-            {46, 84, 0},
-            {46, 85, 0},
-            {46, 86, 0},
-            {2002, 87, 0},
-            {2048, 88, 0},
-            {2048, 89, 0},
-            {2048, 90, 0},
-            {2048, 91, 0},
-            {2011, 92, 0},
-            {2011, 93, 0},
-            {2035, 94, 0},
-            {2015, 95, 0},
-            {2015, 96, 0},
-            {2015, 97, 0},
-            {2015, 98, 0},
-            {2015, 99, 0},
-            {3004, 100, 0},
-            {3004, 101, 0},
-            {3004, 102, 0},
-            {3004, 103, 0},
-            {9, 104, 0},
-            {9, 105, 0},
-            {9, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {9, 109, 0},
-            {9, 110, 0},
-            {9, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {2012, 115, 0},
-            {2024, 116, 0},
-            {11, 117, 0},
-            {2015, 118, 0},
-            {2015, 119, 0},
-            {2015, 120, 0},
-            {2015, 121, 0},
-            {2014, 122, 0},
-            {2014, 123, 0},
-            {2014, 124, 0},
-            {2014, 125, 0},
-            {48, 126, 0},
-            {48, 127, 0},
-            {2035, 128, 0},
-            {2035, 129, 0},
-            {2035, 130, 0},
-            {2015, 131, 0},
-            {2015, 132, 0},
-            {2015, 133, 0},
-            {2015, 134, 0},
-            {2015, 135, 0},
-            {2015, 136, 0},
-            {2015, 137, 0},
-            {2015, 138, 0},
-            {2018, 139, 0},
-            {3001, 140, 0},
-            {3004, 141, 0},
-            {9, 142, 0},
-            {9, 143, 0},
-            {9, 144, 0},
-            {58, 145, 0},
-            {58, 146, 0},
-            {2035, 147, 0},
-            {2035, 148, 0},
-            {34, 149, 0},
-            {34, 150, 0},
-            {34, 151, 0},
-            {34, 152, 0},
-            {34, 153, 0},
-            {34, 154, 0},
-            {34, 155, 0},
-            {14, 156, 0},
-            {3001, 157, 0},
-            {3001, 158, 0},
-            {3001, 159, 0},
-            {3001, 160, 0},
-            {3001, 161, 0},
-            {3002, 162, 0},
-            {3002, 163, 0},
-            {3002, 164, 0},
-            {3002, 165, 0},
-            {3002, 166, 0},
-            {58, 167, 0},
-            {58, 168, 0},
-            {58, 169, 0},
-            {58, 170, 0},
-            {58, 171, 0},
-            {2003, 172, 0},
-            {2046, 173, 0},
-            {2012, 174, 0},
-            {2012, 175, 0},
-            {9, 176, 0},
-            {9, 177, 0},
-            {9, 178, 0},
-            {9, 179, 0},
-            {3001, 180, 0},
-            {3001, 181, 0},
-            {3001, 182, 0},
-            {2012, 183, 0},
-            {2028, 184, 0},
-            {2028, 185, 0},
-            {2007, 186, 0},
-            {2007, 187, 0},
-            {5, 188, 0},
-            {2011, 189, 0},
-            {2011, 190, 0},
-            {2028, 191, 0},
-            {3001, 192, 0},
-            {3001, 193, 0},
-            {3001, 194, 0},
-            {3001, 195, 0},
-            {3001, 196, 0},
-            {3001, 197, 0},
-            {58, 198, 0},
-            {58, 199, 0},
-            {58, 200, 0},
-            {58, 201, 0},
-            {3001, 202, 0},
-            {3001, 203, 0},
-            {9, 204, 0},
-            {9, 205, 0},
-            {3001, 206, 0},
-            {3001, 207, 0},
-            {58, 208, 0},
-            {58, 209, 0},
-            {58, 210, 0},
-            {2014, 211, 0},
-            {2014, 212, 0},
-            {2014, 213, 0},
-            {2014, 214, 0},
-            {2014, 215, 0},
-            {2014, 216, 0},
-            {2015, 217, 0},
-            {2015, 218, 0},
-            {2015, 219, 0},
-            {2015, 220, 0},
-            {2012, 221, 0},
-            {8, 222, 0},
-            {2001, 223, 0},
-            {2049, 224, 0},
-            {2005, 225, 0},
-            {2046, 226, 0},
-            {2048, 227, 0},
-            {11, 228, 0},
-            {11, 229, 0},
-            {11, 230, 0},
-            {11, 231, 0},
-            {11, 232, 0},
-            {11, 233, 0},
-            {11, 234, 0},
-            {11, 235, 0},
-            {11, 236, 0},
-        }},
-    },
-    {
-        {"Deimos Anomaly (E2M1)", {true, false, true}, {0, 0, 0}, 8, 127, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3004, 4, 0},
-            {3004, 5, 0},
-            {3004, 6, 0},
-            {3004, 7, 0},
-            {3004, 8, 0},
-            {3001, 9, 0},
-            {3001, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3004, 15, 0},
-            {9, 16, 0},
-            {3001, 17, 0},
-            {3001, 18, 0},
-            {9, 19, 0},
-            {9, 20, 0},
-            {3001, 21, 0},
-            {3004, 22, 0},
-            {3004, 23, 0},
-            {3004, 24, 0},
-            {9, 25, 0},
-            {9, 26, 0},
-            {3002, 27, 0},
-            {3002, 28, 0},
-            {3002, 29, 0},
-            {2014, 30, 0},
-            {2014, 31, 0},
-            {2014, 32, 0},
-            {2014, 33, 0},
-            {2015, 34, 0},
-            {2015, 35, 0},
-            {2015, 36, 0},
-            {2015, 37, 0},
-            {2014, 38, 0},
-            {2014, 39, 0},
-            {2015, 40, 0},
-            {2014, 41, 0},
-            {2015, 42, 0},
-            {2014, 43, 0},
-            {2004, 44, 0},
-            {2047, 45, 0},
-            {9, 46, 0},
-            {9, 47, 0},
-            {9, 48, 0},
-            {9, 49, 0},
-            {3001, 50, 0},
-            {5, 51, 0},
-            {14, 52, 0},
-            {14, 53, 0},
-            {2001, 54, 0},
-            {14, 55, 0},
-            {14, 56, 0},
-            {2018, 57, 0},
-            {2049, 58, 0},
-            {3002, 59, 0},
-            {3002, 60, 0},
-            {3002, 61, 0},
-            {3002, 62, 0},
-            {3002, 63, 0},
-            {2012, 64, 0},
-            {14, 65, 0},
-            {2012, 66, 0},
-            {2015, 67, 0},
-            {14, 68, 0},
-            {14, 69, 0},
-            {14, 70, 0},
-            {14, 71, 0},
-            {14, 72, 0},
-            {3001, 73, 0},
-            {14, 74, 0},
-            {14, 75, 0},
-            {14, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3002, 79, 0},
-            {3001, 80, 0},
-            {3005, 81, 0},
-            {2007, 82, 0},
-            {13, 83, 0},
-            {2026, 84, 0},
-            {2011, 85, 0},
-            {2019, 86, 0},
-            {2011, 87, 0},
-            {9, 88, 0},
-            {2012, 89, 0},
-            {2048, 90, 0},
-            {2008, 91, 0},
-            {2008, 92, 0},
-            {2008, 93, 0},
-            {2011, 94, 0},
-            {2011, 95, 0},
-            {2012, 96, 0},
-            {2012, 97, 0},
-            {2012, 98, 0},
-            {2001, 99, 0},
-            {3004, 100, 0},
-            {3004, 101, 0},
-            {3004, 102, 0},
-            {3006, 103, 0},
-            {3005, 104, 0},
-            {3002, 105, 0},
-            {3002, 106, 0},
-            {3004, 107, 0},
-            {3004, 108, 0},
-            {34, 109, 0},
-            {34, 110, 0},
-            {34, 111, 0},
-            {34, 112, 0},
-            {34, 113, 0},
-            {34, 114, 0},
-            {34, 115, 0},
-            {2011, 116, 0},
-            {2012, 117, 0},
-            {2012, 118, 0},
-            {3004, 119, 0},
-            {2007, 120, 0},
-            {11, 121, 0},
-            {11, 122, 0},
-            {11, 123, 0},
-            {11, 124, 0},
-            {3005, 125, 0},
-            {58, 126, 0},
-        }},
-        {"Containment Area (E2M2)", {true, true, true}, {0, 0, 0}, 19, 311, {
-            {2012, 0, 0},
-            {2014, 1, 0},
-            {1, 2, 0},
-            {2, 3, 0},
-            {3, 4, 0},
-            {4, 5, 0},
-            {3002, 6, 0},
-            {3002, 7, 0},
-            {2002, 8, 0},
-            {2018, 9, 0},
-            {2007, 10, 0},
-            {2007, 11, 0},
-            {2007, 12, 0},
-            {2007, 13, 0},
-            {2014, 14, 0},
-            {2014, 15, 0},
-            {2015, 16, 0},
-            {2015, 17, 0},
-            {2014, 18, 0},
-            {2007, 19, 0},
-            {2018, 20, 0},
-            {2015, 21, 0},
-            {2014, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3001, 25, 0},
-            {3001, 26, 0},
-            {3001, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {2007, 34, 0},
-            {2008, 35, 0},
-            {2007, 36, 0},
-            {3001, 37, 0},
-            {3001, 38, 0},
-            {3001, 39, 0},
-            {3001, 40, 0},
-            {3001, 41, 0},
-            {3001, 42, 0},
-            {3001, 43, 0},
-            {3001, 44, 0},
-            {3001, 45, 0},
-            {3001, 46, 0},
-            {3001, 47, 0},
-            {3001, 48, 0},
-            {3001, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {3001, 52, 0},
-            {3001, 53, 0},
-            {2028, 54, 0},
-            {2028, 55, 0},
-            {2028, 56, 0},
-            {2028, 57, 0},
-            {2028, 58, 0},
-            {2028, 59, 0},
-            {2028, 60, 0},
-            {2028, 61, 0},
-            {2028, 62, 0},
-            {2028, 63, 0},
-            {2028, 64, 0},
-            {2028, 65, 0},
-            {8, 66, 0},
-            {3001, 67, 0},
-            {3001, 68, 0},
-            {3002, 69, 0},
-            {3001, 70, 0},
-            {2008, 71, 0},
-            {2014, 72, 0},
-            {2015, 73, 0},
-            {2007, 74, 0},
-            {2008, 75, 0},
-            {2008, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {2013, 80, 0},
-            {2005, 81, 0},
-            {3001, 82, 0},
-            {3001, 83, 0},
-            {3001, 84, 0},
-            {3002, 85, 0},
-            {2008, 86, 0},
-            {2012, 87, 0},
-            {2015, 88, 0},
-            {2014, 89, 0},
-            {3001, 90, 0},
-            {3001, 91, 0},
-            {3001, 92, 0},
-            {3002, 93, 0},
-            {3001, 94, 0},
-            {3001, 95, 0},
-            {3001, 96, 0},
-            {2014, 97, 0},
-            {2015, 98, 0},
-            {2014, 99, 0},
-            {2018, 100, 0},
-            {2012, 101, 0},
-            {3001, 102, 0},
-            {3001, 103, 0},
-            {3001, 104, 0},
-            {3001, 105, 0},
-            {3001, 106, 0},
-            {3002, 107, 0},
-            {2007, 108, 0},
-            {2026, 109, 0},
-            {2012, 110, 0},
-            {2046, 111, 0},
-            {2012, 112, 0},
-            {2014, 113, 0},
-            {2008, 114, 0},
-            {2007, 115, 0},
-            {2011, 116, 0},
-            {2014, 117, 0},
-            {2011, 118, 0},
-            {3001, 119, 0},
-            {3001, 120, 0},
-            {2008, 121, 0},
-            {2007, 122, 0},
-            {17, 123, 0},
-            {2010, 124, 0},
-            {2019, 125, 0},
-            {2011, 126, 0},
-            {2004, 127, 0},
-            {3001, 128, 0},
-            {3001, 129, 0},
-            {3001, 130, 0},
-            {3001, 131, 0},
-            {3001, 132, 0},
-            {3002, 133, 0},
-            {3002, 134, 0},
-            {3006, 135, 0},
-            {3006, 136, 0},
-            {2048, 137, 0},
-            {2003, 138, 0},
-            {2046, 139, 0},
-            {2014, 140, 0},
-            {2014, 141, 0},
-            {2015, 142, 0},
-            {5, 143, 0},
-            {6, 144, 0},
-            {2015, 145, 0},
-            {2010, 146, 0},
-            {2011, 147, 0},
-            {2048, 148, 0},
-            {2014, 149, 0},
-            {2014, 150, 0},
-            {2048, 151, 0},
-            {2011, 152, 0},
-            {13, 153, 0},
-            {3001, 154, 0},
-            {3002, 155, 0},
-            {3001, 156, 0},
-            {3001, 157, 0},
-            {3001, 158, 0},
-            {3001, 159, 0},
-            {2001, 160, 0},
-            {2001, 161, 0},
-            {2049, 162, 0},
-            {2049, 163, 0},
-            {2049, 164, 0},
-            {2018, 165, 0},
-            {2035, 166, 0},
-            {2035, 167, 0},
-            {2007, 168, 0},
-            {2012, 169, 0},
-            {2049, 170, 0},
-            {2025, 171, 0},
-            {2025, 172, 0},
-            {2025, 173, 0},
-            {2035, 174, 0},
-            {2008, 175, 0},
-            {2014, 176, 0},
-            {2014, 177, 0},
-            {2014, 178, 0},
-            {3002, 179, 0},
-            {3001, 180, 0},
-            {3001, 181, 0},
-            {2048, 182, 0},
-            {2008, 183, 0},
-            {2011, 184, 0},
-            {2011, 185, 0},
-            {2011, 186, 0},
-            {2011, 187, 0},
-            {2011, 188, 0},
-            {2011, 189, 0},
-            {2011, 190, 0},
-            {2011, 191, 0},
-            {2012, 192, 0},
-            {2011, 193, 0},
-            {2011, 194, 0},
-            {2011, 195, 0},
-            {2014, 196, 0},
-            {2014, 197, 0},
-            {2014, 198, 0},
-            {58, 199, 0},
-            {2007, 200, 0},
-            {2007, 201, 0},
-            {58, 202, 0},
-            {3002, 203, 0},
-            {2007, 204, 0},
-            {2008, 205, 0},
-            {3002, 206, 0},
-            {3001, 207, 0},
-            {3001, 208, 0},
-            {3001, 209, 0},
-            {3001, 210, 0},
-            {3001, 211, 0},
-            {2008, 212, 0},
-            {2007, 213, 0},
-            {2049, 214, 0},
-            {2011, 215, 0},
-            {2011, 216, 0},
-            {2011, 217, 0},
-            {3001, 218, 0},
-            {3001, 219, 0},
-            {2012, 220, 0},
-            {2011, 221, 0},
-            {2011, 222, 0},
-            {2012, 223, 0},
-            {2011, 224, 0},
-            {2011, 225, 0},
-            {2011, 226, 0},
-            {2011, 227, 0},
-            {2011, 228, 0},
-            {2012, 229, 0},
-            {2011, 230, 0},
-            {2011, 231, 0},
-            {3002, 232, 0},
-            {3001, 233, 0},
-            {3001, 234, 0},
-            {3002, 235, 0},
-            {3006, 236, 0},
-            {3001, 237, 0},
-            {3006, 238, 0},
-            {3006, 239, 0},
-            {3006, 240, 0},
-            {3006, 241, 0},
-            {3006, 242, 0},
-            {3006, 243, 0},
-            {3006, 244, 0},
-            {3006, 245, 0},
-            {3006, 246, 0},
-            {3002, 247, 0},
-            {3002, 248, 0},
-            {2035, 249, 0},
-            {2023, 250, 0},
-            {62, 251, 0},
-            {62, 252, 0},
-            {62, 253, 0},
-            {62, 254, 0},
-            {15, 255, 0},
-            {15, 256, 0},
-            {15, 257, 0},
-            {15, 258, 0},
-            {12, 259, 0},
-            {12, 260, 0},
-            {12, 261, 0},
-            {10, 262, 0},
-            {10, 263, 0},
-            {35, 264, 0},
-            {35, 265, 0},
-            {35, 266, 0},
-            {11, 267, 0},
-            {11, 268, 0},
-            {11, 269, 0},
-            {11, 270, 0},
-            {11, 271, 0},
-            {11, 272, 0},
-            {2014, 273, 0},
-            {2011, 274, 0},
-            {2011, 275, 0},
-            {2014, 276, 0},
-            {2014, 277, 0},
-            {2014, 278, 0},
-            {2014, 279, 0},
-            {2014, 280, 0},
-            {2014, 281, 0},
-            {2014, 282, 0},
-            {2014, 283, 0},
-            {2014, 284, 0},
-            {2014, 285, 0},
-            {2014, 286, 0},
-            {2014, 287, 0},
-            {2014, 288, 0},
-            {2014, 289, 0},
-            {11, 290, 0},
-            {8, 291, 0},
-            {2008, 292, 0},
-            {2008, 293, 0},
-            {3001, 294, 0},
-            {3001, 295, 0},
-            {3001, 296, 0},
-            {2014, 297, 0},
-            {3002, 298, 0},
-            {3002, 299, 0},
-            {3001, 300, 0},
-            {3001, 301, 0},
-            {3002, 302, 0},
-            {3001, 303, 0},
-            {3001, 304, 0},
-            {3001, 305, 0},
-            {3001, 306, 0},
-            {2008, 307, 0},
-            {2008, 308, 0},
-            {3001, 309, 0},
-            {2004, 310, 0},
-        }},
-        {"Refinery (E2M3)", {true, false, false}, {0, 0, 0}, 11, 229, {
-            {2, 0, 0},
-            {3, 1, 0},
-            {4, 2, 0},
-            {1, 3, 0},
-            {2048, 4, 0},
-            {2008, 5, 0},
-            {2035, 6, 0},
-            {2035, 7, 0},
-            {2035, 8, 0},
-            {2035, 9, 0},
-            {2035, 10, 0},
-            {2014, 11, 0},
-            {2004, 12, 0},
-            {2025, 13, 0},
-            {2010, 14, 0},
-            {2012, 15, 0},
-            {2015, 16, 0},
-            {2014, 17, 0},
-            {2007, 18, 0},
-            {2049, 19, 0},
-            {2008, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3002, 23, 0},
-            {2012, 24, 0},
-            {2007, 25, 0},
-            {3002, 26, 0},
-            {9, 27, 0},
-            {3004, 28, 0},
-            {3004, 29, 0},
-            {3002, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {8, 37, 0},
-            {2035, 38, 0},
-            {2035, 39, 0},
-            {2019, 40, 0},
-            {2014, 41, 0},
-            {2047, 42, 0},
-            {3002, 43, 0},
-            {3001, 44, 0},
-            {3002, 45, 0},
-            {2007, 46, 0},
-            {2012, 47, 0},
-            {3001, 48, 0},
-            {3001, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {3002, 52, 0},
-            {3002, 53, 0},
-            {2047, 54, 0},
-            {2007, 55, 0},
-            {2008, 56, 0},
-            {2018, 57, 0},
-            {2015, 58, 0},
-            {2015, 59, 0},
-            {2014, 60, 0},
-            {2014, 61, 0},
-            {3001, 62, 0},
-            {3001, 63, 0},
-            {3001, 64, 0},
-            {3005, 65, 0},
-            {2011, 66, 0},
-            {2024, 67, 0},
-            {2046, 68, 0},
-            {2008, 69, 0},
-            {2047, 70, 0},
-            {3004, 71, 0},
-            {3004, 72, 0},
-            {3004, 73, 0},
-            {3002, 74, 0},
-            {3002, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {3001, 80, 0},
-            {3005, 81, 0},
-            {3001, 82, 0},
-            {3001, 83, 0},
-            {2011, 84, 0},
-            {2049, 85, 0},
-            {2015, 86, 0},
-            {2013, 87, 0},
-            {3004, 88, 0},
-            {3001, 89, 0},
-            {5, 90, 0},
-            {2014, 91, 0},
-            {2014, 92, 0},
-            {3002, 93, 0},
-            {2047, 94, 0},
-            {3001, 95, 0},
-            {3001, 96, 0},
-            {3001, 97, 0},
-            {3001, 98, 0},
-            {3003, 99, 0},
-            {3002, 100, 0},
-            {3006, 101, 0},
-            {3006, 102, 0},
-            {3006, 103, 0},
-            {3006, 104, 0},
-            {3006, 105, 0},
-            {3006, 106, 0},
-            {3006, 107, 0},
-            {3006, 108, 0},
-            {2011, 109, 0},
-            {2024, 110, 0},
-            {2011, 111, 0},
-            {2011, 112, 0},
-            {2001, 113, 0},
-            {3006, 114, 0},
-            {3006, 115, 0},
-            {3006, 116, 0},
-            {3006, 117, 0},
-            {3006, 118, 0},
-            {3006, 119, 0},
-            {2014, 120, 0},
-            {2014, 121, 0},
-            {2014, 122, 0},
-            {2014, 123, 0},
-            {3005, 124, 0},
-            {3002, 125, 0},
-            {3004, 126, 0},
-            {3004, 127, 0},
-            {3004, 128, 0},
-            {3004, 129, 0},
-            {3004, 130, 0},
-            {3004, 131, 0},
-            {3004, 132, 0},
-            {3004, 133, 0},
-            {2008, 134, 0},
-            {2011, 135, 0},
-            {2011, 136, 0},
-            {2008, 137, 0},
-            {2008, 138, 0},
-            {2007, 139, 0},
-            {2010, 140, 0},
-            {2012, 141, 0},
-            {2049, 142, 0},
-            {2011, 143, 0},
-            {2008, 144, 0},
-            {2011, 145, 0},
-            {2011, 146, 0},
-            {3001, 147, 0},
-            {3001, 148, 0},
-            {3001, 149, 0},
-            {3001, 150, 0},
-            {2035, 151, 0},
-            {2035, 152, 0},
-            {2035, 153, 0},
-            {3004, 154, 0},
-            {3004, 155, 0},
-            {3004, 156, 0},
-            {3002, 157, 0},
-            {3002, 158, 0},
-            {3002, 159, 0},
-            {3002, 160, 0},
-            {3002, 161, 0},
-            {3004, 162, 0},
-            {60, 163, 0},
-            {12, 164, 0},
-            {24, 165, 0},
-            {24, 166, 0},
-            {24, 167, 0},
-            {24, 168, 0},
-            {24, 169, 0},
-            {15, 170, 0},
-            {15, 171, 0},
-            {12, 172, 0},
-            {12, 173, 0},
-            {12, 174, 0},
-            {12, 175, 0},
-            {10, 176, 0},
-            {10, 177, 0},
-            {34, 178, 0},
-            {34, 179, 0},
-            {34, 180, 0},
-            {34, 181, 0},
-            {34, 182, 0},
-            {34, 183, 0},
-            {34, 184, 0},
-            {34, 185, 0},
-            {34, 186, 0},
-            {35, 187, 0},
-            {35, 188, 0},
-            {2015, 189, 0},
-            {2015, 190, 0},
-            {2014, 191, 0},
-            {2014, 192, 0},
-            {31, 193, 0},
-            {31, 194, 0},
-            {31, 195, 0},
-            {31, 196, 0},
-            {31, 197, 0},
-            {31, 198, 0},
-            {32, 199, 0},
-            {32, 200, 0},
-            {32, 201, 0},
-            {32, 202, 0},
-            {31, 203, 0},
-            {31, 204, 0},
-            {2008, 205, 0},
-            {2008, 206, 0},
-            {2007, 207, 0},
-            {2008, 208, 0},
-            {2014, 209, 0},
-            {2014, 210, 0},
-            {2014, 211, 0},
-            {2014, 212, 0},
-            {2015, 213, 0},
-            {2015, 214, 0},
-            {2015, 215, 0},
-            {2015, 216, 0},
-            {11, 217, 0},
-            {11, 218, 0},
-            {11, 219, 0},
-            {11, 220, 0},
-            {2023, 221, 0},
-            {2025, 222, 0},
-            {2002, 223, 0},
-            {58, 224, 0},
-            {58, 225, 0},
-            {3005, 226, 0},
-            {3005, 227, 0},
-            {3005, 228, 0},
-        }},
-        {"Deimos Lab (E2M4)", {true, true, false}, {0, 0, 0}, 16, 265, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3002, 4, 0},
-            {3005, 5, 0},
-            {2015, 6, 0},
-            {2018, 7, 0},
-            {2024, 8, 0},
-            {3002, 9, 0},
-            {3002, 10, 0},
-            {3002, 11, 0},
-            {3002, 12, 0},
-            {3002, 13, 0},
-            {3002, 14, 0},
-            {3002, 15, 0},
-            {3002, 16, 0},
-            {2015, 17, 0},
-            {2015, 18, 0},
-            {2015, 19, 0},
-            {2014, 20, 0},
-            {2014, 21, 0},
-            {2014, 22, 0},
-            {2014, 23, 0},
-            {2014, 24, 0},
-            {2048, 25, 0},
-            {2012, 26, 0},
-            {2012, 27, 0},
-            {9, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {2008, 31, 0},
-            {2012, 32, 0},
-            {2010, 33, 0},
-            {2015, 34, 0},
-            {2012, 35, 0},
-            {2012, 36, 0},
-            {2048, 37, 0},
-            {2012, 38, 0},
-            {2026, 39, 0},
-            {2018, 40, 0},
-            {2049, 41, 0},
-            {33, 42, 0},
-            {37, 43, 0},
-            {3006, 44, 0},
-            {3002, 45, 0},
-            {3002, 46, 0},
-            {3006, 47, 0},
-            {3006, 48, 0},
-            {3002, 49, 0},
-            {3005, 50, 0},
-            {2012, 51, 0},
-            {2049, 52, 0},
-            {2008, 53, 0},
-            {2008, 54, 0},
-            {2014, 55, 0},
-            {2014, 56, 0},
-            {2014, 57, 0},
-            {2014, 58, 0},
-            {2014, 59, 0},
-            {3005, 60, 0},
-            {3001, 61, 0},
-            {3001, 62, 0},
-            {3001, 63, 0},
-            {3001, 64, 0},
-            {3001, 65, 0},
-            {2008, 66, 0},
-            {2007, 67, 0},
-            {2008, 68, 0},
-            {3001, 69, 0},
-            {3001, 70, 0},
-            {3002, 71, 0},
-            {3002, 72, 0},
-            {2015, 73, 0},
-            {5, 74, 0},
-            {3001, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {3001, 80, 0},
-            {3001, 81, 0},
-            {3002, 82, 0},
-            {3005, 83, 0},
-            {3005, 84, 0},
-            {3005, 85, 0},
-            {6, 86, 0},
-            {14, 87, 0},
-            {14, 88, 0},
-            {3001, 89, 0},
-            {14, 90, 0},
-            {14, 91, 0},
-            {3001, 92, 0},
-            {3001, 93, 0},
-            {3001, 94, 0},
-            {3001, 95, 0},
-            {3001, 96, 0},
-            {3001, 97, 0},
-            {3001, 98, 0},
-            {3001, 99, 0},
-            {3001, 100, 0},
-            {3001, 101, 0},
-            {3001, 102, 0},
-            {3001, 103, 0},
-            {2007, 104, 0},
-            {3002, 105, 0},
-            {3002, 106, 0},
-            {2013, 107, 0},
-            {2048, 108, 0},
-            {2001, 109, 0},
-            {2049, 110, 0},
-            {2012, 111, 0},
-            {2015, 112, 0},
-            {2015, 113, 0},
-            {3005, 114, 0},
-            {2014, 115, 0},
-            {2014, 116, 0},
-            {2014, 117, 0},
-            {2014, 118, 0},
-            {2014, 119, 0},
-            {2014, 120, 0},
-            {2014, 121, 0},
-            {2014, 122, 0},
-            {2014, 123, 0},
-            {2014, 124, 0},
-            {3001, 125, 0},
-            {3003, 126, 0},
-            {3003, 127, 0},
-            {2014, 128, 0},
-            {2019, 129, 0},
-            {2004, 130, 0},
-            {14, 131, 0},
-            {2035, 132, 0},
-            {2035, 133, 0},
-            {2035, 134, 0},
-            {2014, 135, 0},
-            {2014, 136, 0},
-            {3002, 137, 0},
-            {3005, 138, 0},
-            {3002, 139, 0},
-            {3002, 140, 0},
-            {2010, 141, 0},
-            {2010, 142, 0},
-            {2015, 143, 0},
-            {2015, 144, 0},
-            {2015, 145, 0},
-            {2015, 146, 0},
-            {2011, 147, 0},
-            {2015, 148, 0},
-            {2014, 149, 0},
-            {3006, 150, 0},
-            {3006, 151, 0},
-            {3006, 152, 0},
-            {3006, 153, 0},
-            {3006, 154, 0},
-            {2008, 155, 0},
-            {2011, 156, 0},
-            {2046, 157, 0},
-            {3001, 158, 0},
-            {8, 159, 0},
-            {3003, 160, 0},
-            {3005, 161, 0},
-            {3005, 162, 0},
-            {2011, 163, 0},
-            {2011, 164, 0},
-            {2047, 165, 0},
-            {2007, 166, 0},
-            {2010, 167, 0},
-            {2010, 168, 0},
-            {2049, 169, 0},
-            {3006, 170, 0},
-            {3006, 171, 0},
-            {3006, 172, 0},
-            {2025, 173, 0},
-            {2023, 174, 0},
-            {2024, 175, 0},
-            {3003, 176, 0},
-            {3005, 177, 0},
-            {9, 178, 0},
-            {9, 179, 0},
-            {9, 180, 0},
-            {3004, 181, 0},
-            {3004, 182, 0},
-            {2015, 183, 0},
-            {2015, 184, 0},
-            {2015, 185, 0},
-            {2018, 186, 0},
-            {31, 187, 0},
-            {31, 188, 0},
-            {2002, 189, 0},
-            {2049, 190, 0},
-            {2012, 191, 0},
-            {9, 192, 0},
-            {9, 193, 0},
-            {2007, 194, 0},
-            {2008, 195, 0},
-            {2008, 196, 0},
-            {2008, 197, 0},
-            {2008, 198, 0},
-            {2012, 199, 0},
-            {58, 200, 0},
-            {58, 201, 0},
-            {62, 202, 0},
-            {62, 203, 0},
-            {62, 204, 0},
-            {62, 205, 0},
-            {46, 206, 0},
-            {46, 207, 0},
-            {24, 208, 0},
-            {12, 209, 0},
-            {24, 210, 0},
-            {24, 211, 0},
-            {24, 212, 0},
-            {24, 213, 0},
-            {24, 214, 0},
-            {24, 215, 0},
-            {46, 216, 0},
-            {46, 217, 0},
-            {46, 218, 0},
-            {46, 219, 0},
-            {33, 220, 0},
-            {33, 221, 0},
-            {33, 222, 0},
-            {33, 223, 0},
-            {32, 224, 0},
-            {32, 225, 0},
-            {32, 226, 0},
-            {32, 227, 0},
-            {32, 228, 0},
-            {32, 229, 0},
-            {32, 230, 0},
-            {32, 231, 0},
-            {30, 232, 0},
-            {30, 233, 0},
-            {30, 234, 0},
-            {30, 235, 0},
-            {41, 236, 0},
-            {41, 237, 0},
-            {15, 238, 0},
-            {15, 239, 0},
-            {12, 240, 0},
-            {2012, 241, 0},
-            {2012, 242, 0},
-            {3001, 243, 0},
-            {2013, 244, 0},
-            {2025, 245, 0},
-            {11, 246, 0},
-            {11, 247, 0},
-            {11, 248, 0},
-            {11, 249, 0},
-            {11, 250, 0},
-            {11, 251, 0},
-            {11, 252, 0},
-            {2012, 253, 0},
-            {2003, 254, 0},
-            {2012, 255, 0},
-            {2012, 256, 0},
-            {2012, 257, 0},
-            {2012, 258, 0},
-            {2012, 259, 0},
-            {2012, 260, 0},
-            {8, 261, 0},
-            {8, 262, 0},
-            {8, 263, 0},
-            {2013, 264, 0},
-        }},
-        {"Command Center (E2M5)", {false, false, false}, {0, 0, 0}, 10, 326, {
-            {3, 0, 0},
-            {2, 1, 0},
-            {1, 2, 0},
-            {8, 3, 0},
-            {3005, 4, 0},
-            {3002, 5, 0},
-            {4, 6, 0},
-            {3001, 7, 0},
-            {3001, 8, 0},
-            {3001, 9, 0},
-            {3001, 10, 0},
-            {3003, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3001, 15, 0},
-            {9, 16, 0},
-            {9, 17, 0},
-            {9, 18, 0},
-            {3001, 19, 0},
-            {3001, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3001, 25, 0},
-            {3001, 26, 0},
-            {9, 27, 0},
-            {3001, 28, 0},
-            {9, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3002, 34, 0},
-            {3006, 35, 0},
-            {3006, 36, 0},
-            {3006, 37, 0},
-            {3006, 38, 0},
-            {2049, 39, 0},
-            {9, 40, 0},
-            {9, 41, 0},
-            {9, 42, 0},
-            {2007, 43, 0},
-            {3002, 44, 0},
-            {3002, 45, 0},
-            {3002, 46, 0},
-            {3002, 47, 0},
-            {3002, 48, 0},
-            {3002, 49, 0},
-            {3002, 50, 0},
-            {3002, 51, 0},
-            {3002, 52, 0},
-            {2019, 53, 0},
-            {3006, 54, 0},
-            {3006, 55, 0},
-            {3006, 56, 0},
-            {2023, 57, 0},
-            {2011, 58, 0},
-            {2007, 59, 0},
-            {56, 60, 0},
-            {56, 61, 0},
-            {3002, 62, 0},
-            {3006, 63, 0},
-            {3006, 64, 0},
-            {3006, 65, 0},
-            {3001, 66, 0},
-            {3006, 67, 0},
-            {3003, 68, 0},
-            {2002, 69, 0},
-            {2012, 70, 0},
-            {3002, 71, 0},
-            {9, 72, 0},
-            {9, 73, 0},
-            {9, 74, 0},
-            {3001, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {2005, 79, 0},
-            {2011, 80, 0},
-            {29, 81, 0},
-            {60, 82, 0},
-            {27, 83, 0},
-            {27, 84, 0},
-            {27, 85, 0},
-            {27, 86, 0},
-            {27, 87, 0},
-            {27, 88, 0},
-            {28, 89, 0},
-            {28, 90, 0},
-            {24, 91, 0},
-            {15, 92, 0},
-            {15, 93, 0},
-            {12, 94, 0},
-            {24, 95, 0},
-            {24, 96, 0},
-            {24, 97, 0},
-            {10, 98, 0},
-            {24, 99, 0},
-            {18, 100, 0},
-            {19, 101, 0},
-            {45, 102, 0},
-            {45, 103, 0},
-            {24, 104, 0},
-            {24, 105, 0},
-            {2015, 106, 0},
-            {2015, 107, 0},
-            {2011, 108, 0},
-            {2004, 109, 0},
-            {14, 110, 0},
-            {14, 111, 0},
-            {14, 112, 0},
-            {14, 113, 0},
-            {3005, 114, 0},
-            {3005, 115, 0},
-            {3003, 116, 0},
-            {2049, 117, 0},
-            {2012, 118, 0},
-            {2048, 119, 0},
-            {29, 120, 0},
-            {49, 121, 0},
-            {10, 122, 0},
-            {24, 123, 0},
-            {24, 124, 0},
-            {24, 125, 0},
-            {27, 126, 0},
-            {9, 127, 0},
-            {9, 128, 0},
-            {9, 129, 0},
-            {9, 130, 0},
-            {9, 131, 0},
-            {3002, 132, 0},
-            {3002, 133, 0},
-            {3002, 134, 0},
-            {3002, 135, 0},
-            {3002, 136, 0},
-            {3002, 137, 0},
-            {31, 138, 0},
-            {30, 139, 0},
-            {31, 140, 0},
-            {31, 141, 0},
-            {30, 142, 0},
-            {31, 143, 0},
-            {36, 144, 0},
-            {35, 145, 0},
-            {35, 146, 0},
-            {35, 147, 0},
-            {35, 148, 0},
-            {3001, 149, 0},
-            {3001, 150, 0},
-            {3001, 151, 0},
-            {2007, 152, 0},
-            {2049, 153, 0},
-            {2012, 154, 0},
-            {2049, 155, 0},
-            {2007, 156, 0},
-            {2012, 157, 0},
-            {2008, 158, 0},
-            {2015, 159, 0},
-            {2015, 160, 0},
-            {2015, 161, 0},
-            {2015, 162, 0},
-            {2015, 163, 0},
-            {2015, 164, 0},
-            {2015, 165, 0},
-            {2015, 166, 0},
-            {2012, 167, 0},
-            {2012, 168, 0},
-            {2015, 169, 0},
-            {2048, 170, 0},
-            {2007, 171, 0},
-            {2008, 172, 0},
-            {2047, 173, 0},
-            {2008, 174, 0},
-            {2008, 175, 0},
-            {2026, 176, 0},
-            {3006, 177, 0},
-            {3006, 178, 0},
-            {3006, 179, 0},
-            {3006, 180, 0},
-            {3002, 181, 0},
-            {2011, 182, 0},
-            {46, 183, 0},
-            {60, 184, 0},
-            {24, 185, 0},
-            {2015, 186, 0},
-            {2015, 187, 0},
-            {3002, 188, 0},
-            {3002, 189, 0},
-            {3002, 190, 0},
-            {3002, 191, 0},
-            {2049, 192, 0},
-            {9, 193, 0},
-            {9, 194, 0},
-            {3005, 195, 0},
-            {3005, 196, 0},
-            {2018, 197, 0},
-            {2049, 198, 0},
-            {17, 199, 0},
-            {3005, 200, 0},
-            {2015, 201, 0},
-            {2015, 202, 0},
-            {2015, 203, 0},
-            {2015, 204, 0},
-            {2015, 205, 0},
-            {2015, 206, 0},
-            {2015, 207, 0},
-            {2015, 208, 0},
-            {2015, 209, 0},
-            {2015, 210, 0},
-            {2015, 211, 0},
-            {2015, 212, 0},
-            {2015, 213, 0},
-            {2015, 214, 0},
-            {2011, 215, 0},
-            {2007, 216, 0},
-            {2008, 217, 0},
-            {2011, 218, 0},
-            {9, 219, 0},
-            {9, 220, 0},
-            {9, 221, 0},
-            {9, 222, 0},
-            {2011, 223, 0},
-            {2011, 224, 0},
-            {2008, 225, 0},
-            {2008, 226, 0},
-            {2008, 227, 0},
-            {2007, 228, 0},
-            {2007, 229, 0},
-            {2010, 230, 0},
-            {2045, 231, 0},
-            {35, 232, 0},
-            {2018, 233, 0},
-            {23, 234, 0},
-            {24, 235, 0},
-            {3006, 236, 0},
-            {3002, 237, 0},
-            {3006, 238, 0},
-            {2025, 239, 0},
-            {2012, 240, 0},
-            {3001, 241, 0},
-            {3001, 242, 0},
-            {3001, 243, 0},
-            {3006, 244, 0},
-            {3006, 245, 0},
-            {3006, 246, 0},
-            {3006, 247, 0},
-            {3001, 248, 0},
-            {3001, 249, 0},
-            {3001, 250, 0},
-            {3001, 251, 0},
-            {3002, 252, 0},
-            {3006, 253, 0},
-            {2012, 254, 0},
-            {2047, 255, 0},
-            {2024, 256, 0},
-            {2008, 257, 0},
-            {2010, 258, 0},
-            {2011, 259, 0},
-            {2011, 260, 0},
-            {2011, 261, 0},
-            {2007, 262, 0},
-            {10, 263, 0},
-            {23, 264, 0},
-            {23, 265, 0},
-            {24, 266, 0},
-            {24, 267, 0},
-            {24, 268, 0},
-            {46, 269, 0},
-            {46, 270, 0},
-            {33, 271, 0},
-            {33, 272, 0},
-            {33, 273, 0},
-            {33, 274, 0},
-            {33, 275, 0},
-            {35, 276, 0},
-            {35, 277, 0},
-            {2015, 278, 0},
-            {2015, 279, 0},
-            {2015, 280, 0},
-            {2014, 281, 0},
-            {2014, 282, 0},
-            {2014, 283, 0},
-            {2015, 284, 0},
-            {2014, 285, 0},
-            {2014, 286, 0},
-            {2014, 287, 0},
-            {2025, 288, 0},
-            {18, 289, 0},
-            {18, 290, 0},
-            {3004, 291, 0},
-            {3004, 292, 0},
-            {3004, 293, 0},
-            {3004, 294, 0},
-            {3004, 295, 0},
-            {3004, 296, 0},
-            {3004, 297, 0},
-            {3004, 298, 0},
-            {3004, 299, 0},
-            {3004, 300, 0},
-            {3004, 301, 0},
-            {3004, 302, 0},
-            {3004, 303, 0},
-            {3004, 304, 0},
-            {3001, 305, 0},
-            {3001, 306, 0},
-            {2012, 307, 0},
-            {2012, 308, 0},
-            {2012, 309, 0},
-            {2048, 310, 0},
-            {2049, 311, 0},
-            {2046, 312, 0},
-            {3006, 313, 0},
-            {3006, 314, 0},
-            {3006, 315, 0},
-            {3006, 316, 0},
-            {17, 317, 0},
-            {3001, 318, 0},
-            {3001, 319, 0},
-            {11, 320, 0},
-            {11, 321, 0},
-            {11, 322, 0},
-            {11, 323, 0},
-            {11, 324, 0},
-            {3003, 325, 0},
-        }},
-        {"Halls of the Damned (E2M6)", {true, true, true}, {1, 1, 1}, 17, 326, {
-            {1, 0, 0},
-            {3, 1, 0},
-            {2, 2, 0},
-            {4, 3, 0},
-            {9, 4, 0},
-            {3001, 5, 0},
-            {2007, 6, 0},
-            {3002, 7, 0},
-            {2010, 8, 0},
-            {3005, 9, 0},
-            {2023, 10, 0},
-            {2012, 11, 0},
-            {2012, 12, 0},
-            {40, 13, 0},
-            {2012, 14, 0},
-            {3001, 15, 0},
-            {3001, 16, 0},
-            {3002, 17, 0},
-            {3002, 18, 0},
-            {3002, 19, 0},
-            {3002, 20, 0},
-            {3002, 21, 0},
-            {3004, 22, 0},
-            {9, 23, 0},
-            {3004, 24, 0},
-            {2012, 25, 0},
-            {8, 26, 0},
-            {3002, 27, 0},
-            {2007, 28, 0},
-            {2011, 29, 0},
-            {2008, 30, 0},
-            {2011, 31, 0},
-            {3002, 32, 0},
-            {2011, 33, 0},
-            {2010, 34, 0},
-            {2014, 35, 0},
-            {3002, 36, 0},
-            {3002, 37, 0},
-            {3002, 38, 0},
-            {2019, 39, 0},
-            {2049, 40, 0},
-            {2007, 41, 0},
-            {3002, 42, 0},
-            {3002, 43, 0},
-            {2046, 44, 0},
-            {2011, 45, 0},
-            {2046, 46, 0},
-            {2008, 47, 0},
-            {2026, 48, 0},
-            {2018, 49, 0},
-            {3005, 50, 0},
-            {3006, 51, 0},
-            {3006, 52, 0},
-            {3006, 53, 0},
-            {3006, 54, 0},
-            {3006, 55, 0},
-            {2012, 56, 0},
-            {2024, 57, 0},
-            {2008, 58, 0},
-            {2047, 59, 0},
-            {3005, 60, 0},
-            {2012, 61, 0},
-            {2008, 62, 0},
-            {2011, 63, 0},
-            {2014, 64, 0},
-            {2014, 65, 0},
-            {2010, 66, 0},
-            {2045, 67, 0},
-            {3002, 68, 0},
-            {3002, 69, 0},
-            {3002, 70, 0},
-            {3002, 71, 0},
-            {3002, 72, 0},
-            {3002, 73, 0},
-            {3004, 74, 0},
-            {3004, 75, 0},
-            {3001, 76, 0},
-            {3004, 77, 0},
-            {3001, 78, 0},
-            {9, 79, 0},
-            {3001, 80, 0},
-            {3004, 81, 0},
-            {3004, 82, 0},
-            {3001, 83, 0},
-            {3004, 84, 0},
-            {3001, 85, 0},
-            {9, 86, 0},
-            {3001, 87, 0},
-            {2015, 88, 0},
-            {2015, 89, 0},
-            {2008, 90, 0},
-            {2008, 91, 0},
-            {2008, 92, 0},
-            {2015, 93, 0},
-            {3005, 94, 0},
-            {3006, 95, 0},
-            {3006, 96, 0},
-            {2011, 97, 0},
-            {2011, 98, 0},
-            {2007, 99, 0},
-            {2008, 100, 0},
-            {3006, 101, 0},
-            {2008, 102, 0},
-            {3005, 103, 0},
-            {3005, 104, 0},
-            {3005, 105, 0},
-            {9, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {9, 109, 0},
-            {2014, 110, 0},
-            {2014, 111, 0},
-            {2015, 112, 0},
-            {2012, 113, 0},
-            {2014, 114, 0},
-            {2015, 115, 0},
-            {2015, 116, 0},
-            {2007, 117, 0},
-            {2008, 118, 0},
-            {2007, 119, 0},
-            {2008, 120, 0},
-            {2012, 121, 0},
-            {3005, 122, 0},
-            {3002, 123, 0},
-            {3002, 124, 0},
-            {39, 125, 0},
-            {3001, 126, 0},
-            {3001, 127, 0},
-            {3002, 128, 0},
-            {2048, 129, 0},
-            {2011, 130, 0},
-            {3006, 131, 0},
-            {3006, 132, 0},
-            {3006, 133, 0},
-            {3002, 134, 0},
-            {3006, 135, 0},
-            {3006, 136, 0},
-            {3006, 137, 0},
-            {3001, 138, 0},
-            {3001, 139, 0},
-            {3001, 140, 0},
-            {3001, 141, 0},
-            {2013, 142, 0},
-            {2002, 143, 0},
-            {2045, 144, 0},
-            {2008, 145, 0},
-            {2010, 146, 0},
-            {2008, 147, 0},
-            {2012, 148, 0},
-            {3001, 149, 0},
-            {3001, 150, 0},
-            {9, 151, 0},
-            {3004, 152, 0},
-            {3004, 153, 0},
-            {3004, 154, 0},
-            {58, 155, 0},
-            {3001, 156, 0},
-            {3001, 157, 0},
-            {3001, 158, 0},
-            {2012, 159, 0},
-            {2014, 160, 0},
-            {2014, 161, 0},
-            {2015, 162, 0},
-            {2015, 163, 0},
-            {2015, 164, 0},
-            {3006, 165, 0},
-            {3006, 166, 0},
-            {3006, 167, 0},
-            {3006, 168, 0},
-            {3006, 169, 0},
-            {3006, 170, 0},
-            {2007, 171, 0},
-            {2008, 172, 0},
-            {2004, 173, 0},
-            {2047, 174, 0},
-            {2011, 175, 0},
-            {2015, 176, 0},
-            {2010, 177, 0},
-            {2011, 178, 0},
-            {3006, 179, 0},
-            {3001, 180, 0},
-            {3001, 181, 0},
-            {3001, 182, 0},
-            {3001, 183, 0},
-            {3002, 184, 0},
-            {3002, 185, 0},
-            {2046, 186, 0},
-            {3002, 187, 0},
-            {3006, 188, 0},
-            {3006, 189, 0},
-            {3001, 190, 0},
-            {3001, 191, 0},
-            {3001, 192, 0},
-            {3001, 193, 0},
-            {3001, 194, 0},
-            {3001, 195, 0},
-            {3002, 196, 0},
-            {2045, 197, 0},
-            {24, 198, 0},
-            {2011, 199, 0},
-            {2011, 200, 0},
-            {2011, 201, 0},
-            {2011, 202, 0},
-            {2008, 203, 0},
-            {2008, 204, 0},
-            {2007, 205, 0},
-            {3002, 206, 0},
-            {3002, 207, 0},
-            {3002, 208, 0},
-            {3002, 209, 0},
-            {3001, 210, 0},
-            {3006, 211, 0},
-            {3001, 212, 0},
-            {3006, 213, 0},
-            {3001, 214, 0},
-            {3006, 215, 0},
-            {2049, 216, 0},
-            {2024, 217, 0},
-            {3006, 218, 0},
-            {2011, 219, 0},
-            {38, 220, 0},
-            {2047, 221, 0},
-            {2012, 222, 0},
-            {2012, 223, 0},
-            {2011, 224, 0},
-            {2008, 225, 0},
-            {2015, 226, 0},
-            {2015, 227, 0},
-            {2012, 228, 0},
-            {3001, 229, 0},
-            {2001, 230, 0},
-            {2008, 231, 0},
-            {2003, 232, 0},
-            {3006, 233, 0},
-            {3002, 234, 0},
-            {3005, 235, 0},
-            {55, 236, 0},
-            {55, 237, 0},
-            {55, 238, 0},
-            {57, 239, 0},
-            {57, 240, 0},
-            {57, 241, 0},
-            {24, 242, 0},
-            {33, 243, 0},
-            {33, 244, 0},
-            {37, 245, 0},
-            {12, 246, 0},
-            {24, 247, 0},
-            {27, 248, 0},
-            {27, 249, 0},
-            {28, 250, 0},
-            {27, 251, 0},
-            {33, 252, 0},
-            {33, 253, 0},
-            {33, 254, 0},
-            {33, 255, 0},
-            {33, 256, 0},
-            {33, 257, 0},
-            {31, 258, 0},
-            {31, 259, 0},
-            {31, 260, 0},
-            {31, 261, 0},
-            {19, 262, 0},
-            {12, 263, 0},
-            {29, 264, 0},
-            {35, 265, 0},
-            {35, 266, 0},
-            {2014, 267, 0},
-            {28, 268, 0},
-            {28, 269, 0},
-            {35, 270, 0},
-            {24, 271, 0},
-            {52, 272, 0},
-            {36, 273, 0},
-            {62, 274, 0},
-            {24, 275, 0},
-            {24, 276, 0},
-            {15, 277, 0},
-            {2001, 278, 0},
-            {11, 279, 0},
-            {11, 280, 0},
-            {11, 281, 0},
-            {11, 282, 0},
-            {11, 283, 0},
-            {9, 284, 0},
-            {9, 285, 0},
-            {2005, 286, 0},
-            {2008, 287, 0},
-            {2008, 288, 0},
-            {2008, 289, 0},
-            {3002, 290, 0},
-            {3002, 291, 0},
-            {3002, 292, 0},
-            {3002, 293, 0},
-            {3003, 294, 0},
-            {2049, 295, 0},
-            {3002, 296, 0},
-            {3002, 297, 0},
-            {3003, 298, 0},
-            {2047, 299, 0},
-            {2011, 300, 0},
-            {2008, 301, 0},
-            {2045, 302, 0},
-            {3002, 303, 0},
-            {3002, 304, 0},
-            {2008, 305, 0},
-            {2010, 306, 0},
-            {3002, 307, 0},
-            {3002, 308, 0},
-            {2011, 309, 0},
-            {2011, 310, 0},
-            {3003, 311, 0},
-            {3006, 312, 0},
-            {3006, 313, 0},
-            {3006, 314, 0},
-            {58, 315, 0},
-            {58, 316, 0},
-            {2049, 317, 0},
-            {2008, 318, 0},
-            {2010, 319, 0},
-            {2024, 320, 0},
-            {3001, 321, 0},
-            {3001, 322, 0},
-            {3001, 323, 0},
-            {3001, 324, 0},
-            {3001, 325, 0},
-        }},
-        {"Spawning Vats (E2M7)", {true, true, true}, {0, 0, 0}, 16, 235, {
-            {3001, 0, 0},
-            {3002, 1, 0},
-            {3001, 2, 0},
-            {3001, 3, 0},
-            {3001, 4, 0},
-            {3001, 5, 0},
-            {3001, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3002, 9, 0},
-            {3001, 10, 0},
-            {3002, 11, 0},
-            {3002, 12, 0},
-            {3002, 13, 0},
-            {3005, 14, 0},
-            {3005, 15, 0},
-            {3002, 16, 0},
-            {2014, 17, 0},
-            {2014, 18, 0},
-            {2014, 19, 0},
-            {2049, 20, 0},
-            {17, 21, 0},
-            {2014, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3002, 25, 0},
-            {2014, 26, 0},
-            {2014, 27, 0},
-            {3002, 28, 0},
-            {2003, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3002, 37, 0},
-            {3002, 38, 0},
-            {3002, 39, 0},
-            {3002, 40, 0},
-            {3002, 41, 0},
-            {3002, 42, 0},
-            {3002, 43, 0},
-            {3002, 44, 0},
-            {3002, 45, 0},
-            {3002, 46, 0},
-            {2007, 47, 0},
-            {2007, 48, 0},
-            {8, 49, 0},
-            {2008, 50, 0},
-            {2011, 51, 0},
-            {3002, 52, 0},
-            {3001, 53, 0},
-            {3001, 54, 0},
-            {3001, 55, 0},
-            {2012, 56, 0},
-            {2007, 57, 0},
-            {2007, 58, 0},
-            {3001, 59, 0},
-            {3001, 60, 0},
-            {3001, 61, 0},
-            {2007, 62, 0},
-            {2011, 63, 0},
-            {2014, 64, 0},
-            {3001, 65, 0},
-            {3001, 66, 0},
-            {3001, 67, 0},
-            {2007, 68, 0},
-            {2007, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {2011, 72, 0},
-            {2008, 73, 0},
-            {3001, 74, 0},
-            {3001, 75, 0},
-            {2014, 76, 0},
-            {2015, 77, 0},
-            {2048, 78, 0},
-            {2024, 79, 0},
-            {2014, 80, 0},
-            {2007, 81, 0},
-            {2007, 82, 0},
-            {2007, 83, 0},
-            {2011, 84, 0},
-            {2011, 85, 0},
-            {2011, 86, 0},
-            {2011, 87, 0},
-            {2011, 88, 0},
-            {2015, 89, 0},
-            {2015, 90, 0},
-            {2015, 91, 0},
-            {2049, 92, 0},
-            {2048, 93, 0},
-            {2019, 94, 0},
-            {3002, 95, 0},
-            {3002, 96, 0},
-            {3001, 97, 0},
-            {2015, 98, 0},
-            {2047, 99, 0},
-            {2008, 100, 0},
-            {2048, 101, 0},
-            {36, 102, 0},
-            {50, 103, 0},
-            {3001, 104, 0},
-            {3001, 105, 0},
-            {3001, 106, 0},
-            {9, 107, 0},
-            {3001, 108, 0},
-            {3001, 109, 0},
-            {1, 110, 0},
-            {2, 111, 0},
-            {3, 112, 0},
-            {4, 113, 0},
-            {2008, 114, 0},
-            {2007, 115, 0},
-            {57, 116, 0},
-            {57, 117, 0},
-            {2008, 118, 0},
-            {2035, 119, 0},
-            {2007, 120, 0},
-            {2007, 121, 0},
-            {3001, 122, 0},
-            {3001, 123, 0},
-            {3001, 124, 0},
-            {2007, 125, 0},
-            {2007, 126, 0},
-            {3001, 127, 0},
-            {2002, 128, 0},
-            {2015, 129, 0},
-            {2015, 130, 0},
-            {2018, 131, 0},
-            {2011, 132, 0},
-            {3003, 133, 0},
-            {2011, 134, 0},
-            {2011, 135, 0},
-            {2011, 136, 0},
-            {2011, 137, 0},
-            {2010, 138, 0},
-            {2049, 139, 0},
-            {13, 140, 0},
-            {6, 141, 0},
-            {5, 142, 0},
-            {3005, 143, 0},
-            {14, 144, 0},
-            {14, 145, 0},
-            {2022, 146, 0},
-            {15, 147, 0},
-            {10, 148, 0},
-            {12, 149, 0},
-            {10, 150, 0},
-            {10, 151, 0},
-            {10, 152, 0},
-            {21, 153, 0},
-            {21, 154, 0},
-            {21, 155, 0},
-            {24, 156, 0},
-            {3002, 157, 0},
-            {3002, 158, 0},
-            {3002, 159, 0},
-            {2023, 160, 0},
-            {3002, 161, 0},
-            {3002, 162, 0},
-            {2015, 163, 0},
-            {2015, 164, 0},
-            {2015, 165, 0},
-            {2015, 166, 0},
-            {2015, 167, 0},
-            {2012, 168, 0},
-            {2011, 169, 0},
-            {2011, 170, 0},
-            {2008, 171, 0},
-            {2010, 172, 0},
-            {2047, 173, 0},
-            {2005, 174, 0},
-            {51, 175, 0},
-            {3002, 176, 0},
-            {3002, 177, 0},
-            {2011, 178, 0},
-            {3002, 179, 0},
-            {56, 180, 0},
-            {56, 181, 0},
-            {2012, 182, 0},
-            {41, 183, 0},
-            {3005, 184, 0},
-            {9, 185, 0},
-            {9, 186, 0},
-            {9, 187, 0},
-            {3005, 188, 0},
-            {55, 189, 0},
-            {2047, 190, 0},
-            {2047, 191, 0},
-            {62, 192, 0},
-            {62, 193, 0},
-            {55, 194, 0},
-            {63, 195, 0},
-            {61, 196, 0},
-            {2049, 197, 0},
-            {2049, 198, 0},
-            {2013, 199, 0},
-            {2022, 200, 0},
-            {2026, 201, 0},
-            {2001, 202, 0},
-            {2004, 203, 0},
-            {58, 204, 0},
-            {2049, 205, 0},
-            {2012, 206, 0},
-            {2012, 207, 0},
-            {58, 208, 0},
-            {58, 209, 0},
-            {58, 210, 0},
-            {3001, 211, 0},
-            {3001, 212, 0},
-            {3001, 213, 0},
-            {3001, 214, 0},
-            {3001, 215, 0},
-            {3003, 216, 0},
-            {58, 217, 0},
-            {3002, 218, 0},
-            {11, 219, 0},
-            {11, 220, 0},
-            {11, 221, 0},
-            {11, 222, 0},
-            {11, 223, 0},
-            {3002, 224, 0},
-            {3002, 225, 0},
-            {3001, 226, 0},
-            {3001, 227, 0},
-            {3002, 228, 0},
-            {17, 229, 0},
-            {2007, 230, 0},
-            {2028, 231, 0},
-            {2028, 232, 0},
-            {2004, 233, 0},
-            {2003, 234, 0},
-        }},
-        {"Tower of Babel (E2M8)", {false, false, false}, {0, 0, 0}, 4, 66, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {2046, 4, 0},
-            {2046, 5, 0},
-            {2046, 6, 0},
-            {2046, 7, 0},
-            {2046, 8, 0},
-            {2046, 9, 0},
-            {2046, 10, 0},
-            {2046, 11, 0},
-            {2046, 12, 0},
-            {2046, 13, 0},
-            {2046, 14, 0},
-            {2046, 15, 0},
-            {2003, 16, 0},
-            {2013, 17, 0},
-            {2013, 18, 0},
-            {16, 19, 0},
-            {3006, 20, 0},
-            {3006, 21, 0},
-            {3006, 22, 0},
-            {3006, 23, 0},
-            {3006, 24, 0},
-            {3006, 25, 0},
-            {3006, 26, 0},
-            {3006, 27, 0},
-            {3006, 28, 0},
-            {3006, 29, 0},
-            {3006, 30, 0},
-            {3006, 31, 0},
-            {3006, 32, 0},
-            {3006, 33, 0},
-            {3006, 34, 0},
-            {3006, 35, 0},
-            {2019, 36, 0},
-            {3006, 37, 0},
-            {3006, 38, 0},
-            {3006, 39, 0},
-            {3006, 40, 0},
-            {2046, 41, 0},
-            {2046, 42, 0},
-            {2046, 43, 0},
-            {2046, 44, 0},
-            {2046, 45, 0},
-            {2046, 46, 0},
-            {2046, 47, 0},
-            {2046, 48, 0},
-            {2046, 49, 0},
-            {2046, 50, 0},
-            {2046, 51, 0},
-            {2046, 52, 0},
-            {2046, 53, 0},
-            {2046, 54, 0},
-            {2046, 55, 0},
-            {2046, 56, 0},
-            {2046, 57, 0},
-            {2046, 58, 0},
-            {11, 59, 0},
-            {11, 60, 0},
-            {11, 61, 0},
-            {11, 62, 0},
-            {11, 63, 0},
-            {11, 64, 0},
-            {11, 65, 0},
-        }},
-        {"Fortress of Mystery (E2M9)", {true, true, true}, {1, 1, 1}, 12, 53, {
-            {2, 0, 0},
-            {1, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3003, 4, 0},
-            {3003, 5, 0},
-            {3003, 6, 0},
-            {3003, 7, 0},
-            {3005, 8, 0},
-            {3005, 9, 0},
-            {3005, 10, 0},
-            {3005, 11, 0},
-            {3005, 12, 0},
-            {3005, 13, 0},
-            {3005, 14, 0},
-            {3005, 15, 0},
-            {3005, 16, 0},
-            {3005, 17, 0},
-            {2013, 18, 0},
-            {2012, 19, 0},
-            {2012, 20, 0},
-            {2012, 21, 0},
-            {2012, 22, 0},
-            {22, 23, 0},
-            {22, 24, 0},
-            {22, 25, 0},
-            {22, 26, 0},
-            {40, 27, 0},
-            {38, 28, 0},
-            {39, 29, 0},
-            {8, 30, 0},
-            {2002, 31, 0},
-            {2004, 32, 0},
-            {2003, 33, 0},
-            {2001, 34, 0},
-            {2005, 35, 0},
-            {2026, 36, 0},
-            {2047, 37, 0},
-            {2048, 38, 0},
-            {2048, 39, 0},
-            {2046, 40, 0},
-            {2046, 41, 0},
-            {2049, 42, 0},
-            {2049, 43, 0},
-            {2019, 44, 0},
-            {11, 45, 0},
-            {11, 46, 0},
-            {11, 47, 0},
-            {11, 48, 0},
-            {11, 49, 0},
-            {11, 50, 0},
-            {11, 51, 0},
-            {11, 52, 0},
-        }},
-    },
-    {
-        {"Hell Keep (E3M1)", {false, false, false}, {0, 0, 0}, 2, 92, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3001, 4, 0},
-            {3001, 5, 0},
-            {3001, 6, 0},
-            {3005, 7, 0},
-            {3005, 8, 0},
-            {2048, 9, 0},
-            {2048, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3005, 15, 0},
-            {3002, 16, 0},
-            {2012, 17, 0},
-            {2012, 18, 0},
-            {2008, 19, 0},
-            {2001, 20, 0},
-            {2049, 21, 0},
-            {3002, 22, 0},
-            {3002, 23, 0},
-            {3002, 24, 0},
-            {3002, 25, 0},
-            {3001, 26, 0},
-            {3001, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {2007, 34, 0},
-            {2011, 35, 0},
-            {2011, 36, 0},
-            {2014, 37, 0},
-            {2014, 38, 0},
-            {2015, 39, 0},
-            {2015, 40, 0},
-            {2015, 41, 0},
-            {2015, 42, 0},
-            {2012, 43, 0},
-            {2012, 44, 0},
-            {2012, 45, 0},
-            {2003, 46, 0},
-            {2008, 47, 0},
-            {2011, 48, 0},
-            {2012, 49, 0},
-            {3001, 50, 0},
-            {43, 51, 0},
-            {43, 52, 0},
-            {43, 53, 0},
-            {43, 54, 0},
-            {43, 55, 0},
-            {43, 56, 0},
-            {43, 57, 0},
-            {43, 58, 0},
-            {43, 59, 0},
-            {54, 60, 0},
-            {54, 61, 0},
-            {27, 62, 0},
-            {27, 63, 0},
-            {33, 64, 0},
-            {33, 65, 0},
-            {12, 66, 0},
-            {24, 67, 0},
-            {24, 68, 0},
-            {24, 69, 0},
-            {29, 70, 0},
-            {32, 71, 0},
-            {33, 72, 0},
-            {33, 73, 0},
-            {33, 74, 0},
-            {32, 75, 0},
-            {37, 76, 0},
-            {24, 77, 0},
-            {24, 78, 0},
-            {54, 79, 0},
-            {62, 80, 0},
-            {10, 81, 0},
-            {62, 82, 0},
-            {62, 83, 0},
-            {2008, 84, 0},
-            {11, 85, 0},
-            {11, 86, 0},
-            {11, 87, 0},
-            {11, 88, 0},
-            {3001, 89, 0},
-            {3001, 90, 0},
-            {2008, 91, 0},
-        }},
-        {"Slough of Despair (E3M2)", {true, false, false}, {1, 0, 0}, 9, 208, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {47, 4, 0},
-            {47, 5, 0},
-            {46, 6, 0},
-            {43, 7, 0},
-            {54, 8, 0},
-            {54, 9, 0},
-            {47, 10, 0},
-            {47, 11, 0},
-            {3006, 12, 0},
-            {3002, 13, 0},
-            {3002, 14, 0},
-            {2011, 15, 0},
-            {3005, 16, 0},
-            {2049, 17, 0},
-            {9, 18, 0},
-            {2008, 19, 0},
-            {2014, 20, 0},
-            {2012, 21, 0},
-            {46, 22, 0},
-            {58, 23, 0},
-            {9, 24, 0},
-            {3004, 25, 0},
-            {2012, 26, 0},
-            {3006, 27, 0},
-            {47, 28, 0},
-            {47, 29, 0},
-            {47, 30, 0},
-            {2048, 31, 0},
-            {2002, 32, 0},
-            {3002, 33, 0},
-            {9, 34, 0},
-            {9, 35, 0},
-            {2011, 36, 0},
-            {2023, 37, 0},
-            {58, 38, 0},
-            {3004, 39, 0},
-            {3004, 40, 0},
-            {3004, 41, 0},
-            {3006, 42, 0},
-            {3006, 43, 0},
-            {26, 44, 0},
-            {3006, 45, 0},
-            {2011, 46, 0},
-            {2008, 47, 0},
-            {43, 48, 0},
-            {47, 49, 0},
-            {42, 50, 0},
-            {42, 51, 0},
-            {46, 52, 0},
-            {46, 53, 0},
-            {46, 54, 0},
-            {46, 55, 0},
-            {46, 56, 0},
-            {3006, 57, 0},
-            {3006, 58, 0},
-            {3006, 59, 0},
-            {2011, 60, 0},
-            {2011, 61, 0},
-            {2012, 62, 0},
-            {2049, 63, 0},
-            {15, 64, 0},
-            {19, 65, 0},
-            {19, 66, 0},
-            {54, 67, 0},
-            {43, 68, 0},
-            {43, 69, 0},
-            {47, 70, 0},
-            {47, 71, 0},
-            {42, 72, 0},
-            {19, 73, 0},
-            {3005, 74, 0},
-            {2011, 75, 0},
-            {2019, 76, 0},
-            {2018, 77, 0},
-            {3002, 78, 0},
-            {3006, 79, 0},
-            {2003, 80, 0},
-            {10, 81, 0},
-            {3006, 82, 0},
-            {3006, 83, 0},
-            {3006, 84, 0},
-            {2011, 85, 0},
-            {2011, 86, 0},
-            {2008, 87, 0},
-            {2004, 88, 0},
-            {2012, 89, 0},
-            {2012, 90, 0},
-            {2011, 91, 0},
-            {2011, 92, 0},
-            {2008, 93, 0},
-            {2008, 94, 0},
-            {2007, 95, 0},
-            {2007, 96, 0},
-            {2011, 97, 0},
-            {2008, 98, 0},
-            {3004, 99, 0},
-            {3004, 100, 0},
-            {3002, 101, 0},
-            {9, 102, 0},
-            {9, 103, 0},
-            {9, 104, 0},
-            {9, 105, 0},
-            {9, 106, 0},
-            {9, 107, 0},
-            {2047, 108, 0},
-            {2015, 109, 0},
-            {2015, 110, 0},
-            {2015, 111, 0},
-            {2015, 112, 0},
-            {2015, 113, 0},
-            {2015, 114, 0},
-            {58, 115, 0},
-            {3005, 116, 0},
-            {3006, 117, 0},
-            {3006, 118, 0},
-            {3006, 119, 0},
-            {3002, 120, 0},
-            {2011, 121, 0},
-            {3005, 122, 0},
-            {2011, 123, 0},
-            {2011, 124, 0},
-            {58, 125, 0},
-            {2012, 126, 0},
-            {58, 127, 0},
-            {3006, 128, 0},
-            {3006, 129, 0},
-            {3006, 130, 0},
-            {3006, 131, 0},
-            {3006, 132, 0},
-            {3006, 133, 0},
-            {3002, 134, 0},
-            {3006, 135, 0},
-            {3006, 136, 0},
-            {3006, 137, 0},
-            {3002, 138, 0},
-            {3005, 139, 0},
-            {3005, 140, 0},
-            {3005, 141, 0},
-            {3005, 142, 0},
-            {2011, 143, 0},
-            {2011, 144, 0},
-            {2008, 145, 0},
-            {2008, 146, 0},
-            {2008, 147, 0},
-            {2014, 148, 0},
-            {2014, 149, 0},
-            {2014, 150, 0},
-            {2014, 151, 0},
-            {2014, 152, 0},
-            {2011, 153, 0},
-            {2026, 154, 0},
-            {2012, 155, 0},
-            {2049, 156, 0},
-            {2048, 157, 0},
-            {24, 158, 0},
-            {15, 159, 0},
-            {12, 160, 0},
-            {24, 161, 0},
-            {58, 162, 0},
-            {58, 163, 0},
-            {58, 164, 0},
-            {2007, 165, 0},
-            {2012, 166, 0},
-            {3006, 167, 0},
-            {3006, 168, 0},
-            {3006, 169, 0},
-            {3006, 170, 0},
-            {3006, 171, 0},
-            {3006, 172, 0},
-            {3006, 173, 0},
-            {3006, 174, 0},
-            {3006, 175, 0},
-            {3006, 176, 0},
-            {3006, 177, 0},
-            {2012, 178, 0},
-            {2012, 179, 0},
-            {2012, 180, 0},
-            {40, 181, 0},
-            {2013, 182, 0},
-            {3006, 183, 0},
-            {62, 184, 0},
-            {62, 185, 0},
-            {62, 186, 0},
-            {24, 187, 0},
-            {58, 188, 0},
-            {58, 189, 0},
-            {2046, 190, 0},
-            {2012, 191, 0},
-            {2012, 192, 0},
-            {58, 193, 0},
-            {2001, 194, 0},
-            {2004, 195, 0},
-            {17, 196, 0},
-            {2046, 197, 0},
-            {11, 198, 0},
-            {11, 199, 0},
-            {11, 200, 0},
-            {11, 201, 0},
-            {2008, 202, 0},
-            {2047, 203, 0},
-            {9, 204, 0},
-            {2010, 205, 0},
-            {2003, 206, 0},
-            {11, 207, 0},
-        }},
-        {"Pandemonium (E3M3)", {true, false, false}, {1, 0, 0}, 14, 209, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {2007, 4, 0},
-            {2047, 5, 0},
-            {2049, 6, 0},
-            {2010, 7, 0},
-            {2008, 8, 0},
-            {2007, 9, 0},
-            {2008, 10, 0},
-            {2023, 11, 0},
-            {2048, 12, 0},
-            {2012, 13, 0},
-            {2002, 14, 0},
-            {2012, 15, 0},
-            {2008, 16, 0},
-            {2007, 17, 0},
-            {2007, 18, 0},
-            {2047, 19, 0},
-            {2047, 20, 0},
-            {2012, 21, 0},
-            {2006, 22, 0},
-            {2013, 23, 0},
-            {3001, 24, 0},
-            {3001, 25, 0},
-            {2022, 26, 0},
-            {2007, 27, 0},
-            {2049, 28, 0},
-            {2012, 29, 0},
-            {3002, 30, 0},
-            {3002, 31, 0},
-            {2007, 32, 0},
-            {2012, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3001, 37, 0},
-            {3002, 38, 0},
-            {3001, 39, 0},
-            {3001, 40, 0},
-            {3001, 41, 0},
-            {3001, 42, 0},
-            {3001, 43, 0},
-            {3001, 44, 0},
-            {3002, 45, 0},
-            {3001, 46, 0},
-            {3001, 47, 0},
-            {3001, 48, 0},
-            {40, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {3001, 52, 0},
-            {3001, 53, 0},
-            {3001, 54, 0},
-            {3001, 55, 0},
-            {2011, 56, 0},
-            {2007, 57, 0},
-            {2008, 58, 0},
-            {3001, 59, 0},
-            {57, 60, 0},
-            {57, 61, 0},
-            {57, 62, 0},
-            {57, 63, 0},
-            {3006, 64, 0},
-            {3006, 65, 0},
-            {2019, 66, 0},
-            {17, 67, 0},
-            {3006, 68, 0},
-            {3002, 69, 0},
-            {3005, 70, 0},
-            {3002, 71, 0},
-            {3002, 72, 0},
-            {2001, 73, 0},
-            {3003, 74, 0},
-            {3002, 75, 0},
-            {2012, 76, 0},
-            {2047, 77, 0},
-            {3002, 78, 0},
-            {2015, 79, 0},
-            {2015, 80, 0},
-            {2015, 81, 0},
-            {2011, 82, 0},
-            {2011, 83, 0},
-            {3001, 84, 0},
-            {2018, 85, 0},
-            {2012, 86, 0},
-            {2011, 87, 0},
-            {8, 88, 0},
-            {2048, 89, 0},
-            {2012, 90, 0},
-            {2012, 91, 0},
-            {2026, 92, 0},
-            {2008, 93, 0},
-            {2048, 94, 0},
-            {2011, 95, 0},
-            {2011, 96, 0},
-            {3002, 97, 0},
-            {3005, 98, 0},
-            {3001, 99, 0},
-            {3001, 100, 0},
-            {3001, 101, 0},
-            {3001, 102, 0},
-            {3001, 103, 0},
-            {3001, 104, 0},
-            {3005, 105, 0},
-            {3006, 106, 0},
-            {3006, 107, 0},
-            {3006, 108, 0},
-            {3006, 109, 0},
-            {2011, 110, 0},
-            {2011, 111, 0},
-            {3001, 112, 0},
-            {2019, 113, 0},
-            {2008, 114, 0},
-            {2008, 115, 0},
-            {2007, 116, 0},
-            {2007, 117, 0},
-            {2001, 118, 0},
-            {2012, 119, 0},
-            {2048, 120, 0},
-            {2008, 121, 0},
-            {2011, 122, 0},
-            {2011, 123, 0},
-            {2012, 124, 0},
-            {2012, 125, 0},
-            {9, 126, 0},
-            {2012, 127, 0},
-            {2049, 128, 0},
-            {2007, 129, 0},
-            {2011, 130, 0},
-            {2007, 131, 0},
-            {2008, 132, 0},
-            {2010, 133, 0},
-            {2008, 134, 0},
-            {2008, 135, 0},
-            {2011, 136, 0},
-            {2011, 137, 0},
-            {3002, 138, 0},
-            {3002, 139, 0},
-            {3006, 140, 0},
-            {3006, 141, 0},
-            {58, 142, 0},
-            {58, 143, 0},
-            {58, 144, 0},
-            {3001, 145, 0},
-            {3001, 146, 0},
-            {3001, 147, 0},
-            {3001, 148, 0},
-            {3006, 149, 0},
-            {3006, 150, 0},
-            {3002, 151, 0},
-            {2011, 152, 0},
-            {2012, 153, 0},
-            {2010, 154, 0},
-            {3003, 155, 0},
-            {62, 156, 0},
-            {62, 157, 0},
-            {32, 158, 0},
-            {41, 159, 0},
-            {10, 160, 0},
-            {12, 161, 0},
-            {24, 162, 0},
-            {24, 163, 0},
-            {61, 164, 0},
-            {46, 165, 0},
-            {42, 166, 0},
-            {42, 167, 0},
-            {42, 168, 0},
-            {42, 169, 0},
-            {25, 170, 0},
-            {27, 171, 0},
-            {27, 172, 0},
-            {45, 173, 0},
-            {45, 174, 0},
-            {35, 175, 0},
-            {35, 176, 0},
-            {24, 177, 0},
-            {24, 178, 0},
-            {34, 179, 0},
-            {34, 180, 0},
-            {53, 181, 0},
-            {25, 182, 0},
-            {2003, 183, 0},
-            {17, 184, 0},
-            {2019, 185, 0},
-            {2012, 186, 0},
-            {2012, 187, 0},
-            {2012, 188, 0},
-            {3002, 189, 0},
-            {2049, 190, 0},
-            {11, 191, 0},
-            {11, 192, 0},
-            {11, 193, 0},
-            {11, 194, 0},
-            {11, 195, 0},
-            {11, 196, 0},
-            {11, 197, 0},
-            {58, 198, 0},
-            {3002, 199, 0},
-            {3006, 200, 0},
-            {3006, 201, 0},
-            {3006, 202, 0},
-            {3006, 203, 0},
-            {3002, 204, 0},
-            {55, 205, 0},
-            {55, 206, 0},
-            {55, 207, 0},
-            {55, 208, 0},
-        }},
-        {"House of Pain (E3M4)", {true, true, true}, {1, 1, 1}, 18, 374, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3002, 4, 0},
-            {2001, 5, 0},
-            {2011, 6, 0},
-            {2011, 7, 0},
-            {2047, 8, 0},
-            {3004, 9, 0},
-            {3004, 10, 0},
-            {2007, 11, 0},
-            {2008, 12, 0},
-            {2047, 13, 0},
-            {2007, 14, 0},
-            {2023, 15, 0},
-            {2007, 16, 0},
-            {2019, 17, 0},
-            {2012, 18, 0},
-            {3006, 19, 0},
-            {3002, 20, 0},
-            {3002, 21, 0},
-            {3002, 22, 0},
-            {2011, 23, 0},
-            {2014, 24, 0},
-            {2014, 25, 0},
-            {2015, 26, 0},
-            {2015, 27, 0},
-            {2014, 28, 0},
-            {3005, 29, 0},
-            {3005, 30, 0},
-            {3002, 31, 0},
-            {3002, 32, 0},
-            {3002, 33, 0},
-            {3002, 34, 0},
-            {3004, 35, 0},
-            {9, 36, 0},
-            {3006, 37, 0},
-            {3004, 38, 0},
-            {3004, 39, 0},
-            {3006, 40, 0},
-            {2014, 41, 0},
-            {2014, 42, 0},
-            {2014, 43, 0},
-            {2014, 44, 0},
-            {2014, 45, 0},
-            {2002, 46, 0},
-            {2014, 47, 0},
-            {2014, 48, 0},
-            {2014, 49, 0},
-            {2014, 50, 0},
-            {2022, 51, 0},
-            {2011, 52, 0},
-            {2011, 53, 0},
-            {2011, 54, 0},
-            {2011, 55, 0},
-            {2011, 56, 0},
-            {2011, 57, 0},
-            {2011, 58, 0},
-            {2011, 59, 0},
-            {3001, 60, 0},
-            {3001, 61, 0},
-            {3001, 62, 0},
-            {3002, 63, 0},
-            {2007, 64, 0},
-            {2007, 65, 0},
-            {9, 66, 0},
-            {9, 67, 0},
-            {3002, 68, 0},
-            {2014, 69, 0},
-            {2014, 70, 0},
-            {2014, 71, 0},
-            {2049, 72, 0},
-            {2048, 73, 0},
-            {2011, 74, 0},
-            {3001, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3002, 79, 0},
-            {3002, 80, 0},
-            {3003, 81, 0},
-            {3002, 82, 0},
-            {3006, 83, 0},
-            {3006, 84, 0},
-            {3006, 85, 0},
-            {3006, 86, 0},
-            {40, 87, 0},
-            {3005, 88, 0},
-            {2048, 89, 0},
-            {2015, 90, 0},
-            {2015, 91, 0},
-            {2015, 92, 0},
-            {2011, 93, 0},
-            {2047, 94, 0},
-            {2011, 95, 0},
-            {2008, 96, 0},
-            {2007, 97, 0},
-            {2008, 98, 0},
-            {2014, 99, 0},
-            {2018, 100, 0},
-            {2014, 101, 0},
-            {3002, 102, 0},
-            {3002, 103, 0},
-            {3002, 104, 0},
-            {2014, 105, 0},
-            {2014, 106, 0},
-            {2014, 107, 0},
-            {2014, 108, 0},
-            {3001, 109, 0},
-            {3001, 110, 0},
-            {3001, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {39, 114, 0},
-            {2007, 115, 0},
-            {2007, 116, 0},
-            {2011, 117, 0},
-            {3002, 118, 0},
-            {3002, 119, 0},
-            {3002, 120, 0},
-            {2022, 121, 0},
-            {2049, 122, 0},
-            {2014, 123, 0},
-            {2014, 124, 0},
-            {2011, 125, 0},
-            {2011, 126, 0},
-            {2011, 127, 0},
-            {2011, 128, 0},
-            {3006, 129, 0},
-            {9, 130, 0},
-            {3004, 131, 0},
-            {9, 132, 0},
-            {3004, 133, 0},
-            {38, 134, 0},
-            {3006, 135, 0},
-            {3002, 136, 0},
-            {3004, 137, 0},
-            {3004, 138, 0},
-            {3004, 139, 0},
-            {3004, 140, 0},
-            {3004, 141, 0},
-            {3001, 142, 0},
-            {3006, 143, 0},
-            {3002, 144, 0},
-            {3005, 145, 0},
-            {3003, 146, 0},
-            {2012, 147, 0},
-            {2012, 148, 0},
-            {2012, 149, 0},
-            {2012, 150, 0},
-            {2012, 151, 0},
-            {2012, 152, 0},
-            {2012, 153, 0},
-            {2012, 154, 0},
-            {2012, 155, 0},
-            {2012, 156, 0},
-            {2012, 157, 0},
-            {2012, 158, 0},
-            {2049, 159, 0},
-            {8, 160, 0},
-            {2025, 161, 0},
-            {2012, 162, 0},
-            {2012, 163, 0},
-            {3002, 164, 0},
-            {3002, 165, 0},
-            {3002, 166, 0},
-            {3002, 167, 0},
-            {3002, 168, 0},
-            {2048, 169, 0},
-            {2019, 170, 0},
-            {3001, 171, 0},
-            {3001, 172, 0},
-            {3001, 173, 0},
-            {3001, 174, 0},
-            {3004, 175, 0},
-            {3004, 176, 0},
-            {3005, 177, 0},
-            {2035, 178, 0},
-            {2035, 179, 0},
-            {2035, 180, 0},
-            {2007, 181, 0},
-            {2024, 182, 0},
-            {2015, 183, 0},
-            {3002, 184, 0},
-            {3005, 185, 0},
-            {3004, 186, 0},
-            {3005, 187, 0},
-            {3004, 188, 0},
-            {3004, 189, 0},
-            {9, 190, 0},
-            {3004, 191, 0},
-            {3004, 192, 0},
-            {9, 193, 0},
-            {3004, 194, 0},
-            {3004, 195, 0},
-            {9, 196, 0},
-            {3004, 197, 0},
-            {2011, 198, 0},
-            {2049, 199, 0},
-            {2014, 200, 0},
-            {2014, 201, 0},
-            {2014, 202, 0},
-            {2014, 203, 0},
-            {2014, 204, 0},
-            {2014, 205, 0},
-            {2006, 206, 0},
-            {3001, 207, 0},
-            {3001, 208, 0},
-            {3001, 209, 0},
-            {3001, 210, 0},
-            {2014, 211, 0},
-            {2014, 212, 0},
-            {2014, 213, 0},
-            {2014, 214, 0},
-            {2014, 215, 0},
-            {2014, 216, 0},
-            {2014, 217, 0},
-            {2014, 218, 0},
-            {3003, 219, 0},
-            {2013, 220, 0},
-            {2035, 221, 0},
-            {2035, 222, 0},
-            {2035, 223, 0},
-            {2035, 224, 0},
-            {2007, 225, 0},
-            {2008, 226, 0},
-            {2011, 227, 0},
-            {2011, 228, 0},
-            {2046, 229, 0},
-            {2046, 230, 0},
-            {2046, 231, 0},
-            {2046, 232, 0},
-            {2046, 233, 0},
-            {3002, 234, 0},
-            {3002, 235, 0},
-            {2046, 236, 0},
-            {2012, 237, 0},
-            {2012, 238, 0},
-            {17, 239, 0},
-            {17, 240, 0},
-            {2048, 241, 0},
-            {2018, 242, 0},
-            {2003, 243, 0},
-            {14, 244, 0},
-            {14, 245, 0},
-            {2035, 246, 0},
-            {2035, 247, 0},
-            {2049, 248, 0},
-            {2048, 249, 0},
-            {2049, 250, 0},
-            {2047, 251, 0},
-            {3001, 252, 0},
-            {3005, 253, 0},
-            {3005, 254, 0},
-            {3002, 255, 0},
-            {3002, 256, 0},
-            {3005, 257, 0},
-            {3002, 258, 0},
-            {3002, 259, 0},
-            {3005, 260, 0},
-            {58, 261, 0},
-            {3004, 262, 0},
-            {3004, 263, 0},
-            {3004, 264, 0},
-            {3004, 265, 0},
-            {9, 266, 0},
-            {9, 267, 0},
-            {9, 268, 0},
-            {9, 269, 0},
-            {3002, 270, 0},
-            {3005, 271, 0},
-            {2035, 272, 0},
-            {2035, 273, 0},
-            {2035, 274, 0},
-            {3002, 275, 0},
-            {2035, 276, 0},
-            {2035, 277, 0},
-            {2035, 278, 0},
-            {3002, 279, 0},
-            {62, 280, 0},
-            {62, 281, 0},
-            {34, 282, 0},
-            {62, 283, 0},
-            {42, 284, 0},
-            {42, 285, 0},
-            {42, 286, 0},
-            {29, 287, 0},
-            {35, 288, 0},
-            {35, 289, 0},
-            {35, 290, 0},
-            {35, 291, 0},
-            {24, 292, 0},
-            {24, 293, 0},
-            {42, 294, 0},
-            {26, 295, 0},
-            {24, 296, 0},
-            {24, 297, 0},
-            {15, 298, 0},
-            {12, 299, 0},
-            {27, 300, 0},
-            {29, 301, 0},
-            {29, 302, 0},
-            {63, 303, 0},
-            {32, 304, 0},
-            {32, 305, 0},
-            {57, 306, 0},
-            {57, 307, 0},
-            {57, 308, 0},
-            {57, 309, 0},
-            {2011, 310, 0},
-            {2007, 311, 0},
-            {2012, 312, 0},
-            {2007, 313, 0},
-            {2007, 314, 0},
-            {2007, 315, 0},
-            {2007, 316, 0},
-            {2008, 317, 0},
-            {2018, 318, 0},
-            {2049, 319, 0},
-            {2008, 320, 0},
-            {2008, 321, 0},
-            {11, 322, 0},
-            {11, 323, 0},
-            {11, 324, 0},
-            {11, 325, 0},
-            {3002, 326, 0},
-            {3002, 327, 0},
-            {3002, 328, 0},
-            {3002, 329, 0},
-            {2010, 330, 0},
-            {2010, 331, 0},
-            {2012, 332, 0},
-            {58, 333, 0},
-            {3002, 334, 0},
-            {58, 335, 0},
-            {3002, 336, 0},
-            {9, 337, 0},
-            {9, 338, 0},
-            {3002, 339, 0},
-            {3002, 340, 0},
-            {3002, 341, 0},
-            {3002, 342, 0},
-            {3002, 343, 0},
-            {9, 344, 0},
-            {9, 345, 0},
-            {9, 346, 0},
-            {9, 347, 0},
-            {3006, 348, 0},
-            {3006, 349, 0},
-            {3006, 350, 0},
-            {3001, 351, 0},
-            {58, 352, 0},
-            {3006, 353, 0},
-            {3006, 354, 0},
-            {3006, 355, 0},
-            {3006, 356, 0},
-            {3006, 357, 0},
-            {3006, 358, 0},
-            {3006, 359, 0},
-            {3006, 360, 0},
-            {58, 361, 0},
-            {3002, 362, 0},
-            {3002, 363, 0},
-            {3002, 364, 0},
-            {3002, 365, 0},
-            {3002, 366, 0},
-            {3001, 367, 0},
-            {3001, 368, 0},
-            {3001, 369, 0},
-            {3002, 370, 0},
-            {3005, 371, 0},
-            {42, 372, 0},
-            {42, 373, 0},
-        }},
-        {"Unholy Cathedral (E3M5)", {true, true, false}, {1, 1, 0}, 14, 291, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3002, 4, 0},
-            {3002, 5, 0},
-            {3002, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3002, 9, 0},
-            {14, 10, 0},
-            {2045, 11, 0},
-            {3002, 12, 0},
-            {2014, 13, 0},
-            {2014, 14, 0},
-            {2014, 15, 0},
-            {2014, 16, 0},
-            {3006, 17, 0},
-            {2049, 18, 0},
-            {3001, 19, 0},
-            {3001, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3001, 25, 0},
-            {3001, 26, 0},
-            {2025, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3002, 31, 0},
-            {17, 32, 0},
-            {2011, 33, 0},
-            {2011, 34, 0},
-            {2011, 35, 0},
-            {2011, 36, 0},
-            {2014, 37, 0},
-            {2014, 38, 0},
-            {2014, 39, 0},
-            {2014, 40, 0},
-            {2014, 41, 0},
-            {2014, 42, 0},
-            {2014, 43, 0},
-            {3002, 44, 0},
-            {3001, 45, 0},
-            {2048, 46, 0},
-            {2010, 47, 0},
-            {3006, 48, 0},
-            {3006, 49, 0},
-            {3006, 50, 0},
-            {3006, 51, 0},
-            {3006, 52, 0},
-            {3006, 53, 0},
-            {40, 54, 0},
-            {2002, 55, 0},
-            {3003, 56, 0},
-            {3003, 57, 0},
-            {3003, 58, 0},
-            {3005, 59, 0},
-            {3005, 60, 0},
-            {3005, 61, 0},
-            {3002, 62, 0},
-            {3001, 63, 0},
-            {3002, 64, 0},
-            {3002, 65, 0},
-            {3001, 66, 0},
-            {3001, 67, 0},
-            {3005, 68, 0},
-            {3005, 69, 0},
-            {3005, 70, 0},
-            {2011, 71, 0},
-            {2011, 72, 0},
-            {2011, 73, 0},
-            {2007, 74, 0},
-            {2007, 75, 0},
-            {2015, 76, 0},
-            {2015, 77, 0},
-            {2008, 78, 0},
-            {2012, 79, 0},
-            {2012, 80, 0},
-            {2012, 81, 0},
-            {2012, 82, 0},
-            {2046, 83, 0},
-            {2012, 84, 0},
-            {17, 85, 0},
-            {2004, 86, 0},
-            {2013, 87, 0},
-            {3002, 88, 0},
-            {39, 89, 0},
-            {2022, 90, 0},
-            {2049, 91, 0},
-            {2048, 92, 0},
-            {2048, 93, 0},
-            {2048, 94, 0},
-            {2048, 95, 0},
-            {2012, 96, 0},
-            {2012, 97, 0},
-            {2014, 98, 0},
-            {2014, 99, 0},
-            {2014, 100, 0},
-            {2014, 101, 0},
-            {2014, 102, 0},
-            {2014, 103, 0},
-            {2014, 104, 0},
-            {2014, 105, 0},
-            {14, 106, 0},
-            {14, 107, 0},
-            {3002, 108, 0},
-            {2014, 109, 0},
-            {2014, 110, 0},
-            {2014, 111, 0},
-            {2014, 112, 0},
-            {2014, 113, 0},
-            {2014, 114, 0},
-            {3002, 115, 0},
-            {3002, 116, 0},
-            {3002, 117, 0},
-            {3002, 118, 0},
-            {3002, 119, 0},
-            {3002, 120, 0},
-            {3002, 121, 0},
-            {2012, 122, 0},
-            {2012, 123, 0},
-            {2012, 124, 0},
-            {2012, 125, 0},
-            {2023, 126, 0},
-            {2015, 127, 0},
-            {2015, 128, 0},
-            {2024, 129, 0},
-            {3002, 130, 0},
-            {2007, 131, 0},
-            {2007, 132, 0},
-            {2005, 133, 0},
-            {14, 134, 0},
-            {3001, 135, 0},
-            {3001, 136, 0},
-            {3001, 137, 0},
-            {3001, 138, 0},
-            {3001, 139, 0},
-            {3001, 140, 0},
-            {3001, 141, 0},
-            {3001, 142, 0},
-            {3006, 143, 0},
-            {3006, 144, 0},
-            {3006, 145, 0},
-            {3006, 146, 0},
-            {3006, 147, 0},
-            {3006, 148, 0},
-            {3001, 149, 0},
-            {3001, 150, 0},
-            {3001, 151, 0},
-            {3001, 152, 0},
-            {3001, 153, 0},
-            {3001, 154, 0},
-            {3001, 155, 0},
-            {3001, 156, 0},
-            {3001, 157, 0},
-            {3001, 158, 0},
-            {3001, 159, 0},
-            {3001, 160, 0},
-            {3001, 161, 0},
-            {3002, 162, 0},
-            {3002, 163, 0},
-            {3002, 164, 0},
-            {3002, 165, 0},
-            {3002, 166, 0},
-            {3002, 167, 0},
-            {3002, 168, 0},
-            {3002, 169, 0},
-            {3002, 170, 0},
-            {3002, 171, 0},
-            {3003, 172, 0},
-            {2047, 173, 0},
-            {2048, 174, 0},
-            {2011, 175, 0},
-            {2049, 176, 0},
-            {2011, 177, 0},
-            {2046, 178, 0},
-            {2047, 179, 0},
-            {2006, 180, 0},
-            {3005, 181, 0},
-            {3002, 182, 0},
-            {3005, 183, 0},
-            {3002, 184, 0},
-            {3005, 185, 0},
-            {3002, 186, 0},
-            {2001, 187, 0},
-            {3001, 188, 0},
-            {2012, 189, 0},
-            {2001, 190, 0},
-            {2011, 191, 0},
-            {2011, 192, 0},
-            {2008, 193, 0},
-            {2008, 194, 0},
-            {2008, 195, 0},
-            {2008, 196, 0},
-            {2008, 197, 0},
-            {2008, 198, 0},
-            {2008, 199, 0},
-            {2008, 200, 0},
-            {2007, 201, 0},
-            {2007, 202, 0},
-            {2007, 203, 0},
-            {2007, 204, 0},
-            {2007, 205, 0},
-            {2007, 206, 0},
-            {2007, 207, 0},
-            {2007, 208, 0},
-            {2011, 209, 0},
-            {2011, 210, 0},
-            {2011, 211, 0},
-            {2011, 212, 0},
-            {2011, 213, 0},
-            {2011, 214, 0},
-            {2011, 215, 0},
-            {2011, 216, 0},
-            {3002, 217, 0},
-            {2003, 218, 0},
-            {2010, 219, 0},
-            {2049, 220, 0},
-            {2010, 221, 0},
-            {2012, 222, 0},
-            {2010, 223, 0},
-            {62, 224, 0},
-            {62, 225, 0},
-            {62, 226, 0},
-            {62, 227, 0},
-            {62, 228, 0},
-            {62, 229, 0},
-            {25, 230, 0},
-            {26, 231, 0},
-            {26, 232, 0},
-            {25, 233, 0},
-            {59, 234, 0},
-            {27, 235, 0},
-            {15, 236, 0},
-            {15, 237, 0},
-            {15, 238, 0},
-            {15, 239, 0},
-            {10, 240, 0},
-            {10, 241, 0},
-            {12, 242, 0},
-            {12, 243, 0},
-            {60, 244, 0},
-            {51, 245, 0},
-            {61, 246, 0},
-            {59, 247, 0},
-            {35, 248, 0},
-            {35, 249, 0},
-            {35, 250, 0},
-            {35, 251, 0},
-            {28, 252, 0},
-            {29, 253, 0},
-            {28, 254, 0},
-            {15, 255, 0},
-            {10, 256, 0},
-            {24, 257, 0},
-            {24, 258, 0},
-            {12, 259, 0},
-            {42, 260, 0},
-            {42, 261, 0},
-            {42, 262, 0},
-            {44, 263, 0},
-            {44, 264, 0},
-            {44, 265, 0},
-            {45, 266, 0},
-            {45, 267, 0},
-            {45, 268, 0},
-            {45, 269, 0},
-            {46, 270, 0},
-            {46, 271, 0},
-            {46, 272, 0},
-            {46, 273, 0},
-            {42, 274, 0},
-            {42, 275, 0},
-            {58, 276, 0},
-            {58, 277, 0},
-            {3003, 278, 0},
-            {58, 279, 0},
-            {58, 280, 0},
-            {3002, 281, 0},
-            {2012, 282, 0},
-            {2008, 283, 0},
-            {2007, 284, 0},
-            {2013, 285, 0},
-            {11, 286, 0},
-            {11, 287, 0},
-            {11, 288, 0},
-            {11, 289, 0},
-            {11, 290, 0},
-        }},
-        {"Mt. Erebus (E3M6)", {true, false, false}, {1, 0, 0}, 17, 335, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3005, 4, 0},
-            {3005, 5, 0},
-            {3005, 6, 0},
-            {3005, 7, 0},
-            {3005, 8, 0},
-            {3005, 9, 0},
-            {63, 10, 0},
-            {10, 11, 0},
-            {44, 12, 0},
-            {56, 13, 0},
-            {36, 14, 0},
-            {44, 15, 0},
-            {24, 16, 0},
-            {55, 17, 0},
-            {55, 18, 0},
-            {12, 19, 0},
-            {3003, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3001, 25, 0},
-            {3001, 26, 0},
-            {9, 27, 0},
-            {2049, 28, 0},
-            {2048, 29, 0},
-            {2010, 30, 0},
-            {2015, 31, 0},
-            {2015, 32, 0},
-            {2015, 33, 0},
-            {2015, 34, 0},
-            {2015, 35, 0},
-            {2015, 36, 0},
-            {2015, 37, 0},
-            {2019, 38, 0},
-            {9, 39, 0},
-            {9, 40, 0},
-            {9, 41, 0},
-            {9, 42, 0},
-            {2012, 43, 0},
-            {2011, 44, 0},
-            {2011, 45, 0},
-            {2011, 46, 0},
-            {2012, 47, 0},
-            {3002, 48, 0},
-            {3001, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {2011, 52, 0},
-            {2018, 53, 0},
-            {2049, 54, 0},
-            {3006, 55, 0},
-            {3006, 56, 0},
-            {3006, 57, 0},
-            {3006, 58, 0},
-            {3006, 59, 0},
-            {3006, 60, 0},
-            {2015, 61, 0},
-            {2011, 62, 0},
-            {2007, 63, 0},
-            {2011, 64, 0},
-            {2011, 65, 0},
-            {2011, 66, 0},
-            {3001, 67, 0},
-            {3001, 68, 0},
-            {3001, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {3001, 72, 0},
-            {9, 73, 0},
-            {9, 74, 0},
-            {3002, 75, 0},
-            {3002, 76, 0},
-            {2049, 77, 0},
-            {2011, 78, 0},
-            {3004, 79, 0},
-            {3004, 80, 0},
-            {3005, 81, 0},
-            {9, 82, 0},
-            {9, 83, 0},
-            {61, 84, 0},
-            {3002, 85, 0},
-            {14, 86, 0},
-            {58, 87, 0},
-            {57, 88, 0},
-            {57, 89, 0},
-            {8, 90, 0},
-            {2008, 91, 0},
-            {2011, 92, 0},
-            {2014, 93, 0},
-            {2014, 94, 0},
-            {2014, 95, 0},
-            {2014, 96, 0},
-            {2014, 97, 0},
-            {2025, 98, 0},
-            {3004, 99, 0},
-            {2022, 100, 0},
-            {2015, 101, 0},
-            {2048, 102, 0},
-            {2002, 103, 0},
-            {2001, 104, 0},
-            {2003, 105, 0},
-            {20, 106, 0},
-            {3002, 107, 0},
-            {3002, 108, 0},
-            {3002, 109, 0},
-            {20, 110, 0},
-            {3001, 111, 0},
-            {3001, 112, 0},
-            {3001, 113, 0},
-            {3001, 114, 0},
-            {3006, 115, 0},
-            {3006, 116, 0},
-            {3001, 117, 0},
-            {3006, 118, 0},
-            {3006, 119, 0},
-            {3006, 120, 0},
-            {3006, 121, 0},
-            {3001, 122, 0},
-            {2046, 123, 0},
-            {2011, 124, 0},
-            {2011, 125, 0},
-            {2011, 126, 0},
-            {2011, 127, 0},
-            {29, 128, 0},
-            {29, 129, 0},
-            {28, 130, 0},
-            {28, 131, 0},
-            {30, 132, 0},
-            {36, 133, 0},
-            {43, 134, 0},
-            {43, 135, 0},
-            {42, 136, 0},
-            {42, 137, 0},
-            {54, 138, 0},
-            {42, 139, 0},
-            {42, 140, 0},
-            {42, 141, 0},
-            {42, 142, 0},
-            {42, 143, 0},
-            {43, 144, 0},
-            {47, 145, 0},
-            {47, 146, 0},
-            {47, 147, 0},
-            {54, 148, 0},
-            {47, 149, 0},
-            {43, 150, 0},
-            {43, 151, 0},
-            {43, 152, 0},
-            {42, 153, 0},
-            {42, 154, 0},
-            {42, 155, 0},
-            {42, 156, 0},
-            {42, 157, 0},
-            {3005, 158, 0},
-            {3005, 159, 0},
-            {3005, 160, 0},
-            {3005, 161, 0},
-            {2025, 162, 0},
-            {58, 163, 0},
-            {58, 164, 0},
-            {2049, 165, 0},
-            {14, 166, 0},
-            {14, 167, 0},
-            {2004, 168, 0},
-            {2012, 169, 0},
-            {2014, 170, 0},
-            {2014, 171, 0},
-            {2014, 172, 0},
-            {2014, 173, 0},
-            {63, 174, 0},
-            {27, 175, 0},
-            {27, 176, 0},
-            {45, 177, 0},
-            {45, 178, 0},
-            {2012, 179, 0},
-            {2018, 180, 0},
-            {2008, 181, 0},
-            {26, 182, 0},
-            {3001, 183, 0},
-            {3001, 184, 0},
-            {3001, 185, 0},
-            {3001, 186, 0},
-            {3001, 187, 0},
-            {3001, 188, 0},
-            {3004, 189, 0},
-            {3004, 190, 0},
-            {3004, 191, 0},
-            {3004, 192, 0},
-            {9, 193, 0},
-            {9, 194, 0},
-            {9, 195, 0},
-            {3001, 196, 0},
-            {3001, 197, 0},
-            {9, 198, 0},
-            {9, 199, 0},
-            {17, 200, 0},
-            {2012, 201, 0},
-            {2012, 202, 0},
-            {34, 203, 0},
-            {34, 204, 0},
-            {14, 205, 0},
-            {2023, 206, 0},
-            {2022, 207, 0},
-            {42, 208, 0},
-            {42, 209, 0},
-            {42, 210, 0},
-            {42, 211, 0},
-            {42, 212, 0},
-            {42, 213, 0},
-            {42, 214, 0},
-            {42, 215, 0},
-            {42, 216, 0},
-            {42, 217, 0},
-            {42, 218, 0},
-            {42, 219, 0},
-            {42, 220, 0},
-            {42, 221, 0},
-            {42, 222, 0},
-            {42, 223, 0},
-            {42, 224, 0},
-            {43, 225, 0},
-            {43, 226, 0},
-            {43, 227, 0},
-            {43, 228, 0},
-            {43, 229, 0},
-            {43, 230, 0},
-            {43, 231, 0},
-            {54, 232, 0},
-            {43, 233, 0},
-            {54, 234, 0},
-            {47, 235, 0},
-            {47, 236, 0},
-            {47, 237, 0},
-            {47, 238, 0},
-            {43, 239, 0},
-            {47, 240, 0},
-            {47, 241, 0},
-            {41, 242, 0},
-            {3005, 243, 0},
-            {3005, 244, 0},
-            {3005, 245, 0},
-            {3005, 246, 0},
-            {3005, 247, 0},
-            {3005, 248, 0},
-            {2013, 249, 0},
-            {40, 250, 0},
-            {40, 251, 0},
-            {9, 252, 0},
-            {9, 253, 0},
-            {9, 254, 0},
-            {9, 255, 0},
-            {9, 256, 0},
-            {3001, 257, 0},
-            {3001, 258, 0},
-            {3001, 259, 0},
-            {3001, 260, 0},
-            {3001, 261, 0},
-            {3001, 262, 0},
-            {3001, 263, 0},
-            {3005, 264, 0},
-            {3005, 265, 0},
-            {3005, 266, 0},
-            {2026, 267, 0},
-            {2011, 268, 0},
-            {2011, 269, 0},
-            {2011, 270, 0},
-            {2008, 271, 0},
-            {2008, 272, 0},
-            {2005, 273, 0},
-            {3006, 274, 0},
-            {3006, 275, 0},
-            {3006, 276, 0},
-            {3006, 277, 0},
-            {3006, 278, 0},
-            {3006, 279, 0},
-            {3005, 280, 0},
-            {3005, 281, 0},
-            {2010, 282, 0},
-            {2011, 283, 0},
-            {3006, 284, 0},
-            {3006, 285, 0},
-            {3006, 286, 0},
-            {3006, 287, 0},
-            {3006, 288, 0},
-            {3006, 289, 0},
-            {3006, 290, 0},
-            {3006, 291, 0},
-            {3006, 292, 0},
-            {3006, 293, 0},
-            {3006, 294, 0},
-            {3006, 295, 0},
-            {3006, 296, 0},
-            {3006, 297, 0},
-            {3006, 298, 0},
-            {3006, 299, 0},
-            {3006, 300, 0},
-            {3006, 301, 0},
-            {2025, 302, 0},
-            {2010, 303, 0},
-            {47, 304, 0},
-            {47, 305, 0},
-            {47, 306, 0},
-            {14, 307, 0},
-            {58, 308, 0},
-            {14, 309, 0},
-            {2008, 310, 0},
-            {2008, 311, 0},
-            {2007, 312, 0},
-            {2011, 313, 0},
-            {2011, 314, 0},
-            {2011, 315, 0},
-            {2011, 316, 0},
-            {2011, 317, 0},
-            {2011, 318, 0},
-            {11, 319, 0},
-            {11, 320, 0},
-            {11, 321, 0},
-            {11, 322, 0},
-            {11, 323, 0},
-            {2025, 324, 0},
-            {2025, 325, 0},
-            {2013, 326, 0},
-            {2012, 327, 0},
-            {17, 328, 0},
-            {2048, 329, 0},
-            {2049, 330, 0},
-            {2046, 331, 0},
-            {2049, 332, 0},
-            {11, 333, 0},
-            {2006, 334, 0},
-        }},
-        {"Limbo (E3M7)", {true, true, true}, {1, 1, 1}, 11, 154, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3002, 4, 0},
-            {3002, 5, 0},
-            {3002, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3002, 9, 0},
-            {3002, 10, 0},
-            {3002, 11, 0},
-            {3002, 12, 0},
-            {3006, 13, 0},
-            {3002, 14, 0},
-            {3002, 15, 0},
-            {2015, 16, 0},
-            {2015, 17, 0},
-            {2015, 18, 0},
-            {3005, 19, 0},
-            {2015, 20, 0},
-            {2025, 21, 0},
-            {40, 22, 0},
-            {14, 23, 0},
-            {14, 24, 0},
-            {14, 25, 0},
-            {14, 26, 0},
-            {14, 27, 0},
-            {14, 28, 0},
-            {2049, 29, 0},
-            {2025, 30, 0},
-            {2012, 31, 0},
-            {2012, 32, 0},
-            {2012, 33, 0},
-            {2012, 34, 0},
-            {2012, 35, 0},
-            {2012, 36, 0},
-            {2012, 37, 0},
-            {2012, 38, 0},
-            {14, 39, 0},
-            {14, 40, 0},
-            {14, 41, 0},
-            {14, 42, 0},
-            {14, 43, 0},
-            {14, 44, 0},
-            {3005, 45, 0},
-            {3005, 46, 0},
-            {3005, 47, 0},
-            {3005, 48, 0},
-            {2013, 49, 0},
-            {2046, 50, 0},
-            {2003, 51, 0},
-            {2025, 52, 0},
-            {2025, 53, 0},
-            {2025, 54, 0},
-            {2025, 55, 0},
-            {2025, 56, 0},
-            {38, 57, 0},
-            {3005, 58, 0},
-            {3005, 59, 0},
-            {8, 60, 0},
-            {14, 61, 0},
-            {2008, 62, 0},
-            {2047, 63, 0},
-            {2047, 64, 0},
-            {2004, 65, 0},
-            {2010, 66, 0},
-            {2018, 67, 0},
-            {2014, 68, 0},
-            {39, 69, 0},
-            {3006, 70, 0},
-            {3006, 71, 0},
-            {3003, 72, 0},
-            {3006, 73, 0},
-            {3006, 74, 0},
-            {3006, 75, 0},
-            {9, 76, 0},
-            {9, 77, 0},
-            {9, 78, 0},
-            {2008, 79, 0},
-            {2008, 80, 0},
-            {2007, 81, 0},
-            {2011, 82, 0},
-            {2018, 83, 0},
-            {2011, 84, 0},
-            {3002, 85, 0},
-            {3002, 86, 0},
-            {2049, 87, 0},
-            {2048, 88, 0},
-            {2012, 89, 0},
-            {2012, 90, 0},
-            {3005, 91, 0},
-            {3005, 92, 0},
-            {3002, 93, 0},
-            {9, 94, 0},
-            {3004, 95, 0},
-            {3004, 96, 0},
-            {3006, 97, 0},
-            {3006, 98, 0},
-            {3006, 99, 0},
-            {3002, 100, 0},
-            {3002, 101, 0},
-            {3002, 102, 0},
-            {9, 103, 0},
-            {9, 104, 0},
-            {9, 105, 0},
-            {9, 106, 0},
-            {2008, 107, 0},
-            {2008, 108, 0},
-            {2008, 109, 0},
-            {2015, 110, 0},
-            {2015, 111, 0},
-            {2019, 112, 0},
-            {2049, 113, 0},
-            {2049, 114, 0},
-            {2010, 115, 0},
-            {2007, 116, 0},
-            {2008, 117, 0},
-            {2007, 118, 0},
-            {3006, 119, 0},
-            {3006, 120, 0},
-            {3006, 121, 0},
-            {9, 122, 0},
-            {2047, 123, 0},
-            {2025, 124, 0},
-            {2025, 125, 0},
-            {2025, 126, 0},
-            {2025, 127, 0},
-            {2006, 128, 0},
-            {62, 129, 0},
-            {62, 130, 0},
-            {61, 131, 0},
-            {62, 132, 0},
-            {2049, 133, 0},
-            {2012, 134, 0},
-            {2011, 135, 0},
-            {2011, 136, 0},
-            {11, 137, 0},
-            {11, 138, 0},
-            {11, 139, 0},
-            {11, 140, 0},
-            {2012, 141, 0},
-            {2012, 142, 0},
-            {2047, 143, 0},
-            {2047, 144, 0},
-            {2047, 145, 0},
-            {2047, 146, 0},
-            {2047, 147, 0},
-            {2047, 148, 0},
-            {2047, 149, 0},
-            {2047, 150, 0},
-            {2047, 151, 0},
-            {2046, 152, 0},
-            {2001, 153, 0},
-        }},
-        {"Dis (E3M8)", {false, false, false}, {0, 0, 0}, 3, 58, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {62, 4, 0},
-            {7, 5, 0},
-            {3003, 6, 0},
-            {2003, 7, 0},
-            {2004, 8, 0},
-            {2010, 9, 0},
-            {2010, 10, 0},
-            {2010, 11, 0},
-            {2010, 12, 0},
-            {2010, 13, 0},
-            {2010, 14, 0},
-            {2010, 15, 0},
-            {2010, 16, 0},
-            {2010, 17, 0},
-            {2010, 18, 0},
-            {2010, 19, 0},
-            {2010, 20, 0},
-            {2010, 21, 0},
-            {2010, 22, 0},
-            {2010, 23, 0},
-            {2010, 24, 0},
-            {2010, 25, 0},
-            {2010, 26, 0},
-            {2010, 27, 0},
-            {2010, 28, 0},
-            {2047, 29, 0},
-            {2047, 30, 0},
-            {2047, 31, 0},
-            {3005, 32, 0},
-            {3005, 33, 0},
-            {2019, 34, 0},
-            {2010, 35, 0},
-            {2010, 36, 0},
-            {2010, 37, 0},
-            {2010, 38, 0},
-            {2010, 39, 0},
-            {2010, 40, 0},
-            {2010, 41, 0},
-            {2010, 42, 0},
-            {2010, 43, 0},
-            {2010, 44, 0},
-            {2010, 45, 0},
-            {2010, 46, 0},
-            {2010, 47, 0},
-            {2010, 48, 0},
-            {2010, 49, 0},
-            {2010, 50, 0},
-            {2010, 51, 0},
-            {2010, 52, 0},
-            {2010, 53, 0},
-            {11, 54, 0},
-            {11, 55, 0},
-            {11, 56, 0},
-            {11, 57, 0},
-        }},
-        {"Warrens (E3M9)", {true, false, true}, {1, 0, 1}, 16, 197, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {3001, 4, 0},
-            {3001, 5, 0},
-            {3001, 6, 0},
-            {3005, 7, 0},
-            {3005, 8, 0},
-            {2048, 9, 0},
-            {2048, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3005, 15, 0},
-            {3002, 16, 0},
-            {2012, 17, 0},
-            {2012, 18, 0},
-            {2008, 19, 0},
-            {2001, 20, 0},
-            {2049, 21, 0},
-            {3002, 22, 0},
-            {3002, 23, 0},
-            {3002, 24, 0},
-            {3002, 25, 0},
-            {3001, 26, 0},
-            {3001, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {2007, 34, 0},
-            {2011, 35, 0},
-            {2011, 36, 0},
-            {2014, 37, 0},
-            {2014, 38, 0},
-            {2015, 39, 0},
-            {2015, 40, 0},
-            {2015, 41, 0},
-            {2015, 42, 0},
-            {2012, 43, 0},
-            {2012, 44, 0},
-            {2012, 45, 0},
-            {2003, 46, 0},
-            {2008, 47, 0},
-            {2011, 48, 0},
-            {2012, 49, 0},
-            {3001, 50, 0},
-            {43, 51, 0},
-            {43, 52, 0},
-            {43, 53, 0},
-            {43, 54, 0},
-            {43, 55, 0},
-            {43, 56, 0},
-            {43, 57, 0},
-            {43, 58, 0},
-            {43, 59, 0},
-            {54, 60, 0},
-            {54, 61, 0},
-            {27, 62, 0},
-            {27, 63, 0},
-            {33, 64, 0},
-            {33, 65, 0},
-            {12, 66, 0},
-            {24, 67, 0},
-            {24, 68, 0},
-            {24, 69, 0},
-            {29, 70, 0},
-            {32, 71, 0},
-            {33, 72, 0},
-            {33, 73, 0},
-            {33, 74, 0},
-            {32, 75, 0},
-            {37, 76, 0},
-            {24, 77, 0},
-            {24, 78, 0},
-            {54, 79, 0},
-            {62, 80, 0},
-            {10, 81, 0},
-            {62, 82, 0},
-            {62, 83, 0},
-            {2008, 84, 0},
-            {11, 85, 0},
-            {11, 86, 0},
-            {11, 87, 0},
-            {11, 88, 0},
-            {2046, 89, 0},
-            {2046, 90, 0},
-            {2046, 91, 0},
-            {2046, 92, 0},
-            {2046, 93, 0},
-            {2046, 94, 0},
-            {2046, 95, 0},
-            {2046, 96, 0},
-            {2046, 97, 0},
-            {2046, 98, 0},
-            {2003, 99, 0},
-            {16, 100, 0},
-            {2013, 101, 0},
-            {2046, 102, 0},
-            {2046, 103, 0},
-            {2046, 104, 0},
-            {2046, 105, 0},
-            {2046, 106, 0},
-            {2046, 107, 0},
-            {40, 108, 0},
-            {3005, 109, 0},
-            {3005, 110, 0},
-            {2049, 111, 0},
-            {2049, 112, 0},
-            {2025, 113, 0},
-            {2023, 114, 0},
-            {3003, 115, 0},
-            {3006, 116, 0},
-            {3006, 117, 0},
-            {3006, 118, 0},
-            {3006, 119, 0},
-            {2022, 120, 0},
-            {2024, 121, 0},
-            {2002, 122, 0},
-            {58, 123, 0},
-            {58, 124, 0},
-            {58, 125, 0},
-            {58, 126, 0},
-            {58, 127, 0},
-            {58, 128, 0},
-            {2048, 129, 0},
-            {2012, 130, 0},
-            {2012, 131, 0},
-            {3005, 132, 0},
-            {3005, 133, 0},
-            {3005, 134, 0},
-            {2004, 135, 0},
-            {2047, 136, 0},
-            {2047, 137, 0},
-            {2022, 138, 0},
-            {2018, 139, 0},
-            {2005, 140, 0},
-            {2006, 141, 0},
-            {2025, 142, 0},
-            {38, 143, 0},
-            {3003, 144, 0},
-            {17, 145, 0},
-            {9, 146, 0},
-            {9, 147, 0},
-            {9, 148, 0},
-            {9, 149, 0},
-            {9, 150, 0},
-            {9, 151, 0},
-            {9, 152, 0},
-            {9, 153, 0},
-            {9, 154, 0},
-            {9, 155, 0},
-            {9, 156, 0},
-            {9, 157, 0},
-            {9, 158, 0},
-            {9, 159, 0},
-            {9, 160, 0},
-            {9, 161, 0},
-            {9, 162, 0},
-            {9, 163, 0},
-            {9, 164, 0},
-            {3005, 165, 0},
-            {3005, 166, 0},
-            {3005, 167, 0},
-            {2048, 168, 0},
-            {2048, 169, 0},
-            {9, 170, 0},
-            {9, 171, 0},
-            {9, 172, 0},
-            {9, 173, 0},
-            {9, 174, 0},
-            {9, 175, 0},
-            {9, 176, 0},
-            {9, 177, 0},
-            {9, 178, 0},
-            {9, 179, 0},
-            {9, 180, 0},
-            {9, 181, 0},
-            {9, 182, 0},
-            {9, 183, 0},
-            {9, 184, 0},
-            {3003, 185, 0},
-            {3003, 186, 0},
-            {3003, 187, 0},
-            {2013, 188, 0},
-            {58, 189, 0},
-            {58, 190, 0},
-            {58, 191, 0},
-            {58, 192, 0},
-            {2012, 193, 0},
-            {14, 194, 0},
-            {3001, 195, 0},
-            {3001, 196, 0},
-        }},
-    },
-    {
-        {"Hell Beneath (E4M1)", {true, false, true}, {1, 0, 1}, 6, 141, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {45, 4, 0},
-            {45, 5, 0},
-            {38, 6, 0},
-            {14, 7, 0},
-            {9, 8, 0},
-            {9, 9, 0},
-            {9, 10, 0},
-            {9, 11, 0},
-            {14, 12, 0},
-            {9, 13, 0},
-            {9, 14, 0},
-            {9, 15, 0},
-            {9, 16, 0},
-            {3001, 17, 0},
-            {3001, 18, 0},
-            {3001, 19, 0},
-            {3001, 20, 0},
-            {58, 21, 0},
-            {58, 22, 0},
-            {2003, 23, 0},
-            {2046, 24, 0},
-            {2046, 25, 0},
-            {46, 26, 0},
-            {46, 27, 0},
-            {14, 28, 0},
-            {3003, 29, 0},
-            {3003, 30, 0},
-            {3003, 31, 0},
-            {3003, 32, 0},
-            {40, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3001, 37, 0},
-            {3001, 38, 0},
-            {58, 39, 0},
-            {58, 40, 0},
-            {58, 41, 0},
-            {58, 42, 0},
-            {58, 43, 0},
-            {58, 44, 0},
-            {3001, 45, 0},
-            {3001, 46, 0},
-            {2001, 47, 0},
-            {2008, 48, 0},
-            {3001, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {3001, 52, 0},
-            {3001, 53, 0},
-            {3001, 54, 0},
-            {45, 55, 0},
-            {14, 56, 0},
-            {14, 57, 0},
-            {2013, 58, 0},
-            {2018, 59, 0},
-            {2012, 60, 0},
-            {2012, 61, 0},
-            {9, 62, 0},
-            {9, 63, 0},
-            {9, 64, 0},
-            {3001, 65, 0},
-            {3001, 66, 0},
-            {3001, 67, 0},
-            {3001, 68, 0},
-            {3001, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {3001, 72, 0},
-            {3001, 73, 0},
-            {9, 74, 0},
-            {9, 75, 0},
-            {58, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {14, 80, 0},
-            {9, 81, 0},
-            {9, 82, 0},
-            {9, 83, 0},
-            {9, 84, 0},
-            {9, 85, 0},
-            {9, 86, 0},
-            {3003, 87, 0},
-            {2012, 88, 0},
-            {2012, 89, 0},
-            {2018, 90, 0},
-            {9, 91, 0},
-            {14, 92, 0},
-            {45, 93, 0},
-            {45, 94, 0},
-            {2008, 95, 0},
-            {2008, 96, 0},
-            {2002, 97, 0},
-            {2007, 98, 0},
-            {24, 99, 0},
-            {24, 100, 0},
-            {24, 101, 0},
-            {24, 102, 0},
-            {24, 103, 0},
-            {24, 104, 0},
-            {24, 105, 0},
-            {60, 106, 0},
-            {60, 107, 0},
-            {62, 108, 0},
-            {62, 109, 0},
-            {24, 110, 0},
-            {24, 111, 0},
-            {11, 112, 0},
-            {11, 113, 0},
-            {11, 114, 0},
-            {11, 115, 0},
-            {2023, 116, 0},
-            {2024, 117, 0},
-            {2004, 118, 0},
-            {2015, 119, 0},
-            {2015, 120, 0},
-            {2015, 121, 0},
-            {2015, 122, 0},
-            {2015, 123, 0},
-            {2015, 124, 0},
-            {2015, 125, 0},
-            {2015, 126, 0},
-            {2015, 127, 0},
-            {2015, 128, 0},
-            {2015, 129, 0},
-            {2015, 130, 0},
-            {2014, 131, 0},
-            {2014, 132, 0},
-            {2014, 133, 0},
-            {2014, 134, 0},
-            {2014, 135, 0},
-            {2014, 136, 0},
-            {2014, 137, 0},
-            {2014, 138, 0},
-            {2014, 139, 0},
-            {2025, 140, 0},
-        }},
-        {"Perfect Hatred (E4M2)", {true, true, false}, {1, 1, 0}, 12, 227, {
-            {1, 0, 0},
-            {57, 1, 0},
-            {57, 2, 0},
-            {56, 3, 0},
-            {56, 4, 0},
-            {2004, 5, 0},
-            {2011, 6, 0},
-            {2025, 7, 0},
-            {46, 8, 0},
-            {46, 9, 0},
-            {2001, 10, 0},
-            {2049, 11, 0},
-            {2047, 12, 0},
-            {17, 13, 0},
-            {2023, 14, 0},
-            {14, 15, 0},
-            {2025, 16, 0},
-            {2013, 17, 0},
-            {45, 18, 0},
-            {45, 19, 0},
-            {2019, 20, 0},
-            {14, 21, 0},
-            {3003, 22, 0},
-            {17, 23, 0},
-            {3003, 24, 0},
-            {3003, 25, 0},
-            {3003, 26, 0},
-            {17, 27, 0},
-            {2012, 28, 0},
-            {39, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {9, 32, 0},
-            {9, 33, 0},
-            {9, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3001, 37, 0},
-            {3001, 38, 0},
-            {3003, 39, 0},
-            {3003, 40, 0},
-            {9, 41, 0},
-            {9, 42, 0},
-            {9, 43, 0},
-            {9, 44, 0},
-            {9, 45, 0},
-            {2018, 46, 0},
-            {2012, 47, 0},
-            {2049, 48, 0},
-            {2014, 49, 0},
-            {2014, 50, 0},
-            {2014, 51, 0},
-            {2014, 52, 0},
-            {2014, 53, 0},
-            {2014, 54, 0},
-            {2015, 55, 0},
-            {2015, 56, 0},
-            {2015, 57, 0},
-            {2015, 58, 0},
-            {2015, 59, 0},
-            {2015, 60, 0},
-            {2015, 61, 0},
-            {2015, 62, 0},
-            {2015, 63, 0},
-            {2015, 64, 0},
-            {2015, 65, 0},
-            {2015, 66, 0},
-            {2015, 67, 0},
-            {2015, 68, 0},
-            {3001, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {3001, 72, 0},
-            {3001, 73, 0},
-            {58, 74, 0},
-            {9, 75, 0},
-            {9, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {3001, 80, 0},
-            {3001, 81, 0},
-            {3001, 82, 0},
-            {3001, 83, 0},
-            {3002, 84, 0},
-            {3002, 85, 0},
-            {3006, 86, 0},
-            {3006, 87, 0},
-            {3006, 88, 0},
-            {3006, 89, 0},
-            {3003, 90, 0},
-            {3003, 91, 0},
-            {3003, 92, 0},
-            {2003, 93, 0},
-            {2046, 94, 0},
-            {2046, 95, 0},
-            {2046, 96, 0},
-            {2035, 97, 0},
-            {2035, 98, 0},
-            {16, 99, 0},
-            {14, 100, 0},
-            {3005, 101, 0},
-            {3005, 102, 0},
-            {3005, 103, 0},
-            {3005, 104, 0},
-            {3005, 105, 0},
-            {3005, 106, 0},
-            {2047, 107, 0},
-            {2047, 108, 0},
-            {2047, 109, 0},
-            {2047, 110, 0},
-            {2049, 111, 0},
-            {2047, 112, 0},
-            {2049, 113, 0},
-            {2047, 114, 0},
-            {2047, 115, 0},
-            {2049, 116, 0},
-            {2049, 117, 0},
-            {2049, 118, 0},
-            {2049, 119, 0},
-            {3005, 120, 0},
-            {58, 121, 0},
-            {58, 122, 0},
-            {58, 123, 0},
-            {58, 124, 0},
-            {58, 125, 0},
-            {2005, 126, 0},
-            {58, 127, 0},
-            {58, 128, 0},
-            {58, 129, 0},
-            {58, 130, 0},
-            {3005, 131, 0},
-            {3005, 132, 0},
-            {3003, 133, 0},
-            {3003, 134, 0},
-            {17, 135, 0},
-            {17, 136, 0},
-            {17, 137, 0},
-            {17, 138, 0},
-            {17, 139, 0},
-            {3006, 140, 0},
-            {3006, 141, 0},
-            {3006, 142, 0},
-            {3006, 143, 0},
-            {3006, 144, 0},
-            {3006, 145, 0},
-            {3006, 146, 0},
-            {3006, 147, 0},
-            {3006, 148, 0},
-            {3006, 149, 0},
-            {3006, 150, 0},
-            {2018, 151, 0},
-            {56, 152, 0},
-            {56, 153, 0},
-            {47, 154, 0},
-            {47, 155, 0},
-            {47, 156, 0},
-            {47, 157, 0},
-            {47, 158, 0},
-            {47, 159, 0},
-            {47, 160, 0},
-            {47, 161, 0},
-            {47, 162, 0},
-            {47, 163, 0},
-            {47, 164, 0},
-            {47, 165, 0},
-            {47, 166, 0},
-            {40, 167, 0},
-            {2012, 168, 0},
-            {2012, 169, 0},
-            {2012, 170, 0},
-            {2012, 171, 0},
-            {2012, 172, 0},
-            {2012, 173, 0},
-            {2012, 174, 0},
-            {2012, 175, 0},
-            {2012, 176, 0},
-            {36, 177, 0},
-            {41, 178, 0},
-            {37, 179, 0},
-            {41, 180, 0},
-            {57, 181, 0},
-            {57, 182, 0},
-            {55, 183, 0},
-            {55, 184, 0},
-            {3002, 185, 0},
-            {3002, 186, 0},
-            {3002, 187, 0},
-            {3002, 188, 0},
-            {3002, 189, 0},
-            {3002, 190, 0},
-            {3005, 191, 0},
-            {3005, 192, 0},
-            {3005, 193, 0},
-            {3005, 194, 0},
-            {3005, 195, 0},
-            {3005, 196, 0},
-            {3005, 197, 0},
-            {3005, 198, 0},
-            {2046, 199, 0},
-            {2046, 200, 0},
-            {2046, 201, 0},
-            {2046, 202, 0},
-            {2046, 203, 0},
-            {2046, 204, 0},
-            {17, 205, 0},
-            {17, 206, 0},
-            {17, 207, 0},
-            {2012, 208, 0},
-            {2012, 209, 0},
-            {2012, 210, 0},
-            {2012, 211, 0},
-            {35, 212, 0},
-            {35, 213, 0},
-            {2025, 214, 0},
-            {2025, 215, 0},
-            {14, 216, 0},
-            {2006, 217, 0},
-            {11, 218, 0},
-            {11, 219, 0},
-            {11, 220, 0},
-            {11, 221, 0},
-            {11, 222, 0},
-            {3003, 223, 0},
-            {2, 224, 0},
-            {3, 225, 0},
-            {4, 226, 0},
-        }},
-        {"Sever the Wicked (E4M3)", {true, false, true}, {1, 0, 1}, 16, 384, {
-            {11, 0, 0},
-            {3, 1, 0},
-            {4, 2, 0},
-            {1, 3, 0},
-            {2047, 4, 0},
-            {2047, 5, 0},
-            {2047, 6, 0},
-            {17, 7, 0},
-            {2046, 8, 0},
-            {2022, 9, 0},
-            {46, 10, 0},
-            {46, 11, 0},
-            {2025, 12, 0},
-            {44, 13, 0},
-            {44, 14, 0},
-            {44, 15, 0},
-            {44, 16, 0},
-            {44, 17, 0},
-            {44, 18, 0},
-            {44, 19, 0},
-            {44, 20, 0},
-            {2023, 21, 0},
-            {2024, 22, 0},
-            {8, 23, 0},
-            {2, 24, 0},
-            {2004, 25, 0},
-            {14, 26, 0},
-            {38, 27, 0},
-            {40, 28, 0},
-            {8, 29, 0},
-            {2010, 30, 0},
-            {2010, 31, 0},
-            {2049, 32, 0},
-            {2049, 33, 0},
-            {2008, 34, 0},
-            {2008, 35, 0},
-            {2008, 36, 0},
-            {2008, 37, 0},
-            {2005, 38, 0},
-            {2019, 39, 0},
-            {2011, 40, 0},
-            {2011, 41, 0},
-            {9, 42, 0},
-            {9, 43, 0},
-            {9, 44, 0},
-            {9, 45, 0},
-            {9, 46, 0},
-            {9, 47, 0},
-            {3001, 48, 0},
-            {3001, 49, 0},
-            {9, 50, 0},
-            {3001, 51, 0},
-            {3005, 52, 0},
-            {9, 53, 0},
-            {9, 54, 0},
-            {9, 55, 0},
-            {2012, 56, 0},
-            {9, 57, 0},
-            {9, 58, 0},
-            {3004, 59, 0},
-            {3004, 60, 0},
-            {3004, 61, 0},
-            {3004, 62, 0},
-            {3004, 63, 0},
-            {3004, 64, 0},
-            {3001, 65, 0},
-            {3001, 66, 0},
-            {3001, 67, 0},
-            {3001, 68, 0},
-            {3001, 69, 0},
-            {3003, 70, 0},
-            {9, 71, 0},
-            {9, 72, 0},
-            {9, 73, 0},
-            {9, 74, 0},
-            {3001, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {9, 79, 0},
-            {9, 80, 0},
-            {9, 81, 0},
-            {3001, 82, 0},
-            {3001, 83, 0},
-            {3001, 84, 0},
-            {9, 85, 0},
-            {9, 86, 0},
-            {3001, 87, 0},
-            {3001, 88, 0},
-            {3001, 89, 0},
-            {3001, 90, 0},
-            {9, 91, 0},
-            {9, 92, 0},
-            {2024, 93, 0},
-            {2013, 94, 0},
-            {2019, 95, 0},
-            {2022, 96, 0},
-            {2049, 97, 0},
-            {2049, 98, 0},
-            {2049, 99, 0},
-            {2049, 100, 0},
-            {2049, 101, 0},
-            {2049, 102, 0},
-            {3001, 103, 0},
-            {3001, 104, 0},
-            {3001, 105, 0},
-            {3001, 106, 0},
-            {2046, 107, 0},
-            {2046, 108, 0},
-            {2046, 109, 0},
-            {2046, 110, 0},
-            {2046, 111, 0},
-            {2046, 112, 0},
-            {2047, 113, 0},
-            {2046, 114, 0},
-            {2046, 115, 0},
-            {2046, 116, 0},
-            {2047, 117, 0},
-            {2047, 118, 0},
-            {2047, 119, 0},
-            {2047, 120, 0},
-            {2047, 121, 0},
-            {2047, 122, 0},
-            {2047, 123, 0},
-            {2014, 124, 0},
-            {2014, 125, 0},
-            {2014, 126, 0},
-            {2014, 127, 0},
-            {2014, 128, 0},
-            {2014, 129, 0},
-            {2014, 130, 0},
-            {2014, 131, 0},
-            {2014, 132, 0},
-            {2014, 133, 0},
-            {2014, 134, 0},
-            {2014, 135, 0},
-            {2014, 136, 0},
-            {2014, 137, 0},
-            {2014, 138, 0},
-            {2014, 139, 0},
-            {2014, 140, 0},
-            {2014, 141, 0},
-            {2014, 142, 0},
-            {2014, 143, 0},
-            {2014, 144, 0},
-            {2014, 145, 0},
-            {2014, 146, 0},
-            {2014, 147, 0},
-            {2014, 148, 0},
-            {2014, 149, 0},
-            {2014, 150, 0},
-            {2014, 151, 0},
-            {2014, 152, 0},
-            {2014, 153, 0},
-            {2014, 154, 0},
-            {2014, 155, 0},
-            {2014, 156, 0},
-            {2004, 157, 0},
-            {9, 158, 0},
-            {9, 159, 0},
-            {9, 160, 0},
-            {3002, 161, 0},
-            {3001, 162, 0},
-            {3001, 163, 0},
-            {3001, 164, 0},
-            {9, 165, 0},
-            {9, 166, 0},
-            {9, 167, 0},
-            {9, 168, 0},
-            {58, 169, 0},
-            {58, 170, 0},
-            {58, 171, 0},
-            {3006, 172, 0},
-            {3006, 173, 0},
-            {3002, 174, 0},
-            {3002, 175, 0},
-            {3002, 176, 0},
-            {3002, 177, 0},
-            {2002, 178, 0},
-            {2012, 179, 0},
-            {2012, 180, 0},
-            {2048, 181, 0},
-            {2048, 182, 0},
-            {2048, 183, 0},
-            {2048, 184, 0},
-            {2001, 185, 0},
-            {2008, 186, 0},
-            {2008, 187, 0},
-            {2008, 188, 0},
-            {2008, 189, 0},
-            {2006, 190, 0},
-            {17, 191, 0},
-            {17, 192, 0},
-            {3001, 193, 0},
-            {3001, 194, 0},
-            {3001, 195, 0},
-            {3001, 196, 0},
-            {3001, 197, 0},
-            {3001, 198, 0},
-            {3001, 199, 0},
-            {3001, 200, 0},
-            {3006, 201, 0},
-            {3006, 202, 0},
-            {3006, 203, 0},
-            {3006, 204, 0},
-            {3006, 205, 0},
-            {3006, 206, 0},
-            {3006, 207, 0},
-            {3006, 208, 0},
-            {3002, 209, 0},
-            {58, 210, 0},
-            {58, 211, 0},
-            {9, 212, 0},
-            {9, 213, 0},
-            {9, 214, 0},
-            {9, 215, 0},
-            {3003, 216, 0},
-            {3005, 217, 0},
-            {9, 218, 0},
-            {9, 219, 0},
-            {2048, 220, 0},
-            {2048, 221, 0},
-            {2048, 222, 0},
-            {2048, 223, 0},
-            {2048, 224, 0},
-            {2048, 225, 0},
-            {2048, 226, 0},
-            {2010, 227, 0},
-            {2010, 228, 0},
-            {2010, 229, 0},
-            {2010, 230, 0},
-            {2010, 231, 0},
-            {2010, 232, 0},
-            {2010, 233, 0},
-            {3006, 234, 0},
-            {3006, 235, 0},
-            {3005, 236, 0},
-            {3005, 237, 0},
-            {3003, 238, 0},
-            {3003, 239, 0},
-            {3001, 240, 0},
-            {9, 241, 0},
-            {9, 242, 0},
-            {9, 243, 0},
-            {9, 244, 0},
-            {9, 245, 0},
-            {3004, 246, 0},
-            {3004, 247, 0},
-            {3004, 248, 0},
-            {3004, 249, 0},
-            {9, 250, 0},
-            {9, 251, 0},
-            {9, 252, 0},
-            {9, 253, 0},
-            {2001, 254, 0},
-            {2049, 255, 0},
-            {3001, 256, 0},
-            {3001, 257, 0},
-            {3001, 258, 0},
-            {3001, 259, 0},
-            {3001, 260, 0},
-            {3002, 261, 0},
-            {3002, 262, 0},
-            {9, 263, 0},
-            {9, 264, 0},
-            {9, 265, 0},
-            {58, 266, 0},
-            {58, 267, 0},
-            {58, 268, 0},
-            {3001, 269, 0},
-            {3001, 270, 0},
-            {9, 271, 0},
-            {9, 272, 0},
-            {9, 273, 0},
-            {2012, 274, 0},
-            {2012, 275, 0},
-            {2012, 276, 0},
-            {2012, 277, 0},
-            {2007, 278, 0},
-            {2007, 279, 0},
-            {2007, 280, 0},
-            {2007, 281, 0},
-            {2007, 282, 0},
-            {2007, 283, 0},
-            {2007, 284, 0},
-            {2008, 285, 0},
-            {2008, 286, 0},
-            {2008, 287, 0},
-            {2008, 288, 0},
-            {2008, 289, 0},
-            {2008, 290, 0},
-            {2008, 291, 0},
-            {11, 292, 0},
-            {11, 293, 0},
-            {11, 294, 0},
-            {46, 295, 0},
-            {46, 296, 0},
-            {46, 297, 0},
-            {46, 298, 0},
-            {2003, 299, 0},
-            {2010, 300, 0},
-            {2010, 301, 0},
-            {2010, 302, 0},
-            {2010, 303, 0},
-            {2024, 304, 0},
-            {14, 305, 0},
-            {14, 306, 0},
-            {30, 307, 0},
-            {30, 308, 0},
-            {30, 309, 0},
-            {30, 310, 0},
-            {30, 311, 0},
-            {30, 312, 0},
-            {30, 313, 0},
-            {2012, 314, 0},
-            {2012, 315, 0},
-            {2046, 316, 0},
-            {2046, 317, 0},
-            {2046, 318, 0},
-            {2046, 319, 0},
-            {2012, 320, 0},
-            {2012, 321, 0},
-            {58, 322, 0},
-            {58, 323, 0},
-            {3005, 324, 0},
-            {3005, 325, 0},
-            {3003, 326, 0},
-            {3003, 327, 0},
-            {58, 328, 0},
-            {49, 329, 0},
-            {44, 330, 0},
-            {44, 331, 0},
-            {44, 332, 0},
-            {44, 333, 0},
-            {44, 334, 0},
-            {44, 335, 0},
-            {44, 336, 0},
-            {2008, 337, 0},
-            {2010, 338, 0},
-            {2008, 339, 0},
-            {2010, 340, 0},
-            {2008, 341, 0},
-            {2008, 342, 0},
-            {2010, 343, 0},
-            {2008, 344, 0},
-            {2010, 345, 0},
-            {2008, 346, 0},
-            {9, 347, 0},
-            {3001, 348, 0},
-            {9, 349, 0},
-            {58, 350, 0},
-            {3001, 351, 0},
-            {58, 352, 0},
-            {44, 353, 0},
-            {52, 354, 0},
-            {51, 355, 0},
-            {27, 356, 0},
-            {58, 357, 0},
-            {58, 358, 0},
-            {9, 359, 0},
-            {9, 360, 0},
-            {9, 361, 0},
-            {2011, 362, 0},
-            {2011, 363, 0},
-            {2011, 364, 0},
-            {2011, 365, 0},
-            {2003, 366, 0},
-            {2046, 367, 0},
-            {3003, 368, 0},
-            {58, 369, 0},
-            {58, 370, 0},
-            {9, 371, 0},
-            {9, 372, 0},
-            {9, 373, 0},
-            {9, 374, 0},
-            {2046, 375, 0},
-            {2046, 376, 0},
-            {2046, 377, 0},
-            {2046, 378, 0},
-            {2046, 379, 0},
-            {2046, 380, 0},
-            {2046, 381, 0},
-            {2046, 382, 0},
-            {2046, 383, 0},
-        }},
-        {"Unruly Evil (E4M4)", {false, false, true}, {0, 0, 1}, 8, 153, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {46, 4, 0},
-            {46, 5, 0},
-            {46, 6, 0},
-            {14, 7, 0},
-            {45, 8, 0},
-            {2003, 9, 0},
-            {2046, 10, 0},
-            {2046, 11, 0},
-            {2046, 12, 0},
-            {2004, 13, 0},
-            {17, 14, 0},
-            {2023, 15, 0},
-            {38, 16, 0},
-            {3001, 17, 0},
-            {3001, 18, 0},
-            {3001, 19, 0},
-            {3001, 20, 0},
-            {3001, 21, 0},
-            {3001, 22, 0},
-            {3001, 23, 0},
-            {9, 24, 0},
-            {9, 25, 0},
-            {46, 26, 0},
-            {46, 27, 0},
-            {46, 28, 0},
-            {46, 29, 0},
-            {3002, 30, 0},
-            {3002, 31, 0},
-            {3002, 32, 0},
-            {3001, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3001, 36, 0},
-            {3001, 37, 0},
-            {3001, 38, 0},
-            {3001, 39, 0},
-            {58, 40, 0},
-            {58, 41, 0},
-            {58, 42, 0},
-            {9, 43, 0},
-            {9, 44, 0},
-            {9, 45, 0},
-            {9, 46, 0},
-            {3001, 47, 0},
-            {3001, 48, 0},
-            {3001, 49, 0},
-            {3001, 50, 0},
-            {3001, 51, 0},
-            {3001, 52, 0},
-            {3001, 53, 0},
-            {3001, 54, 0},
-            {2013, 55, 0},
-            {2002, 56, 0},
-            {2007, 57, 0},
-            {2048, 58, 0},
-            {2012, 59, 0},
-            {2012, 60, 0},
-            {2001, 61, 0},
-            {2008, 62, 0},
-            {2049, 63, 0},
-            {14, 64, 0},
-            {14, 65, 0},
-            {2008, 66, 0},
-            {2006, 67, 0},
-            {2024, 68, 0},
-            {2001, 69, 0},
-            {11, 70, 0},
-            {11, 71, 0},
-            {11, 72, 0},
-            {11, 73, 0},
-            {11, 74, 0},
-            {11, 75, 0},
-            {2019, 76, 0},
-            {2010, 77, 0},
-            {2010, 78, 0},
-            {2010, 79, 0},
-            {2010, 80, 0},
-            {2022, 81, 0},
-            {2012, 82, 0},
-            {2012, 83, 0},
-            {14, 84, 0},
-            {2008, 85, 0},
-            {9, 86, 0},
-            {9, 87, 0},
-            {9, 88, 0},
-            {9, 89, 0},
-            {9, 90, 0},
-            {9, 91, 0},
-            {3001, 92, 0},
-            {3001, 93, 0},
-            {3001, 94, 0},
-            {3001, 95, 0},
-            {3001, 96, 0},
-            {3001, 97, 0},
-            {3001, 98, 0},
-            {3001, 99, 0},
-            {3001, 100, 0},
-            {3001, 101, 0},
-            {3001, 102, 0},
-            {3005, 103, 0},
-            {3005, 104, 0},
-            {3005, 105, 0},
-            {58, 106, 0},
-            {58, 107, 0},
-            {3005, 108, 0},
-            {3005, 109, 0},
-            {58, 110, 0},
-            {58, 111, 0},
-            {2008, 112, 0},
-            {2012, 113, 0},
-            {2012, 114, 0},
-            {2022, 115, 0},
-            {2013, 116, 0},
-            {2007, 117, 0},
-            {2007, 118, 0},
-            {2023, 119, 0},
-            {46, 120, 0},
-            {46, 121, 0},
-            {46, 122, 0},
-            {46, 123, 0},
-            {2025, 124, 0},
-            {2015, 125, 0},
-            {2015, 126, 0},
-            {2015, 127, 0},
-            {2015, 128, 0},
-            {2015, 129, 0},
-            {2015, 130, 0},
-            {2015, 131, 0},
-            {2015, 132, 0},
-            {3005, 133, 0},
-            {3005, 134, 0},
-            {14, 135, 0},
-            {17, 136, 0},
-            {2046, 137, 0},
-            {2025, 138, 0},
-            {2012, 139, 0},
-            {2012, 140, 0},
-            {2012, 141, 0},
-            {2014, 142, 0},
-            {2014, 143, 0},
-            {2014, 144, 0},
-            {2014, 145, 0},
-            {2014, 146, 0},
-            {2014, 147, 0},
-            {2014, 148, 0},
-            {2014, 149, 0},
-            {2014, 150, 0},
-            {2014, 151, 0},
-            {2014, 152, 0},
-        }},
-        {"They Will Repent (E4M5)", {true, true, true}, {1, 1, 1}, 11, 267, {
-            {1, 0, 0},
-            {14, 1, 0},
-            {14, 2, 0},
-            {46, 3, 0},
-            {46, 4, 0},
-            {46, 5, 0},
-            {35, 6, 0},
-            {35, 7, 0},
-            {14, 8, 0},
-            {14, 9, 0},
-            {46, 10, 0},
-            {46, 11, 0},
-            {46, 12, 0},
-            {46, 13, 0},
-            {46, 14, 0},
-            {46, 15, 0},
-            {46, 16, 0},
-            {39, 17, 0},
-            {33, 18, 0},
-            {33, 19, 0},
-            {38, 20, 0},
-            {40, 21, 0},
-            {46, 22, 0},
-            {2, 23, 0},
-            {3, 24, 0},
-            {4, 25, 0},
-            {11, 26, 0},
-            {11, 27, 0},
-            {11, 28, 0},
-            {11, 29, 0},
-            {11, 30, 0},
-            {2006, 31, 0},
-            {3004, 32, 0},
-            {3004, 33, 0},
-            {9, 34, 0},
-            {3002, 35, 0},
-            {3004, 36, 0},
-            {3004, 37, 0},
-            {3004, 38, 0},
-            {9, 39, 0},
-            {3004, 40, 0},
-            {9, 41, 0},
-            {3006, 42, 0},
-            {3006, 43, 0},
-            {3001, 44, 0},
-            {3001, 45, 0},
-            {3001, 46, 0},
-            {3001, 47, 0},
-            {9, 48, 0},
-            {3001, 49, 0},
-            {3004, 50, 0},
-            {3004, 51, 0},
-            {9, 52, 0},
-            {58, 53, 0},
-            {58, 54, 0},
-            {3006, 55, 0},
-            {3006, 56, 0},
-            {3001, 57, 0},
-            {3004, 58, 0},
-            {3002, 59, 0},
-            {3002, 60, 0},
-            {3004, 61, 0},
-            {3004, 62, 0},
-            {3004, 63, 0},
-            {3004, 64, 0},
-            {3001, 65, 0},
-            {3002, 66, 0},
-            {3006, 67, 0},
-            {3006, 68, 0},
-            {3001, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {3001, 72, 0},
-            {3004, 73, 0},
-            {9, 74, 0},
-            {3004, 75, 0},
-            {3001, 76, 0},
-            {3001, 77, 0},
-            {3002, 78, 0},
-            {3004, 79, 0},
-            {3004, 80, 0},
-            {9, 81, 0},
-            {58, 82, 0},
-            {58, 83, 0},
-            {3006, 84, 0},
-            {9, 85, 0},
-            {3004, 86, 0},
-            {3004, 87, 0},
-            {3006, 88, 0},
-            {3002, 89, 0},
-            {3002, 90, 0},
-            {11, 91, 0},
-            {2003, 92, 0},
-            {9, 93, 0},
-            {3004, 94, 0},
-            {9, 95, 0},
-            {3006, 96, 0},
-            {3006, 97, 0},
-            {3006, 98, 0},
-            {2008, 99, 0},
-            {2008, 100, 0},
-            {2008, 101, 0},
-            {2035, 102, 0},
-            {2035, 103, 0},
-            {2035, 104, 0},
-            {2035, 105, 0},
-            {2035, 106, 0},
-            {2035, 107, 0},
-            {2035, 108, 0},
-            {2035, 109, 0},
-            {2035, 110, 0},
-            {2035, 111, 0},
-            {2035, 112, 0},
-            {2035, 113, 0},
-            {2035, 114, 0},
-            {2035, 115, 0},
-            {2035, 116, 0},
-            {2035, 117, 0},
-            {2035, 118, 0},
-            {25, 119, 0},
-            {2035, 120, 0},
-            {2035, 121, 0},
-            {2035, 122, 0},
-            {2035, 123, 0},
-            {2035, 124, 0},
-            {2035, 125, 0},
-            {2035, 126, 0},
-            {2035, 127, 0},
-            {2035, 128, 0},
-            {2035, 129, 0},
-            {2035, 130, 0},
-            {2035, 131, 0},
-            {2035, 132, 0},
-            {2035, 133, 0},
-            {2035, 134, 0},
-            {2035, 135, 0},
-            {15, 136, 0},
-            {2002, 137, 0},
-            {2011, 138, 0},
-            {2011, 139, 0},
-            {2003, 140, 0},
-            {2008, 141, 0},
-            {2008, 142, 0},
-            {2008, 143, 0},
-            {2008, 144, 0},
-            {2012, 145, 0},
-            {2011, 146, 0},
-            {2014, 147, 0},
-            {2014, 148, 0},
-            {2014, 149, 0},
-            {2014, 150, 0},
-            {24, 151, 0},
-            {2015, 152, 0},
-            {2015, 153, 0},
-            {2015, 154, 0},
-            {2018, 155, 0},
-            {2035, 156, 0},
-            {2035, 157, 0},
-            {2035, 158, 0},
-            {2048, 159, 0},
-            {2014, 160, 0},
-            {2007, 161, 0},
-            {2008, 162, 0},
-            {2014, 163, 0},
-            {2014, 164, 0},
-            {2014, 165, 0},
-            {2014, 166, 0},
-            {2014, 167, 0},
-            {2014, 168, 0},
-            {3004, 169, 0},
-            {2015, 170, 0},
-            {2015, 171, 0},
-            {2015, 172, 0},
-            {2014, 173, 0},
-            {2014, 174, 0},
-            {2014, 175, 0},
-            {49, 176, 0},
-            {2004, 177, 0},
-            {2047, 178, 0},
-            {2011, 179, 0},
-            {2011, 180, 0},
-            {24, 181, 0},
-            {2025, 182, 0},
-            {2015, 183, 0},
-            {2015, 184, 0},
-            {2015, 185, 0},
-            {2011, 186, 0},
-            {2010, 187, 0},
-            {2010, 188, 0},
-            {2010, 189, 0},
-            {2010, 190, 0},
-            {2010, 191, 0},
-            {2010, 192, 0},
-            {2013, 193, 0},
-            {2025, 194, 0},
-            {2011, 195, 0},
-            {2011, 196, 0},
-            {2048, 197, 0},
-            {2047, 198, 0},
-            {2022, 199, 0},
-            {2011, 200, 0},
-            {2011, 201, 0},
-            {2035, 202, 0},
-            {2035, 203, 0},
-            {2035, 204, 0},
-            {2035, 205, 0},
-            {2035, 206, 0},
-            {2014, 207, 0},
-            {2014, 208, 0},
-            {2014, 209, 0},
-            {24, 210, 0},
-            {24, 211, 0},
-            {24, 212, 0},
-            {3001, 213, 0},
-            {3006, 214, 0},
-            {3002, 215, 0},
-            {3005, 216, 0},
-            {2049, 217, 0},
-            {3004, 218, 0},
-            {3006, 219, 0},
-            {2011, 220, 0},
-            {3006, 221, 0},
-            {3006, 222, 0},
-            {3004, 223, 0},
-            {3004, 224, 0},
-            {3002, 225, 0},
-            {3002, 226, 0},
-            {3005, 227, 0},
-            {3005, 228, 0},
-            {3001, 229, 0},
-            {3001, 230, 0},
-            {3004, 231, 0},
-            {3004, 232, 0},
-            {3006, 233, 0},
-            {3006, 234, 0},
-            {3003, 235, 0},
-            {3006, 236, 0},
-            {9, 237, 0},
-            {9, 238, 0},
-            {2011, 239, 0},
-            {2012, 240, 0},
-            {2049, 241, 0},
-            {2010, 242, 0},
-            {2010, 243, 0},
-            {2010, 244, 0},
-            {2012, 245, 0},
-            {9, 246, 0},
-            {2003, 247, 0},
-            {2001, 248, 0},
-            {2002, 249, 0},
-            {2011, 250, 0},
-            {2011, 251, 0},
-            {3006, 252, 0},
-            {2046, 253, 0},
-            {2046, 254, 0},
-            {2049, 255, 0},
-            {2023, 256, 0},
-            {2008, 257, 0},
-            {2008, 258, 0},
-            {2008, 259, 0},
-            {2008, 260, 0},
-            {2008, 261, 0},
-            {2046, 262, 0},
-            {2046, 263, 0},
-            {2046, 264, 0},
-            {2008, 265, 0},
-            {2008, 266, 0},
-        }},
-        {"Against Thee Wickedly (E4M6)", {true, true, true}, {1, 1, 1}, 16, 295, {
-            {1, 0, 0},
-            {54, 1, 0},
-            {43, 2, 0},
-            {43, 3, 0},
-            {25, 4, 0},
-            {26, 5, 0},
-            {15, 6, 0},
-            {47, 7, 0},
-            {47, 8, 0},
-            {47, 9, 0},
-            {47, 10, 0},
-            {47, 11, 0},
-            {47, 12, 0},
-            {47, 13, 0},
-            {47, 14, 0},
-            {47, 15, 0},
-            {47, 16, 0},
-            {47, 17, 0},
-            {54, 18, 0},
-            {54, 19, 0},
-            {54, 20, 0},
-            {43, 21, 0},
-            {43, 22, 0},
-            {2, 23, 0},
-            {3, 24, 0},
-            {4, 25, 0},
-            {46, 26, 0},
-            {46, 27, 0},
-            {46, 28, 0},
-            {46, 29, 0},
-            {2004, 30, 0},
-            {2047, 31, 0},
-            {2047, 32, 0},
-            {2047, 33, 0},
-            {2047, 34, 0},
-            {2047, 35, 0},
-            {57, 36, 0},
-            {57, 37, 0},
-            {2025, 38, 0},
-            {40, 39, 0},
-            {14, 40, 0},
-            {14, 41, 0},
-            {35, 42, 0},
-            {35, 43, 0},
-            {2025, 44, 0},
-            {42, 45, 0},
-            {42, 46, 0},
-            {39, 47, 0},
-            {2013, 48, 0},
-            {2003, 49, 0},
-            {2046, 50, 0},
-            {2046, 51, 0},
-            {2046, 52, 0},
-            {2046, 53, 0},
-            {2002, 54, 0},
-            {2048, 55, 0},
-            {2024, 56, 0},
-            {14, 57, 0},
-            {44, 58, 0},
-            {44, 59, 0},
-            {34, 60, 0},
-            {34, 61, 0},
-            {34, 62, 0},
-            {34, 63, 0},
-            {34, 64, 0},
-            {44, 65, 0},
-            {44, 66, 0},
-            {46, 67, 0},
-            {46, 68, 0},
-            {14, 69, 0},
-            {14, 70, 0},
-            {14, 71, 0},
-            {46, 72, 0},
-            {46, 73, 0},
-            {46, 74, 0},
-            {46, 75, 0},
-            {46, 76, 0},
-            {38, 77, 0},
-            {2022, 78, 0},
-            {17, 79, 0},
-            {17, 80, 0},
-            {17, 81, 0},
-            {17, 82, 0},
-            {17, 83, 0},
-            {17, 84, 0},
-            {17, 85, 0},
-            {17, 86, 0},
-            {17, 87, 0},
-            {17, 88, 0},
-            {2022, 89, 0},
-            {16, 90, 0},
-            {14, 91, 0},
-            {2046, 92, 0},
-            {2046, 93, 0},
-            {2046, 94, 0},
-            {2046, 95, 0},
-            {2046, 96, 0},
-            {2046, 97, 0},
-            {2046, 98, 0},
-            {2006, 99, 0},
-            {17, 100, 0},
-            {17, 101, 0},
-            {8, 102, 0},
-            {62, 103, 0},
-            {61, 104, 0},
-            {59, 105, 0},
-            {59, 106, 0},
-            {61, 107, 0},
-            {62, 108, 0},
-            {15, 109, 0},
-            {15, 110, 0},
-            {15, 111, 0},
-            {15, 112, 0},
-            {15, 113, 0},
-            {15, 114, 0},
-            {15, 115, 0},
-            {24, 116, 0},
-            {24, 117, 0},
-            {24, 118, 0},
-            {24, 119, 0},
-            {24, 120, 0},
-            {24, 121, 0},
-            {12, 122, 0},
-            {10, 123, 0},
-            {43, 124, 0},
-            {43, 125, 0},
-            {46, 126, 0},
-            {46, 127, 0},
-            {46, 128, 0},
-            {46, 129, 0},
-            {45, 130, 0},
-            {45, 131, 0},
-            {9, 132, 0},
-            {9, 133, 0},
-            {9, 134, 0},
-            {9, 135, 0},
-            {9, 136, 0},
-            {9, 137, 0},
-            {9, 138, 0},
-            {9, 139, 0},
-            {9, 140, 0},
-            {9, 141, 0},
-            {9, 142, 0},
-            {9, 143, 0},
-            {9, 144, 0},
-            {9, 145, 0},
-            {9, 146, 0},
-            {9, 147, 0},
-            {9, 148, 0},
-            {9, 149, 0},
-            {9, 150, 0},
-            {9, 151, 0},
-            {9, 152, 0},
-            {9, 153, 0},
-            {9, 154, 0},
-            {9, 155, 0},
-            {9, 156, 0},
-            {9, 157, 0},
-            {9, 158, 0},
-            {9, 159, 0},
-            {3001, 160, 0},
-            {3001, 161, 0},
-            {3001, 162, 0},
-            {3001, 163, 0},
-            {3001, 164, 0},
-            {3001, 165, 0},
-            {3001, 166, 0},
-            {3001, 167, 0},
-            {3001, 168, 0},
-            {3001, 169, 0},
-            {3001, 170, 0},
-            {3001, 171, 0},
-            {3001, 172, 0},
-            {3001, 173, 0},
-            {3001, 174, 0},
-            {3001, 175, 0},
-            {3001, 176, 0},
-            {3001, 177, 0},
-            {3001, 178, 0},
-            {3002, 179, 0},
-            {3002, 180, 0},
-            {58, 181, 0},
-            {58, 182, 0},
-            {58, 183, 0},
-            {58, 184, 0},
-            {3001, 185, 0},
-            {3001, 186, 0},
-            {3006, 187, 0},
-            {3006, 188, 0},
-            {3006, 189, 0},
-            {3006, 190, 0},
-            {3001, 191, 0},
-            {3001, 192, 0},
-            {3001, 193, 0},
-            {2049, 194, 0},
-            {2049, 195, 0},
-            {2008, 196, 0},
-            {2008, 197, 0},
-            {2008, 198, 0},
-            {58, 199, 0},
-            {58, 200, 0},
-            {58, 201, 0},
-            {58, 202, 0},
-            {58, 203, 0},
-            {58, 204, 0},
-            {58, 205, 0},
-            {58, 206, 0},
-            {3003, 207, 0},
-            {3003, 208, 0},
-            {3005, 209, 0},
-            {3005, 210, 0},
-            {3005, 211, 0},
-            {3005, 212, 0},
-            {3005, 213, 0},
-            {3005, 214, 0},
-            {3005, 215, 0},
-            {3005, 216, 0},
-            {3005, 217, 0},
-            {3001, 218, 0},
-            {3003, 219, 0},
-            {3005, 220, 0},
-            {2025, 221, 0},
-            {2025, 222, 0},
-            {2025, 223, 0},
-            {3006, 224, 0},
-            {3006, 225, 0},
-            {3006, 226, 0},
-            {3001, 227, 0},
-            {3001, 228, 0},
-            {3001, 229, 0},
-            {3001, 230, 0},
-            {3001, 231, 0},
-            {2048, 232, 0},
-            {2048, 233, 0},
-            {2048, 234, 0},
-            {2046, 235, 0},
-            {2049, 236, 0},
-            {2049, 237, 0},
-            {2049, 238, 0},
-            {2049, 239, 0},
-            {2049, 240, 0},
-            {2010, 241, 0},
-            {2010, 242, 0},
-            {2010, 243, 0},
-            {2012, 244, 0},
-            {2012, 245, 0},
-            {2012, 246, 0},
-            {2012, 247, 0},
-            {2012, 248, 0},
-            {2012, 249, 0},
-            {2012, 250, 0},
-            {2012, 251, 0},
-            {2012, 252, 0},
-            {2012, 253, 0},
-            {2012, 254, 0},
-            {3001, 255, 0},
-            {2023, 256, 0},
-            {3005, 257, 0},
-            {3005, 258, 0},
-            {3005, 259, 0},
-            {2012, 260, 0},
-            {2012, 261, 0},
-            {2012, 262, 0},
-            {2049, 263, 0},
-            {2008, 264, 0},
-            {2025, 265, 0},
-            {2012, 266, 0},
-            {2012, 267, 0},
-            {2048, 268, 0},
-            {2048, 269, 0},
-            {2049, 270, 0},
-            {2049, 271, 0},
-            {2012, 272, 0},
-            {2012, 273, 0},
-            {2025, 274, 0},
-            {2012, 275, 0},
-            {2012, 276, 0},
-            {2012, 277, 0},
-            {2001, 278, 0},
-            {2049, 279, 0},
-            {3005, 280, 0},
-            {3005, 281, 0},
-            {3005, 282, 0},
-            {3005, 283, 0},
-            {3005, 284, 0},
-            {3005, 285, 0},
-            {3005, 286, 0},
-            {11, 287, 0},
-            {11, 288, 0},
-            {11, 289, 0},
-            {11, 290, 0},
-            {11, 291, 0},
-            {2018, 292, 0},
-            {2019, 293, 0},
-            {2001, 294, 0},
-        }},
-        {"And Hell Followed (E4M7)", {true, true, true}, {1, 1, 1}, 22, 258, {
-            {1, 0, 0},
-            {2001, 1, 0},
-            {28, 2, 0},
-            {28, 3, 0},
-            {28, 4, 0},
-            {28, 5, 0},
-            {9, 6, 0},
-            {9, 7, 0},
-            {3001, 8, 0},
-            {3004, 9, 0},
-            {9, 10, 0},
-            {3002, 11, 0},
-            {33, 12, 0},
-            {33, 13, 0},
-            {33, 14, 0},
-            {33, 15, 0},
-            {58, 16, 0},
-            {3001, 17, 0},
-            {2011, 18, 0},
-            {54, 19, 0},
-            {47, 20, 0},
-            {3001, 21, 0},
-            {9, 22, 0},
-            {9, 23, 0},
-            {9, 24, 0},
-            {9, 25, 0},
-            {9, 26, 0},
-            {3001, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {2002, 33, 0},
-            {2048, 34, 0},
-            {45, 35, 0},
-            {45, 36, 0},
-            {32, 37, 0},
-            {32, 38, 0},
-            {12, 39, 0},
-            {58, 40, 0},
-            {3005, 41, 0},
-            {9, 42, 0},
-            {3001, 43, 0},
-            {9, 44, 0},
-            {9, 45, 0},
-            {3004, 46, 0},
-            {9, 47, 0},
-            {9, 48, 0},
-            {9, 49, 0},
-            {9, 50, 0},
-            {3005, 51, 0},
-            {3002, 52, 0},
-            {9, 53, 0},
-            {9, 54, 0},
-            {3002, 55, 0},
-            {3002, 56, 0},
-            {3002, 57, 0},
-            {2003, 58, 0},
-            {3001, 59, 0},
-            {3005, 60, 0},
-            {2004, 61, 0},
-            {2047, 62, 0},
-            {3001, 63, 0},
-            {2012, 64, 0},
-            {3004, 65, 0},
-            {3004, 66, 0},
-            {3001, 67, 0},
-            {54, 68, 0},
-            {47, 69, 0},
-            {9, 70, 0},
-            {2012, 71, 0},
-            {2046, 72, 0},
-            {2046, 73, 0},
-            {2028, 74, 0},
-            {2008, 75, 0},
-            {8, 76, 0},
-            {2013, 77, 0},
-            {3001, 78, 0},
-            {3001, 79, 0},
-            {3001, 80, 0},
-            {3001, 81, 0},
-            {3001, 82, 0},
-            {3001, 83, 0},
-            {3001, 84, 0},
-            {3001, 85, 0},
-            {3001, 86, 0},
-            {40, 87, 0},
-            {58, 88, 0},
-            {2049, 89, 0},
-            {2015, 90, 0},
-            {2015, 91, 0},
-            {2015, 92, 0},
-            {2015, 93, 0},
-            {2015, 94, 0},
-            {2015, 95, 0},
-            {2014, 96, 0},
-            {2014, 97, 0},
-            {2014, 98, 0},
-            {3004, 99, 0},
-            {3001, 100, 0},
-            {3001, 101, 0},
-            {9, 102, 0},
-            {9, 103, 0},
-            {3001, 104, 0},
-            {49, 105, 0},
-            {15, 106, 0},
-            {2007, 107, 0},
-            {28, 108, 0},
-            {26, 109, 0},
-            {25, 110, 0},
-            {26, 111, 0},
-            {25, 112, 0},
-            {25, 113, 0},
-            {25, 114, 0},
-            {2012, 115, 0},
-            {12, 116, 0},
-            {54, 117, 0},
-            {47, 118, 0},
-            {28, 119, 0},
-            {2014, 120, 0},
-            {2014, 121, 0},
-            {2024, 122, 0},
-            {2010, 123, 0},
-            {2047, 124, 0},
-            {9, 125, 0},
-            {3003, 126, 0},
-            {9, 127, 0},
-            {9, 128, 0},
-            {2011, 129, 0},
-            {3003, 130, 0},
-            {3003, 131, 0},
-            {3001, 132, 0},
-            {3001, 133, 0},
-            {3001, 134, 0},
-            {3001, 135, 0},
-            {9, 136, 0},
-            {11, 137, 0},
-            {11, 138, 0},
-            {11, 139, 0},
-            {11, 140, 0},
-            {2001, 141, 0},
-            {2001, 142, 0},
-            {2001, 143, 0},
-            {2, 144, 0},
-            {3, 145, 0},
-            {4, 146, 0},
-            {2001, 147, 0},
-            {26, 148, 0},
-            {25, 149, 0},
-            {2049, 150, 0},
-            {3001, 151, 0},
-            {3001, 152, 0},
-            {3001, 153, 0},
-            {2048, 154, 0},
-            {17, 155, 0},
-            {2019, 156, 0},
-            {12, 157, 0},
-            {24, 158, 0},
-            {2010, 159, 0},
-            {14, 160, 0},
-            {14, 161, 0},
-            {2025, 162, 0},
-            {2025, 163, 0},
-            {9, 164, 0},
-            {3001, 165, 0},
-            {3005, 166, 0},
-            {3002, 167, 0},
-            {3001, 168, 0},
-            {3001, 169, 0},
-            {3001, 170, 0},
-            {3001, 171, 0},
-            {2018, 172, 0},
-            {2026, 173, 0},
-            {2023, 174, 0},
-            {3001, 175, 0},
-            {3005, 176, 0},
-            {33, 177, 0},
-            {33, 178, 0},
-            {33, 179, 0},
-            {16, 180, 0},
-            {14, 181, 0},
-            {39, 182, 0},
-            {14, 183, 0},
-            {14, 184, 0},
-            {9, 185, 0},
-            {38, 186, 0},
-            {2049, 187, 0},
-            {2010, 188, 0},
-            {2008, 189, 0},
-            {2005, 190, 0},
-            {46, 191, 0},
-            {46, 192, 0},
-            {3004, 193, 0},
-            {28, 194, 0},
-            {28, 195, 0},
-            {2006, 196, 0},
-            {2046, 197, 0},
-            {2046, 198, 0},
-            {17, 199, 0},
-            {17, 200, 0},
-            {9, 201, 0},
-            {3001, 202, 0},
-            {2008, 203, 0},
-            {2011, 204, 0},
-            {3006, 205, 0},
-            {3006, 206, 0},
-            {9, 207, 0},
-            {9, 208, 0},
-            {3006, 209, 0},
-            {3006, 210, 0},
-            {2046, 211, 0},
-            {2046, 212, 0},
-            {2046, 213, 0},
-            {2046, 214, 0},
-            {2046, 215, 0},
-            {2046, 216, 0},
-            {2019, 217, 0},
-            {2012, 218, 0},
-            {2012, 219, 0},
-            {3006, 220, 0},
-            {3006, 221, 0},
-            {3005, 222, 0},
-            {3006, 223, 0},
-            {3003, 224, 0},
-            {2046, 225, 0},
-            {2046, 226, 0},
-            {2046, 227, 0},
-            {2046, 228, 0},
-            {3001, 229, 0},
-            {3001, 230, 0},
-            {2011, 231, 0},
-            {2012, 232, 0},
-            {14, 233, 0},
-            {3001, 234, 0},
-            {2022, 235, 0},
-            {2022, 236, 0},
-            {2013, 237, 0},
-            {2008, 238, 0},
-            {2049, 239, 0},
-            {2025, 240, 0},
-            {2025, 241, 0},
-            {17, 242, 0},
-            {2003, 243, 0},
-            {11, 244, 0},
-            {2001, 245, 0},
-            {2001, 246, 0},
-            {3001, 247, 0},
-            {2003, 248, 0},
-            {3001, 249, 0},
-            {2049, 250, 0},
-            {2011, 251, 0},
-            {2012, 252, 0},
-            {2012, 253, 0},
-            {45, 254, 0},
-            {45, 255, 0},
-            {41, 256, 0},
-            {41, 257, 0},
-        }},
-        {"Unto the Cruel (E4M8)", {false, true, true}, {0, 1, 1}, 17, 315, {
-            {2, 0, 0},
-            {3, 1, 0},
-            {4, 2, 0},
-            {46, 3, 0},
-            {46, 4, 0},
-            {14, 5, 0},
-            {14, 6, 0},
-            {1, 7, 0},
-            {54, 8, 0},
-            {54, 9, 0},
-            {43, 10, 0},
-            {43, 11, 0},
-            {43, 12, 0},
-            {54, 13, 0},
-            {54, 14, 0},
-            {54, 15, 0},
-            {54, 16, 0},
-            {54, 17, 0},
-            {43, 18, 0},
-            {54, 19, 0},
-            {45, 20, 0},
-            {45, 21, 0},
-            {45, 22, 0},
-            {45, 23, 0},
-            {45, 24, 0},
-            {45, 25, 0},
-            {45, 26, 0},
-            {45, 27, 0},
-            {14, 28, 0},
-            {14, 29, 0},
-            {49, 30, 0},
-            {44, 31, 0},
-            {44, 32, 0},
-            {28, 33, 0},
-            {44, 34, 0},
-            {44, 35, 0},
-            {51, 36, 0},
-            {44, 37, 0},
-            {44, 38, 0},
-            {44, 39, 0},
-            {7, 40, 0},
-            {44, 41, 0},
-            {44, 42, 0},
-            {44, 43, 0},
-            {44, 44, 0},
-            {53, 45, 0},
-            {25, 46, 0},
-            {26, 47, 0},
-            {46, 48, 0},
-            {46, 49, 0},
-            {46, 50, 0},
-            {46, 51, 0},
-            {46, 52, 0},
-            {46, 53, 0},
-            {46, 54, 0},
-            {46, 55, 0},
-            {46, 56, 0},
-            {46, 57, 0},
-            {46, 58, 0},
-            {2048, 59, 0},
-            {2048, 60, 0},
-            {2012, 61, 0},
-            {2012, 62, 0},
-            {2012, 63, 0},
-            {2012, 64, 0},
-            {2008, 65, 0},
-            {2008, 66, 0},
-            {2008, 67, 0},
-            {2008, 68, 0},
-            {2008, 69, 0},
-            {2008, 70, 0},
-            {2008, 71, 0},
-            {2008, 72, 0},
-            {2008, 73, 0},
-            {2008, 74, 0},
-            {2008, 75, 0},
-            {2008, 76, 0},
-            {2008, 77, 0},
-            {2008, 78, 0},
-            {2001, 79, 0},
-            {2001, 80, 0},
-            {2013, 81, 0},
-            {2046, 82, 0},
-            {2046, 83, 0},
-            {2046, 84, 0},
-            {2003, 85, 0},
-            {46, 86, 0},
-            {46, 87, 0},
-            {46, 88, 0},
-            {46, 89, 0},
-            {46, 90, 0},
-            {46, 91, 0},
-            {46, 92, 0},
-            {46, 93, 0},
-            {46, 94, 0},
-            {46, 95, 0},
-            {46, 96, 0},
-            {46, 97, 0},
-            {46, 98, 0},
-            {46, 99, 0},
-            {2019, 100, 0},
-            {2013, 101, 0},
-            {2019, 102, 0},
-            {3001, 103, 0},
-            {3001, 104, 0},
-            {3003, 105, 0},
-            {3003, 106, 0},
-            {9, 107, 0},
-            {9, 108, 0},
-            {9, 109, 0},
-            {3002, 110, 0},
-            {3002, 111, 0},
-            {3004, 112, 0},
-            {3004, 113, 0},
-            {3004, 114, 0},
-            {9, 115, 0},
-            {9, 116, 0},
-            {3002, 117, 0},
-            {9, 118, 0},
-            {9, 119, 0},
-            {3003, 120, 0},
-            {3005, 121, 0},
-            {3004, 122, 0},
-            {3004, 123, 0},
-            {9, 124, 0},
-            {9, 125, 0},
-            {9, 126, 0},
-            {9, 127, 0},
-            {9, 128, 0},
-            {3005, 129, 0},
-            {3002, 130, 0},
-            {3002, 131, 0},
-            {9, 132, 0},
-            {3004, 133, 0},
-            {3004, 134, 0},
-            {3004, 135, 0},
-            {9, 136, 0},
-            {3003, 137, 0},
-            {9, 138, 0},
-            {9, 139, 0},
-            {3005, 140, 0},
-            {3005, 141, 0},
-            {3005, 142, 0},
-            {3003, 143, 0},
-            {3003, 144, 0},
-            {3003, 145, 0},
-            {39, 146, 0},
-            {2045, 147, 0},
-            {2023, 148, 0},
-            {2006, 149, 0},
-            {17, 150, 0},
-            {17, 151, 0},
-            {17, 152, 0},
-            {17, 153, 0},
-            {2048, 154, 0},
-            {2048, 155, 0},
-            {2046, 156, 0},
-            {2046, 157, 0},
-            {2049, 158, 0},
-            {2049, 159, 0},
-            {2011, 160, 0},
-            {2011, 161, 0},
-            {2011, 162, 0},
-            {2011, 163, 0},
-            {2011, 164, 0},
-            {2011, 165, 0},
-            {2011, 166, 0},
-            {2011, 167, 0},
-            {2011, 168, 0},
-            {2011, 169, 0},
-            {2011, 170, 0},
-            {2011, 171, 0},
-            {2002, 172, 0},
-            {2001, 173, 0},
-            {11, 174, 0},
-            {11, 175, 0},
-            {11, 176, 0},
-            {11, 177, 0},
-            {2003, 178, 0},
-            {17, 179, 0},
-            {2006, 180, 0},
-            {17, 181, 0},
-            {14, 182, 0},
-            {14, 183, 0},
-            {17, 184, 0},
-            {2046, 185, 0},
-            {2003, 186, 0},
-            {2004, 187, 0},
-            {17, 188, 0},
-            {17, 189, 0},
-            {2046, 190, 0},
-            {2046, 191, 0},
-            {38, 192, 0},
-            {9, 193, 0},
-            {9, 194, 0},
-            {9, 195, 0},
-            {3001, 196, 0},
-            {3001, 197, 0},
-            {3001, 198, 0},
-            {3001, 199, 0},
-            {9, 200, 0},
-            {3001, 201, 0},
-            {3005, 202, 0},
-            {3005, 203, 0},
-            {9, 204, 0},
-            {9, 205, 0},
-            {3001, 206, 0},
-            {3001, 207, 0},
-            {58, 208, 0},
-            {58, 209, 0},
-            {3001, 210, 0},
-            {3001, 211, 0},
-            {3002, 212, 0},
-            {3002, 213, 0},
-            {3002, 214, 0},
-            {3002, 215, 0},
-            {58, 216, 0},
-            {58, 217, 0},
-            {3004, 218, 0},
-            {3004, 219, 0},
-            {3004, 220, 0},
-            {3004, 221, 0},
-            {9, 222, 0},
-            {9, 223, 0},
-            {9, 224, 0},
-            {9, 225, 0},
-            {9, 226, 0},
-            {58, 227, 0},
-            {3004, 228, 0},
-            {9, 229, 0},
-            {9, 230, 0},
-            {3004, 231, 0},
-            {9, 232, 0},
-            {9, 233, 0},
-            {58, 234, 0},
-            {3004, 235, 0},
-            {3004, 236, 0},
-            {9, 237, 0},
-            {9, 238, 0},
-            {9, 239, 0},
-            {9, 240, 0},
-            {9, 241, 0},
-            {9, 242, 0},
-            {9, 243, 0},
-            {3004, 244, 0},
-            {9, 245, 0},
-            {9, 246, 0},
-            {3004, 247, 0},
-            {9, 248, 0},
-            {9, 249, 0},
-            {3004, 250, 0},
-            {9, 251, 0},
-            {9, 252, 0},
-            {58, 253, 0},
-            {3004, 254, 0},
-            {9, 255, 0},
-            {9, 256, 0},
-            {9, 257, 0},
-            {3004, 258, 0},
-            {3005, 259, 0},
-            {3005, 260, 0},
-            {3003, 261, 0},
-            {3003, 262, 0},
-            {3003, 263, 0},
-            {3003, 264, 0},
-            {9, 265, 0},
-            {9, 266, 0},
-            {9, 267, 0},
-            {9, 268, 0},
-            {9, 269, 0},
-            {9, 270, 0},
-            {3001, 271, 0},
-            {3001, 272, 0},
-            {3001, 273, 0},
-            {3001, 274, 0},
-            {3006, 275, 0},
-            {3006, 276, 0},
-            {3006, 277, 0},
-            {3006, 278, 0},
-            {3006, 279, 0},
-            {3006, 280, 0},
-            {3006, 281, 0},
-            {3006, 282, 0},
-            {3006, 283, 0},
-            {3006, 284, 0},
-            {3006, 285, 0},
-            {3006, 286, 0},
-            {3006, 287, 0},
-            {3006, 288, 0},
-            {9, 289, 0},
-            {3005, 290, 0},
-            {3003, 291, 0},
-            {2002, 292, 0},
-            {2048, 293, 0},
-            {2048, 294, 0},
-            {2048, 295, 0},
-            {2048, 296, 0},
-            {2012, 297, 0},
-            {2012, 298, 0},
-            {2012, 299, 0},
-            {2012, 300, 0},
-            {2012, 301, 0},
-            {2012, 302, 0},
-            {2012, 303, 0},
-            {2013, 304, 0},
-            {2048, 305, 0},
-            {2048, 306, 0},
-            {2048, 307, 0},
-            {2046, 308, 0},
-            {2046, 309, 0},
-            {2024, 310, 0},
-            {8, 311, 0},
-            {2004, 312, 0},
-            {2025, 313, 0},
-            {2025, 314, 0},
-        }},
-        {"Fear (E4M9)", {false, true, false}, {0, 1, 0}, 9, 247, {
-            {1, 0, 0},
-            {31, 1, 0},
-            {14, 2, 0},
-            {14, 3, 0},
-            {14, 4, 0},
-            {14, 5, 0},
-            {39, 6, 0},
-            {46, 7, 0},
-            {46, 8, 0},
-            {46, 9, 0},
-            {46, 10, 0},
-            {46, 11, 0},
-            {46, 12, 0},
-            {46, 13, 0},
-            {46, 14, 0},
-            {32, 15, 0},
-            {32, 16, 0},
-            {32, 17, 0},
-            {32, 18, 0},
-            {2, 19, 0},
-            {3, 20, 0},
-            {4, 21, 0},
-            {11, 22, 0},
-            {11, 23, 0},
-            {11, 24, 0},
-            {11, 25, 0},
-            {11, 26, 0},
-            {2013, 27, 0},
-            {3004, 28, 0},
-            {3004, 29, 0},
-            {3004, 30, 0},
-            {3004, 31, 0},
-            {15, 32, 0},
-            {24, 33, 0},
-            {24, 34, 0},
-            {24, 35, 0},
-            {24, 36, 0},
-            {2001, 37, 0},
-            {2011, 38, 0},
-            {2011, 39, 0},
-            {2019, 40, 0},
-            {2008, 41, 0},
-            {2008, 42, 0},
-            {2008, 43, 0},
-            {2008, 44, 0},
-            {2010, 45, 0},
-            {2010, 46, 0},
-            {2010, 47, 0},
-            {3002, 48, 0},
-            {9, 49, 0},
-            {3002, 50, 0},
-            {3002, 51, 0},
-            {58, 52, 0},
-            {58, 53, 0},
-            {3005, 54, 0},
-            {3005, 55, 0},
-            {3004, 56, 0},
-            {3004, 57, 0},
-            {3004, 58, 0},
-            {3004, 59, 0},
-            {3001, 60, 0},
-            {3001, 61, 0},
-            {3001, 62, 0},
-            {3001, 63, 0},
-            {3004, 64, 0},
-            {3004, 65, 0},
-            {3001, 66, 0},
-            {3001, 67, 0},
-            {9, 68, 0},
-            {9, 69, 0},
-            {3001, 70, 0},
-            {3001, 71, 0},
-            {3001, 72, 0},
-            {3001, 73, 0},
-            {3005, 74, 0},
-            {58, 75, 0},
-            {58, 76, 0},
-            {3001, 77, 0},
-            {3001, 78, 0},
-            {3004, 79, 0},
-            {3004, 80, 0},
-            {3004, 81, 0},
-            {9, 82, 0},
-            {3001, 83, 0},
-            {3001, 84, 0},
-            {3002, 85, 0},
-            {3002, 86, 0},
-            {3004, 87, 0},
-            {3004, 88, 0},
-            {3004, 89, 0},
-            {3004, 90, 0},
-            {3002, 91, 0},
-            {3002, 92, 0},
-            {3005, 93, 0},
-            {3002, 94, 0},
-            {3002, 95, 0},
-            {3001, 96, 0},
-            {3001, 97, 0},
-            {3001, 98, 0},
-            {3001, 99, 0},
-            {3004, 100, 0},
-            {3004, 101, 0},
-            {3004, 102, 0},
-            {9, 103, 0},
-            {9, 104, 0},
-            {3006, 105, 0},
-            {3006, 106, 0},
-            {3002, 107, 0},
-            {3002, 108, 0},
-            {9, 109, 0},
-            {3005, 110, 0},
-            {3005, 111, 0},
-            {3006, 112, 0},
-            {3006, 113, 0},
-            {3006, 114, 0},
-            {3005, 115, 0},
-            {3005, 116, 0},
-            {3006, 117, 0},
-            {3006, 118, 0},
-            {2003, 119, 0},
-            {3006, 120, 0},
-            {3006, 121, 0},
-            {3006, 122, 0},
-            {3001, 123, 0},
-            {3001, 124, 0},
-            {3001, 125, 0},
-            {3001, 126, 0},
-            {9, 127, 0},
-            {9, 128, 0},
-            {9, 129, 0},
-            {9, 130, 0},
-            {9, 131, 0},
-            {9, 132, 0},
-            {3006, 133, 0},
-            {3001, 134, 0},
-            {3001, 135, 0},
-            {11, 136, 0},
-            {3003, 137, 0},
-            {9, 138, 0},
-            {3001, 139, 0},
-            {3003, 140, 0},
-            {3001, 141, 0},
-            {3001, 142, 0},
-            {3001, 143, 0},
-            {3001, 144, 0},
-            {3001, 145, 0},
-            {46, 146, 0},
-            {46, 147, 0},
-            {46, 148, 0},
-            {2003, 149, 0},
-            {2005, 150, 0},
-            {8, 151, 0},
-            {2002, 152, 0},
-            {2001, 153, 0},
-            {2047, 154, 0},
-            {2012, 155, 0},
-            {2011, 156, 0},
-            {2011, 157, 0},
-            {2014, 158, 0},
-            {2014, 159, 0},
-            {2014, 160, 0},
-            {2014, 161, 0},
-            {2014, 162, 0},
-            {2014, 163, 0},
-            {2014, 164, 0},
-            {2015, 165, 0},
-            {2015, 166, 0},
-            {2015, 167, 0},
-            {2012, 168, 0},
-            {2049, 169, 0},
-            {2048, 170, 0},
-            {2011, 171, 0},
-            {2011, 172, 0},
-            {2011, 173, 0},
-            {2035, 174, 0},
-            {2035, 175, 0},
-            {2035, 176, 0},
-            {2035, 177, 0},
-            {2035, 178, 0},
-            {2035, 179, 0},
-            {2035, 180, 0},
-            {2035, 181, 0},
-            {2035, 182, 0},
-            {2035, 183, 0},
-            {2035, 184, 0},
-            {2035, 185, 0},
-            {2035, 186, 0},
-            {2035, 187, 0},
-            {2035, 188, 0},
-            {2035, 189, 0},
-            {2035, 190, 0},
-            {2035, 191, 0},
-            {2035, 192, 0},
-            {2035, 193, 0},
-            {2035, 194, 0},
-            {2007, 195, 0},
-            {2007, 196, 0},
-            {2007, 197, 0},
-            {2049, 198, 0},
-            {2011, 199, 0},
-            {2011, 200, 0},
-            {2011, 201, 0},
-            {2014, 202, 0},
-            {2014, 203, 0},
-            {2014, 204, 0},
-            {2035, 205, 0},
-            {2035, 206, 0},
-            {2035, 207, 0},
-            {2035, 208, 0},
-            {2035, 209, 0},
-            {2035, 210, 0},
-            {2049, 211, 0},
-            {2012, 212, 0},
-            {2035, 213, 0},
-            {2035, 214, 0},
-            {2035, 215, 0},
-            {2035, 216, 0},
-            {2035, 217, 0},
-            {2035, 218, 0},
-            {2035, 219, 0},
-            {2004, 220, 0},
-            {17, 221, 0},
-            {2047, 222, 0},
-            {2047, 223, 0},
-            {2047, 224, 0},
-            {2047, 225, 0},
-            {2047, 226, 0},
-            {2012, 227, 0},
-            {2012, 228, 0},
-            {2035, 229, 0},
-            {2035, 230, 0},
-            {2035, 231, 0},
-            {2035, 232, 0},
-            {2035, 233, 0},
-            {2035, 234, 0},
-            {2002, 235, 0},
-            {2008, 236, 0},
-            {2008, 237, 0},
-            {2008, 238, 0},
-            {2008, 239, 0},
-            {2008, 240, 0},
-            {2008, 241, 0},
-            {2011, 242, 0},
-            {2011, 243, 0},
-            {2046, 244, 0},
-            {2046, 245, 0},
-            {2023, 246, 0},
-        }},
-    },
+// Things of every level, packed back to back
+constexpr ap_thing_info_t ap_doom_thing_infos[] = {
+    // Hangar (E1M1)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {48, 4, 0, 0},
+    {48, 5, 0, 0},
+    {2028, 6, 0, 0},
+    {2028, 7, 0, 0},
+    {3001, 8, 0, 0},
+    {3001, 9, 0, 0},
+    {3004, 10, 0, 0},
+    {3004, 11, 0, 0},
+    {3004, 12, 0, 0},
+    {2019, 13, 0, 0},
+    {3004, 14, 0, 0},
+    {3004, 15, 0, 0},
+    {3001, 16, 0, 0},
+    {3004, 17, 0, 0},
+    {3004, 18, 0, 0},
+    {2012, 19, 0, 0},
+    {2007, 20, 0, 0},
+    {2007, 21, 0, 0},
+    {2008, 22, 0, 0},
+    {2014, 23, 0, 0},
+    {2014, 24, 0, 0},
+    {2014, 25, 0, 0},
+    {2014, 26, 0, 0},
+    {2015, 27, 0, 0},
+    {2015, 28, 0, 0},
+    {2015, 29, 0, 0},
+    {2015, 30, 0, 0},
+    {2014, 31, 0, 0},
+    {2014, 32, 0, 0},
+    {2015, 33, 0, 0},
+    {2015, 34, 0, 0},
+    {2035, 35, 0, 0},
+    {2035, 36, 0, 0},
+    {2035, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2014, 39, 0, 0},
+    {2028, 40, 0, 0},
+    {2028, 41, 0, 0},
+    {2008, 42, 0, 0},
+    {2008, 43, 0, 0},
+    {2028, 44, 0, 0},
+    {2028, 45, 0, 0},
+    {2028, 46, 0, 0},
+    {2028, 47, 0, 0},
+    {2035, 48, 0, 0},
+    {2035, 49, 0, 0},
+    {2035, 50, 0, 0},
+    {2014, 51, 0, 0},
+    {2014, 52, 0, 0},
+    {2014, 53, 0, 0},
+    {2014, 54, 0, 0},
+    {2014, 55, 0, 0},
+    {2015, 56, 0, 0},
+    {2015, 57, 0, 0},
+    {2015, 58, 0, 0},
+    {2015, 59, 0, 0},
+    {2015, 60, 0, 0},
+    {35, 61, 0, 0},
+    {35, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {2011, 64, 0, 0},
+    {2012, 65, 0, 0},
+    {2049, 66, 0, 0},
+    {2048, 67, 0, 0},
+    {2018, 68, 0, 0},
+    {11, 69, 0, 0},
+    {11, 70, 0, 0},
+    {11, 71, 0, 0},
+    {11, 72, 0, 0},
+    {11, 73, 0, 0},
+    {2003, 74, 0, 0},
+    {2046, 75, 0, 0},
+    {2046, 76, 0, 0},
+    {2046, 77, 0, 0},
+    {2002, 78, 0, 0},
+    {2048, 79, 0, 0},
+    {2048, 80, 0, 0},
+    {2048, 81, 0, 0},
+    {2048, 82, 0, 0},
+    {2048, 83, 0, 0},
+    {2049, 84, 0, 0},
+    {2049, 85, 0, 0},
+    {2049, 86, 0, 0},
+    {3004, 87, 0, 0},
+    {3004, 88, 0, 0},
+    {9, 89, 0, 0},
+    {9, 90, 0, 0},
+    {2015, 91, 0, 0},
+    {2015, 92, 0, 0},
+    {2015, 93, 0, 0},
+    {2015, 94, 0, 0},
+    {2015, 95, 0, 0},
+    {2015, 96, 0, 0},
+    {2049, 97, 0, 0},
+    {2001, 98, 0, 0},
+    {2012, 99, 0, 0},
+    {9, 100, 0, 0},
+    {9, 101, 0, 0},
+    {9, 102, 0, 0},
+    {9, 103, 0, 0},
+    {9, 104, 0, 0},
+    {9, 105, 0, 0},
+    {9, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {9, 109, 0, 0},
+    {9, 110, 0, 0},
+    {9, 111, 0, 0},
+    {9, 112, 0, 0},
+    {9, 113, 0, 0},
+    {10, 114, 0, 0},
+    {15, 115, 0, 0},
+    {24, 116, 0, 0},
+    {10, 117, 0, 0},
+    {15, 118, 0, 0},
+    {15, 119, 0, 0},
+    {24, 120, 0, 0},
+    {24, 121, 0, 0},
+    {24, 122, 0, 0},
+    {15, 123, 0, 0},
+    {12, 124, 0, 0},
+    {12, 125, 0, 0},
+    {24, 126, 0, 0},
+    {24, 127, 0, 0},
+    {24, 128, 0, 0},
+    {2049, 129, 0, 0},
+    {2015, 130, 0, 0},
+    {2015, 131, 0, 0},
+    {2015, 132, 0, 0},
+    {2015, 133, 0, 0},
+    {2015, 134, 0, 0},
+    {2015, 135, 0, 0},
+    {2015, 136, 0, 0},
+    {2015, 137, 0, 0},
+    {2023, 138, 0, 0},
+    {2035, 139, 0, 0},
+    {2035, 140, 0, 0},
+    {2035, 141, 0, 0},
+    {2001, 142, 0, 0},
+    // Nuclear Plant (E1M2)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {2005, 4, 0, 0},
+    {2001, 5, 0, 0},
+    {2049, 6, 0, 0},
+    {3004, 7, 0, 0},
+    {3004, 8, 0, 0},
+    {3004, 9, 0, 0},
+    {3004, 10, 0, 0},
+    {3004, 11, 0, 0},
+    {3004, 12, 0, 0},
+    {3004, 13, 0, 0},
+    {3004, 14, 0, 0},
+    {3004, 15, 0, 0},
+    {3004, 16, 0, 0},
+    {3004, 17, 0, 0},
+    {3004, 18, 0, 0},
+    {2015, 19, 0, 0},
+    {2018, 20, 0, 0},
+    {2012, 21, 0, 0},
+    {2013, 22, 0, 0},
+    {2014, 23, 0, 0},
+    {2015, 24, 0, 0},
+    {2002, 25, 0, 0},
+    {2015, 26, 0, 0},
+    {2015, 27, 0, 0},
+    {3004, 28, 0, 0},
+    {3004, 29, 0, 0},
+    {3004, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {2007, 32, 0, 0},
+    {2007, 33, 0, 0},
+    {2015, 34, 0, 0},
+    {2015, 35, 0, 0},
+    {2014, 36, 0, 0},
+    {3004, 37, 0, 0},
+    {2008, 38, 0, 0},
+    {2011, 39, 0, 0},
+    {2011, 40, 0, 0},
+    {13, 41, 0, 0},
+    {2012, 42, 0, 0},
+    {2018, 43, 0, 0},
+    {2012, 44, 0, 0},
+    {2049, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3004, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {3004, 52, 0, 0},
+    {2019, 53, 0, 0},
+    {2012, 54, 0, 0},
+    {2011, 55, 0, 0},
+    {2015, 56, 0, 0},
+    {3001, 57, 0, 0},
+    {3001, 58, 0, 0},
+    {3001, 59, 0, 0},
+    {2049, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {2015, 62, 0, 0},
+    {2014, 63, 0, 0},
+    {2014, 64, 0, 0},
+    {2014, 65, 0, 0},
+    {3004, 66, 0, 0},
+    {3004, 67, 0, 0},
+    {3004, 68, 0, 0},
+    {3004, 69, 0, 0},
+    {3004, 70, 0, 0},
+    {3004, 71, 0, 0},
+    {3004, 72, 0, 0},
+    {3004, 73, 0, 0},
+    {3001, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3004, 78, 0, 0},
+    {3004, 79, 0, 0},
+    {3004, 80, 0, 0},
+    {3004, 81, 0, 0},
+    {3004, 82, 0, 0},
+    {3004, 83, 0, 0},
+    {3004, 84, 0, 0},
+    {3004, 85, 0, 0},
+    {3004, 86, 0, 0},
+    {3004, 87, 0, 0},
+    {3004, 88, 0, 0},
+    {3004, 89, 0, 0},
+    {3004, 90, 0, 0},
+    {3004, 91, 0, 0},
+    {3004, 92, 0, 0},
+    {3004, 93, 0, 0},
+    {3004, 94, 0, 0},
+    {3004, 95, 0, 0},
+    {3004, 96, 0, 0},
+    {2014, 97, 0, 0},
+    {2014, 98, 0, 0},
+    {2007, 99, 0, 0},
+    {2008, 100, 0, 0},
+    {2011, 101, 0, 0},
+    {2011, 102, 0, 0},
+    {2008, 103, 0, 0},
+    {2015, 104, 0, 0},
+    {2015, 105, 0, 0},
+    {2014, 106, 0, 0},
+    {2014, 107, 0, 0},
+    {2014, 108, 0, 0},
+    {2014, 109, 0, 0},
+    {2015, 110, 0, 0},
+    {2015, 111, 0, 0},
+    {2014, 112, 0, 0},
+    {2014, 113, 0, 0},
+    {2012, 114, 0, 0},
+    {2014, 115, 0, 0},
+    {2015, 116, 0, 0},
+    {3001, 117, 0, 0},
+    {2028, 118, 0, 0},
+    {2018, 119, 0, 0},
+    {2015, 120, 0, 0},
+    {2014, 121, 0, 0},
+    {2015, 122, 0, 0},
+    {2014, 123, 0, 0},
+    {2015, 124, 0, 0},
+    {2014, 125, 0, 0},
+    {2014, 126, 0, 0},
+    {2014, 127, 0, 0},
+    {48, 128, 0, 0},
+    {48, 129, 0, 0},
+    {2011, 130, 0, 0},
+    {3004, 131, 0, 0},
+    {3004, 132, 0, 0},
+    {3004, 133, 0, 0},
+    {3004, 134, 0, 0},
+    {3004, 135, 0, 0},
+    {3001, 136, 0, 0},
+    {2012, 137, 0, 0},
+    {2008, 138, 0, 0},
+    {8, 139, 0, 0},
+    {3001, 140, 0, 0},
+    {3001, 141, 0, 0},
+    {2012, 142, 0, 0},
+    {2048, 143, 0, 0},
+    {2012, 144, 0, 0},
+    {2048, 145, 0, 0},
+    {2012, 146, 0, 0},
+    {2012, 147, 0, 0},
+    {2008, 148, 0, 0},
+    {2007, 149, 0, 0},
+    {3001, 150, 0, 0},
+    {3004, 151, 0, 0},
+    {2008, 152, 0, 0},
+    {2008, 153, 0, 0},
+    {2008, 154, 0, 0},
+    {2008, 155, 0, 0},
+    {2008, 156, 0, 0},
+    {2008, 157, 0, 0},
+    {2008, 158, 0, 0},
+    {2008, 159, 0, 0},
+    {2007, 160, 0, 0},
+    {2007, 161, 0, 0},
+    {2007, 162, 0, 0},
+    {2048, 163, 0, 0},
+    {2048, 164, 0, 0},
+    {2007, 165, 0, 0},
+    {2007, 166, 0, 0},
+    {2007, 167, 0, 0},
+    {2012, 168, 0, 0},
+    {2007, 169, 0, 0},
+    {2007, 170, 0, 0},
+    {2048, 171, 0, 0},
+    {2048, 172, 0, 0},
+    {2048, 173, 0, 0},
+    {2048, 174, 0, 0},
+    {2048, 175, 0, 0},
+    {2048, 176, 0, 0},
+    {2048, 177, 0, 0},
+    {2048, 178, 0, 0},
+    {2048, 179, 0, 0},
+    {2048, 180, 0, 0},
+    {2015, 181, 0, 0},
+    {2015, 182, 0, 0},
+    {2015, 183, 0, 0},
+    {2015, 184, 0, 0},
+    {2003, 185, 0, 0},
+    {2046, 186, 0, 0},
+    {2046, 187, 0, 0},
+    {2046, 188, 0, 0},
+    {2046, 189, 0, 0},
+    {2014, 190, 0, 0},
+    {2014, 191, 0, 0},
+    {9, 192, 0, 0},
+    {9, 193, 0, 0},
+    {9, 194, 0, 0},
+    {9, 195, 0, 0},
+    {9, 196, 0, 0},
+    {9, 197, 0, 0},
+    {9, 198, 0, 0},
+    {9, 199, 0, 0},
+    {8, 200, 0, 0},
+    {2035, 201, 0, 0},
+    {2035, 202, 0, 0},
+    {2035, 203, 0, 0},
+    {2035, 204, 0, 0},
+    {2035, 205, 0, 0},
+    {2035, 206, 0, 0},
+    {2035, 207, 0, 0},
+    {2035, 208, 0, 0},
+    {2035, 209, 0, 0},
+    {2035, 210, 0, 0},
+    {2035, 211, 0, 0},
+    {2035, 212, 0, 0},
+    {2035, 213, 0, 0},
+    {2035, 214, 0, 0},
+    {2035, 215, 0, 0},
+    {2035, 216, 0, 0},
+    {2035, 217, 0, 0},
+    {2035, 218, 0, 0},
+    {2035, 219, 0, 0},
+    {2035, 220, 0, 0},
+    {2035, 221, 0, 0},
+    {2035, 222, 0, 0},
+    {2035, 223, 0, 0},
+    {2035, 224, 0, 0},
+    {11, 225, 0, 0},
+    {11, 226, 0, 0},
+    {11, 227, 0, 0},
+    {11, 228, 0, 0},
+    {11, 229, 0, 0},
+    {11, 230, 0, 0},
+    {11, 231, 0, 0},
+    {11, 232, 0, 0},
+    {11, 233, 0, 0},
+    {11, 234, 0, 0},
+    {3004, 235, 0, 0},
+    {3004, 236, 0, 0},
+    {15, 237, 0, 0},
+    {15, 238, 0, 0},
+    {24, 239, 0, 0},
+    {24, 240, 0, 0},
+    {24, 241, 0, 0},
+    {12, 242, 0, 0},
+    {12, 243, 0, 0},
+    {10, 244, 0, 0},
+    {10, 245, 0, 0},
+    {10, 246, 0, 0},
+    {10, 247, 0, 0},
+    {10, 248, 0, 0},
+    {15, 249, 0, 0},
+    {15, 250, 0, 0},
+    {15, 251, 0, 0},
+    {24, 252, 0, 0},
+    {10, 253, 0, 0},
+    {15, 254, 0, 0},
+    {15, 255, 0, 0},
+    {24, 256, 0, 0},
+    {10, 257, 0, 0},
+    {15, 258, 0, 0},
+    {12, 259, 0, 0},
+    {10, 260, 0, 0},
+    {10, 261, 0, 0},
+    // Toxin Refinery (E1M3)
+    {1, 0, 0, 0},
+    {3, 1, 0, 0},
+    {2, 2, 0, 0},
+    {4, 3, 0, 0},
+    {2014, 4, 0, 0},
+    {2015, 5, 0, 0},
+    {2015, 6, 0, 0},
+    {2007, 7, 0, 0},
+    {2018, 8, 0, 0},
+    {2013, 9, 0, 0},
+    {2014, 10, 0, 0},
+    {2014, 11, 0, 0},
+    {2014, 12, 0, 0},
+    {2015, 13, 0, 0},
+    {2014, 14, 0, 0},
+    {2015, 15, 0, 0},
+    {2015, 16, 0, 0},
+    {2012, 17, 0, 0},
+    {6, 18, 0, 0},
+    {5, 19, 0, 0},
+    {2014, 20, 0, 0},
+    {2014, 21, 0, 0},
+    {2049, 22, 0, 0},
+    {2049, 23, 0, 0},
+    {48, 24, 0, 0},
+    {48, 25, 0, 0},
+    {48, 26, 0, 0},
+    {48, 27, 0, 0},
+    {48, 28, 0, 0},
+    {48, 29, 0, 0},
+    {48, 30, 0, 0},
+    {48, 31, 0, 0},
+    {48, 32, 0, 0},
+    {2028, 33, 0, 0},
+    {2028, 34, 0, 0},
+    {2028, 35, 0, 0},
+    {2028, 36, 0, 0},
+    {2035, 37, 0, 0},
+    {2035, 38, 0, 0},
+    {2035, 39, 0, 0},
+    {2035, 40, 0, 0},
+    {2035, 41, 0, 0},
+    {2035, 42, 0, 0},
+    {3004, 43, 0, 0},
+    {3004, 44, 0, 0},
+    {3004, 45, 0, 0},
+    {3004, 46, 0, 0},
+    {9, 47, 0, 0},
+    {9, 48, 0, 0},
+    {9, 49, 0, 0},
+    {2012, 50, 0, 0},
+    {2012, 51, 0, 0},
+    {2035, 52, 0, 0},
+    {2035, 53, 0, 0},
+    {2035, 54, 0, 0},
+    {2035, 55, 0, 0},
+    {2035, 56, 0, 0},
+    {2035, 57, 0, 0},
+    {3002, 58, 0, 0},
+    {2008, 59, 0, 0},
+    {2007, 60, 0, 0},
+    {2007, 61, 0, 0},
+    {2011, 62, 0, 0},
+    {2011, 63, 0, 0},
+    {2001, 64, 0, 0},
+    {3004, 65, 0, 0},
+    {3004, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {9, 68, 0, 0},
+    {9, 69, 0, 0},
+    {2049, 70, 0, 0},
+    {2035, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {3001, 73, 0, 0},
+    {3001, 74, 0, 0},
+    {9, 75, 0, 0},
+    {2035, 76, 0, 0},
+    {2001, 77, 0, 0},
+    {2008, 78, 0, 0},
+    {2007, 79, 0, 0},
+    {2011, 80, 0, 0},
+    {2014, 81, 0, 0},
+    {2014, 82, 0, 0},
+    {2014, 83, 0, 0},
+    {2015, 84, 0, 0},
+    {2018, 85, 0, 0},
+    {2014, 86, 0, 0},
+    {2014, 87, 0, 0},
+    {2014, 88, 0, 0},
+    {2015, 89, 0, 0},
+    {2015, 90, 0, 0},
+    {2015, 91, 0, 0},
+    {2015, 92, 0, 0},
+    {2015, 93, 0, 0},
+    {2015, 94, 0, 0},
+    {2015, 95, 0, 0},
+    {2015, 96, 0, 0},
+    {2015, 97, 0, 0},
+    {2015, 98, 0, 0},
+    {2015, 99, 0, 0},
+    {3001, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3004, 103, 0, 0},
+    {2014, 104, 0, 0},
+    {2014, 105, 0, 0},
+    {2007, 106, 0, 0},
+    {2003, 107, 0, 0},
+    {2046, 108, 0, 0},
+    {2002, 109, 0, 0},
+    {2048, 110, 0, 0},
+    {2048, 111, 0, 0},
+    {8, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {3001, 115, 0, 0},
+    {9, 116, 0, 0},
+    {2012, 117, 0, 0},
+    {2012, 118, 0, 0},
+    {2012, 119, 0, 0},
+    {2011, 120, 0, 0},
+    {2011, 121, 0, 0},
+    {2048, 122, 0, 0},
+    {2008, 123, 0, 0},
+    {2008, 124, 0, 0},
+    {2008, 125, 0, 0},
+    {3001, 126, 0, 0},
+    {3001, 127, 0, 0},
+    {9, 128, 0, 0},
+    {9, 129, 0, 0},
+    {3002, 130, 0, 0},
+    {58, 131, 0, 0},
+    {3002, 132, 0, 0},
+    {2008, 133, 0, 0},
+    {2008, 134, 0, 0},
+    {2035, 135, 0, 0},
+    {2035, 136, 0, 0},
+    {2035, 137, 0, 0},
+    {2035, 138, 0, 0},
+    {2014, 139, 0, 0},
+    {2014, 140, 0, 0},
+    {2014, 141, 0, 0},
+    {2014, 142, 0, 0},
+    {2014, 143, 0, 0},
+    {2014, 144, 0, 0},
+    {2015, 145, 0, 0},
+    {2015, 146, 0, 0},
+    {2015, 147, 0, 0},
+    {2015, 148, 0, 0},
+    {2015, 149, 0, 0},
+    {2015, 150, 0, 0},
+    {2008, 151, 0, 0},
+    {2008, 152, 0, 0},
+    {2008, 153, 0, 0},
+    {2014, 154, 0, 0},
+    {2014, 155, 0, 0},
+    {2014, 156, 0, 0},
+    {2014, 157, 0, 0},
+    {2011, 158, 0, 0},
+    {3001, 159, 0, 0},
+    {3004, 160, 0, 0},
+    {3004, 161, 0, 0},
+    {3004, 162, 0, 0},
+    {9, 163, 0, 0},
+    {9, 164, 0, 0},
+    {9, 165, 0, 0},
+    {3001, 166, 0, 0},
+    {2012, 167, 0, 0},
+    {2011, 168, 0, 0},
+    {2008, 169, 0, 0},
+    {3001, 170, 0, 0},
+    {3001, 171, 0, 0},
+    {3004, 172, 0, 0},
+    {3004, 173, 0, 0},
+    {9, 174, 0, 0},
+    {3002, 175, 0, 0},
+    {3002, 176, 0, 0},
+    {2008, 177, 0, 0},
+    {2007, 178, 0, 0},
+    {2011, 179, 0, 0},
+    {2035, 180, 0, 0},
+    {2035, 181, 0, 0},
+    {2035, 182, 0, 0},
+    {9, 183, 0, 0},
+    {9, 184, 0, 0},
+    {9, 185, 0, 0},
+    {3004, 186, 0, 0},
+    {3002, 187, 0, 0},
+    {2035, 188, 0, 0},
+    {3004, 189, 0, 0},
+    {3004, 190, 0, 0},
+    {3001, 191, 0, 0},
+    {3001, 192, 0, 0},
+    {3001, 193, 0, 0},
+    {3001, 194, 0, 0},
+    {2035, 195, 0, 0},
+    {2014, 196, 0, 0},
+    {2014, 197, 0, 0},
+    {2015, 198, 0, 0},
+    {2015, 199, 0, 0},
+    {2028, 200, 0, 0},
+    {2049, 201, 0, 0},
+    {2048, 202, 0, 0},
+    {2012, 203, 0, 0},
+    {2008, 204, 0, 0},
+    {2007, 205, 0, 0},
+    {2007, 206, 0, 0},
+    {2014, 207, 0, 0},
+    {2014, 208, 0, 0},
+    {2015, 209, 0, 0},
+    {2015, 210, 0, 0},
+    {2015, 211, 0, 0},
+    {2015, 212, 0, 0},
+    {3002, 213, 0, 0},
+    {3001, 214, 0, 0},
+    {2012, 215, 0, 0},
+    {2014, 216, 0, 0},
+    {2014, 217, 0, 0},
+    {2014, 218, 0, 0},
+    {2014, 219, 0, 0},
+    {48, 220, 0, 0},
+    {48, 221, 0, 0},
+    {3004, 222, 0, 0},
+    {3004, 223, 0, 0},
+    {3004, 224, 0, 0},
+    {3004, 225, 0, 0},
+    {9, 226, 0, 0},
+    {9, 227, 0, 0},
+    {9, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {3001, 230, 0, 0},
+    {3001, 231, 0, 0},
+    {3001, 232, 0, 0},
+    {3001, 233, 0, 0},
+    {2035, 234, 0, 0},
+    {2035, 235, 0, 0},
+    {2008, 236, 0, 0},
+    {2008, 237, 0, 0},
+    {2012, 238, 0, 0},
+    {2014, 239, 0, 0},
+    {2014, 240, 0, 0},
+    {2014, 241, 0, 0},
+    {2014, 242, 0, 0},
+    {2015, 243, 0, 0},
+    {2015, 244, 0, 0},
+    {2015, 245, 0, 0},
+    {2015, 246, 0, 0},
+    {3001, 247, 0, 0},
+    {3001, 248, 0, 0},
+    {9, 249, 0, 0},
+    {9, 250, 0, 0},
+    {9, 251, 0, 0},
+    {9, 252, 0, 0},
+    {3004, 253, 0, 0},
+    {3004, 254, 0, 0},
+    {3004, 255, 0, 0},
+    {3004, 256, 0, 0},
+    {3004, 257, 0, 0},
+    {2012, 258, 0, 0},
+    {2013, 259, 0, 0},
+    {2024, 260, 0, 0},
+    {2005, 261, 0, 0},
+    {2046, 262, 0, 0},
+    {2012, 263, 0, 0},
+    {2012, 264, 0, 0},
+    {2019, 265, 0, 0},
+    {2014, 266, 0, 0},
+    {2014, 267, 0, 0},
+    {2014, 268, 0, 0},
+    {2014, 269, 0, 0},
+    {2015, 270, 0, 0},
+    {2015, 271, 0, 0},
+    {2015, 272, 0, 0},
+    {2015, 273, 0, 0},
+    {2014, 274, 0, 0},
+    {2014, 275, 0, 0},
+    {2015, 276, 0, 0},
+    {2015, 277, 0, 0},
+    {2015, 278, 0, 0},
+    {2015, 279, 0, 0},
+    {2015, 280, 0, 0},
+    {2014, 281, 0, 0},
+    {2014, 282, 0, 0},
+    {2035, 283, 0, 0},
+    {2035, 284, 0, 0},
+    {2035, 285, 0, 0},
+    {2011, 286, 0, 0},
+    {2011, 287, 0, 0},
+    {2011, 288, 0, 0},
+    {2011, 289, 0, 0},
+    {3001, 290, 0, 0},
+    {3001, 291, 0, 0},
+    {3001, 292, 0, 0},
+    {3001, 293, 0, 0},
+    {3001, 294, 0, 0},
+    {9, 295, 0, 0},
+    {9, 296, 0, 0},
+    {9, 297, 0, 0},
+    {9, 298, 0, 0},
+    {3004, 299, 0, 0},
+    {3004, 300, 0, 0},
+    {3004, 301, 0, 0},
+    {3004, 302, 0, 0},
+    {9, 303, 0, 0},
+    {9, 304, 0, 0},
+    {9, 305, 0, 0},
+    {9, 306, 0, 0},
+    {9, 307, 0, 0},
+    {3001, 308, 0, 0},
+    {2012, 309, 0, 0},
+    {2011, 310, 0, 0},
+    {2008, 311, 0, 0},
+    {2008, 312, 0, 0},
+    {2007, 313, 0, 0},
+    {2007, 314, 0, 0},
+    {2014, 315, 0, 0},
+    {2014, 316, 0, 0},
+    {2014, 317, 0, 0},
+    {2015, 318, 0, 0},
+    {2015, 319, 0, 0},
+    {2049, 320, 0, 0},
+    {2048, 321, 0, 0},
+    {2028, 322, 0, 0},
+    {2018, 323, 0, 0},
+    {2012, 324, 0, 0},
+    {3001, 325, 0, 0},
+    {9, 326, 0, 0},
+    {9, 327, 0, 0},
+    {3001, 328, 0, 0},
+    {9, 329, 0, 0},
+    {9, 330, 0, 0},
+    {3001, 331, 0, 0},
+    {3001, 332, 0, 0},
+    {3001, 333, 0, 0},
+    {3001, 334, 0, 0},
+    {3001, 335, 0, 0},
+    {3001, 336, 0, 0},
+    {3001, 337, 0, 0},
+    {9, 338, 0, 0},
+    {9, 339, 0, 0},
+    {9, 340, 0, 0},
+    {9, 341, 0, 0},
+    {9, 342, 0, 0},
+    {9, 343, 0, 0},
+    {9, 344, 0, 0},
+    {9, 345, 0, 0},
+    {3001, 346, 0, 0},
+    {3001, 347, 0, 0},
+    {9, 348, 0, 0},
+    {9, 349, 0, 0},
+    {3001, 350, 0, 0},
+    {3001, 351, 0, 0},
+    {9, 352, 0, 0},
+    {58, 353, 0, 0},
+    {2011, 354, 0, 0},
+    {11, 355, 0, 0},
+    {11, 356, 0, 0},
+    {11, 357, 0, 0},
+    {11, 358, 0, 0},
+    {11, 359, 0, 0},
+    {11, 360, 0, 0},
+    {11, 361, 0, 0},
+    {11, 362, 0, 0},
+    {11, 363, 0, 0},
+    {15, 364, 0, 0},
+    {24, 365, 0, 0},
+    {10, 366, 0, 0},
+    {12, 367, 0, 0},
+    {10, 368, 0, 0},
+    {15, 369, 0, 0},
+    {24, 370, 0, 0},
+    {24, 371, 0, 0},
+    {15, 372, 0, 0},
+    {10, 373, 0, 0},
+    {10, 374, 0, 0},
+    {12, 375, 0, 0},
+    {15, 376, 0, 0},
+    {15, 377, 0, 0},
+    {24, 378, 0, 0},
+    {2046, 379, 0, 0},
+    // Command Control (E1M4)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {2014, 6, 0, 0},
+    {2014, 7, 0, 0},
+    {2014, 8, 0, 0},
+    {2014, 9, 0, 0},
+    {2014, 10, 0, 0},
+    {2002, 11, 0, 0},
+    {9, 12, 0, 0},
+    {9, 13, 0, 0},
+    {9, 14, 0, 0},
+    {2008, 15, 0, 0},
+    {2008, 16, 0, 0},
+    {2007, 17, 0, 0},
+    {2007, 18, 0, 0},
+    {2008, 19, 0, 0},
+    {2007, 20, 0, 0},
+    {2007, 21, 0, 0},
+    {2048, 22, 0, 0},
+    {2011, 23, 0, 0},
+    {2046, 24, 0, 0},
+    {2014, 25, 0, 0},
+    {2014, 26, 0, 0},
+    {2014, 27, 0, 0},
+    {2014, 28, 0, 0},
+    {2014, 29, 0, 0},
+    {2014, 30, 0, 0},
+    {2014, 31, 0, 0},
+    {2014, 32, 0, 0},
+    {2014, 33, 0, 0},
+    {2014, 34, 0, 0},
+    {2014, 35, 0, 0},
+    {2014, 36, 0, 0},
+    {2014, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2018, 39, 0, 0},
+    {2012, 40, 0, 0},
+    {3004, 41, 0, 0},
+    {3004, 42, 0, 0},
+    {3004, 43, 0, 0},
+    {3004, 44, 0, 0},
+    {3004, 45, 0, 0},
+    {2048, 46, 0, 0},
+    {2007, 47, 0, 0},
+    {2008, 48, 0, 0},
+    {2007, 49, 0, 0},
+    {9, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {3004, 52, 0, 0},
+    {3004, 53, 0, 0},
+    {3004, 54, 0, 0},
+    {3004, 55, 0, 0},
+    {2049, 56, 0, 0},
+    {2012, 57, 0, 0},
+    {3001, 58, 0, 0},
+    {3001, 59, 0, 0},
+    {3001, 60, 0, 0},
+    {6, 61, 0, 0},
+    {5, 62, 0, 0},
+    {2013, 63, 0, 0},
+    {2003, 64, 0, 0},
+    {2007, 65, 0, 0},
+    {2010, 66, 0, 0},
+    {2025, 67, 0, 0},
+    {2015, 68, 0, 0},
+    {2015, 69, 0, 0},
+    {2015, 70, 0, 0},
+    {2015, 71, 0, 0},
+    {2015, 72, 0, 0},
+    {2015, 73, 0, 0},
+    {2015, 74, 0, 0},
+    {2012, 75, 0, 0},
+    {2011, 76, 0, 0},
+    {2011, 77, 0, 0},
+    {2008, 78, 0, 0},
+    {3004, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3002, 81, 0, 0},
+    {3002, 82, 0, 0},
+    {3002, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {3001, 85, 0, 0},
+    {3004, 86, 0, 0},
+    {3001, 87, 0, 0},
+    {3001, 88, 0, 0},
+    {2025, 89, 0, 0},
+    {3001, 90, 0, 0},
+    {3001, 91, 0, 0},
+    {2011, 92, 0, 0},
+    {2012, 93, 0, 0},
+    {2014, 94, 0, 0},
+    {2048, 95, 0, 0},
+    {2048, 96, 0, 0},
+    {2007, 97, 0, 0},
+    {2008, 98, 0, 0},
+    {2008, 99, 0, 0},
+    {2019, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {2011, 103, 0, 0},
+    {2011, 104, 0, 0},
+    {2011, 105, 0, 0},
+    {2011, 106, 0, 0},
+    {8, 107, 0, 0},
+    {3001, 108, 0, 0},
+    {3002, 109, 0, 0},
+    {3001, 110, 0, 0},
+    {3001, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {3004, 115, 0, 0},
+    {3004, 116, 0, 0},
+    {3004, 117, 0, 0},
+    {9, 118, 0, 0},
+    {3004, 119, 0, 0},
+    {9, 120, 0, 0},
+    {3004, 121, 0, 0},
+    {3004, 122, 0, 0},
+    {3002, 123, 0, 0},
+    {9, 124, 0, 0},
+    {9, 125, 0, 0},
+    {2014, 126, 0, 0},
+    {2014, 127, 0, 0},
+    {2014, 128, 0, 0},
+    {2001, 129, 0, 0},
+    {3001, 130, 0, 0},
+    {3001, 131, 0, 0},
+    {3001, 132, 0, 0},
+    {3001, 133, 0, 0},
+    {2007, 134, 0, 0},
+    {2011, 135, 0, 0},
+    {2028, 136, 0, 0},
+    {2028, 137, 0, 0},
+    {2028, 138, 0, 0},
+    {2028, 139, 0, 0},
+    {3001, 140, 0, 0},
+    {3001, 141, 0, 0},
+    {3002, 142, 0, 0},
+    {3002, 143, 0, 0},
+    {3001, 144, 0, 0},
+    {3002, 145, 0, 0},
+    {3002, 146, 0, 0},
+    {2007, 147, 0, 0},
+    {2007, 148, 0, 0},
+    {9, 149, 0, 0},
+    {9, 150, 0, 0},
+    {9, 151, 0, 0},
+    {3001, 152, 0, 0},
+    {3001, 153, 0, 0},
+    {3001, 154, 0, 0},
+    {3001, 155, 0, 0},
+    {3001, 156, 0, 0},
+    {3001, 157, 0, 0},
+    {3002, 158, 0, 0},
+    {9, 159, 0, 0},
+    {9, 160, 0, 0},
+    {3001, 161, 0, 0},
+    {3001, 162, 0, 0},
+    {9, 163, 0, 0},
+    {3004, 164, 0, 0},
+    {3004, 165, 0, 0},
+    {3004, 166, 0, 0},
+    {9, 167, 0, 0},
+    {3002, 168, 0, 0},
+    {3001, 169, 0, 0},
+    {2014, 170, 0, 0},
+    {2014, 171, 0, 0},
+    {2015, 172, 0, 0},
+    {2015, 173, 0, 0},
+    {2015, 174, 0, 0},
+    {2015, 175, 0, 0},
+    {2015, 176, 0, 0},
+    {2015, 177, 0, 0},
+    {2015, 178, 0, 0},
+    {2014, 179, 0, 0},
+    {2014, 180, 0, 0},
+    {2014, 181, 0, 0},
+    {2014, 182, 0, 0},
+    {2014, 183, 0, 0},
+    {11, 184, 0, 0},
+    {11, 185, 0, 0},
+    {11, 186, 0, 0},
+    {11, 187, 0, 0},
+    {11, 188, 0, 0},
+    {11, 189, 0, 0},
+    {11, 190, 0, 0},
+    {11, 191, 0, 0},
+    {11, 192, 0, 0},
+    {2046, 193, 0, 0},
+    {3004, 194, 0, 0},
+    {3004, 195, 0, 0},
+    {9, 196, 0, 0},
+    {9, 197, 0, 0},
+    {9, 198, 0, 0},
+    {2012, 199, 0, 0},
+    {2001, 200, 0, 0},
+    {2035, 201, 0, 0},
+    {2035, 202, 0, 0},
+    {2035, 203, 0, 0},
+    {2035, 204, 0, 0},
+    {2035, 205, 0, 0},
+    {2035, 206, 0, 0},
+    {2035, 207, 0, 0},
+    {2035, 208, 0, 0},
+    {2035, 209, 0, 0},
+    {2035, 210, 0, 0},
+    {2035, 211, 0, 0},
+    {2035, 212, 0, 0},
+    {2035, 213, 0, 0},
+    {2035, 214, 0, 0},
+    {2035, 215, 0, 0},
+    {2035, 216, 0, 0},
+    {2035, 217, 0, 0},
+    {2035, 218, 0, 0},
+    {2035, 219, 0, 0},
+    {2035, 220, 0, 0},
+    {2035, 221, 0, 0},
+    {2035, 222, 0, 0},
+    {2035, 223, 0, 0},
+    {2035, 224, 0, 0},
+    {2035, 225, 0, 0},
+    {2035, 226, 0, 0},
+    {2035, 227, 0, 0},
+    {2035, 228, 0, 0},
+    {2035, 229, 0, 0},
+    {2035, 230, 0, 0},
+    {2035, 231, 0, 0},
+    {2035, 232, 0, 0},
+    {15, 233, 0, 0},
+    {24, 234, 0, 0},
+    {24, 235, 0, 0},
+    {12, 236, 0, 0},
+    {24, 237, 0, 0},
+    {10, 238, 0, 0},
+    {15, 239, 0, 0},
+    {24, 240, 0, 0},
+    {12, 241, 0, 0},
+    {24, 242, 0, 0},
+    {10, 243, 0, 0},
+    {15, 244, 0, 0},
+    {10, 245, 0, 0},
+    {24, 246, 0, 0},
+    {10, 247, 0, 0},
+    {24, 248, 0, 0},
+    {10, 249, 0, 0},
+    {12, 250, 0, 0},
+    {12, 251, 0, 0},
+    {12, 252, 0, 0},
+    {15, 253, 0, 0},
+    // Phobos Lab (E1M5)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {5, 4, 0, 0},
+    {2014, 5, 0, 0},
+    {2014, 6, 0, 0},
+    {2014, 7, 0, 0},
+    {2015, 8, 0, 0},
+    {2014, 9, 0, 0},
+    {6, 10, 0, 0},
+    {2019, 11, 0, 0},
+    {2015, 12, 0, 0},
+    {2015, 13, 0, 0},
+    {2015, 14, 0, 0},
+    {2012, 15, 0, 0},
+    {2015, 16, 0, 0},
+    {2014, 17, 0, 0},
+    {2015, 18, 0, 0},
+    {2012, 19, 0, 0},
+    {2012, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {2015, 23, 0, 0},
+    {2015, 24, 0, 0},
+    {2045, 25, 0, 0},
+    {35, 26, 0, 0},
+    {35, 27, 0, 0},
+    {3004, 28, 0, 0},
+    {3004, 29, 0, 0},
+    {9, 30, 0, 0},
+    {9, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3004, 34, 0, 0},
+    {3004, 35, 0, 0},
+    {3004, 36, 0, 0},
+    {3004, 37, 0, 0},
+    {9, 38, 0, 0},
+    {9, 39, 0, 0},
+    {2025, 40, 0, 0},
+    {2008, 41, 0, 0},
+    {2007, 42, 0, 0},
+    {3004, 43, 0, 0},
+    {3004, 44, 0, 0},
+    {3001, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3002, 49, 0, 0},
+    {9, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {9, 52, 0, 0},
+    {9, 53, 0, 0},
+    {3004, 54, 0, 0},
+    {3002, 55, 0, 0},
+    {9, 56, 0, 0},
+    {3004, 57, 0, 0},
+    {3004, 58, 0, 0},
+    {2007, 59, 0, 0},
+    {2003, 60, 0, 0},
+    {2046, 61, 0, 0},
+    {2008, 62, 0, 0},
+    {2008, 63, 0, 0},
+    {2008, 64, 0, 0},
+    {58, 65, 0, 0},
+    {9, 66, 0, 0},
+    {3004, 67, 0, 0},
+    {3004, 68, 0, 0},
+    {3004, 69, 0, 0},
+    {3004, 70, 0, 0},
+    {3004, 71, 0, 0},
+    {3004, 72, 0, 0},
+    {3004, 73, 0, 0},
+    {9, 74, 0, 0},
+    {2001, 75, 0, 0},
+    {2049, 76, 0, 0},
+    {2008, 77, 0, 0},
+    {9, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {9, 80, 0, 0},
+    {2008, 81, 0, 0},
+    {2008, 82, 0, 0},
+    {2001, 83, 0, 0},
+    {2035, 84, 0, 0},
+    {2035, 85, 0, 0},
+    {2035, 86, 0, 0},
+    {2035, 87, 0, 0},
+    {2035, 88, 0, 0},
+    {2035, 89, 0, 0},
+    {2035, 90, 0, 0},
+    {2035, 91, 0, 0},
+    {2035, 92, 0, 0},
+    {2035, 93, 0, 0},
+    {2035, 94, 0, 0},
+    {2035, 95, 0, 0},
+    {2035, 96, 0, 0},
+    {2035, 97, 0, 0},
+    {2035, 98, 0, 0},
+    {2035, 99, 0, 0},
+    {2035, 100, 0, 0},
+    {2035, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {3004, 104, 0, 0},
+    {3004, 105, 0, 0},
+    {3004, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {58, 109, 0, 0},
+    {3001, 110, 0, 0},
+    {3001, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {9, 115, 0, 0},
+    {9, 116, 0, 0},
+    {3002, 117, 0, 0},
+    {3002, 118, 0, 0},
+    {2035, 119, 0, 0},
+    {2035, 120, 0, 0},
+    {3002, 121, 0, 0},
+    {9, 122, 0, 0},
+    {9, 123, 0, 0},
+    {3004, 124, 0, 0},
+    {2008, 125, 0, 0},
+    {3001, 126, 0, 0},
+    {3002, 127, 0, 0},
+    {3004, 128, 0, 0},
+    {3004, 129, 0, 0},
+    {3002, 130, 0, 0},
+    {3002, 131, 0, 0},
+    {3002, 132, 0, 0},
+    {9, 133, 0, 0},
+    {9, 134, 0, 0},
+    {9, 135, 0, 0},
+    {9, 136, 0, 0},
+    {9, 137, 0, 0},
+    {9, 138, 0, 0},
+    {2011, 139, 0, 0},
+    {2012, 140, 0, 0},
+    {2012, 141, 0, 0},
+    {2011, 142, 0, 0},
+    {2011, 143, 0, 0},
+    {2011, 144, 0, 0},
+    {2011, 145, 0, 0},
+    {2011, 146, 0, 0},
+    {2011, 147, 0, 0},
+    {2011, 148, 0, 0},
+    {3004, 149, 0, 0},
+    {3004, 150, 0, 0},
+    {3004, 151, 0, 0},
+    {9, 152, 0, 0},
+    {9, 153, 0, 0},
+    {9, 154, 0, 0},
+    {9, 155, 0, 0},
+    {9, 156, 0, 0},
+    {9, 157, 0, 0},
+    {9, 158, 0, 0},
+    {9, 159, 0, 0},
+    {2012, 160, 0, 0},
+    {58, 161, 0, 0},
+    {2008, 162, 0, 0},
+    {2008, 163, 0, 0},
+    {2008, 164, 0, 0},
+    {2011, 165, 0, 0},
+    {2011, 166, 0, 0},
+    {2005, 167, 0, 0},
+    {2003, 168, 0, 0},
+    {2013, 169, 0, 0},
+    {2015, 170, 0, 0},
+    {2048, 171, 0, 0},
+    {2015, 172, 0, 0},
+    {2002, 173, 0, 0},
+    {8, 174, 0, 0},
+    {2011, 175, 0, 0},
+    {2026, 176, 0, 0},
+    {3002, 177, 0, 0},
+    {3002, 178, 0, 0},
+    {3002, 179, 0, 0},
+    {58, 180, 0, 0},
+    {2012, 181, 0, 0},
+    {2012, 182, 0, 0},
+    {2012, 183, 0, 0},
+    {2012, 184, 0, 0},
+    {2012, 185, 0, 0},
+    {2012, 186, 0, 0},
+    {2012, 187, 0, 0},
+    {2012, 188, 0, 0},
+    {2012, 189, 0, 0},
+    {2012, 190, 0, 0},
+    {2012, 191, 0, 0},
+    {2012, 192, 0, 0},
+    {2012, 193, 0, 0},
+    {2012, 194, 0, 0},
+    {2012, 195, 0, 0},
+    {2012, 196, 0, 0},
+    {2012, 197, 0, 0},
+    {2012, 198, 0, 0},
+    {2012, 199, 0, 0},
+    {2012, 200, 0, 0},
+    {2012, 201, 0, 0},
+    {2012, 202, 0, 0},
+    {2010, 203, 0, 0},
+    {2010, 204, 0, 0},
+    {2010, 205, 0, 0},
+    {2019, 206, 0, 0},
+    {2048, 207, 0, 0},
+    {2001, 208, 0, 0},
+    {2008, 209, 0, 0},
+    {2035, 210, 0, 0},
+    {2035, 211, 0, 0},
+    {2015, 212, 0, 0},
+    {2015, 213, 0, 0},
+    {2015, 214, 0, 0},
+    {2015, 215, 0, 0},
+    {11, 216, 0, 0},
+    {11, 217, 0, 0},
+    {11, 218, 0, 0},
+    {11, 219, 0, 0},
+    {11, 220, 0, 0},
+    {11, 221, 0, 0},
+    {11, 222, 0, 0},
+    {11, 223, 0, 0},
+    {2011, 224, 0, 0},
+    {2011, 225, 0, 0},
+    {2011, 226, 0, 0},
+    {2011, 227, 0, 0},
+    {3001, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {9, 230, 0, 0},
+    {2008, 231, 0, 0},
+    {2008, 232, 0, 0},
+    {3001, 233, 0, 0},
+    {3001, 234, 0, 0},
+    {3001, 235, 0, 0},
+    {3001, 236, 0, 0},
+    {9, 237, 0, 0},
+    {9, 238, 0, 0},
+    {9, 239, 0, 0},
+    {58, 240, 0, 0},
+    {9, 241, 0, 0},
+    {9, 242, 0, 0},
+    {9, 243, 0, 0},
+    {9, 244, 0, 0},
+    {58, 245, 0, 0},
+    {9, 246, 0, 0},
+    {58, 247, 0, 0},
+    {58, 248, 0, 0},
+    {2035, 249, 0, 0},
+    {2035, 250, 0, 0},
+    {9, 251, 0, 0},
+    {9, 252, 0, 0},
+    {9, 253, 0, 0},
+    {9, 254, 0, 0},
+    {9, 255, 0, 0},
+    {3001, 256, 0, 0},
+    {3001, 257, 0, 0},
+    {3001, 258, 0, 0},
+    {3001, 259, 0, 0},
+    {3001, 260, 0, 0},
+    {3001, 261, 0, 0},
+    {3001, 262, 0, 0},
+    {3001, 263, 0, 0},
+    {58, 264, 0, 0},
+    {58, 265, 0, 0},
+    {58, 266, 0, 0},
+    {58, 267, 0, 0},
+    {58, 268, 0, 0},
+    {58, 269, 0, 0},
+    {2008, 270, 0, 0},
+    {2008, 271, 0, 0},
+    {2008, 272, 0, 0},
+    {2011, 273, 0, 0},
+    {2011, 274, 0, 0},
+    {2035, 275, 0, 0},
+    {2035, 276, 0, 0},
+    {2035, 277, 0, 0},
+    {2035, 278, 0, 0},
+    {2018, 279, 0, 0},
+    {2018, 280, 0, 0},
+    {14, 281, 0, 0},
+    {2024, 282, 0, 0},
+    {2046, 283, 0, 0},
+    {2012, 284, 0, 0},
+    {2012, 285, 0, 0},
+    {2014, 286, 0, 0},
+    {2014, 287, 0, 0},
+    {2014, 288, 0, 0},
+    {2014, 289, 0, 0},
+    {2014, 290, 0, 0},
+    {2014, 291, 0, 0},
+    {2049, 292, 0, 0},
+    // Central Processing (E1M6)
+    {2, 0, 0, 0},
+    {3, 1, 0, 0},
+    {4, 2, 0, 0},
+    {1, 3, 0, 0},
+    {2013, 4, 0, 0},
+    {5, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3001, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {13, 9, 0, 0},
+    {6, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {9, 14, 0, 0},
+    {9, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {3002, 17, 0, 0},
+    {3002, 18, 0, 0},
+    {58, 19, 0, 0},
+    {2035, 20, 0, 0},
+    {2012, 21, 0, 0},
+    {2024, 22, 0, 0},
+    {2002, 23, 0, 0},
+    {8, 24, 0, 0},
+    {2035, 25, 0, 0},
+    {2035, 26, 0, 0},
+    {2035, 27, 0, 0},
+    {2035, 28, 0, 0},
+    {2035, 29, 0, 0},
+    {2035, 30, 0, 0},
+    {2035, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3001, 38, 0, 0},
+    {3001, 39, 0, 0},
+    {58, 40, 0, 0},
+    {58, 41, 0, 0},
+    {58, 42, 0, 0},
+    {58, 43, 0, 0},
+    {9, 44, 0, 0},
+    {9, 45, 0, 0},
+    {9, 46, 0, 0},
+    {9, 47, 0, 0},
+    {9, 48, 0, 0},
+    {3004, 49, 0, 0},
+    {3004, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {3004, 52, 0, 0},
+    {3004, 53, 0, 0},
+    {2012, 54, 0, 0},
+    {2012, 55, 0, 0},
+    {2008, 56, 0, 0},
+    {2008, 57, 0, 0},
+    {2048, 58, 0, 0},
+    {2049, 59, 0, 0},
+    {2008, 60, 0, 0},
+    {2048, 61, 0, 0},
+    {2048, 62, 0, 0},
+    {2003, 63, 0, 0},
+    {2001, 64, 0, 0},
+    {2049, 65, 0, 0},
+    {2012, 66, 0, 0},
+    {2012, 67, 0, 0},
+    {2011, 68, 0, 0},
+    {2011, 69, 0, 0},
+    {2011, 70, 0, 0},
+    {2011, 71, 0, 0},
+    {2011, 72, 0, 0},
+    {2011, 73, 0, 0},
+    {3004, 74, 0, 0},
+    {3004, 75, 0, 0},
+    {3004, 76, 0, 0},
+    {9, 77, 0, 0},
+    {9, 78, 0, 0},
+    {58, 79, 0, 0},
+    {2012, 80, 0, 0},
+    {2019, 81, 0, 0},
+    {2018, 82, 0, 0},
+    {2011, 83, 0, 0},
+    {2008, 84, 0, 0},
+    {2015, 85, 0, 0},
+    {2014, 86, 0, 0},
+    {2015, 87, 0, 0},
+    {9, 88, 0, 0},
+    {3002, 89, 0, 0},
+    {3002, 90, 0, 0},
+    {58, 91, 0, 0},
+    {3001, 92, 0, 0},
+    {3001, 93, 0, 0},
+    {3001, 94, 0, 0},
+    {3001, 95, 0, 0},
+    {3004, 96, 0, 0},
+    {9, 97, 0, 0},
+    {2008, 98, 0, 0},
+    {2008, 99, 0, 0},
+    {2008, 100, 0, 0},
+    {2008, 101, 0, 0},
+    {2008, 102, 0, 0},
+    {2008, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3001, 105, 0, 0},
+    {3001, 106, 0, 0},
+    {3004, 107, 0, 0},
+    {9, 108, 0, 0},
+    {3001, 109, 0, 0},
+    {3001, 110, 0, 0},
+    {3001, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {9, 115, 0, 0},
+    {9, 116, 0, 0},
+    {9, 117, 0, 0},
+    {9, 118, 0, 0},
+    {2049, 119, 0, 0},
+    {2008, 120, 0, 0},
+    {2008, 121, 0, 0},
+    {2048, 122, 0, 0},
+    {8, 123, 0, 0},
+    {2026, 124, 0, 0},
+    {2008, 125, 0, 0},
+    {2008, 126, 0, 0},
+    {2008, 127, 0, 0},
+    {2008, 128, 0, 0},
+    {2046, 129, 0, 0},
+    {2046, 130, 0, 0},
+    {2024, 131, 0, 0},
+    {2045, 132, 0, 0},
+    {2015, 133, 0, 0},
+    {2015, 134, 0, 0},
+    {2014, 135, 0, 0},
+    {2014, 136, 0, 0},
+    {2015, 137, 0, 0},
+    {2015, 138, 0, 0},
+    {2014, 139, 0, 0},
+    {2014, 140, 0, 0},
+    {2014, 141, 0, 0},
+    {2007, 142, 0, 0},
+    {2007, 143, 0, 0},
+    {2007, 144, 0, 0},
+    {2025, 145, 0, 0},
+    {2015, 146, 0, 0},
+    {2015, 147, 0, 0},
+    {2015, 148, 0, 0},
+    {9, 149, 0, 0},
+    {3004, 150, 0, 0},
+    {9, 151, 0, 0},
+    {2008, 152, 0, 0},
+    {2008, 153, 0, 0},
+    {2011, 154, 0, 0},
+    {2011, 155, 0, 0},
+    {3004, 156, 0, 0},
+    {3004, 157, 0, 0},
+    {9, 158, 0, 0},
+    {9, 159, 0, 0},
+    {2014, 160, 0, 0},
+    {2015, 161, 0, 0},
+    {2014, 162, 0, 0},
+    {2015, 163, 0, 0},
+    {2011, 164, 0, 0},
+    {2011, 165, 0, 0},
+    {2012, 166, 0, 0},
+    {2011, 167, 0, 0},
+    {58, 168, 0, 0},
+    {3004, 169, 0, 0},
+    {3004, 170, 0, 0},
+    {3004, 171, 0, 0},
+    {3004, 172, 0, 0},
+    {9, 173, 0, 0},
+    {9, 174, 0, 0},
+    {2008, 175, 0, 0},
+    {2008, 176, 0, 0},
+    {2025, 177, 0, 0},
+    {2012, 178, 0, 0},
+    {2011, 179, 0, 0},
+    {2048, 180, 0, 0},
+    {3004, 181, 0, 0},
+    {3004, 182, 0, 0},
+    {3004, 183, 0, 0},
+    {9, 184, 0, 0},
+    {3002, 185, 0, 0},
+    {9, 186, 0, 0},
+    {9, 187, 0, 0},
+    {9, 188, 0, 0},
+    {3001, 189, 0, 0},
+    {3001, 190, 0, 0},
+    {2011, 191, 0, 0},
+    {2012, 192, 0, 0},
+    {2011, 193, 0, 0},
+    {3001, 194, 0, 0},
+    {3001, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {2049, 197, 0, 0},
+    {35, 198, 0, 0},
+    {35, 199, 0, 0},
+    {2028, 200, 0, 0},
+    {2028, 201, 0, 0},
+    {2028, 202, 0, 0},
+    {2028, 203, 0, 0},
+    {2028, 204, 0, 0},
+    {2028, 205, 0, 0},
+    {2028, 206, 0, 0},
+    {2028, 207, 0, 0},
+    {2028, 208, 0, 0},
+    {2028, 209, 0, 0},
+    {3001, 210, 0, 0},
+    {3001, 211, 0, 0},
+    {3001, 212, 0, 0},
+    {3001, 213, 0, 0},
+    {2018, 214, 0, 0},
+    {2012, 215, 0, 0},
+    {2012, 216, 0, 0},
+    {2012, 217, 0, 0},
+    {3001, 218, 0, 0},
+    {3001, 219, 0, 0},
+    {9, 220, 0, 0},
+    {3004, 221, 0, 0},
+    {3004, 222, 0, 0},
+    {9, 223, 0, 0},
+    {58, 224, 0, 0},
+    {3002, 225, 0, 0},
+    {2012, 226, 0, 0},
+    {2011, 227, 0, 0},
+    {2007, 228, 0, 0},
+    {2007, 229, 0, 0},
+    {2007, 230, 0, 0},
+    {2008, 231, 0, 0},
+    {2048, 232, 0, 0},
+    {2035, 233, 0, 0},
+    {2035, 234, 0, 0},
+    {2035, 235, 0, 0},
+    {2035, 236, 0, 0},
+    {2035, 237, 0, 0},
+    {3001, 238, 0, 0},
+    {3001, 239, 0, 0},
+    {3001, 240, 0, 0},
+    {3001, 241, 0, 0},
+    {3001, 242, 0, 0},
+    {3002, 243, 0, 0},
+    {3002, 244, 0, 0},
+    {3002, 245, 0, 0},
+    {3002, 246, 0, 0},
+    {9, 247, 0, 0},
+    {9, 248, 0, 0},
+    {9, 249, 0, 0},
+    {9, 250, 0, 0},
+    {2035, 251, 0, 0},
+    {2035, 252, 0, 0},
+    {2035, 253, 0, 0},
+    {9, 254, 0, 0},
+    {9, 255, 0, 0},
+    {2010, 256, 0, 0},
+    {2008, 257, 0, 0},
+    {2008, 258, 0, 0},
+    {2007, 259, 0, 0},
+    {2007, 260, 0, 0},
+    {2007, 261, 0, 0},
+    {2012, 262, 0, 0},
+    {2011, 263, 0, 0},
+    {2011, 264, 0, 0},
+    {2011, 265, 0, 0},
+    {48, 266, 0, 0},
+    {48, 267, 0, 0},
+    {48, 268, 0, 0},
+    {58, 269, 0, 0},
+    {58, 270, 0, 0},
+    {58, 271, 0, 0},
+    {2035, 272, 0, 0},
+    {2012, 273, 0, 0},
+    {2014, 274, 0, 0},
+    {2014, 275, 0, 0},
+    {2014, 276, 0, 0},
+    {2014, 277, 0, 0},
+    {2015, 278, 0, 0},
+    {2015, 279, 0, 0},
+    {2015, 280, 0, 0},
+    {2015, 281, 0, 0},
+    {2015, 282, 0, 0},
+    {2015, 283, 0, 0},
+    {2015, 284, 0, 0},
+    {2015, 285, 0, 0},
+    {2015, 286, 0, 0},
+    {2015, 287, 0, 0},
+    {2014, 288, 0, 0},
+    {2014, 289, 0, 0},
+    {2014, 290, 0, 0},
+    {2018, 291, 0, 0},
+    {3001, 292, 0, 0},
+    {9, 293, 0, 0},
+    {9, 294, 0, 0},
+    {3002, 295, 0, 0},
+    {3002, 296, 0, 0},
+    {3002, 297, 0, 0},
+    {3001, 298, 0, 0},
+    {9, 299, 0, 0},
+    {9, 300, 0, 0},
+    {9, 301, 0, 0},
+    {2008, 302, 0, 0},
+    {2011, 303, 0, 0},
+    {2014, 304, 0, 0},
+    {2014, 305, 0, 0},
+    {2014, 306, 0, 0},
+    {2025, 307, 0, 0},
+    {2014, 308, 0, 0},
+    {2014, 309, 0, 0},
+    {2015, 310, 0, 0},
+    {2015, 311, 0, 0},
+    {2015, 312, 0, 0},
+    {2015, 313, 0, 0},
+    {2015, 314, 0, 0},
+    {2015, 315, 0, 0},
+    {2015, 316, 0, 0},
+    {2015, 317, 0, 0},
+    {2015, 318, 0, 0},
+    {2015, 319, 0, 0},
+    {2015, 320, 0, 0},
+    {2015, 321, 0, 0},
+    {2015, 322, 0, 0},
+    {2015, 323, 0, 0},
+    {2015, 324, 0, 0},
+    {2015, 325, 0, 0},
+    {2015, 326, 0, 0},
+    {2015, 327, 0, 0},
+    {2015, 328, 0, 0},
+    {2015, 329, 0, 0},
+    {2015, 330, 0, 0},
+    {2015, 331, 0, 0},
+    {2015, 332, 0, 0},
+    {2015, 333, 0, 0},
+    {2015, 334, 0, 0},
+    {2015, 335, 0, 0},
+    {2015, 336, 0, 0},
+    {2015, 337, 0, 0},
+    {2015, 338, 0, 0},
+    {2015, 339, 0, 0},
+    {2015, 340, 0, 0},
+    {2015, 341, 0, 0},
+    {2015, 342, 0, 0},
+    {2015, 343, 0, 0},
+    {2015, 344, 0, 0},
+    {2015, 345, 0, 0},
+    {2015, 346, 0, 0},
+    {2015, 347, 0, 0},
+    {2015, 348, 0, 0},
+    {2015, 349, 0, 0},
+    {2015, 350, 0, 0},
+    {2015, 351, 0, 0},
+    {2015, 352, 0, 0},
+    {2014, 353, 0, 0},
+    {2014, 354, 0, 0},
+    {2014, 355, 0, 0},
+    {2014, 356, 0, 0},
+    {2014, 357, 0, 0},
+    {2014, 358, 0, 0},
+    {2014, 359, 0, 0},
+    {2014, 360, 0, 0},
+    {2014, 361, 0, 0},
+    {2014, 362, 0, 0},
+    {2014, 363, 0, 0},
+    {2014, 364, 0, 0},
+    {2014, 365, 0, 0},
+    {2014, 366, 0, 0},
+    {3001, 367, 0, 0},
+    {3001, 368, 0, 0},
+    {3001, 369, 0, 0},
+    {2012, 370, 0, 0},
+    {2012, 371, 0, 0},
+    {2012, 372, 0, 0},
+    {2049, 373, 0, 0},
+    {2049, 374, 0, 0},
+    {2049, 375, 0, 0},
+    {2035, 376, 0, 0},
+    {2014, 377, 0, 0},
+    {2014, 378, 0, 0},
+    {2014, 379, 0, 0},
+    {2014, 380, 0, 0},
+    {2018, 381, 0, 0},
+    {2011, 382, 0, 0},
+    {2035, 383, 0, 0},
+    {2035, 384, 0, 0},
+    {3001, 385, 0, 0},
+    {3001, 386, 0, 0},
+    {3001, 387, 0, 0},
+    {3001, 388, 0, 0},
+    {3001, 389, 0, 0},
+    {2012, 390, 0, 0},
+    {2012, 391, 0, 0},
+    {2013, 392, 0, 0},
+    {2049, 393, 0, 0},
+    {2048, 394, 0, 0},
+    {8, 395, 0, 0},
+    {2014, 396, 0, 0},
+    {2014, 397, 0, 0},
+    {2014, 398, 0, 0},
+    {2014, 399, 0, 0},
+    {2014, 400, 0, 0},
+    {2046, 401, 0, 0},
+    {2046, 402, 0, 0},
+    {58, 403, 0, 0},
+    {2035, 404, 0, 0},
+    {2035, 405, 0, 0},
+    {2035, 406, 0, 0},
+    {2035, 407, 0, 0},
+    {58, 408, 0, 0},
+    {58, 409, 0, 0},
+    {58, 410, 0, 0},
+    {9, 411, 0, 0},
+    {9, 412, 0, 0},
+    {9, 413, 0, 0},
+    {9, 414, 0, 0},
+    {3002, 415, 0, 0},
+    {3001, 416, 0, 0},
+    {2012, 417, 0, 0},
+    {2012, 418, 0, 0},
+    {2008, 419, 0, 0},
+    {2008, 420, 0, 0},
+    {2010, 421, 0, 0},
+    {58, 422, 0, 0},
+    {58, 423, 0, 0},
+    {58, 424, 0, 0},
+    {3001, 425, 0, 0},
+    {3001, 426, 0, 0},
+    {3001, 427, 0, 0},
+    {3001, 428, 0, 0},
+    {9, 429, 0, 0},
+    {9, 430, 0, 0},
+    {9, 431, 0, 0},
+    {3002, 432, 0, 0},
+    {3002, 433, 0, 0},
+    {3002, 434, 0, 0},
+    {3002, 435, 0, 0},
+    {9, 436, 0, 0},
+    {9, 437, 0, 0},
+    {9, 438, 0, 0},
+    {58, 439, 0, 0},
+    {58, 440, 0, 0},
+    {58, 441, 0, 0},
+    {2012, 442, 0, 0},
+    {2012, 443, 0, 0},
+    {2049, 444, 0, 0},
+    {9, 445, 0, 0},
+    {9, 446, 0, 0},
+    {9, 447, 0, 0},
+    {9, 448, 0, 0},
+    {9, 449, 0, 0},
+    {9, 450, 0, 0},
+    {9, 451, 0, 0},
+    {11, 452, 0, 0},
+    {11, 453, 0, 0},
+    {11, 454, 0, 0},
+    {11, 455, 0, 0},
+    {11, 456, 0, 0},
+    {11, 457, 0, 0},
+    {11, 458, 0, 0},
+    {11, 459, 0, 0},
+    {11, 460, 0, 0},
+    {11, 461, 0, 0},
+    {11, 462, 0, 0},
+    // Computer Station (E1M7)
+    {3, 0, 0, 0},
+    {2, 1, 0, 0},
+    {4, 2, 0, 0},
+    {1, 3, 0, 0},
+    {2028, 4, 0, 0},
+    {2028, 5, 0, 0},
+    {2028, 6, 0, 0},
+    {2028, 7, 0, 0},
+    {2028, 8, 0, 0},
+    {2028, 9, 0, 0},
+    {2028, 10, 0, 0},
+    {9, 11, 0, 0},
+    {9, 12, 0, 0},
+    {9, 13, 0, 0},
+    {9, 14, 0, 0},
+    {2012, 15, 0, 0},
+    {2049, 16, 0, 0},
+    {2048, 17, 0, 0},
+    {2002, 18, 0, 0},
+    {2048, 19, 0, 0},
+    {2026, 20, 0, 0},
+    {2013, 21, 0, 0},
+    {2025, 22, 0, 0},
+    {2028, 23, 0, 0},
+    {2028, 24, 0, 0},
+    {6, 25, 0, 0},
+    {5, 26, 0, 0},
+    {13, 27, 0, 0},
+    {9, 28, 0, 0},
+    {9, 29, 0, 0},
+    {9, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {2049, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {9, 37, 0, 0},
+    {9, 38, 0, 0},
+    {2048, 39, 0, 0},
+    {9, 40, 0, 0},
+    {2007, 41, 0, 0},
+    {2007, 42, 0, 0},
+    {2008, 43, 0, 0},
+    {9, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3002, 47, 0, 0},
+    {2008, 48, 0, 0},
+    {2008, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {9, 52, 0, 0},
+    {2005, 53, 0, 0},
+    {2028, 54, 0, 0},
+    {2028, 55, 0, 0},
+    {2028, 56, 0, 0},
+    {2028, 57, 0, 0},
+    {2028, 58, 0, 0},
+    {2028, 59, 0, 0},
+    {3001, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {3004, 62, 0, 0},
+    {3004, 63, 0, 0},
+    {9, 64, 0, 0},
+    {9, 65, 0, 0},
+    {9, 66, 0, 0},
+    {9, 67, 0, 0},
+    {9, 68, 0, 0},
+    {9, 69, 0, 0},
+    {2008, 70, 0, 0},
+    {2008, 71, 0, 0},
+    {2011, 72, 0, 0},
+    {2012, 73, 0, 0},
+    {3001, 74, 0, 0},
+    {9, 75, 0, 0},
+    {9, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3004, 78, 0, 0},
+    {9, 79, 0, 0},
+    {9, 80, 0, 0},
+    {3001, 81, 0, 0},
+    {3004, 82, 0, 0},
+    {3004, 83, 0, 0},
+    {3004, 84, 0, 0},
+    {3004, 85, 0, 0},
+    {3004, 86, 0, 0},
+    {2001, 87, 0, 0},
+    {3004, 88, 0, 0},
+    {3004, 89, 0, 0},
+    {3001, 90, 0, 0},
+    {3001, 91, 0, 0},
+    {3001, 92, 0, 0},
+    {3004, 93, 0, 0},
+    {3004, 94, 0, 0},
+    {3004, 95, 0, 0},
+    {3004, 96, 0, 0},
+    {3004, 97, 0, 0},
+    {3004, 98, 0, 0},
+    {3004, 99, 0, 0},
+    {9, 100, 0, 0},
+    {2011, 101, 0, 0},
+    {2011, 102, 0, 0},
+    {3004, 103, 0, 0},
+    {3004, 104, 0, 0},
+    {3004, 105, 0, 0},
+    {3004, 106, 0, 0},
+    {3004, 107, 0, 0},
+    {3004, 108, 0, 0},
+    {2046, 109, 0, 0},
+    {2012, 110, 0, 0},
+    {2012, 111, 0, 0},
+    {2035, 112, 0, 0},
+    {2035, 113, 0, 0},
+    {2035, 114, 0, 0},
+    {2035, 115, 0, 0},
+    {2035, 116, 0, 0},
+    {2035, 117, 0, 0},
+    {2035, 118, 0, 0},
+    {2035, 119, 0, 0},
+    {48, 120, 0, 0},
+    {48, 121, 0, 0},
+    {2001, 122, 0, 0},
+    {2008, 123, 0, 0},
+    {2008, 124, 0, 0},
+    {3004, 125, 0, 0},
+    {3004, 126, 0, 0},
+    {3004, 127, 0, 0},
+    {3004, 128, 0, 0},
+    {3001, 129, 0, 0},
+    {3001, 130, 0, 0},
+    {3001, 131, 0, 0},
+    {3001, 132, 0, 0},
+    {3001, 133, 0, 0},
+    {3001, 134, 0, 0},
+    {9, 135, 0, 0},
+    {9, 136, 0, 0},
+    {9, 137, 0, 0},
+    {2007, 138, 0, 0},
+    {2007, 139, 0, 0},
+    {2049, 140, 0, 0},
+    {2010, 141, 0, 0},
+    {2010, 142, 0, 0},
+    {2011, 143, 0, 0},
+    {2011, 144, 0, 0},
+    {3004, 145, 0, 0},
+    {3004, 146, 0, 0},
+    {9, 147, 0, 0},
+    {3004, 148, 0, 0},
+    {3004, 149, 0, 0},
+    {2011, 150, 0, 0},
+    {35, 151, 0, 0},
+    {2008, 152, 0, 0},
+    {3001, 153, 0, 0},
+    {3001, 154, 0, 0},
+    {3001, 155, 0, 0},
+    {9, 156, 0, 0},
+    {9, 157, 0, 0},
+    {9, 158, 0, 0},
+    {2011, 159, 0, 0},
+    {2007, 160, 0, 0},
+    {3001, 161, 0, 0},
+    {3001, 162, 0, 0},
+    {9, 163, 0, 0},
+    {9, 164, 0, 0},
+    {3004, 165, 0, 0},
+    {3004, 166, 0, 0},
+    {3004, 167, 0, 0},
+    {9, 168, 0, 0},
+    {3004, 169, 0, 0},
+    {3004, 170, 0, 0},
+    {3001, 171, 0, 0},
+    {3001, 172, 0, 0},
+    {3001, 173, 0, 0},
+    {2011, 174, 0, 0},
+    {2011, 175, 0, 0},
+    {3001, 176, 0, 0},
+    {3001, 177, 0, 0},
+    {3004, 178, 0, 0},
+    {3004, 179, 0, 0},
+    {3004, 180, 0, 0},
+    {3004, 181, 0, 0},
+    {3004, 182, 0, 0},
+    {2035, 183, 0, 0},
+    {2035, 184, 0, 0},
+    {2035, 185, 0, 0},
+    {2035, 186, 0, 0},
+    {2035, 187, 0, 0},
+    {2008, 188, 0, 0},
+    {2008, 189, 0, 0},
+    {3001, 190, 0, 0},
+    {3001, 191, 0, 0},
+    {3001, 192, 0, 0},
+    {2012, 193, 0, 0},
+    {2012, 194, 0, 0},
+    {2012, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {3001, 197, 0, 0},
+    {3001, 198, 0, 0},
+    {2012, 199, 0, 0},
+    {2012, 200, 0, 0},
+    {3002, 201, 0, 0},
+    {9, 202, 0, 0},
+    {3004, 203, 0, 0},
+    {3004, 204, 0, 0},
+    {3002, 205, 0, 0},
+    {3002, 206, 0, 0},
+    {2012, 207, 0, 0},
+    {9, 208, 0, 0},
+    {9, 209, 0, 0},
+    {9, 210, 0, 0},
+    {3004, 211, 0, 0},
+    {3004, 212, 0, 0},
+    {3004, 213, 0, 0},
+    {3002, 214, 0, 0},
+    {2048, 215, 0, 0},
+    {9, 216, 0, 0},
+    {9, 217, 0, 0},
+    {9, 218, 0, 0},
+    {3002, 219, 0, 0},
+    {2048, 220, 0, 0},
+    {2035, 221, 0, 0},
+    {2035, 222, 0, 0},
+    {2035, 223, 0, 0},
+    {2035, 224, 0, 0},
+    {2011, 225, 0, 0},
+    {3001, 226, 0, 0},
+    {2035, 227, 0, 0},
+    {2014, 228, 0, 0},
+    {2014, 229, 0, 0},
+    {2014, 230, 0, 0},
+    {2015, 231, 0, 0},
+    {2015, 232, 0, 0},
+    {2015, 233, 0, 0},
+    {2015, 234, 0, 0},
+    {2015, 235, 0, 0},
+    {2015, 236, 0, 0},
+    {2015, 237, 0, 0},
+    {2015, 238, 0, 0},
+    {2015, 239, 0, 0},
+    {2015, 240, 0, 0},
+    {2015, 241, 0, 0},
+    {2015, 242, 0, 0},
+    {2014, 243, 0, 0},
+    {2014, 244, 0, 0},
+    {2015, 245, 0, 0},
+    {2015, 246, 0, 0},
+    {2015, 247, 0, 0},
+    {2015, 248, 0, 0},
+    {2015, 249, 0, 0},
+    {2015, 250, 0, 0},
+    {2015, 251, 0, 0},
+    {2015, 252, 0, 0},
+    {2015, 253, 0, 0},
+    {2015, 254, 0, 0},
+    {2015, 255, 0, 0},
+    {2015, 256, 0, 0},
+    {2015, 257, 0, 0},
+    {2014, 258, 0, 0},
+    {2014, 259, 0, 0},
+    {2014, 260, 0, 0},
+    {2014, 261, 0, 0},
+    {2014, 262, 0, 0},
+    {2015, 263, 0, 0},
+    {2015, 264, 0, 0},
+    {2014, 265, 0, 0},
+    {2014, 266, 0, 0},
+    {2014, 267, 0, 0},
+    {2014, 268, 0, 0},
+    {2014, 269, 0, 0},
+    {2014, 270, 0, 0},
+    {2014, 271, 0, 0},
+    {2014, 272, 0, 0},
+    {2014, 273, 0, 0},
+    {2015, 274, 0, 0},
+    {2015, 275, 0, 0},
+    {2015, 276, 0, 0},
+    {2015, 277, 0, 0},
+    {2015, 278, 0, 0},
+    {2015, 279, 0, 0},
+    {2015, 280, 0, 0},
+    {2014, 281, 0, 0},
+    {2014, 282, 0, 0},
+    {2015, 283, 0, 0},
+    {2015, 284, 0, 0},
+    {2015, 285, 0, 0},
+    {2014, 286, 0, 0},
+    {2014, 287, 0, 0},
+    {2014, 288, 0, 0},
+    {2014, 289, 0, 0},
+    {2014, 290, 0, 0},
+    {2014, 291, 0, 0},
+    {2014, 292, 0, 0},
+    {2014, 293, 0, 0},
+    {2014, 294, 0, 0},
+    {2014, 295, 0, 0},
+    {2014, 296, 0, 0},
+    {2014, 297, 0, 0},
+    {2015, 298, 0, 0},
+    {2015, 299, 0, 0},
+    {2015, 300, 0, 0},
+    {2015, 301, 0, 0},
+    {2015, 302, 0, 0},
+    {2015, 303, 0, 0},
+    {2015, 304, 0, 0},
+    {2015, 305, 0, 0},
+    {2015, 306, 0, 0},
+    {2015, 307, 0, 0},
+    {2015, 308, 0, 0},
+    {2003, 309, 0, 0},
+    {2018, 310, 0, 0},
+    {2018, 311, 0, 0},
+    {2019, 312, 0, 0},
+    {2046, 313, 0, 0},
+    {8, 314, 0, 0},
+    {2035, 315, 0, 0},
+    {2035, 316, 0, 0},
+    {9, 317, 0, 0},
+    {9, 318, 0, 0},
+    {58, 319, 0, 0},
+    {3001, 320, 0, 0},
+    {2008, 321, 0, 0},
+    {2008, 322, 0, 0},
+    {9, 323, 0, 0},
+    {9, 324, 0, 0},
+    {9, 325, 0, 0},
+    {9, 326, 0, 0},
+    {9, 327, 0, 0},
+    {9, 328, 0, 0},
+    {9, 329, 0, 0},
+    {9, 330, 0, 0},
+    {9, 331, 0, 0},
+    {9, 332, 0, 0},
+    {9, 333, 0, 0},
+    {9, 334, 0, 0},
+    {9, 335, 0, 0},
+    {9, 336, 0, 0},
+    {2024, 337, 0, 0},
+    {2012, 338, 0, 0},
+    {2012, 339, 0, 0},
+    {2012, 340, 0, 0},
+    {2012, 341, 0, 0},
+    {2012, 342, 0, 0},
+    {2012, 343, 0, 0},
+    {2012, 344, 0, 0},
+    {2019, 345, 0, 0},
+    {2028, 346, 0, 0},
+    {2028, 347, 0, 0},
+    {11, 348, 0, 0},
+    {11, 349, 0, 0},
+    {11, 350, 0, 0},
+    {11, 351, 0, 0},
+    {11, 352, 0, 0},
+    {11, 353, 0, 0},
+    {11, 354, 0, 0},
+    {11, 355, 0, 0},
+    {11, 356, 0, 0},
+    {11, 357, 0, 0},
+    // Phobos Anomaly (E1M8)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {2011, 4, 0, 0},
+    {2011, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3002, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {3002, 13, 0, 0},
+    {3002, 14, 0, 0},
+    {2013, 15, 0, 0},
+    {2011, 16, 0, 0},
+    {2011, 17, 0, 0},
+    {2011, 18, 0, 0},
+    {2011, 19, 0, 0},
+    {2011, 20, 0, 0},
+    {2011, 21, 0, 0},
+    {2011, 22, 0, 0},
+    {2011, 23, 0, 0},
+    {2035, 24, 0, 0},
+    {2035, 25, 0, 0},
+    {2035, 26, 0, 0},
+    {2035, 27, 0, 0},
+    {2035, 28, 0, 0},
+    {2035, 29, 0, 0},
+    {2035, 30, 0, 0},
+    {2035, 31, 0, 0},
+    {2035, 32, 0, 0},
+    {2035, 33, 0, 0},
+    {2035, 34, 0, 0},
+    {2035, 35, 0, 0},
+    {2035, 36, 0, 0},
+    {2035, 37, 0, 0},
+    {2035, 38, 0, 0},
+    {2035, 39, 0, 0},
+    {2035, 40, 0, 0},
+    {2035, 41, 0, 0},
+    {2035, 42, 0, 0},
+    {2035, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3002, 46, 0, 0},
+    {3002, 47, 0, 0},
+    {3002, 48, 0, 0},
+    {2001, 49, 0, 0},
+    {2049, 50, 0, 0},
+    {2049, 51, 0, 0},
+    {2001, 52, 0, 0},
+    {2018, 53, 0, 0},
+    {2012, 54, 0, 0},
+    {2011, 55, 0, 0},
+    {46, 56, 0, 0},
+    {46, 57, 0, 0},
+    {3003, 58, 0, 0},
+    {3003, 59, 0, 0},
+    {2049, 60, 0, 0},
+    {2048, 61, 0, 0},
+    {2048, 62, 0, 0},
+    {2048, 63, 0, 0},
+    {2048, 64, 0, 0},
+    {2002, 65, 0, 0},
+    {2049, 66, 0, 0},
+    {2012, 67, 0, 0},
+    {2048, 68, 0, 0},
+    {2012, 69, 0, 0},
+    {2024, 70, 0, 0},
+    {2035, 71, 0, 0},
+    {2035, 72, 0, 0},
+    {2035, 73, 0, 0},
+    {2035, 74, 0, 0},
+    {2035, 75, 0, 0},
+    {2035, 76, 0, 0},
+    {58, 77, 0, 0},
+    {58, 78, 0, 0},
+    {58, 79, 0, 0},
+    {58, 80, 0, 0},
+    {58, 81, 0, 0},
+    {58, 82, 0, 0},
+    {58, 83, 0, 0},
+    {58, 84, 0, 0},
+    {58, 85, 0, 0},
+    {58, 86, 0, 0},
+    {2048, 87, 0, 0},
+    {46, 88, 0, 0},
+    {46, 89, 0, 0},
+    {46, 90, 0, 0},
+    {46, 91, 0, 0},
+    {2035, 92, 0, 0},
+    {2035, 93, 0, 0},
+    {2026, 94, 0, 0},
+    {2048, 95, 0, 0},
+    {11, 96, 0, 0},
+    {11, 97, 0, 0},
+    {11, 98, 0, 0},
+    {11, 99, 0, 0},
+    {11, 100, 0, 0},
+    {11, 101, 0, 0},
+    {11, 102, 0, 0},
+    {11, 103, 0, 0},
+    {11, 104, 0, 0},
+    {14, 105, 0, 0},
+    {3002, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {3001, 109, 0, 0},
+    {3001, 110, 0, 0},
+    {9, 111, 0, 0},
+    {9, 112, 0, 0},
+    {2048, 113, 0, 0},
+    {2048, 114, 0, 0},
+    {2048, 115, 0, 0},
+    {2048, 116, 0, 0},
+    {2048, 117, 0, 0},
+    {3002, 118, 0, 0},
+    {3002, 119, 0, 0},
+    {3002, 120, 0, 0},
+    {3001, 121, 0, 0},
+    {3001, 122, 0, 0},
+    {3001, 123, 0, 0},
+    {9, 124, 0, 0},
+    {9, 125, 0, 0},
+    // Military Base (E1M9)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3001, 7, 0, 0},
+    {3001, 8, 0, 0},
+    {3001, 9, 0, 0},
+    {3001, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {6, 13, 0, 0},
+    {9, 14, 0, 0},
+    {9, 15, 0, 0},
+    {3001, 16, 0, 0},
+    {3001, 17, 0, 0},
+    {3002, 18, 0, 0},
+    {3002, 19, 0, 0},
+    {13, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {9, 25, 0, 0},
+    {9, 26, 0, 0},
+    {9, 27, 0, 0},
+    {9, 28, 0, 0},
+    {9, 29, 0, 0},
+    {2011, 30, 0, 0},
+    {2011, 31, 0, 0},
+    {2008, 32, 0, 0},
+    {2007, 33, 0, 0},
+    {2007, 34, 0, 0},
+    {2035, 35, 0, 0},
+    {2035, 36, 0, 0},
+    {3002, 37, 0, 0},
+    {3002, 38, 0, 0},
+    {3002, 39, 0, 0},
+    {3002, 40, 0, 0},
+    {3002, 41, 0, 0},
+    {3002, 42, 0, 0},
+    {3002, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {2049, 45, 0, 0},
+    {2048, 46, 0, 0},
+    {2012, 47, 0, 0},
+    {2028, 48, 0, 0},
+    {2028, 49, 0, 0},
+    {35, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3001, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {9, 54, 0, 0},
+    {9, 55, 0, 0},
+    {9, 56, 0, 0},
+    {9, 57, 0, 0},
+    {9, 58, 0, 0},
+    {2035, 59, 0, 0},
+    {2035, 60, 0, 0},
+    {2035, 61, 0, 0},
+    {2035, 62, 0, 0},
+    {2035, 63, 0, 0},
+    {2035, 64, 0, 0},
+    {2035, 65, 0, 0},
+    {2035, 66, 0, 0},
+    {2035, 67, 0, 0},
+    {2035, 68, 0, 0},
+    {2035, 69, 0, 0},
+    {2035, 70, 0, 0},
+    {2014, 71, 0, 0},
+    {2014, 72, 0, 0},
+    {2014, 73, 0, 0},
+    {2014, 74, 0, 0},
+    {2014, 75, 0, 0},
+    {2014, 76, 0, 0},
+    {2015, 77, 0, 0},
+    {2015, 78, 0, 0},
+    {2015, 79, 0, 0},
+    {2015, 80, 0, 0},
+    {2015, 81, 0, 0},
+    {2015, 82, 0, 0},
+    {46, 83, 0, 0},
+    {46, 84, 0, 0},
+    {46, 85, 0, 0},
+    {46, 86, 0, 0},
+    {2002, 87, 0, 0},
+    {2048, 88, 0, 0},
+    {2048, 89, 0, 0},
+    {2048, 90, 0, 0},
+    {2048, 91, 0, 0},
+    {2011, 92, 0, 0},
+    {2011, 93, 0, 0},
+    {2035, 94, 0, 0},
+    {2015, 95, 0, 0},
+    {2015, 96, 0, 0},
+    {2015, 97, 0, 0},
+    {2015, 98, 0, 0},
+    {2015, 99, 0, 0},
+    {3004, 100, 0, 0},
+    {3004, 101, 0, 0},
+    {3004, 102, 0, 0},
+    {3004, 103, 0, 0},
+    {9, 104, 0, 0},
+    {9, 105, 0, 0},
+    {9, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {9, 109, 0, 0},
+    {9, 110, 0, 0},
+    {9, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {2012, 115, 0, 0},
+    {2024, 116, 0, 0},
+    {11, 117, 0, 0},
+    {2015, 118, 0, 0},
+    {2015, 119, 0, 0},
+    {2015, 120, 0, 0},
+    {2015, 121, 0, 0},
+    {2014, 122, 0, 0},
+    {2014, 123, 0, 0},
+    {2014, 124, 0, 0},
+    {2014, 125, 0, 0},
+    {48, 126, 0, 0},
+    {48, 127, 0, 0},
+    {2035, 128, 0, 0},
+    {2035, 129, 0, 0},
+    {2035, 130, 0, 0},
+    {2015, 131, 0, 0},
+    {2015, 132, 0, 0},
+    {2015, 133, 0, 0},
+    {2015, 134, 0, 0},
+    {2015, 135, 0, 0},
+    {2015, 136, 0, 0},
+    {2015, 137, 0, 0},
+    {2015, 138, 0, 0},
+    {2018, 139, 0, 0},
+    {3001, 140, 0, 0},
+    {3004, 141, 0, 0},
+    {9, 142, 0, 0},
+    {9, 143, 0, 0},
+    {9, 144, 0, 0},
+    {58, 145, 0, 0},
+    {58, 146, 0, 0},
+    {2035, 147, 0, 0},
+    {2035, 148, 0, 0},
+    {34, 149, 0, 0},
+    {34, 150, 0, 0},
+    {34, 151, 0, 0},
+    {34, 152, 0, 0},
+    {34, 153, 0, 0},
+    {34, 154, 0, 0},
+    {34, 155, 0, 0},
+    {14, 156, 0, 0},
+    {3001, 157, 0, 0},
+    {3001, 158, 0, 0},
+    {3001, 159, 0, 0},
+    {3001, 160, 0, 0},
+    {3001, 161, 0, 0},
+    {3002, 162, 0, 0},
+    {3002, 163, 0, 0},
+    {3002, 164, 0, 0},
+    {3002, 165, 0, 0},
+    {3002, 166, 0, 0},
+    {58, 167, 0, 0},
+    {58, 168, 0, 0},
+    {58, 169, 0, 0},
+    {58, 170, 0, 0},
+    {58, 171, 0, 0},
+    {2003, 172, 0, 0},
+    {2046, 173, 0, 0},
+    {2012, 174, 0, 0},
+    {2012, 175, 0, 0},
+    {9, 176, 0, 0},
+    {9, 177, 0, 0},
+    {9, 178, 0, 0},
+    {9, 179, 0, 0},
+    {3001, 180, 0, 0},
+    {3001, 181, 0, 0},
+    {3001, 182, 0, 0},
+    {2012, 183, 0, 0},
+    {2028, 184, 0, 0},
+    {2028, 185, 0, 0},
+    {2007, 186, 0, 0},
+    {2007, 187, 0, 0},
+    {5, 188, 0, 0},
+    {2011, 189, 0, 0},
+    {2011, 190, 0, 0},
+    {2028, 191, 0, 0},
+    {3001, 192, 0, 0},
+    {3001, 193, 0, 0},
+    {3001, 194, 0, 0},
+    {3001, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {3001, 197, 0, 0},
+    {58, 198, 0, 0},
+    {58, 199, 0, 0},
+    {58, 200, 0, 0},
+    {58, 201, 0, 0},
+    {3001, 202, 0, 0},
+    {3001, 203, 0, 0},
+    {9, 204, 0, 0},
+    {9, 205, 0, 0},
+    {3001, 206, 0, 0},
+    {3001, 207, 0, 0},
+    {58, 208, 0, 0},
+    {58, 209, 0, 0},
+    {58, 210, 0, 0},
+    {2014, 211, 0, 0},
+    {2014, 212, 0, 0},
+    {2014, 213, 0, 0},
+    {2014, 214, 0, 0},
+    {2014, 215, 0, 0},
+    {2014, 216, 0, 0},
+    {2015, 217, 0, 0},
+    {2015, 218, 0, 0},
+    {2015, 219, 0, 0},
+    {2015, 220, 0, 0},
+    {2012, 221, 0, 0},
+    {8, 222, 0, 0},
+    {2001, 223, 0, 0},
+    {2049, 224, 0, 0},
+    {2005, 225, 0, 0},
+    {2046, 226, 0, 0},
+    {2048, 227, 0, 0},
+    {11, 228, 0, 0},
+    {11, 229, 0, 0},
+    {11, 230, 0, 0},
+    {11, 231, 0, 0},
+    {11, 232, 0, 0},
+    {11, 233, 0, 0},
+    {11, 234, 0, 0},
+    {11, 235, 0, 0},
+    {11, 236, 0, 0},
+    // Deimos Anomaly (E2M1)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3004, 4, 0, 0},
+    {3004, 5, 0, 0},
+    {3004, 6, 0, 0},
+    {3004, 7, 0, 0},
+    {3004, 8, 0, 0},
+    {3001, 9, 0, 0},
+    {3001, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3004, 15, 0, 0},
+    {9, 16, 0, 0},
+    {3001, 17, 0, 0},
+    {3001, 18, 0, 0},
+    {9, 19, 0, 0},
+    {9, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3004, 22, 0, 0},
+    {3004, 23, 0, 0},
+    {3004, 24, 0, 0},
+    {9, 25, 0, 0},
+    {9, 26, 0, 0},
+    {3002, 27, 0, 0},
+    {3002, 28, 0, 0},
+    {3002, 29, 0, 0},
+    {2014, 30, 0, 0},
+    {2014, 31, 0, 0},
+    {2014, 32, 0, 0},
+    {2014, 33, 0, 0},
+    {2015, 34, 0, 0},
+    {2015, 35, 0, 0},
+    {2015, 36, 0, 0},
+    {2015, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2014, 39, 0, 0},
+    {2015, 40, 0, 0},
+    {2014, 41, 0, 0},
+    {2015, 42, 0, 0},
+    {2014, 43, 0, 0},
+    {2004, 44, 0, 0},
+    {2047, 45, 0, 0},
+    {9, 46, 0, 0},
+    {9, 47, 0, 0},
+    {9, 48, 0, 0},
+    {9, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {5, 51, 0, 0},
+    {14, 52, 0, 0},
+    {14, 53, 0, 0},
+    {2001, 54, 0, 0},
+    {14, 55, 0, 0},
+    {14, 56, 0, 0},
+    {2018, 57, 0, 0},
+    {2049, 58, 0, 0},
+    {3002, 59, 0, 0},
+    {3002, 60, 0, 0},
+    {3002, 61, 0, 0},
+    {3002, 62, 0, 0},
+    {3002, 63, 0, 0},
+    {2012, 64, 0, 0},
+    {14, 65, 0, 0},
+    {2012, 66, 0, 0},
+    {2015, 67, 0, 0},
+    {14, 68, 0, 0},
+    {14, 69, 0, 0},
+    {14, 70, 0, 0},
+    {14, 71, 0, 0},
+    {14, 72, 0, 0},
+    {3001, 73, 0, 0},
+    {14, 74, 0, 0},
+    {14, 75, 0, 0},
+    {14, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3002, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3005, 81, 0, 0},
+    {2007, 82, 0, 0},
+    {13, 83, 0, 0},
+    {2026, 84, 0, 0},
+    {2011, 85, 0, 0},
+    {2019, 86, 0, 0},
+    {2011, 87, 0, 0},
+    {9, 88, 0, 0},
+    {2012, 89, 0, 0},
+    {2048, 90, 0, 0},
+    {2008, 91, 0, 0},
+    {2008, 92, 0, 0},
+    {2008, 93, 0, 0},
+    {2011, 94, 0, 0},
+    {2011, 95, 0, 0},
+    {2012, 96, 0, 0},
+    {2012, 97, 0, 0},
+    {2012, 98, 0, 0},
+    {2001, 99, 0, 0},
+    {3004, 100, 0, 0},
+    {3004, 101, 0, 0},
+    {3004, 102, 0, 0},
+    {3006, 103, 0, 0},
+    {3005, 104, 0, 0},
+    {3002, 105, 0, 0},
+    {3002, 106, 0, 0},
+    {3004, 107, 0, 0},
+    {3004, 108, 0, 0},
+    {34, 109, 0, 0},
+    {34, 110, 0, 0},
+    {34, 111, 0, 0},
+    {34, 112, 0, 0},
+    {34, 113, 0, 0},
+    {34, 114, 0, 0},
+    {34, 115, 0, 0},
+    {2011, 116, 0, 0},
+    {2012, 117, 0, 0},
+    {2012, 118, 0, 0},
+    {3004, 119, 0, 0},
+    {2007, 120, 0, 0},
+    {11, 121, 0, 0},
+    {11, 122, 0, 0},
+    {11, 123, 0, 0},
+    {11, 124, 0, 0},
+    {3005, 125, 0, 0},
+    {58, 126, 0, 0},
+    // Containment Area (E2M2)
+    {2012, 0, 0, 0},
+    {2014, 1, 0, 0},
+    {1, 2, 0, 0},
+    {2, 3, 0, 0},
+    {3, 4, 0, 0},
+    {4, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {2002, 8, 0, 0},
+    {2018, 9, 0, 0},
+    {2007, 10, 0, 0},
+    {2007, 11, 0, 0},
+    {2007, 12, 0, 0},
+    {2007, 13, 0, 0},
+    {2014, 14, 0, 0},
+    {2014, 15, 0, 0},
+    {2015, 16, 0, 0},
+    {2015, 17, 0, 0},
+    {2014, 18, 0, 0},
+    {2007, 19, 0, 0},
+    {2018, 20, 0, 0},
+    {2015, 21, 0, 0},
+    {2014, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3001, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {3001, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {2007, 34, 0, 0},
+    {2008, 35, 0, 0},
+    {2007, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3001, 38, 0, 0},
+    {3001, 39, 0, 0},
+    {3001, 40, 0, 0},
+    {3001, 41, 0, 0},
+    {3001, 42, 0, 0},
+    {3001, 43, 0, 0},
+    {3001, 44, 0, 0},
+    {3001, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3001, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {2028, 54, 0, 0},
+    {2028, 55, 0, 0},
+    {2028, 56, 0, 0},
+    {2028, 57, 0, 0},
+    {2028, 58, 0, 0},
+    {2028, 59, 0, 0},
+    {2028, 60, 0, 0},
+    {2028, 61, 0, 0},
+    {2028, 62, 0, 0},
+    {2028, 63, 0, 0},
+    {2028, 64, 0, 0},
+    {2028, 65, 0, 0},
+    {8, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {3001, 68, 0, 0},
+    {3002, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {2008, 71, 0, 0},
+    {2014, 72, 0, 0},
+    {2015, 73, 0, 0},
+    {2007, 74, 0, 0},
+    {2008, 75, 0, 0},
+    {2008, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {2013, 80, 0, 0},
+    {2005, 81, 0, 0},
+    {3001, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {3002, 85, 0, 0},
+    {2008, 86, 0, 0},
+    {2012, 87, 0, 0},
+    {2015, 88, 0, 0},
+    {2014, 89, 0, 0},
+    {3001, 90, 0, 0},
+    {3001, 91, 0, 0},
+    {3001, 92, 0, 0},
+    {3002, 93, 0, 0},
+    {3001, 94, 0, 0},
+    {3001, 95, 0, 0},
+    {3001, 96, 0, 0},
+    {2014, 97, 0, 0},
+    {2015, 98, 0, 0},
+    {2014, 99, 0, 0},
+    {2018, 100, 0, 0},
+    {2012, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3001, 105, 0, 0},
+    {3001, 106, 0, 0},
+    {3002, 107, 0, 0},
+    {2007, 108, 0, 0},
+    {2026, 109, 0, 0},
+    {2012, 110, 0, 0},
+    {2046, 111, 0, 0},
+    {2012, 112, 0, 0},
+    {2014, 113, 0, 0},
+    {2008, 114, 0, 0},
+    {2007, 115, 0, 0},
+    {2011, 116, 0, 0},
+    {2014, 117, 0, 0},
+    {2011, 118, 0, 0},
+    {3001, 119, 0, 0},
+    {3001, 120, 0, 0},
+    {2008, 121, 0, 0},
+    {2007, 122, 0, 0},
+    {17, 123, 0, 0},
+    {2010, 124, 0, 0},
+    {2019, 125, 0, 0},
+    {2011, 126, 0, 0},
+    {2004, 127, 0, 0},
+    {3001, 128, 0, 0},
+    {3001, 129, 0, 0},
+    {3001, 130, 0, 0},
+    {3001, 131, 0, 0},
+    {3001, 132, 0, 0},
+    {3002, 133, 0, 0},
+    {3002, 134, 0, 0},
+    {3006, 135, 0, 0},
+    {3006, 136, 0, 0},
+    {2048, 137, 0, 0},
+    {2003, 138, 0, 0},
+    {2046, 139, 0, 0},
+    {2014, 140, 0, 0},
+    {2014, 141, 0, 0},
+    {2015, 142, 0, 0},
+    {5, 143, 0, 0},
+    {6, 144, 0, 0},
+    {2015, 145, 0, 0},
+    {2010, 146, 0, 0},
+    {2011, 147, 0, 0},
+    {2048, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {2014, 150, 0, 0},
+    {2048, 151, 0, 0},
+    {2011, 152, 0, 0},
+    {13, 153, 0, 0},
+    {3001, 154, 0, 0},
+    {3002, 155, 0, 0},
+    {3001, 156, 0, 0},
+    {3001, 157, 0, 0},
+    {3001, 158, 0, 0},
+    {3001, 159, 0, 0},
+    {2001, 160, 0, 0},
+    {2001, 161, 0, 0},
+    {2049, 162, 0, 0},
+    {2049, 163, 0, 0},
+    {2049, 164, 0, 0},
+    {2018, 165, 0, 0},
+    {2035, 166, 0, 0},
+    {2035, 167, 0, 0},
+    {2007, 168, 0, 0},
+    {2012, 169, 0, 0},
+    {2049, 170, 0, 0},
+    {2025, 171, 0, 0},
+    {2025, 172, 0, 0},
+    {2025, 173, 0, 0},
+    {2035, 174, 0, 0},
+    {2008, 175, 0, 0},
+    {2014, 176, 0, 0},
+    {2014, 177, 0, 0},
+    {2014, 178, 0, 0},
+    {3002, 179, 0, 0},
+    {3001, 180, 0, 0},
+    {3001, 181, 0, 0},
+    {2048, 182, 0, 0},
+    {2008, 183, 0, 0},
+    {2011, 184, 0, 0},
+    {2011, 185, 0, 0},
+    {2011, 186, 0, 0},
+    {2011, 187, 0, 0},
+    {2011, 188, 0, 0},
+    {2011, 189, 0, 0},
+    {2011, 190, 0, 0},
+    {2011, 191, 0, 0},
+    {2012, 192, 0, 0},
+    {2011, 193, 0, 0},
+    {2011, 194, 0, 0},
+    {2011, 195, 0, 0},
+    {2014, 196, 0, 0},
+    {2014, 197, 0, 0},
+    {2014, 198, 0, 0},
+    {58, 199, 0, 0},
+    {2007, 200, 0, 0},
+    {2007, 201, 0, 0},
+    {58, 202, 0, 0},
+    {3002, 203, 0, 0},
+    {2007, 204, 0, 0},
+    {2008, 205, 0, 0},
+    {3002, 206, 0, 0},
+    {3001, 207, 0, 0},
+    {3001, 208, 0, 0},
+    {3001, 209, 0, 0},
+    {3001, 210, 0, 0},
+    {3001, 211, 0, 0},
+    {2008, 212, 0, 0},
+    {2007, 213, 0, 0},
+    {2049, 214, 0, 0},
+    {2011, 215, 0, 0},
+    {2011, 216, 0, 0},
+    {2011, 217, 0, 0},
+    {3001, 218, 0, 0},
+    {3001, 219, 0, 0},
+    {2012, 220, 0, 0},
+    {2011, 221, 0, 0},
+    {2011, 222, 0, 0},
+    {2012, 223, 0, 0},
+    {2011, 224, 0, 0},
+    {2011, 225, 0, 0},
+    {2011, 226, 0, 0},
+    {2011, 227, 0, 0},
+    {2011, 228, 0, 0},
+    {2012, 229, 0, 0},
+    {2011, 230, 0, 0},
+    {2011, 231, 0, 0},
+    {3002, 232, 0, 0},
+    {3001, 233, 0, 0},
+    {3001, 234, 0, 0},
+    {3002, 235, 0, 0},
+    {3006, 236, 0, 0},
+    {3001, 237, 0, 0},
+    {3006, 238, 0, 0},
+    {3006, 239, 0, 0},
+    {3006, 240, 0, 0},
+    {3006, 241, 0, 0},
+    {3006, 242, 0, 0},
+    {3006, 243, 0, 0},
+    {3006, 244, 0, 0},
+    {3006, 245, 0, 0},
+    {3006, 246, 0, 0},
+    {3002, 247, 0, 0},
+    {3002, 248, 0, 0},
+    {2035, 249, 0, 0},
+    {2023, 250, 0, 0},
+    {62, 251, 0, 0},
+    {62, 252, 0, 0},
+    {62, 253, 0, 0},
+    {62, 254, 0, 0},
+    {15, 255, 0, 0},
+    {15, 256, 0, 0},
+    {15, 257, 0, 0},
+    {15, 258, 0, 0},
+    {12, 259, 0, 0},
+    {12, 260, 0, 0},
+    {12, 261, 0, 0},
+    {10, 262, 0, 0},
+    {10, 263, 0, 0},
+    {35, 264, 0, 0},
+    {35, 265, 0, 0},
+    {35, 266, 0, 0},
+    {11, 267, 0, 0},
+    {11, 268, 0, 0},
+    {11, 269, 0, 0},
+    {11, 270, 0, 0},
+    {11, 271, 0, 0},
+    {11, 272, 0, 0},
+    {2014, 273, 0, 0},
+    {2011, 274, 0, 0},
+    {2011, 275, 0, 0},
+    {2014, 276, 0, 0},
+    {2014, 277, 0, 0},
+    {2014, 278, 0, 0},
+    {2014, 279, 0, 0},
+    {2014, 280, 0, 0},
+    {2014, 281, 0, 0},
+    {2014, 282, 0, 0},
+    {2014, 283, 0, 0},
+    {2014, 284, 0, 0},
+    {2014, 285, 0, 0},
+    {2014, 286, 0, 0},
+    {2014, 287, 0, 0},
+    {2014, 288, 0, 0},
+    {2014, 289, 0, 0},
+    {11, 290, 0, 0},
+    {8, 291, 0, 0},
+    {2008, 292, 0, 0},
+    {2008, 293, 0, 0},
+    {3001, 294, 0, 0},
+    {3001, 295, 0, 0},
+    {3001, 296, 0, 0},
+    {2014, 297, 0, 0},
+    {3002, 298, 0, 0},
+    {3002, 299, 0, 0},
+    {3001, 300, 0, 0},
+    {3001, 301, 0, 0},
+    {3002, 302, 0, 0},
+    {3001, 303, 0, 0},
+    {3001, 304, 0, 0},
+    {3001, 305, 0, 0},
+    {3001, 306, 0, 0},
+    {2008, 307, 0, 0},
+    {2008, 308, 0, 0},
+    {3001, 309, 0, 0},
+    {2004, 310, 0, 0},
+    // Refinery (E2M3)
+    {2, 0, 0, 0},
+    {3, 1, 0, 0},
+    {4, 2, 0, 0},
+    {1, 3, 0, 0},
+    {2048, 4, 0, 0},
+    {2008, 5, 0, 0},
+    {2035, 6, 0, 0},
+    {2035, 7, 0, 0},
+    {2035, 8, 0, 0},
+    {2035, 9, 0, 0},
+    {2035, 10, 0, 0},
+    {2014, 11, 0, 0},
+    {2004, 12, 0, 0},
+    {2025, 13, 0, 0},
+    {2010, 14, 0, 0},
+    {2012, 15, 0, 0},
+    {2015, 16, 0, 0},
+    {2014, 17, 0, 0},
+    {2007, 18, 0, 0},
+    {2049, 19, 0, 0},
+    {2008, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3002, 23, 0, 0},
+    {2012, 24, 0, 0},
+    {2007, 25, 0, 0},
+    {3002, 26, 0, 0},
+    {9, 27, 0, 0},
+    {3004, 28, 0, 0},
+    {3004, 29, 0, 0},
+    {3002, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {8, 37, 0, 0},
+    {2035, 38, 0, 0},
+    {2035, 39, 0, 0},
+    {2019, 40, 0, 0},
+    {2014, 41, 0, 0},
+    {2047, 42, 0, 0},
+    {3002, 43, 0, 0},
+    {3001, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {2007, 46, 0, 0},
+    {2012, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3002, 52, 0, 0},
+    {3002, 53, 0, 0},
+    {2047, 54, 0, 0},
+    {2007, 55, 0, 0},
+    {2008, 56, 0, 0},
+    {2018, 57, 0, 0},
+    {2015, 58, 0, 0},
+    {2015, 59, 0, 0},
+    {2014, 60, 0, 0},
+    {2014, 61, 0, 0},
+    {3001, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {3001, 64, 0, 0},
+    {3005, 65, 0, 0},
+    {2011, 66, 0, 0},
+    {2024, 67, 0, 0},
+    {2046, 68, 0, 0},
+    {2008, 69, 0, 0},
+    {2047, 70, 0, 0},
+    {3004, 71, 0, 0},
+    {3004, 72, 0, 0},
+    {3004, 73, 0, 0},
+    {3002, 74, 0, 0},
+    {3002, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3005, 81, 0, 0},
+    {3001, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {2011, 84, 0, 0},
+    {2049, 85, 0, 0},
+    {2015, 86, 0, 0},
+    {2013, 87, 0, 0},
+    {3004, 88, 0, 0},
+    {3001, 89, 0, 0},
+    {5, 90, 0, 0},
+    {2014, 91, 0, 0},
+    {2014, 92, 0, 0},
+    {3002, 93, 0, 0},
+    {2047, 94, 0, 0},
+    {3001, 95, 0, 0},
+    {3001, 96, 0, 0},
+    {3001, 97, 0, 0},
+    {3001, 98, 0, 0},
+    {3003, 99, 0, 0},
+    {3002, 100, 0, 0},
+    {3006, 101, 0, 0},
+    {3006, 102, 0, 0},
+    {3006, 103, 0, 0},
+    {3006, 104, 0, 0},
+    {3006, 105, 0, 0},
+    {3006, 106, 0, 0},
+    {3006, 107, 0, 0},
+    {3006, 108, 0, 0},
+    {2011, 109, 0, 0},
+    {2024, 110, 0, 0},
+    {2011, 111, 0, 0},
+    {2011, 112, 0, 0},
+    {2001, 113, 0, 0},
+    {3006, 114, 0, 0},
+    {3006, 115, 0, 0},
+    {3006, 116, 0, 0},
+    {3006, 117, 0, 0},
+    {3006, 118, 0, 0},
+    {3006, 119, 0, 0},
+    {2014, 120, 0, 0},
+    {2014, 121, 0, 0},
+    {2014, 122, 0, 0},
+    {2014, 123, 0, 0},
+    {3005, 124, 0, 0},
+    {3002, 125, 0, 0},
+    {3004, 126, 0, 0},
+    {3004, 127, 0, 0},
+    {3004, 128, 0, 0},
+    {3004, 129, 0, 0},
+    {3004, 130, 0, 0},
+    {3004, 131, 0, 0},
+    {3004, 132, 0, 0},
+    {3004, 133, 0, 0},
+    {2008, 134, 0, 0},
+    {2011, 135, 0, 0},
+    {2011, 136, 0, 0},
+    {2008, 137, 0, 0},
+    {2008, 138, 0, 0},
+    {2007, 139, 0, 0},
+    {2010, 140, 0, 0},
+    {2012, 141, 0, 0},
+    {2049, 142, 0, 0},
+    {2011, 143, 0, 0},
+    {2008, 144, 0, 0},
+    {2011, 145, 0, 0},
+    {2011, 146, 0, 0},
+    {3001, 147, 0, 0},
+    {3001, 148, 0, 0},
+    {3001, 149, 0, 0},
+    {3001, 150, 0, 0},
+    {2035, 151, 0, 0},
+    {2035, 152, 0, 0},
+    {2035, 153, 0, 0},
+    {3004, 154, 0, 0},
+    {3004, 155, 0, 0},
+    {3004, 156, 0, 0},
+    {3002, 157, 0, 0},
+    {3002, 158, 0, 0},
+    {3002, 159, 0, 0},
+    {3002, 160, 0, 0},
+    {3002, 161, 0, 0},
+    {3004, 162, 0, 0},
+    {60, 163, 0, 0},
+    {12, 164, 0, 0},
+    {24, 165, 0, 0},
+    {24, 166, 0, 0},
+    {24, 167, 0, 0},
+    {24, 168, 0, 0},
+    {24, 169, 0, 0},
+    {15, 170, 0, 0},
+    {15, 171, 0, 0},
+    {12, 172, 0, 0},
+    {12, 173, 0, 0},
+    {12, 174, 0, 0},
+    {12, 175, 0, 0},
+    {10, 176, 0, 0},
+    {10, 177, 0, 0},
+    {34, 178, 0, 0},
+    {34, 179, 0, 0},
+    {34, 180, 0, 0},
+    {34, 181, 0, 0},
+    {34, 182, 0, 0},
+    {34, 183, 0, 0},
+    {34, 184, 0, 0},
+    {34, 185, 0, 0},
+    {34, 186, 0, 0},
+    {35, 187, 0, 0},
+    {35, 188, 0, 0},
+    {2015, 189, 0, 0},
+    {2015, 190, 0, 0},
+    {2014, 191, 0, 0},
+    {2014, 192, 0, 0},
+    {31, 193, 0, 0},
+    {31, 194, 0, 0},
+    {31, 195, 0, 0},
+    {31, 196, 0, 0},
+    {31, 197, 0, 0},
+    {31, 198, 0, 0},
+    {32, 199, 0, 0},
+    {32, 200, 0, 0},
+    {32, 201, 0, 0},
+    {32, 202, 0, 0},
+    {31, 203, 0, 0},
+    {31, 204, 0, 0},
+    {2008, 205, 0, 0},
+    {2008, 206, 0, 0},
+    {2007, 207, 0, 0},
+    {2008, 208, 0, 0},
+    {2014, 209, 0, 0},
+    {2014, 210, 0, 0},
+    {2014, 211, 0, 0},
+    {2014, 212, 0, 0},
+    {2015, 213, 0, 0},
+    {2015, 214, 0, 0},
+    {2015, 215, 0, 0},
+    {2015, 216, 0, 0},
+    {11, 217, 0, 0},
+    {11, 218, 0, 0},
+    {11, 219, 0, 0},
+    {11, 220, 0, 0},
+    {2023, 221, 0, 0},
+    {2025, 222, 0, 0},
+    {2002, 223, 0, 0},
+    {58, 224, 0, 0},
+    {58, 225, 0, 0},
+    {3005, 226, 0, 0},
+    {3005, 227, 0, 0},
+    {3005, 228, 0, 0},
+    // Deimos Lab (E2M4)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3005, 5, 0, 0},
+    {2015, 6, 0, 0},
+    {2018, 7, 0, 0},
+    {2024, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3002, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {3002, 13, 0, 0},
+    {3002, 14, 0, 0},
+    {3002, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {2015, 17, 0, 0},
+    {2015, 18, 0, 0},
+    {2015, 19, 0, 0},
+    {2014, 20, 0, 0},
+    {2014, 21, 0, 0},
+    {2014, 22, 0, 0},
+    {2014, 23, 0, 0},
+    {2014, 24, 0, 0},
+    {2048, 25, 0, 0},
+    {2012, 26, 0, 0},
+    {2012, 27, 0, 0},
+    {9, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {2008, 31, 0, 0},
+    {2012, 32, 0, 0},
+    {2010, 33, 0, 0},
+    {2015, 34, 0, 0},
+    {2012, 35, 0, 0},
+    {2012, 36, 0, 0},
+    {2048, 37, 0, 0},
+    {2012, 38, 0, 0},
+    {2026, 39, 0, 0},
+    {2018, 40, 0, 0},
+    {2049, 41, 0, 0},
+    {33, 42, 0, 0},
+    {37, 43, 0, 0},
+    {3006, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3002, 46, 0, 0},
+    {3006, 47, 0, 0},
+    {3006, 48, 0, 0},
+    {3002, 49, 0, 0},
+    {3005, 50, 0, 0},
+    {2012, 51, 0, 0},
+    {2049, 52, 0, 0},
+    {2008, 53, 0, 0},
+    {2008, 54, 0, 0},
+    {2014, 55, 0, 0},
+    {2014, 56, 0, 0},
+    {2014, 57, 0, 0},
+    {2014, 58, 0, 0},
+    {2014, 59, 0, 0},
+    {3005, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {3001, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {3001, 64, 0, 0},
+    {3001, 65, 0, 0},
+    {2008, 66, 0, 0},
+    {2007, 67, 0, 0},
+    {2008, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3002, 71, 0, 0},
+    {3002, 72, 0, 0},
+    {2015, 73, 0, 0},
+    {5, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3001, 81, 0, 0},
+    {3002, 82, 0, 0},
+    {3005, 83, 0, 0},
+    {3005, 84, 0, 0},
+    {3005, 85, 0, 0},
+    {6, 86, 0, 0},
+    {14, 87, 0, 0},
+    {14, 88, 0, 0},
+    {3001, 89, 0, 0},
+    {14, 90, 0, 0},
+    {14, 91, 0, 0},
+    {3001, 92, 0, 0},
+    {3001, 93, 0, 0},
+    {3001, 94, 0, 0},
+    {3001, 95, 0, 0},
+    {3001, 96, 0, 0},
+    {3001, 97, 0, 0},
+    {3001, 98, 0, 0},
+    {3001, 99, 0, 0},
+    {3001, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {2007, 104, 0, 0},
+    {3002, 105, 0, 0},
+    {3002, 106, 0, 0},
+    {2013, 107, 0, 0},
+    {2048, 108, 0, 0},
+    {2001, 109, 0, 0},
+    {2049, 110, 0, 0},
+    {2012, 111, 0, 0},
+    {2015, 112, 0, 0},
+    {2015, 113, 0, 0},
+    {3005, 114, 0, 0},
+    {2014, 115, 0, 0},
+    {2014, 116, 0, 0},
+    {2014, 117, 0, 0},
+    {2014, 118, 0, 0},
+    {2014, 119, 0, 0},
+    {2014, 120, 0, 0},
+    {2014, 121, 0, 0},
+    {2014, 122, 0, 0},
+    {2014, 123, 0, 0},
+    {2014, 124, 0, 0},
+    {3001, 125, 0, 0},
+    {3003, 126, 0, 0},
+    {3003, 127, 0, 0},
+    {2014, 128, 0, 0},
+    {2019, 129, 0, 0},
+    {2004, 130, 0, 0},
+    {14, 131, 0, 0},
+    {2035, 132, 0, 0},
+    {2035, 133, 0, 0},
+    {2035, 134, 0, 0},
+    {2014, 135, 0, 0},
+    {2014, 136, 0, 0},
+    {3002, 137, 0, 0},
+    {3005, 138, 0, 0},
+    {3002, 139, 0, 0},
+    {3002, 140, 0, 0},
+    {2010, 141, 0, 0},
+    {2010, 142, 0, 0},
+    {2015, 143, 0, 0},
+    {2015, 144, 0, 0},
+    {2015, 145, 0, 0},
+    {2015, 146, 0, 0},
+    {2011, 147, 0, 0},
+    {2015, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {3006, 150, 0, 0},
+    {3006, 151, 0, 0},
+    {3006, 152, 0, 0},
+    {3006, 153, 0, 0},
+    {3006, 154, 0, 0},
+    {2008, 155, 0, 0},
+    {2011, 156, 0, 0},
+    {2046, 157, 0, 0},
+    {3001, 158, 0, 0},
+    {8, 159, 0, 0},
+    {3003, 160, 0, 0},
+    {3005, 161, 0, 0},
+    {3005, 162, 0, 0},
+    {2011, 163, 0, 0},
+    {2011, 164, 0, 0},
+    {2047, 165, 0, 0},
+    {2007, 166, 0, 0},
+    {2010, 167, 0, 0},
+    {2010, 168, 0, 0},
+    {2049, 169, 0, 0},
+    {3006, 170, 0, 0},
+    {3006, 171, 0, 0},
+    {3006, 172, 0, 0},
+    {2025, 173, 0, 0},
+    {2023, 174, 0, 0},
+    {2024, 175, 0, 0},
+    {3003, 176, 0, 0},
+    {3005, 177, 0, 0},
+    {9, 178, 0, 0},
+    {9, 179, 0, 0},
+    {9, 180, 0, 0},
+    {3004, 181, 0, 0},
+    {3004, 182, 0, 0},
+    {2015, 183, 0, 0},
+    {2015, 184, 0, 0},
+    {2015, 185, 0, 0},
+    {2018, 186, 0, 0},
+    {31, 187, 0, 0},
+    {31, 188, 0, 0},
+    {2002, 189, 0, 0},
+    {2049, 190, 0, 0},
+    {2012, 191, 0, 0},
+    {9, 192, 0, 0},
+    {9, 193, 0, 0},
+    {2007, 194, 0, 0},
+    {2008, 195, 0, 0},
+    {2008, 196, 0, 0},
+    {2008, 197, 0, 0},
+    {2008, 198, 0, 0},
+    {2012, 199, 0, 0},
+    {58, 200, 0, 0},
+    {58, 201, 0, 0},
+    {62, 202, 0, 0},
+    {62, 203, 0, 0},
+    {62, 204, 0, 0},
+    {62, 205, 0, 0},
+    {46, 206, 0, 0},
+    {46, 207, 0, 0},
+    {24, 208, 0, 0},
+    {12, 209, 0, 0},
+    {24, 210, 0, 0},
+    {24, 211, 0, 0},
+    {24, 212, 0, 0},
+    {24, 213, 0, 0},
+    {24, 214, 0, 0},
+    {24, 215, 0, 0},
+    {46, 216, 0, 0},
+    {46, 217, 0, 0},
+    {46, 218, 0, 0},
+    {46, 219, 0, 0},
+    {33, 220, 0, 0},
+    {33, 221, 0, 0},
+    {33, 222, 0, 0},
+    {33, 223, 0, 0},
+    {32, 224, 0, 0},
+    {32, 225, 0, 0},
+    {32, 226, 0, 0},
+    {32, 227, 0, 0},
+    {32, 228, 0, 0},
+    {32, 229, 0, 0},
+    {32, 230, 0, 0},
+    {32, 231, 0, 0},
+    {30, 232, 0, 0},
+    {30, 233, 0, 0},
+    {30, 234, 0, 0},
+    {30, 235, 0, 0},
+    {41, 236, 0, 0},
+    {41, 237, 0, 0},
+    {15, 238, 0, 0},
+    {15, 239, 0, 0},
+    {12, 240, 0, 0},
+    {2012, 241, 0, 0},
+    {2012, 242, 0, 0},
+    {3001, 243, 0, 0},
+    {2013, 244, 0, 0},
+    {2025, 245, 0, 0},
+    {11, 246, 0, 0},
+    {11, 247, 0, 0},
+    {11, 248, 0, 0},
+    {11, 249, 0, 0},
+    {11, 250, 0, 0},
+    {11, 251, 0, 0},
+    {11, 252, 0, 0},
+    {2012, 253, 0, 0},
+    {2003, 254, 0, 0},
+    {2012, 255, 0, 0},
+    {2012, 256, 0, 0},
+    {2012, 257, 0, 0},
+    {2012, 258, 0, 0},
+    {2012, 259, 0, 0},
+    {2012, 260, 0, 0},
+    {8, 261, 0, 0},
+    {8, 262, 0, 0},
+    {8, 263, 0, 0},
+    {2013, 264, 0, 0},
+    // Command Center (E2M5)
+    {3, 0, 0, 0},
+    {2, 1, 0, 0},
+    {1, 2, 0, 0},
+    {8, 3, 0, 0},
+    {3005, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {4, 6, 0, 0},
+    {3001, 7, 0, 0},
+    {3001, 8, 0, 0},
+    {3001, 9, 0, 0},
+    {3001, 10, 0, 0},
+    {3003, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3001, 15, 0, 0},
+    {9, 16, 0, 0},
+    {9, 17, 0, 0},
+    {9, 18, 0, 0},
+    {3001, 19, 0, 0},
+    {3001, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3001, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {9, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {9, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3002, 34, 0, 0},
+    {3006, 35, 0, 0},
+    {3006, 36, 0, 0},
+    {3006, 37, 0, 0},
+    {3006, 38, 0, 0},
+    {2049, 39, 0, 0},
+    {9, 40, 0, 0},
+    {9, 41, 0, 0},
+    {9, 42, 0, 0},
+    {2007, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3002, 46, 0, 0},
+    {3002, 47, 0, 0},
+    {3002, 48, 0, 0},
+    {3002, 49, 0, 0},
+    {3002, 50, 0, 0},
+    {3002, 51, 0, 0},
+    {3002, 52, 0, 0},
+    {2019, 53, 0, 0},
+    {3006, 54, 0, 0},
+    {3006, 55, 0, 0},
+    {3006, 56, 0, 0},
+    {2023, 57, 0, 0},
+    {2011, 58, 0, 0},
+    {2007, 59, 0, 0},
+    {56, 60, 0, 0},
+    {56, 61, 0, 0},
+    {3002, 62, 0, 0},
+    {3006, 63, 0, 0},
+    {3006, 64, 0, 0},
+    {3006, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3006, 67, 0, 0},
+    {3003, 68, 0, 0},
+    {2002, 69, 0, 0},
+    {2012, 70, 0, 0},
+    {3002, 71, 0, 0},
+    {9, 72, 0, 0},
+    {9, 73, 0, 0},
+    {9, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {2005, 79, 0, 0},
+    {2011, 80, 0, 0},
+    {29, 81, 0, 0},
+    {60, 82, 0, 0},
+    {27, 83, 0, 0},
+    {27, 84, 0, 0},
+    {27, 85, 0, 0},
+    {27, 86, 0, 0},
+    {27, 87, 0, 0},
+    {27, 88, 0, 0},
+    {28, 89, 0, 0},
+    {28, 90, 0, 0},
+    {24, 91, 0, 0},
+    {15, 92, 0, 0},
+    {15, 93, 0, 0},
+    {12, 94, 0, 0},
+    {24, 95, 0, 0},
+    {24, 96, 0, 0},
+    {24, 97, 0, 0},
+    {10, 98, 0, 0},
+    {24, 99, 0, 0},
+    {18, 100, 0, 0},
+    {19, 101, 0, 0},
+    {45, 102, 0, 0},
+    {45, 103, 0, 0},
+    {24, 104, 0, 0},
+    {24, 105, 0, 0},
+    {2015, 106, 0, 0},
+    {2015, 107, 0, 0},
+    {2011, 108, 0, 0},
+    {2004, 109, 0, 0},
+    {14, 110, 0, 0},
+    {14, 111, 0, 0},
+    {14, 112, 0, 0},
+    {14, 113, 0, 0},
+    {3005, 114, 0, 0},
+    {3005, 115, 0, 0},
+    {3003, 116, 0, 0},
+    {2049, 117, 0, 0},
+    {2012, 118, 0, 0},
+    {2048, 119, 0, 0},
+    {29, 120, 0, 0},
+    {49, 121, 0, 0},
+    {10, 122, 0, 0},
+    {24, 123, 0, 0},
+    {24, 124, 0, 0},
+    {24, 125, 0, 0},
+    {27, 126, 0, 0},
+    {9, 127, 0, 0},
+    {9, 128, 0, 0},
+    {9, 129, 0, 0},
+    {9, 130, 0, 0},
+    {9, 131, 0, 0},
+    {3002, 132, 0, 0},
+    {3002, 133, 0, 0},
+    {3002, 134, 0, 0},
+    {3002, 135, 0, 0},
+    {3002, 136, 0, 0},
+    {3002, 137, 0, 0},
+    {31, 138, 0, 0},
+    {30, 139, 0, 0},
+    {31, 140, 0, 0},
+    {31, 141, 0, 0},
+    {30, 142, 0, 0},
+    {31, 143, 0, 0},
+    {36, 144, 0, 0},
+    {35, 145, 0, 0},
+    {35, 146, 0, 0},
+    {35, 147, 0, 0},
+    {35, 148, 0, 0},
+    {3001, 149, 0, 0},
+    {3001, 150, 0, 0},
+    {3001, 151, 0, 0},
+    {2007, 152, 0, 0},
+    {2049, 153, 0, 0},
+    {2012, 154, 0, 0},
+    {2049, 155, 0, 0},
+    {2007, 156, 0, 0},
+    {2012, 157, 0, 0},
+    {2008, 158, 0, 0},
+    {2015, 159, 0, 0},
+    {2015, 160, 0, 0},
+    {2015, 161, 0, 0},
+    {2015, 162, 0, 0},
+    {2015, 163, 0, 0},
+    {2015, 164, 0, 0},
+    {2015, 165, 0, 0},
+    {2015, 166, 0, 0},
+    {2012, 167, 0, 0},
+    {2012, 168, 0, 0},
+    {2015, 169, 0, 0},
+    {2048, 170, 0, 0},
+    {2007, 171, 0, 0},
+    {2008, 172, 0, 0},
+    {2047, 173, 0, 0},
+    {2008, 174, 0, 0},
+    {2008, 175, 0, 0},
+    {2026, 176, 0, 0},
+    {3006, 177, 0, 0},
+    {3006, 178, 0, 0},
+    {3006, 179, 0, 0},
+    {3006, 180, 0, 0},
+    {3002, 181, 0, 0},
+    {2011, 182, 0, 0},
+    {46, 183, 0, 0},
+    {60, 184, 0, 0},
+    {24, 185, 0, 0},
+    {2015, 186, 0, 0},
+    {2015, 187, 0, 0},
+    {3002, 188, 0, 0},
+    {3002, 189, 0, 0},
+    {3002, 190, 0, 0},
+    {3002, 191, 0, 0},
+    {2049, 192, 0, 0},
+    {9, 193, 0, 0},
+    {9, 194, 0, 0},
+    {3005, 195, 0, 0},
+    {3005, 196, 0, 0},
+    {2018, 197, 0, 0},
+    {2049, 198, 0, 0},
+    {17, 199, 0, 0},
+    {3005, 200, 0, 0},
+    {2015, 201, 0, 0},
+    {2015, 202, 0, 0},
+    {2015, 203, 0, 0},
+    {2015, 204, 0, 0},
+    {2015, 205, 0, 0},
+    {2015, 206, 0, 0},
+    {2015, 207, 0, 0},
+    {2015, 208, 0, 0},
+    {2015, 209, 0, 0},
+    {2015, 210, 0, 0},
+    {2015, 211, 0, 0},
+    {2015, 212, 0, 0},
+    {2015, 213, 0, 0},
+    {2015, 214, 0, 0},
+    {2011, 215, 0, 0},
+    {2007, 216, 0, 0},
+    {2008, 217, 0, 0},
+    {2011, 218, 0, 0},
+    {9, 219, 0, 0},
+    {9, 220, 0, 0},
+    {9, 221, 0, 0},
+    {9, 222, 0, 0},
+    {2011, 223, 0, 0},
+    {2011, 224, 0, 0},
+    {2008, 225, 0, 0},
+    {2008, 226, 0, 0},
+    {2008, 227, 0, 0},
+    {2007, 228, 0, 0},
+    {2007, 229, 0, 0},
+    {2010, 230, 0, 0},
+    {2045, 231, 0, 0},
+    {35, 232, 0, 0},
+    {2018, 233, 0, 0},
+    {23, 234, 0, 0},
+    {24, 235, 0, 0},
+    {3006, 236, 0, 0},
+    {3002, 237, 0, 0},
+    {3006, 238, 0, 0},
+    {2025, 239, 0, 0},
+    {2012, 240, 0, 0},
+    {3001, 241, 0, 0},
+    {3001, 242, 0, 0},
+    {3001, 243, 0, 0},
+    {3006, 244, 0, 0},
+    {3006, 245, 0, 0},
+    {3006, 246, 0, 0},
+    {3006, 247, 0, 0},
+    {3001, 248, 0, 0},
+    {3001, 249, 0, 0},
+    {3001, 250, 0, 0},
+    {3001, 251, 0, 0},
+    {3002, 252, 0, 0},
+    {3006, 253, 0, 0},
+    {2012, 254, 0, 0},
+    {2047, 255, 0, 0},
+    {2024, 256, 0, 0},
+    {2008, 257, 0, 0},
+    {2010, 258, 0, 0},
+    {2011, 259, 0, 0},
+    {2011, 260, 0, 0},
+    {2011, 261, 0, 0},
+    {2007, 262, 0, 0},
+    {10, 263, 0, 0},
+    {23, 264, 0, 0},
+    {23, 265, 0, 0},
+    {24, 266, 0, 0},
+    {24, 267, 0, 0},
+    {24, 268, 0, 0},
+    {46, 269, 0, 0},
+    {46, 270, 0, 0},
+    {33, 271, 0, 0},
+    {33, 272, 0, 0},
+    {33, 273, 0, 0},
+    {33, 274, 0, 0},
+    {33, 275, 0, 0},
+    {35, 276, 0, 0},
+    {35, 277, 0, 0},
+    {2015, 278, 0, 0},
+    {2015, 279, 0, 0},
+    {2015, 280, 0, 0},
+    {2014, 281, 0, 0},
+    {2014, 282, 0, 0},
+    {2014, 283, 0, 0},
+    {2015, 284, 0, 0},
+    {2014, 285, 0, 0},
+    {2014, 286, 0, 0},
+    {2014, 287, 0, 0},
+    {2025, 288, 0, 0},
+    {18, 289, 0, 0},
+    {18, 290, 0, 0},
+    {3004, 291, 0, 0},
+    {3004, 292, 0, 0},
+    {3004, 293, 0, 0},
+    {3004, 294, 0, 0},
+    {3004, 295, 0, 0},
+    {3004, 296, 0, 0},
+    {3004, 297, 0, 0},
+    {3004, 298, 0, 0},
+    {3004, 299, 0, 0},
+    {3004, 300, 0, 0},
+    {3004, 301, 0, 0},
+    {3004, 302, 0, 0},
+    {3004, 303, 0, 0},
+    {3004, 304, 0, 0},
+    {3001, 305, 0, 0},
+    {3001, 306, 0, 0},
+    {2012, 307, 0, 0},
+    {2012, 308, 0, 0},
+    {2012, 309, 0, 0},
+    {2048, 310, 0, 0},
+    {2049, 311, 0, 0},
+    {2046, 312, 0, 0},
+    {3006, 313, 0, 0},
+    {3006, 314, 0, 0},
+    {3006, 315, 0, 0},
+    {3006, 316, 0, 0},
+    {17, 317, 0, 0},
+    {3001, 318, 0, 0},
+    {3001, 319, 0, 0},
+    {11, 320, 0, 0},
+    {11, 321, 0, 0},
+    {11, 322, 0, 0},
+    {11, 323, 0, 0},
+    {11, 324, 0, 0},
+    {3003, 325, 0, 0},
+    // Halls of the Damned (E2M6)
+    {1, 0, 0, 0},
+    {3, 1, 0, 0},
+    {2, 2, 0, 0},
+    {4, 3, 0, 0},
+    {9, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {2007, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {2010, 8, 0, 0},
+    {3005, 9, 0, 0},
+    {2023, 10, 0, 0},
+    {2012, 11, 0, 0},
+    {2012, 12, 0, 0},
+    {40, 13, 0, 0},
+    {2012, 14, 0, 0},
+    {3001, 15, 0, 0},
+    {3001, 16, 0, 0},
+    {3002, 17, 0, 0},
+    {3002, 18, 0, 0},
+    {3002, 19, 0, 0},
+    {3002, 20, 0, 0},
+    {3002, 21, 0, 0},
+    {3004, 22, 0, 0},
+    {9, 23, 0, 0},
+    {3004, 24, 0, 0},
+    {2012, 25, 0, 0},
+    {8, 26, 0, 0},
+    {3002, 27, 0, 0},
+    {2007, 28, 0, 0},
+    {2011, 29, 0, 0},
+    {2008, 30, 0, 0},
+    {2011, 31, 0, 0},
+    {3002, 32, 0, 0},
+    {2011, 33, 0, 0},
+    {2010, 34, 0, 0},
+    {2014, 35, 0, 0},
+    {3002, 36, 0, 0},
+    {3002, 37, 0, 0},
+    {3002, 38, 0, 0},
+    {2019, 39, 0, 0},
+    {2049, 40, 0, 0},
+    {2007, 41, 0, 0},
+    {3002, 42, 0, 0},
+    {3002, 43, 0, 0},
+    {2046, 44, 0, 0},
+    {2011, 45, 0, 0},
+    {2046, 46, 0, 0},
+    {2008, 47, 0, 0},
+    {2026, 48, 0, 0},
+    {2018, 49, 0, 0},
+    {3005, 50, 0, 0},
+    {3006, 51, 0, 0},
+    {3006, 52, 0, 0},
+    {3006, 53, 0, 0},
+    {3006, 54, 0, 0},
+    {3006, 55, 0, 0},
+    {2012, 56, 0, 0},
+    {2024, 57, 0, 0},
+    {2008, 58, 0, 0},
+    {2047, 59, 0, 0},
+    {3005, 60, 0, 0},
+    {2012, 61, 0, 0},
+    {2008, 62, 0, 0},
+    {2011, 63, 0, 0},
+    {2014, 64, 0, 0},
+    {2014, 65, 0, 0},
+    {2010, 66, 0, 0},
+    {2045, 67, 0, 0},
+    {3002, 68, 0, 0},
+    {3002, 69, 0, 0},
+    {3002, 70, 0, 0},
+    {3002, 71, 0, 0},
+    {3002, 72, 0, 0},
+    {3002, 73, 0, 0},
+    {3004, 74, 0, 0},
+    {3004, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3004, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {9, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3004, 81, 0, 0},
+    {3004, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3004, 84, 0, 0},
+    {3001, 85, 0, 0},
+    {9, 86, 0, 0},
+    {3001, 87, 0, 0},
+    {2015, 88, 0, 0},
+    {2015, 89, 0, 0},
+    {2008, 90, 0, 0},
+    {2008, 91, 0, 0},
+    {2008, 92, 0, 0},
+    {2015, 93, 0, 0},
+    {3005, 94, 0, 0},
+    {3006, 95, 0, 0},
+    {3006, 96, 0, 0},
+    {2011, 97, 0, 0},
+    {2011, 98, 0, 0},
+    {2007, 99, 0, 0},
+    {2008, 100, 0, 0},
+    {3006, 101, 0, 0},
+    {2008, 102, 0, 0},
+    {3005, 103, 0, 0},
+    {3005, 104, 0, 0},
+    {3005, 105, 0, 0},
+    {9, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {9, 109, 0, 0},
+    {2014, 110, 0, 0},
+    {2014, 111, 0, 0},
+    {2015, 112, 0, 0},
+    {2012, 113, 0, 0},
+    {2014, 114, 0, 0},
+    {2015, 115, 0, 0},
+    {2015, 116, 0, 0},
+    {2007, 117, 0, 0},
+    {2008, 118, 0, 0},
+    {2007, 119, 0, 0},
+    {2008, 120, 0, 0},
+    {2012, 121, 0, 0},
+    {3005, 122, 0, 0},
+    {3002, 123, 0, 0},
+    {3002, 124, 0, 0},
+    {39, 125, 0, 0},
+    {3001, 126, 0, 0},
+    {3001, 127, 0, 0},
+    {3002, 128, 0, 0},
+    {2048, 129, 0, 0},
+    {2011, 130, 0, 0},
+    {3006, 131, 0, 0},
+    {3006, 132, 0, 0},
+    {3006, 133, 0, 0},
+    {3002, 134, 0, 0},
+    {3006, 135, 0, 0},
+    {3006, 136, 0, 0},
+    {3006, 137, 0, 0},
+    {3001, 138, 0, 0},
+    {3001, 139, 0, 0},
+    {3001, 140, 0, 0},
+    {3001, 141, 0, 0},
+    {2013, 142, 0, 0},
+    {2002, 143, 0, 0},
+    {2045, 144, 0, 0},
+    {2008, 145, 0, 0},
+    {2010, 146, 0, 0},
+    {2008, 147, 0, 0},
+    {2012, 148, 0, 0},
+    {3001, 149, 0, 0},
+    {3001, 150, 0, 0},
+    {9, 151, 0, 0},
+    {3004, 152, 0, 0},
+    {3004, 153, 0, 0},
+    {3004, 154, 0, 0},
+    {58, 155, 0, 0},
+    {3001, 156, 0, 0},
+    {3001, 157, 0, 0},
+    {3001, 158, 0, 0},
+    {2012, 159, 0, 0},
+    {2014, 160, 0, 0},
+    {2014, 161, 0, 0},
+    {2015, 162, 0, 0},
+    {2015, 163, 0, 0},
+    {2015, 164, 0, 0},
+    {3006, 165, 0, 0},
+    {3006, 166, 0, 0},
+    {3006, 167, 0, 0},
+    {3006, 168, 0, 0},
+    {3006, 169, 0, 0},
+    {3006, 170, 0, 0},
+    {2007, 171, 0, 0},
+    {2008, 172, 0, 0},
+    {2004, 173, 0, 0},
+    {2047, 174, 0, 0},
+    {2011, 175, 0, 0},
+    {2015, 176, 0, 0},
+    {2010, 177, 0, 0},
+    {2011, 178, 0, 0},
+    {3006, 179, 0, 0},
+    {3001, 180, 0, 0},
+    {3001, 181, 0, 0},
+    {3001, 182, 0, 0},
+    {3001, 183, 0, 0},
+    {3002, 184, 0, 0},
+    {3002, 185, 0, 0},
+    {2046, 186, 0, 0},
+    {3002, 187, 0, 0},
+    {3006, 188, 0, 0},
+    {3006, 189, 0, 0},
+    {3001, 190, 0, 0},
+    {3001, 191, 0, 0},
+    {3001, 192, 0, 0},
+    {3001, 193, 0, 0},
+    {3001, 194, 0, 0},
+    {3001, 195, 0, 0},
+    {3002, 196, 0, 0},
+    {2045, 197, 0, 0},
+    {24, 198, 0, 0},
+    {2011, 199, 0, 0},
+    {2011, 200, 0, 0},
+    {2011, 201, 0, 0},
+    {2011, 202, 0, 0},
+    {2008, 203, 0, 0},
+    {2008, 204, 0, 0},
+    {2007, 205, 0, 0},
+    {3002, 206, 0, 0},
+    {3002, 207, 0, 0},
+    {3002, 208, 0, 0},
+    {3002, 209, 0, 0},
+    {3001, 210, 0, 0},
+    {3006, 211, 0, 0},
+    {3001, 212, 0, 0},
+    {3006, 213, 0, 0},
+    {3001, 214, 0, 0},
+    {3006, 215, 0, 0},
+    {2049, 216, 0, 0},
+    {2024, 217, 0, 0},
+    {3006, 218, 0, 0},
+    {2011, 219, 0, 0},
+    {38, 220, 0, 0},
+    {2047, 221, 0, 0},
+    {2012, 222, 0, 0},
+    {2012, 223, 0, 0},
+    {2011, 224, 0, 0},
+    {2008, 225, 0, 0},
+    {2015, 226, 0, 0},
+    {2015, 227, 0, 0},
+    {2012, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {2001, 230, 0, 0},
+    {2008, 231, 0, 0},
+    {2003, 232, 0, 0},
+    {3006, 233, 0, 0},
+    {3002, 234, 0, 0},
+    {3005, 235, 0, 0},
+    {55, 236, 0, 0},
+    {55, 237, 0, 0},
+    {55, 238, 0, 0},
+    {57, 239, 0, 0},
+    {57, 240, 0, 0},
+    {57, 241, 0, 0},
+    {24, 242, 0, 0},
+    {33, 243, 0, 0},
+    {33, 244, 0, 0},
+    {37, 245, 0, 0},
+    {12, 246, 0, 0},
+    {24, 247, 0, 0},
+    {27, 248, 0, 0},
+    {27, 249, 0, 0},
+    {28, 250, 0, 0},
+    {27, 251, 0, 0},
+    {33, 252, 0, 0},
+    {33, 253, 0, 0},
+    {33, 254, 0, 0},
+    {33, 255, 0, 0},
+    {33, 256, 0, 0},
+    {33, 257, 0, 0},
+    {31, 258, 0, 0},
+    {31, 259, 0, 0},
+    {31, 260, 0, 0},
+    {31, 261, 0, 0},
+    {19, 262, 0, 0},
+    {12, 263, 0, 0},
+    {29, 264, 0, 0},
+    {35, 265, 0, 0},
+    {35, 266, 0, 0},
+    {2014, 267, 0, 0},
+    {28, 268, 0, 0},
+    {28, 269, 0, 0},
+    {35, 270, 0, 0},
+    {24, 271, 0, 0},
+    {52, 272, 0, 0},
+    {36, 273, 0, 0},
+    {62, 274, 0, 0},
+    {24, 275, 0, 0},
+    {24, 276, 0, 0},
+    {15, 277, 0, 0},
+    {2001, 278, 0, 0},
+    {11, 279, 0, 0},
+    {11, 280, 0, 0},
+    {11, 281, 0, 0},
+    {11, 282, 0, 0},
+    {11, 283, 0, 0},
+    {9, 284, 0, 0},
+    {9, 285, 0, 0},
+    {2005, 286, 0, 0},
+    {2008, 287, 0, 0},
+    {2008, 288, 0, 0},
+    {2008, 289, 0, 0},
+    {3002, 290, 0, 0},
+    {3002, 291, 0, 0},
+    {3002, 292, 0, 0},
+    {3002, 293, 0, 0},
+    {3003, 294, 0, 0},
+    {2049, 295, 0, 0},
+    {3002, 296, 0, 0},
+    {3002, 297, 0, 0},
+    {3003, 298, 0, 0},
+    {2047, 299, 0, 0},
+    {2011, 300, 0, 0},
+    {2008, 301, 0, 0},
+    {2045, 302, 0, 0},
+    {3002, 303, 0, 0},
+    {3002, 304, 0, 0},
+    {2008, 305, 0, 0},
+    {2010, 306, 0, 0},
+    {3002, 307, 0, 0},
+    {3002, 308, 0, 0},
+    {2011, 309, 0, 0},
+    {2011, 310, 0, 0},
+    {3003, 311, 0, 0},
+    {3006, 312, 0, 0},
+    {3006, 313, 0, 0},
+    {3006, 314, 0, 0},
+    {58, 315, 0, 0},
+    {58, 316, 0, 0},
+    {2049, 317, 0, 0},
+    {2008, 318, 0, 0},
+    {2010, 319, 0, 0},
+    {2024, 320, 0, 0},
+    {3001, 321, 0, 0},
+    {3001, 322, 0, 0},
+    {3001, 323, 0, 0},
+    {3001, 324, 0, 0},
+    {3001, 325, 0, 0},
+    // Spawning Vats (E2M7)
+    {3001, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3001, 2, 0, 0},
+    {3001, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3001, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {3002, 13, 0, 0},
+    {3005, 14, 0, 0},
+    {3005, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {2014, 17, 0, 0},
+    {2014, 18, 0, 0},
+    {2014, 19, 0, 0},
+    {2049, 20, 0, 0},
+    {17, 21, 0, 0},
+    {2014, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3002, 25, 0, 0},
+    {2014, 26, 0, 0},
+    {2014, 27, 0, 0},
+    {3002, 28, 0, 0},
+    {2003, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3002, 37, 0, 0},
+    {3002, 38, 0, 0},
+    {3002, 39, 0, 0},
+    {3002, 40, 0, 0},
+    {3002, 41, 0, 0},
+    {3002, 42, 0, 0},
+    {3002, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3002, 46, 0, 0},
+    {2007, 47, 0, 0},
+    {2007, 48, 0, 0},
+    {8, 49, 0, 0},
+    {2008, 50, 0, 0},
+    {2011, 51, 0, 0},
+    {3002, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {3001, 54, 0, 0},
+    {3001, 55, 0, 0},
+    {2012, 56, 0, 0},
+    {2007, 57, 0, 0},
+    {2007, 58, 0, 0},
+    {3001, 59, 0, 0},
+    {3001, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {2007, 62, 0, 0},
+    {2011, 63, 0, 0},
+    {2014, 64, 0, 0},
+    {3001, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {2007, 68, 0, 0},
+    {2007, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {2011, 72, 0, 0},
+    {2008, 73, 0, 0},
+    {3001, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {2014, 76, 0, 0},
+    {2015, 77, 0, 0},
+    {2048, 78, 0, 0},
+    {2024, 79, 0, 0},
+    {2014, 80, 0, 0},
+    {2007, 81, 0, 0},
+    {2007, 82, 0, 0},
+    {2007, 83, 0, 0},
+    {2011, 84, 0, 0},
+    {2011, 85, 0, 0},
+    {2011, 86, 0, 0},
+    {2011, 87, 0, 0},
+    {2011, 88, 0, 0},
+    {2015, 89, 0, 0},
+    {2015, 90, 0, 0},
+    {2015, 91, 0, 0},
+    {2049, 92, 0, 0},
+    {2048, 93, 0, 0},
+    {2019, 94, 0, 0},
+    {3002, 95, 0, 0},
+    {3002, 96, 0, 0},
+    {3001, 97, 0, 0},
+    {2015, 98, 0, 0},
+    {2047, 99, 0, 0},
+    {2008, 100, 0, 0},
+    {2048, 101, 0, 0},
+    {36, 102, 0, 0},
+    {50, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3001, 105, 0, 0},
+    {3001, 106, 0, 0},
+    {9, 107, 0, 0},
+    {3001, 108, 0, 0},
+    {3001, 109, 0, 0},
+    {1, 110, 0, 0},
+    {2, 111, 0, 0},
+    {3, 112, 0, 0},
+    {4, 113, 0, 0},
+    {2008, 114, 0, 0},
+    {2007, 115, 0, 0},
+    {57, 116, 0, 0},
+    {57, 117, 0, 0},
+    {2008, 118, 0, 0},
+    {2035, 119, 0, 0},
+    {2007, 120, 0, 0},
+    {2007, 121, 0, 0},
+    {3001, 122, 0, 0},
+    {3001, 123, 0, 0},
+    {3001, 124, 0, 0},
+    {2007, 125, 0, 0},
+    {2007, 126, 0, 0},
+    {3001, 127, 0, 0},
+    {2002, 128, 0, 0},
+    {2015, 129, 0, 0},
+    {2015, 130, 0, 0},
+    {2018, 131, 0, 0},
+    {2011, 132, 0, 0},
+    {3003, 133, 0, 0},
+    {2011, 134, 0, 0},
+    {2011, 135, 0, 0},
+    {2011, 136, 0, 0},
+    {2011, 137, 0, 0},
+    {2010, 138, 0, 0},
+    {2049, 139, 0, 0},
+    {13, 140, 0, 0},
+    {6, 141, 0, 0},
+    {5, 142, 0, 0},
+    {3005, 143, 0, 0},
+    {14, 144, 0, 0},
+    {14, 145, 0, 0},
+    {2022, 146, 0, 0},
+    {15, 147, 0, 0},
+    {10, 148, 0, 0},
+    {12, 149, 0, 0},
+    {10, 150, 0, 0},
+    {10, 151, 0, 0},
+    {10, 152, 0, 0},
+    {21, 153, 0, 0},
+    {21, 154, 0, 0},
+    {21, 155, 0, 0},
+    {24, 156, 0, 0},
+    {3002, 157, 0, 0},
+    {3002, 158, 0, 0},
+    {3002, 159, 0, 0},
+    {2023, 160, 0, 0},
+    {3002, 161, 0, 0},
+    {3002, 162, 0, 0},
+    {2015, 163, 0, 0},
+    {2015, 164, 0, 0},
+    {2015, 165, 0, 0},
+    {2015, 166, 0, 0},
+    {2015, 167, 0, 0},
+    {2012, 168, 0, 0},
+    {2011, 169, 0, 0},
+    {2011, 170, 0, 0},
+    {2008, 171, 0, 0},
+    {2010, 172, 0, 0},
+    {2047, 173, 0, 0},
+    {2005, 174, 0, 0},
+    {51, 175, 0, 0},
+    {3002, 176, 0, 0},
+    {3002, 177, 0, 0},
+    {2011, 178, 0, 0},
+    {3002, 179, 0, 0},
+    {56, 180, 0, 0},
+    {56, 181, 0, 0},
+    {2012, 182, 0, 0},
+    {41, 183, 0, 0},
+    {3005, 184, 0, 0},
+    {9, 185, 0, 0},
+    {9, 186, 0, 0},
+    {9, 187, 0, 0},
+    {3005, 188, 0, 0},
+    {55, 189, 0, 0},
+    {2047, 190, 0, 0},
+    {2047, 191, 0, 0},
+    {62, 192, 0, 0},
+    {62, 193, 0, 0},
+    {55, 194, 0, 0},
+    {63, 195, 0, 0},
+    {61, 196, 0, 0},
+    {2049, 197, 0, 0},
+    {2049, 198, 0, 0},
+    {2013, 199, 0, 0},
+    {2022, 200, 0, 0},
+    {2026, 201, 0, 0},
+    {2001, 202, 0, 0},
+    {2004, 203, 0, 0},
+    {58, 204, 0, 0},
+    {2049, 205, 0, 0},
+    {2012, 206, 0, 0},
+    {2012, 207, 0, 0},
+    {58, 208, 0, 0},
+    {58, 209, 0, 0},
+    {58, 210, 0, 0},
+    {3001, 211, 0, 0},
+    {3001, 212, 0, 0},
+    {3001, 213, 0, 0},
+    {3001, 214, 0, 0},
+    {3001, 215, 0, 0},
+    {3003, 216, 0, 0},
+    {58, 217, 0, 0},
+    {3002, 218, 0, 0},
+    {11, 219, 0, 0},
+    {11, 220, 0, 0},
+    {11, 221, 0, 0},
+    {11, 222, 0, 0},
+    {11, 223, 0, 0},
+    {3002, 224, 0, 0},
+    {3002, 225, 0, 0},
+    {3001, 226, 0, 0},
+    {3001, 227, 0, 0},
+    {3002, 228, 0, 0},
+    {17, 229, 0, 0},
+    {2007, 230, 0, 0},
+    {2028, 231, 0, 0},
+    {2028, 232, 0, 0},
+    {2004, 233, 0, 0},
+    {2003, 234, 0, 0},
+    // Tower of Babel (E2M8)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {2046, 4, 0, 0},
+    {2046, 5, 0, 0},
+    {2046, 6, 0, 0},
+    {2046, 7, 0, 0},
+    {2046, 8, 0, 0},
+    {2046, 9, 0, 0},
+    {2046, 10, 0, 0},
+    {2046, 11, 0, 0},
+    {2046, 12, 0, 0},
+    {2046, 13, 0, 0},
+    {2046, 14, 0, 0},
+    {2046, 15, 0, 0},
+    {2003, 16, 0, 0},
+    {2013, 17, 0, 0},
+    {2013, 18, 0, 0},
+    {16, 19, 0, 0},
+    {3006, 20, 0, 0},
+    {3006, 21, 0, 0},
+    {3006, 22, 0, 0},
+    {3006, 23, 0, 0},
+    {3006, 24, 0, 0},
+    {3006, 25, 0, 0},
+    {3006, 26, 0, 0},
+    {3006, 27, 0, 0},
+    {3006, 28, 0, 0},
+    {3006, 29, 0, 0},
+    {3006, 30, 0, 0},
+    {3006, 31, 0, 0},
+    {3006, 32, 0, 0},
+    {3006, 33, 0, 0},
+    {3006, 34, 0, 0},
+    {3006, 35, 0, 0},
+    {2019, 36, 0, 0},
+    {3006, 37, 0, 0},
+    {3006, 38, 0, 0},
+    {3006, 39, 0, 0},
+    {3006, 40, 0, 0},
+    {2046, 41, 0, 0},
+    {2046, 42, 0, 0},
+    {2046, 43, 0, 0},
+    {2046, 44, 0, 0},
+    {2046, 45, 0, 0},
+    {2046, 46, 0, 0},
+    {2046, 47, 0, 0},
+    {2046, 48, 0, 0},
+    {2046, 49, 0, 0},
+    {2046, 50, 0, 0},
+    {2046, 51, 0, 0},
+    {2046, 52, 0, 0},
+    {2046, 53, 0, 0},
+    {2046, 54, 0, 0},
+    {2046, 55, 0, 0},
+    {2046, 56, 0, 0},
+    {2046, 57, 0, 0},
+    {2046, 58, 0, 0},
+    {11, 59, 0, 0},
+    {11, 60, 0, 0},
+    {11, 61, 0, 0},
+    {11, 62, 0, 0},
+    {11, 63, 0, 0},
+    {11, 64, 0, 0},
+    {11, 65, 0, 0},
+    // Fortress of Mystery (E2M9)
+    {2, 0, 0, 0},
+    {1, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3003, 4, 0, 0},
+    {3003, 5, 0, 0},
+    {3003, 6, 0, 0},
+    {3003, 7, 0, 0},
+    {3005, 8, 0, 0},
+    {3005, 9, 0, 0},
+    {3005, 10, 0, 0},
+    {3005, 11, 0, 0},
+    {3005, 12, 0, 0},
+    {3005, 13, 0, 0},
+    {3005, 14, 0, 0},
+    {3005, 15, 0, 0},
+    {3005, 16, 0, 0},
+    {3005, 17, 0, 0},
+    {2013, 18, 0, 0},
+    {2012, 19, 0, 0},
+    {2012, 20, 0, 0},
+    {2012, 21, 0, 0},
+    {2012, 22, 0, 0},
+    {22, 23, 0, 0},
+    {22, 24, 0, 0},
+    {22, 25, 0, 0},
+    {22, 26, 0, 0},
+    {40, 27, 0, 0},
+    {38, 28, 0, 0},
+    {39, 29, 0, 0},
+    {8, 30, 0, 0},
+    {2002, 31, 0, 0},
+    {2004, 32, 0, 0},
+    {2003, 33, 0, 0},
+    {2001, 34, 0, 0},
+    {2005, 35, 0, 0},
+    {2026, 36, 0, 0},
+    {2047, 37, 0, 0},
+    {2048, 38, 0, 0},
+    {2048, 39, 0, 0},
+    {2046, 40, 0, 0},
+    {2046, 41, 0, 0},
+    {2049, 42, 0, 0},
+    {2049, 43, 0, 0},
+    {2019, 44, 0, 0},
+    {11, 45, 0, 0},
+    {11, 46, 0, 0},
+    {11, 47, 0, 0},
+    {11, 48, 0, 0},
+    {11, 49, 0, 0},
+    {11, 50, 0, 0},
+    {11, 51, 0, 0},
+    {11, 52, 0, 0},
+    // Hell Keep (E3M1)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3005, 7, 0, 0},
+    {3005, 8, 0, 0},
+    {2048, 9, 0, 0},
+    {2048, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3005, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {2012, 17, 0, 0},
+    {2012, 18, 0, 0},
+    {2008, 19, 0, 0},
+    {2001, 20, 0, 0},
+    {2049, 21, 0, 0},
+    {3002, 22, 0, 0},
+    {3002, 23, 0, 0},
+    {3002, 24, 0, 0},
+    {3002, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {3001, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {2007, 34, 0, 0},
+    {2011, 35, 0, 0},
+    {2011, 36, 0, 0},
+    {2014, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2015, 39, 0, 0},
+    {2015, 40, 0, 0},
+    {2015, 41, 0, 0},
+    {2015, 42, 0, 0},
+    {2012, 43, 0, 0},
+    {2012, 44, 0, 0},
+    {2012, 45, 0, 0},
+    {2003, 46, 0, 0},
+    {2008, 47, 0, 0},
+    {2011, 48, 0, 0},
+    {2012, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {43, 51, 0, 0},
+    {43, 52, 0, 0},
+    {43, 53, 0, 0},
+    {43, 54, 0, 0},
+    {43, 55, 0, 0},
+    {43, 56, 0, 0},
+    {43, 57, 0, 0},
+    {43, 58, 0, 0},
+    {43, 59, 0, 0},
+    {54, 60, 0, 0},
+    {54, 61, 0, 0},
+    {27, 62, 0, 0},
+    {27, 63, 0, 0},
+    {33, 64, 0, 0},
+    {33, 65, 0, 0},
+    {12, 66, 0, 0},
+    {24, 67, 0, 0},
+    {24, 68, 0, 0},
+    {24, 69, 0, 0},
+    {29, 70, 0, 0},
+    {32, 71, 0, 0},
+    {33, 72, 0, 0},
+    {33, 73, 0, 0},
+    {33, 74, 0, 0},
+    {32, 75, 0, 0},
+    {37, 76, 0, 0},
+    {24, 77, 0, 0},
+    {24, 78, 0, 0},
+    {54, 79, 0, 0},
+    {62, 80, 0, 0},
+    {10, 81, 0, 0},
+    {62, 82, 0, 0},
+    {62, 83, 0, 0},
+    {2008, 84, 0, 0},
+    {11, 85, 0, 0},
+    {11, 86, 0, 0},
+    {11, 87, 0, 0},
+    {11, 88, 0, 0},
+    {3001, 89, 0, 0},
+    {3001, 90, 0, 0},
+    {2008, 91, 0, 0},
+    // Slough of Despair (E3M2)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {47, 4, 0, 0},
+    {47, 5, 0, 0},
+    {46, 6, 0, 0},
+    {43, 7, 0, 0},
+    {54, 8, 0, 0},
+    {54, 9, 0, 0},
+    {47, 10, 0, 0},
+    {47, 11, 0, 0},
+    {3006, 12, 0, 0},
+    {3002, 13, 0, 0},
+    {3002, 14, 0, 0},
+    {2011, 15, 0, 0},
+    {3005, 16, 0, 0},
+    {2049, 17, 0, 0},
+    {9, 18, 0, 0},
+    {2008, 19, 0, 0},
+    {2014, 20, 0, 0},
+    {2012, 21, 0, 0},
+    {46, 22, 0, 0},
+    {58, 23, 0, 0},
+    {9, 24, 0, 0},
+    {3004, 25, 0, 0},
+    {2012, 26, 0, 0},
+    {3006, 27, 0, 0},
+    {47, 28, 0, 0},
+    {47, 29, 0, 0},
+    {47, 30, 0, 0},
+    {2048, 31, 0, 0},
+    {2002, 32, 0, 0},
+    {3002, 33, 0, 0},
+    {9, 34, 0, 0},
+    {9, 35, 0, 0},
+    {2011, 36, 0, 0},
+    {2023, 37, 0, 0},
+    {58, 38, 0, 0},
+    {3004, 39, 0, 0},
+    {3004, 40, 0, 0},
+    {3004, 41, 0, 0},
+    {3006, 42, 0, 0},
+    {3006, 43, 0, 0},
+    {26, 44, 0, 0},
+    {3006, 45, 0, 0},
+    {2011, 46, 0, 0},
+    {2008, 47, 0, 0},
+    {43, 48, 0, 0},
+    {47, 49, 0, 0},
+    {42, 50, 0, 0},
+    {42, 51, 0, 0},
+    {46, 52, 0, 0},
+    {46, 53, 0, 0},
+    {46, 54, 0, 0},
+    {46, 55, 0, 0},
+    {46, 56, 0, 0},
+    {3006, 57, 0, 0},
+    {3006, 58, 0, 0},
+    {3006, 59, 0, 0},
+    {2011, 60, 0, 0},
+    {2011, 61, 0, 0},
+    {2012, 62, 0, 0},
+    {2049, 63, 0, 0},
+    {15, 64, 0, 0},
+    {19, 65, 0, 0},
+    {19, 66, 0, 0},
+    {54, 67, 0, 0},
+    {43, 68, 0, 0},
+    {43, 69, 0, 0},
+    {47, 70, 0, 0},
+    {47, 71, 0, 0},
+    {42, 72, 0, 0},
+    {19, 73, 0, 0},
+    {3005, 74, 0, 0},
+    {2011, 75, 0, 0},
+    {2019, 76, 0, 0},
+    {2018, 77, 0, 0},
+    {3002, 78, 0, 0},
+    {3006, 79, 0, 0},
+    {2003, 80, 0, 0},
+    {10, 81, 0, 0},
+    {3006, 82, 0, 0},
+    {3006, 83, 0, 0},
+    {3006, 84, 0, 0},
+    {2011, 85, 0, 0},
+    {2011, 86, 0, 0},
+    {2008, 87, 0, 0},
+    {2004, 88, 0, 0},
+    {2012, 89, 0, 0},
+    {2012, 90, 0, 0},
+    {2011, 91, 0, 0},
+    {2011, 92, 0, 0},
+    {2008, 93, 0, 0},
+    {2008, 94, 0, 0},
+    {2007, 95, 0, 0},
+    {2007, 96, 0, 0},
+    {2011, 97, 0, 0},
+    {2008, 98, 0, 0},
+    {3004, 99, 0, 0},
+    {3004, 100, 0, 0},
+    {3002, 101, 0, 0},
+    {9, 102, 0, 0},
+    {9, 103, 0, 0},
+    {9, 104, 0, 0},
+    {9, 105, 0, 0},
+    {9, 106, 0, 0},
+    {9, 107, 0, 0},
+    {2047, 108, 0, 0},
+    {2015, 109, 0, 0},
+    {2015, 110, 0, 0},
+    {2015, 111, 0, 0},
+    {2015, 112, 0, 0},
+    {2015, 113, 0, 0},
+    {2015, 114, 0, 0},
+    {58, 115, 0, 0},
+    {3005, 116, 0, 0},
+    {3006, 117, 0, 0},
+    {3006, 118, 0, 0},
+    {3006, 119, 0, 0},
+    {3002, 120, 0, 0},
+    {2011, 121, 0, 0},
+    {3005, 122, 0, 0},
+    {2011, 123, 0, 0},
+    {2011, 124, 0, 0},
+    {58, 125, 0, 0},
+    {2012, 126, 0, 0},
+    {58, 127, 0, 0},
+    {3006, 128, 0, 0},
+    {3006, 129, 0, 0},
+    {3006, 130, 0, 0},
+    {3006, 131, 0, 0},
+    {3006, 132, 0, 0},
+    {3006, 133, 0, 0},
+    {3002, 134, 0, 0},
+    {3006, 135, 0, 0},
+    {3006, 136, 0, 0},
+    {3006, 137, 0, 0},
+    {3002, 138, 0, 0},
+    {3005, 139, 0, 0},
+    {3005, 140, 0, 0},
+    {3005, 141, 0, 0},
+    {3005, 142, 0, 0},
+    {2011, 143, 0, 0},
+    {2011, 144, 0, 0},
+    {2008, 145, 0, 0},
+    {2008, 146, 0, 0},
+    {2008, 147, 0, 0},
+    {2014, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {2014, 150, 0, 0},
+    {2014, 151, 0, 0},
+    {2014, 152, 0, 0},
+    {2011, 153, 0, 0},
+    {2026, 154, 0, 0},
+    {2012, 155, 0, 0},
+    {2049, 156, 0, 0},
+    {2048, 157, 0, 0},
+    {24, 158, 0, 0},
+    {15, 159, 0, 0},
+    {12, 160, 0, 0},
+    {24, 161, 0, 0},
+    {58, 162, 0, 0},
+    {58, 163, 0, 0},
+    {58, 164, 0, 0},
+    {2007, 165, 0, 0},
+    {2012, 166, 0, 0},
+    {3006, 167, 0, 0},
+    {3006, 168, 0, 0},
+    {3006, 169, 0, 0},
+    {3006, 170, 0, 0},
+    {3006, 171, 0, 0},
+    {3006, 172, 0, 0},
+    {3006, 173, 0, 0},
+    {3006, 174, 0, 0},
+    {3006, 175, 0, 0},
+    {3006, 176, 0, 0},
+    {3006, 177, 0, 0},
+    {2012, 178, 0, 0},
+    {2012, 179, 0, 0},
+    {2012, 180, 0, 0},
+    {40, 181, 0, 0},
+    {2013, 182, 0, 0},
+    {3006, 183, 0, 0},
+    {62, 184, 0, 0},
+    {62, 185, 0, 0},
+    {62, 186, 0, 0},
+    {24, 187, 0, 0},
+    {58, 188, 0, 0},
+    {58, 189, 0, 0},
+    {2046, 190, 0, 0},
+    {2012, 191, 0, 0},
+    {2012, 192, 0, 0},
+    {58, 193, 0, 0},
+    {2001, 194, 0, 0},
+    {2004, 195, 0, 0},
+    {17, 196, 0, 0},
+    {2046, 197, 0, 0},
+    {11, 198, 0, 0},
+    {11, 199, 0, 0},
+    {11, 200, 0, 0},
+    {11, 201, 0, 0},
+    {2008, 202, 0, 0},
+    {2047, 203, 0, 0},
+    {9, 204, 0, 0},
+    {2010, 205, 0, 0},
+    {2003, 206, 0, 0},
+    {11, 207, 0, 0},
+    // Pandemonium (E3M3)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {2007, 4, 0, 0},
+    {2047, 5, 0, 0},
+    {2049, 6, 0, 0},
+    {2010, 7, 0, 0},
+    {2008, 8, 0, 0},
+    {2007, 9, 0, 0},
+    {2008, 10, 0, 0},
+    {2023, 11, 0, 0},
+    {2048, 12, 0, 0},
+    {2012, 13, 0, 0},
+    {2002, 14, 0, 0},
+    {2012, 15, 0, 0},
+    {2008, 16, 0, 0},
+    {2007, 17, 0, 0},
+    {2007, 18, 0, 0},
+    {2047, 19, 0, 0},
+    {2047, 20, 0, 0},
+    {2012, 21, 0, 0},
+    {2006, 22, 0, 0},
+    {2013, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3001, 25, 0, 0},
+    {2022, 26, 0, 0},
+    {2007, 27, 0, 0},
+    {2049, 28, 0, 0},
+    {2012, 29, 0, 0},
+    {3002, 30, 0, 0},
+    {3002, 31, 0, 0},
+    {2007, 32, 0, 0},
+    {2012, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3002, 38, 0, 0},
+    {3001, 39, 0, 0},
+    {3001, 40, 0, 0},
+    {3001, 41, 0, 0},
+    {3001, 42, 0, 0},
+    {3001, 43, 0, 0},
+    {3001, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {40, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3001, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {3001, 54, 0, 0},
+    {3001, 55, 0, 0},
+    {2011, 56, 0, 0},
+    {2007, 57, 0, 0},
+    {2008, 58, 0, 0},
+    {3001, 59, 0, 0},
+    {57, 60, 0, 0},
+    {57, 61, 0, 0},
+    {57, 62, 0, 0},
+    {57, 63, 0, 0},
+    {3006, 64, 0, 0},
+    {3006, 65, 0, 0},
+    {2019, 66, 0, 0},
+    {17, 67, 0, 0},
+    {3006, 68, 0, 0},
+    {3002, 69, 0, 0},
+    {3005, 70, 0, 0},
+    {3002, 71, 0, 0},
+    {3002, 72, 0, 0},
+    {2001, 73, 0, 0},
+    {3003, 74, 0, 0},
+    {3002, 75, 0, 0},
+    {2012, 76, 0, 0},
+    {2047, 77, 0, 0},
+    {3002, 78, 0, 0},
+    {2015, 79, 0, 0},
+    {2015, 80, 0, 0},
+    {2015, 81, 0, 0},
+    {2011, 82, 0, 0},
+    {2011, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {2018, 85, 0, 0},
+    {2012, 86, 0, 0},
+    {2011, 87, 0, 0},
+    {8, 88, 0, 0},
+    {2048, 89, 0, 0},
+    {2012, 90, 0, 0},
+    {2012, 91, 0, 0},
+    {2026, 92, 0, 0},
+    {2008, 93, 0, 0},
+    {2048, 94, 0, 0},
+    {2011, 95, 0, 0},
+    {2011, 96, 0, 0},
+    {3002, 97, 0, 0},
+    {3005, 98, 0, 0},
+    {3001, 99, 0, 0},
+    {3001, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3005, 105, 0, 0},
+    {3006, 106, 0, 0},
+    {3006, 107, 0, 0},
+    {3006, 108, 0, 0},
+    {3006, 109, 0, 0},
+    {2011, 110, 0, 0},
+    {2011, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {2019, 113, 0, 0},
+    {2008, 114, 0, 0},
+    {2008, 115, 0, 0},
+    {2007, 116, 0, 0},
+    {2007, 117, 0, 0},
+    {2001, 118, 0, 0},
+    {2012, 119, 0, 0},
+    {2048, 120, 0, 0},
+    {2008, 121, 0, 0},
+    {2011, 122, 0, 0},
+    {2011, 123, 0, 0},
+    {2012, 124, 0, 0},
+    {2012, 125, 0, 0},
+    {9, 126, 0, 0},
+    {2012, 127, 0, 0},
+    {2049, 128, 0, 0},
+    {2007, 129, 0, 0},
+    {2011, 130, 0, 0},
+    {2007, 131, 0, 0},
+    {2008, 132, 0, 0},
+    {2010, 133, 0, 0},
+    {2008, 134, 0, 0},
+    {2008, 135, 0, 0},
+    {2011, 136, 0, 0},
+    {2011, 137, 0, 0},
+    {3002, 138, 0, 0},
+    {3002, 139, 0, 0},
+    {3006, 140, 0, 0},
+    {3006, 141, 0, 0},
+    {58, 142, 0, 0},
+    {58, 143, 0, 0},
+    {58, 144, 0, 0},
+    {3001, 145, 0, 0},
+    {3001, 146, 0, 0},
+    {3001, 147, 0, 0},
+    {3001, 148, 0, 0},
+    {3006, 149, 0, 0},
+    {3006, 150, 0, 0},
+    {3002, 151, 0, 0},
+    {2011, 152, 0, 0},
+    {2012, 153, 0, 0},
+    {2010, 154, 0, 0},
+    {3003, 155, 0, 0},
+    {62, 156, 0, 0},
+    {62, 157, 0, 0},
+    {32, 158, 0, 0},
+    {41, 159, 0, 0},
+    {10, 160, 0, 0},
+    {12, 161, 0, 0},
+    {24, 162, 0, 0},
+    {24, 163, 0, 0},
+    {61, 164, 0, 0},
+    {46, 165, 0, 0},
+    {42, 166, 0, 0},
+    {42, 167, 0, 0},
+    {42, 168, 0, 0},
+    {42, 169, 0, 0},
+    {25, 170, 0, 0},
+    {27, 171, 0, 0},
+    {27, 172, 0, 0},
+    {45, 173, 0, 0},
+    {45, 174, 0, 0},
+    {35, 175, 0, 0},
+    {35, 176, 0, 0},
+    {24, 177, 0, 0},
+    {24, 178, 0, 0},
+    {34, 179, 0, 0},
+    {34, 180, 0, 0},
+    {53, 181, 0, 0},
+    {25, 182, 0, 0},
+    {2003, 183, 0, 0},
+    {17, 184, 0, 0},
+    {2019, 185, 0, 0},
+    {2012, 186, 0, 0},
+    {2012, 187, 0, 0},
+    {2012, 188, 0, 0},
+    {3002, 189, 0, 0},
+    {2049, 190, 0, 0},
+    {11, 191, 0, 0},
+    {11, 192, 0, 0},
+    {11, 193, 0, 0},
+    {11, 194, 0, 0},
+    {11, 195, 0, 0},
+    {11, 196, 0, 0},
+    {11, 197, 0, 0},
+    {58, 198, 0, 0},
+    {3002, 199, 0, 0},
+    {3006, 200, 0, 0},
+    {3006, 201, 0, 0},
+    {3006, 202, 0, 0},
+    {3006, 203, 0, 0},
+    {3002, 204, 0, 0},
+    {55, 205, 0, 0},
+    {55, 206, 0, 0},
+    {55, 207, 0, 0},
+    {55, 208, 0, 0},
+    // House of Pain (E3M4)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {2001, 5, 0, 0},
+    {2011, 6, 0, 0},
+    {2011, 7, 0, 0},
+    {2047, 8, 0, 0},
+    {3004, 9, 0, 0},
+    {3004, 10, 0, 0},
+    {2007, 11, 0, 0},
+    {2008, 12, 0, 0},
+    {2047, 13, 0, 0},
+    {2007, 14, 0, 0},
+    {2023, 15, 0, 0},
+    {2007, 16, 0, 0},
+    {2019, 17, 0, 0},
+    {2012, 18, 0, 0},
+    {3006, 19, 0, 0},
+    {3002, 20, 0, 0},
+    {3002, 21, 0, 0},
+    {3002, 22, 0, 0},
+    {2011, 23, 0, 0},
+    {2014, 24, 0, 0},
+    {2014, 25, 0, 0},
+    {2015, 26, 0, 0},
+    {2015, 27, 0, 0},
+    {2014, 28, 0, 0},
+    {3005, 29, 0, 0},
+    {3005, 30, 0, 0},
+    {3002, 31, 0, 0},
+    {3002, 32, 0, 0},
+    {3002, 33, 0, 0},
+    {3002, 34, 0, 0},
+    {3004, 35, 0, 0},
+    {9, 36, 0, 0},
+    {3006, 37, 0, 0},
+    {3004, 38, 0, 0},
+    {3004, 39, 0, 0},
+    {3006, 40, 0, 0},
+    {2014, 41, 0, 0},
+    {2014, 42, 0, 0},
+    {2014, 43, 0, 0},
+    {2014, 44, 0, 0},
+    {2014, 45, 0, 0},
+    {2002, 46, 0, 0},
+    {2014, 47, 0, 0},
+    {2014, 48, 0, 0},
+    {2014, 49, 0, 0},
+    {2014, 50, 0, 0},
+    {2022, 51, 0, 0},
+    {2011, 52, 0, 0},
+    {2011, 53, 0, 0},
+    {2011, 54, 0, 0},
+    {2011, 55, 0, 0},
+    {2011, 56, 0, 0},
+    {2011, 57, 0, 0},
+    {2011, 58, 0, 0},
+    {2011, 59, 0, 0},
+    {3001, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {3001, 62, 0, 0},
+    {3002, 63, 0, 0},
+    {2007, 64, 0, 0},
+    {2007, 65, 0, 0},
+    {9, 66, 0, 0},
+    {9, 67, 0, 0},
+    {3002, 68, 0, 0},
+    {2014, 69, 0, 0},
+    {2014, 70, 0, 0},
+    {2014, 71, 0, 0},
+    {2049, 72, 0, 0},
+    {2048, 73, 0, 0},
+    {2011, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3002, 79, 0, 0},
+    {3002, 80, 0, 0},
+    {3003, 81, 0, 0},
+    {3002, 82, 0, 0},
+    {3006, 83, 0, 0},
+    {3006, 84, 0, 0},
+    {3006, 85, 0, 0},
+    {3006, 86, 0, 0},
+    {40, 87, 0, 0},
+    {3005, 88, 0, 0},
+    {2048, 89, 0, 0},
+    {2015, 90, 0, 0},
+    {2015, 91, 0, 0},
+    {2015, 92, 0, 0},
+    {2011, 93, 0, 0},
+    {2047, 94, 0, 0},
+    {2011, 95, 0, 0},
+    {2008, 96, 0, 0},
+    {2007, 97, 0, 0},
+    {2008, 98, 0, 0},
+    {2014, 99, 0, 0},
+    {2018, 100, 0, 0},
+    {2014, 101, 0, 0},
+    {3002, 102, 0, 0},
+    {3002, 103, 0, 0},
+    {3002, 104, 0, 0},
+    {2014, 105, 0, 0},
+    {2014, 106, 0, 0},
+    {2014, 107, 0, 0},
+    {2014, 108, 0, 0},
+    {3001, 109, 0, 0},
+    {3001, 110, 0, 0},
+    {3001, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {39, 114, 0, 0},
+    {2007, 115, 0, 0},
+    {2007, 116, 0, 0},
+    {2011, 117, 0, 0},
+    {3002, 118, 0, 0},
+    {3002, 119, 0, 0},
+    {3002, 120, 0, 0},
+    {2022, 121, 0, 0},
+    {2049, 122, 0, 0},
+    {2014, 123, 0, 0},
+    {2014, 124, 0, 0},
+    {2011, 125, 0, 0},
+    {2011, 126, 0, 0},
+    {2011, 127, 0, 0},
+    {2011, 128, 0, 0},
+    {3006, 129, 0, 0},
+    {9, 130, 0, 0},
+    {3004, 131, 0, 0},
+    {9, 132, 0, 0},
+    {3004, 133, 0, 0},
+    {38, 134, 0, 0},
+    {3006, 135, 0, 0},
+    {3002, 136, 0, 0},
+    {3004, 137, 0, 0},
+    {3004, 138, 0, 0},
+    {3004, 139, 0, 0},
+    {3004, 140, 0, 0},
+    {3004, 141, 0, 0},
+    {3001, 142, 0, 0},
+    {3006, 143, 0, 0},
+    {3002, 144, 0, 0},
+    {3005, 145, 0, 0},
+    {3003, 146, 0, 0},
+    {2012, 147, 0, 0},
+    {2012, 148, 0, 0},
+    {2012, 149, 0, 0},
+    {2012, 150, 0, 0},
+    {2012, 151, 0, 0},
+    {2012, 152, 0, 0},
+    {2012, 153, 0, 0},
+    {2012, 154, 0, 0},
+    {2012, 155, 0, 0},
+    {2012, 156, 0, 0},
+    {2012, 157, 0, 0},
+    {2012, 158, 0, 0},
+    {2049, 159, 0, 0},
+    {8, 160, 0, 0},
+    {2025, 161, 0, 0},
+    {2012, 162, 0, 0},
+    {2012, 163, 0, 0},
+    {3002, 164, 0, 0},
+    {3002, 165, 0, 0},
+    {3002, 166, 0, 0},
+    {3002, 167, 0, 0},
+    {3002, 168, 0, 0},
+    {2048, 169, 0, 0},
+    {2019, 170, 0, 0},
+    {3001, 171, 0, 0},
+    {3001, 172, 0, 0},
+    {3001, 173, 0, 0},
+    {3001, 174, 0, 0},
+    {3004, 175, 0, 0},
+    {3004, 176, 0, 0},
+    {3005, 177, 0, 0},
+    {2035, 178, 0, 0},
+    {2035, 179, 0, 0},
+    {2035, 180, 0, 0},
+    {2007, 181, 0, 0},
+    {2024, 182, 0, 0},
+    {2015, 183, 0, 0},
+    {3002, 184, 0, 0},
+    {3005, 185, 0, 0},
+    {3004, 186, 0, 0},
+    {3005, 187, 0, 0},
+    {3004, 188, 0, 0},
+    {3004, 189, 0, 0},
+    {9, 190, 0, 0},
+    {3004, 191, 0, 0},
+    {3004, 192, 0, 0},
+    {9, 193, 0, 0},
+    {3004, 194, 0, 0},
+    {3004, 195, 0, 0},
+    {9, 196, 0, 0},
+    {3004, 197, 0, 0},
+    {2011, 198, 0, 0},
+    {2049, 199, 0, 0},
+    {2014, 200, 0, 0},
+    {2014, 201, 0, 0},
+    {2014, 202, 0, 0},
+    {2014, 203, 0, 0},
+    {2014, 204, 0, 0},
+    {2014, 205, 0, 0},
+    {2006, 206, 0, 0},
+    {3001, 207, 0, 0},
+    {3001, 208, 0, 0},
+    {3001, 209, 0, 0},
+    {3001, 210, 0, 0},
+    {2014, 211, 0, 0},
+    {2014, 212, 0, 0},
+    {2014, 213, 0, 0},
+    {2014, 214, 0, 0},
+    {2014, 215, 0, 0},
+    {2014, 216, 0, 0},
+    {2014, 217, 0, 0},
+    {2014, 218, 0, 0},
+    {3003, 219, 0, 0},
+    {2013, 220, 0, 0},
+    {2035, 221, 0, 0},
+    {2035, 222, 0, 0},
+    {2035, 223, 0, 0},
+    {2035, 224, 0, 0},
+    {2007, 225, 0, 0},
+    {2008, 226, 0, 0},
+    {2011, 227, 0, 0},
+    {2011, 228, 0, 0},
+    {2046, 229, 0, 0},
+    {2046, 230, 0, 0},
+    {2046, 231, 0, 0},
+    {2046, 232, 0, 0},
+    {2046, 233, 0, 0},
+    {3002, 234, 0, 0},
+    {3002, 235, 0, 0},
+    {2046, 236, 0, 0},
+    {2012, 237, 0, 0},
+    {2012, 238, 0, 0},
+    {17, 239, 0, 0},
+    {17, 240, 0, 0},
+    {2048, 241, 0, 0},
+    {2018, 242, 0, 0},
+    {2003, 243, 0, 0},
+    {14, 244, 0, 0},
+    {14, 245, 0, 0},
+    {2035, 246, 0, 0},
+    {2035, 247, 0, 0},
+    {2049, 248, 0, 0},
+    {2048, 249, 0, 0},
+    {2049, 250, 0, 0},
+    {2047, 251, 0, 0},
+    {3001, 252, 0, 0},
+    {3005, 253, 0, 0},
+    {3005, 254, 0, 0},
+    {3002, 255, 0, 0},
+    {3002, 256, 0, 0},
+    {3005, 257, 0, 0},
+    {3002, 258, 0, 0},
+    {3002, 259, 0, 0},
+    {3005, 260, 0, 0},
+    {58, 261, 0, 0},
+    {3004, 262, 0, 0},
+    {3004, 263, 0, 0},
+    {3004, 264, 0, 0},
+    {3004, 265, 0, 0},
+    {9, 266, 0, 0},
+    {9, 267, 0, 0},
+    {9, 268, 0, 0},
+    {9, 269, 0, 0},
+    {3002, 270, 0, 0},
+    {3005, 271, 0, 0},
+    {2035, 272, 0, 0},
+    {2035, 273, 0, 0},
+    {2035, 274, 0, 0},
+    {3002, 275, 0, 0},
+    {2035, 276, 0, 0},
+    {2035, 277, 0, 0},
+    {2035, 278, 0, 0},
+    {3002, 279, 0, 0},
+    {62, 280, 0, 0},
+    {62, 281, 0, 0},
+    {34, 282, 0, 0},
+    {62, 283, 0, 0},
+    {42, 284, 0, 0},
+    {42, 285, 0, 0},
+    {42, 286, 0, 0},
+    {29, 287, 0, 0},
+    {35, 288, 0, 0},
+    {35, 289, 0, 0},
+    {35, 290, 0, 0},
+    {35, 291, 0, 0},
+    {24, 292, 0, 0},
+    {24, 293, 0, 0},
+    {42, 294, 0, 0},
+    {26, 295, 0, 0},
+    {24, 296, 0, 0},
+    {24, 297, 0, 0},
+    {15, 298, 0, 0},
+    {12, 299, 0, 0},
+    {27, 300, 0, 0},
+    {29, 301, 0, 0},
+    {29, 302, 0, 0},
+    {63, 303, 0, 0},
+    {32, 304, 0, 0},
+    {32, 305, 0, 0},
+    {57, 306, 0, 0},
+    {57, 307, 0, 0},
+    {57, 308, 0, 0},
+    {57, 309, 0, 0},
+    {2011, 310, 0, 0},
+    {2007, 311, 0, 0},
+    {2012, 312, 0, 0},
+    {2007, 313, 0, 0},
+    {2007, 314, 0, 0},
+    {2007, 315, 0, 0},
+    {2007, 316, 0, 0},
+    {2008, 317, 0, 0},
+    {2018, 318, 0, 0},
+    {2049, 319, 0, 0},
+    {2008, 320, 0, 0},
+    {2008, 321, 0, 0},
+    {11, 322, 0, 0},
+    {11, 323, 0, 0},
+    {11, 324, 0, 0},
+    {11, 325, 0, 0},
+    {3002, 326, 0, 0},
+    {3002, 327, 0, 0},
+    {3002, 328, 0, 0},
+    {3002, 329, 0, 0},
+    {2010, 330, 0, 0},
+    {2010, 331, 0, 0},
+    {2012, 332, 0, 0},
+    {58, 333, 0, 0},
+    {3002, 334, 0, 0},
+    {58, 335, 0, 0},
+    {3002, 336, 0, 0},
+    {9, 337, 0, 0},
+    {9, 338, 0, 0},
+    {3002, 339, 0, 0},
+    {3002, 340, 0, 0},
+    {3002, 341, 0, 0},
+    {3002, 342, 0, 0},
+    {3002, 343, 0, 0},
+    {9, 344, 0, 0},
+    {9, 345, 0, 0},
+    {9, 346, 0, 0},
+    {9, 347, 0, 0},
+    {3006, 348, 0, 0},
+    {3006, 349, 0, 0},
+    {3006, 350, 0, 0},
+    {3001, 351, 0, 0},
+    {58, 352, 0, 0},
+    {3006, 353, 0, 0},
+    {3006, 354, 0, 0},
+    {3006, 355, 0, 0},
+    {3006, 356, 0, 0},
+    {3006, 357, 0, 0},
+    {3006, 358, 0, 0},
+    {3006, 359, 0, 0},
+    {3006, 360, 0, 0},
+    {58, 361, 0, 0},
+    {3002, 362, 0, 0},
+    {3002, 363, 0, 0},
+    {3002, 364, 0, 0},
+    {3002, 365, 0, 0},
+    {3002, 366, 0, 0},
+    {3001, 367, 0, 0},
+    {3001, 368, 0, 0},
+    {3001, 369, 0, 0},
+    {3002, 370, 0, 0},
+    {3005, 371, 0, 0},
+    {42, 372, 0, 0},
+    {42, 373, 0, 0},
+    // Unholy Cathedral (E3M5)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {14, 10, 0, 0},
+    {2045, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {2014, 13, 0, 0},
+    {2014, 14, 0, 0},
+    {2014, 15, 0, 0},
+    {2014, 16, 0, 0},
+    {3006, 17, 0, 0},
+    {2049, 18, 0, 0},
+    {3001, 19, 0, 0},
+    {3001, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3001, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {2025, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3002, 31, 0, 0},
+    {17, 32, 0, 0},
+    {2011, 33, 0, 0},
+    {2011, 34, 0, 0},
+    {2011, 35, 0, 0},
+    {2011, 36, 0, 0},
+    {2014, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2014, 39, 0, 0},
+    {2014, 40, 0, 0},
+    {2014, 41, 0, 0},
+    {2014, 42, 0, 0},
+    {2014, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {3001, 45, 0, 0},
+    {2048, 46, 0, 0},
+    {2010, 47, 0, 0},
+    {3006, 48, 0, 0},
+    {3006, 49, 0, 0},
+    {3006, 50, 0, 0},
+    {3006, 51, 0, 0},
+    {3006, 52, 0, 0},
+    {3006, 53, 0, 0},
+    {40, 54, 0, 0},
+    {2002, 55, 0, 0},
+    {3003, 56, 0, 0},
+    {3003, 57, 0, 0},
+    {3003, 58, 0, 0},
+    {3005, 59, 0, 0},
+    {3005, 60, 0, 0},
+    {3005, 61, 0, 0},
+    {3002, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {3002, 64, 0, 0},
+    {3002, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {3005, 68, 0, 0},
+    {3005, 69, 0, 0},
+    {3005, 70, 0, 0},
+    {2011, 71, 0, 0},
+    {2011, 72, 0, 0},
+    {2011, 73, 0, 0},
+    {2007, 74, 0, 0},
+    {2007, 75, 0, 0},
+    {2015, 76, 0, 0},
+    {2015, 77, 0, 0},
+    {2008, 78, 0, 0},
+    {2012, 79, 0, 0},
+    {2012, 80, 0, 0},
+    {2012, 81, 0, 0},
+    {2012, 82, 0, 0},
+    {2046, 83, 0, 0},
+    {2012, 84, 0, 0},
+    {17, 85, 0, 0},
+    {2004, 86, 0, 0},
+    {2013, 87, 0, 0},
+    {3002, 88, 0, 0},
+    {39, 89, 0, 0},
+    {2022, 90, 0, 0},
+    {2049, 91, 0, 0},
+    {2048, 92, 0, 0},
+    {2048, 93, 0, 0},
+    {2048, 94, 0, 0},
+    {2048, 95, 0, 0},
+    {2012, 96, 0, 0},
+    {2012, 97, 0, 0},
+    {2014, 98, 0, 0},
+    {2014, 99, 0, 0},
+    {2014, 100, 0, 0},
+    {2014, 101, 0, 0},
+    {2014, 102, 0, 0},
+    {2014, 103, 0, 0},
+    {2014, 104, 0, 0},
+    {2014, 105, 0, 0},
+    {14, 106, 0, 0},
+    {14, 107, 0, 0},
+    {3002, 108, 0, 0},
+    {2014, 109, 0, 0},
+    {2014, 110, 0, 0},
+    {2014, 111, 0, 0},
+    {2014, 112, 0, 0},
+    {2014, 113, 0, 0},
+    {2014, 114, 0, 0},
+    {3002, 115, 0, 0},
+    {3002, 116, 0, 0},
+    {3002, 117, 0, 0},
+    {3002, 118, 0, 0},
+    {3002, 119, 0, 0},
+    {3002, 120, 0, 0},
+    {3002, 121, 0, 0},
+    {2012, 122, 0, 0},
+    {2012, 123, 0, 0},
+    {2012, 124, 0, 0},
+    {2012, 125, 0, 0},
+    {2023, 126, 0, 0},
+    {2015, 127, 0, 0},
+    {2015, 128, 0, 0},
+    {2024, 129, 0, 0},
+    {3002, 130, 0, 0},
+    {2007, 131, 0, 0},
+    {2007, 132, 0, 0},
+    {2005, 133, 0, 0},
+    {14, 134, 0, 0},
+    {3001, 135, 0, 0},
+    {3001, 136, 0, 0},
+    {3001, 137, 0, 0},
+    {3001, 138, 0, 0},
+    {3001, 139, 0, 0},
+    {3001, 140, 0, 0},
+    {3001, 141, 0, 0},
+    {3001, 142, 0, 0},
+    {3006, 143, 0, 0},
+    {3006, 144, 0, 0},
+    {3006, 145, 0, 0},
+    {3006, 146, 0, 0},
+    {3006, 147, 0, 0},
+    {3006, 148, 0, 0},
+    {3001, 149, 0, 0},
+    {3001, 150, 0, 0},
+    {3001, 151, 0, 0},
+    {3001, 152, 0, 0},
+    {3001, 153, 0, 0},
+    {3001, 154, 0, 0},
+    {3001, 155, 0, 0},
+    {3001, 156, 0, 0},
+    {3001, 157, 0, 0},
+    {3001, 158, 0, 0},
+    {3001, 159, 0, 0},
+    {3001, 160, 0, 0},
+    {3001, 161, 0, 0},
+    {3002, 162, 0, 0},
+    {3002, 163, 0, 0},
+    {3002, 164, 0, 0},
+    {3002, 165, 0, 0},
+    {3002, 166, 0, 0},
+    {3002, 167, 0, 0},
+    {3002, 168, 0, 0},
+    {3002, 169, 0, 0},
+    {3002, 170, 0, 0},
+    {3002, 171, 0, 0},
+    {3003, 172, 0, 0},
+    {2047, 173, 0, 0},
+    {2048, 174, 0, 0},
+    {2011, 175, 0, 0},
+    {2049, 176, 0, 0},
+    {2011, 177, 0, 0},
+    {2046, 178, 0, 0},
+    {2047, 179, 0, 0},
+    {2006, 180, 0, 0},
+    {3005, 181, 0, 0},
+    {3002, 182, 0, 0},
+    {3005, 183, 0, 0},
+    {3002, 184, 0, 0},
+    {3005, 185, 0, 0},
+    {3002, 186, 0, 0},
+    {2001, 187, 0, 0},
+    {3001, 188, 0, 0},
+    {2012, 189, 0, 0},
+    {2001, 190, 0, 0},
+    {2011, 191, 0, 0},
+    {2011, 192, 0, 0},
+    {2008, 193, 0, 0},
+    {2008, 194, 0, 0},
+    {2008, 195, 0, 0},
+    {2008, 196, 0, 0},
+    {2008, 197, 0, 0},
+    {2008, 198, 0, 0},
+    {2008, 199, 0, 0},
+    {2008, 200, 0, 0},
+    {2007, 201, 0, 0},
+    {2007, 202, 0, 0},
+    {2007, 203, 0, 0},
+    {2007, 204, 0, 0},
+    {2007, 205, 0, 0},
+    {2007, 206, 0, 0},
+    {2007, 207, 0, 0},
+    {2007, 208, 0, 0},
+    {2011, 209, 0, 0},
+    {2011, 210, 0, 0},
+    {2011, 211, 0, 0},
+    {2011, 212, 0, 0},
+    {2011, 213, 0, 0},
+    {2011, 214, 0, 0},
+    {2011, 215, 0, 0},
+    {2011, 216, 0, 0},
+    {3002, 217, 0, 0},
+    {2003, 218, 0, 0},
+    {2010, 219, 0, 0},
+    {2049, 220, 0, 0},
+    {2010, 221, 0, 0},
+    {2012, 222, 0, 0},
+    {2010, 223, 0, 0},
+    {62, 224, 0, 0},
+    {62, 225, 0, 0},
+    {62, 226, 0, 0},
+    {62, 227, 0, 0},
+    {62, 228, 0, 0},
+    {62, 229, 0, 0},
+    {25, 230, 0, 0},
+    {26, 231, 0, 0},
+    {26, 232, 0, 0},
+    {25, 233, 0, 0},
+    {59, 234, 0, 0},
+    {27, 235, 0, 0},
+    {15, 236, 0, 0},
+    {15, 237, 0, 0},
+    {15, 238, 0, 0},
+    {15, 239, 0, 0},
+    {10, 240, 0, 0},
+    {10, 241, 0, 0},
+    {12, 242, 0, 0},
+    {12, 243, 0, 0},
+    {60, 244, 0, 0},
+    {51, 245, 0, 0},
+    {61, 246, 0, 0},
+    {59, 247, 0, 0},
+    {35, 248, 0, 0},
+    {35, 249, 0, 0},
+    {35, 250, 0, 0},
+    {35, 251, 0, 0},
+    {28, 252, 0, 0},
+    {29, 253, 0, 0},
+    {28, 254, 0, 0},
+    {15, 255, 0, 0},
+    {10, 256, 0, 0},
+    {24, 257, 0, 0},
+    {24, 258, 0, 0},
+    {12, 259, 0, 0},
+    {42, 260, 0, 0},
+    {42, 261, 0, 0},
+    {42, 262, 0, 0},
+    {44, 263, 0, 0},
+    {44, 264, 0, 0},
+    {44, 265, 0, 0},
+    {45, 266, 0, 0},
+    {45, 267, 0, 0},
+    {45, 268, 0, 0},
+    {45, 269, 0, 0},
+    {46, 270, 0, 0},
+    {46, 271, 0, 0},
+    {46, 272, 0, 0},
+    {46, 273, 0, 0},
+    {42, 274, 0, 0},
+    {42, 275, 0, 0},
+    {58, 276, 0, 0},
+    {58, 277, 0, 0},
+    {3003, 278, 0, 0},
+    {58, 279, 0, 0},
+    {58, 280, 0, 0},
+    {3002, 281, 0, 0},
+    {2012, 282, 0, 0},
+    {2008, 283, 0, 0},
+    {2007, 284, 0, 0},
+    {2013, 285, 0, 0},
+    {11, 286, 0, 0},
+    {11, 287, 0, 0},
+    {11, 288, 0, 0},
+    {11, 289, 0, 0},
+    {11, 290, 0, 0},
+    // Mt. Erebus (E3M6)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3005, 4, 0, 0},
+    {3005, 5, 0, 0},
+    {3005, 6, 0, 0},
+    {3005, 7, 0, 0},
+    {3005, 8, 0, 0},
+    {3005, 9, 0, 0},
+    {63, 10, 0, 0},
+    {10, 11, 0, 0},
+    {44, 12, 0, 0},
+    {56, 13, 0, 0},
+    {36, 14, 0, 0},
+    {44, 15, 0, 0},
+    {24, 16, 0, 0},
+    {55, 17, 0, 0},
+    {55, 18, 0, 0},
+    {12, 19, 0, 0},
+    {3003, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3001, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {9, 27, 0, 0},
+    {2049, 28, 0, 0},
+    {2048, 29, 0, 0},
+    {2010, 30, 0, 0},
+    {2015, 31, 0, 0},
+    {2015, 32, 0, 0},
+    {2015, 33, 0, 0},
+    {2015, 34, 0, 0},
+    {2015, 35, 0, 0},
+    {2015, 36, 0, 0},
+    {2015, 37, 0, 0},
+    {2019, 38, 0, 0},
+    {9, 39, 0, 0},
+    {9, 40, 0, 0},
+    {9, 41, 0, 0},
+    {9, 42, 0, 0},
+    {2012, 43, 0, 0},
+    {2011, 44, 0, 0},
+    {2011, 45, 0, 0},
+    {2011, 46, 0, 0},
+    {2012, 47, 0, 0},
+    {3002, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {2011, 52, 0, 0},
+    {2018, 53, 0, 0},
+    {2049, 54, 0, 0},
+    {3006, 55, 0, 0},
+    {3006, 56, 0, 0},
+    {3006, 57, 0, 0},
+    {3006, 58, 0, 0},
+    {3006, 59, 0, 0},
+    {3006, 60, 0, 0},
+    {2015, 61, 0, 0},
+    {2011, 62, 0, 0},
+    {2007, 63, 0, 0},
+    {2011, 64, 0, 0},
+    {2011, 65, 0, 0},
+    {2011, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {3001, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {9, 73, 0, 0},
+    {9, 74, 0, 0},
+    {3002, 75, 0, 0},
+    {3002, 76, 0, 0},
+    {2049, 77, 0, 0},
+    {2011, 78, 0, 0},
+    {3004, 79, 0, 0},
+    {3004, 80, 0, 0},
+    {3005, 81, 0, 0},
+    {9, 82, 0, 0},
+    {9, 83, 0, 0},
+    {61, 84, 0, 0},
+    {3002, 85, 0, 0},
+    {14, 86, 0, 0},
+    {58, 87, 0, 0},
+    {57, 88, 0, 0},
+    {57, 89, 0, 0},
+    {8, 90, 0, 0},
+    {2008, 91, 0, 0},
+    {2011, 92, 0, 0},
+    {2014, 93, 0, 0},
+    {2014, 94, 0, 0},
+    {2014, 95, 0, 0},
+    {2014, 96, 0, 0},
+    {2014, 97, 0, 0},
+    {2025, 98, 0, 0},
+    {3004, 99, 0, 0},
+    {2022, 100, 0, 0},
+    {2015, 101, 0, 0},
+    {2048, 102, 0, 0},
+    {2002, 103, 0, 0},
+    {2001, 104, 0, 0},
+    {2003, 105, 0, 0},
+    {20, 106, 0, 0},
+    {3002, 107, 0, 0},
+    {3002, 108, 0, 0},
+    {3002, 109, 0, 0},
+    {20, 110, 0, 0},
+    {3001, 111, 0, 0},
+    {3001, 112, 0, 0},
+    {3001, 113, 0, 0},
+    {3001, 114, 0, 0},
+    {3006, 115, 0, 0},
+    {3006, 116, 0, 0},
+    {3001, 117, 0, 0},
+    {3006, 118, 0, 0},
+    {3006, 119, 0, 0},
+    {3006, 120, 0, 0},
+    {3006, 121, 0, 0},
+    {3001, 122, 0, 0},
+    {2046, 123, 0, 0},
+    {2011, 124, 0, 0},
+    {2011, 125, 0, 0},
+    {2011, 126, 0, 0},
+    {2011, 127, 0, 0},
+    {29, 128, 0, 0},
+    {29, 129, 0, 0},
+    {28, 130, 0, 0},
+    {28, 131, 0, 0},
+    {30, 132, 0, 0},
+    {36, 133, 0, 0},
+    {43, 134, 0, 0},
+    {43, 135, 0, 0},
+    {42, 136, 0, 0},
+    {42, 137, 0, 0},
+    {54, 138, 0, 0},
+    {42, 139, 0, 0},
+    {42, 140, 0, 0},
+    {42, 141, 0, 0},
+    {42, 142, 0, 0},
+    {42, 143, 0, 0},
+    {43, 144, 0, 0},
+    {47, 145, 0, 0},
+    {47, 146, 0, 0},
+    {47, 147, 0, 0},
+    {54, 148, 0, 0},
+    {47, 149, 0, 0},
+    {43, 150, 0, 0},
+    {43, 151, 0, 0},
+    {43, 152, 0, 0},
+    {42, 153, 0, 0},
+    {42, 154, 0, 0},
+    {42, 155, 0, 0},
+    {42, 156, 0, 0},
+    {42, 157, 0, 0},
+    {3005, 158, 0, 0},
+    {3005, 159, 0, 0},
+    {3005, 160, 0, 0},
+    {3005, 161, 0, 0},
+    {2025, 162, 0, 0},
+    {58, 163, 0, 0},
+    {58, 164, 0, 0},
+    {2049, 165, 0, 0},
+    {14, 166, 0, 0},
+    {14, 167, 0, 0},
+    {2004, 168, 0, 0},
+    {2012, 169, 0, 0},
+    {2014, 170, 0, 0},
+    {2014, 171, 0, 0},
+    {2014, 172, 0, 0},
+    {2014, 173, 0, 0},
+    {63, 174, 0, 0},
+    {27, 175, 0, 0},
+    {27, 176, 0, 0},
+    {45, 177, 0, 0},
+    {45, 178, 0, 0},
+    {2012, 179, 0, 0},
+    {2018, 180, 0, 0},
+    {2008, 181, 0, 0},
+    {26, 182, 0, 0},
+    {3001, 183, 0, 0},
+    {3001, 184, 0, 0},
+    {3001, 185, 0, 0},
+    {3001, 186, 0, 0},
+    {3001, 187, 0, 0},
+    {3001, 188, 0, 0},
+    {3004, 189, 0, 0},
+    {3004, 190, 0, 0},
+    {3004, 191, 0, 0},
+    {3004, 192, 0, 0},
+    {9, 193, 0, 0},
+    {9, 194, 0, 0},
+    {9, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {3001, 197, 0, 0},
+    {9, 198, 0, 0},
+    {9, 199, 0, 0},
+    {17, 200, 0, 0},
+    {2012, 201, 0, 0},
+    {2012, 202, 0, 0},
+    {34, 203, 0, 0},
+    {34, 204, 0, 0},
+    {14, 205, 0, 0},
+    {2023, 206, 0, 0},
+    {2022, 207, 0, 0},
+    {42, 208, 0, 0},
+    {42, 209, 0, 0},
+    {42, 210, 0, 0},
+    {42, 211, 0, 0},
+    {42, 212, 0, 0},
+    {42, 213, 0, 0},
+    {42, 214, 0, 0},
+    {42, 215, 0, 0},
+    {42, 216, 0, 0},
+    {42, 217, 0, 0},
+    {42, 218, 0, 0},
+    {42, 219, 0, 0},
+    {42, 220, 0, 0},
+    {42, 221, 0, 0},
+    {42, 222, 0, 0},
+    {42, 223, 0, 0},
+    {42, 224, 0, 0},
+    {43, 225, 0, 0},
+    {43, 226, 0, 0},
+    {43, 227, 0, 0},
+    {43, 228, 0, 0},
+    {43, 229, 0, 0},
+    {43, 230, 0, 0},
+    {43, 231, 0, 0},
+    {54, 232, 0, 0},
+    {43, 233, 0, 0},
+    {54, 234, 0, 0},
+    {47, 235, 0, 0},
+    {47, 236, 0, 0},
+    {47, 237, 0, 0},
+    {47, 238, 0, 0},
+    {43, 239, 0, 0},
+    {47, 240, 0, 0},
+    {47, 241, 0, 0},
+    {41, 242, 0, 0},
+    {3005, 243, 0, 0},
+    {3005, 244, 0, 0},
+    {3005, 245, 0, 0},
+    {3005, 246, 0, 0},
+    {3005, 247, 0, 0},
+    {3005, 248, 0, 0},
+    {2013, 249, 0, 0},
+    {40, 250, 0, 0},
+    {40, 251, 0, 0},
+    {9, 252, 0, 0},
+    {9, 253, 0, 0},
+    {9, 254, 0, 0},
+    {9, 255, 0, 0},
+    {9, 256, 0, 0},
+    {3001, 257, 0, 0},
+    {3001, 258, 0, 0},
+    {3001, 259, 0, 0},
+    {3001, 260, 0, 0},
+    {3001, 261, 0, 0},
+    {3001, 262, 0, 0},
+    {3001, 263, 0, 0},
+    {3005, 264, 0, 0},
+    {3005, 265, 0, 0},
+    {3005, 266, 0, 0},
+    {2026, 267, 0, 0},
+    {2011, 268, 0, 0},
+    {2011, 269, 0, 0},
+    {2011, 270, 0, 0},
+    {2008, 271, 0, 0},
+    {2008, 272, 0, 0},
+    {2005, 273, 0, 0},
+    {3006, 274, 0, 0},
+    {3006, 275, 0, 0},
+    {3006, 276, 0, 0},
+    {3006, 277, 0, 0},
+    {3006, 278, 0, 0},
+    {3006, 279, 0, 0},
+    {3005, 280, 0, 0},
+    {3005, 281, 0, 0},
+    {2010, 282, 0, 0},
+    {2011, 283, 0, 0},
+    {3006, 284, 0, 0},
+    {3006, 285, 0, 0},
+    {3006, 286, 0, 0},
+    {3006, 287, 0, 0},
+    {3006, 288, 0, 0},
+    {3006, 289, 0, 0},
+    {3006, 290, 0, 0},
+    {3006, 291, 0, 0},
+    {3006, 292, 0, 0},
+    {3006, 293, 0, 0},
+    {3006, 294, 0, 0},
+    {3006, 295, 0, 0},
+    {3006, 296, 0, 0},
+    {3006, 297, 0, 0},
+    {3006, 298, 0, 0},
+    {3006, 299, 0, 0},
+    {3006, 300, 0, 0},
+    {3006, 301, 0, 0},
+    {2025, 302, 0, 0},
+    {2010, 303, 0, 0},
+    {47, 304, 0, 0},
+    {47, 305, 0, 0},
+    {47, 306, 0, 0},
+    {14, 307, 0, 0},
+    {58, 308, 0, 0},
+    {14, 309, 0, 0},
+    {2008, 310, 0, 0},
+    {2008, 311, 0, 0},
+    {2007, 312, 0, 0},
+    {2011, 313, 0, 0},
+    {2011, 314, 0, 0},
+    {2011, 315, 0, 0},
+    {2011, 316, 0, 0},
+    {2011, 317, 0, 0},
+    {2011, 318, 0, 0},
+    {11, 319, 0, 0},
+    {11, 320, 0, 0},
+    {11, 321, 0, 0},
+    {11, 322, 0, 0},
+    {11, 323, 0, 0},
+    {2025, 324, 0, 0},
+    {2025, 325, 0, 0},
+    {2013, 326, 0, 0},
+    {2012, 327, 0, 0},
+    {17, 328, 0, 0},
+    {2048, 329, 0, 0},
+    {2049, 330, 0, 0},
+    {2046, 331, 0, 0},
+    {2049, 332, 0, 0},
+    {11, 333, 0, 0},
+    {2006, 334, 0, 0},
+    // Limbo (E3M7)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3002, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {3006, 13, 0, 0},
+    {3002, 14, 0, 0},
+    {3002, 15, 0, 0},
+    {2015, 16, 0, 0},
+    {2015, 17, 0, 0},
+    {2015, 18, 0, 0},
+    {3005, 19, 0, 0},
+    {2015, 20, 0, 0},
+    {2025, 21, 0, 0},
+    {40, 22, 0, 0},
+    {14, 23, 0, 0},
+    {14, 24, 0, 0},
+    {14, 25, 0, 0},
+    {14, 26, 0, 0},
+    {14, 27, 0, 0},
+    {14, 28, 0, 0},
+    {2049, 29, 0, 0},
+    {2025, 30, 0, 0},
+    {2012, 31, 0, 0},
+    {2012, 32, 0, 0},
+    {2012, 33, 0, 0},
+    {2012, 34, 0, 0},
+    {2012, 35, 0, 0},
+    {2012, 36, 0, 0},
+    {2012, 37, 0, 0},
+    {2012, 38, 0, 0},
+    {14, 39, 0, 0},
+    {14, 40, 0, 0},
+    {14, 41, 0, 0},
+    {14, 42, 0, 0},
+    {14, 43, 0, 0},
+    {14, 44, 0, 0},
+    {3005, 45, 0, 0},
+    {3005, 46, 0, 0},
+    {3005, 47, 0, 0},
+    {3005, 48, 0, 0},
+    {2013, 49, 0, 0},
+    {2046, 50, 0, 0},
+    {2003, 51, 0, 0},
+    {2025, 52, 0, 0},
+    {2025, 53, 0, 0},
+    {2025, 54, 0, 0},
+    {2025, 55, 0, 0},
+    {2025, 56, 0, 0},
+    {38, 57, 0, 0},
+    {3005, 58, 0, 0},
+    {3005, 59, 0, 0},
+    {8, 60, 0, 0},
+    {14, 61, 0, 0},
+    {2008, 62, 0, 0},
+    {2047, 63, 0, 0},
+    {2047, 64, 0, 0},
+    {2004, 65, 0, 0},
+    {2010, 66, 0, 0},
+    {2018, 67, 0, 0},
+    {2014, 68, 0, 0},
+    {39, 69, 0, 0},
+    {3006, 70, 0, 0},
+    {3006, 71, 0, 0},
+    {3003, 72, 0, 0},
+    {3006, 73, 0, 0},
+    {3006, 74, 0, 0},
+    {3006, 75, 0, 0},
+    {9, 76, 0, 0},
+    {9, 77, 0, 0},
+    {9, 78, 0, 0},
+    {2008, 79, 0, 0},
+    {2008, 80, 0, 0},
+    {2007, 81, 0, 0},
+    {2011, 82, 0, 0},
+    {2018, 83, 0, 0},
+    {2011, 84, 0, 0},
+    {3002, 85, 0, 0},
+    {3002, 86, 0, 0},
+    {2049, 87, 0, 0},
+    {2048, 88, 0, 0},
+    {2012, 89, 0, 0},
+    {2012, 90, 0, 0},
+    {3005, 91, 0, 0},
+    {3005, 92, 0, 0},
+    {3002, 93, 0, 0},
+    {9, 94, 0, 0},
+    {3004, 95, 0, 0},
+    {3004, 96, 0, 0},
+    {3006, 97, 0, 0},
+    {3006, 98, 0, 0},
+    {3006, 99, 0, 0},
+    {3002, 100, 0, 0},
+    {3002, 101, 0, 0},
+    {3002, 102, 0, 0},
+    {9, 103, 0, 0},
+    {9, 104, 0, 0},
+    {9, 105, 0, 0},
+    {9, 106, 0, 0},
+    {2008, 107, 0, 0},
+    {2008, 108, 0, 0},
+    {2008, 109, 0, 0},
+    {2015, 110, 0, 0},
+    {2015, 111, 0, 0},
+    {2019, 112, 0, 0},
+    {2049, 113, 0, 0},
+    {2049, 114, 0, 0},
+    {2010, 115, 0, 0},
+    {2007, 116, 0, 0},
+    {2008, 117, 0, 0},
+    {2007, 118, 0, 0},
+    {3006, 119, 0, 0},
+    {3006, 120, 0, 0},
+    {3006, 121, 0, 0},
+    {9, 122, 0, 0},
+    {2047, 123, 0, 0},
+    {2025, 124, 0, 0},
+    {2025, 125, 0, 0},
+    {2025, 126, 0, 0},
+    {2025, 127, 0, 0},
+    {2006, 128, 0, 0},
+    {62, 129, 0, 0},
+    {62, 130, 0, 0},
+    {61, 131, 0, 0},
+    {62, 132, 0, 0},
+    {2049, 133, 0, 0},
+    {2012, 134, 0, 0},
+    {2011, 135, 0, 0},
+    {2011, 136, 0, 0},
+    {11, 137, 0, 0},
+    {11, 138, 0, 0},
+    {11, 139, 0, 0},
+    {11, 140, 0, 0},
+    {2012, 141, 0, 0},
+    {2012, 142, 0, 0},
+    {2047, 143, 0, 0},
+    {2047, 144, 0, 0},
+    {2047, 145, 0, 0},
+    {2047, 146, 0, 0},
+    {2047, 147, 0, 0},
+    {2047, 148, 0, 0},
+    {2047, 149, 0, 0},
+    {2047, 150, 0, 0},
+    {2047, 151, 0, 0},
+    {2046, 152, 0, 0},
+    {2001, 153, 0, 0},
+    // Dis (E3M8)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {62, 4, 0, 0},
+    {7, 5, 0, 0},
+    {3003, 6, 0, 0},
+    {2003, 7, 0, 0},
+    {2004, 8, 0, 0},
+    {2010, 9, 0, 0},
+    {2010, 10, 0, 0},
+    {2010, 11, 0, 0},
+    {2010, 12, 0, 0},
+    {2010, 13, 0, 0},
+    {2010, 14, 0, 0},
+    {2010, 15, 0, 0},
+    {2010, 16, 0, 0},
+    {2010, 17, 0, 0},
+    {2010, 18, 0, 0},
+    {2010, 19, 0, 0},
+    {2010, 20, 0, 0},
+    {2010, 21, 0, 0},
+    {2010, 22, 0, 0},
+    {2010, 23, 0, 0},
+    {2010, 24, 0, 0},
+    {2010, 25, 0, 0},
+    {2010, 26, 0, 0},
+    {2010, 27, 0, 0},
+    {2010, 28, 0, 0},
+    {2047, 29, 0, 0},
+    {2047, 30, 0, 0},
+    {2047, 31, 0, 0},
+    {3005, 32, 0, 0},
+    {3005, 33, 0, 0},
+    {2019, 34, 0, 0},
+    {2010, 35, 0, 0},
+    {2010, 36, 0, 0},
+    {2010, 37, 0, 0},
+    {2010, 38, 0, 0},
+    {2010, 39, 0, 0},
+    {2010, 40, 0, 0},
+    {2010, 41, 0, 0},
+    {2010, 42, 0, 0},
+    {2010, 43, 0, 0},
+    {2010, 44, 0, 0},
+    {2010, 45, 0, 0},
+    {2010, 46, 0, 0},
+    {2010, 47, 0, 0},
+    {2010, 48, 0, 0},
+    {2010, 49, 0, 0},
+    {2010, 50, 0, 0},
+    {2010, 51, 0, 0},
+    {2010, 52, 0, 0},
+    {2010, 53, 0, 0},
+    {11, 54, 0, 0},
+    {11, 55, 0, 0},
+    {11, 56, 0, 0},
+    {11, 57, 0, 0},
+    // Warrens (E3M9)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3005, 7, 0, 0},
+    {3005, 8, 0, 0},
+    {2048, 9, 0, 0},
+    {2048, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3005, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {2012, 17, 0, 0},
+    {2012, 18, 0, 0},
+    {2008, 19, 0, 0},
+    {2001, 20, 0, 0},
+    {2049, 21, 0, 0},
+    {3002, 22, 0, 0},
+    {3002, 23, 0, 0},
+    {3002, 24, 0, 0},
+    {3002, 25, 0, 0},
+    {3001, 26, 0, 0},
+    {3001, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {2007, 34, 0, 0},
+    {2011, 35, 0, 0},
+    {2011, 36, 0, 0},
+    {2014, 37, 0, 0},
+    {2014, 38, 0, 0},
+    {2015, 39, 0, 0},
+    {2015, 40, 0, 0},
+    {2015, 41, 0, 0},
+    {2015, 42, 0, 0},
+    {2012, 43, 0, 0},
+    {2012, 44, 0, 0},
+    {2012, 45, 0, 0},
+    {2003, 46, 0, 0},
+    {2008, 47, 0, 0},
+    {2011, 48, 0, 0},
+    {2012, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {43, 51, 0, 0},
+    {43, 52, 0, 0},
+    {43, 53, 0, 0},
+    {43, 54, 0, 0},
+    {43, 55, 0, 0},
+    {43, 56, 0, 0},
+    {43, 57, 0, 0},
+    {43, 58, 0, 0},
+    {43, 59, 0, 0},
+    {54, 60, 0, 0},
+    {54, 61, 0, 0},
+    {27, 62, 0, 0},
+    {27, 63, 0, 0},
+    {33, 64, 0, 0},
+    {33, 65, 0, 0},
+    {12, 66, 0, 0},
+    {24, 67, 0, 0},
+    {24, 68, 0, 0},
+    {24, 69, 0, 0},
+    {29, 70, 0, 0},
+    {32, 71, 0, 0},
+    {33, 72, 0, 0},
+    {33, 73, 0, 0},
+    {33, 74, 0, 0},
+    {32, 75, 0, 0},
+    {37, 76, 0, 0},
+    {24, 77, 0, 0},
+    {24, 78, 0, 0},
+    {54, 79, 0, 0},
+    {62, 80, 0, 0},
+    {10, 81, 0, 0},
+    {62, 82, 0, 0},
+    {62, 83, 0, 0},
+    {2008, 84, 0, 0},
+    {11, 85, 0, 0},
+    {11, 86, 0, 0},
+    {11, 87, 0, 0},
+    {11, 88, 0, 0},
+    {2046, 89, 0, 0},
+    {2046, 90, 0, 0},
+    {2046, 91, 0, 0},
+    {2046, 92, 0, 0},
+    {2046, 93, 0, 0},
+    {2046, 94, 0, 0},
+    {2046, 95, 0, 0},
+    {2046, 96, 0, 0},
+    {2046, 97, 0, 0},
+    {2046, 98, 0, 0},
+    {2003, 99, 0, 0},
+    {16, 100, 0, 0},
+    {2013, 101, 0, 0},
+    {2046, 102, 0, 0},
+    {2046, 103, 0, 0},
+    {2046, 104, 0, 0},
+    {2046, 105, 0, 0},
+    {2046, 106, 0, 0},
+    {2046, 107, 0, 0},
+    {40, 108, 0, 0},
+    {3005, 109, 0, 0},
+    {3005, 110, 0, 0},
+    {2049, 111, 0, 0},
+    {2049, 112, 0, 0},
+    {2025, 113, 0, 0},
+    {2023, 114, 0, 0},
+    {3003, 115, 0, 0},
+    {3006, 116, 0, 0},
+    {3006, 117, 0, 0},
+    {3006, 118, 0, 0},
+    {3006, 119, 0, 0},
+    {2022, 120, 0, 0},
+    {2024, 121, 0, 0},
+    {2002, 122, 0, 0},
+    {58, 123, 0, 0},
+    {58, 124, 0, 0},
+    {58, 125, 0, 0},
+    {58, 126, 0, 0},
+    {58, 127, 0, 0},
+    {58, 128, 0, 0},
+    {2048, 129, 0, 0},
+    {2012, 130, 0, 0},
+    {2012, 131, 0, 0},
+    {3005, 132, 0, 0},
+    {3005, 133, 0, 0},
+    {3005, 134, 0, 0},
+    {2004, 135, 0, 0},
+    {2047, 136, 0, 0},
+    {2047, 137, 0, 0},
+    {2022, 138, 0, 0},
+    {2018, 139, 0, 0},
+    {2005, 140, 0, 0},
+    {2006, 141, 0, 0},
+    {2025, 142, 0, 0},
+    {38, 143, 0, 0},
+    {3003, 144, 0, 0},
+    {17, 145, 0, 0},
+    {9, 146, 0, 0},
+    {9, 147, 0, 0},
+    {9, 148, 0, 0},
+    {9, 149, 0, 0},
+    {9, 150, 0, 0},
+    {9, 151, 0, 0},
+    {9, 152, 0, 0},
+    {9, 153, 0, 0},
+    {9, 154, 0, 0},
+    {9, 155, 0, 0},
+    {9, 156, 0, 0},
+    {9, 157, 0, 0},
+    {9, 158, 0, 0},
+    {9, 159, 0, 0},
+    {9, 160, 0, 0},
+    {9, 161, 0, 0},
+    {9, 162, 0, 0},
+    {9, 163, 0, 0},
+    {9, 164, 0, 0},
+    {3005, 165, 0, 0},
+    {3005, 166, 0, 0},
+    {3005, 167, 0, 0},
+    {2048, 168, 0, 0},
+    {2048, 169, 0, 0},
+    {9, 170, 0, 0},
+    {9, 171, 0, 0},
+    {9, 172, 0, 0},
+    {9, 173, 0, 0},
+    {9, 174, 0, 0},
+    {9, 175, 0, 0},
+    {9, 176, 0, 0},
+    {9, 177, 0, 0},
+    {9, 178, 0, 0},
+    {9, 179, 0, 0},
+    {9, 180, 0, 0},
+    {9, 181, 0, 0},
+    {9, 182, 0, 0},
+    {9, 183, 0, 0},
+    {9, 184, 0, 0},
+    {3003, 185, 0, 0},
+    {3003, 186, 0, 0},
+    {3003, 187, 0, 0},
+    {2013, 188, 0, 0},
+    {58, 189, 0, 0},
+    {58, 190, 0, 0},
+    {58, 191, 0, 0},
+    {58, 192, 0, 0},
+    {2012, 193, 0, 0},
+    {14, 194, 0, 0},
+    {3001, 195, 0, 0},
+    {3001, 196, 0, 0},
+    // Hell Beneath (E4M1)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {45, 4, 0, 0},
+    {45, 5, 0, 0},
+    {38, 6, 0, 0},
+    {14, 7, 0, 0},
+    {9, 8, 0, 0},
+    {9, 9, 0, 0},
+    {9, 10, 0, 0},
+    {9, 11, 0, 0},
+    {14, 12, 0, 0},
+    {9, 13, 0, 0},
+    {9, 14, 0, 0},
+    {9, 15, 0, 0},
+    {9, 16, 0, 0},
+    {3001, 17, 0, 0},
+    {3001, 18, 0, 0},
+    {3001, 19, 0, 0},
+    {3001, 20, 0, 0},
+    {58, 21, 0, 0},
+    {58, 22, 0, 0},
+    {2003, 23, 0, 0},
+    {2046, 24, 0, 0},
+    {2046, 25, 0, 0},
+    {46, 26, 0, 0},
+    {46, 27, 0, 0},
+    {14, 28, 0, 0},
+    {3003, 29, 0, 0},
+    {3003, 30, 0, 0},
+    {3003, 31, 0, 0},
+    {3003, 32, 0, 0},
+    {40, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3001, 38, 0, 0},
+    {58, 39, 0, 0},
+    {58, 40, 0, 0},
+    {58, 41, 0, 0},
+    {58, 42, 0, 0},
+    {58, 43, 0, 0},
+    {58, 44, 0, 0},
+    {3001, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {2001, 47, 0, 0},
+    {2008, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3001, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {3001, 54, 0, 0},
+    {45, 55, 0, 0},
+    {14, 56, 0, 0},
+    {14, 57, 0, 0},
+    {2013, 58, 0, 0},
+    {2018, 59, 0, 0},
+    {2012, 60, 0, 0},
+    {2012, 61, 0, 0},
+    {9, 62, 0, 0},
+    {9, 63, 0, 0},
+    {9, 64, 0, 0},
+    {3001, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {3001, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {3001, 73, 0, 0},
+    {9, 74, 0, 0},
+    {9, 75, 0, 0},
+    {58, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {14, 80, 0, 0},
+    {9, 81, 0, 0},
+    {9, 82, 0, 0},
+    {9, 83, 0, 0},
+    {9, 84, 0, 0},
+    {9, 85, 0, 0},
+    {9, 86, 0, 0},
+    {3003, 87, 0, 0},
+    {2012, 88, 0, 0},
+    {2012, 89, 0, 0},
+    {2018, 90, 0, 0},
+    {9, 91, 0, 0},
+    {14, 92, 0, 0},
+    {45, 93, 0, 0},
+    {45, 94, 0, 0},
+    {2008, 95, 0, 0},
+    {2008, 96, 0, 0},
+    {2002, 97, 0, 0},
+    {2007, 98, 0, 0},
+    {24, 99, 0, 0},
+    {24, 100, 0, 0},
+    {24, 101, 0, 0},
+    {24, 102, 0, 0},
+    {24, 103, 0, 0},
+    {24, 104, 0, 0},
+    {24, 105, 0, 0},
+    {60, 106, 0, 0},
+    {60, 107, 0, 0},
+    {62, 108, 0, 0},
+    {62, 109, 0, 0},
+    {24, 110, 0, 0},
+    {24, 111, 0, 0},
+    {11, 112, 0, 0},
+    {11, 113, 0, 0},
+    {11, 114, 0, 0},
+    {11, 115, 0, 0},
+    {2023, 116, 0, 0},
+    {2024, 117, 0, 0},
+    {2004, 118, 0, 0},
+    {2015, 119, 0, 0},
+    {2015, 120, 0, 0},
+    {2015, 121, 0, 0},
+    {2015, 122, 0, 0},
+    {2015, 123, 0, 0},
+    {2015, 124, 0, 0},
+    {2015, 125, 0, 0},
+    {2015, 126, 0, 0},
+    {2015, 127, 0, 0},
+    {2015, 128, 0, 0},
+    {2015, 129, 0, 0},
+    {2015, 130, 0, 0},
+    {2014, 131, 0, 0},
+    {2014, 132, 0, 0},
+    {2014, 133, 0, 0},
+    {2014, 134, 0, 0},
+    {2014, 135, 0, 0},
+    {2014, 136, 0, 0},
+    {2014, 137, 0, 0},
+    {2014, 138, 0, 0},
+    {2014, 139, 0, 0},
+    {2025, 140, 0, 0},
+    // Perfect Hatred (E4M2)
+    {1, 0, 0, 0},
+    {57, 1, 0, 0},
+    {57, 2, 0, 0},
+    {56, 3, 0, 0},
+    {56, 4, 0, 0},
+    {2004, 5, 0, 0},
+    {2011, 6, 0, 0},
+    {2025, 7, 0, 0},
+    {46, 8, 0, 0},
+    {46, 9, 0, 0},
+    {2001, 10, 0, 0},
+    {2049, 11, 0, 0},
+    {2047, 12, 0, 0},
+    {17, 13, 0, 0},
+    {2023, 14, 0, 0},
+    {14, 15, 0, 0},
+    {2025, 16, 0, 0},
+    {2013, 17, 0, 0},
+    {45, 18, 0, 0},
+    {45, 19, 0, 0},
+    {2019, 20, 0, 0},
+    {14, 21, 0, 0},
+    {3003, 22, 0, 0},
+    {17, 23, 0, 0},
+    {3003, 24, 0, 0},
+    {3003, 25, 0, 0},
+    {3003, 26, 0, 0},
+    {17, 27, 0, 0},
+    {2012, 28, 0, 0},
+    {39, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {9, 32, 0, 0},
+    {9, 33, 0, 0},
+    {9, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3001, 38, 0, 0},
+    {3003, 39, 0, 0},
+    {3003, 40, 0, 0},
+    {9, 41, 0, 0},
+    {9, 42, 0, 0},
+    {9, 43, 0, 0},
+    {9, 44, 0, 0},
+    {9, 45, 0, 0},
+    {2018, 46, 0, 0},
+    {2012, 47, 0, 0},
+    {2049, 48, 0, 0},
+    {2014, 49, 0, 0},
+    {2014, 50, 0, 0},
+    {2014, 51, 0, 0},
+    {2014, 52, 0, 0},
+    {2014, 53, 0, 0},
+    {2014, 54, 0, 0},
+    {2015, 55, 0, 0},
+    {2015, 56, 0, 0},
+    {2015, 57, 0, 0},
+    {2015, 58, 0, 0},
+    {2015, 59, 0, 0},
+    {2015, 60, 0, 0},
+    {2015, 61, 0, 0},
+    {2015, 62, 0, 0},
+    {2015, 63, 0, 0},
+    {2015, 64, 0, 0},
+    {2015, 65, 0, 0},
+    {2015, 66, 0, 0},
+    {2015, 67, 0, 0},
+    {2015, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {3001, 73, 0, 0},
+    {58, 74, 0, 0},
+    {9, 75, 0, 0},
+    {9, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3001, 81, 0, 0},
+    {3001, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3002, 84, 0, 0},
+    {3002, 85, 0, 0},
+    {3006, 86, 0, 0},
+    {3006, 87, 0, 0},
+    {3006, 88, 0, 0},
+    {3006, 89, 0, 0},
+    {3003, 90, 0, 0},
+    {3003, 91, 0, 0},
+    {3003, 92, 0, 0},
+    {2003, 93, 0, 0},
+    {2046, 94, 0, 0},
+    {2046, 95, 0, 0},
+    {2046, 96, 0, 0},
+    {2035, 97, 0, 0},
+    {2035, 98, 0, 0},
+    {16, 99, 0, 0},
+    {14, 100, 0, 0},
+    {3005, 101, 0, 0},
+    {3005, 102, 0, 0},
+    {3005, 103, 0, 0},
+    {3005, 104, 0, 0},
+    {3005, 105, 0, 0},
+    {3005, 106, 0, 0},
+    {2047, 107, 0, 0},
+    {2047, 108, 0, 0},
+    {2047, 109, 0, 0},
+    {2047, 110, 0, 0},
+    {2049, 111, 0, 0},
+    {2047, 112, 0, 0},
+    {2049, 113, 0, 0},
+    {2047, 114, 0, 0},
+    {2047, 115, 0, 0},
+    {2049, 116, 0, 0},
+    {2049, 117, 0, 0},
+    {2049, 118, 0, 0},
+    {2049, 119, 0, 0},
+    {3005, 120, 0, 0},
+    {58, 121, 0, 0},
+    {58, 122, 0, 0},
+    {58, 123, 0, 0},
+    {58, 124, 0, 0},
+    {58, 125, 0, 0},
+    {2005, 126, 0, 0},
+    {58, 127, 0, 0},
+    {58, 128, 0, 0},
+    {58, 129, 0, 0},
+    {58, 130, 0, 0},
+    {3005, 131, 0, 0},
+    {3005, 132, 0, 0},
+    {3003, 133, 0, 0},
+    {3003, 134, 0, 0},
+    {17, 135, 0, 0},
+    {17, 136, 0, 0},
+    {17, 137, 0, 0},
+    {17, 138, 0, 0},
+    {17, 139, 0, 0},
+    {3006, 140, 0, 0},
+    {3006, 141, 0, 0},
+    {3006, 142, 0, 0},
+    {3006, 143, 0, 0},
+    {3006, 144, 0, 0},
+    {3006, 145, 0, 0},
+    {3006, 146, 0, 0},
+    {3006, 147, 0, 0},
+    {3006, 148, 0, 0},
+    {3006, 149, 0, 0},
+    {3006, 150, 0, 0},
+    {2018, 151, 0, 0},
+    {56, 152, 0, 0},
+    {56, 153, 0, 0},
+    {47, 154, 0, 0},
+    {47, 155, 0, 0},
+    {47, 156, 0, 0},
+    {47, 157, 0, 0},
+    {47, 158, 0, 0},
+    {47, 159, 0, 0},
+    {47, 160, 0, 0},
+    {47, 161, 0, 0},
+    {47, 162, 0, 0},
+    {47, 163, 0, 0},
+    {47, 164, 0, 0},
+    {47, 165, 0, 0},
+    {47, 166, 0, 0},
+    {40, 167, 0, 0},
+    {2012, 168, 0, 0},
+    {2012, 169, 0, 0},
+    {2012, 170, 0, 0},
+    {2012, 171, 0, 0},
+    {2012, 172, 0, 0},
+    {2012, 173, 0, 0},
+    {2012, 174, 0, 0},
+    {2012, 175, 0, 0},
+    {2012, 176, 0, 0},
+    {36, 177, 0, 0},
+    {41, 178, 0, 0},
+    {37, 179, 0, 0},
+    {41, 180, 0, 0},
+    {57, 181, 0, 0},
+    {57, 182, 0, 0},
+    {55, 183, 0, 0},
+    {55, 184, 0, 0},
+    {3002, 185, 0, 0},
+    {3002, 186, 0, 0},
+    {3002, 187, 0, 0},
+    {3002, 188, 0, 0},
+    {3002, 189, 0, 0},
+    {3002, 190, 0, 0},
+    {3005, 191, 0, 0},
+    {3005, 192, 0, 0},
+    {3005, 193, 0, 0},
+    {3005, 194, 0, 0},
+    {3005, 195, 0, 0},
+    {3005, 196, 0, 0},
+    {3005, 197, 0, 0},
+    {3005, 198, 0, 0},
+    {2046, 199, 0, 0},
+    {2046, 200, 0, 0},
+    {2046, 201, 0, 0},
+    {2046, 202, 0, 0},
+    {2046, 203, 0, 0},
+    {2046, 204, 0, 0},
+    {17, 205, 0, 0},
+    {17, 206, 0, 0},
+    {17, 207, 0, 0},
+    {2012, 208, 0, 0},
+    {2012, 209, 0, 0},
+    {2012, 210, 0, 0},
+    {2012, 211, 0, 0},
+    {35, 212, 0, 0},
+    {35, 213, 0, 0},
+    {2025, 214, 0, 0},
+    {2025, 215, 0, 0},
+    {14, 216, 0, 0},
+    {2006, 217, 0, 0},
+    {11, 218, 0, 0},
+    {11, 219, 0, 0},
+    {11, 220, 0, 0},
+    {11, 221, 0, 0},
+    {11, 222, 0, 0},
+    {3003, 223, 0, 0},
+    {2, 224, 0, 0},
+    {3, 225, 0, 0},
+    {4, 226, 0, 0},
+    // Sever the Wicked (E4M3)
+    {11, 0, 0, 0},
+    {3, 1, 0, 0},
+    {4, 2, 0, 0},
+    {1, 3, 0, 0},
+    {2047, 4, 0, 0},
+    {2047, 5, 0, 0},
+    {2047, 6, 0, 0},
+    {17, 7, 0, 0},
+    {2046, 8, 0, 0},
+    {2022, 9, 0, 0},
+    {46, 10, 0, 0},
+    {46, 11, 0, 0},
+    {2025, 12, 0, 0},
+    {44, 13, 0, 0},
+    {44, 14, 0, 0},
+    {44, 15, 0, 0},
+    {44, 16, 0, 0},
+    {44, 17, 0, 0},
+    {44, 18, 0, 0},
+    {44, 19, 0, 0},
+    {44, 20, 0, 0},
+    {2023, 21, 0, 0},
+    {2024, 22, 0, 0},
+    {8, 23, 0, 0},
+    {2, 24, 0, 0},
+    {2004, 25, 0, 0},
+    {14, 26, 0, 0},
+    {38, 27, 0, 0},
+    {40, 28, 0, 0},
+    {8, 29, 0, 0},
+    {2010, 30, 0, 0},
+    {2010, 31, 0, 0},
+    {2049, 32, 0, 0},
+    {2049, 33, 0, 0},
+    {2008, 34, 0, 0},
+    {2008, 35, 0, 0},
+    {2008, 36, 0, 0},
+    {2008, 37, 0, 0},
+    {2005, 38, 0, 0},
+    {2019, 39, 0, 0},
+    {2011, 40, 0, 0},
+    {2011, 41, 0, 0},
+    {9, 42, 0, 0},
+    {9, 43, 0, 0},
+    {9, 44, 0, 0},
+    {9, 45, 0, 0},
+    {9, 46, 0, 0},
+    {9, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {9, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3005, 52, 0, 0},
+    {9, 53, 0, 0},
+    {9, 54, 0, 0},
+    {9, 55, 0, 0},
+    {2012, 56, 0, 0},
+    {9, 57, 0, 0},
+    {9, 58, 0, 0},
+    {3004, 59, 0, 0},
+    {3004, 60, 0, 0},
+    {3004, 61, 0, 0},
+    {3004, 62, 0, 0},
+    {3004, 63, 0, 0},
+    {3004, 64, 0, 0},
+    {3001, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {3001, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3003, 70, 0, 0},
+    {9, 71, 0, 0},
+    {9, 72, 0, 0},
+    {9, 73, 0, 0},
+    {9, 74, 0, 0},
+    {3001, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {9, 79, 0, 0},
+    {9, 80, 0, 0},
+    {9, 81, 0, 0},
+    {3001, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {9, 85, 0, 0},
+    {9, 86, 0, 0},
+    {3001, 87, 0, 0},
+    {3001, 88, 0, 0},
+    {3001, 89, 0, 0},
+    {3001, 90, 0, 0},
+    {9, 91, 0, 0},
+    {9, 92, 0, 0},
+    {2024, 93, 0, 0},
+    {2013, 94, 0, 0},
+    {2019, 95, 0, 0},
+    {2022, 96, 0, 0},
+    {2049, 97, 0, 0},
+    {2049, 98, 0, 0},
+    {2049, 99, 0, 0},
+    {2049, 100, 0, 0},
+    {2049, 101, 0, 0},
+    {2049, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3001, 105, 0, 0},
+    {3001, 106, 0, 0},
+    {2046, 107, 0, 0},
+    {2046, 108, 0, 0},
+    {2046, 109, 0, 0},
+    {2046, 110, 0, 0},
+    {2046, 111, 0, 0},
+    {2046, 112, 0, 0},
+    {2047, 113, 0, 0},
+    {2046, 114, 0, 0},
+    {2046, 115, 0, 0},
+    {2046, 116, 0, 0},
+    {2047, 117, 0, 0},
+    {2047, 118, 0, 0},
+    {2047, 119, 0, 0},
+    {2047, 120, 0, 0},
+    {2047, 121, 0, 0},
+    {2047, 122, 0, 0},
+    {2047, 123, 0, 0},
+    {2014, 124, 0, 0},
+    {2014, 125, 0, 0},
+    {2014, 126, 0, 0},
+    {2014, 127, 0, 0},
+    {2014, 128, 0, 0},
+    {2014, 129, 0, 0},
+    {2014, 130, 0, 0},
+    {2014, 131, 0, 0},
+    {2014, 132, 0, 0},
+    {2014, 133, 0, 0},
+    {2014, 134, 0, 0},
+    {2014, 135, 0, 0},
+    {2014, 136, 0, 0},
+    {2014, 137, 0, 0},
+    {2014, 138, 0, 0},
+    {2014, 139, 0, 0},
+    {2014, 140, 0, 0},
+    {2014, 141, 0, 0},
+    {2014, 142, 0, 0},
+    {2014, 143, 0, 0},
+    {2014, 144, 0, 0},
+    {2014, 145, 0, 0},
+    {2014, 146, 0, 0},
+    {2014, 147, 0, 0},
+    {2014, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {2014, 150, 0, 0},
+    {2014, 151, 0, 0},
+    {2014, 152, 0, 0},
+    {2014, 153, 0, 0},
+    {2014, 154, 0, 0},
+    {2014, 155, 0, 0},
+    {2014, 156, 0, 0},
+    {2004, 157, 0, 0},
+    {9, 158, 0, 0},
+    {9, 159, 0, 0},
+    {9, 160, 0, 0},
+    {3002, 161, 0, 0},
+    {3001, 162, 0, 0},
+    {3001, 163, 0, 0},
+    {3001, 164, 0, 0},
+    {9, 165, 0, 0},
+    {9, 166, 0, 0},
+    {9, 167, 0, 0},
+    {9, 168, 0, 0},
+    {58, 169, 0, 0},
+    {58, 170, 0, 0},
+    {58, 171, 0, 0},
+    {3006, 172, 0, 0},
+    {3006, 173, 0, 0},
+    {3002, 174, 0, 0},
+    {3002, 175, 0, 0},
+    {3002, 176, 0, 0},
+    {3002, 177, 0, 0},
+    {2002, 178, 0, 0},
+    {2012, 179, 0, 0},
+    {2012, 180, 0, 0},
+    {2048, 181, 0, 0},
+    {2048, 182, 0, 0},
+    {2048, 183, 0, 0},
+    {2048, 184, 0, 0},
+    {2001, 185, 0, 0},
+    {2008, 186, 0, 0},
+    {2008, 187, 0, 0},
+    {2008, 188, 0, 0},
+    {2008, 189, 0, 0},
+    {2006, 190, 0, 0},
+    {17, 191, 0, 0},
+    {17, 192, 0, 0},
+    {3001, 193, 0, 0},
+    {3001, 194, 0, 0},
+    {3001, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {3001, 197, 0, 0},
+    {3001, 198, 0, 0},
+    {3001, 199, 0, 0},
+    {3001, 200, 0, 0},
+    {3006, 201, 0, 0},
+    {3006, 202, 0, 0},
+    {3006, 203, 0, 0},
+    {3006, 204, 0, 0},
+    {3006, 205, 0, 0},
+    {3006, 206, 0, 0},
+    {3006, 207, 0, 0},
+    {3006, 208, 0, 0},
+    {3002, 209, 0, 0},
+    {58, 210, 0, 0},
+    {58, 211, 0, 0},
+    {9, 212, 0, 0},
+    {9, 213, 0, 0},
+    {9, 214, 0, 0},
+    {9, 215, 0, 0},
+    {3003, 216, 0, 0},
+    {3005, 217, 0, 0},
+    {9, 218, 0, 0},
+    {9, 219, 0, 0},
+    {2048, 220, 0, 0},
+    {2048, 221, 0, 0},
+    {2048, 222, 0, 0},
+    {2048, 223, 0, 0},
+    {2048, 224, 0, 0},
+    {2048, 225, 0, 0},
+    {2048, 226, 0, 0},
+    {2010, 227, 0, 0},
+    {2010, 228, 0, 0},
+    {2010, 229, 0, 0},
+    {2010, 230, 0, 0},
+    {2010, 231, 0, 0},
+    {2010, 232, 0, 0},
+    {2010, 233, 0, 0},
+    {3006, 234, 0, 0},
+    {3006, 235, 0, 0},
+    {3005, 236, 0, 0},
+    {3005, 237, 0, 0},
+    {3003, 238, 0, 0},
+    {3003, 239, 0, 0},
+    {3001, 240, 0, 0},
+    {9, 241, 0, 0},
+    {9, 242, 0, 0},
+    {9, 243, 0, 0},
+    {9, 244, 0, 0},
+    {9, 245, 0, 0},
+    {3004, 246, 0, 0},
+    {3004, 247, 0, 0},
+    {3004, 248, 0, 0},
+    {3004, 249, 0, 0},
+    {9, 250, 0, 0},
+    {9, 251, 0, 0},
+    {9, 252, 0, 0},
+    {9, 253, 0, 0},
+    {2001, 254, 0, 0},
+    {2049, 255, 0, 0},
+    {3001, 256, 0, 0},
+    {3001, 257, 0, 0},
+    {3001, 258, 0, 0},
+    {3001, 259, 0, 0},
+    {3001, 260, 0, 0},
+    {3002, 261, 0, 0},
+    {3002, 262, 0, 0},
+    {9, 263, 0, 0},
+    {9, 264, 0, 0},
+    {9, 265, 0, 0},
+    {58, 266, 0, 0},
+    {58, 267, 0, 0},
+    {58, 268, 0, 0},
+    {3001, 269, 0, 0},
+    {3001, 270, 0, 0},
+    {9, 271, 0, 0},
+    {9, 272, 0, 0},
+    {9, 273, 0, 0},
+    {2012, 274, 0, 0},
+    {2012, 275, 0, 0},
+    {2012, 276, 0, 0},
+    {2012, 277, 0, 0},
+    {2007, 278, 0, 0},
+    {2007, 279, 0, 0},
+    {2007, 280, 0, 0},
+    {2007, 281, 0, 0},
+    {2007, 282, 0, 0},
+    {2007, 283, 0, 0},
+    {2007, 284, 0, 0},
+    {2008, 285, 0, 0},
+    {2008, 286, 0, 0},
+    {2008, 287, 0, 0},
+    {2008, 288, 0, 0},
+    {2008, 289, 0, 0},
+    {2008, 290, 0, 0},
+    {2008, 291, 0, 0},
+    {11, 292, 0, 0},
+    {11, 293, 0, 0},
+    {11, 294, 0, 0},
+    {46, 295, 0, 0},
+    {46, 296, 0, 0},
+    {46, 297, 0, 0},
+    {46, 298, 0, 0},
+    {2003, 299, 0, 0},
+    {2010, 300, 0, 0},
+    {2010, 301, 0, 0},
+    {2010, 302, 0, 0},
+    {2010, 303, 0, 0},
+    {2024, 304, 0, 0},
+    {14, 305, 0, 0},
+    {14, 306, 0, 0},
+    {30, 307, 0, 0},
+    {30, 308, 0, 0},
+    {30, 309, 0, 0},
+    {30, 310, 0, 0},
+    {30, 311, 0, 0},
+    {30, 312, 0, 0},
+    {30, 313, 0, 0},
+    {2012, 314, 0, 0},
+    {2012, 315, 0, 0},
+    {2046, 316, 0, 0},
+    {2046, 317, 0, 0},
+    {2046, 318, 0, 0},
+    {2046, 319, 0, 0},
+    {2012, 320, 0, 0},
+    {2012, 321, 0, 0},
+    {58, 322, 0, 0},
+    {58, 323, 0, 0},
+    {3005, 324, 0, 0},
+    {3005, 325, 0, 0},
+    {3003, 326, 0, 0},
+    {3003, 327, 0, 0},
+    {58, 328, 0, 0},
+    {49, 329, 0, 0},
+    {44, 330, 0, 0},
+    {44, 331, 0, 0},
+    {44, 332, 0, 0},
+    {44, 333, 0, 0},
+    {44, 334, 0, 0},
+    {44, 335, 0, 0},
+    {44, 336, 0, 0},
+    {2008, 337, 0, 0},
+    {2010, 338, 0, 0},
+    {2008, 339, 0, 0},
+    {2010, 340, 0, 0},
+    {2008, 341, 0, 0},
+    {2008, 342, 0, 0},
+    {2010, 343, 0, 0},
+    {2008, 344, 0, 0},
+    {2010, 345, 0, 0},
+    {2008, 346, 0, 0},
+    {9, 347, 0, 0},
+    {3001, 348, 0, 0},
+    {9, 349, 0, 0},
+    {58, 350, 0, 0},
+    {3001, 351, 0, 0},
+    {58, 352, 0, 0},
+    {44, 353, 0, 0},
+    {52, 354, 0, 0},
+    {51, 355, 0, 0},
+    {27, 356, 0, 0},
+    {58, 357, 0, 0},
+    {58, 358, 0, 0},
+    {9, 359, 0, 0},
+    {9, 360, 0, 0},
+    {9, 361, 0, 0},
+    {2011, 362, 0, 0},
+    {2011, 363, 0, 0},
+    {2011, 364, 0, 0},
+    {2011, 365, 0, 0},
+    {2003, 366, 0, 0},
+    {2046, 367, 0, 0},
+    {3003, 368, 0, 0},
+    {58, 369, 0, 0},
+    {58, 370, 0, 0},
+    {9, 371, 0, 0},
+    {9, 372, 0, 0},
+    {9, 373, 0, 0},
+    {9, 374, 0, 0},
+    {2046, 375, 0, 0},
+    {2046, 376, 0, 0},
+    {2046, 377, 0, 0},
+    {2046, 378, 0, 0},
+    {2046, 379, 0, 0},
+    {2046, 380, 0, 0},
+    {2046, 381, 0, 0},
+    {2046, 382, 0, 0},
+    {2046, 383, 0, 0},
+    // Unruly Evil (E4M4)
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {46, 4, 0, 0},
+    {46, 5, 0, 0},
+    {46, 6, 0, 0},
+    {14, 7, 0, 0},
+    {45, 8, 0, 0},
+    {2003, 9, 0, 0},
+    {2046, 10, 0, 0},
+    {2046, 11, 0, 0},
+    {2046, 12, 0, 0},
+    {2004, 13, 0, 0},
+    {17, 14, 0, 0},
+    {2023, 15, 0, 0},
+    {38, 16, 0, 0},
+    {3001, 17, 0, 0},
+    {3001, 18, 0, 0},
+    {3001, 19, 0, 0},
+    {3001, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {3001, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {9, 24, 0, 0},
+    {9, 25, 0, 0},
+    {46, 26, 0, 0},
+    {46, 27, 0, 0},
+    {46, 28, 0, 0},
+    {46, 29, 0, 0},
+    {3002, 30, 0, 0},
+    {3002, 31, 0, 0},
+    {3002, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3001, 36, 0, 0},
+    {3001, 37, 0, 0},
+    {3001, 38, 0, 0},
+    {3001, 39, 0, 0},
+    {58, 40, 0, 0},
+    {58, 41, 0, 0},
+    {58, 42, 0, 0},
+    {9, 43, 0, 0},
+    {9, 44, 0, 0},
+    {9, 45, 0, 0},
+    {9, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {3001, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3001, 50, 0, 0},
+    {3001, 51, 0, 0},
+    {3001, 52, 0, 0},
+    {3001, 53, 0, 0},
+    {3001, 54, 0, 0},
+    {2013, 55, 0, 0},
+    {2002, 56, 0, 0},
+    {2007, 57, 0, 0},
+    {2048, 58, 0, 0},
+    {2012, 59, 0, 0},
+    {2012, 60, 0, 0},
+    {2001, 61, 0, 0},
+    {2008, 62, 0, 0},
+    {2049, 63, 0, 0},
+    {14, 64, 0, 0},
+    {14, 65, 0, 0},
+    {2008, 66, 0, 0},
+    {2006, 67, 0, 0},
+    {2024, 68, 0, 0},
+    {2001, 69, 0, 0},
+    {11, 70, 0, 0},
+    {11, 71, 0, 0},
+    {11, 72, 0, 0},
+    {11, 73, 0, 0},
+    {11, 74, 0, 0},
+    {11, 75, 0, 0},
+    {2019, 76, 0, 0},
+    {2010, 77, 0, 0},
+    {2010, 78, 0, 0},
+    {2010, 79, 0, 0},
+    {2010, 80, 0, 0},
+    {2022, 81, 0, 0},
+    {2012, 82, 0, 0},
+    {2012, 83, 0, 0},
+    {14, 84, 0, 0},
+    {2008, 85, 0, 0},
+    {9, 86, 0, 0},
+    {9, 87, 0, 0},
+    {9, 88, 0, 0},
+    {9, 89, 0, 0},
+    {9, 90, 0, 0},
+    {9, 91, 0, 0},
+    {3001, 92, 0, 0},
+    {3001, 93, 0, 0},
+    {3001, 94, 0, 0},
+    {3001, 95, 0, 0},
+    {3001, 96, 0, 0},
+    {3001, 97, 0, 0},
+    {3001, 98, 0, 0},
+    {3001, 99, 0, 0},
+    {3001, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {3001, 102, 0, 0},
+    {3005, 103, 0, 0},
+    {3005, 104, 0, 0},
+    {3005, 105, 0, 0},
+    {58, 106, 0, 0},
+    {58, 107, 0, 0},
+    {3005, 108, 0, 0},
+    {3005, 109, 0, 0},
+    {58, 110, 0, 0},
+    {58, 111, 0, 0},
+    {2008, 112, 0, 0},
+    {2012, 113, 0, 0},
+    {2012, 114, 0, 0},
+    {2022, 115, 0, 0},
+    {2013, 116, 0, 0},
+    {2007, 117, 0, 0},
+    {2007, 118, 0, 0},
+    {2023, 119, 0, 0},
+    {46, 120, 0, 0},
+    {46, 121, 0, 0},
+    {46, 122, 0, 0},
+    {46, 123, 0, 0},
+    {2025, 124, 0, 0},
+    {2015, 125, 0, 0},
+    {2015, 126, 0, 0},
+    {2015, 127, 0, 0},
+    {2015, 128, 0, 0},
+    {2015, 129, 0, 0},
+    {2015, 130, 0, 0},
+    {2015, 131, 0, 0},
+    {2015, 132, 0, 0},
+    {3005, 133, 0, 0},
+    {3005, 134, 0, 0},
+    {14, 135, 0, 0},
+    {17, 136, 0, 0},
+    {2046, 137, 0, 0},
+    {2025, 138, 0, 0},
+    {2012, 139, 0, 0},
+    {2012, 140, 0, 0},
+    {2012, 141, 0, 0},
+    {2014, 142, 0, 0},
+    {2014, 143, 0, 0},
+    {2014, 144, 0, 0},
+    {2014, 145, 0, 0},
+    {2014, 146, 0, 0},
+    {2014, 147, 0, 0},
+    {2014, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {2014, 150, 0, 0},
+    {2014, 151, 0, 0},
+    {2014, 152, 0, 0},
+    // They Will Repent (E4M5)
+    {1, 0, 0, 0},
+    {14, 1, 0, 0},
+    {14, 2, 0, 0},
+    {46, 3, 0, 0},
+    {46, 4, 0, 0},
+    {46, 5, 0, 0},
+    {35, 6, 0, 0},
+    {35, 7, 0, 0},
+    {14, 8, 0, 0},
+    {14, 9, 0, 0},
+    {46, 10, 0, 0},
+    {46, 11, 0, 0},
+    {46, 12, 0, 0},
+    {46, 13, 0, 0},
+    {46, 14, 0, 0},
+    {46, 15, 0, 0},
+    {46, 16, 0, 0},
+    {39, 17, 0, 0},
+    {33, 18, 0, 0},
+    {33, 19, 0, 0},
+    {38, 20, 0, 0},
+    {40, 21, 0, 0},
+    {46, 22, 0, 0},
+    {2, 23, 0, 0},
+    {3, 24, 0, 0},
+    {4, 25, 0, 0},
+    {11, 26, 0, 0},
+    {11, 27, 0, 0},
+    {11, 28, 0, 0},
+    {11, 29, 0, 0},
+    {11, 30, 0, 0},
+    {2006, 31, 0, 0},
+    {3004, 32, 0, 0},
+    {3004, 33, 0, 0},
+    {9, 34, 0, 0},
+    {3002, 35, 0, 0},
+    {3004, 36, 0, 0},
+    {3004, 37, 0, 0},
+    {3004, 38, 0, 0},
+    {9, 39, 0, 0},
+    {3004, 40, 0, 0},
+    {9, 41, 0, 0},
+    {3006, 42, 0, 0},
+    {3006, 43, 0, 0},
+    {3001, 44, 0, 0},
+    {3001, 45, 0, 0},
+    {3001, 46, 0, 0},
+    {3001, 47, 0, 0},
+    {9, 48, 0, 0},
+    {3001, 49, 0, 0},
+    {3004, 50, 0, 0},
+    {3004, 51, 0, 0},
+    {9, 52, 0, 0},
+    {58, 53, 0, 0},
+    {58, 54, 0, 0},
+    {3006, 55, 0, 0},
+    {3006, 56, 0, 0},
+    {3001, 57, 0, 0},
+    {3004, 58, 0, 0},
+    {3002, 59, 0, 0},
+    {3002, 60, 0, 0},
+    {3004, 61, 0, 0},
+    {3004, 62, 0, 0},
+    {3004, 63, 0, 0},
+    {3004, 64, 0, 0},
+    {3001, 65, 0, 0},
+    {3002, 66, 0, 0},
+    {3006, 67, 0, 0},
+    {3006, 68, 0, 0},
+    {3001, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {3004, 73, 0, 0},
+    {9, 74, 0, 0},
+    {3004, 75, 0, 0},
+    {3001, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3002, 78, 0, 0},
+    {3004, 79, 0, 0},
+    {3004, 80, 0, 0},
+    {9, 81, 0, 0},
+    {58, 82, 0, 0},
+    {58, 83, 0, 0},
+    {3006, 84, 0, 0},
+    {9, 85, 0, 0},
+    {3004, 86, 0, 0},
+    {3004, 87, 0, 0},
+    {3006, 88, 0, 0},
+    {3002, 89, 0, 0},
+    {3002, 90, 0, 0},
+    {11, 91, 0, 0},
+    {2003, 92, 0, 0},
+    {9, 93, 0, 0},
+    {3004, 94, 0, 0},
+    {9, 95, 0, 0},
+    {3006, 96, 0, 0},
+    {3006, 97, 0, 0},
+    {3006, 98, 0, 0},
+    {2008, 99, 0, 0},
+    {2008, 100, 0, 0},
+    {2008, 101, 0, 0},
+    {2035, 102, 0, 0},
+    {2035, 103, 0, 0},
+    {2035, 104, 0, 0},
+    {2035, 105, 0, 0},
+    {2035, 106, 0, 0},
+    {2035, 107, 0, 0},
+    {2035, 108, 0, 0},
+    {2035, 109, 0, 0},
+    {2035, 110, 0, 0},
+    {2035, 111, 0, 0},
+    {2035, 112, 0, 0},
+    {2035, 113, 0, 0},
+    {2035, 114, 0, 0},
+    {2035, 115, 0, 0},
+    {2035, 116, 0, 0},
+    {2035, 117, 0, 0},
+    {2035, 118, 0, 0},
+    {25, 119, 0, 0},
+    {2035, 120, 0, 0},
+    {2035, 121, 0, 0},
+    {2035, 122, 0, 0},
+    {2035, 123, 0, 0},
+    {2035, 124, 0, 0},
+    {2035, 125, 0, 0},
+    {2035, 126, 0, 0},
+    {2035, 127, 0, 0},
+    {2035, 128, 0, 0},
+    {2035, 129, 0, 0},
+    {2035, 130, 0, 0},
+    {2035, 131, 0, 0},
+    {2035, 132, 0, 0},
+    {2035, 133, 0, 0},
+    {2035, 134, 0, 0},
+    {2035, 135, 0, 0},
+    {15, 136, 0, 0},
+    {2002, 137, 0, 0},
+    {2011, 138, 0, 0},
+    {2011, 139, 0, 0},
+    {2003, 140, 0, 0},
+    {2008, 141, 0, 0},
+    {2008, 142, 0, 0},
+    {2008, 143, 0, 0},
+    {2008, 144, 0, 0},
+    {2012, 145, 0, 0},
+    {2011, 146, 0, 0},
+    {2014, 147, 0, 0},
+    {2014, 148, 0, 0},
+    {2014, 149, 0, 0},
+    {2014, 150, 0, 0},
+    {24, 151, 0, 0},
+    {2015, 152, 0, 0},
+    {2015, 153, 0, 0},
+    {2015, 154, 0, 0},
+    {2018, 155, 0, 0},
+    {2035, 156, 0, 0},
+    {2035, 157, 0, 0},
+    {2035, 158, 0, 0},
+    {2048, 159, 0, 0},
+    {2014, 160, 0, 0},
+    {2007, 161, 0, 0},
+    {2008, 162, 0, 0},
+    {2014, 163, 0, 0},
+    {2014, 164, 0, 0},
+    {2014, 165, 0, 0},
+    {2014, 166, 0, 0},
+    {2014, 167, 0, 0},
+    {2014, 168, 0, 0},
+    {3004, 169, 0, 0},
+    {2015, 170, 0, 0},
+    {2015, 171, 0, 0},
+    {2015, 172, 0, 0},
+    {2014, 173, 0, 0},
+    {2014, 174, 0, 0},
+    {2014, 175, 0, 0},
+    {49, 176, 0, 0},
+    {2004, 177, 0, 0},
+    {2047, 178, 0, 0},
+    {2011, 179, 0, 0},
+    {2011, 180, 0, 0},
+    {24, 181, 0, 0},
+    {2025, 182, 0, 0},
+    {2015, 183, 0, 0},
+    {2015, 184, 0, 0},
+    {2015, 185, 0, 0},
+    {2011, 186, 0, 0},
+    {2010, 187, 0, 0},
+    {2010, 188, 0, 0},
+    {2010, 189, 0, 0},
+    {2010, 190, 0, 0},
+    {2010, 191, 0, 0},
+    {2010, 192, 0, 0},
+    {2013, 193, 0, 0},
+    {2025, 194, 0, 0},
+    {2011, 195, 0, 0},
+    {2011, 196, 0, 0},
+    {2048, 197, 0, 0},
+    {2047, 198, 0, 0},
+    {2022, 199, 0, 0},
+    {2011, 200, 0, 0},
+    {2011, 201, 0, 0},
+    {2035, 202, 0, 0},
+    {2035, 203, 0, 0},
+    {2035, 204, 0, 0},
+    {2035, 205, 0, 0},
+    {2035, 206, 0, 0},
+    {2014, 207, 0, 0},
+    {2014, 208, 0, 0},
+    {2014, 209, 0, 0},
+    {24, 210, 0, 0},
+    {24, 211, 0, 0},
+    {24, 212, 0, 0},
+    {3001, 213, 0, 0},
+    {3006, 214, 0, 0},
+    {3002, 215, 0, 0},
+    {3005, 216, 0, 0},
+    {2049, 217, 0, 0},
+    {3004, 218, 0, 0},
+    {3006, 219, 0, 0},
+    {2011, 220, 0, 0},
+    {3006, 221, 0, 0},
+    {3006, 222, 0, 0},
+    {3004, 223, 0, 0},
+    {3004, 224, 0, 0},
+    {3002, 225, 0, 0},
+    {3002, 226, 0, 0},
+    {3005, 227, 0, 0},
+    {3005, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {3001, 230, 0, 0},
+    {3004, 231, 0, 0},
+    {3004, 232, 0, 0},
+    {3006, 233, 0, 0},
+    {3006, 234, 0, 0},
+    {3003, 235, 0, 0},
+    {3006, 236, 0, 0},
+    {9, 237, 0, 0},
+    {9, 238, 0, 0},
+    {2011, 239, 0, 0},
+    {2012, 240, 0, 0},
+    {2049, 241, 0, 0},
+    {2010, 242, 0, 0},
+    {2010, 243, 0, 0},
+    {2010, 244, 0, 0},
+    {2012, 245, 0, 0},
+    {9, 246, 0, 0},
+    {2003, 247, 0, 0},
+    {2001, 248, 0, 0},
+    {2002, 249, 0, 0},
+    {2011, 250, 0, 0},
+    {2011, 251, 0, 0},
+    {3006, 252, 0, 0},
+    {2046, 253, 0, 0},
+    {2046, 254, 0, 0},
+    {2049, 255, 0, 0},
+    {2023, 256, 0, 0},
+    {2008, 257, 0, 0},
+    {2008, 258, 0, 0},
+    {2008, 259, 0, 0},
+    {2008, 260, 0, 0},
+    {2008, 261, 0, 0},
+    {2046, 262, 0, 0},
+    {2046, 263, 0, 0},
+    {2046, 264, 0, 0},
+    {2008, 265, 0, 0},
+    {2008, 266, 0, 0},
+    // Against Thee Wickedly (E4M6)
+    {1, 0, 0, 0},
+    {54, 1, 0, 0},
+    {43, 2, 0, 0},
+    {43, 3, 0, 0},
+    {25, 4, 0, 0},
+    {26, 5, 0, 0},
+    {15, 6, 0, 0},
+    {47, 7, 0, 0},
+    {47, 8, 0, 0},
+    {47, 9, 0, 0},
+    {47, 10, 0, 0},
+    {47, 11, 0, 0},
+    {47, 12, 0, 0},
+    {47, 13, 0, 0},
+    {47, 14, 0, 0},
+    {47, 15, 0, 0},
+    {47, 16, 0, 0},
+    {47, 17, 0, 0},
+    {54, 18, 0, 0},
+    {54, 19, 0, 0},
+    {54, 20, 0, 0},
+    {43, 21, 0, 0},
+    {43, 22, 0, 0},
+    {2, 23, 0, 0},
+    {3, 24, 0, 0},
+    {4, 25, 0, 0},
+    {46, 26, 0, 0},
+    {46, 27, 0, 0},
+    {46, 28, 0, 0},
+    {46, 29, 0, 0},
+    {2004, 30, 0, 0},
+    {2047, 31, 0, 0},
+    {2047, 32, 0, 0},
+    {2047, 33, 0, 0},
+    {2047, 34, 0, 0},
+    {2047, 35, 0, 0},
+    {57, 36, 0, 0},
+    {57, 37, 0, 0},
+    {2025, 38, 0, 0},
+    {40, 39, 0, 0},
+    {14, 40, 0, 0},
+    {14, 41, 0, 0},
+    {35, 42, 0, 0},
+    {35, 43, 0, 0},
+    {2025, 44, 0, 0},
+    {42, 45, 0, 0},
+    {42, 46, 0, 0},
+    {39, 47, 0, 0},
+    {2013, 48, 0, 0},
+    {2003, 49, 0, 0},
+    {2046, 50, 0, 0},
+    {2046, 51, 0, 0},
+    {2046, 52, 0, 0},
+    {2046, 53, 0, 0},
+    {2002, 54, 0, 0},
+    {2048, 55, 0, 0},
+    {2024, 56, 0, 0},
+    {14, 57, 0, 0},
+    {44, 58, 0, 0},
+    {44, 59, 0, 0},
+    {34, 60, 0, 0},
+    {34, 61, 0, 0},
+    {34, 62, 0, 0},
+    {34, 63, 0, 0},
+    {34, 64, 0, 0},
+    {44, 65, 0, 0},
+    {44, 66, 0, 0},
+    {46, 67, 0, 0},
+    {46, 68, 0, 0},
+    {14, 69, 0, 0},
+    {14, 70, 0, 0},
+    {14, 71, 0, 0},
+    {46, 72, 0, 0},
+    {46, 73, 0, 0},
+    {46, 74, 0, 0},
+    {46, 75, 0, 0},
+    {46, 76, 0, 0},
+    {38, 77, 0, 0},
+    {2022, 78, 0, 0},
+    {17, 79, 0, 0},
+    {17, 80, 0, 0},
+    {17, 81, 0, 0},
+    {17, 82, 0, 0},
+    {17, 83, 0, 0},
+    {17, 84, 0, 0},
+    {17, 85, 0, 0},
+    {17, 86, 0, 0},
+    {17, 87, 0, 0},
+    {17, 88, 0, 0},
+    {2022, 89, 0, 0},
+    {16, 90, 0, 0},
+    {14, 91, 0, 0},
+    {2046, 92, 0, 0},
+    {2046, 93, 0, 0},
+    {2046, 94, 0, 0},
+    {2046, 95, 0, 0},
+    {2046, 96, 0, 0},
+    {2046, 97, 0, 0},
+    {2046, 98, 0, 0},
+    {2006, 99, 0, 0},
+    {17, 100, 0, 0},
+    {17, 101, 0, 0},
+    {8, 102, 0, 0},
+    {62, 103, 0, 0},
+    {61, 104, 0, 0},
+    {59, 105, 0, 0},
+    {59, 106, 0, 0},
+    {61, 107, 0, 0},
+    {62, 108, 0, 0},
+    {15, 109, 0, 0},
+    {15, 110, 0, 0},
+    {15, 111, 0, 0},
+    {15, 112, 0, 0},
+    {15, 113, 0, 0},
+    {15, 114, 0, 0},
+    {15, 115, 0, 0},
+    {24, 116, 0, 0},
+    {24, 117, 0, 0},
+    {24, 118, 0, 0},
+    {24, 119, 0, 0},
+    {24, 120, 0, 0},
+    {24, 121, 0, 0},
+    {12, 122, 0, 0},
+    {10, 123, 0, 0},
+    {43, 124, 0, 0},
+    {43, 125, 0, 0},
+    {46, 126, 0, 0},
+    {46, 127, 0, 0},
+    {46, 128, 0, 0},
+    {46, 129, 0, 0},
+    {45, 130, 0, 0},
+    {45, 131, 0, 0},
+    {9, 132, 0, 0},
+    {9, 133, 0, 0},
+    {9, 134, 0, 0},
+    {9, 135, 0, 0},
+    {9, 136, 0, 0},
+    {9, 137, 0, 0},
+    {9, 138, 0, 0},
+    {9, 139, 0, 0},
+    {9, 140, 0, 0},
+    {9, 141, 0, 0},
+    {9, 142, 0, 0},
+    {9, 143, 0, 0},
+    {9, 144, 0, 0},
+    {9, 145, 0, 0},
+    {9, 146, 0, 0},
+    {9, 147, 0, 0},
+    {9, 148, 0, 0},
+    {9, 149, 0, 0},
+    {9, 150, 0, 0},
+    {9, 151, 0, 0},
+    {9, 152, 0, 0},
+    {9, 153, 0, 0},
+    {9, 154, 0, 0},
+    {9, 155, 0, 0},
+    {9, 156, 0, 0},
+    {9, 157, 0, 0},
+    {9, 158, 0, 0},
+    {9, 159, 0, 0},
+    {3001, 160, 0, 0},
+    {3001, 161, 0, 0},
+    {3001, 162, 0, 0},
+    {3001, 163, 0, 0},
+    {3001, 164, 0, 0},
+    {3001, 165, 0, 0},
+    {3001, 166, 0, 0},
+    {3001, 167, 0, 0},
+    {3001, 168, 0, 0},
+    {3001, 169, 0, 0},
+    {3001, 170, 0, 0},
+    {3001, 171, 0, 0},
+    {3001, 172, 0, 0},
+    {3001, 173, 0, 0},
+    {3001, 174, 0, 0},
+    {3001, 175, 0, 0},
+    {3001, 176, 0, 0},
+    {3001, 177, 0, 0},
+    {3001, 178, 0, 0},
+    {3002, 179, 0, 0},
+    {3002, 180, 0, 0},
+    {58, 181, 0, 0},
+    {58, 182, 0, 0},
+    {58, 183, 0, 0},
+    {58, 184, 0, 0},
+    {3001, 185, 0, 0},
+    {3001, 186, 0, 0},
+    {3006, 187, 0, 0},
+    {3006, 188, 0, 0},
+    {3006, 189, 0, 0},
+    {3006, 190, 0, 0},
+    {3001, 191, 0, 0},
+    {3001, 192, 0, 0},
+    {3001, 193, 0, 0},
+    {2049, 194, 0, 0},
+    {2049, 195, 0, 0},
+    {2008, 196, 0, 0},
+    {2008, 197, 0, 0},
+    {2008, 198, 0, 0},
+    {58, 199, 0, 0},
+    {58, 200, 0, 0},
+    {58, 201, 0, 0},
+    {58, 202, 0, 0},
+    {58, 203, 0, 0},
+    {58, 204, 0, 0},
+    {58, 205, 0, 0},
+    {58, 206, 0, 0},
+    {3003, 207, 0, 0},
+    {3003, 208, 0, 0},
+    {3005, 209, 0, 0},
+    {3005, 210, 0, 0},
+    {3005, 211, 0, 0},
+    {3005, 212, 0, 0},
+    {3005, 213, 0, 0},
+    {3005, 214, 0, 0},
+    {3005, 215, 0, 0},
+    {3005, 216, 0, 0},
+    {3005, 217, 0, 0},
+    {3001, 218, 0, 0},
+    {3003, 219, 0, 0},
+    {3005, 220, 0, 0},
+    {2025, 221, 0, 0},
+    {2025, 222, 0, 0},
+    {2025, 223, 0, 0},
+    {3006, 224, 0, 0},
+    {3006, 225, 0, 0},
+    {3006, 226, 0, 0},
+    {3001, 227, 0, 0},
+    {3001, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {3001, 230, 0, 0},
+    {3001, 231, 0, 0},
+    {2048, 232, 0, 0},
+    {2048, 233, 0, 0},
+    {2048, 234, 0, 0},
+    {2046, 235, 0, 0},
+    {2049, 236, 0, 0},
+    {2049, 237, 0, 0},
+    {2049, 238, 0, 0},
+    {2049, 239, 0, 0},
+    {2049, 240, 0, 0},
+    {2010, 241, 0, 0},
+    {2010, 242, 0, 0},
+    {2010, 243, 0, 0},
+    {2012, 244, 0, 0},
+    {2012, 245, 0, 0},
+    {2012, 246, 0, 0},
+    {2012, 247, 0, 0},
+    {2012, 248, 0, 0},
+    {2012, 249, 0, 0},
+    {2012, 250, 0, 0},
+    {2012, 251, 0, 0},
+    {2012, 252, 0, 0},
+    {2012, 253, 0, 0},
+    {2012, 254, 0, 0},
+    {3001, 255, 0, 0},
+    {2023, 256, 0, 0},
+    {3005, 257, 0, 0},
+    {3005, 258, 0, 0},
+    {3005, 259, 0, 0},
+    {2012, 260, 0, 0},
+    {2012, 261, 0, 0},
+    {2012, 262, 0, 0},
+    {2049, 263, 0, 0},
+    {2008, 264, 0, 0},
+    {2025, 265, 0, 0},
+    {2012, 266, 0, 0},
+    {2012, 267, 0, 0},
+    {2048, 268, 0, 0},
+    {2048, 269, 0, 0},
+    {2049, 270, 0, 0},
+    {2049, 271, 0, 0},
+    {2012, 272, 0, 0},
+    {2012, 273, 0, 0},
+    {2025, 274, 0, 0},
+    {2012, 275, 0, 0},
+    {2012, 276, 0, 0},
+    {2012, 277, 0, 0},
+    {2001, 278, 0, 0},
+    {2049, 279, 0, 0},
+    {3005, 280, 0, 0},
+    {3005, 281, 0, 0},
+    {3005, 282, 0, 0},
+    {3005, 283, 0, 0},
+    {3005, 284, 0, 0},
+    {3005, 285, 0, 0},
+    {3005, 286, 0, 0},
+    {11, 287, 0, 0},
+    {11, 288, 0, 0},
+    {11, 289, 0, 0},
+    {11, 290, 0, 0},
+    {11, 291, 0, 0},
+    {2018, 292, 0, 0},
+    {2019, 293, 0, 0},
+    {2001, 294, 0, 0},
+    // And Hell Followed (E4M7)
+    {1, 0, 0, 0},
+    {2001, 1, 0, 0},
+    {28, 2, 0, 0},
+    {28, 3, 0, 0},
+    {28, 4, 0, 0},
+    {28, 5, 0, 0},
+    {9, 6, 0, 0},
+    {9, 7, 0, 0},
+    {3001, 8, 0, 0},
+    {3004, 9, 0, 0},
+    {9, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {33, 12, 0, 0},
+    {33, 13, 0, 0},
+    {33, 14, 0, 0},
+    {33, 15, 0, 0},
+    {58, 16, 0, 0},
+    {3001, 17, 0, 0},
+    {2011, 18, 0, 0},
+    {54, 19, 0, 0},
+    {47, 20, 0, 0},
+    {3001, 21, 0, 0},
+    {9, 22, 0, 0},
+    {9, 23, 0, 0},
+    {9, 24, 0, 0},
+    {9, 25, 0, 0},
+    {9, 26, 0, 0},
+    {3001, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {2002, 33, 0, 0},
+    {2048, 34, 0, 0},
+    {45, 35, 0, 0},
+    {45, 36, 0, 0},
+    {32, 37, 0, 0},
+    {32, 38, 0, 0},
+    {12, 39, 0, 0},
+    {58, 40, 0, 0},
+    {3005, 41, 0, 0},
+    {9, 42, 0, 0},
+    {3001, 43, 0, 0},
+    {9, 44, 0, 0},
+    {9, 45, 0, 0},
+    {3004, 46, 0, 0},
+    {9, 47, 0, 0},
+    {9, 48, 0, 0},
+    {9, 49, 0, 0},
+    {9, 50, 0, 0},
+    {3005, 51, 0, 0},
+    {3002, 52, 0, 0},
+    {9, 53, 0, 0},
+    {9, 54, 0, 0},
+    {3002, 55, 0, 0},
+    {3002, 56, 0, 0},
+    {3002, 57, 0, 0},
+    {2003, 58, 0, 0},
+    {3001, 59, 0, 0},
+    {3005, 60, 0, 0},
+    {2004, 61, 0, 0},
+    {2047, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {2012, 64, 0, 0},
+    {3004, 65, 0, 0},
+    {3004, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {54, 68, 0, 0},
+    {47, 69, 0, 0},
+    {9, 70, 0, 0},
+    {2012, 71, 0, 0},
+    {2046, 72, 0, 0},
+    {2046, 73, 0, 0},
+    {2028, 74, 0, 0},
+    {2008, 75, 0, 0},
+    {8, 76, 0, 0},
+    {2013, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3001, 79, 0, 0},
+    {3001, 80, 0, 0},
+    {3001, 81, 0, 0},
+    {3001, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {3001, 85, 0, 0},
+    {3001, 86, 0, 0},
+    {40, 87, 0, 0},
+    {58, 88, 0, 0},
+    {2049, 89, 0, 0},
+    {2015, 90, 0, 0},
+    {2015, 91, 0, 0},
+    {2015, 92, 0, 0},
+    {2015, 93, 0, 0},
+    {2015, 94, 0, 0},
+    {2015, 95, 0, 0},
+    {2014, 96, 0, 0},
+    {2014, 97, 0, 0},
+    {2014, 98, 0, 0},
+    {3004, 99, 0, 0},
+    {3001, 100, 0, 0},
+    {3001, 101, 0, 0},
+    {9, 102, 0, 0},
+    {9, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {49, 105, 0, 0},
+    {15, 106, 0, 0},
+    {2007, 107, 0, 0},
+    {28, 108, 0, 0},
+    {26, 109, 0, 0},
+    {25, 110, 0, 0},
+    {26, 111, 0, 0},
+    {25, 112, 0, 0},
+    {25, 113, 0, 0},
+    {25, 114, 0, 0},
+    {2012, 115, 0, 0},
+    {12, 116, 0, 0},
+    {54, 117, 0, 0},
+    {47, 118, 0, 0},
+    {28, 119, 0, 0},
+    {2014, 120, 0, 0},
+    {2014, 121, 0, 0},
+    {2024, 122, 0, 0},
+    {2010, 123, 0, 0},
+    {2047, 124, 0, 0},
+    {9, 125, 0, 0},
+    {3003, 126, 0, 0},
+    {9, 127, 0, 0},
+    {9, 128, 0, 0},
+    {2011, 129, 0, 0},
+    {3003, 130, 0, 0},
+    {3003, 131, 0, 0},
+    {3001, 132, 0, 0},
+    {3001, 133, 0, 0},
+    {3001, 134, 0, 0},
+    {3001, 135, 0, 0},
+    {9, 136, 0, 0},
+    {11, 137, 0, 0},
+    {11, 138, 0, 0},
+    {11, 139, 0, 0},
+    {11, 140, 0, 0},
+    {2001, 141, 0, 0},
+    {2001, 142, 0, 0},
+    {2001, 143, 0, 0},
+    {2, 144, 0, 0},
+    {3, 145, 0, 0},
+    {4, 146, 0, 0},
+    {2001, 147, 0, 0},
+    {26, 148, 0, 0},
+    {25, 149, 0, 0},
+    {2049, 150, 0, 0},
+    {3001, 151, 0, 0},
+    {3001, 152, 0, 0},
+    {3001, 153, 0, 0},
+    {2048, 154, 0, 0},
+    {17, 155, 0, 0},
+    {2019, 156, 0, 0},
+    {12, 157, 0, 0},
+    {24, 158, 0, 0},
+    {2010, 159, 0, 0},
+    {14, 160, 0, 0},
+    {14, 161, 0, 0},
+    {2025, 162, 0, 0},
+    {2025, 163, 0, 0},
+    {9, 164, 0, 0},
+    {3001, 165, 0, 0},
+    {3005, 166, 0, 0},
+    {3002, 167, 0, 0},
+    {3001, 168, 0, 0},
+    {3001, 169, 0, 0},
+    {3001, 170, 0, 0},
+    {3001, 171, 0, 0},
+    {2018, 172, 0, 0},
+    {2026, 173, 0, 0},
+    {2023, 174, 0, 0},
+    {3001, 175, 0, 0},
+    {3005, 176, 0, 0},
+    {33, 177, 0, 0},
+    {33, 178, 0, 0},
+    {33, 179, 0, 0},
+    {16, 180, 0, 0},
+    {14, 181, 0, 0},
+    {39, 182, 0, 0},
+    {14, 183, 0, 0},
+    {14, 184, 0, 0},
+    {9, 185, 0, 0},
+    {38, 186, 0, 0},
+    {2049, 187, 0, 0},
+    {2010, 188, 0, 0},
+    {2008, 189, 0, 0},
+    {2005, 190, 0, 0},
+    {46, 191, 0, 0},
+    {46, 192, 0, 0},
+    {3004, 193, 0, 0},
+    {28, 194, 0, 0},
+    {28, 195, 0, 0},
+    {2006, 196, 0, 0},
+    {2046, 197, 0, 0},
+    {2046, 198, 0, 0},
+    {17, 199, 0, 0},
+    {17, 200, 0, 0},
+    {9, 201, 0, 0},
+    {3001, 202, 0, 0},
+    {2008, 203, 0, 0},
+    {2011, 204, 0, 0},
+    {3006, 205, 0, 0},
+    {3006, 206, 0, 0},
+    {9, 207, 0, 0},
+    {9, 208, 0, 0},
+    {3006, 209, 0, 0},
+    {3006, 210, 0, 0},
+    {2046, 211, 0, 0},
+    {2046, 212, 0, 0},
+    {2046, 213, 0, 0},
+    {2046, 214, 0, 0},
+    {2046, 215, 0, 0},
+    {2046, 216, 0, 0},
+    {2019, 217, 0, 0},
+    {2012, 218, 0, 0},
+    {2012, 219, 0, 0},
+    {3006, 220, 0, 0},
+    {3006, 221, 0, 0},
+    {3005, 222, 0, 0},
+    {3006, 223, 0, 0},
+    {3003, 224, 0, 0},
+    {2046, 225, 0, 0},
+    {2046, 226, 0, 0},
+    {2046, 227, 0, 0},
+    {2046, 228, 0, 0},
+    {3001, 229, 0, 0},
+    {3001, 230, 0, 0},
+    {2011, 231, 0, 0},
+    {2012, 232, 0, 0},
+    {14, 233, 0, 0},
+    {3001, 234, 0, 0},
+    {2022, 235, 0, 0},
+    {2022, 236, 0, 0},
+    {2013, 237, 0, 0},
+    {2008, 238, 0, 0},
+    {2049, 239, 0, 0},
+    {2025, 240, 0, 0},
+    {2025, 241, 0, 0},
+    {17, 242, 0, 0},
+    {2003, 243, 0, 0},
+    {11, 244, 0, 0},
+    {2001, 245, 0, 0},
+    {2001, 246, 0, 0},
+    {3001, 247, 0, 0},
+    {2003, 248, 0, 0},
+    {3001, 249, 0, 0},
+    {2049, 250, 0, 0},
+    {2011, 251, 0, 0},
+    {2012, 252, 0, 0},
+    {2012, 253, 0, 0},
+    {45, 254, 0, 0},
+    {45, 255, 0, 0},
+    {41, 256, 0, 0},
+    {41, 257, 0, 0},
+    // Unto the Cruel (E4M8)
+    {2, 0, 0, 0},
+    {3, 1, 0, 0},
+    {4, 2, 0, 0},
+    {46, 3, 0, 0},
+    {46, 4, 0, 0},
+    {14, 5, 0, 0},
+    {14, 6, 0, 0},
+    {1, 7, 0, 0},
+    {54, 8, 0, 0},
+    {54, 9, 0, 0},
+    {43, 10, 0, 0},
+    {43, 11, 0, 0},
+    {43, 12, 0, 0},
+    {54, 13, 0, 0},
+    {54, 14, 0, 0},
+    {54, 15, 0, 0},
+    {54, 16, 0, 0},
+    {54, 17, 0, 0},
+    {43, 18, 0, 0},
+    {54, 19, 0, 0},
+    {45, 20, 0, 0},
+    {45, 21, 0, 0},
+    {45, 22, 0, 0},
+    {45, 23, 0, 0},
+    {45, 24, 0, 0},
+    {45, 25, 0, 0},
+    {45, 26, 0, 0},
+    {45, 27, 0, 0},
+    {14, 28, 0, 0},
+    {14, 29, 0, 0},
+    {49, 30, 0, 0},
+    {44, 31, 0, 0},
+    {44, 32, 0, 0},
+    {28, 33, 0, 0},
+    {44, 34, 0, 0},
+    {44, 35, 0, 0},
+    {51, 36, 0, 0},
+    {44, 37, 0, 0},
+    {44, 38, 0, 0},
+    {44, 39, 0, 0},
+    {7, 40, 0, 0},
+    {44, 41, 0, 0},
+    {44, 42, 0, 0},
+    {44, 43, 0, 0},
+    {44, 44, 0, 0},
+    {53, 45, 0, 0},
+    {25, 46, 0, 0},
+    {26, 47, 0, 0},
+    {46, 48, 0, 0},
+    {46, 49, 0, 0},
+    {46, 50, 0, 0},
+    {46, 51, 0, 0},
+    {46, 52, 0, 0},
+    {46, 53, 0, 0},
+    {46, 54, 0, 0},
+    {46, 55, 0, 0},
+    {46, 56, 0, 0},
+    {46, 57, 0, 0},
+    {46, 58, 0, 0},
+    {2048, 59, 0, 0},
+    {2048, 60, 0, 0},
+    {2012, 61, 0, 0},
+    {2012, 62, 0, 0},
+    {2012, 63, 0, 0},
+    {2012, 64, 0, 0},
+    {2008, 65, 0, 0},
+    {2008, 66, 0, 0},
+    {2008, 67, 0, 0},
+    {2008, 68, 0, 0},
+    {2008, 69, 0, 0},
+    {2008, 70, 0, 0},
+    {2008, 71, 0, 0},
+    {2008, 72, 0, 0},
+    {2008, 73, 0, 0},
+    {2008, 74, 0, 0},
+    {2008, 75, 0, 0},
+    {2008, 76, 0, 0},
+    {2008, 77, 0, 0},
+    {2008, 78, 0, 0},
+    {2001, 79, 0, 0},
+    {2001, 80, 0, 0},
+    {2013, 81, 0, 0},
+    {2046, 82, 0, 0},
+    {2046, 83, 0, 0},
+    {2046, 84, 0, 0},
+    {2003, 85, 0, 0},
+    {46, 86, 0, 0},
+    {46, 87, 0, 0},
+    {46, 88, 0, 0},
+    {46, 89, 0, 0},
+    {46, 90, 0, 0},
+    {46, 91, 0, 0},
+    {46, 92, 0, 0},
+    {46, 93, 0, 0},
+    {46, 94, 0, 0},
+    {46, 95, 0, 0},
+    {46, 96, 0, 0},
+    {46, 97, 0, 0},
+    {46, 98, 0, 0},
+    {46, 99, 0, 0},
+    {2019, 100, 0, 0},
+    {2013, 101, 0, 0},
+    {2019, 102, 0, 0},
+    {3001, 103, 0, 0},
+    {3001, 104, 0, 0},
+    {3003, 105, 0, 0},
+    {3003, 106, 0, 0},
+    {9, 107, 0, 0},
+    {9, 108, 0, 0},
+    {9, 109, 0, 0},
+    {3002, 110, 0, 0},
+    {3002, 111, 0, 0},
+    {3004, 112, 0, 0},
+    {3004, 113, 0, 0},
+    {3004, 114, 0, 0},
+    {9, 115, 0, 0},
+    {9, 116, 0, 0},
+    {3002, 117, 0, 0},
+    {9, 118, 0, 0},
+    {9, 119, 0, 0},
+    {3003, 120, 0, 0},
+    {3005, 121, 0, 0},
+    {3004, 122, 0, 0},
+    {3004, 123, 0, 0},
+    {9, 124, 0, 0},
+    {9, 125, 0, 0},
+    {9, 126, 0, 0},
+    {9, 127, 0, 0},
+    {9, 128, 0, 0},
+    {3005, 129, 0, 0},
+    {3002, 130, 0, 0},
+    {3002, 131, 0, 0},
+    {9, 132, 0, 0},
+    {3004, 133, 0, 0},
+    {3004, 134, 0, 0},
+    {3004, 135, 0, 0},
+    {9, 136, 0, 0},
+    {3003, 137, 0, 0},
+    {9, 138, 0, 0},
+    {9, 139, 0, 0},
+    {3005, 140, 0, 0},
+    {3005, 141, 0, 0},
+    {3005, 142, 0, 0},
+    {3003, 143, 0, 0},
+    {3003, 144, 0, 0},
+    {3003, 145, 0, 0},
+    {39, 146, 0, 0},
+    {2045, 147, 0, 0},
+    {2023, 148, 0, 0},
+    {2006, 149, 0, 0},
+    {17, 150, 0, 0},
+    {17, 151, 0, 0},
+    {17, 152, 0, 0},
+    {17, 153, 0, 0},
+    {2048, 154, 0, 0},
+    {2048, 155, 0, 0},
+    {2046, 156, 0, 0},
+    {2046, 157, 0, 0},
+    {2049, 158, 0, 0},
+    {2049, 159, 0, 0},
+    {2011, 160, 0, 0},
+    {2011, 161, 0, 0},
+    {2011, 162, 0, 0},
+    {2011, 163, 0, 0},
+    {2011, 164, 0, 0},
+    {2011, 165, 0, 0},
+    {2011, 166, 0, 0},
+    {2011, 167, 0, 0},
+    {2011, 168, 0, 0},
+    {2011, 169, 0, 0},
+    {2011, 170, 0, 0},
+    {2011, 171, 0, 0},
+    {2002, 172, 0, 0},
+    {2001, 173, 0, 0},
+    {11, 174, 0, 0},
+    {11, 175, 0, 0},
+    {11, 176, 0, 0},
+    {11, 177, 0, 0},
+    {2003, 178, 0, 0},
+    {17, 179, 0, 0},
+    {2006, 180, 0, 0},
+    {17, 181, 0, 0},
+    {14, 182, 0, 0},
+    {14, 183, 0, 0},
+    {17, 184, 0, 0},
+    {2046, 185, 0, 0},
+    {2003, 186, 0, 0},
+    {2004, 187, 0, 0},
+    {17, 188, 0, 0},
+    {17, 189, 0, 0},
+    {2046, 190, 0, 0},
+    {2046, 191, 0, 0},
+    {38, 192, 0, 0},
+    {9, 193, 0, 0},
+    {9, 194, 0, 0},
+    {9, 195, 0, 0},
+    {3001, 196, 0, 0},
+    {3001, 197, 0, 0},
+    {3001, 198, 0, 0},
+    {3001, 199, 0, 0},
+    {9, 200, 0, 0},
+    {3001, 201, 0, 0},
+    {3005, 202, 0, 0},
+    {3005, 203, 0, 0},
+    {9, 204, 0, 0},
+    {9, 205, 0, 0},
+    {3001, 206, 0, 0},
+    {3001, 207, 0, 0},
+    {58, 208, 0, 0},
+    {58, 209, 0, 0},
+    {3001, 210, 0, 0},
+    {3001, 211, 0, 0},
+    {3002, 212, 0, 0},
+    {3002, 213, 0, 0},
+    {3002, 214, 0, 0},
+    {3002, 215, 0, 0},
+    {58, 216, 0, 0},
+    {58, 217, 0, 0},
+    {3004, 218, 0, 0},
+    {3004, 219, 0, 0},
+    {3004, 220, 0, 0},
+    {3004, 221, 0, 0},
+    {9, 222, 0, 0},
+    {9, 223, 0, 0},
+    {9, 224, 0, 0},
+    {9, 225, 0, 0},
+    {9, 226, 0, 0},
+    {58, 227, 0, 0},
+    {3004, 228, 0, 0},
+    {9, 229, 0, 0},
+    {9, 230, 0, 0},
+    {3004, 231, 0, 0},
+    {9, 232, 0, 0},
+    {9, 233, 0, 0},
+    {58, 234, 0, 0},
+    {3004, 235, 0, 0},
+    {3004, 236, 0, 0},
+    {9, 237, 0, 0},
+    {9, 238, 0, 0},
+    {9, 239, 0, 0},
+    {9, 240, 0, 0},
+    {9, 241, 0, 0},
+    {9, 242, 0, 0},
+    {9, 243, 0, 0},
+    {3004, 244, 0, 0},
+    {9, 245, 0, 0},
+    {9, 246, 0, 0},
+    {3004, 247, 0, 0},
+    {9, 248, 0, 0},
+    {9, 249, 0, 0},
+    {3004, 250, 0, 0},
+    {9, 251, 0, 0},
+    {9, 252, 0, 0},
+    {58, 253, 0, 0},
+    {3004, 254, 0, 0},
+    {9, 255, 0, 0},
+    {9, 256, 0, 0},
+    {9, 257, 0, 0},
+    {3004, 258, 0, 0},
+    {3005, 259, 0, 0},
+    {3005, 260, 0, 0},
+    {3003, 261, 0, 0},
+    {3003, 262, 0, 0},
+    {3003, 263, 0, 0},
+    {3003, 264, 0, 0},
+    {9, 265, 0, 0},
+    {9, 266, 0, 0},
+    {9, 267, 0, 0},
+    {9, 268, 0, 0},
+    {9, 269, 0, 0},
+    {9, 270, 0, 0},
+    {3001, 271, 0, 0},
+    {3001, 272, 0, 0},
+    {3001, 273, 0, 0},
+    {3001, 274, 0, 0},
+    {3006, 275, 0, 0},
+    {3006, 276, 0, 0},
+    {3006, 277, 0, 0},
+    {3006, 278, 0, 0},
+    {3006, 279, 0, 0},
+    {3006, 280, 0, 0},
+    {3006, 281, 0, 0},
+    {3006, 282, 0, 0},
+    {3006, 283, 0, 0},
+    {3006, 284, 0, 0},
+    {3006, 285, 0, 0},
+    {3006, 286, 0, 0},
+    {3006, 287, 0, 0},
+    {3006, 288, 0, 0},
+    {9, 289, 0, 0},
+    {3005, 290, 0, 0},
+    {3003, 291, 0, 0},
+    {2002, 292, 0, 0},
+    {2048, 293, 0, 0},
+    {2048, 294, 0, 0},
+    {2048, 295, 0, 0},
+    {2048, 296, 0, 0},
+    {2012, 297, 0, 0},
+    {2012, 298, 0, 0},
+    {2012, 299, 0, 0},
+    {2012, 300, 0, 0},
+    {2012, 301, 0, 0},
+    {2012, 302, 0, 0},
+    {2012, 303, 0, 0},
+    {2013, 304, 0, 0},
+    {2048, 305, 0, 0},
+    {2048, 306, 0, 0},
+    {2048, 307, 0, 0},
+    {2046, 308, 0, 0},
+    {2046, 309, 0, 0},
+    {2024, 310, 0, 0},
+    {8, 311, 0, 0},
+    {2004, 312, 0, 0},
+    {2025, 313, 0, 0},
+    {2025, 314, 0, 0},
+    // Fear (E4M9)
+    {1, 0, 0, 0},
+    {31, 1, 0, 0},
+    {14, 2, 0, 0},
+    {14, 3, 0, 0},
+    {14, 4, 0, 0},
+    {14, 5, 0, 0},
+    {39, 6, 0, 0},
+    {46, 7, 0, 0},
+    {46, 8, 0, 0},
+    {46, 9, 0, 0},
+    {46, 10, 0, 0},
+    {46, 11, 0, 0},
+    {46, 12, 0, 0},
+    {46, 13, 0, 0},
+    {46, 14, 0, 0},
+    {32, 15, 0, 0},
+    {32, 16, 0, 0},
+    {32, 17, 0, 0},
+    {32, 18, 0, 0},
+    {2, 19, 0, 0},
+    {3, 20, 0, 0},
+    {4, 21, 0, 0},
+    {11, 22, 0, 0},
+    {11, 23, 0, 0},
+    {11, 24, 0, 0},
+    {11, 25, 0, 0},
+    {11, 26, 0, 0},
+    {2013, 27, 0, 0},
+    {3004, 28, 0, 0},
+    {3004, 29, 0, 0},
+    {3004, 30, 0, 0},
+    {3004, 31, 0, 0},
+    {15, 32, 0, 0},
+    {24, 33, 0, 0},
+    {24, 34, 0, 0},
+    {24, 35, 0, 0},
+    {24, 36, 0, 0},
+    {2001, 37, 0, 0},
+    {2011, 38, 0, 0},
+    {2011, 39, 0, 0},
+    {2019, 40, 0, 0},
+    {2008, 41, 0, 0},
+    {2008, 42, 0, 0},
+    {2008, 43, 0, 0},
+    {2008, 44, 0, 0},
+    {2010, 45, 0, 0},
+    {2010, 46, 0, 0},
+    {2010, 47, 0, 0},
+    {3002, 48, 0, 0},
+    {9, 49, 0, 0},
+    {3002, 50, 0, 0},
+    {3002, 51, 0, 0},
+    {58, 52, 0, 0},
+    {58, 53, 0, 0},
+    {3005, 54, 0, 0},
+    {3005, 55, 0, 0},
+    {3004, 56, 0, 0},
+    {3004, 57, 0, 0},
+    {3004, 58, 0, 0},
+    {3004, 59, 0, 0},
+    {3001, 60, 0, 0},
+    {3001, 61, 0, 0},
+    {3001, 62, 0, 0},
+    {3001, 63, 0, 0},
+    {3004, 64, 0, 0},
+    {3004, 65, 0, 0},
+    {3001, 66, 0, 0},
+    {3001, 67, 0, 0},
+    {9, 68, 0, 0},
+    {9, 69, 0, 0},
+    {3001, 70, 0, 0},
+    {3001, 71, 0, 0},
+    {3001, 72, 0, 0},
+    {3001, 73, 0, 0},
+    {3005, 74, 0, 0},
+    {58, 75, 0, 0},
+    {58, 76, 0, 0},
+    {3001, 77, 0, 0},
+    {3001, 78, 0, 0},
+    {3004, 79, 0, 0},
+    {3004, 80, 0, 0},
+    {3004, 81, 0, 0},
+    {9, 82, 0, 0},
+    {3001, 83, 0, 0},
+    {3001, 84, 0, 0},
+    {3002, 85, 0, 0},
+    {3002, 86, 0, 0},
+    {3004, 87, 0, 0},
+    {3004, 88, 0, 0},
+    {3004, 89, 0, 0},
+    {3004, 90, 0, 0},
+    {3002, 91, 0, 0},
+    {3002, 92, 0, 0},
+    {3005, 93, 0, 0},
+    {3002, 94, 0, 0},
+    {3002, 95, 0, 0},
+    {3001, 96, 0, 0},
+    {3001, 97, 0, 0},
+    {3001, 98, 0, 0},
+    {3001, 99, 0, 0},
+    {3004, 100, 0, 0},
+    {3004, 101, 0, 0},
+    {3004, 102, 0, 0},
+    {9, 103, 0, 0},
+    {9, 104, 0, 0},
+    {3006, 105, 0, 0},
+    {3006, 106, 0, 0},
+    {3002, 107, 0, 0},
+    {3002, 108, 0, 0},
+    {9, 109, 0, 0},
+    {3005, 110, 0, 0},
+    {3005, 111, 0, 0},
+    {3006, 112, 0, 0},
+    {3006, 113, 0, 0},
+    {3006, 114, 0, 0},
+    {3005, 115, 0, 0},
+    {3005, 116, 0, 0},
+    {3006, 117, 0, 0},
+    {3006, 118, 0, 0},
+    {2003, 119, 0, 0},
+    {3006, 120, 0, 0},
+    {3006, 121, 0, 0},
+    {3006, 122, 0, 0},
+    {3001, 123, 0, 0},
+    {3001, 124, 0, 0},
+    {3001, 125, 0, 0},
+    {3001, 126, 0, 0},
+    {9, 127, 0, 0},
+    {9, 128, 0, 0},
+    {9, 129, 0, 0},
+    {9, 130, 0, 0},
+    {9, 131, 0, 0},
+    {9, 132, 0, 0},
+    {3006, 133, 0, 0},
+    {3001, 134, 0, 0},
+    {3001, 135, 0, 0},
+    {11, 136, 0, 0},
+    {3003, 137, 0, 0},
+    {9, 138, 0, 0},
+    {3001, 139, 0, 0},
+    {3003, 140, 0, 0},
+    {3001, 141, 0, 0},
+    {3001, 142, 0, 0},
+    {3001, 143, 0, 0},
+    {3001, 144, 0, 0},
+    {3001, 145, 0, 0},
+    {46, 146, 0, 0},
+    {46, 147, 0, 0},
+    {46, 148, 0, 0},
+    {2003, 149, 0, 0},
+    {2005, 150, 0, 0},
+    {8, 151, 0, 0},
+    {2002, 152, 0, 0},
+    {2001, 153, 0, 0},
+    {2047, 154, 0, 0},
+    {2012, 155, 0, 0},
+    {2011, 156, 0, 0},
+    {2011, 157, 0, 0},
+    {2014, 158, 0, 0},
+    {2014, 159, 0, 0},
+    {2014, 160, 0, 0},
+    {2014, 161, 0, 0},
+    {2014, 162, 0, 0},
+    {2014, 163, 0, 0},
+    {2014, 164, 0, 0},
+    {2015, 165, 0, 0},
+    {2015, 166, 0, 0},
+    {2015, 167, 0, 0},
+    {2012, 168, 0, 0},
+    {2049, 169, 0, 0},
+    {2048, 170, 0, 0},
+    {2011, 171, 0, 0},
+    {2011, 172, 0, 0},
+    {2011, 173, 0, 0},
+    {2035, 174, 0, 0},
+    {2035, 175, 0, 0},
+    {2035, 176, 0, 0},
+    {2035, 177, 0, 0},
+    {2035, 178, 0, 0},
+    {2035, 179, 0, 0},
+    {2035, 180, 0, 0},
+    {2035, 181, 0, 0},
+    {2035, 182, 0, 0},
+    {2035, 183, 0, 0},
+    {2035, 184, 0, 0},
+    {2035, 185, 0, 0},
+    {2035, 186, 0, 0},
+    {2035, 187, 0, 0},
+    {2035, 188, 0, 0},
+    {2035, 189, 0, 0},
+    {2035, 190, 0, 0},
+    {2035, 191, 0, 0},
+    {2035, 192, 0, 0},
+    {2035, 193, 0, 0},
+    {2035, 194, 0, 0},
+    {2007, 195, 0, 0},
+    {2007, 196, 0, 0},
+    {2007, 197, 0, 0},
+    {2049, 198, 0, 0},
+    {2011, 199, 0, 0},
+    {2011, 200, 0, 0},
+    {2011, 201, 0, 0},
+    {2014, 202, 0, 0},
+    {2014, 203, 0, 0},
+    {2014, 204, 0, 0},
+    {2035, 205, 0, 0},
+    {2035, 206, 0, 0},
+    {2035, 207, 0, 0},
+    {2035, 208, 0, 0},
+    {2035, 209, 0, 0},
+    {2035, 210, 0, 0},
+    {2049, 211, 0, 0},
+    {2012, 212, 0, 0},
+    {2035, 213, 0, 0},
+    {2035, 214, 0, 0},
+    {2035, 215, 0, 0},
+    {2035, 216, 0, 0},
+    {2035, 217, 0, 0},
+    {2035, 218, 0, 0},
+    {2035, 219, 0, 0},
+    {2004, 220, 0, 0},
+    {17, 221, 0, 0},
+    {2047, 222, 0, 0},
+    {2047, 223, 0, 0},
+    {2047, 224, 0, 0},
+    {2047, 225, 0, 0},
+    {2047, 226, 0, 0},
+    {2012, 227, 0, 0},
+    {2012, 228, 0, 0},
+    {2035, 229, 0, 0},
+    {2035, 230, 0, 0},
+    {2035, 231, 0, 0},
+    {2035, 232, 0, 0},
+    {2035, 233, 0, 0},
+    {2035, 234, 0, 0},
+    {2002, 235, 0, 0},
+    {2008, 236, 0, 0},
+    {2008, 237, 0, 0},
+    {2008, 238, 0, 0},
+    {2008, 239, 0, 0},
+    {2008, 240, 0, 0},
+    {2008, 241, 0, 0},
+    {2011, 242, 0, 0},
+    {2011, 243, 0, 0},
+    {2046, 244, 0, 0},
+    {2046, 245, 0, 0},
+    {2023, 246, 0, 0},
 };
 
 
-const std::map<int, std::string> ap_doom_type_sprites = {
+constexpr ap_level_info_t ap_doom_level_infos_ep1[] = {
+    {"Hangar (E1M1)", {false, false, false}, {0, 0, 0}, 3, 143, ap_doom_thing_infos + 0, 0},
+    {"Nuclear Plant (E1M2)", {false, false, true}, {0, 0, 0}, 11, 262, ap_doom_thing_infos + 143, 0},
+    {"Toxin Refinery (E1M3)", {true, true, false}, {0, 0, 0}, 15, 380, ap_doom_thing_infos + 405, 0},
+    {"Command Control (E1M4)", {true, true, false}, {0, 0, 0}, 9, 254, ap_doom_thing_infos + 785, 0},
+    {"Phobos Lab (E1M5)", {true, true, false}, {0, 0, 0}, 16, 293, ap_doom_thing_infos + 1039, 0},
+    {"Central Processing (E1M6)", {true, true, true}, {0, 0, 0}, 19, 463, ap_doom_thing_infos + 1332, 0},
+    {"Computer Station (E1M7)", {true, true, true}, {0, 0, 0}, 15, 358, ap_doom_thing_infos + 1795, 0},
+    {"Phobos Anomaly (E1M8)", {false, false, false}, {0, 0, 0}, 7, 126, ap_doom_thing_infos + 2153, 0},
+    {"Military Base (E1M9)", {true, true, true}, {0, 0, 0}, 9, 237, ap_doom_thing_infos + 2279, 0},
+};
+
+
+constexpr ap_level_info_t ap_doom_level_infos_ep2[] = {
+    {"Deimos Anomaly (E2M1)", {true, false, true}, {0, 0, 0}, 8, 127, ap_doom_thing_infos + 2516, 0},
+    {"Containment Area (E2M2)", {true, true, true}, {0, 0, 0}, 19, 311, ap_doom_thing_infos + 2643, 0},
+    {"Refinery (E2M3)", {true, false, false}, {0, 0, 0}, 11, 229, ap_doom_thing_infos + 2954, 0},
+    {"Deimos Lab (E2M4)", {true, true, false}, {0, 0, 0}, 16, 265, ap_doom_thing_infos + 3183, 0},
+    {"Command Center (E2M5)", {false, false, false}, {0, 0, 0}, 10, 326, ap_doom_thing_infos + 3448, 0},
+    {"Halls of the Damned (E2M6)", {true, true, true}, {1, 1, 1}, 17, 326, ap_doom_thing_infos + 3774, 0},
+    {"Spawning Vats (E2M7)", {true, true, true}, {0, 0, 0}, 16, 235, ap_doom_thing_infos + 4100, 0},
+    {"Tower of Babel (E2M8)", {false, false, false}, {0, 0, 0}, 4, 66, ap_doom_thing_infos + 4335, 0},
+    {"Fortress of Mystery (E2M9)", {true, true, true}, {1, 1, 1}, 12, 53, ap_doom_thing_infos + 4401, 0},
+};
+
+
+constexpr ap_level_info_t ap_doom_level_infos_ep3[] = {
+    {"Hell Keep (E3M1)", {false, false, false}, {0, 0, 0}, 2, 92, ap_doom_thing_infos + 4454, 0},
+    {"Slough of Despair (E3M2)", {true, false, false}, {1, 0, 0}, 9, 208, ap_doom_thing_infos + 4546, 0},
+    {"Pandemonium (E3M3)", {true, false, false}, {1, 0, 0}, 14, 209, ap_doom_thing_infos + 4754, 0},
+    {"House of Pain (E3M4)", {true, true, true}, {1, 1, 1}, 18, 374, ap_doom_thing_infos + 4963, 0},
+    {"Unholy Cathedral (E3M5)", {true, true, false}, {1, 1, 0}, 14, 291, ap_doom_thing_infos + 5337, 0},
+    {"Mt. Erebus (E3M6)", {true, false, false}, {1, 0, 0}, 17, 335, ap_doom_thing_infos + 5628, 0},
+    {"Limbo (E3M7)", {true, true, true}, {1, 1, 1}, 11, 154, ap_doom_thing_infos + 5963, 0},
+    {"Dis (E3M8)", {false, false, false}, {0, 0, 0}, 3, 58, ap_doom_thing_infos + 6117, 0},
+    {"Warrens (E3M9)", {true, false, true}, {1, 0, 1}, 16, 197, ap_doom_thing_infos + 6175, 0},
+};
+
+
+constexpr ap_level_info_t ap_doom_level_infos_ep4[] = {
+    {"Hell Beneath (E4M1)", {true, false, true}, {1, 0, 1}, 6, 141, ap_doom_thing_infos + 6372, 0},
+    {"Perfect Hatred (E4M2)", {true, true, false}, {1, 1, 0}, 12, 227, ap_doom_thing_infos + 6513, 0},
+    {"Sever the Wicked (E4M3)", {true, false, true}, {1, 0, 1}, 16, 384, ap_doom_thing_infos + 6740, 0},
+    {"Unruly Evil (E4M4)", {false, false, true}, {0, 0, 1}, 8, 153, ap_doom_thing_infos + 7124, 0},
+    {"They Will Repent (E4M5)", {true, true, true}, {1, 1, 1}, 11, 267, ap_doom_thing_infos + 7277, 0},
+    {"Against Thee Wickedly (E4M6)", {true, true, true}, {1, 1, 1}, 16, 295, ap_doom_thing_infos + 7544, 0},
+    {"And Hell Followed (E4M7)", {true, true, true}, {1, 1, 1}, 22, 258, ap_doom_thing_infos + 7839, 0},
+    {"Unto the Cruel (E4M8)", {false, true, true}, {0, 1, 1}, 17, 315, ap_doom_thing_infos + 8097, 0},
+    {"Fear (E4M9)", {false, true, false}, {0, 1, 0}, 9, 247, ap_doom_thing_infos + 8412, 0},
+};
+
+
+constexpr ap_episode_info_t ap_doom_level_infos[] = {
+    {ap_doom_level_infos_ep1, 9},
+    {ap_doom_level_infos_ep2, 9},
+    {ap_doom_level_infos_ep3, 9},
+    {ap_doom_level_infos_ep4, 9},
+};
+
+
+// Sorted by doom type
+constexpr ap_type_sprite_t ap_doom_type_sprites[] = {
+    {5, "BKEYB0"},
+    {6, "YKEYB0"},
+    {8, "BPAKA0"},
+    {13, "RKEYB0"},
+    {17, "CELPA0"},
+    {38, "RSKUB0"},
+    {39, "YSKUB0"},
+    {40, "BSKUB0"},
     {2001, "SHOTA0"},
+    {2002, "MGUNA0"},
     {2003, "LAUNA0"},
     {2004, "PLASA0"},
     {2005, "CSAWA0"},
-    {2002, "MGUNA0"},
     {2006, "BFUGA0"},
-    {8, "BPAKA0"},
+    {2012, "MEDIA0"},
+    {2013, "SOULA0"},
     {2018, "ARM1A0"},
     {2019, "ARM2A0"},
-    {2023, "PSTRA0"},
     {2022, "PINVA0"},
+    {2023, "PSTRA0"},
     {2024, "PINSA0"},
-    {2013, "SOULA0"},
-    {2012, "MEDIA0"},
-    {2048, "AMMOA0"},
+    {2026, "PMAPA0"},
     {2046, "BROKA0"},
+    {2048, "AMMOA0"},
     {2049, "SBOXA0"},
-    {17, "CELPA0"},
-    {2026, "PMAPA0"},
-    {5, "BKEYB0"},
-    {40, "BSKUB0"},
-    {6, "YKEYB0"},
-    {39, "YSKUB0"},
-    {13, "RKEYB0"},
-    {38, "RSKUB0"},
 };
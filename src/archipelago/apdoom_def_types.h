@@ -1,10 +1,93 @@
 #pragma once
 
 
-// Map item id
-struct ap_item_t
+#include "apdoom.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <algorithm>
+
+
+// Map item id to the item it gives (ap_item_t lives in apdoom.h)
+struct ap_item_def_t
+{
+    int64_t id;
+    ap_item_t item;
+};
+
+
+struct ap_location_def_t
+{
+    int ep; // 1-based
+    int map; // 1-based
+    int index; // -1 is the level exit
+    int64_t loc_id;
+};
+
+
+struct ap_episode_info_t
+{
+    const ap_level_info_t* level_infos;
+    int map_count;
+};
+
+
+struct ap_type_sprite_t
 {
     int doom_type;
-    int ep; // If doom_type is a keycard
-    int map; // If doom_type is a keycard
+    const char* sprite;
 };
+
+
+// View over one of the generated constexpr arrays
+template<typename T>
+struct ap_table_t
+{
+    const T* data;
+    size_t count;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + count; }
+    size_t size() const { return count; }
+    const T& operator[](size_t i) const { return data[i]; }
+};
+
+
+template<typename T, size_t N>
+constexpr ap_table_t<T> ap_make_table(const T (&arr)[N])
+{
+    return {arr, N};
+}
+
+
+// The generated tables are sorted, so all lookups are binary searches.
+inline const ap_item_def_t* ap_find_item_def(ap_table_t<ap_item_def_t> table, int64_t id)
+{
+    auto it = std::lower_bound(table.begin(), table.end(), id,
+        [](const ap_item_def_t& def, int64_t id) { return def.id < id; });
+    if (it == table.end() || it->id != id) return nullptr;
+    return it;
+}
+
+
+inline const ap_location_def_t* ap_find_location_def(ap_table_t<ap_location_def_t> table, int ep, int map, int index)
+{
+    auto less = [](const ap_location_def_t& a, const ap_location_def_t& b)
+    {
+        if (a.ep != b.ep) return a.ep < b.ep;
+        if (a.map != b.map) return a.map < b.map;
+        return a.index < b.index;
+    };
+    ap_location_def_t key = {ep, map, index, 0};
+    auto it = std::lower_bound(table.begin(), table.end(), key, less);
+    if (it == table.end() || less(key, *it)) return nullptr;
+    return it;
+}
+
+
+inline const char* ap_find_type_sprite(ap_table_t<ap_type_sprite_t> table, int doom_type)
+{
+    auto it = std::lower_bound(table.begin(), table.end(), doom_type,
+        [](const ap_type_sprite_t& def, int doom_type) { return def.doom_type < doom_type; });
+    if (it == table.end() || it->doom_type != doom_type) return nullptr;
+    return it->sprite;
+}
@@ -88,6 +88,7 @@ typedef struct
 	// "APiness" config variables
 	int ap_automapicons;
 	int ap_levelselectmusic;
+	int ap_dynamicdetail;
 
 	// [crispy] in-game switches and variables
 	int screenshotmsg;
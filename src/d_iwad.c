@@ -869,12 +869,154 @@ char *D_TryFindWADByName(const char *filename)
 // should be executed (notably loading PWADs).
 //
 
+//
+// [AP] IWAD discovery cache. Probing the registry, Steam, GOG and every
+// IWAD directory costs a lot on network homes or with a slow virus
+// scanner, so what D_FindIWAD found is kept in the config directory as
+// "key<TAB>mtime<TAB>path" lines. An entry is only used while its file
+// still has the same mtime, otherwise the search runs again.
+//
+
+#define IWAD_CACHE_FILENAME "iwadcache.txt"
+
+static char *IWADCachePath(void)
+{
+    if (configdir == NULL)
+    {
+        return NULL;
+    }
+
+    return M_StringJoin(configdir, IWAD_CACHE_FILENAME, NULL);
+}
+
+static boolean IWADModifiedTime(const char *path, long *mtime)
+{
+    struct stat st;
+
+    if (M_stat(path, &st) != 0 || (st.st_mode & S_IFMT) != S_IFREG)
+    {
+        return false;
+    }
+
+    *mtime = (long) st.st_mtime;
+    return true;
+}
+
+static char *LookupIWADCache(const char *key)
+{
+    char *cache_path = IWADCachePath();
+    char *result = NULL;
+    char line[1024];
+    FILE *f;
+
+    if (cache_path == NULL)
+    {
+        return NULL;
+    }
+
+    f = M_fopen(cache_path, "r");
+    free(cache_path);
+
+    if (f == NULL)
+    {
+        return NULL;
+    }
+
+    while (result == NULL && fgets(line, sizeof(line), f) != NULL)
+    {
+        char *mtime_str, *path;
+        long mtime;
+
+        line[strcspn(line, "\r\n")] = '\0';
+
+        mtime_str = strchr(line, '\t');
+        if (mtime_str == NULL)
+        {
+            continue;
+        }
+        *mtime_str++ = '\0';
+
+        path = strchr(mtime_str, '\t');
+        if (path == NULL || strcmp(line, key) != 0)
+        {
+            continue;
+        }
+        *path++ = '\0';
+
+        if (IWADModifiedTime(path, &mtime) && mtime == atol(mtime_str))
+        {
+            result = M_StringDuplicate(path);
+        }
+        else
+        {
+            break; // Stale, search again
+        }
+    }
+
+    fclose(f);
+    return result;
+}
+
+static void StoreIWADCache(const char *key, const char *path)
+{
+    char *cache_path = IWADCachePath();
+    char **lines = NULL;
+    int num_lines = 0;
+    char line[1024];
+    long mtime;
+    FILE *f;
+    int i;
+
+    if (cache_path == NULL || !IWADModifiedTime(path, &mtime))
+    {
+        free(cache_path);
+        return;
+    }
+
+    // Keep the other keys' entries
+    f = M_fopen(cache_path, "r");
+    if (f != NULL)
+    {
+        const size_t key_len = strlen(key);
+
+        while (fgets(line, sizeof(line), f) != NULL)
+        {
+            if (!strncmp(line, key, key_len) && line[key_len] == '\t')
+            {
+                continue;
+            }
+            lines = I_Realloc(lines, (num_lines + 1) * sizeof(*lines));
+            lines[num_lines++] = M_StringDuplicate(line);
+        }
+        fclose(f);
+    }
+
+    f = M_fopen(cache_path, "w");
+    if (f != NULL)
+    {
+        for (i = 0; i < num_lines; ++i)
+        {
+            fputs(lines[i], f);
+        }
+        fprintf(f, "%s\t%ld\t%s\n", key, mtime, path);
+        fclose(f);
+    }
+
+    for (i = 0; i < num_lines; ++i)
+    {
+        free(lines[i]);
+    }
+    free(lines);
+    free(cache_path);
+}
+
 char *D_FindIWAD(int mask, GameMission_t *mission)
 {
     char *result;
     const char *iwadfile;
     int iwadparm;
     int i;
+    char cache_key[64];
 
     // Check for the -iwad parameter
 
@@ -892,11 +1034,18 @@ char *D_FindIWAD(int mask, GameMission_t *mission)
 
         iwadfile = myargv[iwadparm + 1];
 
-        result = D_FindWADByName(iwadfile);
+        result = LookupIWADCache(iwadfile);
 
         if (result == NULL)
         {
-            I_Error("IWAD file '%s' not found!", iwadfile);
+            result = D_FindWADByName(iwadfile);
+
+            if (result == NULL)
+            {
+                I_Error("IWAD file '%s' not found!", iwadfile);
+            }
+
+            StoreIWADCache(iwadfile, result);
         }
         
         *mission = IdentifyIWADByName(result, mask);
@@ -905,7 +1054,14 @@ char *D_FindIWAD(int mask, GameMission_t *mission)
     {
         // Search through the list and look for an IWAD
 
-        result = NULL;
+        M_snprintf(cache_key, sizeof(cache_key), "*mask=%d", mask);
+        result = LookupIWADCache(cache_key);
+
+        if (result != NULL)
+        {
+            *mission = IdentifyIWADByName(result, mask);
+            return result;
+        }
 
         BuildIWADDirList();
     
@@ -913,6 +1069,11 @@ char *D_FindIWAD(int mask, GameMission_t *mission)
         {
             result = SearchDirectoryForIWAD(iwad_dirs[i], mask, mission);
         }
+
+        if (result != NULL)
+        {
+            StoreIWADCache(cache_key, result);
+        }
     }
 
     return result;
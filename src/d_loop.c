@@ -24,11 +24,13 @@
 #include "d_ticcmd.h"
 
 #include "i_system.h"
+#include "i_task.h"
 #include "i_timer.h"
 #include "i_video.h"
 
 #include "m_argv.h"
 #include "m_fixed.h"
+#include "m_prof.h"
 
 #include "net_client.h"
 #include "net_gui.h"
@@ -56,6 +58,11 @@ typedef struct
 // instead for better responsiveness of the menu when we're stuck.
 #define MAX_NETGAME_STALL_TICS  5
 
+// [AP] How far ahead of the last confirmed tic -predict may run, and how
+// far behind the snapshot may fall before it is taken again.
+#define MAX_PREDICTED_TICS      8
+#define MAX_SNAPSHOT_AGE        (BACKUPTICS / 4)
+
 //
 // gametic is the tic about to (or currently being) run
 // maketic is the tic that hasn't had control made for it yet
@@ -116,6 +123,18 @@ static loop_interface_t *loop_interface = NULL;
 
 static boolean local_playeringame[NET_MAXPLAYERS];
 
+// [AP] Client-side prediction. gametic counts the predicted tics too;
+// predict_base is the tic the snapshot was taken at, and tics below
+// replay_until have already been shown once.
+
+static boolean predict;
+static int predict_tics;
+static int predict_base;
+static int replay_until;
+static ticcmd_set_t predicted[BACKUPTICS];
+
+boolean predicted_tic, replaying_tic;
+
 // Requested player class "sent" to the server on connect.
 // If we are only doing a single player game then this needs to be remembered
 // and saved in the game settings.
@@ -147,7 +166,7 @@ static boolean BuildNewTic(void)
     int	gameticdiv;
     ticcmd_t cmd;
 
-    gameticdiv = gametic/ticdup;
+    gameticdiv = (gametic - predict_tics)/ticdup;
 
     I_StartTic ();
     loop_interface->ProcessEvents();
@@ -423,6 +442,20 @@ void D_StartNetGame(net_gamesettings_t *settings,
         I_Error("D_StartNetGame: invalid ticdup value (%d)", ticdup);
     }
 
+    //!
+    // @category net
+    //
+    // Hide network latency in a netgame by running ahead with guessed
+    // commands for the other players, rolling the game back when the
+    // real commands turn out to be different.
+    //
+
+    predict = M_ParmExists("-predict") && net_client_connected && !drone
+           && new_sync && ticdup == 1
+           && loop_interface->CanPredict != NULL
+           && loop_interface->SaveState != NULL
+           && loop_interface->RestoreState != NULL;
+
     // TODO: Message disabled until we fix new_sync.
     //if (!new_sync)
     //{
@@ -676,6 +709,171 @@ static void SinglePlayerClear(ticcmd_set_t *set)
 
 void tick_sticky_msgs();
 
+// [AP] Guessed commands must not include anything that acts outside of
+// the game state, such as pausing, saving or chatting.
+
+static boolean SafeToPredict(ticcmd_set_t *set)
+{
+    unsigned int i;
+
+    for (i = 0; i < NET_MAXPLAYERS; ++i)
+    {
+        if (set->ingame[i]
+         && (set->cmds[i].chatchar != 0
+          || (set->cmds[i].buttons & BT_SPECIAL) != 0))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// [AP] The consistency byte is derived from the sender's view of the game
+// state, so it is left out when checking a guess.
+
+static boolean TiccmdsMatch(const ticcmd_t *a, const ticcmd_t *b)
+{
+    return a->forwardmove == b->forwardmove
+        && a->sidemove == b->sidemove
+        && a->angleturn == b->angleturn
+        && a->chatchar == b->chatchar
+        && a->buttons == b->buttons
+        && a->buttons2 == b->buttons2
+        && a->inventory == b->inventory
+        && a->lookfly == b->lookfly
+        && a->arti == b->arti
+        && a->lookdir == b->lookdir;
+}
+
+static boolean PredictionMatches(int tic)
+{
+    ticcmd_set_t *real = &ticdata[tic % BACKUPTICS];
+    ticcmd_set_t *guess = &predicted[tic % BACKUPTICS];
+    unsigned int i;
+
+    for (i = 0; i < NET_MAXPLAYERS; ++i)
+    {
+        if (real->ingame[i] != guess->ingame[i])
+        {
+            return false;
+        }
+
+        if (real->ingame[i] && !TiccmdsMatch(&real->cmds[i], &guess->cmds[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// [AP] Go back to the snapshot; TryRunTics then runs the confirmed tics
+// since again.
+
+static void RollBack(void)
+{
+    loop_interface->RestoreState();
+
+    if (gametic > replay_until)
+    {
+        replay_until = gametic;
+    }
+
+    gametic = predict_base;
+    predict_tics = 0;
+}
+
+// [AP] Check the predicted tics against the real commands received so
+// far, and roll back at the first one that was guessed wrong.
+
+static void ConfirmPredictedTics(int lowtic)
+{
+    int confirmed = gametic - predict_tics;
+
+    while (predict_tics > 0 && confirmed < lowtic)
+    {
+        if (!PredictionMatches(confirmed))
+        {
+            RollBack();
+            return;
+        }
+
+        ++confirmed;
+        --predict_tics;
+    }
+
+    // The commands from the snapshot onwards must stay in ticdata[].
+
+    if (predict_tics > 0 && confirmed - predict_base >= MAX_SNAPSHOT_AGE)
+    {
+        RollBack();
+    }
+}
+
+// [AP] Run ahead of the other players while their commands for gametic
+// have not arrived, assuming each of them keeps doing what they did on
+// the last confirmed tic.
+
+static void PredictTics(int lowtic)
+{
+    ticcmd_set_t *last;
+    ticcmd_set_t *set;
+    unsigned int i;
+
+    if (lowtic < 1)
+    {
+        return;
+    }
+
+    last = &ticdata[(lowtic - 1) % BACKUPTICS];
+
+    while (gametic < maketic && predict_tics < MAX_PREDICTED_TICS)
+    {
+        set = &predicted[gametic % BACKUPTICS];
+
+        memcpy(set->ingame, last->ingame, sizeof(set->ingame));
+
+        for (i = 0; i < NET_MAXPLAYERS; ++i)
+        {
+            if (i == localplayer)
+            {
+                set->cmds[i] = ticdata[gametic % BACKUPTICS].cmds[i];
+            }
+            else
+            {
+                set->cmds[i] = last->cmds[i];
+            }
+        }
+
+        if (!SafeToPredict(set) || !loop_interface->CanPredict())
+        {
+            break;
+        }
+
+        if (predict_tics == 0)
+        {
+            loop_interface->SaveState();
+            predict_base = gametic;
+        }
+
+        memcpy(local_playeringame, set->ingame, sizeof(local_playeringame));
+
+        predicted_tic = true;
+        replaying_tic = gametic < replay_until;
+        loop_interface->RunTic(set->cmds, set->ingame);
+        predicted_tic = replaying_tic = false;
+
+        if (gametic >= replay_until)
+        {
+            tick_sticky_msgs();
+        }
+
+        gametic++;
+        predict_tics++;
+    }
+}
+
 
 //
 // TryRunTics
@@ -696,6 +894,9 @@ void TryRunTics (void)
     extern int leveltime;
     #define return_early (crispy->uncapped && counts == 0 && leveltime > oldleveltime && screenvisible)
 
+    // [AP] Finished background tasks hand their results back here
+    I_RunTaskCallbacks();
+
     // get real tics
     entertic = I_GetTime() / ticdup;
     realtics = entertic - oldentertics;
@@ -715,6 +916,20 @@ void TryRunTics (void)
 
     lowtic = GetLowTic();
 
+    // [AP] Settle the predicted tics first. Until someone's commands turn
+    // out different, there is nothing to do but keep predicting.
+
+    if (predict_tics > 0)
+    {
+        ConfirmPredictedTics(lowtic);
+
+        if (predict_tics > 0)
+        {
+            PredictTics(lowtic);
+            return;
+        }
+    }
+
     availabletics = lowtic - gametic/ticdup;
 
     // decide how many tics to run
@@ -768,6 +983,13 @@ void TryRunTics (void)
     if (counts < 1)
 	counts = 1;
 
+    // [AP] After a rollback, catch up to where the game was in one go.
+
+    if (gametic < replay_until && counts < availabletics)
+    {
+        counts = availabletics;
+    }
+
     // wait for new tics if needed
     while (!PlayersInGame() || lowtic < gametic/ticdup + counts)
     {
@@ -781,6 +1003,17 @@ void TryRunTics (void)
         // Still no tics to run? Sleep until some are available.
         if (lowtic < gametic/ticdup + counts)
         {
+            // [AP] Or run ahead, once every tic received has been run.
+            if (predict && lowtic == gametic && PlayersInGame())
+            {
+                PredictTics(lowtic);
+
+                if (predict_tics > 0)
+                {
+                    return;
+                }
+            }
+
             // If we're in a netgame, we might spin forever waiting for
             // new network data to be received. So don't stay in here
             // forever - give the menu a chance to work.
@@ -796,7 +1029,9 @@ void TryRunTics (void)
     // run the count * ticdup dics
     while (counts--)
     {
+        M_ProfBegin(PROF_AP);
         apdoom_update();
+        M_ProfEnd(PROF_AP);
 
         ticcmd_set_t *set;
 
@@ -819,14 +1054,19 @@ void TryRunTics (void)
 
             memcpy(local_playeringame, set->ingame, sizeof(local_playeringame));
 
+            replaying_tic = gametic < replay_until;
             loop_interface->RunTic(set->cmds, set->ingame);
+            replaying_tic = false;
 	    gametic++;
 
 	    // modify command for duplicated tics
 
             TicdupSquash(set);
 
-            tick_sticky_msgs();
+            if (gametic > replay_until)
+            {
+                tick_sticky_msgs();
+            }
 	}
 
 	NetUpdate ();	// check for new console commands
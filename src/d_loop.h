@@ -48,6 +48,17 @@ typedef struct
     // Run the menu (runs independently of the game).
 
     void (*RunMenu)();
+
+    // [AP] Optional, for -predict: returns true if the game is in a
+    // state where tics can be run speculatively and rolled back.
+
+    boolean (*CanPredict)(void);
+
+    // [AP] Optional, for -predict: keep a snapshot of the game state in
+    // memory, and go back to it.
+
+    void (*SaveState)(void);
+    void (*RestoreState)(void);
 } loop_interface_t;
 
 // Register callback functions for the main loop code to use.
@@ -80,6 +91,10 @@ extern boolean singletics;
 extern int gametic, ticdup;
 extern int oldleveltime; // [crispy] check if leveltime keeps tickin'
 
+// [AP] Set while RunTic is running a tic with guessed commands for the
+// other players, or running again a tic that has already been shown.
+extern boolean predicted_tic, replaying_tic;
+
 // Check if it is permitted to record a demo with a non-vanilla feature.
 boolean D_NonVanillaRecord(boolean conditional, const char *feature);
 
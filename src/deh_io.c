@@ -39,24 +39,20 @@ struct deh_context_s
     deh_input_type_t type;
     char *filename;
 
-    // If the input comes from a memory buffer, pointer to the memory
-    // buffer.
+    // [AP] The whole input, read in when it's opened: the lump itself,
+    // or a copy of the file.
     unsigned char *input_buffer;
     size_t input_buffer_len;
     unsigned int input_buffer_pos;
     int lumpnum;
 
-    // If the input comes from a file, the file stream for reading
-    // data.
-    FILE *stream;
-
     // Current line number that we have reached:
     int linenum;
 
-    // Used by DEH_ReadLine:
+    // Used by DEH_ReadLine. A line is never longer than the input, so
+    // [AP] the buffer is made that big to start with.
     boolean last_was_newline;
     char *readbuffer;
-    int readbuffer_size;
 
     // Error handling.
     boolean had_error;
@@ -65,16 +61,16 @@ struct deh_context_s
     long linestart;
 };
 
-static deh_context_t *DEH_NewContext(void)
+static deh_context_t *DEH_NewContext(unsigned char *buffer, size_t len)
 {
     deh_context_t *context;
 
     context = Z_Malloc(sizeof(*context), PU_STATIC, NULL);
 
-    // Initial read buffer size of 128 bytes
-
-    context->readbuffer_size = 128;
-    context->readbuffer = Z_Malloc(context->readbuffer_size, PU_STATIC, NULL);
+    context->input_buffer = buffer;
+    context->input_buffer_len = len;
+    context->input_buffer_pos = 0;
+    context->readbuffer = Z_Malloc(len + 1, PU_STATIC, NULL);
     context->linenum = 0;
     context->last_was_newline = true;
 
@@ -91,16 +87,30 @@ deh_context_t *DEH_OpenFile(const char *filename)
 {
     FILE *fstream;
     deh_context_t *context;
+    unsigned char *buffer;
+    long len;
 
-    fstream = M_fopen(filename, "r");
+    fstream = M_fopen(filename, "rb");
 
     if (fstream == NULL)
         return NULL;
 
-    context = DEH_NewContext();
+    // [AP] Read it all in one go; lines are split from memory
+    len = M_FileLength(fstream);
+    buffer = malloc(len > 0 ? len : 1);
+
+    if (buffer == NULL || (len > 0 && fread(buffer, 1, len, fstream) != (size_t) len))
+    {
+        free(buffer);
+        fclose(fstream);
+        return NULL;
+    }
+
+    fclose(fstream);
+
+    context = DEH_NewContext(buffer, len);
 
     context->type = DEH_INPUT_FILE;
-    context->stream = fstream;
     context->filename = M_StringDuplicate(filename);
 
     return context;
@@ -115,13 +125,10 @@ deh_context_t *DEH_OpenLump(int lumpnum)
 
     lump = W_CacheLumpNum(lumpnum, PU_STATIC);
 
-    context = DEH_NewContext();
+    context = DEH_NewContext(lump, W_LumpLength(lumpnum));
 
     context->type = DEH_INPUT_LUMP;
     context->lumpnum = lumpnum;
-    context->input_buffer = lump;
-    context->input_buffer_len = W_LumpLength(lumpnum);
-    context->input_buffer_pos = 0;
 
     context->filename = malloc(9);
     M_StringCopy(context->filename, lumpinfo[lumpnum]->name, 9);
@@ -135,7 +142,7 @@ void DEH_CloseFile(deh_context_t *context)
 {
     if (context->type == DEH_INPUT_FILE)
     {
-        fclose(context->stream);
+        free(context->input_buffer);
     }
     else if (context->type == DEH_INPUT_LUMP)
     {
@@ -147,40 +154,16 @@ void DEH_CloseFile(deh_context_t *context)
     Z_Free(context);
 }
 
-int DEH_GetCharFile(deh_context_t *context)
-{
-    if (feof(context->stream))
-    {
-        // end of file
-
-        return -1;
-    }
-
-    return fgetc(context->stream);
-}
+// Reads a single character from a dehacked file, converting CRLF to LF.
+// [AP] Inlined into DEH_ReadLine, which calls it for every character.
 
-int DEH_GetCharLump(deh_context_t *context)
+static inline int GetChar(deh_context_t *context)
 {
+    const unsigned char *const buffer = context->input_buffer;
+    const size_t len = context->input_buffer_len;
+    unsigned int pos = context->input_buffer_pos;
     int result;
 
-    if (context->input_buffer_pos >= context->input_buffer_len)
-    {
-        return -1;
-    }
-
-    result = context->input_buffer[context->input_buffer_pos];
-    ++context->input_buffer_pos;
-
-    return result;
-}
-
-// Reads a single character from a dehacked file
-
-int DEH_GetChar(deh_context_t *context)
-{
-    int result = 0;
-    boolean last_was_cr = false;
-
     // Track the current line number
 
     if (context->last_was_newline)
@@ -188,77 +171,51 @@ int DEH_GetChar(deh_context_t *context)
         ++context->linenum;
     }
 
-    // Read characters, converting CRLF to LF
-
-    do
+    if (pos >= len)
     {
-        switch (context->type)
-        {
-            case DEH_INPUT_FILE:
-                result = DEH_GetCharFile(context);
-                break;
-
-            case DEH_INPUT_LUMP:
-                result = DEH_GetCharLump(context);
-                break;
-        }
+        result = -1;
+    }
+    else
+    {
+        result = buffer[pos++];
 
-        // Handle \r characters not paired with \n
-        if (last_was_cr && result != '\n')
+        // \r characters not paired with \n are returned as they are
+        if (result == '\r' && pos < len && buffer[pos] == '\n')
         {
-            switch (context->type)
-            {
-                case DEH_INPUT_FILE:
-                    ungetc(result, context->stream);
-                    break;
-
-                case DEH_INPUT_LUMP:
-                    --context->input_buffer_pos;
-                    break;
-            }
-
-            return '\r';
+            result = buffer[pos++];
         }
+    }
 
-        last_was_cr = result == '\r';
-
-    } while (last_was_cr);
-
+    context->input_buffer_pos = pos;
     context->last_was_newline = result == '\n';
 
     return result;
 }
 
-// Increase the read buffer size
-
-static void IncreaseReadBuffer(deh_context_t *context)
+int DEH_GetChar(deh_context_t *context)
 {
-    char *newbuffer;
-    int newbuffer_size;
+    return GetChar(context);
+}
 
-    newbuffer_size = context->readbuffer_size * 2;
-    newbuffer = Z_Malloc(newbuffer_size, PU_STATIC, NULL);
+// [AP] Case insensitive string hash, for looking up section and field
+// names without comparing against each in turn.
 
-    memcpy(newbuffer, context->readbuffer, context->readbuffer_size);
+unsigned int DEH_NameHash(const char *name)
+{
+    unsigned int result = 5381;
 
-    Z_Free(context->readbuffer);
+    for (; *name != '\0'; ++name)
+    {
+        result = result * 33 + tolower((unsigned char) *name);
+    }
 
-    context->readbuffer = newbuffer;
-    context->readbuffer_size = newbuffer_size;
+    return result;
 }
 
 // [crispy] Save pointer to start of current line ...
 void DEH_SaveLineStart (deh_context_t *context)
 {
-    if (context->type == DEH_INPUT_FILE)
-    {
-	context->linestart = ftell(context->stream);
-    }
-    else
-    if (context->type == DEH_INPUT_LUMP)
-    {
-	context->linestart = context->input_buffer_pos;
-    }
+    context->linestart = context->input_buffer_pos;
 }
 
 // [crispy] ... and reset context to start of current line
@@ -269,15 +226,7 @@ void DEH_RestoreLineStart (deh_context_t *context)
     if (context->linestart < 0)
 	return;
 
-    if (context->type == DEH_INPUT_FILE)
-    {
-	fseek(context->stream, context->linestart, SEEK_SET);
-    }
-    else
-    if (context->type == DEH_INPUT_LUMP)
-    {
-	context->input_buffer_pos = context->linestart;
-    }
+    context->input_buffer_pos = context->linestart;
 
     // [crispy] don't count this line twice
     --context->linenum;
@@ -293,7 +242,7 @@ char *DEH_ReadLine(deh_context_t *context, boolean extended)
 
     for (pos = 0;;)
     {
-        c = DEH_GetChar(context);
+        c = GetChar(context);
 
         if (c < 0 && pos == 0)
         {
@@ -302,17 +251,10 @@ char *DEH_ReadLine(deh_context_t *context, boolean extended)
             return NULL;
         }
 
-        // cope with lines of any length: increase the buffer size
-
-        if (pos >= context->readbuffer_size)
-        {
-            IncreaseReadBuffer(context);
-        }
-
         // extended string support
         if (extended && c == '\\')
         {
-            c = DEH_GetChar(context);
+            c = GetChar(context);
 
             // "\n" in the middle of a string indicates an internal linefeed
             if (c == 'n')
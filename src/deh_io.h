@@ -29,6 +29,7 @@ void DEH_Error(deh_context_t *context, const char *msg, ...) PRINTF_ATTR(2, 3);
 void DEH_Warning(deh_context_t *context, const char *msg, ...) PRINTF_ATTR(2, 3);
 boolean DEH_HadError(deh_context_t *context);
 char *DEH_FileName(deh_context_t *context); // [crispy] returns filename
+unsigned int DEH_NameHash(const char *name); // [AP] ignores case
 
 #endif /* #ifndef DEH_IO_H */
 
@@ -85,10 +85,33 @@ void DEH_Checksum(sha1_digest_t digest)
     SHA1_Final(digest, &sha1_context);
 }
 
+// [AP] Sections by name, so a section start is one hash rather than a
+// compare against every section type. No game has more than a couple of
+// dozen.
+
+#define SECTION_HASH_SIZE 64
+
+static deh_section_t *section_hash[SECTION_HASH_SIZE];
+static deh_section_t *strings_section = NULL;
+
+static deh_section_t **SectionHashSlot(const char *name)
+{
+    unsigned int slot = DEH_NameHash(name) % SECTION_HASH_SIZE;
+
+    while (section_hash[slot] != NULL
+        && strcasecmp(section_hash[slot]->name, name))
+    {
+        slot = (slot + 1) % SECTION_HASH_SIZE;
+    }
+
+    return &section_hash[slot];
+}
+
 // Called on startup to call the Init functions
 
 static void InitializeSections(void)
 {
+    deh_section_t **slot;
     unsigned int i;
 
     for (i=0; deh_section_types[i] != NULL; ++i)
@@ -97,7 +120,16 @@ static void InitializeSections(void)
         {
             deh_section_types[i]->init();
         }
+
+        // [AP] the first of any two with the same name wins, as before
+        slot = SectionHashSlot(deh_section_types[i]->name);
+        if (*slot == NULL && i < SECTION_HASH_SIZE - 1)
+        {
+            *slot = deh_section_types[i];
+        }
     }
+
+    strings_section = *SectionHashSlot("[STRINGS]");
 }
 
 void DEH_Init(void) // [crispy] un-static
@@ -123,8 +155,6 @@ void DEH_Init(void) // [crispy] un-static
 
 static deh_section_t *GetSectionByName(char *name)
 {
-    unsigned int i;
-
     // we explicitely do not recognize [STRINGS] sections at all
     // if extended strings are not allowed
 
@@ -133,15 +163,7 @@ static deh_section_t *GetSectionByName(char *name)
         return NULL;
     }
 
-    for (i=0; deh_section_types[i] != NULL; ++i)
-    {
-        if (!strcasecmp(deh_section_types[i]->name, name))
-        {
-            return deh_section_types[i];
-        }
-    }
-
-    return NULL;
+    return *SectionHashSlot(name);
 }
 
 // Is the string passed just whitespace?
@@ -329,7 +351,7 @@ static void DEH_ParseContext(deh_context_t *context)
         // Read the next line. We only allow the special extended parsing
         // for the BEX [STRINGS] section.
         extended = current_section != NULL
-                && !strcasecmp(current_section->name, "[STRINGS]");
+                && current_section == strings_section;
         // [crispy] save pointer to start of line, just in case
         DEH_SaveLineStart(context);
         line = DEH_ReadLine(context, extended);
@@ -27,26 +27,65 @@
 
 #include "deh_mapping.h"
 
+// [AP] Finds name's slot in the mapping's hash: the one holding its
+// entry, or the empty one it would go in.
+
+static byte *MappingHashSlot(deh_mapping_t *mapping, const char *name)
+{
+    unsigned int slot = DEH_NameHash(name) % MAPPING_HASH_SIZE;
+
+    while (mapping->hash[slot] != 0
+        && strcasecmp(mapping->entries[mapping->hash[slot] - 1].name, name))
+    {
+        slot = (slot + 1) % MAPPING_HASH_SIZE;
+    }
+
+    return &mapping->hash[slot];
+}
+
+static void HashMapping(deh_mapping_t *mapping)
+{
+    byte *slot;
+    int i;
+
+    for (i=0; i < MAX_MAPPING_ENTRIES && mapping->entries[i].name != NULL; ++i)
+    {
+        // The first of any two with the same name wins, as before
+        slot = MappingHashSlot(mapping, mapping->entries[i].name);
+
+        if (*slot == 0)
+        {
+            *slot = i + 1;
+        }
+    }
+
+    mapping->hashed = true;
+}
+
 static deh_mapping_entry_t *GetMappingEntryByName(deh_context_t *context,
                                                   deh_mapping_t *mapping,
                                                   char *name)
 {
-    int i;
+    byte *slot;
 
-    for (i=0; mapping->entries[i].name != NULL; ++i)
+    if (!mapping->hashed)
     {
-        deh_mapping_entry_t *entry = &mapping->entries[i];
+        HashMapping(mapping);
+    }
 
-        if (!strcasecmp(entry->name, name))
-        {
-            if (entry->location == NULL)
-            {
-                DEH_Warning(context, "Field '%s' is unsupported", name);
-                return NULL;
-            }
+    slot = MappingHashSlot(mapping, name);
+
+    if (*slot != 0)
+    {
+        deh_mapping_entry_t *entry = &mapping->entries[*slot - 1];
 
-            return entry;
+        if (entry->location == NULL)
+        {
+            DEH_Warning(context, "Field '%s' is unsupported", name);
+            return NULL;
         }
+
+        return entry;
     }
 
     // Not found.
@@ -53,6 +53,10 @@
 
 #define MAX_MAPPING_ENTRIES 32
 
+// [AP] Entries by name, built on the first lookup. Slots hold an entry's
+// index plus one, zero is empty.
+#define MAPPING_HASH_SIZE (MAX_MAPPING_ENTRIES * 2)
+
 typedef struct deh_mapping_s deh_mapping_t;
 typedef struct deh_mapping_entry_s deh_mapping_entry_t;
 
@@ -80,6 +84,8 @@ struct deh_mapping_s
 {
     void *base;
     deh_mapping_entry_t entries[MAX_MAPPING_ENTRIES];
+    boolean hashed; // [AP]
+    byte hash[MAPPING_HASH_SIZE];
 };
 
 boolean DEH_SetMapping(deh_context_t *context, deh_mapping_t *mapping,
@@ -36,6 +36,19 @@ static deh_substitution_t **hash_table = NULL;
 static int hash_table_entries;
 static int hash_table_length = -1;
 
+// [AP] Replacements of string literals, looked up by address. Emptied
+// whenever a replacement is added, since that can free an old to_text.
+
+#define LITERAL_CACHE_SIZE 512
+
+typedef struct
+{
+    const char *from;
+    const char *to;
+} deh_literal_t;
+
+static deh_literal_t literal_cache[LITERAL_CACHE_SIZE];
+
 // This is the algorithm used by glib
 
 static unsigned int strhash(const char *s)
@@ -80,7 +93,7 @@ static deh_substitution_t *SubstitutionForString(const char *s)
 // Look up a string to see if it has been replaced with something else
 // This will be used throughout the program to substitute text
 
-const char *DEH_String(const char *s)
+const char *(DEH_String)(const char *s)
 {
     deh_substitution_t *subst;
 
@@ -96,6 +109,30 @@ const char *DEH_String(const char *s)
     }
 }
 
+// [AP] As DEH_String, for a pointer whose text never changes.
+
+const char *DEH_StringLiteral(const char *s)
+{
+    deh_literal_t *lit;
+    uintptr_t key;
+
+    if (hash_table_length < 0)
+    {
+        return s;
+    }
+
+    key = (uintptr_t) s;
+    lit = &literal_cache[((key >> 3) ^ (key >> 12)) % LITERAL_CACHE_SIZE];
+
+    if (lit->from != s)
+    {
+        lit->from = s;
+        lit->to = (DEH_String)(s);
+    }
+
+    return lit->to;
+}
+
 // [crispy] returns true if a string has been substituted
 
 boolean DEH_HasStringReplacement(const char *s)
@@ -183,6 +220,8 @@ void DEH_AddStringReplacement(const char *from_text, const char *to_text)
         InitHashTable();
     }
 
+    memset(literal_cache, 0, sizeof(literal_cache));
+
     // Check to see if there is an existing substitution already in place.
     sub = SubstitutionForString(from_text);
 
@@ -31,6 +31,17 @@ void DEH_snprintf(char *buffer, size_t len, const char *fmt, ...) PRINTF_ATTR(3,
 void DEH_AddStringReplacement(const char *from_text, const char *to_text);
 boolean DEH_HasStringReplacement(const char *s);
 
+// [AP] A string literal's text never changes, so its replacement can be
+// remembered by address rather than found by hashing the text each time.
+// Anything that isn't known to be a literal still goes through the hash.
+
+const char *DEH_StringLiteral(const char *s);
+
+#if defined(__GNUC__)
+#define DEH_String(x) \
+    (__builtin_constant_p(x) ? DEH_StringLiteral(x) : DEH_String(x))
+#endif
+
 
 #if 0
 // Static macro versions of the functions above
@@ -333,6 +333,7 @@ void AM_rotate (int64_t *x, int64_t *y, angle_t a);
 static void AM_rotatePoint (mpoint_t *pt);
 static mpoint_t mapcenter;
 static angle_t mapangle;
+static const vertex_t *am_vertexlevel; // [AP] see AM_updateVertexCache
 
 static void AM_drawCrosshair(int color, boolean force);
 
@@ -627,6 +628,7 @@ void AM_LevelInit(boolean reinit)
     static int precalc_once;
 
     leveljuststarted = 0;
+    am_vertexlevel = NULL; // [AP] rebuild the vertex cache
 
     f_x = f_y = 0;
     f_w = SCREENWIDTH;
@@ -1615,22 +1617,63 @@ static keycolor_t AM_DoorColor(int type)
   return no_key;
 }
 
+// [AP] Automap coordinates of every vertex, already rotated, so each
+// vertex is transformed once instead of once per line using it. Only
+// rebuilt when the rotation angle or the map center changes.
+static mpoint_t *am_vertexes;
+static int am_maxvertexes;
+static int am_numvertexes;
+static boolean am_vertexrotated;
+static angle_t am_vertexangle;
+static mpoint_t am_vertexcenter;
+
+static void AM_updateVertexCache (void)
+{
+    const angle_t angle = followplayer ? ANG90 - viewangle : mapangle;
+    int i;
+
+    if (am_vertexlevel == vertexes && am_numvertexes == numvertexes &&
+        am_vertexrotated == crispy->automaprotate &&
+        (!am_vertexrotated || (am_vertexangle == angle &&
+                               am_vertexcenter.x == mapcenter.x &&
+                               am_vertexcenter.y == mapcenter.y)))
+    {
+	return;
+    }
+
+    if (numvertexes > am_maxvertexes)
+    {
+	am_maxvertexes = numvertexes;
+	am_vertexes = I_Realloc(am_vertexes, am_maxvertexes * sizeof(*am_vertexes));
+    }
+
+    for (i = 0; i < numvertexes; i++)
+    {
+	am_vertexes[i].x = vertexes[i].x >> FRACTOMAPBITS;
+	am_vertexes[i].y = vertexes[i].y >> FRACTOMAPBITS;
+
+	if (crispy->automaprotate)
+	    AM_rotatePoint(&am_vertexes[i]);
+    }
+
+    am_vertexlevel = vertexes;
+    am_numvertexes = numvertexes;
+    am_vertexrotated = crispy->automaprotate;
+    am_vertexangle = angle;
+    am_vertexcenter = mapcenter;
+}
+
 void AM_drawWalls(void)
 {
     int i;
     static mline_t l;
 
+    AM_updateVertexCache();
+
     for (i=0;i<numlines;i++)
     {
-	l.a.x = lines[i].v1->x >> FRACTOMAPBITS;
-	l.a.y = lines[i].v1->y >> FRACTOMAPBITS;
-	l.b.x = lines[i].v2->x >> FRACTOMAPBITS;
-	l.b.y = lines[i].v2->y >> FRACTOMAPBITS;
-	if (crispy->automaprotate)
-	{
-	    AM_rotatePoint(&l.a);
-	    AM_rotatePoint(&l.b);
-	}
+	l.a = am_vertexes[lines[i].v1 - vertexes];
+	l.b = am_vertexes[lines[i].v2 - vertexes];
 	if (cheating || (lines[i].flags & ML_MAPPED))
 	{
 	    if ((lines[i].flags & LINE_NEVERSEE) && !cheating)
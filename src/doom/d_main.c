@@ -52,6 +52,7 @@
 #include "m_controls.h"
 #include "m_misc.h"
 #include "m_menu.h"
+#include "m_prof.h"
 #include "p_saveg.h"
 
 #include "i_endoom.h"
@@ -85,6 +86,7 @@
 #include "apdoom.h"
 #include "deh_misc.h"
 #include "ap_notif.h"
+#include "hu_lib.h" // [AP] HUlib_drawText, for ap_notif_draw
 
 //
 // D-DoomLoop()
@@ -192,11 +194,12 @@ boolean is_in_level(int ep, int map)
 
 
 // Kind of a copy of P_TouchSpecialThing
-void on_ap_give_item(int doom_type, int ep, int map)
+// Returns the pickup sound, or sfx_None if nothing was given.
+static int give_ap_item(int doom_type, int ep, int map)
 {
     player_t* player = &players[consoleplayer];
     int sound = sfx_itemup;
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     switch (doom_type)
     {
@@ -309,7 +312,7 @@ void on_ap_give_item(int doom_type, int ep, int map)
             break;
         case 2023: // Berserk
             if (!P_GivePower(player, pw_strength))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTBERSERK);
             if (player->readyweapon != wp_fist)
                 player->pendingweapon = wp_fist;
@@ -327,21 +330,21 @@ void on_ap_give_item(int doom_type, int ep, int map)
             break;
         case 2022: // Invulnerability
             if (!P_GivePower (player, pw_invulnerability))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTINVUL);
             if (gameversion > exe_doom_1_2)
                 sound = sfx_getpow;
             break;
         case 2024: // Partial invisibility
             if (!P_GivePower (player, pw_invisibility))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTINVIS);
             if (gameversion > exe_doom_1_2)
                 sound = sfx_getpow;
             break;
         case 83: // Megasphere
 	        if (gamemode != commercial)
-	            return;
+	            return sfx_None;
 	        player->health = deh_megasphere_health;
 	        player->mo->health = player->health;
                 // We always give armor type 2 for the megasphere; dehacked only 
@@ -355,31 +358,78 @@ void on_ap_give_item(int doom_type, int ep, int map)
         // Junk
         case 2012: // Medikit
 	        if (!P_GiveBody(player, 25))
-	            return;
+	            return sfx_None;
             break;
         case 2048: // Box of bullets
             if (!P_GiveAmmo(player, am_clip, 5, false))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTCLIPBOX);
             break;
         case 2046: // Box of rockets
             if (!P_GiveAmmo(player, am_misl, 5, false))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTROCKBOX);
             break;
         case 2049: // Box of shotgun shells
             if (!P_GiveAmmo (player, am_shell,5,false))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTSHELLBOX);
             break;
         case 17: // Energy cell pack
             if (!P_GiveAmmo (player, am_cell,5,false))
-                return;
+                return sfx_None;
             player->message = DEH_String(GOTCELLBOX);
             break;
     }
 
-	S_StartSoundOptional (NULL, sound, sfx_itemup); // [NS] Fallback to itemup.
+    return sound;
+}
+
+
+// Louder pickups win when a batch plays a single sound
+static int give_sound_rank(int sound)
+{
+    if (sound == sfx_keyup) return 3;
+    if (sound == sfx_getpow) return 2;
+    if (sound == sfx_wpnup) return 1;
+    return 0;
+}
+
+
+void on_ap_give_item(int doom_type, int ep, int map)
+{
+    int sound = give_ap_item(doom_type, ep, map);
+
+    if (sound != sfx_None)
+    {
+        S_StartSoundOptional (NULL, sound, sfx_itemup); // [NS] Fallback to itemup.
+    }
+}
+
+
+// Batched delivery, used when the server hands us many items at once.
+// Every item is applied, but only one pickup sound is played and the HUD
+// keeps the message of the last item given.
+void on_ap_give_items(const ap_item_t* items, int count)
+{
+    int sound = sfx_None;
+    int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        int item_sound = give_ap_item(items[i].doom_type, items[i].ep, items[i].map);
+
+        if (item_sound != sfx_None
+         && (sound == sfx_None || give_sound_rank(item_sound) > give_sound_rank(sound)))
+        {
+            sound = item_sound;
+        }
+    }
+
+    if (sound != sfx_None)
+    {
+        S_StartSoundOptional (NULL, sound, sfx_itemup); // [NS] Fallback to itemup.
+    }
 }
 
 
@@ -464,7 +514,9 @@ boolean D_Display (void)
 	    redrawsbar = true;
 	if (inhelpscreensstate && !inhelpscreens)
 	    redrawsbar = true;              // just put away the help screen
+	M_ProfBegin (PROF_HUD);
 	ST_Drawer (viewheight == SCREENHEIGHT, redrawsbar );
+	M_ProfEnd (PROF_HUD);
 	fullscreen = viewheight == SCREENHEIGHT;
 	break;
 
@@ -495,13 +547,21 @@ boolean D_Display (void)
 
         // [crispy] Crispy HUD
         if (screenblocks >= CRISPY_HUD)
+        {
+            M_ProfBegin(PROF_HUD);
             ST_Drawer(false, true);
+            M_ProfEnd(PROF_HUD);
+        }
     }
 
     // [crispy] in automap overlay mode,
     // the HUD is drawn on top of everything else
     if (gamestate == GS_LEVEL && gametic && !(automapactive && crispy->automapoverlay))
+    {
+	M_ProfBegin (PROF_HUD);
 	HU_Drawer ();
+	M_ProfEnd (PROF_HUD);
+    }
     
     // clean up border stuff
     if (gamestate != oldgamestate && gamestate != GS_LEVEL)
@@ -548,7 +608,9 @@ boolean D_Display (void)
     if (automapactive && crispy->automapoverlay)
     {
 	AM_Drawer ();
+	M_ProfBegin (PROF_HUD);
 	HU_Drawer ();
+	M_ProfEnd (PROF_HUD);
 
 	// [crispy] force redraw of status bar and border
 	viewactivestate = false;
@@ -587,7 +649,7 @@ boolean D_Display (void)
     M_Drawer ();          // menu is drawn even on top of everything
     if (gamestate != GS_FINALE)
     {
-        ap_notif_draw();
+        ap_notif_draw(HUlib_drawText);
         HU_DrawAPMessages();   // ^ no, Sticky messages on top of everything :)
     }
     NetUpdate ();         // send out any new accumulation
@@ -712,6 +774,7 @@ void D_BindVariables(void)
     M_BindIntVariable("crispy_demotimer",       &crispy->demotimer);
     M_BindIntVariable("crispy_ap_automapicons", &crispy->ap_automapicons);
     M_BindIntVariable("crispy_ap_levelselectmusic", &crispy->ap_levelselectmusic);
+    M_BindIntVariable("crispy_ap_dynamicdetail", &crispy->ap_dynamicdetail);
     M_BindIntVariable("crispy_demotimerdir",    &crispy->demotimerdir);
     M_BindIntVariable("crispy_extautomap",      &crispy->extautomap);
     M_BindIntVariable("crispy_flipcorpses",     &crispy->flipcorpses);
@@ -766,6 +829,60 @@ boolean D_GrabMouseCallback(void)
     return (gamestate == GS_LEVEL) && !demoplayback && !advancedemo;
 }
 
+//
+// [AP] Dynamic detail. With crispy_ap_dynamicdetail set to a frame time in
+// ms, the 3D view switches to low detail while drawing frames takes longer
+// than that, and back once high detail would fit again. Only the view
+// changes resolution, the HUD and status bar don't.
+//
+
+#define DYNDETAIL_HOLD 35 // frames between switches, so it doesn't flicker
+
+static void D_UpdateDynamicDetail(int frame_us)
+{
+    static int avg_us = 0;
+    static int hold = 0;
+    int target_us;
+
+    if (!crispy->ap_dynamicdetail || detailLevel || gamestate != GS_LEVEL)
+    {
+        // Back to the menu's detail setting
+        if (detailshift != detailLevel && !setsizeneeded)
+        {
+            R_SetViewSize(screenblocks, detailLevel);
+        }
+        avg_us = 0;
+        hold = 0;
+        return;
+    }
+
+    avg_us = avg_us ? (avg_us * 7 + frame_us) / 8 : frame_us;
+
+    if (hold > 0)
+    {
+        hold--;
+        return;
+    }
+    if (setsizeneeded)
+    {
+        return;
+    }
+
+    // Low detail draws half the columns, so high detail costs at most
+    // about twice as much.
+    target_us = crispy->ap_dynamicdetail * 1000;
+    if (!detailshift && avg_us > target_us)
+    {
+        R_SetViewSize(screenblocks, 1);
+        hold = DYNDETAIL_HOLD;
+    }
+    else if (detailshift && avg_us * 2 < target_us)
+    {
+        R_SetViewSize(screenblocks, 0);
+        hold = DYNDETAIL_HOLD;
+    }
+}
+
 //
 //  D_RunFrame
 //
@@ -791,6 +908,7 @@ void D_RunFrame()
         I_UpdateNoBlit ();
         M_Drawer ();                            // menu is drawn even on top of wipes
         I_FinishUpdate ();                      // page flip or blit buffer
+        StatFrame(); // [AP]
         return;
     }
 
@@ -799,12 +917,19 @@ void D_RunFrame()
 
     TryRunTics (); // will run at least one tic
 
+    I_PollFileWrites (); // [AP] report savegames written in the background
+
     S_UpdateSounds (players[displayplayer].mo);// move positional sounds
 
     // Update display, next frame, with current state if no profiling is on
     if (screenvisible && !nodrawers)
     {
-        if ((wipe = D_Display ()))
+        uint64_t display_start = I_GetTimeUS();
+
+        wipe = D_Display ();
+        D_UpdateDynamicDetail((int) (I_GetTimeUS() - display_start));
+
+        if (wipe)
         {
             // start wipe on this frame
             wipe_EndScreen(0, 0, SCREENWIDTH, SCREENHEIGHT);
@@ -812,8 +937,19 @@ void D_RunFrame()
             wipestart = I_GetTime () - 1;
         } else {
             // normal update
+            M_ProfBegin(PROF_BLIT);
             I_FinishUpdate ();              // page flip or blit buffer
+            M_ProfEnd(PROF_BLIT);
         }
+
+        M_ProfEndFrame();
+        StatFrame(); // [AP]
+    }
+
+    // [AP] the rest of a screenshot burst, one shot a frame
+    if (screenvisible && !nodrawers && !wipe)
+    {
+        V_ScreenShotBurstFrame();
     }
 
 	// [crispy] post-rendering function pointer to apply config changes
@@ -875,6 +1011,32 @@ void D_DoomLoop (void)
 
 
 
+//
+//  D_SimulateLoop
+//  [AP] Headless -simulate: no window and no frame pacing, just AP and
+//  the game tickers back to back until the demo ends.
+//
+static void D_SimulateLoop (void)
+{
+    static ticcmd_t cmds[MAXPLAYERS];
+
+    // Playback overwrites these, G_Ticker only needs somewhere to copy from
+    netcmds = cmds;
+
+    while (1)
+    {
+        apdoom_update();
+
+        if (advancedemo)
+            D_DoAdvanceDemo ();
+
+        G_Ticker ();
+        gametic++;
+    }
+}
+
+
+
 //
 //  DEMO LOOP
 //
@@ -1744,6 +1906,16 @@ void D_DoomMain (void)
         ap_settings.item_rando = atoi(myargv[item_rando_id + 1]);
     }
 
+    //!
+    // @category net
+    //
+    // Publish the AP state in shared memory for local trackers and
+    // overlays, see ap_tracker_block_t.
+    //
+
+    if (M_CheckParm("-aptracker"))
+        ap_settings.tracker_export = 1;
+
     int music_rando_id = M_CheckParmWithArgs("-apmusicrando", 1);
     if (music_rando_id)
     {
@@ -1768,23 +1940,66 @@ void D_DoomMain (void)
         ap_settings.reset_level_on_death = atoi(myargv[reset_level_on_death_id + 1]) ? 1 : 0;
     }
 
+
+    //!
+    // @arg <demo>
+    // @category demo
+    //
+    // Play back the demo named demo.lmp as fast as possible, without
+    // a window or sound, and report tics per second. Instead of
+    // connecting, AP is replayed from demo.aplog, which is written
+    // next to the demo by -record.
+    //
+
+    int simulate_arg_id = M_CheckParmWithArgs("-simulate", 1);
+    if (simulate_arg_id)
+        ap_settings.replay_log = G_DemoAPLogName(myargv[simulate_arg_id + 1]);
+
+    //!
+    // @arg <items> <locations> <messages>
+    // @category obscure
+    //
+    // [AP] With -simulate, push that many synthetic items, checked
+    // locations and chat lines through the AP client as fast as it takes
+    // them, to benchmark it. -telemetry reports how they fared.
+    //
+
+    int flood_arg_id = M_CheckParmWithArgs("-apflood", 3);
+    if (flood_arg_id)
+    {
+        ap_settings.flood_items = atoi(myargv[flood_arg_id + 1]);
+        ap_settings.flood_locations = atoi(myargv[flood_arg_id + 2]);
+        ap_settings.flood_messages = atoi(myargv[flood_arg_id + 3]);
+    }
     
     // Grab parameters for AP
     int apserver_arg_id = M_CheckParmWithArgs("-apserver", 1);
-    if (!apserver_arg_id)
+    if (!apserver_arg_id && !simulate_arg_id)
 	    I_Error("Make sure to launch the game using APDoomLauncher.exe.\nThe '-apserver' parameter requires an argument.");
-    ap_settings.ip = myargv[apserver_arg_id + 1];
+    ap_settings.ip = apserver_arg_id ? myargv[apserver_arg_id + 1] : "";
+
+    //!
+    // @arg <seconds>
+    // @category net
+    //
+    // How long to wait for the Archipelago server before giving up.
+    // The default is 10 seconds.
+    //
+
+    int aptimeout_arg_id = M_CheckParmWithArgs("-aptimeout", 1);
+    if (aptimeout_arg_id)
+        ap_settings.connect_timeout = atoi(myargv[aptimeout_arg_id + 1]);
 
     int player_is_hex = 0;
     int applayer_arg_id = M_CheckParmWithArgs("-applayer", 1);
     if (!applayer_arg_id)
     {
         applayer_arg_id = M_CheckParmWithArgs("-applayerhex", 1);
-        if (!applayer_arg_id)
+        if (!applayer_arg_id && !simulate_arg_id)
         {
 	        I_Error("Make sure to launch the game using APDoomLauncher.exe.\nThe '-applayer' parameter requires an argument.");
         }
-        player_is_hex = 1;
+        player_is_hex = applayer_arg_id != 0;
     }
 
     const char* password = "";
@@ -2300,6 +2515,11 @@ void D_DoomMain (void)
 
     }
 
+    if (!p)
+    {
+	p = M_CheckParmWithArgs("-simulate", 1);
+    }
+
     if (p)
     {
         char *uc_filename = strdup(myargv[p + 1]);
@@ -2700,7 +2920,7 @@ void D_DoomMain (void)
     else if (mission == doom2)
         ap_settings.game = "DOOM II";
 
-    char* player_name = myargv[applayer_arg_id + 1];
+    char* player_name = applayer_arg_id ? myargv[applayer_arg_id + 1] : "";
     if (player_is_hex)
     {
         int len = strlen(player_name) / 2;
@@ -2717,8 +2937,11 @@ void D_DoomMain (void)
     ap_settings.passwd = password;
     ap_settings.message_callback = on_ap_message;
     ap_settings.give_item_callback = on_ap_give_item;
+    ap_settings.give_items_callback = on_ap_give_items;
     ap_settings.victory_callback = on_ap_victory;
-    if (!apdoom_init(&ap_settings))
+    // [AP] Connect while the refresh and sound are set up, and only
+    // wait for the slot data once they're done
+    if (!apdoom_init_start(&ap_settings))
     {
 	    I_Error("Failed to initialize Archipelago.");
     }
@@ -2726,6 +2949,7 @@ void D_DoomMain (void)
 
     DEH_printf("M_Init: Init miscellaneous info.\n");
     M_Init ();
+    M_ProfInit ();
 
     DEH_printf("R_Init: Init DOOM refresh daemon - ");
     R_Init ();
@@ -2736,6 +2960,11 @@ void D_DoomMain (void)
     DEH_printf("S_Init: Setting up sound.\n");
     S_Init (sfxVolume * 8, musicVolume * 8);
 
+    if (!apdoom_init_finish())
+    {
+	    I_Error("Failed to initialize Archipelago.");
+    }
+
     DEH_printf("D_CheckNetGame: Checking network game status.\n");
     D_CheckNetGame ();
 
@@ -2760,6 +2989,8 @@ void D_DoomMain (void)
         DEH_printf("External statistics registered.\n");
     }
 
+    StatTelemetryInit(); // [AP]
+
     //!
     // @arg <x>
     // @category demo
@@ -2791,6 +3022,13 @@ void D_DoomMain (void)
 	G_TimeDemo (demolumpname);
 	D_DoomLoop ();  // never returns
     }
+
+    p = M_CheckParmWithArgs("-simulate", 1);
+    if (p)
+    {
+	G_SimulateDemo (demolumpname);
+	D_SimulateLoop ();  // never returns
+    }
 	
     if (startloadgame >= 0)
     {
@@ -93,11 +93,23 @@ static void RunTic(ticcmd_t *cmds, boolean *ingame)
     G_Ticker ();
 }
 
+// [AP] Tics can only be rolled back while a level is being played and
+// nothing that would leave it is pending.
+
+static boolean CanPredict(void)
+{
+    return gamestate == GS_LEVEL && gameaction == ga_nothing
+        && !paused && !advancedemo && !demorecording && !demoplayback;
+}
+
 static loop_interface_t doom_loop_interface = {
     D_ProcessEvents,
     G_BuildTiccmd,
     RunTic,
-    M_Ticker
+    M_Ticker,
+    CanPredict,
+    G_SavePredictState,
+    G_RestorePredictState
 };
 
 
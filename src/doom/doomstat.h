@@ -146,6 +146,7 @@ extern  boolean	paused;		// Game Pause?
 extern  boolean		viewactive;
 
 extern  boolean		nodrawers;
+extern  boolean		simulating;
 
 
 extern  boolean         testcontrols;
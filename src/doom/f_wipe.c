@@ -39,28 +39,6 @@ static pixel_t*	wipe_scr_end;
 static pixel_t*	wipe_scr;
 
 
-void
-wipe_shittyColMajorXform
-( dpixel_t*	array,
-  int		width,
-  int		height )
-{
-    int		x;
-    int		y;
-    dpixel_t*	dest;
-
-    dest = (dpixel_t*) Z_Malloc(width*height*sizeof(*dest), PU_STATIC, 0);
-
-    for(y=0;y<height;y++)
-	for(x=0;x<width;x++)
-	    dest[x*height+y] = array[y*width+x];
-
-    memcpy(array, dest, width*height*sizeof(*dest));
-
-    Z_Free(dest);
-
-}
-
 int
 wipe_initColorXForm
 ( int	width,
@@ -140,10 +118,8 @@ wipe_initMelt
     // copy start screen to main screen
     memcpy(wipe_scr, wipe_scr_start, width*height*sizeof(*wipe_scr));
     
-    // makes this wipe faster (in theory)
-    // to have stuff in column-major format
-    wipe_shittyColMajorXform((dpixel_t*)wipe_scr_start, width/2, height);
-    wipe_shittyColMajorXform((dpixel_t*)wipe_scr_end, width/2, height);
+    // [AP] The screens stay row-major, wipe_doMelt composes
+    // whole rows instead of walking columns.
     
     // setup initial column positions
     // (y<0 => not ready to scroll yet)
@@ -167,16 +143,25 @@ wipe_doMelt
   int	ticks )
 {
     int		i;
-    int		j;
+    int		r;
     int		dy;
-    int		idx;
+    int		first_row;
     
-    dpixel_t*	s;
-    dpixel_t*	d;
+    const dpixel_t*	start = (const dpixel_t *)wipe_scr_start;
+    const dpixel_t*	end = (const dpixel_t *)wipe_scr_end;
     boolean	done = true;
 
     width/=2;
 
+    // [AP] Rows above every column's melt line were already
+    // fully replaced by the end screen.
+    first_row = height;
+    for (i=0;i<width;i++)
+    {
+	if (y[i] < first_row)
+	    first_row = y[i] < 0 ? 0 : y[i];
+    }
+
     while (ticks--)
     {
 	for (i=0;i<width;i++)
@@ -189,28 +174,29 @@ wipe_doMelt
 	    {
 		dy = (y[i] < 16) ? y[i]+1 : (8 << crispy->hires);
 		if (y[i]+dy >= height) dy = height - y[i];
-		s = &((dpixel_t *)wipe_scr_end)[i*height+y[i]];
-		d = &((dpixel_t *)wipe_scr)[y[i]*width+i];
-		idx = 0;
-		for (j=dy;j;j--)
-		{
-		    d[idx] = *(s++);
-		    idx += width;
-		}
 		y[i] += dy;
-		s = &((dpixel_t *)wipe_scr_start)[i*height];
-		d = &((dpixel_t *)wipe_scr)[y[i]*width+i];
-		idx = 0;
-		for (j=height-y[i];j;j--)
-		{
-		    d[idx] = *(s++);
-		    idx += width;
-		}
 		done = false;
 	    }
 	}
     }
 
+    // [AP] A column shows the end screen above its melt line and the
+    // start screen, pushed down, below it. Composing that once per call
+    // in row order replaces moving every column pixel by pixel for each
+    // tic, and keeps the reads and writes of a row together.
+    for (r=first_row;r<height;r++)
+    {
+	dpixel_t*	d = &((dpixel_t *)wipe_scr)[r*width];
+	const dpixel_t*	e = &end[r*width];
+
+	for (i=0;i<width;i++)
+	{
+	    const int yi = y[i] < 0 ? 0 : y[i];
+
+	    d[i] = r < yi ? e[i] : start[(r-yi)*width+i];
+	}
+    }
+
     return done;
 
 }
@@ -35,6 +35,7 @@
 #include "m_controls.h"
 #include "m_misc.h"
 #include "m_menu.h"
+#include "m_prof.h"
 #include "m_random.h"
 #include "i_system.h"
 #include "i_timer.h"
@@ -100,6 +101,17 @@ void	G_DoCompleted (void);
 void	G_DoVictory (void); 
 void	G_DoWorldDone (void); 
 void	G_DoSaveGame (void); 
+
+static MEMFILE *G_DemoFooter (void);
+
+// [AP] demo keyframes
+static void G_KeepDemoKeyframes (const char *demo, int skiptic);
+static void G_FreeDemoKeyframes (void);
+static void G_TakeDemoKeyframe (void);
+static void G_CheckDemoKeyframe (void);
+static void G_ReadDemoKeyframes (const byte *demo, size_t length);
+static void G_WriteDemoKeyframes (uint32_t checksum, size_t length);
+static void G_SkipToDemoKeyframe (void);
  
 // Gamestate the last time G_Ticker was called.
 
@@ -123,6 +135,7 @@ boolean         usergame;               // ok to save / end game
  
 boolean         timingdemo;             // if true, exit with report on completion 
 boolean         nodrawers;              // for comparative timing purposes 
+boolean         simulating;             // [AP] headless -simulate, exit with report
 int             starttime;          	// for comparative timing purposes  	 
  
 boolean         viewactive; 
@@ -224,6 +237,9 @@ int             mousex;
 int             mousex2;
 int             mousey;         
 
+// [AP] The mouse's part of the last ticcmd's turn, see G_MouseViewTurn
+static angle_t  lastmouseturn;
+
 static int      dclicktime;
 static boolean  dclickstate;
 static int      dclicks; 
@@ -740,6 +756,8 @@ void G_BuildTiccmd (ticcmd_t* cmd, int maketic)
 
         testcontrols_mousespeed = 0;
     }
+
+    lastmouseturn = strafe ? 0 : (angle_t) (-mousex * 0x8) << FRACBITS; // [AP]
     
     mousex = mousex2 = mousey = 0;
 	 
@@ -786,6 +804,7 @@ void G_BuildTiccmd (ticcmd_t* cmd, int maketic)
     {
 	cmd->angleturn = -cmd->angleturn;
 	cmd->sidemove = -cmd->sidemove;
+	lastmouseturn = -lastmouseturn; // [AP]
     }
 
     // low-res turning
@@ -810,6 +829,42 @@ void G_BuildTiccmd (ticcmd_t* cmd, int maketic)
 } 
  
 
+// [AP] Turning the view with the mouse every frame. The mouse is sampled
+// before each frame is drawn, and the view turned by what the next ticcmd
+// will turn the player by; the ticcmds themselves are built as before.
+// Once the tic has run, the mouse's part of its turn was already on show,
+// so it's given in ticturn for R_SetupFrame to show in full rather than
+// interpolate. Returns false when the view just follows the tics.
+
+boolean G_MouseViewTurn(angle_t *ticturn, angle_t *pending)
+{
+    boolean strafe;
+    int x;
+
+    if (!crispy->uncapped || gamestate != GS_LEVEL || demoplayback
+     || netgame || menuactive || paused || !mouseSensitivity
+     || displayplayer != consoleplayer
+     || players[consoleplayer].playerstate != PST_LIVE)
+    {
+        return false;
+    }
+
+    strafe = gamekeydown[key_strafe] || mousebuttons[mousebstrafe]
+          || joybuttons[joybstrafe];
+
+    // Left for the tic when it strafes
+    x = strafe ? 0 : I_SampleMouseFrame() * (mouseSensitivity + 5) / 10;
+
+    *pending = (angle_t) (-x * 0x8) << FRACBITS;
+    if (crispy->fliplevels)
+    {
+        *pending = -*pending;
+    }
+    *ticturn = lastmouseturn;
+
+    return true;
+}
+
 
 //
 // G_DoLoadLevel 
@@ -817,6 +872,7 @@ void G_BuildTiccmd (ticcmd_t* cmd, int maketic)
 void G_DoLoadLevel (void) 
 { 
     int             i; 
+    const uint64_t  load_start = I_GetTimeUS(); // [AP] for -telemetry
 
     crispy->fliplevels = ap_get_level_state(ap_make_level_index(gameepisode, gamemap))->flipped ? true : false;
     crispy->flipweapons = crispy->fliplevels;
@@ -944,6 +1000,8 @@ void G_DoLoadLevel (void)
     {
         players[consoleplayer].message = "Press escape to quit.";
     }
+
+    StatLevelLoaded(gameepisode, gamemap, (int) (I_GetTimeUS() - load_start));
 } 
 
 static void SetJoyButtons(unsigned int buttons_mask)
@@ -1217,7 +1275,7 @@ void set_ap_player_states()
 
     // Cards
     ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     p->cards[0] = level_state->keys[0] && !level_info->use_skull[0];
     p->cards[1] = level_state->keys[1] && !level_info->use_skull[1];
@@ -1245,6 +1303,7 @@ void G_Ticker (void)
     int		buf; 
     ticcmd_t*	cmd;
     player_t* p;
+    boolean	demotic = false;
     
     // do player reborns if needed
     for (i=0 ; i<MAXPLAYERS ; i++) 
@@ -1334,6 +1393,10 @@ void G_Ticker (void)
     }
     else
     {     
+    // [AP] between tics, with any level load above done
+    G_TakeDemoKeyframe ();
+    G_CheckDemoKeyframe ();
+
     // get commands, check consistancy,
     // and build new consistancy check
     buf = (gametic/ticdup)%BACKUPTICS; 
@@ -1378,16 +1441,15 @@ void G_Ticker (void)
 
 	    if (netgame && !netdemo && !(gametic%ticdup) ) 
 	    { 
-		if (gametic > BACKUPTICS 
+		// [AP] The consistency byte of a guessed command is stale
+		if (gametic > BACKUPTICS && !predicted_tic
 		    && consistancy[i][buf] != cmd->consistancy) 
 		{ 
 		    I_Error ("consistency failure (%i should be %i)",
 			     cmd->consistancy, consistancy[i][buf]); 
 		} 
-		if (players[i].mo) 
-		    consistancy[i][buf] = players[i].mo->x; 
-		else 
-		    consistancy[i][buf] = rndindex; 
+		// [AP] a byte of the whole state, not the player's x
+		consistancy[i][buf] = (byte) P_StateHash();
 	    } 
 	}
     }
@@ -1396,6 +1458,7 @@ void G_Ticker (void)
     if (demoplayback || demorecording)
     {
 	    defdemotics++;
+	    demotic = true;
     }
 
     // check for special buttons
@@ -1464,7 +1527,9 @@ void G_Ticker (void)
     switch (gamestate) 
     { 
       case GS_LEVEL: 
+	M_ProfBegin (PROF_TICKER);
 	P_Ticker (); 
+	M_ProfEnd (PROF_TICKER);
 	ST_Ticker (); 
 	AM_Ticker (); 
 	HU_Ticker ();
@@ -1478,6 +1543,12 @@ void G_Ticker (void)
                 P_KillMobj_Real(NULL, players[consoleplayer].mo, false);
             }
         }
+
+        if (players[consoleplayer].mo)
+        {
+            const mobj_t *mo = players[consoleplayer].mo;
+            apdoom_set_player_position(mo->x >> FRACBITS, mo->y >> FRACBITS, mo->angle / ANG1);
+        }
 	break; 
 	 
       case GS_INTERMISSION: 
@@ -1496,6 +1567,13 @@ void G_Ticker (void)
             TickLevelSelect();
             break;
     }        
+
+    // [AP] the AP record/replay log is keyed on demo tics, advance it
+    // only after the deathlink check above has seen this one
+    if (demotic)
+    {
+        ap_log_tic++;
+    }
 } 
  
  
@@ -2260,6 +2338,7 @@ void G_DoCompleted (void)
     {
     StatCopy(&wminfo);
     }
+    StatLevelCompleted();
 
     WI_Start (&wminfo); 
 #endif
@@ -2373,11 +2452,18 @@ void G_DoLoadGame (void)
     }
     gameaction = ga_nothing; 
 	 
-    save_stream = M_fopen(savename, "rb");
-
-    if (save_stream == NULL)
     {
-        I_Error("Could not load savegame %s", savename);
+        const byte *save_data;
+        size_t save_length;
+
+        save_data = P_LoadSaveSnapshot(savename, &save_length);
+
+        if (save_data == NULL)
+        {
+            I_Error("Could not load savegame %s", savename);
+        }
+
+        save_stream = mem_fopen_read((void *) save_data, save_length);
     }
 
     // [crispy] read extended savegame data,
@@ -2393,7 +2479,7 @@ void G_DoLoadGame (void)
             strcasecmp(savewadfilename, W_WadNameForLump(savemaplumpinfo)))
         {
             M_ForceLoadGame();
-            fclose(save_stream);
+            mem_fclose(save_stream);
             return;
         }
         else
@@ -2412,7 +2498,7 @@ void G_DoLoadGame (void)
         // [crispy] indicate game version mismatch
         extern void M_LoadGameVerMismatch ();
         M_LoadGameVerMismatch();
-        fclose(save_stream);
+        mem_fclose(save_stream);
         return;
     }
 
@@ -2439,7 +2525,7 @@ void G_DoLoadGame (void)
     // [crispy] read more extended savegame data
     P_ReadExtendedSaveGameData(1);
 
-    fclose(save_stream);
+    mem_fclose(save_stream);
     
     if (setsizeneeded)
 	R_ExecuteSetViewSize ();
@@ -2506,8 +2592,46 @@ G_SaveGame
 
 void cache_ap_player_state(void);
 
+// [AP] Called once the background write of a savegame has landed.
+
+static void G_SaveGameWritten(const char *savegame_file, boolean success)
+{
+    const byte *save_data;
+    size_t save_length;
+    char *recovery_savegame_file;
+
+    if (success)
+    {
+        players[consoleplayer].message = DEH_String(GGSAVED);
+        return;
+    }
+
+    // Failed to save the game, so we're going to have to abort. But
+    // to be nice, save to somewhere else before we call I_Error().
+    // The snapshot still holds what was meant to be written.
+    save_data = P_LoadSaveSnapshot(savegame_file, &save_length);
+    recovery_savegame_file = M_TempFile("recovery.dsg");
+
+    if (save_data == NULL
+     || !M_WriteFile(recovery_savegame_file, save_data, save_length))
+    {
+        I_Error("Failed to open either '%s' or '%s' to write savegame.",
+                P_TempSaveGameFile(), recovery_savegame_file);
+    }
+
+    I_Error("Failed to open savegame file '%s' for writing.\n"
+            "But your game has been saved to '%s' for recovery.",
+            P_TempSaveGameFile(), recovery_savegame_file);
+}
+
 void G_DoSaveGame (void) 
 { 
+    // [AP] a -simulate replay must leave the real saves alone
+    if (simulating)
+        return;
+
+    const uint64_t save_start = I_GetTimeUS(); // [AP] for -telemetry
+
     cache_ap_player_state();
 
     char filename[260];
@@ -2519,30 +2643,14 @@ void G_DoSaveGame (void)
 
     char *savegame_file;
     char *temp_savegame_file;
-    char *recovery_savegame_file;
+    void *save_data;
+    size_t save_length;
 
-    recovery_savegame_file = NULL;
     temp_savegame_file = P_TempSaveGameFile();
     savegame_file = filename;//P_SaveGameFile(savegameslot);
 
-    // Open the savegame file for writing.  We write to a temporary file
-    // and then rename it at the end if it was successfully written.
-    // This prevents an existing savegame from being overwritten by
-    // a corrupted one, or if a savegame buffer overrun occurs.
-    save_stream = M_fopen(temp_savegame_file, "wb");
-
-    if (save_stream == NULL)
-    {
-        // Failed to save the game, so we're going to have to abort. But
-        // to be nice, save to somewhere else before we call I_Error().
-        recovery_savegame_file = M_TempFile("recovery.dsg");
-        save_stream = M_fopen(recovery_savegame_file, "wb");
-        if (save_stream == NULL)
-        {
-            I_Error("Failed to open either '%s' or '%s' to write savegame.",
-                    temp_savegame_file, recovery_savegame_file);
-        }
-    }
+    // [AP] The savegame is built in memory, then written out in one go.
+    save_stream = mem_fopen_write();
 
     savegame_error = false;
 
@@ -2574,40 +2682,174 @@ void G_DoSaveGame (void)
     // Enforce the same savegame size limit as in Vanilla Doom,
     // except if the vanilla_savegame_limit setting is turned off.
 
-    if (vanilla_savegame_limit && ftell(save_stream) > SAVEGAMESIZE)
+    if (vanilla_savegame_limit && mem_ftell(save_stream) > SAVEGAMESIZE)
     {
         I_Error("Savegame buffer overrun");
     }
     */
 
-    // Finish up, close the savegame file.
-
-    fclose(save_stream);
+    // Keep it for when we come back to this level, then write it to a
+    // temporary file and rename it at the end if it was successfully
+    // written. This prevents an existing savegame from being overwritten
+    // by a corrupted one.
 
-    if (recovery_savegame_file != NULL)
-    {
-        // We failed to save to the normal location, but we wrote a
-        // recovery file to the temp directory. Now we can bomb out
-        // with an error.
-        I_Error("Failed to open savegame file '%s' for writing.\n"
-                "But your game has been saved to '%s' for recovery.",
-                temp_savegame_file, recovery_savegame_file);
-    }
+    mem_get_buf(save_stream, &save_data, &save_length);
+    P_StoreSaveSnapshot(savegame_file, save_data, save_length);
 
-    // Now rename the temporary savegame file to the actual savegame
-    // file, overwriting the old savegame if there was one there.
+    // [AP] Packing, writing and syncing happen on a worker thread so the
+    // tic isn't held up by the disk; the message waits for it to land.
+    I_WriteFileAsync(savegame_file, temp_savegame_file,
+                     save_data, save_length, P_PackSaveGame, G_SaveGameWritten);
 
-    M_remove(savegame_file);
-    M_rename(temp_savegame_file, savegame_file);
+    mem_fclose(save_stream);
 
     gameaction = ga_nothing;
     M_StringCopy(savedescription, "", sizeof(savedescription));
     M_StringCopy(savename, savegame_file, sizeof(savename));
 
-    players[consoleplayer].message = DEH_String(GGSAVED);
-
     // draw the pattern into the back screen
     R_FillBackScreen ();
+
+    // The write itself happens in the background and isn't counted
+    StatSaved((int) (I_GetTimeUS() - save_start));
+}
+
+//
+// [AP] Level snapshots
+// A snapshot of the level, made the same way as a savegame but kept in
+// memory, for -predict and for demo keyframes. What a savegame leaves to
+// be set up again by the level load is kept alongside.
+//
+extern int prndindex;
+
+typedef struct
+{
+    int prndindex;
+    int rndindex;
+    int iquehead;
+    int iquetail;
+    mapthing_t itemrespawnque[ITEMQUESIZE];
+    int itemrespawntime[ITEMQUESIZE];
+    int bodyqueslot;
+    uint32_t bodyque[BODYQUESIZE];
+    uint64_t statehash;
+} levelglobals_t;
+
+typedef struct
+{
+    MEMFILE *stream;
+    levelglobals_t globals;
+} levelsnapshot_t;
+
+static levelsnapshot_t predict_snapshot;
+
+static void G_SaveLevelSnapshot (levelsnapshot_t *snapshot)
+{
+    levelglobals_t *globals = &snapshot->globals;
+    int i;
+
+    if (snapshot->stream != NULL)
+    {
+        mem_fclose(snapshot->stream);
+    }
+
+    save_stream = mem_fopen_write();
+    savegame_error = false;
+
+    P_WriteSaveGameHeader("");
+    P_ArchivePlayers ();
+    P_ArchiveWorld ();
+    P_ArchiveThinkers ();
+    P_ArchiveSpecials ();
+    P_WriteSaveGameEOF();
+    P_WriteExtendedSaveGameData();
+
+    snapshot->stream = save_stream;
+
+    globals->prndindex = prndindex;
+    globals->rndindex = rndindex;
+    globals->iquehead = iquehead;
+    globals->iquetail = iquetail;
+    memcpy(globals->itemrespawnque, itemrespawnque, sizeof(itemrespawnque));
+    memcpy(globals->itemrespawntime, itemrespawntime, sizeof(itemrespawntime));
+    globals->bodyqueslot = bodyqueslot;
+
+    for (i = 0; i < BODYQUESIZE; i++)
+    {
+        globals->bodyque[i] = P_ThinkerToIndex((thinker_t *) bodyque[i]);
+    }
+
+    globals->statehash = statehash;
+}
+
+static void G_RestoreLevelSnapshot (const levelsnapshot_t *snapshot)
+{
+    const levelglobals_t *globals = &snapshot->globals;
+    void *data;
+    size_t length;
+    int i;
+
+    mem_get_buf(snapshot->stream, &data, &length);
+    save_stream = mem_fopen_read(data, length);
+    savegame_error = false;
+
+    // These are filled in again by the specials and the extended data.
+    for (i = 0; i < MAXCEILINGS; i++)
+        activeceilings[i] = NULL;
+    for (i = 0; i < MAXPLATS; i++)
+        activeplats[i] = NULL;
+    memset(buttonlist, 0, sizeof(*buttonlist) * maxbuttons);
+
+    P_ReadSaveGameHeader();
+    P_UnArchivePlayers ();
+    P_UnArchiveWorld ();
+    P_UnArchiveThinkers ();
+    P_UnArchiveSpecials ();
+    P_RestoreTargets ();
+
+    if (!P_ReadSaveGameEOF())
+	I_Error ("G_RestoreLevelSnapshot: bad snapshot");
+
+    P_ReadExtendedSaveGameData(1);
+
+    mem_fclose(save_stream);
+
+    // Removing the old mobjs queued up their items to respawn.
+    prndindex = globals->prndindex;
+    rndindex = globals->rndindex;
+    iquehead = globals->iquehead;
+    iquetail = globals->iquetail;
+    memcpy(itemrespawnque, globals->itemrespawnque, sizeof(itemrespawnque));
+    memcpy(itemrespawntime, globals->itemrespawntime, sizeof(itemrespawntime));
+    bodyqueslot = globals->bodyqueslot;
+
+    for (i = 0; i < BODYQUESIZE; i++)
+    {
+        bodyque[i] = (mobj_t *) P_IndexToThinker(globals->bodyque[i]);
+    }
+
+    // Unarchiving the mobjs hashed them again.
+    statehash = globals->statehash;
+
+    // Snapshots are only taken with nothing pending.
+    gameaction = ga_nothing;
+}
+
+//
+// [AP] G_SavePredictState
+// The snapshot -predict rolls back to.
+//
+void G_SavePredictState (void)
+{
+    G_SaveLevelSnapshot(&predict_snapshot);
+}
+
+//
+// [AP] G_RestorePredictState
+//
+void G_RestorePredictState (void)
+{
+    G_RestoreLevelSnapshot(&predict_snapshot);
 }
  
 
@@ -2971,6 +3213,96 @@ static void IncreaseDemoBuffer(void)
     demoend = demobuffer + new_length;
 }
 
+//
+// [AP] Demo streaming
+// A recorded demo is streamed to its file as it's recorded, instead of
+// growing demobuffer until the end. demobuffer then only holds what was
+// recorded since the last flush, and demowritten is how much came
+// before it. The stream keeps the end marker and footer after what has
+// been written, so the file is a playable demo even after a crash.
+//
+
+#define DEMO_CHECKSUM_INIT 2166136261u
+
+static stream_writer_t *demostream = NULL;
+static size_t demowritten;
+static uint32_t demochecksum;   // of the demowritten bytes
+static int demoflushtic;
+static byte *demotail = NULL;   // the end marker and footer
+static size_t demotaillength;
+
+// FNV-1a, continued from sum.
+
+static uint32_t G_DemoChecksum (uint32_t sum, const byte *demo, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        sum = (sum ^ demo[i]) * 16777619u;
+    }
+
+    return sum;
+}
+
+static void G_FlushDemo (void)
+{
+    size_t length = demo_p - demobuffer;
+
+    I_StreamWrite(demostream, demobuffer, length);
+    demochecksum = G_DemoChecksum(demochecksum, demobuffer, length);
+    demowritten += length;
+    demo_p = demobuffer;
+    demoflushtic = gametic;
+}
+
+// Starts streaming once the header is in demobuffer. Without a stream the
+// demo is kept in memory and written at the end, as before.
+
+static void G_OpenDemoStream (void)
+{
+    MEMFILE *footer;
+    void *data;
+    size_t length;
+
+    demowritten = 0;
+    demochecksum = DEMO_CHECKSUM_INIT;
+
+    footer = G_DemoFooter();
+    if (footer != NULL)
+    {
+        mem_get_buf(footer, &data, &length);
+    }
+    else
+    {
+        length = 0;
+    }
+
+    free(demotail);
+    demotaillength = 1 + length;
+    demotail = malloc(demotaillength);
+    demotail[0] = DEMOMARKER;
+    if (length > 0)
+    {
+        memcpy(demotail + 1, data, length);
+    }
+    if (footer != NULL)
+    {
+        mem_fclose(footer);
+    }
+
+    demostream = I_OpenStreamWriter(demoname, demotail, demotaillength);
+
+    if (demostream == NULL)
+    {
+        fprintf(stderr, "G_OpenDemoStream: can't open %s, "
+                        "keeping the demo in memory\n", demoname);
+        return;
+    }
+
+    G_FlushDemo();
+}
+
 void G_WriteDemoTiccmd (ticcmd_t* cmd) 
 { 
     byte *demo_start;
@@ -3016,11 +3348,20 @@ void G_WriteDemoTiccmd (ticcmd_t* cmd)
             // Vanilla demo limit disabled: unlimited
             // demo lengths!
 
+            // [AP] unless streaming, which empties it below
+            if (demostream == NULL)
             IncreaseDemoBuffer();
         }
     } 
 	
     G_ReadDemoTiccmd (cmd);         // make SURE it is exactly the same 
+
+    // [AP] stream out once a second, or when the buffer is full
+    if (demostream != NULL
+     && (demo_p > demoend - 16 || gametic - demoflushtic >= TICRATE))
+    {
+        G_FlushDemo();
+    }
 } 
  
  
@@ -3073,6 +3414,16 @@ void G_RecordDemo (const char *name)
     demoend = demobuffer + maxsize;
 	
     demorecording = true; 
+
+    // [AP] log what AP hands the game next to the demo, for -simulate
+    {
+	char *aplogname = G_DemoAPLogName(demoname);
+	apdoom_record(aplogname);
+	free(aplogname);
+    }
+
+    // [AP] and a keyframe index for -skipsec
+    G_KeepDemoKeyframes(demoname, 0);
 } 
 
 // Get the demo version code appropriate for the version set in gameversion.
@@ -3133,6 +3484,8 @@ void G_BeginRecording (void)
 	 
     for (i=0 ; i<MAXPLAYERS ; i++) 
 	*demo_p++ = playeringame[i]; 		 
+
+    G_OpenDemoStream(); // [AP]
 } 
  
 
@@ -3317,7 +3670,7 @@ void G_DoPlayDemo (void)
     G_InitNew (skill, episode, map); 
     }
     precache = true; 
-    starttime = I_GetTime (); 
+    starttime = simulating ? I_GetTimeMS () : I_GetTime (); 
     demostarttic = gametic; // [crispy] fix revenant internal demo bug
 
     usergame = false; 
@@ -3346,6 +3699,13 @@ void G_DoPlayDemo (void)
 	    deftotaldemotics++;
 	}
     }
+
+    // [AP] skip ahead with the keyframes made the last time it played
+    if (simulating)
+    {
+	G_ReadDemoKeyframes(demobuffer, lumplength);
+	G_SkipToDemoKeyframe();
+    }
 } 
 
 //
@@ -3370,24 +3730,444 @@ void G_TimeDemo (char* name)
     defdemoname = name; 
     gameaction = ga_playdemo; 
 } 
+
+//
+// G_SimulateDemo
+// [AP] Plays a demo back headless as fast as it goes. Unlike the other
+// playback modes this is allowed, because AP is replayed offline from
+// the log recorded with the demo: nothing picked up reaches the server
+// or the saves.
+//
+void G_SimulateDemo (char* name)
+{
+    int i;
+
+    simulating = true;
+    nodrawers = true;
+
+    //!
+    // @arg <s>
+    // @category demo
+    //
+    // With -simulate, start <s> seconds into the demo. Keyframes for
+    // this are written to demo.dki the first time the demo is
+    // simulated or when it's recorded; without them the whole demo is
+    // simulated as usual.
+    //
+
+    i = M_CheckParmWithArgs("-skipsec", 1);
+    G_KeepDemoKeyframes(myargv[M_CheckParmWithArgs("-simulate", 1) + 1],
+                        i ? (int) (atof(myargv[i + 1]) * TICRATE) : 0);
+
+    defdemoname = name;
+    gameaction = ga_playdemo;
+}
+
+// [AP] A file kept next to a demo, "name.lmp" -> "name<ext>".
+static char *G_DemoSidecarName (const char *demo, const char *ext)
+{
+    char *stem, *result;
+    size_t len;
+
+    stem = M_StringDuplicate(demo);
+    len = strlen(stem);
+
+    if (len > 4 && !strcasecmp(stem + len - 4, ".lmp"))
+    {
+        stem[len - 4] = '\0';
+    }
+
+    result = M_StringJoin(stem, ext, NULL);
+    free(stem);
+
+    return result;
+}
+
+//
+// G_DemoAPLogName
+// [AP] The AP log recorded with a demo, "name.lmp" -> "name.aplog".
+//
+char *G_DemoAPLogName (const char *demo)
+{
+    return G_DemoSidecarName(demo, ".aplog");
+}
+
+//
+// [AP] Demo keyframes
+// While a demo is recorded or simulated, every DEMO_KEYFRAME_TICS a
+// level snapshot is taken along with the AP state and where in the demo
+// it is, and at the end they're written to "name.dki" next to the demo.
+// -skipsec then starts from the last keyframe before the requested
+// time, so getting there takes a level load and at most
+// DEMO_KEYFRAME_TICS tics instead of the whole demo. Keyframes are
+// keyed on ap_log_tic, which unlike defdemotics isn't reset by
+// G_InitNew. Playing the demo back checks its state hash against each
+// keyframe it passes.
+//
+// The file is "APDKI 2\0", the keyframe count, then the length and
+// checksum of the demo it was made from; then per keyframe its
+// demokeyframeinfo_t, its levelglobals_t, the savegame data and the AP
+// state. It is only read by the build that wrote it.
+//
+
+#define DEMO_KEYFRAME_MAGIC "APDKI 2"
+#define DEMO_KEYFRAME_MAGIC_LEN 8
+#define DEMO_KEYFRAME_TICS (30 * TICRATE)
+
+typedef struct
+{
+    int32_t tic;                // ap_log_tic
+    int32_t demotics;           // defdemotics
+    int32_t offset;             // of this tic's ticcmds in the demo
+    int32_t skill;
+    int32_t episode;
+    int32_t map;
+    int32_t totalleveltimes;
+    int32_t savelength;
+    int32_t aplength;
+} demokeyframeinfo_t;
+
+typedef struct
+{
+    demokeyframeinfo_t info;
+    levelsnapshot_t level;
+    char *apstate;
+} demokeyframe_t;
+
+static char *demokeyframename = NULL;   // NULL if not keeping keyframes
+static demokeyframe_t *demokeyframes = NULL;
+static int numdemokeyframes = 0;
+static int maxdemokeyframes = 0;
+static boolean demokeyframesloaded;     // from the file, don't take more
+static int demoskiptic = 0;             // -skipsec
+static int demokeyframecheck = 0;       // next one to check playback by
+
+// Keep keyframes for this demo, and start from the last one before
+// skiptic when it's played back.
+
+static void G_KeepDemoKeyframes (const char *demo, int skiptic)
+{
+    G_FreeDemoKeyframes();
+    free(demokeyframename);
+    demokeyframename = G_DemoSidecarName(demo, ".dki");
+    demoskiptic = skiptic;
+}
+
+static void G_FreeDemoKeyframes (void)
+{
+    int i;
+
+    for (i = 0; i < numdemokeyframes; i++)
+    {
+        mem_fclose(demokeyframes[i].level.stream);
+        free(demokeyframes[i].apstate);
+    }
+
+    free(demokeyframes);
+    demokeyframes = NULL;
+    numdemokeyframes = maxdemokeyframes = demokeyframecheck = 0;
+    demokeyframesloaded = false;
+}
+
+static demokeyframe_t *G_AddDemoKeyframe (void)
+{
+    demokeyframe_t *keyframe;
+
+    if (numdemokeyframes == maxdemokeyframes)
+    {
+        maxdemokeyframes = maxdemokeyframes ? maxdemokeyframes * 2 : 64;
+        demokeyframes = I_Realloc(demokeyframes,
+                                  maxdemokeyframes * sizeof(*demokeyframes));
+    }
+
+    keyframe = &demokeyframes[numdemokeyframes++];
+    memset(keyframe, 0, sizeof(*keyframe));
+    return keyframe;
+}
+
+// Takes a keyframe if one is due. Called from G_Ticker once the tic's
+// game actions are done and before its ticcmds are read.
+
+static void G_TakeDemoKeyframe (void)
+{
+    demokeyframe_t *keyframe;
+    int lasttic;
+
+    if (demokeyframename == NULL || demokeyframesloaded
+     || gamestate != GS_LEVEL || gameaction != ga_nothing || netgame
+     || !(simulating ? demoplayback : demorecording && !demoplayback))
+    {
+        return;
+    }
+
+    lasttic = numdemokeyframes ? demokeyframes[numdemokeyframes - 1].info.tic : 0;
+
+    if (ap_log_tic < lasttic + DEMO_KEYFRAME_TICS)
+    {
+        return;
+    }
+
+    keyframe = G_AddDemoKeyframe();
+    keyframe->info.tic = ap_log_tic;
+    keyframe->info.demotics = defdemotics;
+    keyframe->info.offset = demowritten + (demo_p - demobuffer);
+    keyframe->info.skill = gameskill;
+    keyframe->info.episode = gameepisode;
+    keyframe->info.map = gamemap;
+    keyframe->info.totalleveltimes = totalleveltimes;
+    G_SaveLevelSnapshot(&keyframe->level);
+    keyframe->info.savelength = mem_ftell(keyframe->level.stream);
+    keyframe->apstate = apdoom_save_keyframe();
+    keyframe->info.aplength = strlen(keyframe->apstate);
+}
+
+// Warns if playback has drifted from the run the loaded keyframes were
+// made by, at the same point in G_Ticker they were taken at.
+
+static void G_CheckDemoKeyframe (void)
+{
+    const levelglobals_t *globals;
+
+    if (!demokeyframesloaded || !demoplayback || netgame
+     || gamestate != GS_LEVEL || gameaction != ga_nothing)
+    {
+        return;
+    }
+
+    while (demokeyframecheck < numdemokeyframes
+        && demokeyframes[demokeyframecheck].info.tic < ap_log_tic)
+    {
+        demokeyframecheck++;
+    }
+
+    if (demokeyframecheck == numdemokeyframes
+     || demokeyframes[demokeyframecheck].info.tic != ap_log_tic)
+    {
+        return;
+    }
+
+    globals = &demokeyframes[demokeyframecheck++].level.globals;
+
+    if (globals->statehash != statehash || globals->prndindex != prndindex)
+    {
+        fprintf(stderr, "G_CheckDemoKeyframe: demo out of sync by tic %i\n",
+                ap_log_tic);
+    }
+}
+
+// Writes the keyframes for the demo, then lets go of them.
+
+static void G_WriteDemoKeyframes (uint32_t checksum, size_t length)
+{
+    FILE *f;
+    int32_t header[2];
+    boolean success;
+    int i;
+
+    if (demokeyframename == NULL || demokeyframesloaded)
+    {
+        G_FreeDemoKeyframes();
+        return;
+    }
+
+    f = M_fopen(demokeyframename, "wb");
+    success = f != NULL;
+
+    if (success)
+    {
+        header[0] = numdemokeyframes;
+        header[1] = length;
+
+        success = fwrite(DEMO_KEYFRAME_MAGIC, DEMO_KEYFRAME_MAGIC_LEN, 1, f) == 1
+               && fwrite(header, sizeof(header), 1, f) == 1
+               && fwrite(&checksum, sizeof(checksum), 1, f) == 1;
+    }
+
+    for (i = 0; success && i < numdemokeyframes; i++)
+    {
+        demokeyframe_t *keyframe = &demokeyframes[i];
+        void *data;
+        size_t savelength;
+
+        mem_get_buf(keyframe->level.stream, &data, &savelength);
+
+        success = fwrite(&keyframe->info, sizeof(keyframe->info), 1, f) == 1
+               && fwrite(&keyframe->level.globals,
+                         sizeof(keyframe->level.globals), 1, f) == 1
+               && fwrite(data, 1, savelength, f) == savelength
+               && fwrite(keyframe->apstate, 1, keyframe->info.aplength, f)
+                      == (size_t) keyframe->info.aplength;
+    }
+
+    if (f != NULL && fclose(f) != 0)
+    {
+        success = false;
+    }
+
+    if (!success)
+    {
+        fprintf(stderr, "G_WriteDemoKeyframes: failed to write %s\n",
+                demokeyframename);
+        M_remove(demokeyframename);
+    }
+
+    G_FreeDemoKeyframes();
+}
+
+static boolean G_ReadKeyframeBytes (void *dest, size_t size,
+                                    byte **p, const byte *end)
+{
+    if ((size_t) (end - *p) < size)
+    {
+        return false;
+    }
+
+    memcpy(dest, *p, size);
+    *p += size;
+    return true;
+}
+
+// Reads the keyframes made from this demo, if there are any.
+
+static void G_ReadDemoKeyframes (const byte *demo, size_t length)
+{
+    byte *buffer, *p, *end;
+    int32_t header[2];
+    uint32_t checksum;
+    int filelength, count, i;
+
+    G_FreeDemoKeyframes();
+
+    if (demokeyframename == NULL || !M_FileExists(demokeyframename))
+    {
+        return;
+    }
+
+    filelength = M_ReadFile(demokeyframename, &buffer);
+    p = buffer;
+    end = buffer + filelength;
+
+    if (end - p < DEMO_KEYFRAME_MAGIC_LEN
+     || memcmp(p, DEMO_KEYFRAME_MAGIC, DEMO_KEYFRAME_MAGIC_LEN))
+    {
+        goto bad;
+    }
+    p += DEMO_KEYFRAME_MAGIC_LEN;
+
+    if (!G_ReadKeyframeBytes(header, sizeof(header), &p, end)
+     || !G_ReadKeyframeBytes(&checksum, sizeof(checksum), &p, end))
+    {
+        goto bad;
+    }
+
+    if (header[1] != (int32_t) length || checksum != G_DemoChecksum(DEMO_CHECKSUM_INIT, demo, length))
+    {
+        fprintf(stderr, "G_ReadDemoKeyframes: %s is for another demo\n",
+                demokeyframename);
+        Z_Free(buffer);
+        return;
+    }
+
+    count = header[0];
+
+    for (i = 0; i < count; i++)
+    {
+        demokeyframe_t *keyframe = G_AddDemoKeyframe();
+
+        if (!G_ReadKeyframeBytes(&keyframe->info, sizeof(keyframe->info),
+                                 &p, end)
+         || !G_ReadKeyframeBytes(&keyframe->level.globals,
+                                 sizeof(keyframe->level.globals), &p, end)
+         || keyframe->info.savelength < 0 || keyframe->info.aplength < 0
+         || keyframe->info.offset < 0
+         || (size_t) keyframe->info.offset >= length
+         || (size_t) (end - p) < (size_t) keyframe->info.savelength
+                                + keyframe->info.aplength)
+        {
+            goto bad;
+        }
+
+        keyframe->level.stream = mem_fopen_write();
+        mem_fwrite(p, 1, keyframe->info.savelength, keyframe->level.stream);
+        p += keyframe->info.savelength;
+
+        keyframe->apstate = malloc(keyframe->info.aplength + 1);
+        memcpy(keyframe->apstate, p, keyframe->info.aplength);
+        keyframe->apstate[keyframe->info.aplength] = '\0';
+        p += keyframe->info.aplength;
+    }
+
+    Z_Free(buffer);
+    demokeyframesloaded = true;
+    return;
+
+bad:
+    fprintf(stderr, "G_ReadDemoKeyframes: %s is corrupt\n", demokeyframename);
+    G_FreeDemoKeyframes();
+    Z_Free(buffer);
+}
+
+// Skips the demo ahead to the last keyframe at or before demoskiptic.
+// Called from G_DoPlayDemo once the demo has been set up.
+
+static void G_SkipToDemoKeyframe (void)
+{
+    const demokeyframe_t *keyframe = NULL;
+    int i;
+
+    for (i = 0; i < numdemokeyframes; i++)
+    {
+        if (demokeyframes[i].info.tic <= demoskiptic)
+        {
+            keyframe = &demokeyframes[i];
+        }
+    }
+
+    if (keyframe == NULL)
+    {
+        return;
+    }
+
+    // load a base level, then put it back the way it was
+    precache = false;
+    G_InitNew (keyframe->info.skill, keyframe->info.episode,
+               keyframe->info.map);
+    precache = true;
+
+    G_RestoreLevelSnapshot(&keyframe->level);
+    apdoom_load_keyframe(keyframe->apstate, keyframe->info.tic);
+
+    totalleveltimes = keyframe->info.totalleveltimes;
+    defdemotics = keyframe->info.demotics;
+    demo_p = demobuffer + keyframe->info.offset;
+    usergame = false;
+    demoplayback = true;
+
+    printf("Starting from the keyframe at demo tic %i\n",
+           keyframe->info.tic);
+}
  
 #define DEMO_FOOTER_SEPARATOR "\n"
 
-static void G_AddDemoFooter(void)
+// [AP] The footer text, or NULL if there is none. Also the tail of a
+// streamed demo.
+
+static MEMFILE *G_DemoFooter(void)
 {
     int i;
-    size_t len = 0;
     char *tmp, **filenames;
 
-    MEMFILE *stream = mem_fopen_write();
+    MEMFILE *stream;
 
     filenames = W_GetWADFileNames();
 
     if (!filenames)
     {
-        return;
+        return NULL;
     }
 
+    stream = mem_fopen_write();
+
     tmp = M_StringJoin(PACKAGE_STRING, DEMO_FOOTER_SEPARATOR,
             "-iwad \"", M_BaseName(filenames[0]), "\"", NULL);
     mem_fputs(tmp, stream);
@@ -3430,6 +4210,21 @@ static void G_AddDemoFooter(void)
 
     mem_fputs(DEMO_FOOTER_SEPARATOR, stream);
 
+    return stream;
+}
+
+static void G_AddDemoFooter(void)
+{
+    size_t len = 0;
+    char *tmp;
+
+    MEMFILE *stream = G_DemoFooter();
+
+    if (!stream)
+    {
+        return;
+    }
+
     mem_get_buf(stream, (void **)&tmp, &len);
 
     while (demo_p > demoend - len)
@@ -3461,6 +4256,27 @@ boolean G_CheckDemoStatus (void)
     ticcmd_t* cmd = last_cmd;
     last_cmd = NULL;
 
+    if (simulating)
+    {
+        int realtime = I_GetTimeMS() - starttime;
+
+        // Prevent recursive calls
+        simulating = false;
+        demoplayback = false;
+
+        printf("simulated %i gametics in %i ms (%.1f tics/sec)\n",
+               defdemotics, realtime,
+               realtime > 0 ? defdemotics * 1000.0 / realtime : 0.0);
+        StatTimedemo("simulate", defdemoname, defdemotics, realtime);
+        {
+            int length = W_LumpLength(W_GetNumForName(defdemoname));
+
+            G_WriteDemoKeyframes(G_DemoChecksum(DEMO_CHECKSUM_INIT,
+                                                demobuffer, length), length);
+        }
+        I_Quit();
+    }
+
     if (timingdemo) 
     { 
         float fps;
@@ -3474,6 +4290,9 @@ boolean G_CheckDemoStatus (void)
         timingdemo = false;
         demoplayback = false;
 
+        StatTimedemo("timedemo", defdemoname, gametic,
+                     realtics * 1000 / TICRATE);
+
 	I_Error ("timed %i gametics in %i realtics (%f fps)",
                  gametic, realtics, fps);
     } 
@@ -3533,9 +4352,27 @@ boolean G_CheckDemoStatus (void)
 	boolean success;
 	char *msg;
 
+	if (demostream != NULL)
+	{
+	    // [AP] the stream ends it with the marker and footer
+	    G_FlushDemo();
+	    success = I_CloseStreamWriter(demostream);
+	    demostream = NULL;
+	    G_WriteDemoKeyframes(G_DemoChecksum(demochecksum, demotail,
+	                                        demotaillength),
+	                         demowritten + demotaillength);
+	    free(demotail);
+	    demotail = NULL;
+	}
+	else
+	{
 	*demo_p++ = DEMOMARKER; 
 	G_AddDemoFooter();
 	success = M_WriteFile (demoname, demobuffer, demo_p - demobuffer);
+	G_WriteDemoKeyframes(G_DemoChecksum(DEMO_CHECKSUM_INIT, demobuffer,
+	                                    demo_p - demobuffer),
+	                     demo_p - demobuffer); // [AP]
+	}
 	msg = success ? "Demo %s recorded%c" : "Failed to record Demo %s%c";
 	Z_Free (demobuffer); 
 	demorecording = false; 
@@ -24,6 +24,7 @@
 #include "d_event.h"
 #include "d_ticcmd.h"
 #include "m_fixed.h"
+#include "tables.h"
 
 
 //
@@ -49,6 +50,10 @@ void G_DoLoadGame (void);
 // Called by M_Responder.
 void G_SaveGame (int slot, char* description);
 
+// [AP] In-memory snapshot of the level, for -predict.
+void G_SavePredictState (void);
+void G_RestorePredictState (void);
+
 // Only called by startup code.
 void G_RecordDemo (const char* name);
 
@@ -56,6 +61,8 @@ void G_BeginRecording (void);
 
 void G_PlayDemo (char* name);
 void G_TimeDemo (char* name);
+void G_SimulateDemo (char* name);
+char *G_DemoAPLogName (const char *demo);
 boolean G_CheckDemoStatus (void);
 
 void G_ExitLevel (void);
@@ -67,6 +74,10 @@ void G_WorldDone (void);
 
 void G_BuildTiccmd (ticcmd_t *cmd, int maketic); 
 
+// [AP] Per-frame mouse turning of the view, for R_SetupFrame.
+
+boolean G_MouseViewTurn (angle_t *ticturn, angle_t *pending);
+
 void G_Ticker (void);
 boolean G_Responder (event_t*	ev);
 
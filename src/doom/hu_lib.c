@@ -44,6 +44,7 @@ void HUlib_clearTextLine(hu_textline_t* t)
     t->len = 0;
     t->l[0] = 0;
     t->needsupdate = true;
+    t->layout.len = -1; // [AP]
 }
 
 void
@@ -126,56 +127,68 @@ int HULib_measureText(const char* text, int len)
 	return x;
 }
 
-void
-HUlib_drawTextLine
-( hu_textline_t*	l,
-  boolean		drawcursor )
+// [AP] Lays out text the way it's drawn: colours, line breaks, tab stops
+// and stopping at the right edge. Returns the number of glyphs.
+static int
+HUlib_layoutText
+( const char*		text,
+  int			len,
+  int			x,
+  int			y,
+  patch_t**		f,
+  int			sc,
+  int			lineheight,
+  hu_glyph_t*		glyphs,
+  int			maxglyphs,
+  int*			endx,
+  int*			endy )
 {
-
     int			i;
     int			w;
-    int			x;
-    int			y;
+    int			count = 0;
+    int			color = -1;
+    const int		left = x;
     unsigned char	c;
 
-    // draw the new stuff
-    x = l->x;
-    y = l->y; // [crispy] support line breaks
-    for (i=0;i<l->len;i++)
+    for (i=0;i<len;i++)
     {
-	c = toupper(l->l[i]);
+	c = toupper(text[i]);
 	// [crispy] support multi-colored text lines
 	if (c == cr_esc)
 	{
-		if (l->l[i+1] >= '0' && l->l[i+1] <= '0' + CRMAX - 1)
+		if (text[i+1] >= '0' && text[i+1] <= '0' + CRMAX - 1)
 		{
 		    i++;
-		    dp_translation = (crispy->coloredhud & COLOREDHUD_TEXT) ? cr[(int) (l->l[i] - '0')] : NULL;
+		    color = (crispy->coloredhud & COLOREDHUD_TEXT) ? text[i] - '0' + 1 : 0;
 		}
 	}
 	else
 	// [crispy] support line breaks
 	if (c == '\n')
 	{
-	    x = l->x;
-	    y += SHORT(l->f[0]->height) + 1;
+	    x = left;
+	    y += lineheight;
 	}
 	// [crispy] support tab stops
 	else if (c == '\t')
 	{
-	    x = x - (x - l->x)%12 + 12;
+	    x = x - (x - left)%12 + 12;
 	    if (x >= ORIGWIDTH + WIDESCREENDELTA)
 		break;
 	}
 	else
 	if (c != ' '
-	    && c >= l->sc
+	    && c >= sc
 	    && c <= '_')
 	{
-	    w = SHORT(l->f[c - l->sc]->width);
-	    if (x+w > ORIGWIDTH + WIDESCREENDELTA)
+	    w = SHORT(f[c - sc]->width);
+	    if (x+w > ORIGWIDTH + WIDESCREENDELTA || count == maxglyphs)
 		break;
-	    V_DrawPatchDirect(x, y, l->f[c - l->sc]);
+	    glyphs[count].x = x;
+	    glyphs[count].y = y;
+	    glyphs[count].glyph = c - sc;
+	    glyphs[count].color = color;
+	    count++;
 	    x += w;
 	}
 	else
@@ -186,71 +199,132 @@ HUlib_drawTextLine
 	}
     }
 
+    *endx = x;
+    *endy = y;
+
+    return count;
+}
+
+static void
+HUlib_drawGlyphs
+( const hu_glyph_t*	glyphs,
+  int			count,
+  patch_t**		f )
+{
+    int			i;
+
+    for (i=0;i<count;i++)
+    {
+	if (glyphs[i].color > 0)
+	    dp_translation = cr[glyphs[i].color - 1];
+	else if (glyphs[i].color == 0)
+	    dp_translation = NULL;
+
+	V_DrawGlyph(glyphs[i].x, glyphs[i].y, f[glyphs[i].glyph]);
+    }
+}
+
+// [AP] Lays the text out again if it's not what the layout was made from
+static void
+HUlib_updateLayout
+( hu_layout_t*		layout,
+  const char*		text,
+  int			len,
+  int			x,
+  int			y,
+  patch_t**		f,
+  int			sc,
+  int			lineheight )
+{
+    if (layout->len == len
+	&& layout->x == x
+	&& layout->y == y
+	&& layout->f == f
+	&& layout->coloredhud == (crispy->coloredhud & COLOREDHUD_TEXT)
+	&& !memcmp(layout->text, text, len))
+	return;
+
+    memcpy(layout->text, text, len);
+    layout->len = len;
+    layout->x = x;
+    layout->y = y;
+    layout->f = f;
+    layout->coloredhud = crispy->coloredhud & COLOREDHUD_TEXT;
+    layout->count = HUlib_layoutText(text, len, x, y, f, sc, lineheight,
+				     layout->glyphs, HU_MAXLINELENGTH,
+				     &layout->endx, &layout->endy);
+}
+
+void
+HUlib_drawTextLine
+( hu_textline_t*	l,
+  boolean		drawcursor )
+{
+    hu_layout_t*	layout = &l->layout;
+
+    // draw the new stuff
+    // [crispy] support line breaks
+    HUlib_updateLayout(layout, l->l, l->len, l->x, l->y, l->f, l->sc,
+		       SHORT(l->f[0]->height) + 1);
+    HUlib_drawGlyphs(layout->glyphs, layout->count, l->f);
+
     // draw the cursor if requested
     if (drawcursor
-	&& x + SHORT(l->f['_' - l->sc]->width) <= ORIGWIDTH + WIDESCREENDELTA)
+	&& layout->endx + SHORT(l->f['_' - l->sc]->width) <= ORIGWIDTH + WIDESCREENDELTA)
     {
-	V_DrawPatchDirect(x, y, l->f['_' - l->sc]);
+	V_DrawGlyph(layout->endx, layout->endy, l->f['_' - l->sc]);
     }
 
     dp_translation = NULL;
 }
 
+// [AP] Texts drawn by HUlib_drawText, such as the Archipelago messages,
+// are laid out once and kept in these, taken in turn for new texts
+
+#define HU_TEXT_LAYOUTS 16
+
+static hu_layout_t text_layouts[HU_TEXT_LAYOUTS];
+static int text_layout_next;
+
 void HUlib_drawText(const char* text, int x, int y)
 {
+    static hu_glyph_t	glyphs[HU_MAX_LINE_BUFFER];
+    hu_layout_t*	layout;
+    int			len = strlen(text);
+    int			count;
+    int			endx, endy;
     int			i;
-    int			w;
-    unsigned char	c;
-	int len = strlen(text);
 
-	int og_x = x;
+    if (len > HU_MAXLINELENGTH)
+    {
+	// Too long to keep
+	count = HUlib_layoutText(text, len, x, y, hu_font, HU_FONTSTART, 9,
+				 glyphs, HU_MAX_LINE_BUFFER, &endx, &endy);
+	HUlib_drawGlyphs(glyphs, count, hu_font);
+	dp_translation = NULL;
+	return;
+    }
 
-    // draw the new stuff
-    for (i=0;i<len;i++)
+    for (i=0;i<HU_TEXT_LAYOUTS;i++)
     {
-	c = toupper(text[i]);
-	// [crispy] support multi-colored text lines
-	if (c == cr_esc)
-	{
-		if (text[i+1] >= '0' && text[i+1] <= '0' + CRMAX - 1)
-		{
-		    i++;
-		    dp_translation = (crispy->coloredhud & COLOREDHUD_TEXT) ? cr[(int) (text[i] - '0')] : NULL;
-		}
-	}
-	else
-	// [crispy] support line breaks
-	if (c == '\n')
-	{
-	    x = og_x;
-	    y += 9;
-	}
-	// [crispy] support tab stops
-	else if (c == '\t')
-	{
-	    x = x - (x - og_x)%12 + 12;
-	    if (x >= ORIGWIDTH + WIDESCREENDELTA)
-		break;
-	}
-	else
-	if (c != ' '
-	    && c >= HU_FONTSTART
-	    && c <= '_')
-	{
-	    w = SHORT(hu_font[c - HU_FONTSTART]->width);
-	    if (x+w > ORIGWIDTH + WIDESCREENDELTA)
-		break;
-	    V_DrawPatchDirect(x, y, hu_font[c - HU_FONTSTART]);
-	    x += w;
-	}
-	else
-	{
-	    x += 4;
-	    if (x >= ORIGWIDTH + WIDESCREENDELTA)
-		break;
-	}
+	layout = &text_layouts[i];
+	if (layout->len == len
+	    && layout->x == x
+	    && layout->y == y
+	    && !memcmp(layout->text, text, len))
+	    break;
     }
 
+    if (i == HU_TEXT_LAYOUTS)
+    {
+	layout = &text_layouts[text_layout_next];
+	text_layout_next = (text_layout_next + 1) % HU_TEXT_LAYOUTS;
+	layout->len = -1;
+    }
+
+    HUlib_updateLayout(layout, text, len, x, y, hu_font, HU_FONTSTART, 9);
+    HUlib_drawGlyphs(layout->glyphs, layout->count, hu_font);
+
     dp_translation = NULL;
 }
 
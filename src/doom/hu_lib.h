@@ -32,6 +32,29 @@
 // Typedefs of widgets
 //
 
+// [AP] Text laid out as glyphs, so it's only parsed again once it changes
+typedef struct
+{
+    short	x;
+    short	y;
+    short	glyph;			// index into the font
+    short	color;			// cr[] index + 1, 0 for none, -1 as drawn
+} hu_glyph_t;
+
+typedef struct
+{
+    char	text[HU_MAXLINELENGTH+1];	// as laid out
+    int		len;			// -1 when nothing is laid out
+    int		x;
+    int		y;
+    patch_t**	f;
+    int		coloredhud;
+    int		count;			// glyphs
+    int		endx;			// where the next character goes
+    int		endy;
+    hu_glyph_t	glyphs[HU_MAXLINELENGTH];
+} hu_layout_t;
+
 // Text Line widget
 //  (parent of Scrolling Text and Input Text widgets)
 typedef struct
@@ -48,6 +71,8 @@ typedef struct
     // whether this line needs to be udpated
     int		needsupdate;	      
 
+    hu_layout_t	layout;			// [AP] of l, when last drawn
+
 } hu_textline_t;
 
 
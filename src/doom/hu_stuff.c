@@ -34,9 +34,12 @@
 #include "m_controls.h"
 #include "m_misc.h"
 #include "m_menu.h"
+#include "m_prof.h" // [AP] profiling overlay
+#include "ap_msgqueue.h"
 #include "w_wad.h"
 #include "m_argv.h" // [crispy] M_ParmExists()
 #include "st_stuff.h" // [crispy] ST_HEIGHT
+#include "p_local.h" // [AP] mobjpool
 #include "p_setup.h" // maplumpinfo
 
 #include "s_sound.h"
@@ -101,6 +104,7 @@ static hu_textline_t	w_coordx;
 static hu_textline_t	w_coordy;
 static hu_textline_t	w_coorda;
 static hu_textline_t	w_fps;
+static hu_textline_t	w_prof[NUMPROFSTAGES + 2]; // [AP] header, stages, mobj pool
 boolean			chat_on;
 static hu_itext_t	w_chat;
 static boolean		always_off = false;
@@ -120,9 +124,6 @@ static hu_stext_t   w_ap_messages[4];
 static boolean      ap_message_ons[4];
 static int		ap_message_counters[4];
 
-static char ap_message_buffer[HU_MAX_LINE_BUFFER][HU_MAXLINELENGTH + 1];
-static int ap_message_buffer_count = 0;
-
 static int ap_message_anim = 0;
 
 
@@ -692,6 +693,15 @@ void HU_Start(void)
 		       hu_font,
 		       HU_FONTSTART);
 
+    // [AP] profiling overlay, below the level stats
+    for (i = 0; i < arrlen(w_prof); i++)
+    {
+	HUlib_initTextLine(&w_prof[i],
+			   HU_TITLEX, HU_MSGY + (6 + i) * 8,
+			   hu_font,
+			   HU_FONTSTART);
+    }
+
     
     switch ( logical_gamemission )
     {
@@ -912,6 +922,13 @@ void HU_Drawer(void)
 	HUlib_drawTextLine(&w_fps, false);
     }
 
+    // [AP] profiling overlay
+    if (prof_enabled)
+    {
+	for (int i = 0; i < arrlen(w_prof); i++)
+	    HUlib_drawTextLine(&w_prof[i], false);
+    }
+
     if (crispy->crosshair == CROSSHAIR_STATIC)
 	HU_DrawCrosshair();
 
@@ -952,6 +969,8 @@ void HU_Erase(void)
     HUlib_eraseTextLine(&w_coordy);
     HUlib_eraseTextLine(&w_coorda);
     HUlib_eraseTextLine(&w_fps);
+    for (int i = 0; i < arrlen(w_prof); i++)
+	HUlib_eraseTextLine(&w_prof[i]);
 
 }
 
@@ -997,8 +1016,10 @@ static const crispy_statsline_func_t crispy_statslines[NUM_STATSFORMATS] =
 void HU_ClearAPMessages()
 {
 #if 0
+    char ap_line[AP_MSG_MAXLINELENGTH + 1];
+
     // Keep the last 3 ones in case they are important, but remove the queue.
-    while (HU_GetActiveAPMessageCount() > 3 && ap_message_buffer_count)
+    while (HU_GetActiveAPMessageCount() > 3 && ap_msgqueue_count())
     {
         // Shift currents
         for (int i = 3; i > 0; --i)
@@ -1008,21 +1029,15 @@ void HU_ClearAPMessages()
             ap_message_counters[i] = ap_message_counters[i - 1];
             ap_message_ons[i] = ap_message_ons[i - 1];
         }
-	    HUlib_addMessageToSText(&w_ap_messages[0], 0, ap_message_buffer[0]);
+	    ap_msgqueue_pop(ap_line);
+	    HUlib_addMessageToSText(&w_ap_messages[0], 0, ap_line);
 	    ap_message_ons[0] = true;
 	    ap_message_counters[0] = HU_APMSGTIMEOUT;
-
-        // Shift buffers
-        for (int i = 1; i < ap_message_buffer_count; ++i)
-        {
-            memcpy(ap_message_buffer[i - 1], ap_message_buffer[i], HU_MAXLINELENGTH + 1);
-        }
-        ap_message_buffer_count--;
     }
 #else // Clear everything
     for (int i = 0; i < 4; ++i)
         ap_message_ons[i] = false;
-    ap_message_buffer_count = 0;
+    ap_msgqueue_clear();
 #endif
     ap_message_anim = 0;
 }
@@ -1039,68 +1054,20 @@ void HU_InitAPMessages()
 }
 
 
-void HU_AddAPLine(const char* line, int len)
+static int HU_MeasureAPGlyph(const char* text, int* advance)
 {
-    char baked_line[HU_MAXLINELENGTH + 1];
-    memcpy(baked_line, line, len);
-    baked_line[len] = '\0';
-
-    // Add to buffer
-    if (ap_message_buffer_count >= HU_MAX_LINE_BUFFER)
-        return; // No more room
-    memcpy(ap_message_buffer[ap_message_buffer_count], baked_line, len + 1);
-    ap_message_buffer_count++;
+    if (*text == cr_esc && text[1] >= '0' && text[1] <= '0' + CRMAX - 1)
+    {
+        *advance = 2; // Color escape
+        return 0;
+    }
+    *advance = 1;
+    return HULib_measureText(text, 1);
 }
 
 void HU_AddAPMessage(const char* message)
 {
-    int len = strlen(message);
-
-    int i = 0;
-    int j = 0;
-    char baked_line[HU_MAXLINELENGTH + 1];
-    baked_line[HU_MAXLINELENGTH] = '\0';
-    int word_start = 0;
-    while (i < len)
-    {
-        if (message[j] == ' ')
-        {
-            word_start = j;
-        }
-        if (message[j] != '\n')
-        {
-            int w = HULib_measureText(message + i, j - i);
-            if (w >= ORIGWIDTH + WIDESCREENDELTA - 8 && word_start == i)
-            {
-                if (j > i && word_start == i) --j;
-            }
-            else
-            {
-                if (w < ORIGWIDTH + WIDESCREENDELTA - 8 && (j - i) + 2 < HU_MAXLINELENGTH && j < len)
-                {
-                    j++;
-                    continue;
-                }
-                if (j < len) j = word_start;
-            }
-        }
-        else
-        {
-            j++;
-            word_start = j;
-        }
-        memcpy(baked_line + 2, message + i, j - i);
-        baked_line[0] = '~'; baked_line[1] = '2'; // Always make sure to use white
-        HU_AddAPLine(baked_line, (j - i) + 2);
-        i = j;
-        word_start = j;
-        while (message[i] == ' ')
-        {
-            i++;
-            j++;
-            word_start++;
-        }
-    }
+    ap_msgqueue_add(message, ORIGWIDTH + WIDESCREENDELTA - 8, HU_MeasureAPGlyph);
 }
 
 void HU_DrawAPMessages()
@@ -1138,6 +1105,8 @@ void HU_UpdateAPMessagePosition(int i)
 
 void HU_TickAPMessages()
 {
+    char ap_line[AP_MSG_MAXLINELENGTH + 1];
+
 #if 0
     static int test = 0;
     if (test <= 0)
@@ -1160,7 +1129,7 @@ void HU_TickAPMessages()
     test--;
 #endif
 
-    while (HU_HasAPMessageRoom() && ap_message_buffer_count && ap_message_anim == 0)
+    while (HU_HasAPMessageRoom() && ap_msgqueue_count() && ap_message_anim == 0)
     {
         // Shift currents
         for (int i = 3; i > 0; --i)
@@ -1170,16 +1139,10 @@ void HU_TickAPMessages()
             ap_message_counters[i] = ap_message_counters[i - 1];
             ap_message_ons[i] = ap_message_ons[i - 1];
         }
-	    HUlib_addMessageToSText(&w_ap_messages[0], 0, ap_message_buffer[0]);
+	    ap_msgqueue_pop(ap_line);
+	    HUlib_addMessageToSText(&w_ap_messages[0], 0, ap_line);
 	    ap_message_ons[0] = true;
 	    ap_message_counters[0] = HU_APMSGTIMEOUT;
-
-        // Shift buffers
-        for (int i = 1; i < ap_message_buffer_count; ++i)
-        {
-            memcpy(ap_message_buffer[i - 1], ap_message_buffer[i], HU_MAXLINELENGTH + 1);
-        }
-        ap_message_buffer_count--;
     }
 
     if (ap_message_anim == 0)
@@ -1188,11 +1151,10 @@ void HU_TickAPMessages()
         {
             if (ap_message_counters[i])
             {
-                ap_message_counters[i] -= max(1, ap_message_buffer_count / 6);
+                ap_message_counters[i] -= max(1, ap_msgqueue_count() / 6);
                 if (ap_message_counters[i] <= 0)
                 {
                     ap_message_counters[i] = 0;
-                    // ap_message_buffer_count
                     ap_message_ons[i] = false;
                     ap_message_anim = 8;
                     break;
@@ -1207,7 +1169,7 @@ void HU_TickAPMessages()
 
     if (ap_message_anim > 0)
     {
-        ap_message_anim -= min(4, max(1, ap_message_buffer_count / 10));
+        ap_message_anim -= min(4, max(1, ap_msgqueue_count() / 10));
         if (ap_message_anim < 0) ap_message_anim = 0;
     }
 }
@@ -1451,6 +1413,44 @@ void HU_Ticker(void)
 	while (*s)
 	    HUlib_addCharToTextLine(&w_fps, *(s++));
     }
+
+    // [AP] profiling overlay, in microseconds over the last PROFWINDOW frames
+    if (prof_enabled)
+    {
+	int lo, avg, hi;
+	char pstr[48];
+
+	M_snprintf(pstr, sizeof(pstr), "%sSTAGE  %sMIN/AVG/MAX US", cr_stat2, crstr[CR_GRAY]);
+	HUlib_clearTextLine(&w_prof[0]);
+	s = pstr;
+	while (*s)
+	    HUlib_addCharToTextLine(&w_prof[0], *(s++));
+
+	for (i = 0; i < NUMPROFSTAGES; i++)
+	{
+	    M_ProfStats(i, &lo, &avg, &hi);
+	    M_snprintf(pstr, sizeof(pstr), "%s%-6s %s%d/%d/%d", cr_stat2,
+	               M_ProfStageName(i), crstr[CR_GRAY], lo, avg, hi);
+	    if (i == PROF_FRAME)
+	    {
+		const size_t len = strlen(pstr);
+		M_snprintf(pstr + len, sizeof(pstr) - len, " SD %d",
+		           M_ProfDeviation(i));
+	    }
+	    HUlib_clearTextLine(&w_prof[i + 1]);
+	    s = pstr;
+	    while (*s)
+		HUlib_addCharToTextLine(&w_prof[i + 1], *(s++));
+	}
+
+	// pool pressure: live now, level peak and pool slots
+	M_snprintf(pstr, sizeof(pstr), "%sMOBJS  %s%d/%d/%d", cr_stat2,
+	           crstr[CR_GRAY], mobjpool.live, mobjpool.peak, mobjpool.capacity);
+	HUlib_clearTextLine(&w_prof[NUMPROFSTAGES + 1]);
+	s = pstr;
+	while (*s)
+	    HUlib_addCharToTextLine(&w_prof[NUMPROFSTAGES + 1], *(s++));
+    }
 }
 
 #define QUEUESIZE		128
@@ -159,15 +159,9 @@ void P_RemoveMobj(mobj_t* mobj);
 
 void A_check_collected(mobj_t* mo)
 {
-	int j, lenj;
-	ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-    for (j = 0, lenj = level_state->check_count; j < lenj; ++j)
+    if (apdoom_is_location_checked(ap_make_level_index(gameepisode, gamemap), mo->index))
     {
-        if (level_state->checks[j] == mo->index)
-        {
-			P_RemoveMobj(mo);
-			return;
-        }
+        P_RemoveMobj(mo);
     }
 }
 
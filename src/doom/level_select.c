@@ -21,12 +21,15 @@
 #include "d_main.h"
 #include "s_sound.h"
 #include "z_zone.h"
+#include "i_system.h"
 #include "v_video.h"
 #include "d_player.h"
 #include "doomkeys.h"
 #include "apdoom.h"
+#include "ap_notif.h"
 #include "i_video.h"
 #include "g_game.h"
+#include "p_setup.h"
 #include "m_misc.h"
 #include "hu_lib.h"
 #include "hu_stuff.h"
@@ -522,6 +525,7 @@ boolean LevelSelectResponder(event_t* ev)
 void ShowLevelSelect()
 {
     HU_ClearAPMessages();
+    ap_notif_precache();
 
     // If in a level, save current level
     if (gamestate == GS_LEVEL)
@@ -563,6 +567,38 @@ void ShowLevelSelect()
 }
 
 
+// Once the cursor rests on a level, warm its map lumps and music so
+// entering it doesn't stall on the WAD and music pack reads.
+#define PREFETCH_DELAY 8 // tics
+
+static int prefetch_ep = -1;
+static int prefetch_map = -1;
+static int prefetch_tics = 0;
+
+static void tick_prefetch()
+{
+    int ep = selected_ep;
+    int map = selected_level[selected_ep];
+
+    if (ep != prefetch_ep || map != prefetch_map)
+    {
+        prefetch_ep = ep;
+        prefetch_map = map;
+        prefetch_tics = 0;
+    }
+
+    if (prefetch_tics < PREFETCH_DELAY)
+    {
+        if (++prefetch_tics == PREFETCH_DELAY)
+        {
+            ap_level_index_t idx = {ep, map};
+            P_PrefetchMap(ap_index_to_ep(idx), ap_index_to_map(idx));
+            S_PrefetchLevelMusic(ap_index_to_ep(idx), ap_index_to_map(idx));
+        }
+    }
+}
+
+
 void TickLevelSelect()
 {
     if (ep_anim > 0)
@@ -572,6 +608,7 @@ void TickLevelSelect()
     bcnt++;
     urh_anim = (urh_anim + 1) % 35;
     WI_updateAnimatedBack();
+    tick_prefetch();
 }
 
 
@@ -588,7 +625,9 @@ void draw_legend_line(const char* text, int x, int y)
 }
 
 
-void DrawEpisodicLevelSelectStats()
+// [AP] Everything but the blinking "You are here", which the
+// cached layer can't hold
+static void draw_level_select_static()
 {
     int x, y;
     const int key_spacing = 8;
@@ -600,7 +639,7 @@ void DrawEpisodicLevelSelectStats()
     {
         const level_pos_t* level_pos = get_level_pos_info(selected_ep, i);
         ap_level_index_t idx = {selected_ep, i};
-        ap_level_info_t* ap_level_info = ap_get_level_info(idx);
+        const ap_level_info_t* ap_level_info = ap_get_level_info(idx);
         ap_level_state_t* ap_level_state = ap_get_level_state(idx);
 
         x = level_pos->x;
@@ -697,30 +736,6 @@ void DrawEpisodicLevelSelectStats()
         print_right_aligned_yellow_digit(progress_x, progress_y, ap_level_state->check_count);
         V_DrawPatch(progress_x + 1, progress_y, W_CacheLumpName("STYSLASH", PU_CACHE));
         print_left_aligned_yellow_digit(progress_x + 8, progress_y, ap_level_info->check_count - ap_level_info->sanity_check_count);
-
-        // "You are here"
-        if (i == selected_level[selected_ep] && urh_anim < 25)
-        {
-            int x_offset = 2;
-            int y_offset = -2;
-            if (level_pos->urhere_lump_name[5] == '1')
-            {
-                x_offset = -2;
-            }
-            if ((level_pos->urhere_lump_name[5] == '0' && level_pos->keys_offset > 0) ||
-                (level_pos->urhere_lump_name[5] == '1' && level_pos->keys_offset < 0))
-            {
-                y_offset += key_start_offset;
-            }
-            if (level_pos->urhere_lump_name[5] == '2' ||
-                level_pos->urhere_lump_name[5] == '3')
-            {
-                y_offset = 16;
-            }
-            V_DrawPatch(x + x_offset + level_pos->urhere_x_offset, 
-                        y + y_offset + level_pos->urhere_y_offset, 
-                        W_CacheLumpName(level_pos->urhere_lump_name, PU_CACHE));
-        }
     }
 
     // Level name
@@ -765,6 +780,57 @@ void DrawEpisodicLevelSelectStats()
 }
 
 
+static void draw_you_are_here()
+{
+    const int key_spacing = 8;
+    int i = selected_level[selected_ep];
+
+    if (urh_anim >= 25)
+        return;
+
+    const level_pos_t* level_pos = get_level_pos_info(selected_ep, i);
+    ap_level_index_t idx = {selected_ep, i};
+    const ap_level_info_t* ap_level_info = ap_get_level_info(idx);
+
+    int x = level_pos->x;
+    int y = level_pos->y;
+
+    int key_count = 0;
+    for (int k = 0; k < 3; ++k)
+        if (ap_level_info->keys[k])
+            key_count++;
+
+    const int key_start_offset = -key_spacing * key_count / 2;
+
+    int x_offset = 2;
+    int y_offset = -2;
+    if (level_pos->urhere_lump_name[5] == '1')
+    {
+        x_offset = -2;
+    }
+    if ((level_pos->urhere_lump_name[5] == '0' && level_pos->keys_offset > 0) ||
+        (level_pos->urhere_lump_name[5] == '1' && level_pos->keys_offset < 0))
+    {
+        y_offset += key_start_offset;
+    }
+    if (level_pos->urhere_lump_name[5] == '2' ||
+        level_pos->urhere_lump_name[5] == '3')
+    {
+        y_offset = 16;
+    }
+    V_DrawPatch(x + x_offset + level_pos->urhere_x_offset, 
+                y + y_offset + level_pos->urhere_y_offset, 
+                W_CacheLumpName(level_pos->urhere_lump_name, PU_CACHE));
+}
+
+
+void DrawEpisodicLevelSelectStats()
+{
+    draw_level_select_static();
+    draw_you_are_here();
+}
+
+
 void DrawLevelSelectStats()
 {
     DrawEpisodicLevelSelectStats();
@@ -794,11 +860,159 @@ const char* get_win_map(int ep)
 }
 
 
+// [AP] The map background and the level stats only change when a level
+// state or the selection does, so they are composed offscreen once. A
+// frame then copies the background, draws the animations over it, and
+// puts the stats back on top from runs of the pixels they cover.
+typedef struct
+{
+    int offset;
+    int length;
+} layer_run_t;
+
+#define LAYER_KEY_SIZE (5 + 6 * 11)
+
+static pixel_t* layer_background = NULL;
+static pixel_t* layer_overlay = NULL;
+static int layer_width = 0;
+static int layer_height = 0;
+static layer_run_t* layer_runs = NULL;
+static int layer_run_count = 0;
+static int layer_run_capacity = 0;
+static int layer_key[LAYER_KEY_SIZE];
+static int layer_key_len = -1;
+
+
+// Everything the static layer is drawn from
+static int get_layer_key(int* key)
+{
+    int len = 0;
+    int map_count = ap_get_map_count(selected_ep + 1);
+
+    key[len++] = SCREENWIDTH;
+    key[len++] = SCREENHEIGHT;
+    key[len++] = usegamma;
+    key[len++] = selected_ep;
+    key[len++] = selected_level[selected_ep];
+    for (int i = 0; i < map_count && len + 6 <= LAYER_KEY_SIZE; ++i)
+    {
+        ap_level_index_t idx = {selected_ep, i};
+        ap_level_state_t* ap_level_state = ap_get_level_state(idx);
+        key[len++] = ap_level_state->completed;
+        key[len++] = ap_level_state->unlocked;
+        key[len++] = ap_level_state->keys[0];
+        key[len++] = ap_level_state->keys[1];
+        key[len++] = ap_level_state->keys[2];
+        key[len++] = ap_level_state->check_count;
+    }
+    return len;
+}
+
+
+static void add_layer_run(int offset, int length)
+{
+    if (layer_run_count == layer_run_capacity)
+    {
+        layer_run_capacity = layer_run_capacity ? layer_run_capacity * 2 : 256;
+        layer_runs = I_Realloc(layer_runs, layer_run_capacity * sizeof(*layer_runs));
+    }
+    layer_runs[layer_run_count].offset = offset;
+    layer_runs[layer_run_count].length = length;
+    layer_run_count++;
+}
+
+
+static void compose_level_select_layer()
+{
+    int size = SCREENWIDTH * SCREENHEIGHT;
+    pixel_t* scratch;
+    int run_start = -1;
+
+    if (layer_width != SCREENWIDTH || layer_height != SCREENHEIGHT)
+    {
+        if (layer_background) Z_Free(layer_background);
+        if (layer_overlay) Z_Free(layer_overlay);
+        layer_background = Z_Malloc(size * sizeof(pixel_t), PU_STATIC, NULL);
+        layer_overlay = Z_Malloc(size * sizeof(pixel_t), PU_STATIC, NULL);
+        layer_width = SCREENWIDTH;
+        layer_height = SCREENHEIGHT;
+    }
+
+    // Background, pillarboxes included
+    memset(layer_background, 0, size * sizeof(pixel_t));
+    V_UseBuffer(layer_background);
+    V_DrawPatch(0, 0, W_CacheLumpName(get_win_map(selected_ep), PU_CACHE));
+
+    // The stats are drawn over two different clear colors, the pixels
+    // that come out the same in both are the ones they cover.
+    scratch = Z_Malloc(size * sizeof(pixel_t), PU_STATIC, NULL);
+    memset(layer_overlay, 0, size * sizeof(pixel_t));
+    memset(scratch, 0xff, size * sizeof(pixel_t));
+    V_UseBuffer(layer_overlay);
+    draw_level_select_static();
+    V_UseBuffer(scratch);
+    draw_level_select_static();
+    V_RestoreBuffer();
+
+    layer_run_count = 0;
+    for (int i = 0; i < size; ++i)
+    {
+        if (layer_overlay[i] == scratch[i])
+        {
+            if (run_start < 0) run_start = i;
+        }
+        else if (run_start >= 0)
+        {
+            add_layer_run(run_start, i - run_start);
+            run_start = -1;
+        }
+    }
+    if (run_start >= 0)
+        add_layer_run(run_start, size - run_start);
+
+    Z_Free(scratch);
+}
+
+
+static void draw_level_select_layered()
+{
+    int key[LAYER_KEY_SIZE];
+    int key_len = get_layer_key(key);
+
+    if (key_len != layer_key_len || memcmp(key, layer_key, key_len * sizeof(int)))
+    {
+        compose_level_select_layer();
+        memcpy(layer_key, key, key_len * sizeof(int));
+        layer_key_len = key_len;
+    }
+
+    memcpy(I_VideoBuffer, layer_background, SCREENWIDTH * SCREENHEIGHT * sizeof(pixel_t));
+    V_MarkRect(0, 0, SCREENWIDTH, SCREENHEIGHT);
+
+    WI_drawAnimatedBack();
+
+    for (int i = 0; i < layer_run_count; ++i)
+    {
+        const layer_run_t* run = &layer_runs[i];
+        memcpy(I_VideoBuffer + run->offset, layer_overlay + run->offset, run->length * sizeof(pixel_t));
+    }
+
+    draw_you_are_here();
+}
+
+
 void DrawLevelSelect()
 {
     int x_offset = ep_anim * 32;
 
     char lump_name[9];
+
+    if (ep_anim == 0)
+    {
+        draw_level_select_layered();
+        return;
+    }
+
     snprintf(lump_name, 9, "%s", get_win_map(selected_ep));
     
     // [crispy] fill pillarboxes in widescreen mode
@@ -808,19 +1022,11 @@ void DrawLevelSelect()
     }
 
     V_DrawPatch(x_offset, 0, W_CacheLumpName(lump_name, PU_CACHE));
-    if (ep_anim == 0)
-    {
-        WI_drawAnimatedBack();
 
-        DrawLevelSelectStats();
-    }
+    snprintf(lump_name, 9, "%s", get_win_map(prev_ep));
+    if (ep_anim > 0)
+        x_offset = -(10 - ep_anim) * 32;
     else
-    {
-        snprintf(lump_name, 9, "%s", get_win_map(prev_ep));
-        if (ep_anim > 0)
-            x_offset = -(10 - ep_anim) * 32;
-        else
-            x_offset = (10 + ep_anim) * 32;
-        V_DrawPatch(x_offset, 0, W_CacheLumpName(lump_name, PU_CACHE));
-    }
+        x_offset = (10 + ep_anim) * 32;
+    V_DrawPatch(x_offset, 0, W_CacheLumpName(lump_name, PU_CACHE));
 }
@@ -850,25 +850,21 @@ menu_t  SaveDef =
 //
 void M_ReadSaveStrings(void)
 {
-    FILE   *handle;
     int     i;
     char    name[256];
 
     for (i = 0;i < load_end;i++)
     {
-        int retval;
         M_StringCopy(name, P_SaveGameFile(i), sizeof(name));
 
-	handle = M_fopen(name, "rb");
-        if (handle == NULL)
+        // [AP] Saves can be compressed, read through p_saveg
+        if (!P_ReadSaveDescription(name, savegamestrings[i]))
         {
             M_StringCopy(savegamestrings[i], EMPTYSTRING, SAVESTRINGSIZE);
             LoadMenu[i].status = 0;
             continue;
         }
-        retval = fread(&savegamestrings[i], 1, SAVESTRINGSIZE, handle);
-	fclose(handle);
-        LoadMenu[i].status = retval == SAVESTRINGSIZE;
+        LoadMenu[i].status = 1;
     }
 }
 
@@ -1677,7 +1673,7 @@ static void M_DrawCrispness2(void)
     M_DrawCrispnessSeparator(crispness_sep_audible, "Audible");
     M_DrawCrispnessItem(crispness_soundfull, "Play sounds in full length", crispy->soundfull, true);
     M_DrawCrispnessItem(crispness_soundfix, "Misc. Sound Fixes", crispy->soundfix, true);
-    M_DrawCrispnessMultiItem(crispness_sndchannels, "Sound Channels", multiitem_sndchannels, snd_channels >> 4, snd_sfxdevice != SNDDEVICE_PCSPEAKER);
+    M_DrawCrispnessMultiItem(crispness_sndchannels, "Sound Channels", multiitem_sndchannels, MIN(snd_channels, 32) >> 4, snd_sfxdevice != SNDDEVICE_PCSPEAKER); // [AP] more with snd_softmixer
     M_DrawCrispnessItem(crispness_soundmono, "Mono SFX", crispy->soundmono, true);
 
     M_DrawCrispnessSeparator(crispness_sep_navigational, "Navigational");
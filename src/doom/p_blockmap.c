@@ -23,12 +23,134 @@
 #include "p_local.h"
 #include "z_zone.h"
 
+// [AP] Blockmaps built during this session, so that maps visited again
+// from the hub don't have to be rebuilt. An entry is only reused if the
+// vertexes and linedefs it was built from are the same.
+
+typedef struct blockmapcache_s
+{
+  int lumpnum;
+  int numvertexes, numlines;
+  unsigned int checksum;
+  fixed_t orgx, orgy;
+  int width, height;
+  int count;
+  int32_t *lump;
+  struct blockmapcache_s *next;
+} blockmapcache_t;
+
+static blockmapcache_t *blockmapcache = NULL;
+
+static unsigned int P_BlockMapChecksum(void)
+{
+  unsigned int sum = 2166136261u;
+  int i;
+
+#define MIX(v) (sum = (sum ^ (unsigned int) (v)) * 16777619u)
+  for (i=0; i<numvertexes; i++)
+    {
+      MIX(vertexes[i].x);
+      MIX(vertexes[i].y);
+    }
+  for (i=0; i<numlines; i++)
+    {
+      MIX(lines[i].v1 - vertexes);
+      MIX(lines[i].v2 - vertexes);
+    }
+#undef MIX
+
+  return sum;
+}
+
+// [AP] Walk the blocks crossed by line i. With lists NULL, count the line
+// in each block; otherwise store it in each block's list. The lists are
+// filled from the end, so they come out in the same (descending) order
+// as the old realloc based builder produced.
+
+static void P_WalkLineBlocks(int i, int minx, int miny, unsigned tot,
+                             int *counts, int32_t *lists)
+{
+  int x, y, adx, ady, bend;
+  int dx, dy, diff, b;
+
+  // starting coordinates
+  x = (lines[i].v1->x >> FRACBITS) - minx;
+  y = (lines[i].v1->y >> FRACBITS) - miny;
+
+  // x-y deltas
+  adx = lines[i].dx >> FRACBITS, dx = adx < 0 ? -1 : 1;
+  ady = lines[i].dy >> FRACBITS, dy = ady < 0 ? -1 : 1;
+
+  // difference in preferring to move across y (>0) instead of x (<0)
+  diff = !adx ? 1 : !ady ? -1 :
+    (((x >> MAPBTOFRAC) << MAPBTOFRAC) +
+     (dx > 0 ? MAPBLOCKUNITS-1 : 0) - x) * (ady = abs(ady)) * dx -
+    (((y >> MAPBTOFRAC) << MAPBTOFRAC) +
+     (dy > 0 ? MAPBLOCKUNITS-1 : 0) - y) * (adx = abs(adx)) * dy;
+
+  // starting block
+  b = (y >> MAPBTOFRAC)*bmapwidth + (x >> MAPBTOFRAC);
+
+  // ending block
+  bend = (((lines[i].v2->y >> FRACBITS) - miny) >> MAPBTOFRAC) *
+      bmapwidth + (((lines[i].v2->x >> FRACBITS) - minx) >> MAPBTOFRAC);
+
+  // delta for pointer when moving across y
+  dy *= bmapwidth;
+
+  // deltas for diff inside the loop
+  adx <<= MAPBTOFRAC;
+  ady <<= MAPBTOFRAC;
+
+  // Now we simply iterate block-by-block until we reach the end block.
+  while ((unsigned) b < tot)    // failsafe -- should ALWAYS be true
+    {
+      // Count the linedef, or add it to the block's list; counts then
+      // holds the fill position
+      if (lists)
+	lists[--counts[b]] = i;
+      else
+	counts[b]++;
+
+      // If we have reached the last block, exit
+      if (b == bend)
+	break;
+
+      // Move in either the x or y direction to the next block
+      if (diff < 0)
+	diff += ady, b += dx;
+      else
+	diff -= adx, b += dy;
+    }
+}
+
 // [crispy] taken from mbfsrc/P_SETUP.C:547-707, slightly adapted
 
-void P_CreateBlockMap(void)
+void P_CreateBlockMap(int lumpnum)
 {
   register int i;
   fixed_t minx = INT_MAX, miny = INT_MAX, maxx = INT_MIN, maxy = INT_MIN;
+  unsigned int checksum = P_BlockMapChecksum();
+  blockmapcache_t *cache;
+
+  // [AP] Reuse the blockmap if it was already built this session
+
+  for (cache = blockmapcache; cache != NULL; cache = cache->next)
+    if (cache->lumpnum == lumpnum && cache->checksum == checksum &&
+	cache->numvertexes == numvertexes && cache->numlines == numlines)
+      break;
+
+  if (cache != NULL)
+    {
+      bmaporgx = cache->orgx;
+      bmaporgy = cache->orgy;
+      bmapwidth = cache->width;
+      bmapheight = cache->height;
+      blockmaplump = Z_Malloc(sizeof(*blockmaplump) * cache->count,
+			      PU_LEVEL, 0);
+      memcpy(blockmaplump, cache->lump, sizeof(*blockmaplump) * cache->count);
+      goto done;
+    }
 
   // First find limits of map
 
@@ -63,81 +185,30 @@ void P_CreateBlockMap(void)
   //
   // Pseudocode:
   //
-  // For each linedef:
+  // For each linedef, count the blocks it crosses:
   //
   //   Map the starting and ending vertices to blocks.
   //
   //   Starting in the starting vertex's block, do:
   //
-  //     Add linedef to current block's list, dynamically resizing it.
+  //     Count linedef in current block.
   //
   //     If current block is the same as the ending vertex's block, exit loop.
   //
   //     Move to an adjacent block by moving towards the ending block in
   //     either the x or y direction, to the block which contains the linedef.
+  //
+  // [AP] Then lay out the lists from the counts and walk each linedef
+  // again, this time storing it in the lists of the blocks it crosses.
 
   {
-    typedef struct { int n, nalloc, *list; } bmap_t;  // blocklist structure
     unsigned tot = bmapwidth * bmapheight;            // size of blockmap
-    bmap_t *bmap = calloc(sizeof *bmap, tot);         // array of blocklists
-    int x, y, adx, ady, bend;
+    int *counts = calloc(sizeof *counts, tot);        // lines per block
+    int count = tot+6;  // we need at least 1 word per block, plus reserved's
+    int ndx;
 
     for (i=0; i < numlines; i++)
-      {
-	int dx, dy, diff, b;
-
-	// starting coordinates
-	x = (lines[i].v1->x >> FRACBITS) - minx;
-	y = (lines[i].v1->y >> FRACBITS) - miny;
-
-	// x-y deltas
-	adx = lines[i].dx >> FRACBITS, dx = adx < 0 ? -1 : 1;
-	ady = lines[i].dy >> FRACBITS, dy = ady < 0 ? -1 : 1;
-
-	// difference in preferring to move across y (>0) instead of x (<0)
-	diff = !adx ? 1 : !ady ? -1 :
-	  (((x >> MAPBTOFRAC) << MAPBTOFRAC) +
-	   (dx > 0 ? MAPBLOCKUNITS-1 : 0) - x) * (ady = abs(ady)) * dx -
-	  (((y >> MAPBTOFRAC) << MAPBTOFRAC) +
-	   (dy > 0 ? MAPBLOCKUNITS-1 : 0) - y) * (adx = abs(adx)) * dy;
-
-	// starting block, and pointer to its blocklist structure
-	b = (y >> MAPBTOFRAC)*bmapwidth + (x >> MAPBTOFRAC);
-
-	// ending block
-	bend = (((lines[i].v2->y >> FRACBITS) - miny) >> MAPBTOFRAC) *
-	    bmapwidth + (((lines[i].v2->x >> FRACBITS) - minx) >> MAPBTOFRAC);
-
-	// delta for pointer when moving across y
-	dy *= bmapwidth;
-
-	// deltas for diff inside the loop
-	adx <<= MAPBTOFRAC;
-	ady <<= MAPBTOFRAC;
-
-	// Now we simply iterate block-by-block until we reach the end block.
-	while ((unsigned) b < tot)    // failsafe -- should ALWAYS be true
-	  {
-	    // Increase size of allocated list if necessary
-	    if (bmap[b].n >= bmap[b].nalloc)
-	      bmap[b].list = I_Realloc(bmap[b].list,
-				     (bmap[b].nalloc = bmap[b].nalloc ?
-				      bmap[b].nalloc*2 : 8)*sizeof*bmap->list);
-
-	    // Add linedef to end of list
-	    bmap[b].list[bmap[b].n++] = i;
-
-	    // If we have reached the last block, exit
-	    if (b == bend)
-	      break;
-
-	    // Move in either the x or y direction to the next block
-	    if (diff < 0)
-	      diff += ady, b += dx;
-	    else
-	      diff -= adx, b += dy;
-	  }
-      }
+      P_WalkLineBlocks(i, minx, miny, tot, counts, NULL);
 
     // Compute the total size of the blockmap.
     //
@@ -146,47 +217,61 @@ void P_CreateBlockMap(void)
     //
     // 4 words, unused if this routine is called, are reserved at the start.
 
-    {
-      int count = tot+6;  // we need at least 1 word per block, plus reserved's
+    for (i = 0; i < tot; i++)
+      if (counts[i])
+	count += counts[i] + 2; // 1 header word + 1 trailer word + blocklist
 
-      for (i = 0; i < tot; i++)
-	if (bmap[i].n)
-	  count += bmap[i].n + 2; // 1 header word + 1 trailer word + blocklist
+    // Allocate blockmap lump with computed count
+    blockmaplump = Z_Malloc(sizeof(*blockmaplump) * count, PU_LEVEL, 0);
 
-      // Allocate blockmap lump with computed count
-      blockmaplump = Z_Malloc(sizeof(*blockmaplump) * count, PU_LEVEL, 0);
-    }
+    // Now lay out the compressed blockmap.
 
-    // Now compress the blockmap.
-    {
-      int ndx = tot += 4;         // Advance index to start of linedef lists
-      bmap_t *bp = bmap;          // Start of uncompressed blockmap
-
-      blockmaplump[ndx++] = 0;    // Store an empty blockmap list at start
-      blockmaplump[ndx++] = -1;   // (Used for compression)
-
-      for (i = 4; i < tot; i++, bp++)
-	if (bp->n)                                      // Non-empty blocklist
-	  {
-	    blockmaplump[blockmaplump[i] = ndx++] = 0;  // Store index & header
-	    do
-	      blockmaplump[ndx++] = bp->list[--bp->n];  // Copy linedef list
-	    while (bp->n);
-	    blockmaplump[ndx++] = -1;                   // Store trailer
-	    free(bp->list);                             // Free linedef list
-	  }
-	else            // Empty blocklist: point to reserved empty blocklist
-	  blockmaplump[i] = tot;
-
-      free(bmap);    // Free uncompressed blockmap
-    }
+    ndx = tot + 4;                  // Index of start of linedef lists
+
+    blockmaplump[ndx++] = 0;        // Store an empty blockmap list at start
+    blockmaplump[ndx++] = -1;       // (Used for compression)
+
+    for (i = 0; i < tot; i++)
+      if (counts[i])                                    // Non-empty blocklist
+	{
+	  blockmaplump[blockmaplump[i+4] = ndx++] = 0;  // Store index & header
+	  ndx += counts[i];                             // Room for linedefs
+	  counts[i] = ndx;                              // Fill from here down
+	  blockmaplump[ndx++] = -1;                     // Store trailer
+	}
+      else            // Empty blocklist: point to reserved empty blocklist
+	blockmaplump[i+4] = tot + 4;
+
+    // Fill in the linedef lists
+    for (i=0; i < numlines; i++)
+      P_WalkLineBlocks(i, minx, miny, tot, counts, blockmaplump);
+
+    free(counts);
+
+    // [AP] Keep a copy for the next time this map is loaded
+    cache = malloc(sizeof(*cache));
+    cache->lumpnum = lumpnum;
+    cache->numvertexes = numvertexes;
+    cache->numlines = numlines;
+    cache->checksum = checksum;
+    cache->orgx = bmaporgx;
+    cache->orgy = bmaporgy;
+    cache->width = bmapwidth;
+    cache->height = bmapheight;
+    cache->count = count;
+    cache->lump = malloc(sizeof(*cache->lump) * count);
+    memcpy(cache->lump, blockmaplump, sizeof(*cache->lump) * count);
+    cache->next = blockmapcache;
+    blockmapcache = cache;
   }
 
+done:
   // [crispy] copied over from P_LoadBlockMap()
   {
     int count = sizeof(*blocklinks) * bmapwidth * bmapheight;
     blocklinks = Z_Malloc(count, PU_LEVEL, 0);
     memset(blocklinks, 0, count);
+    P_InitBlockThings();
     blockmap = blockmaplump+4;
   }
 
@@ -23,6 +23,7 @@
 
 #include "m_random.h"
 #include "i_system.h"
+#include "z_zone.h" // [AP]
 
 #include "doomdef.h"
 #include "p_local.h"
@@ -92,52 +93,162 @@ void A_Fall (mobj_t *actor);
 // Recursively traverse adjacent sectors,
 // sound blocking lines cut off traversal.
 //
+// [AP] The traversal is a breadth first search over soundedges[], the
+// two-sided lines out of each sector built once by P_InitSoundGraph().
+// Whether a line is open still depends on the heights at the time of the
+// noise, so that is tested as the flood goes. A sector can be reached
+// having crossed no sound block or one, and keeps the lowest, which is
+// what the recursion ends up with whatever order it visits lines in:
+// the first pass floods what is reachable without crossing a block, the
+// second whatever is one block away from that.
+//
 
 mobj_t*		soundtarget;
 
-void
-P_RecursiveSound
-( sector_t*	sec,
-  int		soundblocks )
+typedef struct
 {
-    int		i;
+    sector_t*	other;
+    boolean	soundblock;
+} soundedge_t;
+
+static soundedge_t*	soundedges;
+static int*		soundedgestart;	// numsectors+1, into soundedges
+static sector_t**	soundqueue;	// numsectors
+
+void P_InitSoundGraph (void)
+{
+    int		i, j, n;
+    sector_t*	sec;
     line_t*	check;
+
+    soundedgestart = Z_Malloc((numsectors + 1) * sizeof(*soundedgestart), PU_LEVEL, NULL);
+    soundqueue = Z_Malloc(numsectors * sizeof(*soundqueue), PU_LEVEL, NULL);
+
+    for (i = 0, n = 0, sec = sectors; i < numsectors; i++, sec++)
+    {
+	for (j = 0; j < sec->linecount; j++)
+	{
+	    check = sec->lines[j];
+	    if ((check->flags & ML_TWOSIDED) && check->sidenum[1] != NO_INDEX)
+		n++;
+	}
+    }
+
+    soundedges = Z_Malloc(n * sizeof(*soundedges) + 1, PU_LEVEL, NULL);
+
+    for (i = 0, n = 0, sec = sectors; i < numsectors; i++, sec++)
+    {
+	soundedgestart[i] = n;
+
+	for (j = 0; j < sec->linecount; j++)
+	{
+	    check = sec->lines[j];
+
+	    // P_LineOpening() closes lines without a back side
+	    if (!(check->flags & ML_TWOSIDED) || check->sidenum[1] == NO_INDEX)
+		continue;
+
+	    if (sides[check->sidenum[0]].sector == sec)
+		soundedges[n].other = sides[check->sidenum[1]].sector;
+	    else
+		soundedges[n].other = sides[check->sidenum[0]].sector;
+
+	    soundedges[n].soundblock = (check->flags & ML_SOUNDBLOCK) != 0;
+	    n++;
+	}
+    }
+
+    soundedgestart[numsectors] = n;
+}
+
+// The same test as P_LineOpening(), the two sectors are the line's sides.
+
+static inline boolean P_SoundOpen (const sector_t* a, const sector_t* b)
+{
+    const fixed_t top = MIN(a->ceilingheight, b->ceilingheight);
+    const fixed_t bottom = MAX(a->floorheight, b->floorheight);
+
+    return top - bottom > 0;
+}
+
+static void
+P_RecursiveSound
+( sector_t*	start )
+{
+    int		head, tail, mark;
+    int		i, end;
+    sector_t*	sec;
     sector_t*	other;
-	
-    // wake up all monsters in this sector
-    if (sec->validcount == validcount
-	&& sec->soundtraversed <= soundblocks+1)
+
+    // no block crossed
+    start->validcount = validcount;
+    start->soundtraversed = 1;
+    start->soundtarget = soundtarget;
+    soundqueue[0] = start;
+    tail = 1;
+
+    for (head = 0; head < tail; head++)
     {
-	return;		// already flooded
+	sec = soundqueue[head];
+
+	for (i = soundedgestart[sec - sectors], end = soundedgestart[sec - sectors + 1]; i < end; i++)
+	{
+	    other = soundedges[i].other;
+
+	    if (soundedges[i].soundblock
+	     || (other->validcount == validcount && other->soundtraversed == 1)
+	     || !P_SoundOpen(sec, other))
+		continue;
+
+	    other->validcount = validcount;
+	    other->soundtraversed = 1;
+	    other->soundtarget = soundtarget;
+	    soundqueue[tail++] = other;
+	}
     }
-    
-    sec->validcount = validcount;
-    sec->soundtraversed = soundblocks+1;
-    sec->soundtarget = soundtarget;
-	
-    for (i=0 ;i<sec->linecount ; i++)
+
+    // one block crossed, from the sectors reached above
+    mark = tail;
+
+    for (head = 0; head < mark; head++)
     {
-	check = sec->lines[i];
-	if (! (check->flags & ML_TWOSIDED) )
-	    continue;
-	
-	P_LineOpening (check);
+	sec = soundqueue[head];
 
-	if (openrange <= 0)
-	    continue;	// closed door
-	
-	if ( sides[ check->sidenum[0] ].sector == sec)
-	    other = sides[ check->sidenum[1] ] .sector;
-	else
-	    other = sides[ check->sidenum[0] ].sector;
-	
-	if (check->flags & ML_SOUNDBLOCK)
+	for (i = soundedgestart[sec - sectors], end = soundedgestart[sec - sectors + 1]; i < end; i++)
 	{
-	    if (!soundblocks)
-		P_RecursiveSound (other, 1);
+	    other = soundedges[i].other;
+
+	    if (!soundedges[i].soundblock
+	     || other->validcount == validcount
+	     || !P_SoundOpen(sec, other))
+		continue;
+
+	    other->validcount = validcount;
+	    other->soundtraversed = 2;
+	    other->soundtarget = soundtarget;
+	    soundqueue[tail++] = other;
+	}
+    }
+
+    // every sector is queued once at most, so the queue has room for both
+    for (head = mark; head < tail; head++)
+    {
+	sec = soundqueue[head];
+
+	for (i = soundedgestart[sec - sectors], end = soundedgestart[sec - sectors + 1]; i < end; i++)
+	{
+	    other = soundedges[i].other;
+
+	    if (soundedges[i].soundblock
+	     || other->validcount == validcount
+	     || !P_SoundOpen(sec, other))
+		continue;
+
+	    other->validcount = validcount;
+	    other->soundtraversed = 2;
+	    other->soundtarget = soundtarget;
+	    soundqueue[tail++] = other;
 	}
-	else
-	    P_RecursiveSound (other, soundblocks);
     }
 }
 
@@ -159,7 +270,7 @@ P_NoiseAlert
 
     soundtarget = target;
     validcount++;
-    P_RecursiveSound (emmiter->subsector->sector, 0);
+    P_RecursiveSound (emmiter->subsector->sector);
 }
 
 
@@ -1040,6 +1151,7 @@ void A_SkelMissile (mobj_t* actor)
 
     mo->x += mo->momx;
     mo->y += mo->momy;
+    P_SyncBlockThing(mo); // [AP] moved without relinking
     mo->tracer = actor->target;
 }
 
@@ -1391,6 +1503,7 @@ void A_VileAttack (mobj_t* actor)
     // move the fire between the vile and the player
     fire->x = actor->target->x - FixedMul (24*FRACUNIT, finecosine[an]);
     fire->y = actor->target->y - FixedMul (24*FRACUNIT, finesine[an]);	
+    P_SyncBlockThing(fire); // [AP] moved without relinking
     P_RadiusAttack (fire, actor, 70 );
 }
 
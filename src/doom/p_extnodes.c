@@ -232,6 +232,62 @@ void P_LoadNodes_DeePBSP (int lump)
   W_ReleaseLumpNum(lump);
 }
 
+// [AP] The nodes are decoded a block of records at a time, straight from
+// the lump or from the zlib stream, into the final arrays; the whole lump
+// is no longer inflated into a staging buffer first.
+
+#define ZNODES_CHUNK 128
+
+typedef struct
+{
+    byte *data;
+    unsigned int pos, len;
+#ifdef HAVE_LIBZ
+    z_stream *zstream;
+#endif
+} znodes_reader_t;
+
+static void ZNodes_Read (znodes_reader_t *reader, void *dest, unsigned int size)
+{
+#ifdef HAVE_LIBZ
+    if (reader->zstream)
+    {
+	z_stream *zstream = reader->zstream;
+	int err;
+
+	zstream->next_out = dest;
+	zstream->avail_out = size;
+
+	while (zstream->avail_out > 0)
+	{
+	    err = inflate(zstream, Z_SYNC_FLUSH);
+
+	    if (err == Z_STREAM_END && zstream->avail_out > 0)
+		I_Error("P_LoadNodes: ZDBSP nodes are truncated!");
+	    else if (err != Z_OK && err != Z_STREAM_END)
+		I_Error("P_LoadNodes: Error during ZDBSP nodes decompression!");
+	}
+
+	return;
+    }
+#endif
+
+    if (size > reader->len - reader->pos)
+	I_Error("P_LoadNodes: ZDBSP nodes are truncated!");
+
+    memcpy(dest, reader->data + reader->pos, size);
+    reader->pos += size;
+}
+
+static unsigned int ZNodes_ReadLong (znodes_reader_t *reader)
+{
+    unsigned int value;
+
+    ZNodes_Read(reader, &value, sizeof(value));
+
+    return LONG(value);
+}
+
 // [crispy] support maps with compressed or uncompressed ZDBSP nodes
 // adapted from prboom-plus/src/p_setup.c:1040-1331
 // heavily modified, condensed and simplyfied
@@ -244,10 +300,8 @@ void P_LoadNodes_DeePBSP (int lump)
 void P_LoadNodes_ZDBSP (int lump, boolean compressed)
 {
     byte *data;
-    unsigned int i;
-#ifdef HAVE_LIBZ
-    byte *output;
-#endif
+    unsigned int i, j;
+    znodes_reader_t reader;
 
     unsigned int orgVerts, newVerts;
     unsigned int numSubs, currSeg;
@@ -257,72 +311,32 @@ void P_LoadNodes_ZDBSP (int lump, boolean compressed)
 
     data = W_CacheLumpNum(lump, PU_LEVEL);
 
-    // 0. Uncompress nodes lump (or simply skip header)
+    // 0. Set up decompression of the nodes lump (or simply skip header)
+
+    memset(&reader, 0, sizeof(reader));
+    reader.data = data + 4;
+    reader.len = W_LumpLength(lump) - 4;
 
     if (compressed)
     {
 #ifdef HAVE_LIBZ
-	const int len =  W_LumpLength(lump);
-	int outlen, err;
-	z_stream *zstream;
-
-	// first estimate for compression rate:
-	// output buffer size == 2.5 * input size
-	outlen = 2.5 * len;
-	output = Z_Malloc(outlen, PU_STATIC, 0);
-
 	// initialize stream state for decompression
-	zstream = malloc(sizeof(*zstream));
-	memset(zstream, 0, sizeof(*zstream));
-	zstream->next_in = data + 4;
-	zstream->avail_in = len - 4;
-	zstream->next_out = output;
-	zstream->avail_out = outlen;
-
-	if (inflateInit(zstream) != Z_OK)
-	    I_Error("P_LoadNodes: Error during ZDBSP nodes decompression initialization!");
-
-	// resize if output buffer runs full
-	while ((err = inflate(zstream, Z_SYNC_FLUSH)) == Z_OK)
-	{
-	    int outlen_old = outlen;
-	    outlen = 2 * outlen_old;
-	    output = I_Realloc(output, outlen);
-	    zstream->next_out = output + outlen_old;
-	    zstream->avail_out = outlen - outlen_old;
-	}
+	reader.zstream = malloc(sizeof(*reader.zstream));
+	memset(reader.zstream, 0, sizeof(*reader.zstream));
+	reader.zstream->next_in = reader.data;
+	reader.zstream->avail_in = reader.len;
 
-	if (err != Z_STREAM_END)
-	    I_Error("P_LoadNodes: Error during ZDBSP nodes decompression!");
-
-	fprintf(stderr, "P_LoadNodes: ZDBSP nodes compression ratio %.3f\n",
-	        (float)zstream->total_out/zstream->total_in);
-
-	data = output;
-
-	if (inflateEnd(zstream) != Z_OK)
-	    I_Error("P_LoadNodes: Error during ZDBSP nodes decompression shut-down!");
-
-	// release the original data lump
-	W_ReleaseLumpNum(lump);
-	free(zstream);
+	if (inflateInit(reader.zstream) != Z_OK)
+	    I_Error("P_LoadNodes: Error during ZDBSP nodes decompression initialization!");
 #else
 	I_Error("P_LoadNodes: Compressed ZDBSP nodes are not supported!");
 #endif
     }
-    else
-    {
-	// skip header
-	data += 4;
-    }
 
     // 1. Load new vertices added during node building
 
-    orgVerts = LONG(*((unsigned int*)data));
-    data += sizeof(orgVerts);
-
-    newVerts = LONG(*((unsigned int*)data));
-    data += sizeof(newVerts);
+    orgVerts = ZNodes_ReadLong(&reader);
+    newVerts = ZNodes_ReadLong(&reader);
 
     if (orgVerts + newVerts == (unsigned int)numvertexes)
     {
@@ -335,15 +349,20 @@ void P_LoadNodes_ZDBSP (int lump, boolean compressed)
 	memset(newvertarray + orgVerts, 0, newVerts * sizeof(vertex_t));
     }
 
-    for (i = 0; i < newVerts; i++)
+    for (i = 0; i < newVerts; i += j)
     {
-	newvertarray[i + orgVerts].r_x =
-	newvertarray[i + orgVerts].x = LONG(*((unsigned int*)data));
-	data += sizeof(newvertarray[0].x);
+	unsigned int mv[ZNODES_CHUNK][2];
+	const unsigned int n = MIN(newVerts - i, ZNODES_CHUNK);
+
+	ZNodes_Read(&reader, mv, n * sizeof(mv[0]));
+
+	for (j = 0; j < n; j++)
+	{
+	    vertex_t *v = newvertarray + orgVerts + i + j;
 
-	newvertarray[i + orgVerts].r_y =
-	newvertarray[i + orgVerts].y = LONG(*((unsigned int*)data));
-	data += sizeof(newvertarray[0].y);
+	    v->r_x = v->x = LONG(mv[j][0]);
+	    v->r_y = v->y = LONG(mv[j][1]);
+	}
     }
 
     if (vertexes != newvertarray)
@@ -361,8 +380,7 @@ void P_LoadNodes_ZDBSP (int lump, boolean compressed)
 
     // 2. Load subsectors
 
-    numSubs = LONG(*((unsigned int*)data));
-    data += sizeof(numSubs);
+    numSubs = ZNodes_ReadLong(&reader);
 
     if (numSubs < 1)
 	I_Error("P_LoadNodes: No subsectors in map!");
@@ -370,21 +388,24 @@ void P_LoadNodes_ZDBSP (int lump, boolean compressed)
     numsubsectors = numSubs;
     subsectors = Z_Malloc(numsubsectors * sizeof(subsector_t), PU_LEVEL, 0);
 
-    for (i = currSeg = 0; i < numsubsectors; i++)
+    for (i = currSeg = 0; i < numsubsectors; i += j)
     {
-	mapsubsector_zdbsp_t *mseg = (mapsubsector_zdbsp_t*) data + i;
+	mapsubsector_zdbsp_t ms[ZNODES_CHUNK];
+	const unsigned int n = MIN(numsubsectors - i, ZNODES_CHUNK);
 
-	subsectors[i].firstline = currSeg;
-	subsectors[i].numlines = LONG(mseg->numsegs);
-	currSeg += LONG(mseg->numsegs);
-    }
+	ZNodes_Read(&reader, ms, n * sizeof(ms[0]));
 
-    data += numsubsectors * sizeof(mapsubsector_zdbsp_t);
+	for (j = 0; j < n; j++)
+	{
+	    subsectors[i + j].firstline = currSeg;
+	    subsectors[i + j].numlines = LONG(ms[j].numsegs);
+	    currSeg += LONG(ms[j].numsegs);
+	}
+    }
 
     // 3. Load segs
 
-    numSegs = LONG(*((unsigned int*)data));
-    data += sizeof(numSegs);
+    numSegs = ZNodes_ReadLong(&reader);
 
     // The number of stored segs should match the number of segs used by subsectors
     if (numSegs != currSeg)
@@ -395,100 +416,121 @@ void P_LoadNodes_ZDBSP (int lump, boolean compressed)
     numsegs = numSegs;
     segs = Z_Malloc(numsegs * sizeof(seg_t), PU_LEVEL, 0);
 
-    for (i = 0; i < numsegs; i++)
+    for (i = 0; i < numsegs; i += j)
     {
-	line_t *ldef;
-	unsigned int linedef;
-	unsigned char side;
-	seg_t *li = segs + i;
-	mapseg_zdbsp_t *ml = (mapseg_zdbsp_t *) data + i;
-	unsigned int v1, v2;
+	mapseg_zdbsp_t msegs[ZNODES_CHUNK];
+	const unsigned int n = MIN(numsegs - i, ZNODES_CHUNK);
 
-	v1 = LONG(ml->v1);
-	v2 = LONG(ml->v2);
-	li->v1 = &vertexes[v1];
-	li->v2 = &vertexes[v2];
+	ZNodes_Read(&reader, msegs, n * sizeof(msegs[0]));
 
-	linedef = (unsigned short)SHORT(ml->linedef);
-	ldef = &lines[linedef];
-	li->linedef = ldef;
-	side = ml->side;
-
-	// e6y: check for wrong indexes
-	if ((unsigned)linedef >= (unsigned)numlines)
+	for (j = 0; j < n; j++)
 	{
+	    line_t *ldef;
+	    unsigned int linedef;
+	    unsigned char side;
+	    seg_t *li = segs + i + j;
+	    mapseg_zdbsp_t *ml = msegs + j;
+	    unsigned int v1, v2;
+
+	    v1 = LONG(ml->v1);
+	    v2 = LONG(ml->v2);
+	    li->v1 = &vertexes[v1];
+	    li->v2 = &vertexes[v2];
+
+	    linedef = (unsigned short)SHORT(ml->linedef);
+	    ldef = &lines[linedef];
+	    li->linedef = ldef;
+	    side = ml->side;
+
+	    // e6y: check for wrong indexes
+	    if ((unsigned)linedef >= (unsigned)numlines)
+	    {
 		I_Error("P_LoadSegs: seg %d references a non-existent linedef %d",
-			i, (unsigned)linedef);
-	}
-	if ((unsigned)ldef->sidenum[side] >= (unsigned)numsides)
-	{
+			i + j, (unsigned)linedef);
+	    }
+	    if ((unsigned)ldef->sidenum[side] >= (unsigned)numsides)
+	    {
 		I_Error("P_LoadSegs: linedef %d for seg %d references a non-existent sidedef %d",
-			linedef, i, (unsigned)ldef->sidenum[side]);
-	}
-
-	li->sidedef = &sides[ldef->sidenum[side]];
-	li->frontsector = sides[ldef->sidenum[side]].sector;
+			linedef, i + j, (unsigned)ldef->sidenum[side]);
+	    }
 
-	// seg angle and offset are not included
-	li->angle = R_PointToAngle2(segs[i].v1->x, segs[i].v1->y, segs[i].v2->x, segs[i].v2->y);
-	li->offset = GetOffset(li->v1, (ml->side ? ldef->v2 : ldef->v1));
+	    li->sidedef = &sides[ldef->sidenum[side]];
+	    li->frontsector = sides[ldef->sidenum[side]].sector;
 
-	if (ldef->flags & ML_TWOSIDED)
-	{
-	    int sidenum = ldef->sidenum[side ^ 1];
+	    // seg angle and offset are not included
+	    li->angle = R_PointToAngle2(li->v1->x, li->v1->y, li->v2->x, li->v2->y);
+	    li->offset = GetOffset(li->v1, (ml->side ? ldef->v2 : ldef->v1));
 
-	    if (sidenum < 0 || sidenum >= numsides)
+	    if (ldef->flags & ML_TWOSIDED)
 	    {
-		if (li->sidedef->midtexture)
+		int sidenum = ldef->sidenum[side ^ 1];
+
+		if (sidenum < 0 || sidenum >= numsides)
 		{
-		    li->backsector = 0;
-		    fprintf(stderr, "P_LoadSegs: Linedef %u has two-sided flag set, but no second sidedef\n", linedef);
+		    if (li->sidedef->midtexture)
+		    {
+			li->backsector = 0;
+			fprintf(stderr, "P_LoadSegs: Linedef %u has two-sided flag set, but no second sidedef\n", linedef);
+		    }
+		    else
+			li->backsector = GetSectorAtNullAddress();
 		}
 		else
-		    li->backsector = GetSectorAtNullAddress();
+		    li->backsector = sides[sidenum].sector;
 	    }
 	    else
-		li->backsector = sides[sidenum].sector;
+		li->backsector = 0;
 	}
-	else
-	    li->backsector = 0;
     }
 
-    data += numsegs * sizeof(mapseg_zdbsp_t);
-
     // 4. Load nodes
 
-    numNodes = LONG(*((unsigned int*)data));
-    data += sizeof(numNodes);
+    numNodes = ZNodes_ReadLong(&reader);
 
     numnodes = numNodes;
     nodes = Z_Malloc(numnodes * sizeof(node_t), PU_LEVEL, 0);
 
-    for (i = 0; i < numnodes; i++)
+    for (i = 0; i < numnodes; i += j)
     {
-	int j, k;
-	node_t *no = nodes + i;
-	mapnode_zdbsp_t *mn = (mapnode_zdbsp_t *) data + i;
+	mapnode_zdbsp_t mnodes[ZNODES_CHUNK];
+	const unsigned int n = MIN(numnodes - i, ZNODES_CHUNK);
 
-	no->x = SHORT(mn->x)<<FRACBITS;
-	no->y = SHORT(mn->y)<<FRACBITS;
-	no->dx = SHORT(mn->dx)<<FRACBITS;
-	no->dy = SHORT(mn->dy)<<FRACBITS;
+	ZNodes_Read(&reader, mnodes, n * sizeof(mnodes[0]));
 
-	for (j = 0; j < 2; j++)
+	for (j = 0; j < n; j++)
 	{
-	    no->children[j] = LONG(mn->children[j]);
-	
-	    for (k = 0; k < 4; k++)
-		no->bbox[j][k] = SHORT(mn->bbox[j][k])<<FRACBITS;
+	    int c, k;
+	    node_t *no = nodes + i + j;
+	    mapnode_zdbsp_t *mn = mnodes + j;
+
+	    no->x = SHORT(mn->x)<<FRACBITS;
+	    no->y = SHORT(mn->y)<<FRACBITS;
+	    no->dx = SHORT(mn->dx)<<FRACBITS;
+	    no->dy = SHORT(mn->dy)<<FRACBITS;
+
+	    for (c = 0; c < 2; c++)
+	    {
+		no->children[c] = LONG(mn->children[c]);
+
+		for (k = 0; k < 4; k++)
+		    no->bbox[c][k] = SHORT(mn->bbox[c][k])<<FRACBITS;
+	    }
 	}
     }
 
 #ifdef HAVE_LIBZ
     if (compressed)
-	Z_Free(output);
-    else
+    {
+	fprintf(stderr, "P_LoadNodes: ZDBSP nodes compression ratio %.3f\n",
+	        (float)reader.zstream->total_out/reader.zstream->total_in);
+
+	if (inflateEnd(reader.zstream) != Z_OK)
+	    I_Error("P_LoadNodes: Error during ZDBSP nodes decompression shut-down!");
+
+	free(reader.zstream);
+    }
 #endif
+
     W_ReleaseLumpNum(lump);
 }
 
@@ -17,12 +17,15 @@
 //	[crispy] Archiving: Extended SaveGame I/O.
 //
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "config.h"
 #include "doomstat.h"
 #include "doomtype.h"
+#include "i_system.h"
 #include "m_misc.h"
 #include "p_extsaveg.h"
 #include "p_local.h"
@@ -37,89 +40,131 @@
 
 static char *line, *string;
 
-static void P_WritePackageTarname (const char *key)
+// [AP] Extended data is written as a binary block right after the
+// SAVEGAME_EOF marker: an 8 byte magic holding the format version, then
+// records of a tag byte, a varint payload length and the payload, ended by
+// tag 0. Payloads are rows of the fields in the entry's format, ints as
+// zigzag varints and strings as a varint length and the bytes. The file
+// then ends in the block's offset as a little endian 32 bit int and the
+// magic again, so it can be found before the rest of the save is read.
+// Saves without it carry the old "key values" text lines.
+
+#define EXTSAVEG_MAGIC "APXSAVE\x01"
+#define EXTSAVEG_MAGIC_LEN 8
+#define EXTSAVEG_TRAILER_LEN (4 + EXTSAVEG_MAGIC_LEN)
+
+// markpoints: the count and 20 coordinates
+#define MAX_ROW_FIELDS 21
+
+typedef struct
+{
+	int count;
+	int ints[MAX_ROW_FIELDS];
+	const char *strings[MAX_ROW_FIELDS];
+} extsavegrow_t;
+
+static byte *record;
+static size_t record_len, record_size;
+
+static void P_PutByte (byte b)
+{
+	if (record_len == record_size)
+	{
+		record_size = record_size ? 2 * record_size : 256;
+		record = I_Realloc(record, record_size);
+	}
+
+	record[record_len++] = b;
+}
+
+static void P_PutUInt (unsigned int value)
+{
+	while (value >= 0x80)
+	{
+		P_PutByte((byte) (value | 0x80));
+		value >>= 7;
+	}
+
+	P_PutByte((byte) value);
+}
+
+static void P_PutInt (int value)
+{
+	P_PutUInt(((unsigned int) value << 1) ^ (value < 0 ? ~0u : 0));
+}
+
+static void P_PutString (const char *s)
 {
-	M_snprintf(line, MAX_LINE_LEN, "%s %s\n", key, PACKAGE_VERSION);
-	fputs(line, save_stream);
+	size_t len = strnlen(s, MAX_STRING_LEN);
+
+	P_PutUInt(len);
+
+	while (len-- > 0)
+	{
+		P_PutByte((byte) *s++);
+	}
+}
+
+static void P_WritePackageTarname (void)
+{
+	P_PutString(PACKAGE_VERSION);
 }
 
 // maplumpinfo->wad_file->basename
 
 char *savewadfilename = NULL;
 
-static void P_WriteWadFileName (const char *key)
+static void P_WriteWadFileName (void)
 {
-	M_snprintf(line, MAX_LINE_LEN, "%s %s\n", key, W_WadNameForLump(maplumpinfo));
-	fputs(line, save_stream);
+	P_PutString(W_WadNameForLump(maplumpinfo));
 }
 
-static void P_ReadWadFileName (const char *key)
+static void P_ReadWadFileName (const extsavegrow_t *row)
 {
 	if (!savewadfilename &&
 	    // [crispy] only check if loaded from the menu,
 	    // we have no chance to show a dialog otherwise
 	    startloadgame == -1)
 	{
-		if (sscanf(line, "%s", string) == 1 &&
-		    !strncmp(string, key, MAX_STRING_LEN))
-		{
-			if (sscanf(line, "%*s %s", string) == 1)
-			{
-				savewadfilename = strdup(string);
-			}
-		}
+		savewadfilename = strdup(row->strings[0]);
 	}
 }
 
 // extrakills
 
-static void P_WriteExtraKills (const char *key)
+static void P_WriteExtraKills (void)
 {
 	if (extrakills)
 	{
-		M_snprintf(line, MAX_LINE_LEN, "%s %d\n", key, extrakills);
-		fputs(line, save_stream);
+		P_PutInt(extrakills);
 	}
 }
 
-static void P_ReadExtraKills (const char *key)
+static void P_ReadExtraKills (const extsavegrow_t *row)
 {
-	int value;
-
-	if (sscanf(line, "%s %d", string, &value) == 2 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		extrakills = value;
-	}
+	extrakills = row->ints[0];
 }
 
 // totalleveltimes
 
-static void P_WriteTotalLevelTimes (const char *key)
+static void P_WriteTotalLevelTimes (void)
 {
 	if (totalleveltimes)
 	{
-		M_snprintf(line, MAX_LINE_LEN, "%s %d\n", key, totalleveltimes);
-		fputs(line, save_stream);
+		P_PutInt(totalleveltimes);
 	}
 }
 
-static void P_ReadTotalLevelTimes (const char *key)
+static void P_ReadTotalLevelTimes (const extsavegrow_t *row)
 {
-	int value;
-
-	if (sscanf(line, "%s %d", string, &value) == 2 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		totalleveltimes = value;
-	}
+	totalleveltimes = row->ints[0];
 }
 
 // T_FireFlicker()
 
 extern void T_FireFlicker (fireflicker_t* flick);
 
-static void P_WriteFireFlicker (const char *key)
+static void P_WriteFireFlicker (void)
 {
 	thinker_t* th;
 
@@ -129,47 +174,33 @@ static void P_WriteFireFlicker (const char *key)
 		{
 			fireflicker_t *flick = (fireflicker_t *)th;
 
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d %d %d\n",
-			           key,
-			           (int)(flick->sector - sectors),
-			           (int)flick->count,
-			           (int)flick->maxlight,
-			           (int)flick->minlight);
-			fputs(line, save_stream);
+			P_PutInt(flick->sector - sectors);
+			P_PutInt(flick->count);
+			P_PutInt(flick->maxlight);
+			P_PutInt(flick->minlight);
 		}
 	}
 }
 
-static void P_ReadFireFlicker (const char *key)
+static void P_ReadFireFlicker (const extsavegrow_t *row)
 {
-	int sector, count, maxlight, minlight;
+	fireflicker_t *flick;
 
-	if (sscanf(line, "%s %d %d %d %d\n",
-	           string,
-	           &sector,
-	           &count,
-	           &maxlight,
-	           &minlight) == 5 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		fireflicker_t *flick;
-
-		flick = Z_Malloc(sizeof(*flick), PU_LEVEL, NULL);
+	flick = Z_Malloc(sizeof(*flick), PU_LEVEL, NULL);
 
-		flick->sector = &sectors[sector];
-		flick->count = count;
-		flick->maxlight = maxlight;
-		flick->minlight = minlight;
+	flick->sector = &sectors[row->ints[0]];
+	flick->count = row->ints[1];
+	flick->maxlight = row->ints[2];
+	flick->minlight = row->ints[3];
 
-		flick->thinker.function.acp1 = (actionf_p1)T_FireFlicker;
+	flick->thinker.function.acp1 = (actionf_p1)T_FireFlicker;
 
-		P_AddThinker(&flick->thinker);
-	}
+	P_AddThinker(&flick->thinker);
 }
 
 // sector->soundtarget
 
-static void P_WriteSoundTarget (const char *key)
+static void P_WriteSoundTarget (void)
 {
 	int i;
 	sector_t *sector;
@@ -178,32 +209,20 @@ static void P_WriteSoundTarget (const char *key)
 	{
 		if (sector->soundtarget)
 		{
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d\n",
-			           key,
-			           i,
-			           P_ThinkerToIndex((thinker_t *) sector->soundtarget));
-			fputs(line, save_stream);
+			P_PutInt(i);
+			P_PutInt(P_ThinkerToIndex((thinker_t *) sector->soundtarget));
 		}
 	}
 }
 
-static void P_ReadSoundTarget (const char *key)
+static void P_ReadSoundTarget (const extsavegrow_t *row)
 {
-	int sector, target;
-
-	if (sscanf(line, "%s %d %d\n",
-	           string,
-	           &sector,
-	           &target) == 3 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		sectors[sector].soundtarget = (mobj_t *) P_IndexToThinker(target);
-	}
+	sectors[row->ints[0]].soundtarget = (mobj_t *) P_IndexToThinker(row->ints[1]);
 }
 
 // sector->oldspecial
 
-static void P_WriteOldSpecial (const char *key)
+static void P_WriteOldSpecial (void)
 {
 	int i;
 	sector_t *sector;
@@ -212,32 +231,20 @@ static void P_WriteOldSpecial (const char *key)
 	{
 		if (sector->oldspecial)
 		{
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d\n",
-			           key,
-			           i,
-			           sector->oldspecial);
-			fputs(line, save_stream);
+			P_PutInt(i);
+			P_PutInt(sector->oldspecial);
 		}
 	}
 }
 
-static void P_ReadOldSpecial (const char *key)
+static void P_ReadOldSpecial (const extsavegrow_t *row)
 {
-	int sector, oldspecial;
-
-	if (sscanf(line, "%s %d %d\n",
-	           string,
-	           &sector,
-	           &oldspecial) == 3 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		sectors[sector].oldspecial = oldspecial;
-	}
+	sectors[row->ints[0]].oldspecial = row->ints[1];
 }
 
 // sector->rlightlevel
 
-static void P_WriteRLightlevel (const char *key)
+static void P_WriteRLightlevel (void)
 {
 	int i;
 	sector_t *sector;
@@ -246,34 +253,22 @@ static void P_WriteRLightlevel (const char *key)
 	{
 		if (sector->rlightlevel != sector->lightlevel)
 		{
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d\n",
-			           key,
-			           i,
-			           (int)sector->rlightlevel);
-			fputs(line, save_stream);
+			P_PutInt(i);
+			P_PutInt(sector->rlightlevel);
 		}
 	}
 }
 
-static void P_ReadRLightlevel (const char *key)
+static void P_ReadRLightlevel (const extsavegrow_t *row)
 {
-	int sector, rlightlevel;
-
-	if (sscanf(line, "%s %d %d\n",
-	           string,
-	           &sector,
-	           &rlightlevel) == 3 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		sectors[sector].rlightlevel = (short)rlightlevel;
-	}
+	sectors[row->ints[0]].rlightlevel = (short)row->ints[1];
 }
 
 // buttonlist[]
 
 extern void P_StartButton (line_t *line, bwhere_e w, int texture, int time);
 
-static void P_WriteButton (const char *key)
+static void P_WriteButton (void)
 {
 	int i;
 
@@ -283,38 +278,24 @@ static void P_WriteButton (const char *key)
 
 		if (button->btimer)
 		{
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d %d %d\n",
-			           key,
-			           (int)(button->line - lines),
-			           (int)button->where,
-			           (int)button->btexture,
-			           (int)button->btimer);
-			fputs(line, save_stream);
+			P_PutInt(button->line - lines);
+			P_PutInt(button->where);
+			P_PutInt(button->btexture);
+			P_PutInt(button->btimer);
 		}
 	}
 }
 
-static void P_ReadButton (const char *key)
+static void P_ReadButton (const extsavegrow_t *row)
 {
-	int linedef, where, btexture, btimer;
-
-	if (sscanf(line, "%s %d %d %d %d\n",
-	           string,
-	           &linedef,
-	           &where,
-	           &btexture,
-	           &btimer) == 5 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		P_StartButton(&lines[linedef], where, btexture, btimer);
-	}
+	P_StartButton(&lines[row->ints[0]], row->ints[1], row->ints[2], row->ints[3]);
 }
 
 // numbraintargets, braintargeton
 
 extern int numbraintargets, braintargeton;
 
-static void P_WriteBrainTarget (const char *key)
+static void P_WriteBrainTarget (void)
 {
 	thinker_t *th;
 
@@ -326,11 +307,8 @@ static void P_WriteBrainTarget (const char *key)
 
 			if (mo->state == &states[S_BRAINEYE1])
 			{
-				M_snprintf(line, MAX_LINE_LEN, "%s %d %d\n",
-				           key,
-				           numbraintargets,
-				           braintargeton);
-				fputs(line, save_stream);
+				P_PutInt(numbraintargets);
+				P_PutInt(braintargeton);
 
 				// [crispy] return after the first brain spitter is found
 				return;
@@ -339,16 +317,10 @@ static void P_WriteBrainTarget (const char *key)
 	}
 }
 
-static void P_ReadBrainTarget (const char *key)
+static void P_ReadBrainTarget (const extsavegrow_t *row)
 {
-	int numtargets, targeton;
-
-	if (sscanf(line, "%s %d %d", string, &numtargets, &targeton) == 3 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
-	{
-		numbraintargets = 0; // [crispy] force A_BrainAwake()
-		braintargeton = targeton;
-	}
+	numbraintargets = 0; // [crispy] force A_BrainAwake()
+	braintargeton = row->ints[1];
 }
 
 // markpoints[]
@@ -356,45 +328,40 @@ static void P_ReadBrainTarget (const char *key)
 extern void AM_GetMarkPoints (int *n, long *p);
 extern void AM_SetMarkPoints (int n, long *p);
 
-static void P_WriteMarkPoints (const char *key)
+static void P_WriteMarkPoints (void)
 {
-	int n;
+	int i, n;
 	long p[20];
 
 	AM_GetMarkPoints(&n, p);
 
 	if (p[0] != -1)
 	{
-		M_snprintf(line, MAX_LINE_LEN, "%s %d %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld\n",
-		           key, n,
-		           p[0], p[1], p[2], p[3], p[4],
-		           p[5], p[6], p[7], p[8], p[9],
-		           p[10], p[11], p[12], p[13], p[14],
-		           p[15], p[16], p[17], p[18], p[19]);
-		fputs(line, save_stream);
+		P_PutInt(n);
+
+		for (i = 0; i < arrlen(p); i++)
+		{
+			P_PutInt((int) p[i]);
+		}
 	}
 }
 
-static void P_ReadMarkPoints (const char *key)
+static void P_ReadMarkPoints (const extsavegrow_t *row)
 {
-	int n;
+	int i;
 	long p[20];
 
-	if (sscanf(line, "%s %d %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld %ld\n",
-	           string, &n,
-	           &p[0], &p[1], &p[2], &p[3], &p[4],
-	           &p[5], &p[6], &p[7], &p[8], &p[9],
-	           &p[10], &p[11], &p[12], &p[13], &p[14],
-	           &p[15], &p[16], &p[17], &p[18], &p[19]) == 22 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
+	for (i = 0; i < arrlen(p); i++)
 	{
-		AM_SetMarkPoints(n, p);
+		p[i] = row->ints[1 + i];
 	}
+
+	AM_SetMarkPoints(row->ints[0], p);
 }
 
 // players[]->lookdir
 
-static void P_WritePlayersLookdir (const char *key)
+static void P_WritePlayersLookdir (void)
 {
 	int i;
 
@@ -402,191 +369,419 @@ static void P_WritePlayersLookdir (const char *key)
 	{
 		if (playeringame[i] && players[i].lookdir)
 		{
-			M_snprintf(line, MAX_LINE_LEN, "%s %d %d\n", key, i, players[i].lookdir);
-			fputs(line, save_stream);
+			P_PutInt(i);
+			P_PutInt(players[i].lookdir);
 		}
 	}
 }
 
-static void P_ReadPlayersLookdir (const char *key)
+static void P_ReadPlayersLookdir (const extsavegrow_t *row)
 {
-	int i, value;
+	const int i = row->ints[0];
 
-	if (sscanf(line, "%s %d %d", string, &i, &value) == 3 &&
-	    !strncmp(string, key, MAX_STRING_LEN) &&
-	    i < MAXPLAYERS &&
+	if (i >= 0 && i < MAXPLAYERS &&
 	    (crispy->freelook || crispy->mouselook))
 	{
-		players[i].lookdir = value;
+		players[i].lookdir = row->ints[1];
 	}
 }
 
 // musinfo.current_item
 
-static void P_WriteMusInfo (const char *key)
+static void P_WriteMusInfo (void)
 {
 	if (musinfo.current_item > 0 && musinfo.items[0] > 0)
 	{
-		char lump[9], orig[9];
+		char lump[9] = {0}, orig[9] = {0};
 
 		strncpy(lump, lumpinfo[musinfo.current_item]->name, 8);
 		strncpy(orig, lumpinfo[musinfo.items[0]]->name, 8);
 
-		M_snprintf(line, MAX_LINE_LEN, "%s %s %s\n", key, lump, orig);
-		fputs(line, save_stream);
+		P_PutString(lump);
+		P_PutString(orig);
 	}
 }
 
-static void P_ReadMusInfo (const char *key)
+static void P_ReadMusInfo (const extsavegrow_t *row)
 {
-	int items;
-	char lump[9] = {0}, orig[9] = {0};
-
-	items = sscanf(line, "%s %s %s", string, lump, orig);
+	int i;
 
-	if (items >= 2 &&
-	    !strncmp(string, key, MAX_STRING_LEN))
+	if ((i = W_CheckNumForName(row->strings[0])) > 0)
 	{
-		int i;
-
-		if ((i = W_CheckNumForName(lump)) > 0)
-		{
-			memset(&musinfo, 0, sizeof(musinfo));
-			musinfo.current_item = i;
-			musinfo.from_savegame = true;
-			S_ChangeMusInfoMusic(i, true);
-		}
+		memset(&musinfo, 0, sizeof(musinfo));
+		musinfo.current_item = i;
+		musinfo.from_savegame = true;
+		S_ChangeMusInfoMusic(i, true);
+	}
 
-		if (items == 3 &&
-		    (i = W_CheckNumForName(orig)) > 0)
-		{
-			musinfo.items[0] = i;
-		}
+	if (row->count == 2 &&
+	    (i = W_CheckNumForName(row->strings[1])) > 0)
+	{
+		musinfo.items[0] = i;
 	}
 }
 
+// [AP] Each entry's fields: 'i' for an int, 's' for a string. Those after
+// a '|' may be missing from a text line. Tags are what binary saves know
+// the entries by, so they must never be reused.
+
 typedef struct
 {
 	const char *key;
-	void (* extsavegwritefn) (const char *key);
-	void (* extsavegreadfn) (const char *key);
+	const byte tag;
+	const char *fields;
+	void (* extsavegwritefn) (void);
+	void (* extsavegreadfn) (const extsavegrow_t *row);
 	const int pass;
 } extsavegdata_t;
 
 static const extsavegdata_t extsavegdata[] =
 {
 	// [crispy] @FORKS: please change this if you are going to introduce incompatible changes!
-	{"crispy-doom", P_WritePackageTarname, NULL, 0},
-	{"wadfilename", P_WriteWadFileName, P_ReadWadFileName, 0},
-	{"extrakills", P_WriteExtraKills, P_ReadExtraKills, 1},
-	{"totalleveltimes", P_WriteTotalLevelTimes, P_ReadTotalLevelTimes, 1},
-	{"fireflicker", P_WriteFireFlicker, P_ReadFireFlicker, 1},
-	{"soundtarget", P_WriteSoundTarget, P_ReadSoundTarget, 1},
-	{"oldspecial", P_WriteOldSpecial, P_ReadOldSpecial, 1},
-	{"rlightlevel", P_WriteRLightlevel, P_ReadRLightlevel, 1},
-	{"button", P_WriteButton, P_ReadButton, 1},
-	{"braintarget", P_WriteBrainTarget, P_ReadBrainTarget, 1},
-	{"markpoints", P_WriteMarkPoints, P_ReadMarkPoints, 1},
-	{"playerslookdir", P_WritePlayersLookdir, P_ReadPlayersLookdir, 1},
-	{"musinfo", P_WriteMusInfo, P_ReadMusInfo, 0},
+	{"crispy-doom", 1, "s", P_WritePackageTarname, NULL, 0},
+	{"wadfilename", 2, "s", P_WriteWadFileName, P_ReadWadFileName, 0},
+	{"extrakills", 3, "i", P_WriteExtraKills, P_ReadExtraKills, 1},
+	{"totalleveltimes", 4, "i", P_WriteTotalLevelTimes, P_ReadTotalLevelTimes, 1},
+	{"fireflicker", 5, "iiii", P_WriteFireFlicker, P_ReadFireFlicker, 1},
+	{"soundtarget", 6, "ii", P_WriteSoundTarget, P_ReadSoundTarget, 1},
+	{"oldspecial", 7, "ii", P_WriteOldSpecial, P_ReadOldSpecial, 1},
+	{"rlightlevel", 8, "ii", P_WriteRLightlevel, P_ReadRLightlevel, 1},
+	{"button", 9, "iiii", P_WriteButton, P_ReadButton, 1},
+	{"braintarget", 10, "ii", P_WriteBrainTarget, P_ReadBrainTarget, 1},
+	{"markpoints", 11, "iiiiiiiiiiiiiiiiiiiii", P_WriteMarkPoints, P_ReadMarkPoints, 1},
+	{"playerslookdir", 12, "ii", P_WritePlayersLookdir, P_ReadPlayersLookdir, 1},
+	{"musinfo", 13, "s|s", P_WriteMusInfo, P_ReadMusInfo, 0},
 };
 
+static void P_WriteLE32 (unsigned int value)
+{
+	byte b[4];
+
+	b[0] = value & 0xff;
+	b[1] = (value >> 8) & 0xff;
+	b[2] = (value >> 16) & 0xff;
+	b[3] = (value >> 24) & 0xff;
+
+	mem_fwrite(b, 1, 4, save_stream);
+}
+
 void P_WriteExtendedSaveGameData (void)
 {
+	const long blockpos = mem_ftell(save_stream);
+	byte header[6];
+	size_t header_len, len;
 	int i;
 
-	line = malloc(MAX_LINE_LEN);
+	mem_fwrite(EXTSAVEG_MAGIC, 1, EXTSAVEG_MAGIC_LEN, save_stream);
 
 	for (i = 0; i < arrlen(extsavegdata); i++)
 	{
-		extsavegdata[i].extsavegwritefn(extsavegdata[i].key);
+		record_len = 0;
+		extsavegdata[i].extsavegwritefn();
+
+		if (record_len == 0)
+		{
+			continue;
+		}
+
+		header[0] = extsavegdata[i].tag;
+		header_len = 1;
+
+		for (len = record_len; len >= 0x80; len >>= 7)
+		{
+			header[header_len++] = (byte) (len | 0x80);
+		}
+		header[header_len++] = (byte) len;
+
+		mem_fwrite(header, 1, header_len, save_stream);
+		mem_fwrite(record, 1, record_len, save_stream);
+	}
+
+	header[0] = 0;
+	mem_fwrite(header, 1, 1, save_stream);
+
+	P_WriteLE32(blockpos);
+	mem_fwrite(EXTSAVEG_MAGIC, 1, EXTSAVEG_MAGIC_LEN, save_stream);
+}
+
+static const extsavegdata_t *P_FindExtSaveGData (boolean bytag, int tag,
+                                                 const char *key, int pass)
+{
+	int i;
+
+	for (i = 1; i < arrlen(extsavegdata); i++)
+	{
+		if (extsavegdata[i].extsavegreadfn &&
+		    extsavegdata[i].pass == pass &&
+		    (bytag ? extsavegdata[i].tag == tag :
+		             !strncmp(key, extsavegdata[i].key, MAX_STRING_LEN)))
+		{
+			return &extsavegdata[i];
+		}
 	}
 
-	free(line);
+	return NULL;
 }
 
+// [AP] Call the entry's reader if the row has all its required fields.
+
+static void P_ReadRow (const extsavegdata_t *data, extsavegrow_t *row)
+{
+	const char *f;
+	int required = 0;
+
+	for (f = data->fields; *f != '\0' && *f != '|'; f++)
+	{
+		required++;
+	}
+
+	if (row->count >= required)
+	{
+		data->extsavegreadfn(row);
+	}
+}
+
+// Text saves: "key value..." lines
+
 static void P_ReadKeyValuePairs (int pass)
 {
-	while (fgets(line, MAX_LINE_LEN, save_stream))
+	while (mem_fgets(line, MAX_LINE_LEN, save_stream))
 	{
-		if (sscanf(line, "%s", string) == 1)
+		const extsavegdata_t *data;
+		extsavegrow_t row;
+		const char *f;
+		char *token, *end;
+
+		token = strtok(line, " \t\r\n");
+
+		if (token == NULL ||
+		    (data = P_FindExtSaveGData(false, 0, token, pass)) == NULL)
 		{
-			int i;
+			continue;
+		}
+
+		row.count = 0;
+
+		for (f = data->fields; *f != '\0'; f++)
+		{
+			if (*f == '|')
+			{
+				continue;
+			}
 
-			for (i = 1; i < arrlen(extsavegdata); i++)
+			if ((token = strtok(NULL, " \t\r\n")) == NULL)
 			{
-				if (extsavegdata[i].extsavegreadfn &&
-				    extsavegdata[i].pass == pass &&
-				    !strncmp(string, extsavegdata[i].key, MAX_STRING_LEN))
+				break;
+			}
+
+			if (*f == 's')
+			{
+				row.strings[row.count] = token;
+			}
+			else
+			{
+				row.ints[row.count] = strtol(token, &end, 10);
+
+				if (end == token)
 				{
-					extsavegdata[i].extsavegreadfn(extsavegdata[i].key);
+					break;
 				}
 			}
+
+			row.count++;
 		}
+
+		P_ReadRow(data, &row);
 	}
 }
 
-// [crispy] pointer to the info struct for the map lump about to load
-lumpinfo_t *savemaplumpinfo = NULL;
+// [AP] Binary saves
 
-void P_ReadExtendedSaveGameData (int pass)
+static boolean P_GetUInt (const byte **p, const byte *end, unsigned int *value)
 {
-	long p, curpos, endpos;
-	byte episode, map;
-	int lumpnum = -1;
+	int shift;
 
-	line = malloc(MAX_LINE_LEN);
-	string = malloc(MAX_STRING_LEN);
+	*value = 0;
 
-	// [crispy] two-pass reading of extended savegame data
-	if (pass == 1)
+	for (shift = 0; *p < end && shift < 32; shift += 7)
 	{
-		P_ReadKeyValuePairs(1);
+		const byte b = *(*p)++;
 
-		free(line);
-		free(string);
+		*value |= (unsigned int) (b & 0x7f) << shift;
 
-		return;
+		if (!(b & 0x80))
+		{
+			return true;
+		}
 	}
 
-	curpos = ftell(save_stream);
+	return false;
+}
 
-	// [crispy] check which map we would want to load
-	fseek(save_stream, SAVESTRINGSIZE + VERSIONSIZE + 1, SEEK_SET); // [crispy] + 1 for "gameskill"
-	if (fread(&episode, 1, 1, save_stream) == 1 &&
-	    fread(&map, 1, 1, save_stream) == 1)
+static boolean P_ReadRecordRow (const extsavegdata_t *data, extsavegrow_t *row,
+                                const byte **p, const byte *end)
+{
+	static char strings[MAX_ROW_FIELDS][MAX_STRING_LEN + 1];
+	unsigned int value;
+	const char *f;
+
+	row->count = 0;
+
+	for (f = data->fields; *f != '\0'; f++)
 	{
-		lumpnum = P_GetNumForMap ((int) episode, (int) map, false);
+		if (*f == '|')
+		{
+			continue;
+		}
+
+		if (!P_GetUInt(p, end, &value))
+		{
+			return false;
+		}
+
+		if (*f == 's')
+		{
+			if (value > MAX_STRING_LEN || (ptrdiff_t) value > end - *p)
+			{
+				return false;
+			}
+
+			memcpy(strings[row->count], *p, value);
+			strings[row->count][value] = '\0';
+			row->strings[row->count] = strings[row->count];
+			*p += value;
+		}
+		else
+		{
+			row->ints[row->count] = (int) (value >> 1) ^ -(int) (value & 1);
+		}
+
+		row->count++;
 	}
 
-	if (lumpnum >= 0)
+	return true;
+}
+
+static boolean P_ReadBinaryMagic (void)
+{
+	char magic[EXTSAVEG_MAGIC_LEN];
+
+	return mem_fread(magic, 1, EXTSAVEG_MAGIC_LEN, save_stream) == EXTSAVEG_MAGIC_LEN &&
+	       !memcmp(magic, EXTSAVEG_MAGIC, EXTSAVEG_MAGIC_LEN);
+}
+
+// The stream is just past the magic at the start of the block.
+
+static void P_ReadBinaryRecords (int pass)
+{
+	byte tag;
+
+	while (mem_fread(&tag, 1, 1, save_stream) == 1 && tag != 0)
 	{
-		savemaplumpinfo = lumpinfo[lumpnum];
+		const extsavegdata_t *data;
+		extsavegrow_t row;
+		const byte *p, *end;
+		unsigned int len = 0;
+		int shift;
+		byte b;
+
+		for (shift = 0; shift < 32; shift += 7)
+		{
+			if (mem_fread(&b, 1, 1, save_stream) != 1)
+			{
+				return;
+			}
+
+			len |= (unsigned int) (b & 0x7f) << shift;
+
+			if (!(b & 0x80))
+			{
+				break;
+			}
+		}
+
+		if (len > record_size)
+		{
+			record_size = len;
+			record = I_Realloc(record, record_size);
+		}
+
+		if (mem_fread(record, 1, len, save_stream) != len)
+		{
+			return;
+		}
+
+		// Tags this version doesn't know are skipped.
+
+		if ((data = P_FindExtSaveGData(true, tag, NULL, pass)) == NULL)
+		{
+			continue;
+		}
+
+		p = record;
+		end = record + len;
+
+		while (p < end && P_ReadRecordRow(data, &row, &p, end))
+		{
+			P_ReadRow(data, &row);
+		}
 	}
-	else
+}
+
+// Seek to just past the magic at the start of the block that the trailer
+// points at. False for saves without one.
+
+static boolean P_FindBinaryBlock (long endpos)
+{
+	byte offset[4];
+	long blockpos;
+
+	if (endpos < EXTSAVEG_MAGIC_LEN + 1 + EXTSAVEG_TRAILER_LEN)
 	{
-		// [crispy] unavailable map!
-		savemaplumpinfo = NULL;
+		return false;
 	}
 
-	// [crispy] read key/value pairs past the end of the regular savegame data
-	fseek(save_stream, 0, SEEK_END);
-	endpos = ftell(save_stream);
+	mem_fseek(save_stream, endpos - EXTSAVEG_TRAILER_LEN, MEM_SEEK_SET);
+
+	if (mem_fread(offset, 1, 4, save_stream) != 4 || !P_ReadBinaryMagic())
+	{
+		return false;
+	}
+
+	blockpos = offset[0] | (offset[1] << 8) | (offset[2] << 16)
+	         | ((long) offset[3] << 24);
+
+	if (blockpos <= 0 || blockpos > endpos - EXTSAVEG_TRAILER_LEN)
+	{
+		return false;
+	}
+
+	mem_fseek(save_stream, blockpos, MEM_SEEK_SET);
+
+	return P_ReadBinaryMagic();
+}
+
+// [crispy] text lines start right after a SAVEGAME_EOF byte, but so may
+// anything else, so look for the one followed by the first key
+
+static void P_FindKeyValuePairs (long endpos)
+{
+	long p;
 
 	for (p = endpos - 1; p > 0; p--)
 	{
 		byte curbyte;
 
-		fseek(save_stream, p, SEEK_SET);
+		mem_fseek(save_stream, p, MEM_SEEK_SET);
 
-		if (fread(&curbyte, 1, 1, save_stream) < 1)
+		if (mem_fread(&curbyte, 1, 1, save_stream) < 1)
 		{
 			break;
 		}
 
 		if (curbyte == SAVEGAME_EOF)
 		{
-			if (!fgets(line, MAX_LINE_LEN, save_stream))
+			if (!mem_fgets(line, MAX_LINE_LEN, save_stream))
 			{
 				continue;
 			}
@@ -599,10 +794,79 @@ void P_ReadExtendedSaveGameData (int pass)
 			}
 		}
 	}
+}
+
+// [crispy] pointer to the info struct for the map lump about to load
+lumpinfo_t *savemaplumpinfo = NULL;
+
+void P_ReadExtendedSaveGameData (int pass)
+{
+	long curpos, endpos;
+	byte episode, map;
+	int lumpnum = -1;
+
+	line = malloc(MAX_LINE_LEN);
+	string = malloc(MAX_STRING_LEN);
+
+	// [crispy] two-pass reading of extended savegame data
+	if (pass == 1)
+	{
+		// [AP] the regular data has just been read up to the block
+		curpos = mem_ftell(save_stream);
+
+		if (P_ReadBinaryMagic())
+		{
+			P_ReadBinaryRecords(1);
+		}
+		else
+		{
+			mem_fseek(save_stream, curpos, MEM_SEEK_SET);
+			P_ReadKeyValuePairs(1);
+		}
+
+		free(line);
+		free(string);
+
+		return;
+	}
+
+	curpos = mem_ftell(save_stream);
+
+	// [crispy] check which map we would want to load
+	mem_fseek(save_stream, SAVESTRINGSIZE + VERSIONSIZE + 1, MEM_SEEK_SET); // [crispy] + 1 for "gameskill"
+	if (mem_fread(&episode, 1, 1, save_stream) == 1 &&
+	    mem_fread(&map, 1, 1, save_stream) == 1)
+	{
+		lumpnum = P_GetNumForMap ((int) episode, (int) map, false);
+	}
+
+	if (lumpnum >= 0)
+	{
+		savemaplumpinfo = lumpinfo[lumpnum];
+	}
+	else
+	{
+		// [crispy] unavailable map!
+		savemaplumpinfo = NULL;
+	}
+
+	// [crispy] read key/value pairs past the end of the regular savegame data
+	mem_fseek(save_stream, 0, MEM_SEEK_END);
+	endpos = mem_ftell(save_stream);
+
+	// [AP] binary block, if the save has one
+	if (P_FindBinaryBlock(endpos))
+	{
+		P_ReadBinaryRecords(0);
+	}
+	else
+	{
+		P_FindKeyValuePairs(endpos);
+	}
 
 	free(line);
 	free(string);
 
 	// [crispy] back to where we started
-	fseek(save_stream, curpos, SEEK_SET);
+	mem_fseek(save_stream, curpos, MEM_SEEK_SET);
 }
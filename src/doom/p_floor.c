@@ -52,6 +52,18 @@ T_MovePlane
     boolean	flag;
     fixed_t	lastpos;
 	
+    // [AP] Record the sector for the renderer once per tic.
+    if (sector->oldgametic != gametic)
+	P_AddMovingSector(sector);
+
+    // [AP] Any cached line of sight may go through this sector.
+    P_InvalidateSightCache();
+
+    // [AP] The heights the last move, or any special, left it at.
+    P_HashState(sector - sectors);
+    P_HashState(sector->floorheight);
+    P_HashState(sector->ceilingheight);
+
     // [AM] Store old sector heights for interpolation.
     sector->oldfloorheight = sector->floorheight;
     sector->oldceilingheight = sector->ceilingheight;
@@ -1016,6 +1016,7 @@ P_DamageMobj
     
     // do the damage	
     target->health -= damage;	
+    P_HashState(target->health); // [AP]
     if (target->health <= 0)
     {
 	P_KillMobj (source, target);
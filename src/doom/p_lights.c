@@ -56,6 +56,8 @@ void T_FireFlicker (fireflicker_t* flick)
     // [crispy] A11Y
     if (a11y_sector_lighting)
 	flick->sector->rlightlevel = flick->sector->lightlevel;
+
+    P_SleepThinker (&flick->thinker, &flick->count); // [AP]
 }
 
 
@@ -112,6 +114,8 @@ void T_LightFlash (lightflash_t* flash)
     // [crispy] A11Y
     if (a11y_sector_lighting)
 	flash->sector->rlightlevel = flash->sector->lightlevel;
+
+    P_SleepThinker (&flash->thinker, &flash->count); // [AP]
 }
 
 
@@ -172,6 +176,8 @@ void T_StrobeFlash (strobe_t*		flash)
     // [crispy] A11Y
     if (a11y_sector_lighting)
 	flash->sector->rlightlevel = flash->sector->lightlevel;
+
+    P_SleepThinker (&flash->thinker, &flash->count); // [AP]
 }
 
 
@@ -246,26 +252,23 @@ void EV_TurnTagLightsOff(line_t* line)
     sector_t*		tsec;
     line_t*		templine;
 	
-    sector = sectors;
-    
-    for (j = 0;j < numsectors; j++, sector++)
+    // [AP] only visit the tagged sectors
+    for (j = -1; (j = P_NextTaggedSector(line->tag, j)) >= 0; )
     {
-	if (sector->tag == line->tag)
+	sector = &sectors[j];
+	min = sector->lightlevel;
+	for (i = 0;i < sector->linecount; i++)
 	{
-	    min = sector->lightlevel;
-	    for (i = 0;i < sector->linecount; i++)
-	    {
-		templine = sector->lines[i];
-		tsec = getNextSector(templine,sector);
-		if (!tsec)
-		    continue;
-		if (tsec->lightlevel < min)
-		    min = tsec->lightlevel;
-	    }
-	    sector->lightlevel = min;
-	    // [crispy] A11Y
-	    sector->rlightlevel = sector->lightlevel;
+	    templine = sector->lines[i];
+	    tsec = getNextSector(templine,sector);
+	    if (!tsec)
+		continue;
+	    if (tsec->lightlevel < min)
+		min = tsec->lightlevel;
 	}
+	sector->lightlevel = min;
+	// [crispy] A11Y
+	sector->rlightlevel = sector->lightlevel;
     }
 }
 
@@ -284,33 +287,30 @@ EV_LightTurnOn
     sector_t*	temp;
     line_t*	templine;
 	
-    sector = sectors;
-	
-    for (i=0;i<numsectors;i++, sector++)
+    // [AP] only visit the tagged sectors
+    for (i = -1; (i = P_NextTaggedSector(line->tag, i)) >= 0; )
     {
-	if (sector->tag == line->tag)
+	sector = &sectors[i];
+	// bright = 0 means to search
+	// for highest light level
+	// surrounding sector
+	if (!bright)
 	{
-	    // bright = 0 means to search
-	    // for highest light level
-	    // surrounding sector
-	    if (!bright)
+	    for (j = 0;j < sector->linecount; j++)
 	    {
-		for (j = 0;j < sector->linecount; j++)
-		{
-		    templine = sector->lines[j];
-		    temp = getNextSector(templine,sector);
+		templine = sector->lines[j];
+		temp = getNextSector(templine,sector);
 
-		    if (!temp)
-			continue;
+		if (!temp)
+		    continue;
 
-		    if (temp->lightlevel > bright)
-			bright = temp->lightlevel;
-		}
+		if (temp->lightlevel > bright)
+		    bright = temp->lightlevel;
 	    }
-	    sector-> lightlevel = bright;
-	    // [crispy] A11Y
-	    sector->rlightlevel = sector->lightlevel;
 	}
+	sector-> lightlevel = bright;
+	// [crispy] A11Y
+	sector->rlightlevel = sector->lightlevel;
     }
 }
 
@@ -73,6 +73,27 @@ void P_InitThinkers (void);
 void P_AddThinker (thinker_t* thinker);
 void P_RemoveThinker (thinker_t* thinker);
 
+// [AP] timer wheel for thinkers that are only counting down
+void P_SleepThinker (thinker_t* thinker, int* count);
+void P_WakeAllThinkers (void);
+
+// [AP] sectors moved by T_MovePlane during the last tic,
+//  the only ones the renderer needs to interpolate
+extern	sector_t**	movingsectors;
+extern	int		nummovingsectors;
+
+void P_AddMovingSector (sector_t* sector);
+
+// [AP] Hash of the simulation, folded in where it changes: moved and
+//  spawned mobjs, damage and moving planes. Peers in a netgame and a
+//  demo played back against its keyframes must keep the same one.
+extern	uint64_t	statehash;
+
+#define P_HashState(v) \
+	(statehash = (statehash ^ (uint32_t) (v)) * 0x100000001b3ULL)
+
+uint64_t P_StateHash (void);
+
 
 //
 // P_PSPR
@@ -115,6 +136,25 @@ P_SpawnMobj
   mobjtype_t	type );
 
 void 	P_RemoveMobj (mobj_t* th);
+
+// [AP] mobj pool, see P_InitMobjPool()
+#define MOBJCHUNK	256
+
+typedef struct
+{
+    int		live;		// mobjs currently allocated
+    int		peak;		// most live at once this level
+    int		capacity;	// slots in all chunks
+    int		chunks;
+    int		spawned;	// allocations this level
+} mobjpool_t;
+
+extern mobjpool_t mobjpool;
+
+void	P_InitMobjPool (void);
+void	P_ReserveMobjs (int count);
+mobj_t*	P_AllocMobj (void);
+void	P_FreeThinker (thinker_t* thinker);
 mobj_t* P_SubstNullMobj (mobj_t* th);
 boolean	P_SetMobjState (mobj_t* mobj, statenum_t state);
 void 	P_MobjThinker (mobj_t* mobj);
@@ -131,6 +171,7 @@ void	P_SpawnPuffSafe (fixed_t x, fixed_t y, fixed_t z, boolean safe);
 // P_ENEMY
 //
 void P_NoiseAlert (mobj_t* target, mobj_t* emmiter);
+void P_InitSoundGraph (void); // [AP]
 
 
 //
@@ -199,6 +240,8 @@ P_PathTraverse
 
 void P_UnsetThingPosition (mobj_t* thing);
 void P_SetThingPosition (mobj_t* thing);
+void P_SyncBlockThing (mobj_t* thing);
+void P_InitBlockThings (void);
 
 
 //
@@ -233,6 +276,7 @@ boolean P_TryMove (mobj_t* thing, fixed_t x, fixed_t y);
 boolean P_TeleportMove (mobj_t* thing, fixed_t x, fixed_t y);
 void	P_SlideMove (mobj_t* mo);
 boolean P_CheckSight (mobj_t* t1, mobj_t* t2);
+void	P_InvalidateSightCache (void); // [AP]
 void 	P_UseLines (player_t* player);
 
 boolean P_ChangeSector (sector_t* sector, boolean crunch);
@@ -281,6 +325,23 @@ extern fixed_t		bmaporgx;
 extern fixed_t		bmaporgy;	// origin of block map
 extern mobj_t**		blocklinks;	// for thing chains
 
+// [AP] Structure-of-arrays mirror of each blocklinks chain, so that
+// the bounding box rejection in P_CheckPosition doesn't have to touch
+// every mobj. Entries are oldest first, i.e. in reverse chain order.
+// Cleared for the rest of the level if the chains ever stop matching.
+typedef struct blockthings_s
+{
+    int		count;
+    int		size;
+    mobj_t**	mobj;
+    fixed_t*	x;
+    fixed_t*	y;
+    fixed_t*	radius;
+} blockthings_t;
+
+extern blockthings_t*	blockthings;
+extern boolean		blockthings_valid;
+
 // [crispy] factor out map lump name and number finding into a separate function
 extern int P_GetNumForMap (int episode, int map, boolean critical);
 
@@ -460,6 +460,79 @@ boolean PIT_CheckThing (mobj_t* thing)
 }
 
 
+//
+// P_CheckThingsIterator
+// [AP] P_BlockThingsIterator(x, y, PIT_CheckThing), but scans the
+// blockthings mirror so that things PIT_CheckThing would reject on
+// their bounding box alone are skipped without touching the mobj.
+// The chain order is kept and everything the callback may do to the
+// chains (removals, spawns, nested P_CheckPosition calls clobbering
+// tmx/tmy/tmthing) is honoured, so the result is the same.
+//
+static boolean P_CheckThingsIterator (int x, int y)
+{
+    blockthings_t *cell;
+    mobj_t *mobj;
+    int i;
+
+    if (!blockthings_valid)
+	return P_BlockThingsIterator(x, y, PIT_CheckThing);
+
+    if ( x<0
+	 || y<0
+	 || x>=bmapwidth
+	 || y>=bmapheight)
+    {
+	return true;
+    }
+
+    cell = &blockthings[y*bmapwidth+x];
+    i = cell->count - 1;
+
+    while (1)
+    {
+	const fixed_t tmradius = tmthing->radius;
+
+	for ( ; i >= 0; i--)
+	{
+	    const fixed_t blockdist = cell->radius[i] + tmradius;
+
+	    if (abs(cell->x[i] - tmx) < blockdist
+	        && abs(cell->y[i] - tmy) < blockdist)
+	    {
+		break;
+	    }
+	}
+
+	if (i < 0)
+	    return true;
+
+	mobj = cell->mobj[i];
+
+	if (!PIT_CheckThing(mobj))
+	    return false;
+
+	if (!blockthings_valid || mobj->blockcell != cell)
+	    break;
+
+	// find where the thing is now
+	if (i >= cell->count || cell->mobj[i] != mobj)
+	    for (i = cell->count - 1; cell->mobj[i] != mobj; i--);
+
+	i--;
+    }
+
+    // the thing was unlinked, follow its stale chain like vanilla
+    for (mobj = mobj->bnext; mobj; mobj = mobj->bnext)
+    {
+	if (!PIT_CheckThing(mobj))
+	    return false;
+    }
+
+    return true;
+}
+
+
 //
 // MOVEMENT CLIPPING
 //
@@ -541,7 +614,7 @@ P_CheckPosition
 
     for (bx=xl ; bx<=xh ; bx++)
 	for (by=yl ; by<=yh ; by++)
-	    if (!P_BlockThingsIterator(bx,by,PIT_CheckThing))
+	    if (!P_CheckThingsIterator(bx,by))
 		return false;
     
     // check lines
@@ -1537,6 +1610,7 @@ boolean PIT_ChangeSector (mobj_t*	thing)
 	    thing->flags &= ~MF_SOLID;
 	thing->height = 0;
 	thing->radius = 0;
+	P_SyncBlockThing(thing); // [AP]
 
 	// [crispy] connect giblet object with the crushed monster
 	thing->target = thing;
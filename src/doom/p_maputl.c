@@ -23,6 +23,7 @@
 
 
 #include <stdlib.h>
+#include <string.h>
 
 
 #include "i_system.h" // [crispy] I_Realloc()
@@ -31,6 +32,7 @@
 #include "doomdef.h"
 #include "doomstat.h"
 #include "p_local.h"
+#include "z_zone.h"
 
 
 // State.
@@ -332,6 +334,148 @@ void P_LineOpening (line_t* linedef)
 // THING POSITION SETTING
 //
 
+blockthings_t*	blockthings;
+boolean		blockthings_valid;
+
+//
+// P_InitBlockThings
+// [AP] Clears the blockthings mirror alongside blocklinks.
+//
+void P_InitBlockThings (void)
+{
+    int count = sizeof(*blockthings) * bmapwidth * bmapheight;
+
+    blockthings = Z_Malloc(count, PU_LEVEL, 0);
+    memset(blockthings, 0, count);
+    blockthings_valid = true;
+}
+
+static void P_GrowBlockThings (blockthings_t* cell)
+{
+    const int size = cell->size ? 2 * cell->size : 8;
+    mobj_t **mobj;
+    fixed_t *x;
+
+    mobj = Z_Malloc(size * (sizeof(*mobj) + 3 * sizeof(*x)), PU_LEVEL, 0);
+    x = (fixed_t *) (mobj + size);
+
+    if (cell->size)
+    {
+	memcpy(mobj, cell->mobj, cell->count * sizeof(*mobj));
+	memcpy(x, cell->x, cell->count * sizeof(*x));
+	memcpy(x + size, cell->y, cell->count * sizeof(*x));
+	memcpy(x + 2 * size, cell->radius, cell->count * sizeof(*x));
+	Z_Free(cell->mobj);
+    }
+
+    cell->size = size;
+    cell->mobj = mobj;
+    cell->x = x;
+    cell->y = x + size;
+    cell->radius = x + 2 * size;
+}
+
+//
+// [AP] Mirror vanilla's chain surgery. Anything the arrays can't
+// represent (a thing relinked without being unlinked, or unlinked
+// from a block its origin has since moved out of, which leaves the
+// chains sharing tails) switches the mirror off until the next level.
+//
+static void P_LinkBlockThing (mobj_t* thing, blockthings_t* cell)
+{
+    int i;
+
+    if (!blockthings_valid)
+	return;
+
+    if (thing->blockcell)
+    {
+	blockthings_valid = false;
+	return;
+    }
+
+    if (!cell)
+	return;
+
+    if (cell->count == cell->size)
+	P_GrowBlockThings(cell);
+
+    i = cell->count++;
+    cell->mobj[i] = thing;
+    cell->x[i] = thing->x;
+    cell->y[i] = thing->y;
+    cell->radius[i] = thing->radius;
+    thing->blockcell = cell;
+}
+
+static void P_UnlinkBlockThing (mobj_t* thing)
+{
+    blockthings_t *cell = thing->blockcell;
+    int blockx, blocky;
+    int i, n;
+
+    if (!blockthings_valid)
+	return;
+
+    if (!thing->bprev)
+    {
+	// the chain head is looked up by the thing's current origin
+	blockthings_t *head = NULL;
+
+	blockx = (thing->x - bmaporgx)>>MAPBLOCKSHIFT;
+	blocky = (thing->y - bmaporgy)>>MAPBLOCKSHIFT;
+
+	if (blockx>=0 && blockx < bmapwidth
+	    && blocky>=0 && blocky <bmapheight)
+	{
+	    head = &blockthings[blocky*bmapwidth+blockx];
+	}
+
+	if (cell != head || (!cell && thing->bnext))
+	{
+	    blockthings_valid = false;
+	    return;
+	}
+    }
+    else if (!cell)
+    {
+	blockthings_valid = false;
+	return;
+    }
+
+    if (!cell)
+	return;
+
+    for (i = cell->count - 1; cell->mobj[i] != thing; i--);
+
+    n = --cell->count - i;
+    memmove(&cell->mobj[i], &cell->mobj[i + 1], n * sizeof(*cell->mobj));
+    memmove(&cell->x[i], &cell->x[i + 1], n * sizeof(*cell->x));
+    memmove(&cell->y[i], &cell->y[i + 1], n * sizeof(*cell->y));
+    memmove(&cell->radius[i], &cell->radius[i + 1], n * sizeof(*cell->radius));
+    thing->blockcell = NULL;
+}
+
+//
+// P_SyncBlockThing
+// [AP] Refreshes the mirrored position and radius of a thing
+// whose x, y or radius changed without it being relinked.
+//
+void P_SyncBlockThing (mobj_t* thing)
+{
+    blockthings_t *cell = thing->blockcell;
+    int i;
+
+    if (!blockthings_valid || !cell)
+	return;
+
+    for (i = cell->count - 1; cell->mobj[i] != thing; i--);
+
+    cell->x[i] = thing->x;
+    cell->y[i] = thing->y;
+    cell->radius[i] = thing->radius;
+}
+
 
 //
 // P_UnsetThingPosition
@@ -360,6 +504,8 @@ void P_UnsetThingPosition (mobj_t* thing)
 	
     if ( ! (thing->flags & MF_NOBLOCKMAP) )
     {
+	P_UnlinkBlockThing(thing);
+
 	// inert things don't need to be in blockmap
 	// unlink from block map
 	if (thing->bnext)
@@ -397,6 +543,11 @@ P_SetThingPosition (mobj_t* thing)
     int			blocky;
     mobj_t**		link;
 
+    // [AP] every move and spawn links the thing in again
+    P_HashState(thing->type);
+    P_HashState(thing->x);
+    P_HashState(thing->y);
+    P_HashState(thing->z);
     
     // link into subsector
     ss = R_PointInSubsector (thing->x,thing->y);
@@ -436,11 +587,15 @@ P_SetThingPosition (mobj_t* thing)
 		(*link)->bprev = thing;
 
 	    *link = thing;
+
+	    P_LinkBlockThing(thing, &blockthings[blocky*bmapwidth+blockx]);
 	}
 	else
 	{
 	    // thing is off the map
 	    thing->bnext = thing->bprev = NULL;
+
+	    P_LinkBlockThing(thing, NULL);
 	}
     }
 }
@@ -540,6 +695,13 @@ P_BlockThingsIterator
 static intercept_t*	intercepts; // [crispy] remove INTERCEPTS limit
 intercept_t*	intercept_p;
 
+// [AP] Traversal order, as a min-heap of indexes into intercepts[].
+static int*	interceptheap;
+
+// [AP] Initial arena size. Both arrays start large enough for long
+// traces on busy maps and are kept for the rest of the session.
+#define INTERCEPTARENA	1024
+
 // [crispy] remove INTERCEPTS limit
 // taken from PrBoom+/src/p_maputl.c:422-433
 static void check_intercept(void)
@@ -549,8 +711,9 @@ static void check_intercept(void)
 
 	if (offset >= num_intercepts)
 	{
-		num_intercepts = num_intercepts ? num_intercepts * 2 : MAXINTERCEPTS_ORIGINAL;
+		num_intercepts = num_intercepts ? num_intercepts * 2 : INTERCEPTARENA;
 		intercepts = I_Realloc(intercepts, sizeof(*intercepts) * num_intercepts);
+		interceptheap = I_Realloc(interceptheap, sizeof(*interceptheap) * num_intercepts);
 		intercept_p = intercepts + offset;
 	}
 }
@@ -712,10 +875,47 @@ boolean PIT_AddThingIntercepts (mobj_t* thing)
 }
 
 
+//
+// [AP] InterceptBefore
+// Heap order. The original repeatedly took the first intercept with
+// the smallest frac, so ties go to the one added first.
+//
+static inline boolean InterceptBefore (int a, int b)
+{
+    if (intercepts[a].frac != intercepts[b].frac)
+	return intercepts[a].frac < intercepts[b].frac;
+
+    return a < b;
+}
+
+static void SiftInterceptDown (int i, int count)
+{
+    const int in = interceptheap[i];
+    int child;
+
+    while ((child = 2 * i + 1) < count)
+    {
+	if (child + 1 < count
+	 && InterceptBefore(interceptheap[child + 1], interceptheap[child]))
+	    child++;
+
+	if (!InterceptBefore(interceptheap[child], in))
+	    break;
+
+	interceptheap[i] = interceptheap[child];
+	i = child;
+    }
+
+    interceptheap[i] = in;
+}
+
 //
 // P_TraverseIntercepts
 // Returns true if the traverser function returns true
 // for all lines.
+//
+// [AP] Intercepts are popped from a heap instead of rescanning the
+// whole list for each one; the visiting order is unchanged.
 // 
 boolean
 P_TraverseIntercepts
@@ -723,45 +923,30 @@ P_TraverseIntercepts
   fixed_t	maxfrac )
 {
     int			count;
-    fixed_t		dist;
-    intercept_t*	scan;
+    int			i;
     intercept_t*	in;
 	
     count = intercept_p - intercepts;
-    
-    in = 0;			// shut up compiler warning
+
+    for (i = 0; i < count; i++)
+	interceptheap[i] = i;
+
+    for (i = count / 2 - 1; i >= 0; i--)
+	SiftInterceptDown(i, count);
 	
-    while (count--)
+    while (count > 0)
     {
-	dist = INT_MAX;
-	for (scan = intercepts ; scan<intercept_p ; scan++)
-	{
-	    if (scan->frac < dist)
-	    {
-		dist = scan->frac;
-		in = scan;
-	    }
-	}
-	
-	if (dist > maxfrac)
-	    return true;	// checked everything in range		
+	in = &intercepts[interceptheap[0]];
 
-#if 0  // UNUSED
-    {
-	// don't check these yet, there may be others inserted
-	in = scan = intercepts;
-	for ( scan = intercepts ; scan<intercept_p ; scan++)
-	    if (scan->frac > maxfrac)
-		*in++ = *scan;
-	intercept_p = in;
-	return false;
-    }
-#endif
+	// The original never picked an intercept at INT_MAX either.
+	if (in->frac > maxfrac || in->frac == INT_MAX)
+	    return true;	// checked everything in range		
 
         if ( !func (in) )
 	    return false;	// don't bother going farther
 
-	in->frac = INT_MAX;
+	interceptheap[0] = interceptheap[--count];
+	SiftInterceptDown(0, count);
     }
 	
     return true;		// everything was traversed
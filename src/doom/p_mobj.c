@@ -19,6 +19,7 @@
 #include <stdio.h>
 
 #include "i_system.h"
+#include "m_argv.h" // [AP] M_ParmExists()
 #include "z_zone.h"
 #include "m_random.h"
 
@@ -33,6 +34,7 @@
 #include "s_musinfo.h" // [crispy] S_ParseMusInfo()
 #include "i_swap.h" // [crispy] SHORT()
 #include "w_wad.h" // [crispy] W_CacheLumpNum()
+#include "p_profile.h" // [AP] -thinkstats
 
 #include "doomstat.h"
 
@@ -79,7 +81,12 @@ P_SetMobjState
 	// Modified handling.
 	// Call action functions when the state is set
 	if (st->action.acp3)
-	    st->action.acp3(mobj, NULL, NULL); // [crispy] let pspr action pointers get called from mobj states
+	{
+	    if (thinkstats) // [AP] -thinkstats
+		P_ProfileAction(st->action.acp3, mobj, NULL, NULL);
+	    else
+		st->action.acp3(mobj, NULL, NULL); // [crispy] let pspr action pointers get called from mobj states
+	}
 	
 	state = st->nextstate;
 
@@ -303,6 +310,10 @@ void P_ZMovement (mobj_t* mo)
 {
     fixed_t	dist;
     fixed_t	delta;
+
+    // [AP] where the last tic's vertical movement left it
+    P_HashState(mo->z);
+    P_HashState(mo->momz);
     
     // check for smooth step up
     if (mo->player && mo->z < mo->floorz)
@@ -636,6 +647,132 @@ void P_MobjThinker (mobj_t* mobj)
 }
 
 
+//
+// [AP] MOBJ POOL
+//
+// Mobjs are carved out of PU_LEVEL chunks instead of being allocated
+// one by one. Removed mobjs go onto a free list threaded through
+// thinker.next once P_RunThinkers gets to them, and are handed out
+// again by the next spawn. The first chunk is sized from the map's
+// thing count; the chunks go away with the rest of the level.
+//
+
+typedef struct mobjchunk_s
+{
+    struct mobjchunk_s*	next;
+    int			count;
+    mobj_t		mobjs[];
+} mobjchunk_t;
+
+static mobjchunk_t*	mobjchunks;
+static mobj_t*		mobjfree;
+
+mobjpool_t		mobjpool;
+
+static void P_GrowMobjPool (int count)
+{
+    mobjchunk_t *chunk;
+    int i;
+
+    chunk = Z_Malloc(sizeof(*chunk) + count * sizeof(mobj_t), PU_LEVEL, NULL);
+    chunk->next = mobjchunks;
+    chunk->count = count;
+    mobjchunks = chunk;
+
+    for (i = count - 1; i >= 0; i--)
+    {
+	chunk->mobjs[i].thinker.next = (thinker_t *) mobjfree;
+	mobjfree = &chunk->mobjs[i];
+    }
+
+    mobjpool.capacity += count;
+    mobjpool.chunks++;
+}
+
+//
+// P_InitMobjPool
+// Forgets the previous level's chunks, which Z_FreeTags has released.
+//
+void P_InitMobjPool (void)
+{
+    //!
+    // @category obscure
+    //
+    // Print mobj pool usage at the end of each level.
+    //
+
+    if (mobjpool.spawned > 0 && M_ParmExists("-mobjstats"))
+    {
+	printf("P_InitMobjPool: %d spawns, %d live at most, %d slots in %d chunks\n",
+	       mobjpool.spawned, mobjpool.peak, mobjpool.capacity, mobjpool.chunks);
+    }
+
+    mobjchunks = NULL;
+    mobjfree = NULL;
+    memset(&mobjpool, 0, sizeof(mobjpool));
+}
+
+//
+// P_ReserveMobjs
+// Makes sure at least count mobjs can be spawned without growing.
+//
+void P_ReserveMobjs (int count)
+{
+    count -= mobjpool.capacity - mobjpool.live;
+
+    if (count > 0)
+    {
+	P_GrowMobjPool(count);
+    }
+}
+
+//
+// P_AllocMobj
+// Returns an uninitialised mobj from the pool.
+//
+mobj_t *P_AllocMobj (void)
+{
+    mobj_t *mobj;
+
+    if (mobjfree == NULL)
+    {
+	P_GrowMobjPool(MOBJCHUNK);
+    }
+
+    mobj = mobjfree;
+    mobjfree = (mobj_t *) mobj->thinker.next;
+
+    mobjpool.spawned++;
+    if (++mobjpool.live > mobjpool.peak)
+	mobjpool.peak = mobjpool.live;
+
+    return mobj;
+}
+
+//
+// P_FreeThinker
+// Releases a removed thinker, back to the mobj pool if it came from it.
+//
+void P_FreeThinker (thinker_t* thinker)
+{
+    mobjchunk_t *chunk;
+
+    for (chunk = mobjchunks; chunk != NULL; chunk = chunk->next)
+    {
+	if ((mobj_t *) thinker >= chunk->mobjs
+	 && (mobj_t *) thinker < chunk->mobjs + chunk->count)
+	{
+	    thinker->next = (thinker_t *) mobjfree;
+	    mobjfree = (mobj_t *) thinker;
+	    mobjpool.live--;
+	    return;
+	}
+    }
+
+    Z_Free(thinker);
+}
+
+
 //
 // P_SpawnMobj
 //
@@ -651,7 +788,7 @@ P_SpawnMobjSafe
     state_t*	st;
     mobjinfo_t*	info;
 	
-    mobj = Z_Malloc (sizeof(*mobj), PU_LEVEL, NULL);
+    mobj = P_AllocMobj ();
     memset (mobj, 0, sizeof (*mobj));
     info = &mobjinfo[type];
 	
@@ -1190,6 +1327,7 @@ void P_CheckMissileSpawn (mobj_t* th)
     // be computed if it immediately explodes
     th->x += (th->momx>>1);
     th->y += (th->momy>>1);
+    P_SyncBlockThing(th); // [AP] moved without relinking
     th->z += (th->momz>>1);
 
     if (!P_TryMove (th, th->x, th->y))
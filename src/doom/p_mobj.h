@@ -230,6 +230,9 @@ typedef struct mobj_s
     // Links in blocks (if needed).
     struct mobj_s*	bnext;
     struct mobj_s*	bprev;
+
+    // [AP] Entry in the blockthings mirror of that chain, if any.
+    struct blockthings_s*	blockcell;
     
     struct subsector_s*	subsector;
 
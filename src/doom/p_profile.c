@@ -0,0 +1,256 @@
+//
+// Copyright(C) 1993-1996 Id Software, Inc.
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Time spent in each thinker and state action, for -thinkstats.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "i_system.h"
+#include "i_timer.h"
+#include "m_argv.h"
+#include "m_misc.h"
+#include "p_local.h"
+#include "p_profile.h"
+
+#include "doomstat.h"
+
+boolean thinkstats = false;
+
+// Every code pointer the states in info.c use, and MBF's, named for the
+// table. BEX and DEHACKED can only pick from these, so an unnamed row is
+// a function missing from the lists.
+#define STATE_ACTIONS(X) \
+    X(A_Light0) X(A_WeaponReady) X(A_Lower) X(A_Raise) X(A_Punch) \
+    X(A_ReFire) X(A_FirePistol) X(A_Light1) X(A_FireShotgun) X(A_Light2) \
+    X(A_FireShotgun2) X(A_CheckReload) X(A_OpenShotgun2) X(A_LoadShotgun2) \
+    X(A_CloseShotgun2) X(A_FireCGun) X(A_GunFlash) X(A_FireMissile) \
+    X(A_Saw) X(A_FirePlasma) X(A_BFGsound) X(A_FireBFG) X(A_BFGSpray) \
+    X(A_Explode) X(A_Pain) X(A_PlayerScream) X(A_Fall) X(A_XScream) \
+    X(A_Look) X(A_Chase) X(A_FaceTarget) X(A_PosAttack) X(A_Scream) \
+    X(A_SPosAttack) X(A_VileChase) X(A_VileStart) X(A_VileTarget) \
+    X(A_VileAttack) X(A_StartFire) X(A_Fire) X(A_FireCrackle) X(A_Tracer) \
+    X(A_SkelWhoosh) X(A_SkelFist) X(A_SkelMissile) X(A_FatRaise) \
+    X(A_FatAttack1) X(A_FatAttack2) X(A_FatAttack3) X(A_BossDeath) \
+    X(A_CPosAttack) X(A_CPosRefire) X(A_TroopAttack) X(A_SargAttack) \
+    X(A_HeadAttack) X(A_BruisAttack) X(A_SkullAttack) X(A_Metal) \
+    X(A_SpidRefire) X(A_BabyMetal) X(A_BspiAttack) X(A_Hoof) \
+    X(A_CyberAttack) X(A_PainAttack) X(A_PainDie) X(A_KeenDie) \
+    X(A_BrainPain) X(A_BrainScream) X(A_BrainDie) X(A_BrainAwake) \
+    X(A_BrainSpit) X(A_SpawnSound) X(A_SpawnFly) X(A_BrainExplode) \
+    X(A_Die) X(A_Detonate) X(A_FireOldBFG) X(A_BetaSkullAttack) X(A_Stop) \
+    X(A_Mushroom) X(A_Spawn) X(A_Turn) X(A_Face) X(A_Scratch) \
+    X(A_PlaySound) X(A_RandomJump) X(A_LineEffect)
+
+#define THINKERS(X) \
+    X(P_MobjThinker) X(T_MoveCeiling) X(T_VerticalDoor) X(T_MoveFloor) \
+    X(T_MoveGoobers) X(T_PlatRaise) X(T_LightFlash) X(T_StrobeFlash) \
+    X(T_Glow) X(T_FireFlicker)
+
+#define DECLARE_ACTION(f) extern void f();
+STATE_ACTIONS(DECLARE_ACTION)
+void T_MoveGoobers ();
+void T_FireFlicker ();
+
+typedef struct
+{
+    const char *name;
+    actionf_v func;
+} namedfunc_t;
+
+#define NAME_FUNC(f) {#f, (actionf_v) f},
+static const namedfunc_t namedfuncs[] =
+{
+    THINKERS(NAME_FUNC)
+    STATE_ACTIONS(NAME_FUNC)
+};
+
+// Rows are found by their function's address. There are a hundred or so
+// functions at most, so the table never gets near full.
+#define MAXPROFROWS 512
+
+typedef struct
+{
+    actionf_v func;
+    boolean thinker;
+    unsigned int calls;
+    uint64_t ticks;
+} profrow_t;
+
+static profrow_t profrows[MAXPROFROWS];
+static int numprofrows;
+static uint64_t thinkerticks; // all thinkers, which don't nest
+static char profmap[9];
+
+static profrow_t *P_ProfileRow (actionf_v func, boolean thinker)
+{
+    unsigned int slot = (unsigned int) (((uintptr_t) func >> 4) % MAXPROFROWS);
+
+    while (profrows[slot].func != func)
+    {
+	if (profrows[slot].func == NULL)
+	{
+	    if (numprofrows == MAXPROFROWS - 1)
+	    {
+		break; // keep one slot free so lookups end
+	    }
+
+	    profrows[slot].func = func;
+	    profrows[slot].thinker = thinker;
+	    numprofrows++;
+	    break;
+	}
+
+	slot = (slot + 1) % MAXPROFROWS;
+    }
+
+    return &profrows[slot];
+}
+
+void P_ProfileThinker (thinker_t *thinker)
+{
+    // Read before the call, the thinker may remove itself
+    const actionf_p1 func = thinker->function.acp1;
+    const uint64_t start = I_GetCounter();
+    uint64_t ticks;
+    profrow_t *row;
+
+    func(thinker);
+
+    ticks = I_GetCounter() - start;
+    thinkerticks += ticks;
+
+    row = P_ProfileRow((actionf_v) func, true);
+    row->calls++;
+    row->ticks += ticks;
+}
+
+void P_ProfileAction (actionf_p3 action, void *mobj, void *player, void *psp)
+{
+    const uint64_t start = I_GetCounter();
+    profrow_t *row;
+
+    action(mobj, player, psp);
+
+    row = P_ProfileRow((actionf_v) action, false);
+    row->calls++;
+    row->ticks += I_GetCounter() - start;
+}
+
+static const char *P_ProfileName (const profrow_t *row)
+{
+    static char unnamed[32];
+    int i;
+
+    for (i = 0; i < arrlen(namedfuncs); ++i)
+    {
+	if (namedfuncs[i].func == row->func)
+	{
+	    return namedfuncs[i].name;
+	}
+    }
+
+    M_snprintf(unnamed, sizeof(unnamed), "%s %p",
+               row->thinker ? "thinker" : "action", (void *) row->func);
+    return unnamed;
+}
+
+static int P_CompareRows (const void *a, const void *b)
+{
+    const profrow_t *ra = *(const profrow_t *const *) a;
+    const profrow_t *rb = *(const profrow_t *const *) b;
+
+    if (ra->ticks != rb->ticks)
+	return ra->ticks < rb->ticks ? 1 : -1;
+
+    return 0;
+}
+
+static void P_PrintThinkStats (void)
+{
+    const double freq = (double) I_GetCounterFreq();
+    profrow_t *sorted[MAXPROFROWS];
+    const profrow_t *row;
+    int i, n;
+
+    if (numprofrows == 0 || freq == 0)
+    {
+	return;
+    }
+
+    for (i = 0, n = 0; i < MAXPROFROWS; ++i)
+    {
+	if (profrows[i].func != NULL)
+	    sorted[n++] = &profrows[i];
+    }
+
+    qsort(sorted, n, sizeof(*sorted), P_CompareRows);
+
+    printf("thinker stats for %s: %d tics, %.2f ms in thinkers\n",
+           profmap, leveltime, thinkerticks * 1000.0 / freq);
+    printf("%-20s %10s %10s %10s %10s %6s\n",
+           "function", "calls", "total ms", "us/tic", "ns/call", "%");
+
+    for (i = 0; i < n; ++i)
+    {
+	row = sorted[i];
+	printf("%-20s %10u %10.2f %10.2f %10.0f %6.1f\n",
+	       P_ProfileName(row), row->calls,
+	       row->ticks * 1000.0 / freq,
+	       leveltime > 0 ? row->ticks * 1000000.0 / freq / leveltime : 0.0,
+	       row->ticks * 1000000000.0 / freq / row->calls,
+	       thinkerticks > 0 ? row->ticks * 100.0 / thinkerticks : 0.0);
+    }
+
+    printf("(actions count towards the thinkers that ran them)\n\n");
+}
+
+void P_InitThinkStats (const char *mapname)
+{
+    static boolean initted = false;
+
+    if (!initted)
+    {
+	initted = true;
+
+	//!
+	// @category obscure
+	//
+	// Time each thinker and state action function, printing a table
+	// of calls and time spent in each at the end of every level.
+	//
+
+	thinkstats = M_ParmExists("-thinkstats");
+
+	if (thinkstats)
+	{
+	    I_AtExit(P_PrintThinkStats, false);
+	}
+    }
+
+    if (!thinkstats)
+    {
+	return;
+    }
+
+    P_PrintThinkStats();
+
+    memset(profrows, 0, sizeof(profrows));
+    numprofrows = 0;
+    thinkerticks = 0;
+    M_StringCopy(profmap, mapname, sizeof(profmap));
+}
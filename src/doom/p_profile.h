@@ -0,0 +1,40 @@
+//
+// Copyright(C) 1993-1996 Id Software, Inc.
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Time spent in each thinker and state action, for -thinkstats.
+//
+
+
+#ifndef __P_PROFILE__
+#define __P_PROFILE__
+
+#include "doomtype.h"
+#include "d_think.h"
+
+// Set by -thinkstats. The dispatchers test it and only call through the
+// functions below when it's set, so an unprofiled game pays one branch.
+extern boolean thinkstats;
+
+// Called from P_SetupLevel with the name of the map being loaded. Prints
+// the previous map's table, if any, and starts a new one.
+void P_InitThinkStats (const char *mapname);
+
+// Run a thinker or a state action, adding its time and a call to its
+// function's row. Actions called from inside a thinker also count towards
+// the thinker's time.
+void P_ProfileThinker (thinker_t *thinker);
+void P_ProfileAction (actionf_p3 action, void *mobj, void *player, void *psp);
+
+#endif
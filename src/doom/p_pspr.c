@@ -35,6 +35,7 @@
 
 #include "p_pspr.h"
 #include "a11y.h" // [crispy] A11Y
+#include "p_profile.h" // [AP] -thinkstats
 
 #define LOWERSPEED		FRACUNIT*6
 #define RAISESPEED		FRACUNIT*6
@@ -106,7 +107,10 @@ P_SetPsprite
 	// Modified handling.
 	if (state->action.acp3)
 	{
-	    state->action.acp3(player->mo, player, psp); // [crispy] let mobj action pointers get called from pspr states
+	    if (thinkstats) // [AP] -thinkstats
+		P_ProfileAction(state->action.acp3, player->mo, player, psp);
+	    else
+		state->action.acp3(player->mo, player, psp); // [crispy] let mobj action pointers get called from pspr states
 	    if (!psp->state)
 		break;
 	}
@@ -0,0 +1,1318 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Background REJECT builder, for maps shipped with an empty REJECT.
+//
+//	A sector pair is only rejected once it is shown that no straight
+//	line from one to the other gets past the one-sided linedefs. Sight
+//	is followed from sector to sector through the two-sided linedefs,
+//	and through the vertexes where sectors meet. At each step the
+//	window it can get through is narrowed the way a BSP vis tool does
+//	it: only what lines up with both the first portal and the current
+//	one is carried on to the next. Every clip keeps a little slack, so
+//	the result errs towards "visible". Geometry that would make this
+//	unsound (crossing or overlapping linedefs, sectors that don't
+//	consistently enclose their area) makes the builder give up, and the
+//	map keeps its empty REJECT.
+//
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "doomstat.h"
+#include "i_system.h"
+#include "m_argv.h"
+#include "p_local.h"
+#include "p_reject.h"
+#include "z_zone.h"
+
+// Bigger maps would need too much memory for the visibility table.
+
+#define RJ_MAXSECTORS 8192
+
+// Slack, in map units, kept whenever something is clipped.
+
+#define RJ_EPSILON (1.0 / 16)
+
+// Tolerance for deciding which side of a line a point is on.
+
+#define RJ_SIDE_EPSILON (1.0 / 4096)
+
+#define RJ_MAXPOLY 16
+#define RJ_MAXSEPARATORS 32
+#define RJ_MAXDEPTH 2048
+
+// Portal steps allowed while following sight out of one sector. Past
+// this, the sector is taken to see everything.
+
+#define RJ_SECTOR_BUDGET (1 << 18)
+
+// Size of the grid cells used to look for clashing linedefs.
+
+#define RJ_CELLSHIFT 7
+
+typedef struct
+{
+    int x1, y1, x2, y2;     // map units
+    int front, back;        // back is -1 for one-sided lines
+} rjline_t;
+
+typedef struct
+{
+    rjline_t *lines;
+    int numlines;
+    int numsectors;
+
+    byte *reject;           // the result; NULL if it couldn't be built
+    const char *failure;
+    int rejected;           // number of sector pairs rejected
+} rjbuild_t;
+
+typedef struct
+{
+    double x, y;
+} rjvec_t;
+
+typedef struct
+{
+    int n;
+    rjvec_t p[RJ_MAXPOLY];
+} rjpoly_t;
+
+// Keeps the points where nx * x + ny * y + d >= 0.
+
+typedef struct
+{
+    double nx, ny, d;
+} rjplane_t;
+
+typedef struct
+{
+    int id;                 // line number, or numlines + vertex number
+    int to;                 // sector on the far side
+    boolean line;
+    rjpoly_t poly;
+    rjplane_t forward;      // far side of a line portal
+} rjportal_t;
+
+typedef struct
+{
+    rjpoly_t source;
+    rjpoly_t window;
+    boolean has_forward;
+    rjplane_t forward;
+    rjplane_t separators[RJ_MAXSEPARATORS];
+    int num_separators;
+    int sector;
+    int via;                // id of the portal that led here
+    int next_portal;
+} rjframe_t;
+
+// Half-edge layout of the map: half-edge 2 * i runs along line i from
+// v1 to v2 and 2 * i + 1 runs back, each with its side on the right.
+
+typedef struct
+{
+    int numvertexes;
+    int *vertex;            // start vertex of each half-edge
+    int *vx, *vy;           // vertex positions
+    double *angle;
+    int *order;             // half-edges sorted by vertex, then angle
+    int *first;             // first entry in order for each vertex
+    int *pos;               // where each half-edge is in order
+} rjgraph_t;
+
+static job_t *reject_job = NULL;
+static rjbuild_t *reject_build = NULL;
+
+//
+// Clipping
+//
+
+static boolean RJ_ClipPoly(rjpoly_t *poly, const rjplane_t *plane)
+{
+    rjpoly_t out;
+    double dist[RJ_MAXPOLY];
+    int i;
+
+    for (i = 0; i < poly->n; i++)
+    {
+        dist[i] = plane->nx * poly->p[i].x + plane->ny * poly->p[i].y
+                + plane->d + RJ_EPSILON;
+    }
+
+    if (poly->n == 1)
+    {
+        return dist[0] >= 0;
+    }
+
+    out.n = 0;
+
+    for (i = 0; i < poly->n; i++)
+    {
+        int j = (i + 1) % poly->n;
+
+        if (out.n + 2 > RJ_MAXPOLY)
+        {
+            return true;    // leave it unclipped; a superset is fine
+        }
+
+        if (dist[i] >= 0)
+        {
+            out.p[out.n++] = poly->p[i];
+        }
+
+        if ((dist[i] >= 0) != (dist[j] >= 0))
+        {
+            double t = dist[i] / (dist[i] - dist[j]);
+
+            out.p[out.n].x = poly->p[i].x + t * (poly->p[j].x - poly->p[i].x);
+            out.p[out.n].y = poly->p[i].y + t * (poly->p[j].y - poly->p[i].y);
+            out.n++;
+        }
+    }
+
+    // A segment is walked as a two sided polygon, so each end it keeps
+    // comes out twice.
+
+    if (poly->n == 2 && out.n > 2)
+    {
+        int n = 0;
+
+        for (i = 0; i < out.n && n < 2; i++)
+        {
+            if (n == 0
+             || fabs(out.p[i].x - out.p[0].x) > RJ_SIDE_EPSILON
+             || fabs(out.p[i].y - out.p[0].y) > RJ_SIDE_EPSILON)
+            {
+                out.p[n++] = out.p[i];
+            }
+        }
+        out.n = n;
+    }
+
+    *poly = out;
+
+    return out.n > 0;
+}
+
+// Plane keeping the left of the line from (x1, y1) to (x2, y2).
+
+static void RJ_PlaneThrough(rjplane_t *plane, double x1, double y1,
+                            double x2, double y2)
+{
+    double dx = x2 - x1, dy = y2 - y1;
+    double len = sqrt(dx * dx + dy * dy);
+
+    plane->nx = -dy / len;
+    plane->ny = dx / len;
+    plane->d = -(plane->nx * x1 + plane->ny * y1);
+}
+
+static void RJ_FlipPlane(rjplane_t *plane)
+{
+    plane->nx = -plane->nx;
+    plane->ny = -plane->ny;
+    plane->d = -plane->d;
+}
+
+static void RJ_PolyRange(const rjpoly_t *poly, const rjplane_t *plane,
+                         double *lo, double *hi)
+{
+    int i;
+
+    for (i = 0; i < poly->n; i++)
+    {
+        double d = plane->nx * poly->p[i].x + plane->ny * poly->p[i].y
+                 + plane->d;
+
+        *lo = i ? MIN(*lo, d) : d;
+        *hi = i ? MAX(*hi, d) : d;
+    }
+}
+
+// Lines through a corner of the source and a corner of the window, with
+// the source on one side and the window on the other. Sight that passed
+// through both can only carry on on the window's side of each of them.
+
+static void RJ_FindSeparators(rjframe_t *frame)
+{
+    const rjpoly_t *src = &frame->source, *win = &frame->window;
+    int i, j;
+
+    frame->num_separators = 0;
+
+    for (i = 0; i < src->n; i++)
+    {
+        for (j = 0; j < win->n; j++)
+        {
+            rjplane_t plane;
+            double slo, shi, wlo, whi;
+
+            if (fabs(win->p[j].x - src->p[i].x) < RJ_SIDE_EPSILON
+             && fabs(win->p[j].y - src->p[i].y) < RJ_SIDE_EPSILON)
+            {
+                continue;
+            }
+
+            RJ_PlaneThrough(&plane, src->p[i].x, src->p[i].y,
+                            win->p[j].x, win->p[j].y);
+            RJ_PolyRange(src, &plane, &slo, &shi);
+            RJ_PolyRange(win, &plane, &wlo, &whi);
+
+            if (slo > -RJ_SIDE_EPSILON && shi < RJ_SIDE_EPSILON
+             && wlo > -RJ_SIDE_EPSILON && whi < RJ_SIDE_EPSILON)
+            {
+                continue;       // all along the line; tells us nothing
+            }
+
+            if (shi < RJ_SIDE_EPSILON && wlo > -RJ_SIDE_EPSILON)
+            {
+                // already keeps the window's side
+            }
+            else if (slo > -RJ_SIDE_EPSILON && whi < RJ_SIDE_EPSILON)
+            {
+                RJ_FlipPlane(&plane);
+            }
+            else
+            {
+                continue;
+            }
+
+            if (frame->num_separators < RJ_MAXSEPARATORS)
+            {
+                frame->separators[frame->num_separators++] = plane;
+            }
+        }
+    }
+}
+
+//
+// Checking that the map is laid out cleanly
+//
+
+static int64_t RJ_Orient(int ax, int ay, int bx, int by, int cx, int cy)
+{
+    return (int64_t) (bx - ax) * (cy - ay) - (int64_t) (by - ay) * (cx - ax);
+}
+
+static boolean RJ_OnSegment(int ax, int ay, int bx, int by, int cx, int cy)
+{
+    return MIN(ax, bx) <= cx && cx <= MAX(ax, bx)
+        && MIN(ay, by) <= cy && cy <= MAX(ay, by);
+}
+
+static int RJ_Sign(int64_t v)
+{
+    return (v > 0) - (v < 0);
+}
+
+// Returns true if the two lines touch anywhere except at a shared end.
+
+static boolean RJ_LinesClash(const rjline_t *a, const rjline_t *b)
+{
+    int64_t o1, o2, o3, o4;
+    boolean a1b1 = a->x1 == b->x1 && a->y1 == b->y1;
+    boolean a1b2 = a->x1 == b->x2 && a->y1 == b->y2;
+    boolean a2b1 = a->x2 == b->x1 && a->y2 == b->y1;
+    boolean a2b2 = a->x2 == b->x2 && a->y2 == b->y2;
+
+    if ((a1b1 && a2b2) || (a1b2 && a2b1))
+    {
+        return true;
+    }
+
+    if (a1b1 || a1b2 || a2b1 || a2b2)
+    {
+        boolean a1 = a1b1 || a1b2, b1 = a1b1 || a2b1;
+        int sx = a1 ? a->x1 : a->x2, sy = a1 ? a->y1 : a->y2;
+        int ax = a1 ? a->x2 : a->x1, ay = a1 ? a->y2 : a->y1;
+        int bx = b1 ? b->x2 : b->x1, by = b1 ? b->y2 : b->y1;
+
+        // Sharing an end is only a problem if they run along each other.
+
+        return RJ_Orient(sx, sy, ax, ay, bx, by) == 0
+            && (int64_t) (ax - sx) * (bx - sx)
+             + (int64_t) (ay - sy) * (by - sy) > 0;
+    }
+
+    o1 = RJ_Orient(a->x1, a->y1, a->x2, a->y2, b->x1, b->y1);
+    o2 = RJ_Orient(a->x1, a->y1, a->x2, a->y2, b->x2, b->y2);
+    o3 = RJ_Orient(b->x1, b->y1, b->x2, b->y2, a->x1, a->y1);
+    o4 = RJ_Orient(b->x1, b->y1, b->x2, b->y2, a->x2, a->y2);
+
+    if (RJ_Sign(o1) * RJ_Sign(o2) < 0 && RJ_Sign(o3) * RJ_Sign(o4) < 0)
+    {
+        return true;
+    }
+
+    return (o1 == 0 && RJ_OnSegment(a->x1, a->y1, a->x2, a->y2, b->x1, b->y1))
+        || (o2 == 0 && RJ_OnSegment(a->x1, a->y1, a->x2, a->y2, b->x2, b->y2))
+        || (o3 == 0 && RJ_OnSegment(b->x1, b->y1, b->x2, b->y2, a->x1, a->y1))
+        || (o4 == 0 && RJ_OnSegment(b->x1, b->y1, b->x2, b->y2, a->x2, a->y2));
+}
+
+// Counts line i in each grid cell it passes near, or with lists set,
+// files it in them; counts then holds where each cell's list is filled
+// down from.
+
+static void RJ_FileLine(const rjline_t *l, int i, int minx, int miny,
+                        int width, int *counts, int *lists)
+{
+    int x1 = l->x1 - minx, y1 = l->y1 - miny;
+    int x2 = l->x2 - minx, y2 = l->y2 - miny;
+    int cx;
+
+    if (x1 > x2)
+    {
+        int t;
+        t = x1; x1 = x2; x2 = t;
+        t = y1; y1 = y2; y2 = t;
+    }
+
+    for (cx = x1 >> RJ_CELLSHIFT; cx <= x2 >> RJ_CELLSHIFT; cx++)
+    {
+        // Span of the line across this column of cells, a cell wider
+        // than it needs to be.
+
+        int lo = MAX(x1, cx << RJ_CELLSHIFT);
+        int hi = MIN(x2, (cx + 1) << RJ_CELLSHIFT);
+        int ya = y1, yb = y2;
+        int cy;
+
+        if (x1 != x2)
+        {
+            ya = y1 + (int) ((int64_t) (y2 - y1) * (lo - x1) / (x2 - x1));
+            yb = y1 + (int) ((int64_t) (y2 - y1) * (hi - x1) / (x2 - x1));
+        }
+
+        for (cy = MAX(MIN(ya, yb) - 1, 0) >> RJ_CELLSHIFT;
+             cy <= (MAX(ya, yb) + 1) >> RJ_CELLSHIFT; cy++)
+        {
+            int cell = cy * width + cx;
+
+            if (lists != NULL)
+            {
+                lists[--counts[cell]] = i;
+            }
+            else
+            {
+                counts[cell]++;
+            }
+        }
+    }
+}
+
+static boolean RJ_CheckPlanar(job_t *job, rjbuild_t *build)
+{
+    const rjline_t *lines = build->lines;
+    int minx = INT_MAX, miny = INT_MAX, maxx = INT_MIN, maxy = INT_MIN;
+    int width, cells, i, j, k;
+    int *counts, *starts, *lists;
+    boolean clash = false;
+
+    for (i = 0; i < build->numlines; i++)
+    {
+        minx = MIN(minx, MIN(lines[i].x1, lines[i].x2));
+        miny = MIN(miny, MIN(lines[i].y1, lines[i].y2));
+        maxx = MAX(maxx, MAX(lines[i].x1, lines[i].x2));
+        maxy = MAX(maxy, MAX(lines[i].y1, lines[i].y2));
+    }
+
+    width = ((maxx - minx) >> RJ_CELLSHIFT) + 2;
+    cells = width * (((maxy - miny + 1) >> RJ_CELLSHIFT) + 2);
+
+    // Count, then fill, the list of lines near each cell.
+
+    counts = calloc(cells, sizeof(*counts));
+    starts = malloc((cells + 1) * sizeof(*starts));
+
+    for (i = 0; i < build->numlines; i++)
+    {
+        RJ_FileLine(&lines[i], i, minx, miny, width, counts, NULL);
+    }
+
+    for (i = 0, k = 0; i < cells; i++)
+    {
+        starts[i] = k;
+        k += counts[i];
+        counts[i] = k;
+    }
+    starts[cells] = k;
+
+    lists = malloc(MAX(k, 1) * sizeof(*lists));
+
+    for (i = 0; i < build->numlines; i++)
+    {
+        RJ_FileLine(&lines[i], i, minx, miny, width, counts, lists);
+    }
+
+    for (i = 0; i < cells && !clash; i++)
+    {
+        if ((i & 1023) == 0 && I_JobCancelled(job))
+        {
+            clash = true;
+        }
+
+        for (j = starts[i]; j < starts[i + 1] && !clash; j++)
+        {
+            for (k = j + 1; k < starts[i + 1] && !clash; k++)
+            {
+                clash = RJ_LinesClash(&lines[lists[j]], &lines[lists[k]]);
+            }
+        }
+    }
+
+    free(lists);
+    free(starts);
+    free(counts);
+
+    return !clash;
+}
+
+static int RJ_CompareVertex(const void *a, const void *b)
+{
+    const int *va = a, *vb = b;
+
+    if (va[0] != vb[0])
+    {
+        return va[0] < vb[0] ? -1 : 1;
+    }
+    if (va[1] != vb[1])
+    {
+        return va[1] < vb[1] ? -1 : 1;
+    }
+    return 0;
+}
+
+static const double *rj_sort_angle;
+static const int *rj_sort_vertex;
+
+static int RJ_CompareHalfEdge(const void *a, const void *b)
+{
+    int ha = *(const int *) a, hb = *(const int *) b;
+
+    if (rj_sort_vertex[ha] != rj_sort_vertex[hb])
+    {
+        return rj_sort_vertex[ha] < rj_sort_vertex[hb] ? -1 : 1;
+    }
+    if (rj_sort_angle[ha] != rj_sort_angle[hb])
+    {
+        return rj_sort_angle[ha] < rj_sort_angle[hb] ? -1 : 1;
+    }
+    return 0;
+}
+
+static void RJ_BuildGraph(rjbuild_t *build, rjgraph_t *graph)
+{
+    int numhalf = build->numlines * 2;
+    int *ends = malloc(numhalf * 3 * sizeof(*ends));
+    int i, n;
+
+    // Number the distinct line ends.
+
+    for (i = 0; i < numhalf; i++)
+    {
+        const rjline_t *l = &build->lines[i / 2];
+
+        ends[i * 3] = i & 1 ? l->x2 : l->x1;
+        ends[i * 3 + 1] = i & 1 ? l->y2 : l->y1;
+        ends[i * 3 + 2] = i;
+    }
+
+    qsort(ends, numhalf, 3 * sizeof(*ends), RJ_CompareVertex);
+
+    graph->vertex = malloc(numhalf * sizeof(*graph->vertex));
+    graph->vx = malloc(numhalf * sizeof(*graph->vx));
+    graph->vy = malloc(numhalf * sizeof(*graph->vy));
+
+    for (i = 0, n = -1; i < numhalf; i++)
+    {
+        if (n < 0 || RJ_CompareVertex(&ends[i * 3], &ends[(i - 1) * 3]))
+        {
+            n++;
+            graph->vx[n] = ends[i * 3];
+            graph->vy[n] = ends[i * 3 + 1];
+        }
+
+        // Half-edge 2 * i starts at v1, and 2 * i + 1 at v2; ends were
+        // numbered the same way.
+
+        graph->vertex[ends[i * 3 + 2]] = n;
+    }
+
+    graph->numvertexes = n + 1;
+    free(ends);
+
+    // Sort the half-edges leaving each vertex anticlockwise.
+
+    graph->angle = malloc(numhalf * sizeof(*graph->angle));
+    graph->order = malloc(numhalf * sizeof(*graph->order));
+    graph->pos = malloc(numhalf * sizeof(*graph->pos));
+    graph->first = malloc((graph->numvertexes + 1) * sizeof(*graph->first));
+
+    for (i = 0; i < numhalf; i++)
+    {
+        int from = graph->vertex[i], to = graph->vertex[i ^ 1];
+
+        graph->angle[i] = atan2(graph->vy[to] - graph->vy[from],
+                                graph->vx[to] - graph->vx[from]);
+        graph->order[i] = i;
+    }
+
+    rj_sort_angle = graph->angle;
+    rj_sort_vertex = graph->vertex;
+    qsort(graph->order, numhalf, sizeof(*graph->order), RJ_CompareHalfEdge);
+
+    for (i = 0, n = 0; i < numhalf; i++)
+    {
+        graph->pos[graph->order[i]] = i;
+
+        while (n <= graph->vertex[graph->order[i]])
+        {
+            graph->first[n++] = i;
+        }
+    }
+    while (n <= graph->numvertexes)
+    {
+        graph->first[n++] = numhalf;
+    }
+}
+
+static void RJ_FreeGraph(rjgraph_t *graph)
+{
+    free(graph->vertex);
+    free(graph->vx);
+    free(graph->vy);
+    free(graph->angle);
+    free(graph->order);
+    free(graph->pos);
+    free(graph->first);
+}
+
+// The next half-edge round the same side: the first one anticlockwise
+// from the way back.
+
+static int RJ_NextHalfEdge(const rjgraph_t *graph, int h)
+{
+    int twin = h ^ 1;
+    int v = graph->vertex[twin];
+    int first = graph->first[v], count = graph->first[v + 1] - first;
+
+    return graph->order[first + (graph->pos[twin] - first + 1) % count];
+}
+
+static int RJ_Side(const rjbuild_t *build, int h)
+{
+    const rjline_t *l = &build->lines[h / 2];
+
+    if (h & 1)
+    {
+        return l->back < 0 ? build->numsectors : l->back;
+    }
+
+    return l->front;
+}
+
+// Looks out from a hole in a face (an island of lines, or the outside of
+// the whole map), starting next to vertex v between half-edges in and
+// out. Returns the side of the first line seen, numsectors for the void
+// around the map, or -1 if the answer isn't clear cut.
+
+static int RJ_LookOutAt(const rjbuild_t *build, const rjgraph_t *graph,
+                        int v, double angle)
+{
+    double dx, dy, ox, oy, best = -1;
+    int i, side = build->numsectors;
+
+    // Everything here is relative to v, to keep the precision.
+
+    dx = cos(angle);
+    dy = sin(angle);
+    ox = dx * 1e-6;
+    oy = dy * 1e-6;
+
+    for (i = 0; i < build->numlines; i++)
+    {
+        const rjline_t *l = &build->lines[i];
+        double ax = l->x1 - graph->vx[v], ay = l->y1 - graph->vy[v];
+        double bx = l->x2 - graph->vx[v], by = l->y2 - graph->vy[v];
+        double ex = bx - ax, ey = by - ay;
+        double denom = dx * ey - dy * ex;
+        double t, u;
+
+        if (fabs(denom) < 1e-12)
+        {
+            continue;
+        }
+
+        // Distance along the ray, and how far along the line.
+
+        t = ((ax - ox) * ey - (ay - oy) * ex) / denom;
+        u = ((ax - ox) * dy - (ay - oy) * dx) / denom;
+
+        if (t <= 0 || u < 0 || u > 1 || (best >= 0 && t >= best))
+        {
+            continue;
+        }
+
+        if (u < 1e-9 || u > 1 - 1e-9)
+        {
+            return -1;          // straight through a vertex
+        }
+
+        best = t;
+        side = RJ_Side(build, 2 * i + ((ex * (oy - ay) - ey * (ox - ax)) > 0));
+    }
+
+    return side;
+}
+
+// Maps on a grid have vertexes lined up with each other, so if a ray
+// runs straight through one, try another angle within the gap.
+
+static const double rj_lookout_tries[] = { 0.5, 0.382, 0.618, 0.236, 0.764 };
+
+static int RJ_LookOut(const rjbuild_t *build, const rjgraph_t *graph,
+                      int v, int in, int out)
+{
+    double a0 = graph->angle[in ^ 1], a1 = graph->angle[out];
+    double gap = a1 - a0;
+    int i, side = -1;
+
+    while (gap <= 1e-9)
+    {
+        gap += 2 * M_PI;
+    }
+    if (gap < 1e-6)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < (int) arrlen(rj_lookout_tries) && side < 0; i++)
+    {
+        side = RJ_LookOutAt(build, graph, v, a0 + gap * rj_lookout_tries[i]);
+    }
+
+    return side;
+}
+
+// Every face of the layout must have the same sector on all of the sides
+// around it, including the sides of any islands inside it.
+
+static boolean RJ_CheckFaces(job_t *job, rjbuild_t *build,
+                             const rjgraph_t *graph)
+{
+    int numhalf = build->numlines * 2;
+    byte *done = calloc(numhalf, 1);
+    boolean result = true;
+    int h;
+
+    for (h = 0; h < numhalf && result; h++)
+    {
+        int64_t area = 0;
+        int side = RJ_Side(build, h);
+        int e, prev, left = -1, left_in = -1;
+
+        if (done[h])
+        {
+            continue;
+        }
+
+        if (I_JobCancelled(job))
+        {
+            result = false;
+            break;
+        }
+
+        prev = -1;
+        e = h;
+
+        do
+        {
+            int v = graph->vertex[e], w = graph->vertex[e ^ 1];
+
+            done[e] = 1;
+
+            if (RJ_Side(build, e) != side)
+            {
+                result = false;
+                break;
+            }
+
+            area += (int64_t) graph->vx[v] * graph->vy[w]
+                  - (int64_t) graph->vx[w] * graph->vy[v];
+
+            if (left < 0 || graph->vx[v] < graph->vx[graph->vertex[left]]
+             || (graph->vx[v] == graph->vx[graph->vertex[left]]
+              && graph->vy[v] < graph->vy[graph->vertex[left]]))
+            {
+                left = e;
+                left_in = prev;
+            }
+
+            prev = e;
+            e = RJ_NextHalfEdge(graph, e);
+        } while (e != h);
+
+        if (!result)
+        {
+            break;
+        }
+
+        if (left_in < 0)
+        {
+            left_in = prev;
+        }
+
+        // Going round with the side on the right, a clockwise cycle is
+        // the outline of a face. Anything else is an island within a
+        // face, and has to agree with whatever the face is.
+
+        if (area >= 0)
+        {
+            result = RJ_LookOut(build, graph, graph->vertex[left],
+                                left_in, left) == side;
+        }
+    }
+
+    free(done);
+
+    return result;
+}
+
+//
+// Following sight through the portals
+//
+
+static void RJ_SegmentPoly(rjpoly_t *poly, double x1, double y1,
+                           double x2, double y2)
+{
+    double dx = x2 - x1, dy = y2 - y1;
+    double len = sqrt(dx * dx + dy * dy);
+
+    dx = dx / len * RJ_EPSILON;
+    dy = dy / len * RJ_EPSILON;
+
+    poly->n = 2;
+    poly->p[0].x = x1 - dx;
+    poly->p[0].y = y1 - dy;
+    poly->p[1].x = x2 + dx;
+    poly->p[1].y = y2 + dy;
+}
+
+static void RJ_PointPoly(rjpoly_t *poly, double x, double y)
+{
+    poly->n = 4;
+    poly->p[0].x = x - RJ_EPSILON;
+    poly->p[0].y = y - RJ_EPSILON;
+    poly->p[1].x = x + RJ_EPSILON;
+    poly->p[1].y = y - RJ_EPSILON;
+    poly->p[2].x = x + RJ_EPSILON;
+    poly->p[2].y = y + RJ_EPSILON;
+    poly->p[3].x = x - RJ_EPSILON;
+    poly->p[3].y = y + RJ_EPSILON;
+}
+
+// Builds the portals out of each sector: one per two-sided line between
+// different sectors, each way, and one for each pair of sectors that
+// meet at a vertex.
+
+static rjportal_t *RJ_BuildPortals(rjbuild_t *build, const rjgraph_t *graph,
+                                   int **first)
+{
+    int numsectors = build->numsectors;
+    int *count = calloc(numsectors + 1, sizeof(*count));
+    int *around = malloc(sizeof(*around) * build->numlines * 4);
+    rjportal_t *portals;
+    int pass, i, j, k, total;
+
+    *first = count;
+    portals = NULL;
+
+    // Count the portals, then fill them in.
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        for (i = 0; i < build->numlines; i++)
+        {
+            const rjline_t *l = &build->lines[i];
+
+            if (l->back < 0 || l->back == l->front)
+            {
+                continue;
+            }
+
+            for (j = 0; j < 2; j++)
+            {
+                int from = j ? l->back : l->front;
+                int to = j ? l->front : l->back;
+
+                if (pass == 0)
+                {
+                    count[from]++;
+                }
+                else
+                {
+                    rjportal_t *p = &portals[--count[from]];
+
+                    p->id = i;
+                    p->to = to;
+                    p->line = true;
+                    RJ_SegmentPoly(&p->poly, l->x1, l->y1, l->x2, l->y2);
+
+                    // The back of a line is on its left.
+
+                    RJ_PlaneThrough(&p->forward, l->x1, l->y1, l->x2, l->y2);
+                    if (j)
+                    {
+                        RJ_FlipPlane(&p->forward);
+                    }
+                }
+            }
+        }
+
+        for (i = 0; i < graph->numvertexes; i++)
+        {
+            int n = 0;
+
+            for (j = graph->first[i]; j < graph->first[i + 1]; j++)
+            {
+                int h = graph->order[j];
+                int sides[2];
+
+                sides[0] = RJ_Side(build, h);
+                sides[1] = RJ_Side(build, h ^ 1);
+
+                for (k = 0; k < 2; k++)
+                {
+                    int m;
+
+                    for (m = 0; m < n && around[m] != sides[k]; m++);
+
+                    if (m == n && sides[k] < numsectors)
+                    {
+                        around[n++] = sides[k];
+                    }
+                }
+            }
+
+            for (j = 0; j < n; j++)
+            {
+                for (k = 0; k < n; k++)
+                {
+                    if (j == k)
+                    {
+                        continue;
+                    }
+
+                    if (pass == 0)
+                    {
+                        count[around[j]]++;
+                    }
+                    else
+                    {
+                        rjportal_t *p = &portals[--count[around[j]]];
+
+                        p->id = build->numlines + i;
+                        p->to = around[k];
+                        p->line = false;
+                        RJ_PointPoly(&p->poly, graph->vx[i], graph->vy[i]);
+                    }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            for (i = 0, total = 0; i <= numsectors; i++)
+            {
+                total += count[i];
+                count[i] = total;
+            }
+
+            portals = malloc(MAX(total, 1) * sizeof(*portals));
+        }
+    }
+
+    // count[] was filled down to the start of each sector's portals.
+
+    free(around);
+
+    return portals;
+}
+
+// Marks in seen every sector that sight from sector s can get to.
+// Returns false if it gave up, in which case nothing is known.
+
+static boolean RJ_FloodSector(job_t *job, int s, const rjportal_t *portals,
+                              const int *first, rjframe_t *stack,
+                              byte *used, byte *seen)
+{
+    int budget = RJ_SECTOR_BUDGET;
+    int i;
+
+    seen[s] = 1;
+
+    for (i = first[s]; i < first[s + 1]; i++)
+    {
+        const rjportal_t *start = &portals[i];
+        int depth = 0;
+
+        seen[start->to] = 1;
+
+        stack[0].source = start->poly;
+        stack[0].window = start->poly;
+        stack[0].has_forward = start->line;
+        stack[0].forward = start->forward;
+        stack[0].num_separators = 0;
+        stack[0].sector = start->to;
+        stack[0].via = start->id;
+        stack[0].next_portal = first[start->to];
+        used[start->id] = 1;
+
+        while (depth >= 0)
+        {
+            rjframe_t *frame = &stack[depth];
+            rjframe_t *next;
+            const rjportal_t *p;
+            rjpoly_t target, source;
+            int j;
+
+            if (frame->next_portal >= first[frame->sector + 1])
+            {
+                used[frame->via] = 0;
+                depth--;
+                continue;
+            }
+
+            p = &portals[frame->next_portal++];
+
+            if (used[p->id])
+            {
+                continue;
+            }
+
+            if (--budget < 0 || depth + 1 >= RJ_MAXDEPTH
+             || ((budget & 4095) == 0 && I_JobCancelled(job)))
+            {
+                while (depth >= 0)
+                {
+                    used[stack[depth--].via] = 0;
+                }
+                return false;
+            }
+
+            // What of the next portal lines up with the way through.
+
+            target = p->poly;
+
+            if (frame->has_forward && !RJ_ClipPoly(&target, &frame->forward))
+            {
+                continue;
+            }
+
+            for (j = 0; j < frame->num_separators; j++)
+            {
+                if (!RJ_ClipPoly(&target, &frame->separators[j]))
+                {
+                    break;
+                }
+            }
+            if (j < frame->num_separators)
+            {
+                continue;
+            }
+
+            // Sight through it must have come from behind it.
+
+            source = frame->source;
+
+            if (p->line)
+            {
+                rjplane_t behind = p->forward;
+
+                RJ_FlipPlane(&behind);
+
+                if (!RJ_ClipPoly(&source, &behind))
+                {
+                    continue;
+                }
+            }
+
+            seen[p->to] = 1;
+
+            next = &stack[++depth];
+            next->source = source;
+            next->window = target;
+            next->has_forward = p->line;
+            next->forward = p->forward;
+            next->sector = p->to;
+            next->via = p->id;
+            next->next_portal = first[p->to];
+            RJ_FindSeparators(next);
+            used[p->id] = 1;
+        }
+    }
+
+    return true;
+}
+
+static void RJ_Build(job_t *job, void *data)
+{
+    rjbuild_t *build = data;
+    int numsectors = build->numsectors;
+    rjgraph_t graph;
+    rjportal_t *portals;
+    rjframe_t *stack;
+    int *first;
+    byte *used, *seen, *visible, *reject;
+    size_t size = ((size_t) numsectors * numsectors + 7) / 8;
+    int s, t;
+
+    if (!RJ_CheckPlanar(job, build))
+    {
+        build->failure = "linedefs cross or overlap";
+        return;
+    }
+
+    RJ_BuildGraph(build, &graph);
+
+    if (!RJ_CheckFaces(job, build, &graph))
+    {
+        RJ_FreeGraph(&graph);
+        build->failure = "sectors are not cleanly enclosed";
+        return;
+    }
+
+    portals = RJ_BuildPortals(build, &graph, &first);
+    stack = malloc(RJ_MAXDEPTH * sizeof(*stack));
+    used = calloc(build->numlines + graph.numvertexes, 1);
+    seen = malloc(numsectors);
+    visible = calloc(size, 1);
+
+    for (s = 0; s < numsectors; s++)
+    {
+        memset(seen, 0, numsectors);
+
+        if (!RJ_FloodSector(job, s, portals, first, stack, used, seen))
+        {
+            memset(seen, 1, numsectors);
+        }
+
+        if (I_JobCancelled(job))
+        {
+            break;
+        }
+
+        for (t = 0; t < numsectors; t++)
+        {
+            if (seen[t])
+            {
+                size_t bit = (size_t) s * numsectors + t;
+
+                visible[bit >> 3] |= 1 << (bit & 7);
+            }
+        }
+    }
+
+    // Sight works both ways, so a pair that either side's flood ruled
+    // out can be rejected.
+
+    if (s == numsectors)
+    {
+        reject = calloc(size, 1);
+
+        for (s = 0; s < numsectors; s++)
+        {
+            for (t = 0; t < numsectors; t++)
+            {
+                size_t st = (size_t) s * numsectors + t;
+                size_t ts = (size_t) t * numsectors + s;
+
+                if (!(visible[st >> 3] & (1 << (st & 7)))
+                 || !(visible[ts >> 3] & (1 << (ts & 7))))
+                {
+                    reject[st >> 3] |= 1 << (st & 7);
+                    build->rejected++;
+                }
+            }
+        }
+
+        build->reject = reject;
+    }
+
+    free(visible);
+    free(seen);
+    free(used);
+    free(stack);
+    free(first);
+    free(portals);
+    RJ_FreeGraph(&graph);
+}
+
+static void RJ_FreeBuild(rjbuild_t *build)
+{
+    free(build->lines);
+    free(build->reject);
+    free(build);
+}
+
+//
+// P_StartRejectBuilder
+// Called once the level's REJECT is loaded.
+//
+
+void P_StartRejectBuilder(void)
+{
+    rjbuild_t *build;
+    int i, size;
+
+    P_StopRejectBuilder();
+
+    //!
+    // @category mod
+    //
+    // Build a REJECT table in the background for maps whose REJECT
+    // lump is empty, so that monsters can skip sight checks that
+    // could never succeed.
+    //
+
+    if (!M_ParmExists("-buildreject"))
+    {
+        return;
+    }
+
+    // Sight checks in these have side effects, and netgames and demos
+    // must not depend on when the table lands.
+
+    if (netgame || demoplayback || demorecording
+     || gameversion <= exe_doom_1_2 || numsectors > RJ_MAXSECTORS)
+    {
+        return;
+    }
+
+    size = (numsectors * numsectors + 7) / 8;
+
+    for (i = 0; i < size; i++)
+    {
+        if (rejectmatrix[i] != 0)
+        {
+            return;
+        }
+    }
+
+    build = calloc(1, sizeof(*build));
+    build->numsectors = numsectors;
+    build->lines = malloc(numlines * sizeof(*build->lines));
+
+    for (i = 0; i < numlines; i++)
+    {
+        const line_t *ld = &lines[i];
+        rjline_t *l = &build->lines[build->numlines];
+
+        if (ld->frontsector == NULL
+         || ((ld->v1->x | ld->v1->y | ld->v2->x | ld->v2->y)
+             & (FRACUNIT - 1)) != 0)
+        {
+            RJ_FreeBuild(build);
+            return;
+        }
+
+        l->x1 = ld->v1->x >> FRACBITS;
+        l->y1 = ld->v1->y >> FRACBITS;
+        l->x2 = ld->v2->x >> FRACBITS;
+        l->y2 = ld->v2->y >> FRACBITS;
+        l->front = ld->frontsector - sectors;
+        l->back = ld->backsector != NULL ? ld->backsector - sectors : -1;
+
+        // Lines with no length neither block nor let anything through.
+
+        if (l->x1 != l->x2 || l->y1 != l->y2)
+        {
+            build->numlines++;
+        }
+    }
+
+    if (build->numlines == 0)
+    {
+        RJ_FreeBuild(build);
+        return;
+    }
+
+    reject_job = I_StartJob("REJECT builder", RJ_Build, build);
+
+    if (reject_job == NULL)
+    {
+        RJ_FreeBuild(build);
+        return;
+    }
+
+    reject_build = build;
+}
+
+//
+// P_StopRejectBuilder
+// Drops a build that is still running, before the level goes away.
+//
+
+void P_StopRejectBuilder(void)
+{
+    if (reject_job != NULL)
+    {
+        I_CancelJob(reject_job);
+        RJ_FreeBuild(reject_build);
+        reject_job = NULL;
+        reject_build = NULL;
+    }
+}
+
+//
+// P_UpdateReject
+// Called every tic; swaps the new table in once it is ready.
+//
+
+void P_UpdateReject(void)
+{
+    rjbuild_t *build = reject_build;
+    int size;
+
+    if (reject_job == NULL || !I_JobFinished(reject_job))
+    {
+        return;
+    }
+
+    I_FinishJob(reject_job);
+    reject_job = NULL;
+    reject_build = NULL;
+
+    if (build->reject != NULL)
+    {
+        size = (numsectors * numsectors + 7) / 8;
+        rejectmatrix = Z_Malloc(size, PU_LEVEL, NULL);
+        memcpy(rejectmatrix, build->reject, size);
+
+        fprintf(stderr, "P_UpdateReject: Built REJECT, %d of %d sector "
+                        "pairs rejected\n",
+                build->rejected, numsectors * numsectors);
+    }
+    else if (build->failure != NULL)
+    {
+        fprintf(stderr, "P_UpdateReject: Not building REJECT, %s\n",
+                build->failure);
+    }
+
+    RJ_FreeBuild(build);
+}
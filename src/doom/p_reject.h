@@ -0,0 +1,35 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Background REJECT builder, for maps shipped with an empty REJECT.
+//
+
+
+#ifndef __P_REJECT__
+#define __P_REJECT__
+
+// Start building a REJECT for the level just loaded, if -buildreject
+// was given and the level's own REJECT is empty.
+
+void P_StartRejectBuilder(void);
+
+// Abandon a build still in progress.
+
+void P_StopRejectBuilder(void);
+
+// Swap the built REJECT in, once it is ready.
+
+void P_UpdateReject(void);
+
+#endif
@@ -35,11 +35,249 @@
 
 #include "apdoom.h"
 
-FILE *save_stream;
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+MEMFILE *save_stream;
 int savegamelength;
 boolean savegame_error;
 static int restoretargets_fail;
 
+// [AP] Players bounce between levels all the time, each with its own save
+// file. Keep the most recent ones in memory so re-entering a level doesn't
+// read the file again.
+
+#define SAVE_SNAPSHOT_COUNT 8
+
+typedef struct
+{
+    char *name;
+    byte *data;
+    size_t length;
+    unsigned int used; // save_snapshot_clock when last stored or loaded
+} save_snapshot_t;
+
+static save_snapshot_t save_snapshots[SAVE_SNAPSHOT_COUNT];
+static unsigned int save_snapshot_clock = 0;
+
+static save_snapshot_t *P_FindSaveSnapshot(const char *name)
+{
+    int i;
+
+    for (i = 0; i < SAVE_SNAPSHOT_COUNT; ++i)
+    {
+        if (save_snapshots[i].name != NULL
+         && !strcmp(save_snapshots[i].name, name))
+        {
+            return &save_snapshots[i];
+        }
+    }
+
+    return NULL;
+}
+
+void P_StoreSaveSnapshot(const char *name, const byte *data, size_t length)
+{
+    save_snapshot_t *snapshot = P_FindSaveSnapshot(name);
+    int i;
+
+    if (snapshot == NULL)
+    {
+        // Reuse the least recently used slot
+        snapshot = &save_snapshots[0];
+        for (i = 1; i < SAVE_SNAPSHOT_COUNT; ++i)
+        {
+            if (save_snapshots[i].used < snapshot->used)
+            {
+                snapshot = &save_snapshots[i];
+            }
+        }
+
+        free(snapshot->name);
+        snapshot->name = M_StringDuplicate(name);
+    }
+
+    free(snapshot->data);
+    snapshot->data = malloc(length);
+    memcpy(snapshot->data, data, length);
+    snapshot->length = length;
+    snapshot->used = ++save_snapshot_clock;
+}
+
+// [AP] Level saves can be written compressed: an 8 byte magic, the
+// unpacked length as a little endian 32 bit int, then a zlib stream.
+// Files without the magic are plain savegames and are read as is.
+
+#define SAVE_PACK_MAGIC "APZSAVE\x01"
+#define SAVE_PACK_MAGIC_LEN 8
+#define SAVE_PACK_HEADER_LEN (SAVE_PACK_MAGIC_LEN + 4)
+
+// Returns a malloc'd packed copy of the savegame, or NULL if it should be
+// written uncompressed.
+
+byte *P_PackSaveGame(const byte *data, size_t length, size_t *packed_length)
+{
+#ifdef HAVE_LIBZ
+    uLongf zlength = compressBound(length);
+    byte *packed = malloc(SAVE_PACK_HEADER_LEN + zlength);
+
+    if (compress2(packed + SAVE_PACK_HEADER_LEN, &zlength, data, length,
+                  Z_BEST_SPEED) != Z_OK)
+    {
+        free(packed);
+        return NULL;
+    }
+
+    memcpy(packed, SAVE_PACK_MAGIC, SAVE_PACK_MAGIC_LEN);
+    packed[SAVE_PACK_MAGIC_LEN + 0] = length & 0xff;
+    packed[SAVE_PACK_MAGIC_LEN + 1] = (length >> 8) & 0xff;
+    packed[SAVE_PACK_MAGIC_LEN + 2] = (length >> 16) & 0xff;
+    packed[SAVE_PACK_MAGIC_LEN + 3] = (length >> 24) & 0xff;
+
+    *packed_length = SAVE_PACK_HEADER_LEN + zlength;
+    return packed;
+#else
+    return NULL;
+#endif
+}
+
+// Stores the file's savegame data as a snapshot, unpacking it if needed.
+
+static void P_StoreSaveFile(const char *name, const byte *data, size_t length)
+{
+    size_t unpacked_length;
+
+    if (length < SAVE_PACK_HEADER_LEN
+     || memcmp(data, SAVE_PACK_MAGIC, SAVE_PACK_MAGIC_LEN))
+    {
+        P_StoreSaveSnapshot(name, data, length);
+        return;
+    }
+
+    unpacked_length = data[SAVE_PACK_MAGIC_LEN + 0]
+                   | (data[SAVE_PACK_MAGIC_LEN + 1] << 8)
+                   | (data[SAVE_PACK_MAGIC_LEN + 2] << 16)
+                   | ((size_t) data[SAVE_PACK_MAGIC_LEN + 3] << 24);
+
+#ifdef HAVE_LIBZ
+    {
+        byte *unpacked = malloc(unpacked_length);
+        uLongf zlength = unpacked_length;
+
+        if (uncompress(unpacked, &zlength, data + SAVE_PACK_HEADER_LEN,
+                       length - SAVE_PACK_HEADER_LEN) != Z_OK
+         || zlength != unpacked_length)
+        {
+            I_Error("Corrupt compressed savegame %s", name);
+        }
+
+        P_StoreSaveSnapshot(name, unpacked, unpacked_length);
+        free(unpacked);
+    }
+#else
+    I_Error("Savegame %s is compressed, but this build has no zlib", name);
+#endif
+}
+
+// Returns the save's bytes, reading the file if it isn't in memory yet.
+// NULL if there is no such save. The buffer stays valid until the next
+// P_StoreSaveSnapshot.
+
+const byte *P_LoadSaveSnapshot(const char *name, size_t *length)
+{
+    save_snapshot_t *snapshot = P_FindSaveSnapshot(name);
+
+    if (snapshot == NULL)
+    {
+        byte *data;
+        int file_length;
+
+        if (!M_FileExists(name))
+        {
+            return NULL;
+        }
+
+        file_length = M_ReadFile(name, &data);
+        P_StoreSaveFile(name, data, file_length);
+        Z_Free(data);
+
+        snapshot = P_FindSaveSnapshot(name);
+    }
+
+    snapshot->used = ++save_snapshot_clock;
+    *length = snapshot->length;
+    return snapshot->data;
+}
+
+// [AP] Copies the description at the head of a save, packed or not,
+// without reading the rest of it. False if there is no such save.
+
+boolean P_ReadSaveDescription(const char *name, char *description)
+{
+    save_snapshot_t *snapshot = P_FindSaveSnapshot(name);
+    byte head[1024]; // Enough for a zlib stream to get past the description
+    size_t length;
+    FILE *handle;
+
+    if (snapshot != NULL)
+    {
+        if (snapshot->length < SAVESTRINGSIZE)
+        {
+            return false;
+        }
+
+        memcpy(description, snapshot->data, SAVESTRINGSIZE);
+        return true;
+    }
+
+    handle = M_fopen(name, "rb");
+    if (handle == NULL)
+    {
+        return false;
+    }
+
+    length = fread(head, 1, sizeof(head), handle);
+    fclose(handle);
+
+    if (length < SAVE_PACK_HEADER_LEN
+     || memcmp(head, SAVE_PACK_MAGIC, SAVE_PACK_MAGIC_LEN))
+    {
+        if (length < SAVESTRINGSIZE)
+        {
+            return false;
+        }
+
+        memcpy(description, head, SAVESTRINGSIZE);
+        return true;
+    }
+
+#ifdef HAVE_LIBZ
+    {
+        z_stream stream;
+        boolean result;
+
+        memset(&stream, 0, sizeof(stream));
+        if (inflateInit(&stream) != Z_OK)
+        {
+            return false;
+        }
+
+        stream.next_in = head + SAVE_PACK_HEADER_LEN;
+        stream.avail_in = length - SAVE_PACK_HEADER_LEN;
+        stream.next_out = (Bytef *) description;
+        stream.avail_out = SAVESTRINGSIZE;
+        inflate(&stream, Z_SYNC_FLUSH);
+        result = stream.avail_out == 0;
+        inflateEnd(&stream);
+
+        return result;
+    }
+#else
+    return false;
+#endif
+}
+
 // Get the filename of a temporary file to write the savegame to.  After
 // the file has been successfully saved, it will be renamed to the 
 // real file.
@@ -85,7 +323,7 @@ static byte saveg_read8(void)
 {
     byte result = -1;
 
-    if (fread(&result, 1, 1, save_stream) < 1)
+    if (mem_fread(&result, 1, 1, save_stream) < 1)
     {
         if (!savegame_error)
         {
@@ -101,7 +339,7 @@ static byte saveg_read8(void)
 
 static void saveg_write8(byte value)
 {
-    if (fwrite(&value, 1, 1, save_stream) < 1)
+    if (mem_fwrite(&value, 1, 1, save_stream) < 1)
     {
         if (!savegame_error)
         {
@@ -156,7 +394,7 @@ static void saveg_read_pad(void)
     int padding;
     int i;
 
-    pos = ftell(save_stream);
+    pos = mem_ftell(save_stream);
 
     padding = (4 - (pos & 3)) & 3;
 
@@ -172,7 +410,7 @@ static void saveg_write_pad(void)
     int padding;
     int i;
 
-    pos = ftell(save_stream);
+    pos = mem_ftell(save_stream);
 
     padding = (4 - (pos & 3)) & 3;
 
@@ -340,6 +578,9 @@ static void saveg_read_mobj_t(mobj_t *str)
     // struct mobj_s* bprev;
     str->bprev = saveg_readp();
 
+    // [AP] not saved, set up again by P_SetThingPosition()
+    str->blockcell = NULL;
+
     // struct subsector_s* subsector;
     str->subsector = saveg_readp();
 
@@ -1631,6 +1872,10 @@ void P_UnArchiveWorld (void)
 	short floorpic, ceilingpic;
 	sec->floorheight = saveg_read16() << FRACBITS;
 	sec->ceilingheight = saveg_read16() << FRACBITS;
+	// [AP] not on the moving sector list, so reset interpolation here
+	sec->interpfloorheight = sec->floorheight;
+	sec->interpceilingheight = sec->ceilingheight;
+	sec->oldgametic = -1;
 	floorpic = saveg_read16();
 	ceilingpic = saveg_read16();
 	sec->lightlevel = saveg_read16();
@@ -1668,6 +1913,9 @@ void P_UnArchiveWorld (void)
 	    si->midtexture = saveg_read16();
 	}
     }
+
+    // [AP] the sector tags may have come back different
+    P_InitTagLists();
 }
 
 
@@ -1731,8 +1979,8 @@ void P_UnArchiveThinkers (void)
 	
 	if (currentthinker->function.acp1 == (actionf_p1)P_MobjThinker)
 	    P_RemoveMobj ((mobj_t *)currentthinker);
-	else
-	    Z_Free (currentthinker);
+
+	P_FreeThinker (currentthinker);
 
 	currentthinker = next;
     }
@@ -1749,7 +1997,7 @@ void P_UnArchiveThinkers (void)
 			
 	  case tc_mobj:
 	    saveg_read_pad();
-	    mobj = Z_Malloc (sizeof(*mobj), PU_LEVEL, NULL);
+	    mobj = P_AllocMobj ();
             saveg_read_mobj_t(mobj);
 
 	    // [crispy] restore mobj->target and mobj->tracer fields
@@ -1829,6 +2077,9 @@ void P_ArchiveSpecials (void)
 {
     thinker_t*		th;
     int			i;
+
+    // [AP] sleeping lights are matched by their function below
+    P_WakeAllThinkers ();
 	
     // save off the current thinkers
     for (th = thinkercap.next ; th != &thinkercap ; th=th->next)
@@ -22,6 +22,8 @@
 
 #include <stdio.h>
 
+#include "memio.h"
+
 #define SAVEGAME_EOF 0x1d
 #define VERSIONSIZE 16
 
@@ -59,7 +61,13 @@ void P_ArchiveSpecials (void);
 void P_UnArchiveSpecials (void);
 void P_RestoreTargets (void);
 
-extern FILE *save_stream;
+// [AP] Level saves kept in memory, most recent first out
+const byte *P_LoadSaveSnapshot(const char *name, size_t *length);
+void P_StoreSaveSnapshot(const char *name, const byte *data, size_t length);
+byte *P_PackSaveGame(const byte *data, size_t length, size_t *packed_length);
+boolean P_ReadSaveDescription(const char *name, char *description);
+
+extern MEMFILE *save_stream;
 extern boolean savegame_error;
 
 
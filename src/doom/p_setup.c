@@ -28,6 +28,7 @@
 #include "i_swap.h"
 #include "m_argv.h"
 #include "m_bbox.h"
+#include "m_memory.h" // [AP] M_TrimMemory()
 #include "m_misc.h" // [crispy] M_StringJoin()
 
 #include "g_game.h"
@@ -44,6 +45,8 @@
 #include "doomstat.h"
 
 #include "p_extnodes.h" // [crispy] support extended node formats
+#include "p_reject.h" // [AP]
+#include "p_profile.h" // [AP] -thinkstats
 
 #include "apdoom_c_def.h"
 #include "apdoom2_c_def.h"
@@ -713,14 +716,62 @@ void get_fit_dimensions(fixed_t x, fixed_t y, fixed_t* fit_radius, fixed_t* fit_
         }
     }
 
-    for (int i = 0, len = sizeof(radius_checks) / sizeof(fixed_t); i < len; ++i)
+    // A box that hits a line still hits it when grown, so whether a radius
+    // fits is monotonic. Binary search the largest one instead of probing
+    // them all from the biggest (and most expensive) down.
+    int lo = 0;
+    int hi = sizeof(radius_checks) / sizeof(fixed_t) - 1;
+    *fit_radius = radius_checks[hi];
+    while (lo <= hi)
     {
-        if (check_position(x, y, radius_checks[i]) || i == len - 1)
+        int mid = (lo + hi) / 2;
+        if (check_position(x, y, radius_checks[mid]))
         {
-            *fit_radius = radius_checks[i];
-            break;
+            *fit_radius = radius_checks[mid];
+            hi = mid - 1;
         }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+}
+
+
+// Fit results only depend on the map geometry, so they are kept per map
+// lump for the whole session. Levels get reloaded a lot (reset on death,
+// coming back from the level select).
+typedef struct
+{
+    int lump;
+    int numthings;
+    fixed_t* fit_radius; // Per thing index, 0 until probed
+    fixed_t* fit_height;
+} fit_cache_t;
+
+static fit_cache_t* fit_caches = NULL;
+static int fit_cache_count = 0;
+
+static fit_cache_t* get_fit_cache(int lump, int numthings)
+{
+    fit_cache_t* fit_cache;
+    int i;
+
+    for (i = 0; i < fit_cache_count; ++i)
+    {
+        if (fit_caches[i].lump == lump && fit_caches[i].numthings == numthings)
+            return &fit_caches[i];
     }
+
+    fit_caches = I_Realloc(fit_caches, sizeof(fit_cache_t) * (fit_cache_count + 1));
+    fit_cache = &fit_caches[fit_cache_count++];
+    fit_cache->lump = lump;
+    fit_cache->numthings = numthings;
+    fit_cache->fit_radius = Z_Malloc(sizeof(fixed_t) * numthings, PU_STATIC, NULL);
+    fit_cache->fit_height = Z_Malloc(sizeof(fixed_t) * numthings, PU_STATIC, NULL);
+    memset(fit_cache->fit_radius, 0, sizeof(fixed_t) * numthings);
+    memset(fit_cache->fit_height, 0, sizeof(fixed_t) * numthings);
+    return fit_cache;
 }
 
 
@@ -730,7 +781,7 @@ void get_fit_dimensions(fixed_t x, fixed_t y, fixed_t* fit_radius, fixed_t* fit_
 void P_LoadThings (int lump)
 {
     byte               *data;
-    int			i, j;
+    int			i;
     mapthing_t         *mt;
     mapthing_t          spawnthing;
     mapthing_t  spawnthing_player1_start;
@@ -741,11 +792,15 @@ void P_LoadThings (int lump)
     data = W_CacheLumpNum (lump,PU_STATIC);
     numthings = W_LumpLength (lump) / sizeof(mapthing_t);
 
+    // [AP] room for the map things plus some projectiles and effects
+    P_ReserveMobjs (numthings + MOBJCHUNK);
+
     // Generate unique random seed from ap seed + level
     const char* ap_seed = apdoom_get_seed();
     unsigned long long seed = hash_seed(ap_seed);
     seed += gameepisode * 9 + gamemap;
-    srand(seed);
+    ap_rng_t rng;
+    ap_rng_seed(&rng, seed);
 
     int things_type_remap[1024] = {0};
 
@@ -779,6 +834,7 @@ void P_LoadThings (int lump)
         int monster_count = 0;
         monster_spawn_def_t spawns[1024] = {0};
         int spawn_count = 0;
+        fit_cache_t* fit_cache = get_fit_cache(lump, numthings);
 
         // Collect spawn points
         mt = (mapthing_t *)data;
@@ -797,7 +853,10 @@ void P_LoadThings (int lump)
                     continue;
                 if (random_monster_defs[j].doom_type == mt->type)
                 {
-                    get_fit_dimensions(mt->x * FRACUNIT, mt->y * FRACUNIT, &spawns[spawn_count].fit_radius, &spawns[spawn_count].fit_height);
+                    if (!fit_cache->fit_radius[i])
+                        get_fit_dimensions(mt->x * FRACUNIT, mt->y * FRACUNIT, &fit_cache->fit_radius[i], &fit_cache->fit_height[i]);
+                    spawns[spawn_count].fit_radius = fit_cache->fit_radius[i];
+                    spawns[spawn_count].fit_height = fit_cache->fit_height[i];
                     spawns[spawn_count].og_monster = &random_monster_defs[j];
                     spawns[spawn_count++].index = i;
                     break;
@@ -836,12 +895,12 @@ void P_LoadThings (int lump)
 
             while (monster_count < spawn_count)
             {
-                int rnd = rand() % total;
+                int rnd = ap_rng_range(&rng, total);
                 for (int i = 0; i < NUM_RMC; ++i)
                 {
                     if (rnd < ratios[i])
                     {
-                        rnd = rand() % rmc_ratios[i];
+                        rnd = ap_rng_range(&rng, rmc_ratios[i]);
                         for (int j = 0; j < defs_by_rmc_count[i]; ++j)
                         {
                             if (rnd < defs_by_rmc[i][j]->frequency)
@@ -869,7 +928,7 @@ void P_LoadThings (int lump)
 
             while (monster_count < spawn_count)
             {
-                int rnd = rand() % total;
+                int rnd = ap_rng_range(&rng, total);
                 for (int i = 0; i < monster_def_count; ++i)
                 {
                     random_monster_def_t* monster = &random_monster_defs[i];
@@ -893,7 +952,7 @@ void P_LoadThings (int lump)
                     baron_count++;
             while (baron_count < 2)
             {
-                int i = rand() % monster_count;
+                int i = ap_rng_range(&rng, monster_count);
                 if (monsters[i]->doom_type != 3003)
                 {
                     monsters[i] = &random_monster_defs[7];
@@ -905,7 +964,7 @@ void P_LoadThings (int lump)
         // Randomly pick them until empty, and place them in different spots
         for (i = 0; i < spawn_count; i++)
         {
-            int idx = rand() % monster_count;
+            int idx = ap_rng_range(&rng, monster_count);
             spawns[i].monster = monsters[idx];
             monsters[idx] = monsters[monster_count - 1];
             monster_count--;
@@ -922,7 +981,7 @@ void P_LoadThings (int lump)
                 int tries = 1000;
                 while (tries--)
                 {
-                    int j = rand() % spawn_count;
+                    int j = ap_rng_range(&rng, spawn_count);
                     if (j == i) continue;
                     monster_spawn_def_t* spawn2 = &spawns[j];
                     if (spawn1->monster->height <= spawn2->fit_height &&
@@ -999,7 +1058,7 @@ void P_LoadThings (int lump)
             mt = (mapthing_t *)data;
             for (i = 0; i < index_count; i++)
             {
-                int idx = rand() % item_count;
+                int idx = ap_rng_range(&rng, item_count);
                 things_type_remap[indices[i]] = items[idx];
                 items[idx] = items[item_count - 1];
                 item_count--;
@@ -1072,10 +1131,10 @@ void P_LoadThings (int lump)
                     case 2012: // medikit
                     case 2011: // Stimpack
                     {
-                        int rnd = rand() % total;
+                        int rnd = ap_rng_range(&rng, total);
                         if (rnd < ratios[0])
                         {
-                            switch (rand()%2)
+                            switch (ap_rng_range(&rng, 2))
                             {
                                 case 0: things_type_remap[i] = 2015; break; // armor bonus
                                 case 1: things_type_remap[i] = 2014; break; // health bonus
@@ -1083,7 +1142,7 @@ void P_LoadThings (int lump)
                         }
                         else if (rnd < ratios[0] + ratios[1])
                         {
-                            switch (rand()%5)
+                            switch (ap_rng_range(&rng, 5))
                             {
                                 case 0: things_type_remap[i] = 2011; break; // Stimpack
                                 case 1: things_type_remap[i] = 2008; break; // 4 shotgun shells
@@ -1094,7 +1153,7 @@ void P_LoadThings (int lump)
                         }
                         else
                         {
-                            switch (rand()%5)
+                            switch (ap_rng_range(&rng, 5))
                             {
                                 case 0: things_type_remap[i] = 2048; break; // box of bullets
                                 case 1: things_type_remap[i] = 2046; break; // box of rockets
@@ -1166,17 +1225,7 @@ void P_LoadThings (int lump)
                     spawnthing.type = 20001;
                 else
                     spawnthing.type = 20000;
-                int skip = 0;
-                ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-                for (j = 0; j < level_state->check_count; ++j)
-                {
-                    if (level_state->checks[j] == i)
-                    {
-                        skip = 1;
-                        break;
-                    }
-                }
-                if (skip)
+                if (apdoom_is_location_checked(ap_make_level_index(gameepisode, gamemap), i))
                     continue;
             }
         }
@@ -1500,6 +1549,7 @@ boolean P_LoadBlockMap (int lump)
     count = sizeof(*blocklinks) * bmapwidth * bmapheight;
     blocklinks = Z_Malloc(count, PU_LEVEL, 0);
     memset(blocklinks, 0, count);
+    P_InitBlockThings();
 
     // [crispy] (re-)create BLOCKMAP if necessary
     fprintf(stderr, ")\n");
@@ -1815,6 +1865,34 @@ int P_GetNumForMap (int episode, int map, boolean critical)
     return critical ? W_GetNumForName(lumpname) : W_CheckNumForName(lumpname);
 }
 
+// [AP] Pull a map's lumps into the zone cache ahead of P_SetupLevel, so
+// entering it from the level select doesn't wait on the WAD reads. They're
+// hinted and read in file order; mapped WADs aren't read here at all, so
+// the hint is what saves their page faults later.
+void P_PrefetchMap (int episode, int map)
+{
+    int lumpnum = P_GetNumForMap(episode, map, false);
+    lumpindex_t lumps[ML_BLOCKMAP];
+    int i, count;
+
+    if (lumpnum < 0)
+        return;
+
+    for (i = ML_THINGS, count = 0; i <= ML_BLOCKMAP && lumpnum + i < numlumps; ++i)
+    {
+        lumps[count++] = lumpnum + i;
+    }
+
+    W_SortLumps(lumps, count);
+    W_PrefetchLumps(lumps, count);
+
+    for (i = 0; i < count; ++i)
+    {
+        W_CacheLumpNum(lumps[i], PU_STATIC);
+        W_ReleaseLumpNum(lumps[i]);
+    }
+}
+
 // pointer to the current map lump info struct
 lumpinfo_t *maplumpinfo;
 
@@ -1894,10 +1972,13 @@ P_SetupLevel
     }
     musinfo.from_savegame = false;
 
+    P_StopRejectBuilder (); // [AP]
     Z_FreeTags (PU_LEVEL, PU_PURGELEVEL-1);
+    M_TrimMemory(); // [AP] -lowmem empties the caches between levels
 
     // UNUSED W_Profile ();
     P_InitThinkers ();
+    P_InitMobjPool (); // [AP]
 
     // if working with a devlopment map, reload it
     W_Reload ();
@@ -1924,9 +2005,12 @@ P_SetupLevel
     lumpnum = W_GetNumForName (lumpname);
 */
     lumpnum = P_GetNumForMap (episode, map, true);
+    P_PrefetchMap (episode, map); // [AP] one sweep instead of a seek per lump
 	
     maplumpinfo = lumpinfo[lumpnum];
     strncpy(lumpname, maplumpinfo->name, 8);
+    Z_StatsLevel(lumpname); // [AP] -zonestats
+    P_InitThinkStats(lumpname); // [AP] -thinkstats
 
     leveltime = 0;
     leveltimesinceload = 0;
@@ -1969,8 +2053,8 @@ P_SetupLevel
     // [crispy] (re-)create BLOCKMAP if necessary
     if (!crispy_validblockmap)
     {
-	extern void P_CreateBlockMap (void);
-	P_CreateBlockMap();
+	extern void P_CreateBlockMap (int lumpnum);
+	P_CreateBlockMap(lumpnum);
     }
     if (crispy_mapformat & (MFMT_ZDBSPX | MFMT_ZDBSPZ))
 	P_LoadNodes_ZDBSP (lumpnum+ML_NODES, crispy_mapformat & MFMT_ZDBSPZ);
@@ -1989,7 +2073,11 @@ P_SetupLevel
     }
 
     P_GroupLines ();
+    P_InitTagLists (); // [AP]
+    P_InitSoundGraph (); // [AP]
     P_LoadReject (lumpnum+ML_REJECT);
+    P_StartRejectBuilder (); // [AP]
+    R_InitSubsectorGrid (); // [AP]
 
     // [crispy] remove slime trails
     P_RemoveSlimeTrails();
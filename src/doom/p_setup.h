@@ -35,6 +35,9 @@ P_SetupLevel
   int		playermask,
   skill_t	skill);
 
+// [AP] Warm the zone cache with a map's lumps.
+void P_PrefetchMap (int episode, int map);
+
 // Called by startup code.
 void P_Init (void);
 
@@ -39,6 +39,32 @@ fixed_t		t2y;
 
 int		sightcounts[2];
 
+// [AP] Sight cache. A monster usually asks about the same target several
+// times in one tic (A_Chase, P_CheckMeleeRange, P_CheckMissileRange)
+// without either of them moving in between. The result of a full check
+// depends only on both positions, the looker's eye height, the target's
+// z range and the sector heights, so it is memoised on exactly those.
+// Entries are dropped every tic and whenever a plane moves, which keeps
+// the cache exact and demos in sync.
+
+#define SIGHTCACHESIZE 1024
+
+typedef struct
+{
+    fixed_t	x1, y1, z1;
+    fixed_t	x2, y2, z2, h2;
+    unsigned int stamp;
+    boolean	result;
+} sightcache_t;
+
+static sightcache_t	sightcache[SIGHTCACHESIZE];
+static unsigned int	sightcachestamp = 1;
+
+void P_InvalidateSightCache (void)
+{
+    sightcachestamp++;
+}
+
 
 // PTR_SightTraverse() for Doom 1.2 sight calculations
 // taken from prboom-plus/src/p_sight.c:69-102
@@ -345,6 +371,7 @@ P_CheckSight
     int		pnum;
     int		bytenum;
     int		bitnum;
+    sightcache_t* entry;
     
     // First check for trivial rejection.
 
@@ -368,18 +395,46 @@ P_CheckSight
     // Now look from eyes of t1 to any part of t2.
     sightcounts[1]++;
 
-    validcount++;
-	
     sightzstart = t1->z + t1->height - (t1->height>>2);
-    topslope = (t2->z+t2->height) - sightzstart;
-    bottomslope = (t2->z) - sightzstart;
-	
+
+    // [AP] P_PathTraverse has intercept overrun side effects; never skip it.
     if (gameversion <= exe_doom_1_2)
     {
+        validcount++;
+        topslope = (t2->z+t2->height) - sightzstart;
+        bottomslope = (t2->z) - sightzstart;
+
         return P_PathTraverse(t1->x, t1->y, t2->x, t2->y,
                               PT_EARLYOUT | PT_ADDLINES, PTR_SightTraverse);
     }
 
+    // [AP] Same question already answered this tic?
+    entry = &sightcache[((unsigned int) (t1->x ^ (t1->y >> 3) ^ (t2->x >> 6)
+                                         ^ (t2->y >> 9) ^ (t2->z >> 12))
+                         * 2654435761u) >> 22];
+
+    if (entry->stamp == sightcachestamp
+     && entry->x1 == t1->x && entry->y1 == t1->y && entry->z1 == sightzstart
+     && entry->x2 == t2->x && entry->y2 == t2->y && entry->z2 == t2->z
+     && entry->h2 == t2->height)
+    {
+	return entry->result;
+    }
+
+    entry->stamp = sightcachestamp;
+    entry->x1 = t1->x;
+    entry->y1 = t1->y;
+    entry->z1 = sightzstart;
+    entry->x2 = t2->x;
+    entry->y2 = t2->y;
+    entry->z2 = t2->z;
+    entry->h2 = t2->height;
+
+    validcount++;
+	
+    topslope = (t2->z+t2->height) - sightzstart;
+    bottomslope = (t2->z) - sightzstart;
+
     strace.x = t1->x;
     strace.y = t1->y;
     t2x = t2->x;
@@ -388,7 +443,7 @@ P_CheckSight
     strace.dy = t2->y - t1->y;
 
     // the head node is the last node output
-    return P_CrossBSPNode (numnodes-1);	
+    return entry->result = P_CrossBSPNode (numnodes-1);	
 }
 
 
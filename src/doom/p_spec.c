@@ -529,11 +529,84 @@ P_FindSectorFromLineTag
     }
 #endif
 
-    for (i=start+1;i<numsectors;i++)
-	if (sectors[i].tag == line->tag)
-	    return i;
-    
-    return -1;
+    return P_NextTaggedSector(line->tag, start);
+}
+
+
+//
+// [AP] Sector tag chains. sectors are hashed on their tag, and each
+// chain runs in ascending sector order, so walking it gives the same
+// sectors in the same order as the linear scan did; only the sectors
+// of other tags are skipped. Rebuilt when a level is set up and when
+// a savegame restores the tags.
+//
+
+static int *tagchain_first;
+static int *tagchain_next;
+static int tagchain_size;
+
+static int TagChainHash(int tag)
+{
+    return (unsigned short) tag % tagchain_size;
+}
+
+void P_InitTagLists(void)
+{
+    int i;
+
+    tagchain_size = numsectors > 0 ? numsectors : 1;
+    tagchain_first = Z_Malloc(tagchain_size * sizeof(*tagchain_first),
+                              PU_LEVEL, NULL);
+    tagchain_next = Z_Malloc(tagchain_size * sizeof(*tagchain_next),
+                             PU_LEVEL, NULL);
+
+    for (i = 0; i < tagchain_size; i++)
+    {
+        tagchain_first[i] = -1;
+    }
+
+    // Insert from the end, so the chains come out in ascending order
+    for (i = numsectors - 1; i >= 0; i--)
+    {
+        const int h = TagChainHash(sectors[i].tag);
+
+        tagchain_next[i] = tagchain_first[h];
+        tagchain_first[h] = i;
+    }
+}
+
+int P_NextTaggedSector(int tag, int start)
+{
+    int i;
+
+    if (start < 0)
+    {
+        i = tagchain_first[TagChainHash(tag)];
+    }
+    else if (start < numsectors
+          && TagChainHash(sectors[start].tag) == TagChainHash(tag))
+    {
+        i = tagchain_next[start];
+    }
+    else
+    {
+        // Resuming from a sector on another chain; scan as vanilla did
+        for (i = start + 1; i < numsectors; i++)
+        {
+            if (sectors[i].tag == tag)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    while (i >= 0 && sectors[i].tag != tag)
+    {
+        i = tagchain_next[i];
+    }
+
+    return i;
 }
 
 
@@ -104,6 +104,11 @@ P_FindSectorFromLineTag
 ( line_t*	line,
   int		start );
 
+// [AP] Next sector after start (-1 for the first) with the given tag,
+// in sector order, without walking the sectors of other tags.
+void P_InitTagLists(void);
+int P_NextTaggedSector(int tag, int start);
+
 int
 P_FindMinSurroundingLight
 ( sector_t*	sector,
@@ -18,9 +18,12 @@
 //
 
 
+#include "i_system.h"
 #include "z_zone.h"
 #include "p_local.h"
 #include "s_musinfo.h" // [crispy] T_MAPMusic()
+#include "p_reject.h" // [AP]
+#include "p_profile.h" // [AP]
 
 #include "doomstat.h"
 
@@ -28,6 +31,27 @@
 int	leveltime;
 int leveltimesinceload;
 
+uint64_t	statehash; // [AP]
+
+//
+// P_StateHash
+// [AP] statehash, with the RNG index and its bits mixed down so that
+//  the low byte depends on all of it.
+//
+uint64_t P_StateHash (void)
+{
+    extern int prndindex;
+    uint64_t h = statehash ^ ((uint64_t) prndindex << 32) ^ (uint64_t) leveltime;
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
 //
 // THINKERS
 // All thinkers should be allocated by Z_Malloc
@@ -45,9 +69,189 @@ thinker_t	thinkercap;
 //
 // P_InitThinkers
 //
+static void P_ClearSleepers (void);
+
 void P_InitThinkers (void)
 {
     thinkercap.prev = thinkercap.next  = &thinkercap;
+    nummovingsectors = 0; // [AP]
+    P_ClearSleepers (); // [AP]
+    statehash = 0; // [AP]
+}
+
+
+//
+// [AP] SLEEPING THINKERS
+//
+// Lighting thinkers that only count down to their next change take
+// themselves off the run by clearing their function, and go on a timer
+// wheel. At the start of the tic in which they are due the function is
+// put back, so they still run in their place in the list and draw
+// their P_Random numbers in the original order.
+//
+
+#define SLEEPWHEEL	64
+
+typedef struct sleeper_s
+{
+    thinker_t*		thinker;
+    actionf_t		function;
+    int*		count;
+    int			waketic;
+    struct sleeper_s*	next;
+} sleeper_t;
+
+static sleeper_t*	sleepwheel[SLEEPWHEEL];
+static sleeper_t*	freesleepers;
+
+//
+// P_SleepThinker
+// Called by a running thinker that has just set *count, the number of
+// tics until it next does anything. It is called again with *count at 1
+// in the tic in which *count would have run out.
+//
+void P_SleepThinker (thinker_t* thinker, int* count)
+{
+    sleeper_t*	sleeper;
+    int		slot;
+
+    if (*count <= 1)
+	return;
+
+    if (freesleepers != NULL)
+    {
+	sleeper = freesleepers;
+	freesleepers = sleeper->next;
+    }
+    else
+    {
+	sleeper = Z_Malloc(sizeof(*sleeper), PU_STATIC, NULL);
+    }
+
+    sleeper->thinker = thinker;
+    sleeper->function = thinker->function;
+    sleeper->count = count;
+    sleeper->waketic = leveltime + *count;
+
+    *count = 1;
+    thinker->function.acv = NULL;
+
+    slot = sleeper->waketic & (SLEEPWHEEL - 1);
+    sleeper->next = sleepwheel[slot];
+    sleepwheel[slot] = sleeper;
+}
+
+//
+// P_WakeThinkers
+// Puts back the thinkers due this tic. The others in the slot wait for
+// another turn of the wheel.
+//
+static void P_WakeThinkers (void)
+{
+    sleeper_t**	link;
+    sleeper_t*	sleeper;
+
+    link = &sleepwheel[leveltime & (SLEEPWHEEL - 1)];
+
+    while ((sleeper = *link) != NULL)
+    {
+	if (sleeper->waketic == leveltime)
+	{
+	    sleeper->thinker->function = sleeper->function;
+	    *link = sleeper->next;
+	    sleeper->next = freesleepers;
+	    freesleepers = sleeper;
+	}
+	else
+	{
+	    link = &sleeper->next;
+	}
+    }
+}
+
+//
+// P_WakeAllThinkers
+// Wakes everything early with the count it would have had by now, so
+// that savegames see every thinker as if none had slept.
+//
+void P_WakeAllThinkers (void)
+{
+    sleeper_t*	sleeper;
+    int		i;
+
+    for (i = 0; i < SLEEPWHEEL; i++)
+    {
+	while ((sleeper = sleepwheel[i]) != NULL)
+	{
+	    sleeper->thinker->function = sleeper->function;
+	    *sleeper->count = sleeper->waketic - leveltime + 1;
+
+	    sleepwheel[i] = sleeper->next;
+	    sleeper->next = freesleepers;
+	    freesleepers = sleeper;
+	}
+    }
+}
+
+//
+// P_ClearSleepers
+// The thinkers themselves are gone, keep the nodes for reuse.
+//
+static void P_ClearSleepers (void)
+{
+    sleeper_t*	sleeper;
+    int		i;
+
+    for (i = 0; i < SLEEPWHEEL; i++)
+    {
+	while ((sleeper = sleepwheel[i]) != NULL)
+	{
+	    sleepwheel[i] = sleeper->next;
+	    sleeper->next = freesleepers;
+	    freesleepers = sleeper;
+	}
+    }
+}
+
+
+//
+// P_AddMovingSector
+// [AP] Called once per tic for each sector that T_MovePlane moves.
+//
+sector_t**	movingsectors;
+int		nummovingsectors;
+static int	maxmovingsectors;
+
+void P_AddMovingSector (sector_t* sector)
+{
+    if (nummovingsectors == maxmovingsectors)
+    {
+	maxmovingsectors = maxmovingsectors ? 2 * maxmovingsectors : 64;
+	movingsectors = I_Realloc(movingsectors, maxmovingsectors * sizeof(*movingsectors));
+    }
+
+    movingsectors[nummovingsectors++] = sector;
+}
+
+
+//
+// P_ClearMovingSectors
+// [AP] Sectors that moved last tic go back to their real heights,
+//  the ones that keep moving are added again by T_MovePlane.
+//
+static void P_ClearMovingSectors (void)
+{
+    int i;
+
+    for (i = 0; i < nummovingsectors; i++)
+    {
+	sector_t* sector = movingsectors[i];
+
+	sector->interpfloorheight = sector->floorheight;
+	sector->interpceilingheight = sector->ceilingheight;
+    }
+
+    nummovingsectors = 0;
 }
 
 
@@ -93,25 +297,45 @@ void P_AllocateThinker (thinker_t*	thinker)
 //
 // P_RunThinkers
 //
+// [AP] Thinkers must run in list order for demo sync, so rather than
+// splitting the list by class, pull the next node in while the current
+// thinker is running. Most of them are mobjs, whose thinker_t is the
+// first member, so this warms the start of the next object as well.
+//
+#if defined(__GNUC__)
+#define PrefetchThinker(th) __builtin_prefetch(th)
+#else
+#define PrefetchThinker(th)
+#endif
+
 void P_RunThinkers (void)
 {
     thinker_t *currentthinker, *nextthinker;
 
+    P_WakeThinkers (); // [AP]
+
     currentthinker = thinkercap.next;
     while (currentthinker != &thinkercap)
     {
+	PrefetchThinker(currentthinker->next);
+
 	if ( currentthinker->function.acv == (actionf_v)(-1) )
 	{
 	    // time to remove it
             nextthinker = currentthinker->next;
 	    currentthinker->next->prev = currentthinker->prev;
 	    currentthinker->prev->next = currentthinker->next;
-	    Z_Free(currentthinker);
+	    P_FreeThinker(currentthinker);
 	}
 	else
 	{
 	    if (currentthinker->function.acp1)
-		currentthinker->function.acp1 (currentthinker);
+	    {
+		if (thinkstats) // [AP] -thinkstats
+		    P_ProfileThinker (currentthinker);
+		else
+		    currentthinker->function.acp1 (currentthinker);
+	    }
             nextthinker = currentthinker->next;
 	}
 	currentthinker = nextthinker;
@@ -145,6 +369,10 @@ void P_Ticker (void)
     }
     
 		
+    P_ClearMovingSectors (); // [AP]
+    P_UpdateReject (); // [AP]
+    P_InvalidateSightCache (); // [AP]
+
     for (i=0 ; i<MAXPLAYERS ; i++)
 	if (playeringame[i])
 	    P_PlayerThink (&players[i]);
@@ -23,10 +23,11 @@
 #include "doomstat.h"
 #include "r_data.h"
 #include "w_wad.h"
+#include "z_zone.h"
 
 // [crispy] brightmap data
 
-static const byte nobrightmap[256] = {0};
+const byte nobrightmap[256] = {0};
 
 static const byte notgray[256] =
 {
@@ -699,38 +700,35 @@ static const byte *R_BrightmapForTexName_Hacx (const char *texname)
 // [crispy] adapted from russian-doom/src/doom/r_things.c:617-639
 static const byte *R_BrightmapForSprite_Doom (const int type)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_SPRITES)
+	switch (type)
 	{
-		switch (type)
+		// Armor Bonus
+		case SPR_BON2:
+		// Cell Charge
+		case SPR_CELL:
 		{
-			// Armor Bonus
-			case SPR_BON2:
-			// Cell Charge
-			case SPR_CELL:
-			{
-				return greenonly2;
-				break;
-			}
-			// Barrel
-			case SPR_BAR1:
-			{
-				return greenonly3;
-				break;
-			}
-			// Cell Charge Pack
-			case SPR_CELP:
-			{
-				return yellowonly;
-				break;
-			}
-			// BFG9000
-			case SPR_BFUG:
-			// Plasmagun
-			case SPR_PLAS:
-			{
-				return redonly;
-				break;
-			}
+			return greenonly2;
+			break;
+		}
+		// Barrel
+		case SPR_BAR1:
+		{
+			return greenonly3;
+			break;
+		}
+		// Cell Charge Pack
+		case SPR_CELP:
+		{
+			return yellowonly;
+			break;
+		}
+		// BFG9000
+		case SPR_BFUG:
+		// Plasmagun
+		case SPR_PLAS:
+		{
+			return redonly;
+			break;
 		}
 	}
 
@@ -769,46 +767,43 @@ static const byte *R_BrightmapForSprite_Chex (const int type)
 
 static const byte *R_BrightmapForSprite_Hacx (const int type)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_SPRITES)
+	switch (type)
 	{
-		switch (type)
+		// Chainsaw
+		case SPR_CSAW:
+		// Plasmagun
+		case SPR_PLAS:
+		// Cell Charge
+		case SPR_CELL:
+		// Cell Charge Pack
+		case SPR_CELP:
 		{
-			// Chainsaw
-			case SPR_CSAW:
-			// Plasmagun
-			case SPR_PLAS:
-			// Cell Charge
-			case SPR_CELL:
-			// Cell Charge Pack
-			case SPR_CELP:
-			{
-				return redonly;
-				break;
-			}
-			// Rocket launcher
-			case SPR_LAUN:
-			// Medikit
-			case SPR_MEDI:
-			{
-				return redandgreen;
-				break;
-			}
-			// Rocket
-			case SPR_ROCK:
-			// Box of rockets
-			case SPR_BROK:
-			{
-				return greenonly1;
-				break;
-			}
-			// Health Bonus
-			case SPR_BON1:
-			// Stimpack
-			case SPR_STIM:
-			{
-				return notgrayorbrown;
-				break;
-			}
+			return redonly;
+			break;
+		}
+		// Rocket launcher
+		case SPR_LAUN:
+		// Medikit
+		case SPR_MEDI:
+		{
+			return redandgreen;
+			break;
+		}
+		// Rocket
+		case SPR_ROCK:
+		// Box of rockets
+		case SPR_BROK:
+		{
+			return greenonly1;
+			break;
+		}
+		// Health Bonus
+		case SPR_BON1:
+		// Stimpack
+		case SPR_STIM:
+		{
+			return notgrayorbrown;
+			break;
 		}
 	}
 
@@ -821,14 +816,11 @@ static int bmapflatnum[12];
 
 static const byte *R_BrightmapForFlatNum_Doom (const int num)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_TEXTURES)
+	if (num == bmapflatnum[0] ||
+	    num == bmapflatnum[1] ||
+	    num == bmapflatnum[2])
 	{
-		if (num == bmapflatnum[0] ||
-		    num == bmapflatnum[1] ||
-		    num == bmapflatnum[2])
-		{
-			return notgrayorbrown;
-		}
+		return notgrayorbrown;
 	}
 
 	return nobrightmap;
@@ -836,27 +828,24 @@ static const byte *R_BrightmapForFlatNum_Doom (const int num)
 
 static const byte *R_BrightmapForFlatNum_Hacx (const int num)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_TEXTURES)
+	if (num == bmapflatnum[0] ||
+	    num == bmapflatnum[1] ||
+	    num == bmapflatnum[2] ||
+	    num == bmapflatnum[3] ||
+	    num == bmapflatnum[4] ||
+	    num == bmapflatnum[5] ||
+	    num == bmapflatnum[9] ||
+	    num == bmapflatnum[10] ||
+	    num == bmapflatnum[11])
 	{
-		if (num == bmapflatnum[0] ||
-		    num == bmapflatnum[1] ||
-		    num == bmapflatnum[2] ||
-		    num == bmapflatnum[3] ||
-		    num == bmapflatnum[4] ||
-		    num == bmapflatnum[5] ||
-		    num == bmapflatnum[9] ||
-		    num == bmapflatnum[10] ||
-		    num == bmapflatnum[11])
-		{
-			return notgrayorbrown;
-		}
+		return notgrayorbrown;
+	}
 
-		if (num == bmapflatnum[6] ||
-		    num == bmapflatnum[7] ||
-		    num == bmapflatnum[8])
-		{
-			return greenonly1;
-		}
+	if (num == bmapflatnum[6] ||
+	    num == bmapflatnum[7] ||
+	    num == bmapflatnum[8])
+	{
+		return greenonly1;
 	}
 
 	return nobrightmap;
@@ -871,18 +860,15 @@ static const byte *R_BrightmapForFlatNum_None (const int num)
 
 static const byte *R_BrightmapForState_Doom (const int state)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_SPRITES)
+	switch (state)
 	{
-		switch (state)
+		case S_BFG1:
+		case S_BFG2:
+		case S_BFG3:
+		case S_BFG4:
 		{
-			case S_BFG1:
-			case S_BFG2:
-			case S_BFG3:
-			case S_BFG4:
-			{
-				return redonly;
-				break;
-			}
+			return redonly;
+			break;
 		}
 	}
 
@@ -891,29 +877,26 @@ static const byte *R_BrightmapForState_Doom (const int state)
 
 static const byte *R_BrightmapForState_Hacx (const int state)
 {
-	if (crispy->brightmaps & BRIGHTMAPS_SPRITES)
+	switch (state)
 	{
-		switch (state)
+		case S_SAW2:
+		case S_SAW3:
 		{
-			case S_SAW2:
-			case S_SAW3:
-			{
-				return hacxlightning;
-				break;
-			}
-			case S_MISSILE:
-			{
-				return redandgreen;
-				break;
-			}
-			case S_SAW:
-			case S_SAWB:
-			case S_PLASMA:
-			case S_PLASMA2:
-			{
-				return redonly;
-				break;
-			}
+			return hacxlightning;
+			break;
+		}
+		case S_MISSILE:
+		{
+			return redandgreen;
+			break;
+		}
+		case S_SAW:
+		case S_SAWB:
+		case S_PLASMA:
+		case S_PLASMA2:
+		{
+			return redonly;
+			break;
 		}
 	}
 
@@ -928,12 +911,50 @@ static const byte *R_BrightmapForState_None (const int state)
 // [crispy] initialize brightmaps
 
 const byte *(*R_BrightmapForTexName) (const char *texname);
-const byte *(*R_BrightmapForSprite) (const int type);
-const byte *(*R_BrightmapForFlatNum) (const int num);
-const byte *(*R_BrightmapForState) (const int state);
+
+// [AP] Resolved once in R_InitBrightmaps, so looking one up for a sprite,
+// psprite state or flat is an array index instead of a switch.
+static const byte *spritebrightmaps[NUMSPRITES];
+static const byte *statebrightmaps[NUMSTATES];
+static const byte **flatbrightmaps;
+
+const byte *R_BrightmapForSprite (const int type)
+{
+	if ((crispy->brightmaps & BRIGHTMAPS_SPRITES) && (unsigned) type < NUMSPRITES)
+	{
+		return spritebrightmaps[type];
+	}
+
+	return nobrightmap;
+}
+
+const byte *R_BrightmapForFlatNum (const int num)
+{
+	if ((crispy->brightmaps & BRIGHTMAPS_TEXTURES) && num >= 0 && num < numflats)
+	{
+		return flatbrightmaps[num];
+	}
+
+	return nobrightmap;
+}
+
+const byte *R_BrightmapForState (const int state)
+{
+	if ((crispy->brightmaps & BRIGHTMAPS_SPRITES) && (unsigned) state < NUMSTATES)
+	{
+		return statebrightmaps[state];
+	}
+
+	return nobrightmap;
+}
 
 void R_InitBrightmaps ()
 {
+	const byte *(*bmapforsprite) (const int type);
+	const byte *(*bmapforflatnum) (const int num);
+	const byte *(*bmapforstate) (const int state);
+	int i;
+
 	if (gameversion == exe_hacx)
 	{
 		bmapflatnum[0] = R_FlatNumForName("FLOOR1_1");
@@ -950,9 +971,9 @@ void R_InitBrightmaps ()
 		bmapflatnum[11] = R_FlatNumForName("SLIME15");
 
 		R_BrightmapForTexName = R_BrightmapForTexName_Hacx;
-		R_BrightmapForSprite = R_BrightmapForSprite_Hacx;
-		R_BrightmapForFlatNum = R_BrightmapForFlatNum_Hacx;
-		R_BrightmapForState = R_BrightmapForState_Hacx;
+		bmapforsprite = R_BrightmapForSprite_Hacx;
+		bmapforflatnum = R_BrightmapForFlatNum_Hacx;
+		bmapforstate = R_BrightmapForState_Hacx;
 	}
 	else
 	if (gameversion == exe_chex)
@@ -967,9 +988,9 @@ void R_InitBrightmaps ()
 		}
 
 		R_BrightmapForTexName = R_BrightmapForTexName_Chex;
-		R_BrightmapForSprite = R_BrightmapForSprite_Chex;
-		R_BrightmapForFlatNum = R_BrightmapForFlatNum_None;
-		R_BrightmapForState = R_BrightmapForState_None;
+		bmapforsprite = R_BrightmapForSprite_Chex;
+		bmapforflatnum = R_BrightmapForFlatNum_None;
+		bmapforstate = R_BrightmapForState_None;
 	}
 	else
 	{
@@ -979,8 +1000,25 @@ void R_InitBrightmaps ()
 		bmapflatnum[2] = R_FlatNumForName("CONS1_7");
 
 		R_BrightmapForTexName = R_BrightmapForTexName_Doom;
-		R_BrightmapForSprite = R_BrightmapForSprite_Doom;
-		R_BrightmapForFlatNum = R_BrightmapForFlatNum_Doom;
-		R_BrightmapForState = R_BrightmapForState_Doom;
+		bmapforsprite = R_BrightmapForSprite_Doom;
+		bmapforflatnum = R_BrightmapForFlatNum_Doom;
+		bmapforstate = R_BrightmapForState_Doom;
+	}
+
+	for (i = 0; i < NUMSPRITES; i++)
+	{
+		spritebrightmaps[i] = bmapforsprite(i);
+	}
+
+	for (i = 0; i < NUMSTATES; i++)
+	{
+		statebrightmaps[i] = bmapforstate(i);
+	}
+
+	flatbrightmaps = Z_Malloc(numflats * sizeof(*flatbrightmaps), PU_STATIC, 0);
+
+	for (i = 0; i < numflats; i++)
+	{
+		flatbrightmaps[i] = bmapforflatnum(i);
 	}
 }
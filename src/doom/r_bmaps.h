@@ -25,9 +25,12 @@
 extern void R_InitBrightmaps ();
 
 extern const byte *(*R_BrightmapForTexName) (const char *texname);
-extern const byte *(*R_BrightmapForSprite) (const int type);
-extern const byte *(*R_BrightmapForFlatNum) (const int num);
-extern const byte *(*R_BrightmapForState) (const int state);
+extern const byte *R_BrightmapForSprite (const int type);
+extern const byte *R_BrightmapForFlatNum (const int num);
+extern const byte *R_BrightmapForState (const int state);
+
+// [AP] shared by every unlit texel, drawers check for it to skip the lookup
+extern const byte nobrightmap[256];
 
 extern const byte **texturebrightmap;
 
@@ -19,12 +19,16 @@
 
 
 
+#include <string.h>
+
 #include "doomdef.h"
 
 #include "m_bbox.h"
 
 #include "i_system.h"
 
+#include "p_local.h" // [AP] movingsectors
+
 #include "r_main.h"
 #include "r_plane.h"
 #include "r_things.h"
@@ -91,6 +95,81 @@ typedef	struct
 cliprange_t*	newend;
 cliprange_t	solidsegs[MAXSEGS];
 
+// [AP] The columns covered by solidsegs as a bitmap, one bit per column,
+// plus one summary bit per fully covered 32-column word. R_CheckBBox
+// tests a span with a few word compares instead of walking the clip
+// list; solidsegs remains the authoritative structure for wall clipping.
+#define SOLIDCOLWORDS ((MAXWIDTH + 31) / 32)
+static uint32_t	solidcols[SOLIDCOLWORDS];
+static uint32_t	solidcolwords[(SOLIDCOLWORDS + 31) / 32];
+
+static void R_MarkSolidColumns (int first, int last)
+{
+    int w, w1, w2;
+
+    if (first < 0)
+	first = 0;
+    if (last > viewwidth - 1)
+	last = viewwidth - 1;
+    if (first > last)
+	return;
+
+    w1 = first >> 5;
+    w2 = last >> 5;
+
+    for (w = w1; w <= w2; w++)
+    {
+	uint32_t mask = ~0u;
+
+	if (w == w1)
+	    mask &= ~0u << (first & 31);
+	if (w == w2)
+	    mask &= ~0u >> (31 - (last & 31));
+
+	solidcols[w] |= mask;
+
+	if (solidcols[w] == ~0u)
+	    solidcolwords[w >> 5] |= 1u << (w & 31);
+    }
+}
+
+// true if every bit from first to last is set
+static boolean R_AllBitsSet (const uint32_t *bits, int first, int last)
+{
+    const int w1 = first >> 5;
+    const int w2 = last >> 5;
+    const uint32_t m1 = ~0u << (first & 31);
+    const uint32_t m2 = ~0u >> (31 - (last & 31));
+    int w;
+
+    if (w1 == w2)
+	return (bits[w1] & m1 & m2) == (m1 & m2);
+
+    if ((bits[w1] & m1) != m1 || (bits[w2] & m2) != m2)
+	return false;
+
+    for (w = w1 + 1; w < w2; w++)
+	if (bits[w] != ~0u)
+	    return false;
+
+    return true;
+}
+
+// true if solidsegs cover every column from first to last
+static boolean R_SolidColumns (int first, int last)
+{
+    const int w1 = first >> 5;
+    const int w2 = last >> 5;
+
+    if (w2 - w1 < 2)
+	return R_AllBitsSet(solidcols, first, last);
+
+    // edge words by mask, the whole words between through the summary
+    return R_AllBitsSet(solidcols, first, (w1 << 5) + 31)
+        && R_AllBitsSet(solidcols, w2 << 5, last)
+        && R_AllBitsSet(solidcolwords, w1 + 1, w2 - 1);
+}
+
 
 
 
@@ -108,6 +187,8 @@ R_ClipSolidWallSegment
     cliprange_t*	next;
     cliprange_t*	start;
 
+    R_MarkSolidColumns (first, last); // [AP]
+
     // Find the first range that touches the range
     //  (adjacent pixels are touching).
     start = solidsegs;
@@ -249,10 +330,13 @@ void R_ClearClipSegs (void)
     solidsegs[1].first = viewwidth;
     solidsegs[1].last = 0x7fffffff;
     newend = solidsegs+2;
+
+    memset(solidcols, 0, sizeof(solidcols)); // [AP]
+    memset(solidcolwords, 0, sizeof(solidcolwords));
 }
 
 // [AM] Interpolate the passed sector, if prudent.
-void R_MaybeInterpolateSector(sector_t* sector)
+static void R_MaybeInterpolateSector(sector_t* sector)
 {
     if (crispy->uncapped &&
         // Only if we moved the sector last tic ...
@@ -277,6 +361,21 @@ void R_MaybeInterpolateSector(sector_t* sector)
     }
 }
 
+//
+// R_InterpolateMovingSectors
+// [AP] Once per frame, for only the sectors that moved last tic. Every
+//  other sector already has its interpolated heights equal to the real ones.
+//
+void R_InterpolateMovingSectors (void)
+{
+    int i;
+
+    for (i = 0; i < nummovingsectors; i++)
+    {
+	R_MaybeInterpolateSector(movingsectors[i]);
+    }
+}
+
 //
 // R_AddLine
 // Clips the given segment
@@ -350,11 +449,6 @@ void R_AddLine (seg_t*	line)
     if (!backsector)
 	goto clipsolid;		
 
-    // [AM] Interpolate sector movement before
-    //      running clipping tests.  Frontsector
-    //      should already be interpolated.
-    R_MaybeInterpolateSector(backsector);
-
     // Closed door.
     if (backsector->interpceilingheight <= frontsector->interpfloorheight
 	|| backsector->interpfloorheight >= frontsector->interpceilingheight)
@@ -426,8 +520,6 @@ boolean R_CheckBBox (fixed_t*	bspcoord)
     angle_t		span;
     angle_t		tspan;
     
-    cliprange_t*	start;
-
     int			sx1;
     int			sx2;
     
@@ -504,12 +596,8 @@ boolean R_CheckBBox (fixed_t*	bspcoord)
 	return false;			
     sx2--;
 	
-    start = solidsegs;
-    while (start->last < sx2)
-	start++;
-    
-    if (sx1 >= start->first
-	&& sx2 <= start->last)
+    // [AP] Covered solid columns, instead of walking solidsegs.
+    if (R_SolidColumns(sx1, sx2))
     {
 	// The clippost contains the new span.
 	return false;
@@ -545,10 +633,6 @@ void R_Subsector (int num)
     count = sub->numlines;
     line = &segs[sub->firstline];
 
-    // [AM] Interpolate sector movement.  Usually only needed
-    //      when you're standing inside the sector.
-    R_MaybeInterpolateSector(frontsector);
-
     if (frontsector->interpfloorheight < viewz)
     {
 	floorplane = R_FindPlane(frontsector->interpfloorheight,
@@ -57,6 +57,7 @@ void R_ClearDrawSegs (void);
 
 
 void R_RenderBSPNode (int bspnum);
+void R_InterpolateMovingSectors (void); // [AP]
 
 
 #endif
@@ -29,6 +29,9 @@
 #include "w_wad.h"
 
 #include "doomdef.h"
+#include "m_argv.h"
+#include "m_config.h" // [AP] configdir
+#include "m_memory.h" // [AP] M_LowMemory()
 #include "m_misc.h"
 #include "r_local.h"
 #include "p_local.h"
@@ -158,14 +161,28 @@ byte**			texturecomposite; // [crispy] composited translucent mid-textures on 2S
 byte**			texturecomposite2; // [crispy] composited opaque textures
 const byte**	texturebrightmap; // [crispy] brightmaps
 
+// [AP] The opaque runs of every column of a composite, decoded from its
+// posts when it's built: int first[width + 1] indices into the
+// maskedrun_t array that follows. Freed along with the composites.
+static byte**		texturemaskedruns;
+
+// [AP] Composite texture cache. The composites are allocated PU_STATIC
+// so an unrelated Z_Malloc can never purge them; R_CacheComposite evicts
+// the least recently used ones itself once the byte budget is exceeded.
+#define TEXCACHE_DEFAULT_MB	32
+#define TEXCACHE_LOWMEM_MB	8
+static int*		texturecachestamp; // framecount of last R_GetColumn use
+static size_t		texturecachebytes;
+static size_t		texturecachebudget;
+unsigned int		texturecachehits;
+unsigned int		texturecachemisses;
+
 // for global animation
 int*		flattranslation;
 int*		texturetranslation;
 
 // needed for pre rendering
-fixed_t*	spritewidth;	
-fixed_t*	spriteoffset;
-fixed_t*	spritetopoffset;
+spritemetrics_t*	spritemetrics; // [AP] width, offset and top offset
 
 lighttable_t	*colormaps;
 
@@ -272,6 +289,9 @@ void R_GenerateComposite (int texnum)
     unsigned*		colofs, *colofs2; // killough 4/9/98: make 32-bit
     byte*		marks; // killough 4/9/98: transparency marks
     byte*		source; // killough 4/9/98: temporary column
+    maskedrun_t*	runs = NULL; // [AP] decoded posts of all columns
+    int*		firstrun;
+    int			numruns = 0, maxruns = 0;
 	
     texture = textures[texnum];
 
@@ -336,8 +356,11 @@ void R_GenerateComposite (int texnum)
     // to fix Medusa bug while still allowing for transparent regions.
 
     source = I_Realloc(NULL, texture->height); // temporary column
+    firstrun = I_Realloc(NULL, (texture->width + 1) * sizeof(*firstrun));
     for (i = 0; i < texture->width; i++)
     {
+	firstrun[i] = numruns;
+
 	// [crispy] generate composites for all columns
 //	if (collump[i] == -1) // process only multipatched columns
 	{
@@ -384,6 +407,20 @@ void R_GenerateComposite (int texnum)
 
 		col->length = len; // killough 12/98: intentionally truncate length
 
+		// [AP] the same post, with its top no longer relative
+		if (len > 0)
+		{
+		    if (numruns == maxruns)
+		    {
+			maxruns = maxruns ? 2 * maxruns : 2 * texture->width;
+			runs = I_Realloc(runs, maxruns * sizeof(*runs));
+		    }
+
+		    runs[numruns].top = abstop;
+		    runs[numruns].length = len;
+		    numruns++;
+		}
+
 		// copy opaque cells from the temporary back into the column
 		memcpy((byte *) col + 3, source + abstop, len);
 		col = (column_t *)((byte *) col + len + 4); // next post
@@ -394,10 +431,85 @@ void R_GenerateComposite (int texnum)
     free(source); // free temporary column
     free(marks); // free transparency marks
 
-    // Now that the texture has been built in column cache,
-    //  it is purgable from zone memory.
-    Z_ChangeTag (block, PU_CACHE);
-    Z_ChangeTag (block2, PU_CACHE);
+    // [AP] one block for the run table, sized now that it's known
+    firstrun[texture->width] = numruns;
+    texturemaskedruns[texnum] = Z_Malloc((texture->width + 1) * sizeof(*firstrun)
+                                         + numruns * sizeof(*runs),
+                                         PU_STATIC, &texturemaskedruns[texnum]);
+    memcpy(texturemaskedruns[texnum], firstrun, (texture->width + 1) * sizeof(*firstrun));
+    if (numruns > 0)
+	memcpy(texturemaskedruns[texnum] + (texture->width + 1) * sizeof(*firstrun),
+	       runs, numruns * sizeof(*runs));
+
+    free(firstrun);
+    free(runs);
+
+    // [AP] The texture stays PU_STATIC, R_EvictComposites
+    //  releases it when the cache budget needs the space.
+}
+
+// [AP] bytes held by both composites of a texture and its run table,
+//  if that's been built
+static size_t R_CompositeSize (int texnum)
+{
+    const int width = textures[texnum]->width;
+    size_t size = texturecompositesize[texnum] + width * textures[texnum]->height;
+
+    if (texturemaskedruns[texnum])
+    {
+	const int *firstrun = (const int *) texturemaskedruns[texnum];
+
+	size += (width + 1) * sizeof(*firstrun) + firstrun[width] * sizeof(maskedrun_t);
+    }
+
+    return size;
+}
+
+//
+// R_EvictComposites
+// Frees the least recently used composites until "needed" more bytes
+//  fit into the cache budget. Textures used in the current frame are
+//  kept, their columns may still be referenced by the drawers.
+//
+static void R_EvictComposites (size_t needed)
+{
+    while (texturecachebytes + needed > texturecachebudget)
+    {
+	int	i;
+	int	oldest = -1;
+
+	for (i = 0; i < numtextures; i++)
+	{
+	    if (texturecomposite2[i] && texturecachestamp[i] < framecount
+	        && (oldest < 0 || texturecachestamp[i] < texturecachestamp[oldest]))
+	    {
+		oldest = i;
+	    }
+	}
+
+	if (oldest < 0)
+	    break;
+
+	texturecachebytes -= R_CompositeSize(oldest);
+
+	// Z_Free clears the texturecomposite pointers through the block user
+	Z_Free(texturecomposite[oldest]);
+	Z_Free(texturecomposite2[oldest]);
+	Z_Free(texturemaskedruns[oldest]);
+    }
+}
+
+//
+// R_CacheComposite
+//
+static void R_CacheComposite (int texnum)
+{
+    texturecachemisses++;
+
+    // the run table is small next to the composites, it's counted once built
+    R_EvictComposites(R_CompositeSize(texnum));
+    R_GenerateComposite(texnum);
+    texturecachebytes += R_CompositeSize(texnum);
 }
 
 
@@ -429,6 +541,7 @@ void R_GenerateLookup (int texnum)
     // Composited texture not created yet.
     texturecomposite[texnum] = 0;
     texturecomposite2[texnum] = 0;
+    texturemaskedruns[texnum] = 0; // [AP]
     
     texturecompositesize[texnum] = 0;
     collump = texturecolumnlump[texnum];
@@ -605,11 +718,35 @@ R_GetColumn
     ofs = texturecolumnofs2[tex][col];
 
     if (!texturecomposite2[tex])
-	R_GenerateComposite (tex);
+	R_CacheComposite (tex);
+    else
+	texturecachehits++;
+
+    texturecachestamp[tex] = framecount;
 
     return texturecomposite2[tex] + ofs;
 }
 
+// [AP] The composite is stamped with this frame, so the cache won't
+// evict it before the frame is done.
+byte*
+R_GetColumnTable
+( int		tex,
+  const unsigned**	ofs,
+  int*		mask )
+{
+    if (!texturecomposite2[tex])
+	R_CacheComposite (tex);
+    else
+	texturecachehits++;
+
+    texturecachestamp[tex] = framecount;
+
+    *ofs = texturecolumnofs2[tex];
+    *mask = texturewidthmask[tex];
+    return texturecomposite2[tex];
+}
+
 // [crispy] wrapping column getter function for composited translucent mid-textures on 2S walls
 byte*
 R_GetColumnMod
@@ -625,11 +762,46 @@ R_GetColumnMod
     ofs = texturecolumnofs[tex][col];
 
     if (!texturecomposite[tex])
-	R_GenerateComposite (tex);
+	R_CacheComposite (tex);
+    else
+	texturecachehits++;
+
+    texturecachestamp[tex] = framecount;
 
     return texturecomposite[tex] + ofs;
 }
 
+// [AP] The opaque runs of a column, wrapping like R_GetColumnMod. Each
+// run's pixels are at *source + top: the opaque composite holds every
+// column whole.
+const maskedrun_t*
+R_GetMaskedRuns
+( int		tex,
+  int		col,
+  int*		count,
+  byte**	source )
+{
+    const int*	firstrun;
+
+    while (col < 0)
+	col += texturewidth[tex];
+
+    col %= texturewidth[tex];
+
+    if (!texturecomposite2[tex])
+	R_CacheComposite (tex);
+    else
+	texturecachehits++;
+
+    texturecachestamp[tex] = framecount;
+
+    firstrun = (const int *) texturemaskedruns[tex];
+    *count = firstrun[col + 1] - firstrun[col];
+    *source = texturecomposite2[tex] + texturecolumnofs2[tex][col];
+
+    return (const maskedrun_t *) (firstrun + texturewidth[tex] + 1) + firstrun[col];
+}
+
 
 static void GenerateTextureHashTable(void)
 {
@@ -864,6 +1036,7 @@ void R_InitTextures (void)
     texturecolumnofs2 = Z_Malloc (numtextures * sizeof(*texturecolumnofs2), PU_STATIC, 0);
     texturecomposite = Z_Malloc (numtextures * sizeof(*texturecomposite), PU_STATIC, 0);
     texturecomposite2 = Z_Malloc (numtextures * sizeof(*texturecomposite2), PU_STATIC, 0);
+    texturemaskedruns = Z_Malloc (numtextures * sizeof(*texturemaskedruns), PU_STATIC, 0); // [AP]
     texturecompositesize = Z_Malloc (numtextures * sizeof(*texturecompositesize), PU_STATIC, 0);
     texturewidthmask = Z_Malloc (numtextures * sizeof(*texturewidthmask), PU_STATIC, 0);
     texturewidth = Z_Malloc (numtextures * sizeof(*texturewidth), PU_STATIC, 0);
@@ -1032,9 +1205,7 @@ void R_InitSpriteLumps (void)
     lastspritelump = W_GetNumForName (DEH_String("S_END")) - 1;
     
     numspritelumps = lastspritelump - firstspritelump + 1;
-    spritewidth = Z_Malloc (numspritelumps*sizeof(*spritewidth), PU_STATIC, 0);
-    spriteoffset = Z_Malloc (numspritelumps*sizeof(*spriteoffset), PU_STATIC, 0);
-    spritetopoffset = Z_Malloc (numspritelumps*sizeof(*spritetopoffset), PU_STATIC, 0);
+    spritemetrics = Z_Malloc (numspritelumps*sizeof(*spritemetrics), PU_STATIC, 0);
 	
     for (i=0 ; i< numspritelumps ; i++)
     {
@@ -1042,9 +1213,9 @@ void R_InitSpriteLumps (void)
 	    printf (".");
 
 	patch = W_CacheLumpNum (firstspritelump+i, PU_CACHE);
-	spritewidth[i] = SHORT(patch->width)<<FRACBITS;
-	spriteoffset[i] = SHORT(patch->leftoffset)<<FRACBITS;
-	spritetopoffset[i] = SHORT(patch->topoffset)<<FRACBITS;
+	spritemetrics[i].width = SHORT(patch->width)<<FRACBITS;
+	spritemetrics[i].offset = SHORT(patch->leftoffset)<<FRACBITS;
+	spritemetrics[i].topoffset = SHORT(patch->topoffset)<<FRACBITS;
     }
 }
 
@@ -1058,6 +1229,73 @@ enum {
 
 static const int tran_filter_pct = 66;
 
+// [AP] A computed map is kept in the config directory, after the PLAYPAL
+// and filter percentage it was made from, so that only the first launch
+// with a given palette pays for the 64K nearest color searches.
+
+#define TRANMAP_CACHE_NAME "tranmap.dat"
+#define TRANMAP_CACHE_SIZE (256*3 + 1 + 256*256)
+
+static char *TranMapCachePath(void)
+{
+    return configdir != NULL
+         ? M_StringJoin(configdir, TRANMAP_CACHE_NAME, NULL) : NULL;
+}
+
+static boolean R_LoadCachedTranMap(const byte *playpal)
+{
+    char *path = TranMapCachePath();
+    byte header[256*3 + 1];
+    boolean result = false;
+    FILE *f;
+
+    if (path == NULL)
+    {
+        return false;
+    }
+
+    f = M_fopen(path, "rb");
+    free(path);
+
+    if (f == NULL)
+    {
+        return false;
+    }
+
+    if (M_FileLength(f) == TRANMAP_CACHE_SIZE
+     && fread(header, 1, sizeof(header), f) == sizeof(header)
+     && !memcmp(header, playpal, 256*3)
+     && header[256*3] == tran_filter_pct
+     && fread(tranmap, 1, 256*256, f) == 256*256)
+    {
+        result = true;
+    }
+
+    fclose(f);
+    return result;
+}
+
+static void R_SaveCachedTranMap(const byte *playpal)
+{
+    char *path = TranMapCachePath();
+    byte *data;
+
+    if (path == NULL)
+    {
+        return;
+    }
+
+    data = Z_Malloc(TRANMAP_CACHE_SIZE, PU_STATIC, 0);
+    memcpy(data, playpal, 256*3);
+    data[256*3] = tran_filter_pct;
+    memcpy(data + 256*3 + 1, tranmap, 256*256);
+
+    M_WriteFile(path, data, TRANMAP_CACHE_SIZE);
+
+    Z_Free(data);
+    free(path);
+}
+
 static void R_InitTranMap()
 {
     int lump = W_CheckNumForName("TRANMAP");
@@ -1076,6 +1314,7 @@ static void R_InitTranMap()
 	unsigned char *playpal = W_CacheLumpName("PLAYPAL", PU_STATIC);
 
 	tranmap = Z_Malloc(256*256, PU_STATIC, 0);
+	if (!R_LoadCachedTranMap(playpal))
 	{
 	    byte *fg, *bg, blend[3], *tp = tranmap;
 	    int i, j, btmp;
@@ -1108,6 +1347,8 @@ static void R_InitTranMap()
 		    *tp++ = V_GetPaletteIndex(playpal, blend[r], blend[g], blend[b]);
 		}
 	    }
+
+	    R_SaveCachedTranMap(playpal);
 	}
 
 	printf(".");
@@ -1151,15 +1392,28 @@ void R_InitColormaps (void)
 
 	if (crispy->truecolor)
 	{
+		// [AP] c / NUMCOLORMAPS is exact in binary, so blending in integers
+		// gives the same bytes as the float math did. The gamma corrected
+		// palette is looked up once instead of for every light level.
+		const byte *const gamma = gamma2table[usegamma];
+		const int black = gamma[0];
+		int pal[3 * 256];
+
+		for (i = 0; i < 3 * 256; i++)
+		{
+			pal[i] = gamma[playpal[i]];
+		}
+
 		for (c = 0; c < NUMCOLORMAPS; c++)
 		{
-			const float scale = 1. * c / NUMCOLORMAPS;
+			const int keep = NUMCOLORMAPS - c;
+			const int fade = black * c;
 
 			for (i = 0; i < 256; i++)
 			{
-				r = gamma2table[usegamma][playpal[3 * i + 0]] * (1. - scale) + gamma2table[usegamma][0] * scale;
-				g = gamma2table[usegamma][playpal[3 * i + 1]] * (1. - scale) + gamma2table[usegamma][0] * scale;
-				b = gamma2table[usegamma][playpal[3 * i + 2]] * (1. - scale) + gamma2table[usegamma][0] * scale;
+				r = (pal[3 * i + 0] * keep + fade) / NUMCOLORMAPS;
+				g = (pal[3 * i + 1] * keep + fade) / NUMCOLORMAPS;
+				b = (pal[3 * i + 2] * keep + fade) / NUMCOLORMAPS;
 
 				colormaps[j++] = 0xff000000 | (r << 16) | (g << 8) | b;
 			}
@@ -1197,6 +1451,8 @@ void R_InitColormaps (void)
 	}
 #endif
 
+    R_ClearSkyCache();
+
     // [crispy] initialize color translation and color strings tables
     {
 	byte *playpal = W_CacheLumpName("PLAYPAL", PU_STATIC);
@@ -1231,6 +1487,73 @@ void R_InitColormaps (void)
 
 
 
+static size_t R_TextureCacheBytes (void)
+{
+    return texturecachebytes;
+}
+
+// [AP] Frees every composite, for between levels in the low memory
+//  profile. Nothing is being drawn then.
+static void R_PurgeComposites (void)
+{
+    int i;
+
+    for (i = 0; i < numtextures; i++)
+    {
+	if (texturecomposite2[i])
+	{
+	    texturecachebytes -= R_CompositeSize(i);
+	    Z_Free(texturecomposite[i]);
+	    Z_Free(texturecomposite2[i]);
+	    Z_Free(texturemaskedruns[i]);
+	}
+    }
+}
+
+//
+// R_InitTextureCache
+// [AP] Sets up the composite texture cache budget.
+//
+static void R_InitTextureCache (void)
+{
+    static boolean reported = false;
+    int i;
+
+    texturecachestamp = Z_Malloc(numtextures * sizeof(*texturecachestamp), PU_STATIC, 0);
+
+    for (i = 0; i < numtextures; i++)
+    {
+	texturecachestamp[i] = -1;
+    }
+
+    texturecachebudget = (size_t) (M_LowMemory() ? TEXCACHE_LOWMEM_MB
+                                                 : TEXCACHE_DEFAULT_MB) << 20;
+
+    //!
+    // @arg <mb>
+    // @category video
+    //
+    // Size of the composite texture cache in MiB (default 32, or 8 with
+    // -lowmem).
+    //
+
+    i = M_CheckParmWithArgs("-texcache", 1);
+
+    if (i > 0 && atoi(myargv[i + 1]) > 0)
+    {
+	texturecachebudget = (size_t) atoi(myargv[i + 1]) << 20;
+    }
+
+    texturecachebytes = texturecachehits = texturecachemisses = 0;
+
+    if (!reported)
+    {
+	M_AddMemoryUser("texture composites", R_TextureCacheBytes,
+	                R_PurgeComposites);
+	reported = true;
+    }
+}
+
 //
 // R_InitData
 // Locates all the lumps
@@ -1247,6 +1570,7 @@ void R_InitData (void)
     R_InitFlats ();
     R_InitBrightmaps ();
     R_InitTextures ();
+    R_InitTextureCache (); // [AP]
     printf (".");
 //  R_InitFlats (); [crispy] moved ...
     printf (".");
@@ -1354,6 +1678,22 @@ int		flatmemory;
 int		texturememory;
 int		spritememory;
 
+// [AP] lumps gathered by R_PrecacheLevel before they are read
+static int*	precachelumps;
+static int	numprecachelumps;
+static int	maxprecachelumps;
+
+static void R_AddPrecacheLump (int lump)
+{
+    if (numprecachelumps == maxprecachelumps)
+    {
+	maxprecachelumps = maxprecachelumps ? 2 * maxprecachelumps : 1024;
+	precachelumps = I_Realloc(precachelumps, maxprecachelumps * sizeof(*precachelumps));
+    }
+
+    precachelumps[numprecachelumps++] = lump;
+}
+
 void R_PrecacheLevel (void)
 {
     char*		flatpresent;
@@ -1367,10 +1707,13 @@ void R_PrecacheLevel (void)
     
     texture_t*		texture;
     thinker_t*		th;
+    int			last;
     spriteframe_t*	sf;
 
     if (demoplayback)
 	return;
+
+    numprecachelumps = 0;
     
     // Precache flats.
     flatpresent = Z_Malloc(numflats, PU_STATIC, NULL);
@@ -1390,7 +1733,7 @@ void R_PrecacheLevel (void)
 	{
 	    lump = firstflat + i;
 	    flatmemory += lumpinfo[lump]->size;
-	    W_CacheLumpNum(lump, PU_CACHE);
+	    R_AddPrecacheLump(lump);
 	}
     }
 
@@ -1421,21 +1764,16 @@ void R_PrecacheLevel (void)
 	if (!texturepresent[i])
 	    continue;
 
-	// [crispy] precache composite textures
-	R_GenerateComposite(i);
-
 	texture = textures[i];
 	
 	for (j=0 ; j<texture->patchcount ; j++)
 	{
 	    lump = texture->patches[j].patch;
 	    texturememory += lumpinfo[lump]->size;
-	    W_CacheLumpNum(lump , PU_CACHE);
+	    R_AddPrecacheLump(lump);
 	}
     }
 
-    Z_Free(texturepresent);
-    
     // Precache sprites.
     spritepresent = Z_Malloc(numsprites, PU_STATIC, NULL);
     memset (spritepresent,0, numsprites);
@@ -1459,12 +1797,36 @@ void R_PrecacheLevel (void)
 	    {
 		lump = firstspritelump + sf->lump[k];
 		spritememory += lumpinfo[lump]->size;
-		W_CacheLumpNum(lump , PU_CACHE);
+		R_AddPrecacheLump(lump);
 	    }
 	}
     }
 
     Z_Free(spritepresent);
+
+    // [AP] Read everything in file order, so the level loads with one
+    //  forward sweep over each WAD instead of a seek per lump.
+    //  The hints let the disk get ahead of the reads.
+    W_SortLumps(precachelumps, numprecachelumps);
+    W_PrefetchLumps(precachelumps, numprecachelumps);
+
+    for (i = 0, last = -1; i < numprecachelumps; i++)
+    {
+	if (precachelumps[i] != last)
+	{
+	    last = precachelumps[i];
+	    W_CacheLumpNum(last, PU_CACHE);
+	}
+    }
+
+    // [crispy] precache composite textures, after their patches are in
+    for (i=0 ; i<numtextures ; i++)
+    {
+	if (texturepresent[i] && !texturecomposite2[i])
+	    R_CacheComposite(i);
+    }
+
+    Z_Free(texturepresent);
 }
 
 
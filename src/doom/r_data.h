@@ -40,6 +40,36 @@ R_GetColumnMod
 ( int		tex,
   int		col );
 
+// [AP] What R_GetColumn looks up, for callers that fetch many columns of
+// one texture: column col is at composite + ofs[col & mask]. Valid until
+// the end of the frame.
+byte*
+R_GetColumnTable
+( int		tex,
+  const unsigned**	ofs,
+  int*		mask );
+
+// [AP] An opaque run of a masked column, from texel top down.
+typedef struct
+{
+    unsigned short	top;
+    unsigned short	length;
+} maskedrun_t;
+
+// [AP] The posts of a column of a composited mid-texture, decoded once
+// when the composite is built. *source is the whole column of texels.
+// Valid until the end of the frame.
+const maskedrun_t*
+R_GetMaskedRuns
+( int		tex,
+  int		col,
+  int*		count,
+  byte**	source );
+
+
+// [AP] composite texture cache statistics
+extern unsigned int texturecachehits;
+extern unsigned int texturecachemisses;
 
 // I/O, setting up the stuff.
 void R_InitData (void);
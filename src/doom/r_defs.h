@@ -451,9 +451,27 @@ typedef struct
 
     // Flip bit (1 = flip) to use for view angles 0-7.
     byte	flip[16]; // [crispy] support 16 sprite rotations
+
+    // [AP] Lump and flip for each 1/32 turn around the thing, worked
+    // out once from the above for whichever number of rotations the
+    // frame has, so R_ProjectSprite looks its patch up in one go.
+    struct
+    {
+	short	lump;
+	byte	flip;
+    } view[32];
     
 } spriteframe_t;
 
+// [AP] A sprite lump's header figures, kept together so projecting a
+// sprite reads them from one place instead of three arrays.
+typedef struct
+{
+    fixed_t	width;
+    fixed_t	offset;
+    fixed_t	topoffset;
+} spritemetrics_t;
+
 
 
 //
@@ -479,6 +497,7 @@ typedef struct
   int			lightlevel;
   int			minx;
   int			maxx;
+  int			hashnext; // [AP] next visplane index in R_FindPlane's chain, -1 ends it
   
   // leave pads for [minx-1]/[maxx+1]
   
@@ -25,14 +25,17 @@
 #include "deh_main.h"
 
 #include "i_system.h"
+#include "i_video.h" // [AP] usegamma
 #include "z_zone.h"
 #include "w_wad.h"
 
 #include "r_local.h"
+#include "r_kernels.h"
 
 // Needs access to LFB (guess what).
 #include "v_video.h"
 #include "v_trans.h"
+#include "r_bmaps.h" // [AP] nobrightmap
 
 // State.
 #include "doomstat.h"
@@ -63,6 +66,10 @@ int		viewwindowx;
 int		viewwindowy; 
 pixel_t*		ylookup[MAXHEIGHT];
 int		columnofs[MAXWIDTH]; 
+// [AP] columnofs with the flipped level mirroring already applied, and
+// the step from one column to the next, -1 when mirrored
+static int	flipcolumnofs[MAXWIDTH];
+static int	flipstep = 1;
 
 // Color tables for different players,
 //  translate a limited part to another
@@ -104,81 +111,73 @@ int			dccount;
 // [crispy] replace R_DrawColumn() with Lee Killough's implementation
 // found in MBF to fix Tutti-Frutti, taken from mbfsrc/R_DRAW.C:99-1979
 
-void R_DrawColumn (void) 
-{ 
-    int			count; 
-    pixel_t*		dest;
-    fixed_t		frac;
-    fixed_t		fracstep;	 
-    int			heightmask = dc_texheight - 1;
- 
-    count = dc_yh - dc_yl; 
-
-    // Zero length, column does not exceed a pixel.
-    if (count < 0) 
-	return; 
-				 
-#ifdef RANGECHECK 
-    if ((unsigned)dc_x >= SCREENWIDTH
-	|| dc_yl < 0
-	|| dc_yh >= SCREENHEIGHT) 
-	I_Error ("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x); 
-#endif 
+// [AP] The loops themselves are shared with the other games, see
+// r_kernels.h.
+static void R_SetupColumn (r_column_t *column, const int x)
+{
+    column->dest = ylookup[dc_yl] + flipcolumnofs[x];
+    column->pitch = SCREENWIDTH;
+    column->count = dc_yh - dc_yl + 1;
+    column->source = dc_source;
+    column->fracstep = dc_iscale;
+    column->frac = dc_texturemid + (dc_yl-centery)*dc_iscale;
+    column->texheight = dc_texheight;
+    column->colormap[0] = dc_colormap[0];
+    column->colormap[1] = dc_colormap[1];
+    column->brightmap = dc_brightmap == nobrightmap ? NULL : dc_brightmap;
+    column->translation = NULL;
+    column->blend = NULL;
+    column->blendswap = false;
+    column->twin = 0;
+}
 
-    // Framebuffer destination address.
-    // Use ylookup LUT to avoid multiply with ScreenWidth.
-    // Use columnofs LUT for subwindows? 
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[dc_x]];
+void R_DrawPrelitColumn (const pixel_t *source)
+{
+    int			count;
+    pixel_t*		dest;
+    const int		pitch = SCREENWIDTH;
 
-    // Determine scaling,
-    //  which is the only mapping to be done.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
+    count = dc_yh - dc_yl;
 
-    // Inner loop that does the actual texture mapping,
-    //  e.g. a DDA-lile scaling.
-    // This is as fast as it gets.
+    if (count < 0)
+	return;
 
-  // heightmask is the Tutti-Frutti fix -- killough
-  if (dc_texheight & heightmask) // not a power of 2 -- killough
-  {
-    heightmask++;
-    heightmask <<= FRACBITS;
+#ifdef RANGECHECK
+    if ((unsigned)dc_x >= SCREENWIDTH
+	|| dc_yl < 0
+	|| dc_yh >= SCREENHEIGHT)
+	I_Error ("R_DrawPrelitColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
+#endif
 
-    if (frac < 0)
-	while ((frac += heightmask) < 0);
-    else
-	while (frac >= heightmask)
-	    frac -= heightmask;
+    dest = ylookup[dc_yl] + flipcolumnofs[dc_x];
+    source += dc_yl;
 
     do
     {
-	// [crispy] brightmaps
-	const byte source = dc_source[frac>>FRACBITS];
-	*dest = dc_colormap[dc_brightmap[source]][source];
-
-	dest += SCREENWIDTH;
-	if ((frac += fracstep) >= heightmask)
-	    frac -= heightmask;
+	*dest = *source++;
+	dest += pitch;
     } while (count--);
-  }
-  else // texture height is a power of 2 -- killough
-  {
-    do 
-    {
-	// Re-map color indices from wall texture column
-	//  using a lighting/special effects LUT.
-	// [crispy] brightmaps
-	const byte source = dc_source[(frac>>FRACBITS)&heightmask];
-	*dest = dc_colormap[dc_brightmap[source]][source];
-	
-	dest += SCREENWIDTH; 
-	frac += fracstep;
-	
-    } while (count--); 
-  }
-} 
+}
 
+void R_DrawColumn (void)
+{
+    r_column_t		column;
+
+    // Zero length, column does not exceed a pixel.
+    if (dc_yh < dc_yl)
+	return;
+
+#ifdef RANGECHECK
+    if ((unsigned)dc_x >= SCREENWIDTH
+	|| dc_yl < 0
+	|| dc_yh >= SCREENHEIGHT)
+	I_Error ("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
+#endif
+
+    // [crispy] brightmaps
+    R_SetupColumn(&column, dc_x);
+    R_KernelColumn(&column);
+}
 
 
 // UNUSED.
@@ -242,18 +241,10 @@ void R_DrawColumn (void)
 
 void R_DrawColumnLow (void) 
 { 
-    int			count; 
-    pixel_t*		dest; 
-    pixel_t*		dest2;
-    fixed_t		frac;
-    fixed_t		fracstep;	 
-    int                 x;
-    int			heightmask = dc_texheight - 1;
- 
-    count = dc_yh - dc_yl; 
+    r_column_t		column;
 
     // Zero length.
-    if (count < 0) 
+    if (dc_yh < dc_yl)
 	return; 
 				 
 #ifdef RANGECHECK 
@@ -267,54 +258,10 @@ void R_DrawColumnLow (void)
     //	dccount++; 
 #endif 
     // Blocky mode, need to multiply by 2.
-    x = dc_x << 1;
-    
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[x]];
-    dest2 = ylookup[dc_yl] + columnofs[flipviewwidth[x+1]];
-    
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep;
-    
-  // heightmask is the Tutti-Frutti fix -- killough
-  if (dc_texheight & heightmask) // not a power of 2 -- killough
-  {
-    heightmask++;
-    heightmask <<= FRACBITS;
-
-    if (frac < 0)
-	while ((frac += heightmask) < 0);
-    else
-	while (frac >= heightmask)
-	    frac -= heightmask;
-
-    do
-    {
-	// [crispy] brightmaps
-	const byte source = dc_source[frac>>FRACBITS];
-	*dest2 = *dest = dc_colormap[dc_brightmap[source]][source];
-
-	dest += SCREENWIDTH;
-	dest2 += SCREENWIDTH;
-
-	if ((frac += fracstep) >= heightmask)
-	    frac -= heightmask;
-    } while (count--);
-  }
-  else // texture height is a power of 2 -- killough
-  {
-    do 
-    {
-	// Hack. Does not work corretly.
-	// [crispy] brightmaps
-	const byte source = dc_source[(frac>>FRACBITS)&heightmask];
-	*dest2 = *dest = dc_colormap[dc_brightmap[source]][source];
-	dest += SCREENWIDTH;
-	dest2 += SCREENWIDTH;
-
-	frac += fracstep; 
-
-    } while (count--);
-  }
+    // [crispy] brightmaps
+    R_SetupColumn(&column, dc_x << 1);
+    column.twin = flipstep;
+    R_KernelColumn(&column);
 }
 
 
@@ -354,6 +301,30 @@ void R_SetFuzzPosDraw (void)
 	fuzzpos = fuzzpos_tic;
 }
 
+// [AP] fuzzoffset premultiplied by the pitch, twice in a row, so a run of
+// up to FUZZTABLE pixels starting anywhere in the table needs no wrap.
+static int fuzzstrip[2 * FUZZTABLE];
+static int fuzzstrip_pitch = 0;
+
+static const int *R_FuzzStrip (void)
+{
+    if (fuzzstrip_pitch != SCREENWIDTH)
+    {
+	int i;
+
+	for (i = 0; i < 2 * FUZZTABLE; i++)
+	    fuzzstrip[i] = SCREENWIDTH * fuzzoffset[i % FUZZTABLE];
+	fuzzstrip_pitch = SCREENWIDTH;
+    }
+    return fuzzstrip;
+}
+
+#ifndef CRISPY_TRUECOLOR
+#define FUZZPIXEL(d, o) (colormaps[6*256+(d)[o]])
+#else
+#define FUZZPIXEL(d, o) (I_BlendDark((d)[o], 0xD3))
+#endif
+
 //
 // Framebuffer postprocessing.
 // Creates a fuzzy image by copying pixels
@@ -367,6 +338,8 @@ void R_DrawFuzzColumn (void)
     int			count; 
     pixel_t*		dest;
     boolean		cutoff = false;
+    const int		*strip = R_FuzzStrip();
+    const int		pitch = SCREENWIDTH;
 
     // Adjust borders. Low... 
     if (!dc_yl) 
@@ -394,29 +367,44 @@ void R_DrawFuzzColumn (void)
     }
 #endif
     
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[dc_x]];
+    dest = ylookup[dc_yl] + flipcolumnofs[dc_x];
 
     // Looks like an attempt at dithering,
     //  using the colormap #6 (of 0-31, a bit
     //  brighter than average).
-    do 
+    // [AP] Runs of the premultiplied strip, four pixels a step. The pixels
+    //  stay in order, each one reads the one above after it was fuzzed.
+    count++;
+    while (count > 0)
     {
+	const int run = count < FUZZTABLE ? count : FUZZTABLE;
+	const int *ofs = strip + fuzzpos;
+	int i = 0;
+
 	// Lookup framebuffer, and retrieve
 	//  a pixel that is either one column
 	//  left or right of the current one.
 	// Add index from colormap to index.
-#ifndef CRISPY_TRUECOLOR
-	*dest = colormaps[6*256+dest[SCREENWIDTH*fuzzoffset[fuzzpos]]]; 
-#else
-	*dest = I_BlendDark(dest[SCREENWIDTH*fuzzoffset[fuzzpos]], 0xD3);
-#endif
+	for ( ; i + 4 <= run; i += 4)
+	{
+	    dest[0] = FUZZPIXEL(dest, ofs[i]);
+	    dest[pitch] = FUZZPIXEL(dest + pitch, ofs[i + 1]);
+	    dest[2 * pitch] = FUZZPIXEL(dest + 2 * pitch, ofs[i + 2]);
+	    dest[3 * pitch] = FUZZPIXEL(dest + 3 * pitch, ofs[i + 3]);
+	    dest += 4 * pitch;
+	}
+	for ( ; i < run; i++)
+	{
+	    *dest = FUZZPIXEL(dest, ofs[i]);
+	    dest += pitch;
+	}
 
 	// Clamp table lookup index.
-	if (++fuzzpos == FUZZTABLE) 
-	    fuzzpos = 0;
-	
-	dest += SCREENWIDTH;
-    } while (count--); 
+	fuzzpos += run;
+	if (fuzzpos >= FUZZTABLE)
+	    fuzzpos -= FUZZTABLE;
+	count -= run;
+    }
 
     // [crispy] if the line at the bottom had to be cut off,
     // draw one extra line using only pixels of that line and the one above
@@ -439,6 +427,8 @@ void R_DrawFuzzColumnLow (void)
     pixel_t*		dest2;
     int x;
     boolean		cutoff = false;
+    const int		*strip = R_FuzzStrip();
+    const int		pitch = SCREENWIDTH;
 
     // Adjust borders. Low... 
     if (!dc_yl) 
@@ -470,33 +460,38 @@ void R_DrawFuzzColumnLow (void)
     }
 #endif
     
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[x]];
-    dest2 = ylookup[dc_yl] + columnofs[flipviewwidth[x+1]];
+    dest = ylookup[dc_yl] + flipcolumnofs[x];
+    dest2 = ylookup[dc_yl] + flipcolumnofs[x+1];
 
     // Looks like an attempt at dithering,
     //  using the colormap #6 (of 0-31, a bit
     //  brighter than average).
-    do 
+    // [AP] Same runs as R_DrawFuzzColumn
+    count++;
+    while (count > 0)
     {
+	const int run = count < FUZZTABLE ? count : FUZZTABLE;
+	const int *ofs = strip + fuzzpos;
+	int i;
+
 	// Lookup framebuffer, and retrieve
 	//  a pixel that is either one column
 	//  left or right of the current one.
 	// Add index from colormap to index.
-#ifndef CRISPY_TRUECOLOR
-	*dest = colormaps[6*256+dest[SCREENWIDTH*fuzzoffset[fuzzpos]]];
-	*dest2 = colormaps[6*256+dest2[SCREENWIDTH*fuzzoffset[fuzzpos]]];
-#else
-	*dest = I_BlendDark(dest[SCREENWIDTH*fuzzoffset[fuzzpos]], 0xD3);
-	*dest2 = I_BlendDark(dest2[SCREENWIDTH*fuzzoffset[fuzzpos]], 0xD3);
-#endif
+	for (i = 0; i < run; i++)
+	{
+	    *dest = FUZZPIXEL(dest, ofs[i]);
+	    *dest2 = FUZZPIXEL(dest2, ofs[i]);
+	    dest += pitch;
+	    dest2 += pitch;
+	}
 
 	// Clamp table lookup index.
-	if (++fuzzpos == FUZZTABLE) 
-	    fuzzpos = 0;
-	
-	dest += SCREENWIDTH;
-	dest2 += SCREENWIDTH;
-    } while (count--); 
+	fuzzpos += run;
+	if (fuzzpos >= FUZZTABLE)
+	    fuzzpos -= FUZZTABLE;
+	count -= run;
+    }
 
     // [crispy] if the line at the bottom had to be cut off,
     // draw one extra line using only pixels of that line and the one above
@@ -528,190 +523,133 @@ void R_DrawFuzzColumnLow (void)
 byte*	dc_translation;
 byte*	translationtables;
 
-void R_DrawTranslatedColumn (void) 
-{ 
-    int			count; 
-    pixel_t*		dest;
-    fixed_t		frac;
-    fixed_t		fracstep;	 
- 
-    count = dc_yh - dc_yl; 
-    if (count < 0) 
-	return; 
-				 
-#ifdef RANGECHECK 
-    if ((unsigned)dc_x >= SCREENWIDTH
-	|| dc_yl < 0
-	|| dc_yh >= SCREENHEIGHT)
-    {
-	I_Error ( "R_DrawColumn: %i to %i at %i",
-		  dc_yl, dc_yh, dc_x);
-    }
-    
-#endif 
-
-
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[dc_x]];
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
-
-    // Here we do an additional index re-mapping.
-    do 
-    {
-	// Translation tables are used
-	//  to map certain colorramps to other ones,
-	//  used with PLAY sprites.
-	// Thus the "green" ramp of the player 0 sprite
-	//  is mapped to gray, red, black/indigo. 
-	*dest = dc_colormap[0][dc_translation[dc_source[frac>>FRACBITS]]];
-	dest += SCREENWIDTH;
-	
-	frac += fracstep; 
-    } while (count--); 
-} 
-
-void R_DrawTranslatedColumnLow (void) 
-{ 
-    int			count; 
-    pixel_t*		dest; 
-    pixel_t*		dest2; 
-    fixed_t		frac;
-    fixed_t		fracstep;	 
-    int                 x;
- 
-    count = dc_yh - dc_yl; 
-    if (count < 0) 
-	return; 
-
-    // low detail, need to scale by 2
-    x = dc_x << 1;
-				 
-#ifdef RANGECHECK 
-    if ((unsigned)x >= SCREENWIDTH
-	|| dc_yl < 0
-	|| dc_yh >= SCREENHEIGHT)
+// [AP] The translated and translucent drawers below are all generated
+// from R_DrawMaskedColumnKernel. Each passes constant flags, so every
+// drawer gets its own specialised copy, and in truecolor the blend is
+// chosen once per column instead of calling blendfunc per pixel.
+enum
+{
+    COLBLEND_NONE,
+    COLBLEND_TRANMAP,
+    COLBLEND_OVER,
+    COLBLEND_ADD,
+    COLBLEND_FUNC,
+};
+
+static inline pixel_t R_BlendPixel (const pixel_t bg, const pixel_t fg, const int blend)
+{
+#ifndef CRISPY_TRUECOLOR
+    // actual translucency map lookup taken from boom202s/R_DRAW.C:255
+    return blend == COLBLEND_TRANMAP ? tranmap[(bg<<8)+fg] : fg;
+#else
+    switch (blend)
     {
-	I_Error ( "R_DrawColumn: %i to %i at %i",
-		  dc_yl, dc_yh, x);
+	case COLBLEND_OVER:
+	    return I_BlendOver(bg, fg);
+	case COLBLEND_ADD:
+	    return I_BlendAdd(bg, fg);
+	case COLBLEND_FUNC:
+	    return blendfunc(bg, fg);
+	default:
+	    return fg;
     }
-    
-#endif 
-
-
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[x]];
-    dest2 = ylookup[dc_yl] + columnofs[flipviewwidth[x+1]];
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
-
-    // Here we do an additional index re-mapping.
-    do 
-    {
-	// Translation tables are used
-	//  to map certain colorramps to other ones,
-	//  used with PLAY sprites.
-	// Thus the "green" ramp of the player 0 sprite
-	//  is mapped to gray, red, black/indigo. 
-	*dest = dc_colormap[0][dc_translation[dc_source[frac>>FRACBITS]]];
-	*dest2 = dc_colormap[0][dc_translation[dc_source[frac>>FRACBITS]]];
-	dest += SCREENWIDTH;
-	dest2 += SCREENWIDTH;
-	
-	frac += fracstep; 
-    } while (count--); 
-} 
+#endif
+}
 
-void R_DrawTLColumn (void)
+static inline void R_DrawMaskedColumnKernel (const boolean low,
+                                             const boolean translated,
+                                             const int blend)
 {
     int			count;
     pixel_t*		dest;
+    pixel_t*		dest2;
     fixed_t		frac;
     fixed_t		fracstep;
+    // [AP] Locals, see R_DrawColumn
+    const byte*		source = dc_source;
+    const lighttable_t*	colormap = dc_colormap[0];
+    const byte*		translation = dc_translation;
+    const int		pitch = SCREENWIDTH;
+    // low detail, need to scale by 2
+    const int		x = low ? dc_x << 1 : dc_x;
 
     count = dc_yh - dc_yl;
     if (count < 0)
 	return;
 
 #ifdef RANGECHECK
-    if ((unsigned)dc_x >= SCREENWIDTH
+    if ((unsigned)x >= SCREENWIDTH
 	|| dc_yl < 0
 	|| dc_yh >= SCREENHEIGHT)
     {
 	I_Error ( "R_DrawColumn: %i to %i at %i",
-		  dc_yl, dc_yh, dc_x);
+		  dc_yl, dc_yh, x);
     }
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[dc_x]];
+    dest = ylookup[dc_yl] + flipcolumnofs[x];
+    dest2 = low ? ylookup[dc_yl] + flipcolumnofs[x+1] : NULL;
 
+    // Looks familiar.
     fracstep = dc_iscale;
     frac = dc_texturemid + (dc_yl-centery)*fracstep;
 
     do
     {
-#ifndef CRISPY_TRUECOLOR
-        // actual translucency map lookup taken from boom202s/R_DRAW.C:255
-        *dest = tranmap[(*dest<<8)+dc_colormap[0][dc_source[frac>>FRACBITS]]];
-#else
-        const pixel_t destrgb = dc_colormap[0][dc_source[frac>>FRACBITS]];
-        *dest = blendfunc(*dest, destrgb);
-#endif
-	dest += SCREENWIDTH;
+	// Translation tables are used
+	//  to map certain colorramps to other ones,
+	//  used with PLAY sprites.
+	// Thus the "green" ramp of the player 0 sprite
+	//  is mapped to gray, red, black/indigo.
+	const byte texel = source[frac>>FRACBITS];
+	const pixel_t color = colormap[translated ? translation[texel] : texel];
+
+	*dest = R_BlendPixel(*dest, color, blend);
+	dest += pitch;
+
+	if (low)
+	{
+	    *dest2 = R_BlendPixel(*dest2, color, blend);
+	    dest2 += pitch;
+	}
 
 	frac += fracstep;
     } while (count--);
 }
 
-// [crispy] draw translucent column, low-resolution version
-void R_DrawTLColumnLow (void)
+void R_DrawTranslatedColumn (void)
 {
-    int			count;
-    pixel_t*		dest;
-    pixel_t*		dest2;
-    fixed_t		frac;
-    fixed_t		fracstep;
-    int                 x;
-
-    count = dc_yh - dc_yl;
-    if (count < 0)
-	return;
-
-    x = dc_x << 1;
-
-#ifdef RANGECHECK
-    if ((unsigned)x >= SCREENWIDTH
-	|| dc_yl < 0
-	|| dc_yh >= SCREENHEIGHT)
-    {
-	I_Error ( "R_DrawColumn: %i to %i at %i",
-		  dc_yl, dc_yh, x);
-    }
-#endif
-
-    dest = ylookup[dc_yl] + columnofs[flipviewwidth[x]];
-    dest2 = ylookup[dc_yl] + columnofs[flipviewwidth[x+1]];
+    R_DrawMaskedColumnKernel(false, true, COLBLEND_NONE);
+}
 
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl-centery)*fracstep;
+void R_DrawTranslatedColumnLow (void)
+{
+    R_DrawMaskedColumnKernel(true, true, COLBLEND_NONE);
+}
 
-    do
-    {
+static inline void R_DrawTLColumnKernel (const boolean low)
+{
 #ifndef CRISPY_TRUECOLOR
-	*dest = tranmap[(*dest<<8)+dc_colormap[0][dc_source[frac>>FRACBITS]]];
-	*dest2 = tranmap[(*dest2<<8)+dc_colormap[0][dc_source[frac>>FRACBITS]]];
+    R_DrawMaskedColumnKernel(low, false, COLBLEND_TRANMAP);
 #else
-	const pixel_t destrgb = dc_colormap[0][dc_source[frac>>FRACBITS]];
-	*dest = blendfunc(*dest, destrgb);
-	*dest2 = blendfunc(*dest2, destrgb);
+    if (blendfunc == I_BlendOver)
+	R_DrawMaskedColumnKernel(low, false, COLBLEND_OVER);
+    else if (blendfunc == I_BlendAdd)
+	R_DrawMaskedColumnKernel(low, false, COLBLEND_ADD);
+    else
+	R_DrawMaskedColumnKernel(low, false, COLBLEND_FUNC);
 #endif
-	dest += SCREENWIDTH;
-	dest2 += SCREENWIDTH;
+}
 
-	frac += fracstep;
-    } while (count--);
+void R_DrawTLColumn (void)
+{
+    R_DrawTLColumnKernel(false);
+}
+
+// [crispy] draw translucent column, low-resolution version
+void R_DrawTLColumnLow (void)
+{
+    R_DrawTLColumnKernel(true);
 }
 
 //
@@ -780,15 +718,28 @@ byte*			ds_source;
 int			dscount;
 
 
+// [AP] Shared with the other games like the columns, see R_SetupColumn
+static void R_SetupSpan (r_span_t *span, const int x)
+{
+    span->dest = ylookup[ds_y] + flipcolumnofs[x];
+    span->step = flipstep;
+    span->count = ds_x2 - ds_x1 + 1;
+    span->source = ds_source;
+    span->xfrac = ds_xfrac;
+    span->yfrac = ds_yfrac;
+    span->xstep = ds_xstep;
+    span->ystep = ds_ystep;
+    span->colormap[0] = ds_colormap[0];
+    span->colormap[1] = ds_colormap[1];
+    span->brightmap = ds_brightmap == nobrightmap ? NULL : ds_brightmap;
+    span->twin = 0;
+}
+
 //
 // Draws the actual span.
-void R_DrawSpan (void) 
-{ 
-//  unsigned int position, step;
-    pixel_t *dest;
-    int count;
-    int spot;
-    unsigned int xtemp, ytemp;
+void R_DrawSpan (void)
+{
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1
@@ -802,47 +753,13 @@ void R_DrawSpan (void)
 //	dscount++;
 #endif
 
-    // Pack position and step variables into a single 32-bit integer,
-    // with x in the top 16 bits and y in the bottom 16 bits.  For
-    // each 16-bit part, the top 6 bits are the integer part and the
-    // bottom 10 bits are the fractional part of the pixel position.
-
-/*
-    position = ((ds_xfrac << 10) & 0xffff0000)
-             | ((ds_yfrac >> 6)  & 0x0000ffff);
-    step = ((ds_xstep << 10) & 0xffff0000)
-         | ((ds_ystep >> 6)  & 0x0000ffff);
-*/
-
-//  dest = ylookup[ds_y] + columnofs[ds_x1];
-
-    // We do not check for zero spans here?
-    count = ds_x2 - ds_x1;
-
-    do
-    {
-	byte source;
-	// Calculate current texture index in u,v.
-        // [crispy] fix flats getting more distorted the closer they are to the right
-        ytemp = (ds_yfrac >> 10) & 0x0fc0;
-        xtemp = (ds_xfrac >> 16) & 0x3f;
-        spot = xtemp | ytemp;
-
-	// Lookup pixel from flat texture tile,
-	//  re-index using light/colormap.
-	source = ds_source[spot];
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
-	*dest = ds_colormap[ds_brightmap[source]][source];
-
-//      position += step;
-        ds_xfrac += ds_xstep;
-        ds_yfrac += ds_ystep;
-
-    } while (count--);
+    // Lookup pixel from flat texture tile,
+    //  re-index using light/colormap.
+    R_SetupSpan(&span, ds_x1);
+    R_KernelSpan(&span);
 }
 
 
-
 // UNUSED.
 // Loop unrolled by 4.
 #if 0
@@ -921,11 +838,7 @@ void R_DrawSpan (void)
 //
 void R_DrawSpanLow (void)
 {
-//  unsigned int position, step;
-    unsigned int xtemp, ytemp;
-    pixel_t *dest;
-    int count;
-    int spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1
@@ -939,44 +852,13 @@ void R_DrawSpanLow (void)
 //	dscount++; 
 #endif
 
-/*
-    position = ((ds_xfrac << 10) & 0xffff0000)
-             | ((ds_yfrac >> 6)  & 0x0000ffff);
-    step = ((ds_xstep << 10) & 0xffff0000)
-         | ((ds_ystep >> 6)  & 0x0000ffff);
-*/
-
-    count = (ds_x2 - ds_x1);
-
     // Blocky mode, need to multiply by 2.
-    ds_x1 <<= 1;
-    ds_x2 <<= 1;
-
-//  dest = ylookup[ds_y] + columnofs[ds_x1];
-
-    do
-    {
-	byte source;
-	// Calculate current texture index in u,v.
-        // [crispy] fix flats getting more distorted the closer they are to the right
-        ytemp = (ds_yfrac >> 10) & 0x0fc0;
-        xtemp = (ds_xfrac >> 16) & 0x3f;
-        spot = xtemp | ytemp;
-
-	// Lowres/blocky mode does it twice,
-	//  while scale is adjusted appropriately.
-	source = ds_source[spot];
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
-	*dest = ds_colormap[ds_brightmap[source]][source];
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
-	*dest = ds_colormap[ds_brightmap[source]][source];
-
-//	position += step;
-	ds_xfrac += ds_xstep;
-	ds_yfrac += ds_ystep;
-
-
-    } while (count--);
+    // Lowres/blocky mode does it twice,
+    //  while scale is adjusted appropriately.
+    R_SetupSpan(&span, ds_x1 << 1);
+    span.step = 2 * flipstep;
+    span.twin = flipstep;
+    R_KernelSpan(&span);
 }
 
 void R_DrawSpanSolid (void)
@@ -1000,7 +882,7 @@ void R_DrawSpanSolid (void)
 
     do
     {
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
+	dest = ylookup[ds_y] + flipcolumnofs[ds_x1++];
 	*dest = ds_colormap[ds_brightmap[source]][source];
     } while (count--);
 }
@@ -1030,13 +912,28 @@ void R_DrawSpanSolidLow (void)
 
     do
     {
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
+	dest = ylookup[ds_y] + flipcolumnofs[ds_x1++];
 	*dest = ds_colormap[ds_brightmap[source]][source];
-	dest = ylookup[ds_y] + columnofs[flipviewwidth[ds_x1++]];
+	dest = ylookup[ds_y] + flipcolumnofs[ds_x1++];
 	*dest = ds_colormap[ds_brightmap[source]][source];
     } while (count--);
 }
 
+//
+// [AP] R_InitFlipColumns
+// Folds flipviewwidth into the column offsets, so the drawers look up
+//  a mirrored column once instead of twice per pixel.
+//
+void R_InitFlipColumns (void)
+{
+    int		i;
+
+    for (i=0 ; i<scaledviewwidth ; i++)
+	flipcolumnofs[i] = columnofs[flipviewwidth[i]];
+
+    flipstep = scaledviewwidth > 1 ? flipcolumnofs[1] - flipcolumnofs[0] : 1;
+}
+
 //
 // R_InitBuffer 
 // Creats lookup tables that avoid
@@ -1074,6 +971,42 @@ R_InitBuffer
  
 
 
+// [AP] Everything the composed background_buffer depends on. It's only
+// redrawn when one of these changes, not on every level load, savegame
+// or menu change that asks for it.
+static int background_key[11];
+static boolean background_valid;
+
+static boolean R_BackScreenChanged (void)
+{
+    const int key[arrlen(background_key)] = {
+        SCREENWIDTH,
+        SCREENHEIGHT,
+        crispy->hires,
+        WIDESCREENDELTA,
+        viewwindowx,
+        viewwindowy,
+        scaledviewwidth,
+        viewheight,
+        gamemode == commercial,
+        usegamma,
+#ifdef CRISPY_TRUECOLOR
+        crispy->truecolor,
+#else
+        0,
+#endif
+    };
+
+    if (background_valid && !memcmp(key, background_key, sizeof(key)))
+    {
+        return false;
+    }
+
+    memcpy(background_key, key, sizeof(key));
+    background_valid = true;
+    return true;
+}
+
 //
 // R_FillBackScreen
 // Fills the back screen with a pattern
@@ -1105,6 +1038,7 @@ void R_FillBackScreen (void)
         {
             Z_Free(background_buffer);
             background_buffer = NULL;
+            background_valid = false; // [AP]
         }
 
 	return;
@@ -1118,6 +1052,12 @@ void R_FillBackScreen (void)
                                      PU_STATIC, NULL);
     }
 
+    // [AP] still as it was last drawn
+    if (!R_BackScreenChanged())
+    {
+        return;
+    }
+
     if (gamemode == commercial)
 	name = name2;
     else
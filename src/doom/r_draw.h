@@ -42,6 +42,10 @@ extern byte*		dc_source;
 void 	R_DrawColumn (void);
 void 	R_DrawColumnLow (void);
 
+// [AP] Copies rows dc_yl to dc_yh of an already lit and scaled column,
+// source[y] going to row y. Used for the sky.
+void 	R_DrawPrelitColumn (const pixel_t *source);
+
 // The Spectre/Invisibility effect.
 void 	R_DrawFuzzColumn (void);
 void 	R_DrawFuzzColumnLow (void);
@@ -101,6 +105,9 @@ R_InitBuffer
 ( int		width,
   int		height );
 
+// [AP] Call after flipviewwidth changes
+void R_InitFlipColumns (void);
+
 
 // Initialize color translation tables,
 //  for player rendering etc.
@@ -29,11 +29,14 @@
 #include "doomdef.h"
 #include "doomstat.h" // [AM] leveltime, paused, menuactive
 #include "d_loop.h"
+#include "g_game.h" // [AP] G_MouseViewTurn()
 
 #include "m_bbox.h"
 #include "m_menu.h"
+#include "m_prof.h" // [AP] M_ProfBegin()
 
 #include "i_system.h" // [crispy] I_Realloc()
+#include "z_zone.h" // [AP] Z_Malloc()
 #include "p_local.h" // [crispy] MLOOKUNIT
 #include "r_local.h"
 #include "r_sky.h"
@@ -930,6 +933,7 @@ void R_ExecuteSetViewSize (void)
     }
 
     flipviewwidth = flipscreenwidth + (crispy->fliplevels ? (SCREENWIDTH - scaledviewwidth) : 0);
+    R_InitFlipColumns (); // [AP]
 
     // [crispy] forcefully initialize the status bar backing screen
     ST_refreshBackground(true);
@@ -981,6 +985,105 @@ void R_Init (void)
 //
 // R_PointInSubsector
 //
+// [AP] For every blockmap cell, the deepest BSP node (or subsector)
+// whose ancestors all put the whole cell on the same side, so a lookup
+// can start there instead of at the root. Built by R_InitSubsectorGrid.
+static int*	subsectorgrid;
+
+//
+// R_CellSideOfNode
+// [AP] Returns the side of the node the whole box is on, the same side
+//  R_PointOnSide would give for every point in it, or -1 if the box
+//  straddles the partition or is too close to call.
+//
+static int R_CellSideOfNode (const fixed_t *box, const node_t *node)
+{
+    int64_t	dmin = INT64_MAX;
+    int64_t	dmax = INT64_MIN;
+    int		i;
+
+    if (!node->dx)
+    {
+	if (box[BOXRIGHT] <= node->x)
+	    return node->dy > 0;
+	if (box[BOXLEFT] > node->x)
+	    return node->dy < 0;
+	return -1;
+    }
+    if (!node->dy)
+    {
+	if (box[BOXTOP] <= node->y)
+	    return node->dx < 0;
+	if (box[BOXBOTTOM] > node->y)
+	    return node->dx > 0;
+	return -1;
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+	const int64_t dx = (int64_t) box[i & 1 ? BOXRIGHT : BOXLEFT] - node->x;
+	const int64_t dy = (int64_t) box[i & 2 ? BOXTOP : BOXBOTTOM] - node->y;
+	int64_t d;
+
+	// R_PointOnSide works on wrapping 32-bit differences
+	if (dx != (fixed_t) dx || dy != (fixed_t) dy)
+	    return -1;
+
+	// the exact value of "left - right" before FixedMul truncates it
+	d = (node->dy >> FRACBITS) * dx - (node->dx >> FRACBITS) * dy;
+	dmin = MIN(dmin, d);
+	dmax = MAX(dmax, d);
+    }
+
+    // A full FRACUNIT of margin survives the truncation, so "right < left"
+    // holds for every point; below zero it can never hold.
+    if (dmin >= FRACUNIT)
+	return 0;
+    if (dmax < 0)
+	return 1;
+
+    return -1;
+}
+
+//
+// R_InitSubsectorGrid
+// [AP] Called by P_SetupLevel once the nodes and the blockmap are loaded.
+//
+void R_InitSubsectorGrid (void)
+{
+    int		bx, by;
+
+    subsectorgrid = NULL;
+
+    if (!numnodes || bmapwidth <= 0 || bmapheight <= 0)
+	return;
+
+    subsectorgrid = Z_Malloc(bmapwidth * bmapheight * sizeof(*subsectorgrid), PU_LEVEL, NULL);
+
+    for (by = 0; by < bmapheight; by++)
+    {
+	for (bx = 0; bx < bmapwidth; bx++)
+	{
+	    fixed_t	box[4];
+	    int		nodenum = numnodes-1;
+	    int		side;
+
+	    box[BOXLEFT] = bmaporgx + (bx << MAPBLOCKSHIFT);
+	    box[BOXRIGHT] = box[BOXLEFT] + MAPBLOCKSIZE;
+	    box[BOXBOTTOM] = bmaporgy + (by << MAPBLOCKSHIFT);
+	    box[BOXTOP] = box[BOXBOTTOM] + MAPBLOCKSIZE;
+
+	    while (!(nodenum & NF_SUBSECTOR)
+	           && (side = R_CellSideOfNode(box, &nodes[nodenum])) >= 0)
+	    {
+		nodenum = nodes[nodenum].children[side];
+	    }
+
+	    subsectorgrid[by * bmapwidth + bx] = nodenum;
+	}
+    }
+}
+
 subsector_t*
 R_PointInSubsector
 ( fixed_t	x,
@@ -989,6 +1092,7 @@ R_PointInSubsector
     node_t*	node;
     int		side;
     int		nodenum;
+    unsigned	bx, by;
 
     // single subsector is a special case
     if (!numnodes)				
@@ -996,6 +1100,13 @@ R_PointInSubsector
 		
     nodenum = numnodes-1;
 
+    // [AP] start below the nodes that put the whole blockmap cell on one side
+    bx = (unsigned) (x - bmaporgx) >> MAPBLOCKSHIFT;
+    by = (unsigned) (y - bmaporgy) >> MAPBLOCKSHIFT;
+
+    if (subsectorgrid && bx < bmapwidth && by < bmapheight)
+	nodenum = subsectorgrid[by * bmapwidth + bx];
+
     while (! (nodenum & NF_SUBSECTOR) )
     {
 	node = &nodes[nodenum];
@@ -1016,9 +1127,17 @@ void R_SetupFrame (player_t* player)
     int		i;
     int		tempCentery;
     int		pitch;
+    angle_t	ticturn = 0, mouseturn = 0; // [AP]
     
     viewplayer = player;
 
+    // [AP] Turn the view with the mouse every frame
+    if (player != &players[consoleplayer]
+     || !G_MouseViewTurn(&ticturn, &mouseturn))
+    {
+        ticturn = mouseturn = 0;
+    }
+
     // [AM] Interpolate the player camera if the feature is enabled.
     if (crispy->uncapped &&
         // Don't interpolate on the first tic of a level,
@@ -1034,7 +1153,7 @@ void R_SetupFrame (player_t* player)
         viewx = player->mo->oldx + FixedMul(player->mo->x - player->mo->oldx, fractionaltic);
         viewy = player->mo->oldy + FixedMul(player->mo->y - player->mo->oldy, fractionaltic);
         viewz = player->oldviewz + FixedMul(player->viewz - player->oldviewz, fractionaltic);
-        viewangle = R_InterpolateAngle(player->mo->oldangle, player->mo->angle, fractionaltic) + viewangleoffset;
+        viewangle = R_InterpolateAngle(player->mo->oldangle + ticturn, player->mo->angle, fractionaltic) + mouseturn + viewangleoffset;
 
         pitch = (player->oldlookdir + (player->lookdir - player->oldlookdir) * FIXED2DOUBLE(fractionaltic)) / MLOOKUNIT
                 + (player->oldrecoilpitch + FixedMul(player->recoilpitch - player->oldrecoilpitch, fractionaltic));
@@ -1044,7 +1163,7 @@ void R_SetupFrame (player_t* player)
         viewx = player->mo->x;
         viewy = player->mo->y;
         viewz = player->viewz;
-        viewangle = player->mo->angle + viewangleoffset;
+        viewangle = player->mo->angle + mouseturn + viewangleoffset;
 
         // [crispy] pitch is actual lookdir and weapon pitch
         pitch = player->lookdir / MLOOKUNIT + player->recoilpitch;
@@ -1107,6 +1226,7 @@ void R_RenderPlayerView (player_t* player)
 {	
     extern void V_DrawFilledBox (int x, int y, int w, int h, int c);
 
+    I_LatchFracTic (); // [AP] -latelatch
     R_SetupFrame (player);
 
     // Clear buffers.
@@ -1114,9 +1234,12 @@ void R_RenderPlayerView (player_t* player)
     R_ClearDrawSegs ();
     R_ClearPlanes ();
     R_ClearSprites ();
+    R_InterpolateMovingSectors (); // [AP]
     if (automapactive && !crispy->automapoverlay)
     {
+        M_ProfBegin (PROF_BSP);
         R_RenderBSPNode (numnodes-1);
+        M_ProfEnd (PROF_BSP);
         return;
     }
     
@@ -1138,19 +1261,25 @@ void R_RenderPlayerView (player_t* player)
     // [crispy] smooth texture scrolling
     R_InterpolateTextureOffsets();
     // The head node is the last node output.
+    M_ProfBegin (PROF_BSP);
     R_RenderBSPNode (numnodes-1);
+    M_ProfEnd (PROF_BSP);
     
     // Check for new console commands.
     NetUpdate ();
     
+    M_ProfBegin (PROF_PLANES);
     R_DrawPlanes ();
+    M_ProfEnd (PROF_PLANES);
     
     // Check for new console commands.
     NetUpdate ();
     
     // [crispy] draw fuzz effect independent of rendering frame rate
     R_SetFuzzPosDraw();
+    M_ProfBegin (PROF_MASKED);
     R_DrawMasked ();
+    M_ProfEnd (PROF_MASKED);
 
     // Check for new console commands.
     NetUpdate ();				
@@ -45,6 +45,7 @@ extern fixed_t		centeryfrac;
 extern fixed_t		projection;
 
 extern int		validcount;
+extern int		framecount; // [AP] used by the composite texture cache
 
 extern int		linecount;
 extern int		loopcount;
@@ -152,6 +153,8 @@ R_PointInSubsector
 ( fixed_t	x,
   fixed_t	y );
 
+void R_InitSubsectorGrid (void); // [AP]
+
 void
 R_AddPointToBox
 ( int		x,
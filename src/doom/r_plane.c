@@ -51,6 +51,21 @@ visplane_t*		floorplane;
 visplane_t*		ceilingplane;
 static int		numvisplanes;
 
+// [AP] Hash visplanes on height/picnum/lightlevel so R_FindPlane doesn't
+// scan every plane. Chains hold indices, visplanes can be reallocated.
+// Only the first plane of each tuple is hashed, that's the one the
+// linear search used to find (R_CheckPlane makes more with the same key).
+#define VISPLANEHASHSIZE	256
+#define visplane_hash(height, picnum, lightlevel) \
+	((((unsigned) (height) >> 8) + (unsigned) (picnum) * 3 + (unsigned) (lightlevel) * 7) & (VISPLANEHASHSIZE - 1))
+
+static int		visplanehash[VISPLANEHASHSIZE];
+
+// [AP] R_DrawPlanes draws in flat then light level order, so each flat
+// is looked up and cached once a frame however many planes use it.
+static visplane_t**	sortedplanes;
+static int		numsortedplanes;
+
 // ?
 #define MAXOPENINGS	MAXWIDTH*64*4
 int			openings[MAXOPENINGS]; // [crispy] 32-bit integer math
@@ -204,6 +219,9 @@ void R_ClearPlanes (void)
 
     lastvisplane = visplanes;
     lastopening = openings;
+
+    for (i = 0; i < VISPLANEHASHSIZE; i++)
+	visplanehash[i] = -1;
     
     // texture calculation
     memset (cachedheight, 0, sizeof(cachedheight));
@@ -253,6 +271,8 @@ R_FindPlane
   int		lightlevel )
 {
     visplane_t*	check;
+    unsigned	hash;
+    int		i;
 	
     // [crispy] add support for MBF sky tranfers
     if (picnum == skyflatnum || picnum & PL_SKYFLAT)
@@ -261,20 +281,19 @@ R_FindPlane
 	lightlevel = 0;
     }
 	
-    for (check=visplanes; check<lastvisplane; check++)
+    hash = visplane_hash(height, picnum, lightlevel);
+    for (i = visplanehash[hash]; i != -1; i = visplanes[i].hashnext)
     {
+	check = &visplanes[i];
 	if (height == check->height
 	    && picnum == check->picnum
 	    && lightlevel == check->lightlevel)
 	{
-	    break;
+	    return check;
 	}
     }
-    
-			
-    if (check < lastvisplane)
-	return check;
 		
+    check = lastvisplane;
     R_RaiseVisplanes(&check); // [crispy] remove VISPLANES limit
     if (lastvisplane - visplanes == MAXVISPLANES && false)
 	I_Error ("R_FindPlane: no more visplanes");
@@ -286,6 +305,8 @@ R_FindPlane
     check->lightlevel = lightlevel;
     check->minx = SCREENWIDTH;
     check->maxx = -1;
+    check->hashnext = visplanehash[hash];
+    visplanehash[hash] = check - visplanes;
     
     memset (check->top,0xff,sizeof(check->top));
 		
@@ -403,6 +424,159 @@ R_MakeSpans
 
 
 
+//
+// [AP] Sky column cache. Every sky column uses the same scale and
+// texturemid, so a texture column always lights and scales to the same
+// pixels; only centery (freelook) moves them up and down. Columns are cached
+// lit, over twice the view height so any centery within the view can
+// index them, and drawn with a plain copy.
+//
+
+#define SKYCACHE_SLOTS 4 // normal sky plus a few MBF sky transfers in view
+
+typedef struct
+{
+    int		texture;
+    fixed_t	texturemid;
+    fixed_t	iscale;
+    int		viewheight;
+    int		columns; // width mask + 1
+    pixel_t	*pixels; // columns * 2 * viewheight
+    byte	*filled;
+} skycache_t;
+
+static skycache_t skycache[SKYCACHE_SLOTS];
+static int skycache_next;
+
+void R_ClearSkyCache (void)
+{
+    int i;
+
+    for (i = 0; i < SKYCACHE_SLOTS; i++)
+    {
+	free(skycache[i].pixels);
+	free(skycache[i].filled);
+	memset(&skycache[i], 0, sizeof(skycache[i]));
+    }
+    skycache_next = 0;
+}
+
+static skycache_t *R_GetSkyCache (int texture, fixed_t texturemid, fixed_t iscale)
+{
+    skycache_t *sky;
+    int i;
+
+    for (i = 0; i < SKYCACHE_SLOTS; i++)
+    {
+	sky = &skycache[i];
+	if (sky->pixels && sky->texture == texture && sky->texturemid == texturemid
+	    && sky->iscale == iscale && sky->viewheight == viewheight)
+	{
+	    return sky;
+	}
+    }
+
+    sky = &skycache[skycache_next];
+    skycache_next = (skycache_next + 1) % SKYCACHE_SLOTS;
+
+    sky->texture = texture;
+    sky->texturemid = texturemid;
+    sky->iscale = iscale;
+    sky->viewheight = viewheight;
+    sky->columns = texturewidthmask[texture] + 1;
+    sky->pixels = I_Realloc(sky->pixels, sky->columns * 2 * viewheight * sizeof(*sky->pixels));
+    sky->filled = I_Realloc(sky->filled, sky->columns);
+    memset(sky->filled, 0, sky->columns);
+
+    return sky;
+}
+
+// Same texel stepping as R_DrawColumn, for rows -viewheight to
+// viewheight - 1 relative to centery
+static void R_FillSkyColumn (skycache_t *sky, const byte *source)
+{
+    pixel_t	*dest = sky->pixels;
+    fixed_t	frac = sky->texturemid - sky->viewheight * sky->iscale;
+    const int	texheight = textureheight[sky->texture]>>FRACBITS;
+    int		heightmask = texheight - 1;
+    int		count = 2 * sky->viewheight;
+
+    if (texheight & heightmask)
+    {
+	heightmask++;
+	heightmask <<= FRACBITS;
+
+	if (frac < 0)
+	    while ((frac += heightmask) < 0);
+	else
+	    while (frac >= heightmask)
+		frac -= heightmask;
+
+	while (count--)
+	{
+	    *dest++ = colormaps[source[frac>>FRACBITS]];
+	    if ((frac += sky->iscale) >= heightmask)
+		frac -= heightmask;
+	}
+    }
+    else
+    {
+	while (count--)
+	{
+	    *dest++ = colormaps[source[(frac>>FRACBITS)&heightmask]];
+	    frac += sky->iscale;
+	}
+    }
+}
+
+static void R_DrawSkyPlane (visplane_t *pl, int texture, angle_t an, angle_t flip)
+{
+    skycache_t	*sky = R_GetSkyCache(texture, dc_texturemid, dc_iscale);
+    const byte	*composite;
+    const unsigned *ofs;
+    int		mask;
+    int		x;
+
+    composite = R_GetColumnTable(texture, &ofs, &mask);
+
+    for (x = pl->minx ; x <= pl->maxx ; x++)
+    {
+	dc_yl = pl->top[x];
+	dc_yh = pl->bottom[x];
+
+	if ((unsigned) dc_yl <= dc_yh) // [crispy] 32-bit integer math
+	{
+	    const int col = (((an + xtoviewangle[x])^flip)>>ANGLETOSKYSHIFT) & mask;
+	    pixel_t *column = sky->pixels + col * 2 * sky->viewheight;
+
+	    if (!sky->filled[col])
+	    {
+		R_FillSkyColumn(sky, composite + ofs[col]);
+		sky->filled[col] = 1;
+	    }
+
+	    dc_x = x;
+	    R_DrawPrelitColumn(column + sky->viewheight - centery);
+	}
+    }
+}
+
+// [AP] Planes never share a pixel, so the order they're drawn in is free.
+// Ties go by creation order to keep it the same from frame to frame.
+static int R_ComparePlanes (const void *a, const void *b)
+{
+    const visplane_t *pa = *(const visplane_t *const *) a;
+    const visplane_t *pb = *(const visplane_t *const *) b;
+
+    if (pa->picnum != pb->picnum)
+	return pa->picnum < pb->picnum ? -1 : 1;
+
+    if (pa->lightlevel != pb->lightlevel)
+	return pa->lightlevel < pb->lightlevel ? -1 : 1;
+
+    return pa < pb ? -1 : pa > pb;
+}
+
 //
 // R_DrawPlanes
 // At the end of each frame.
@@ -415,6 +589,9 @@ void R_DrawPlanes (void)
     int			stop;
     int			angle;
     int                 lumpnum;
+    int			cachedlump = -1; // [AP] flat ds_source points at
+    boolean		cachedswirl = false;
+    int			i, n;
 				
 #ifdef RANGECHECK
     if (ds_p - drawsegs > numdrawsegs)
@@ -430,12 +607,26 @@ void R_DrawPlanes (void)
 		 lastopening - openings);
 #endif
 
-    for (pl = visplanes ; pl < lastvisplane ; pl++)
+    // [AP] sort the planes that have anything to draw
+    if (numsortedplanes < numvisplanes)
+    {
+	numsortedplanes = numvisplanes;
+	sortedplanes = I_Realloc(sortedplanes, numsortedplanes * sizeof(*sortedplanes));
+    }
+
+    for (pl = visplanes, n = 0 ; pl < lastvisplane ; pl++)
+    {
+	if (pl->minx <= pl->maxx)
+	    sortedplanes[n++] = pl;
+    }
+
+    qsort(sortedplanes, n, sizeof(*sortedplanes), R_ComparePlanes);
+
+    for (i = 0 ; i < n ; i++)
     {
 	boolean swirling;
 
-	if (pl->minx > pl->maxx)
-	    continue;
+	pl = sortedplanes[i];
 
 	
 	// sky flat
@@ -477,6 +668,14 @@ void R_DrawPlanes (void)
 	    // [crispy] stretch sky
 	    if (crispy->stretchsky)
 	        dc_iscale = dc_iscale * dc_texheight / SKYSTRETCH_HEIGHT;
+
+	    // [AP] Full detail draws from lit, cached columns
+	    if (!detailshift && centery >= 0 && centery <= viewheight)
+	    {
+		R_DrawSkyPlane (pl, texture, an, flip);
+		continue;
+	    }
+
 	    for (x=pl->minx ; x <= pl->maxx ; x++)
 	    {
 		dc_yl = pl->top[x];
@@ -496,9 +695,20 @@ void R_DrawPlanes (void)
 	swirling = (flattranslation[pl->picnum] == -1);
 	// regular flat
         lumpnum = firstflat + (swirling ? pl->picnum : flattranslation[pl->picnum]);
-	// [crispy] add support for SMMU swirling flats
-	ds_source = swirling ? R_DistortedFlat(lumpnum) : W_CacheLumpNum(lumpnum, PU_STATIC);
-	ds_brightmap = R_BrightmapForFlatNum(lumpnum-firstflat);
+
+	// [AP] the previous plane's flat, still cached
+	if (lumpnum != cachedlump || swirling != cachedswirl)
+	{
+	    // R_DistortedFlat() releases the lump itself
+	    if (cachedlump != -1 && !cachedswirl)
+		W_ReleaseLumpNum(cachedlump);
+
+	    // [crispy] add support for SMMU swirling flats
+	    ds_source = swirling ? R_DistortedFlat(lumpnum) : W_CacheLumpNum(lumpnum, PU_STATIC);
+	    ds_brightmap = R_BrightmapForFlatNum(lumpnum-firstflat);
+	    cachedlump = lumpnum;
+	    cachedswirl = swirling;
+	}
 	
 	planeheight = abs(pl->height-viewz);
 	light = (pl->lightlevel >> LIGHTSEGSHIFT)+(extralight * LIGHTBRIGHT);
@@ -523,7 +733,8 @@ void R_DrawPlanes (void)
 			pl->top[x],
 			pl->bottom[x]);
 	}
-	
-        W_ReleaseLumpNum(lumpnum);
     }
+
+    if (cachedlump != -1 && !cachedswirl)
+	W_ReleaseLumpNum(cachedlump);
 }
@@ -45,6 +45,9 @@ extern fixed_t		distscale[MAXWIDTH];
 void R_InitPlanes (void);
 void R_ClearPlanes (void);
 
+// [AP] Drops the lit sky columns, for when the colormaps change
+void R_ClearSkyCache (void);
+
 void
 R_MapPlane
 ( int		y,
@@ -194,7 +194,9 @@ R_RenderMaskedSegRange
   int		x2 )
 {
     unsigned	index;
-    column_t*	col;
+    const maskedrun_t*	runs; // [AP]
+    byte*	source;
+    int		numruns;
     int		lightnum;
     int		texnum;
     
@@ -298,10 +300,10 @@ R_RenderMaskedSegRange
 	    dc_iscale = 0xffffffffu / (unsigned)spryscale;
 	    
 	    // draw the texture
-	    col = (column_t *)( 
-		(byte *)R_GetColumnMod(texnum,maskedtexturecol[dc_x]) -3);
-			
-	    R_DrawMaskedColumn (col);
+	    // [AP] from the runs decoded with the composite, not its posts
+	    runs = R_GetMaskedRuns(texnum, maskedtexturecol[dc_x], &numruns, &source);
+
+	    R_DrawMaskedRuns (source, runs, numruns);
 	    maskedtexturecol[dc_x] = INT_MAX; // [crispy] 32-bit integer math
 	}
 	spryscale += rw_scalestep;
@@ -323,16 +325,93 @@ R_RenderMaskedSegRange
 #define HEIGHTBITS		12
 #define HEIGHTUNIT		(1<<HEIGHTBITS)
 
-void R_RenderSegLoop (void)
+// [AP] Texture column, light and scale of each column of the seg, filled
+// in a first pass so the drawing loop only reads them back
+static int		seg_texturecolumn[MAXWIDTH];
+static lighttable_t*	seg_walllights[MAXWIDTH];
+static fixed_t		seg_iscale[MAXWIDTH];
+
+// [AP] A wall tier's texture, looked up once per seg instead of once per
+// column
+typedef struct
+{
+    byte		*composite;
+    const unsigned	*ofs;
+    int			mask;
+    int			texheight;
+    const byte		*brightmap;
+} segtier_t;
+
+static void R_SetupSegTier (segtier_t *tier, int tex)
+{
+    tier->composite = R_GetColumnTable(tex, &tier->ofs, &tier->mask);
+    tier->texheight = textureheight[tex]>>FRACBITS; // [crispy] Tutti-Frutti fix
+    tier->brightmap = texturebrightmap[tex];
+}
+
+static void R_SegTierColumn (const segtier_t *tier, int texturecolumn)
+{
+    dc_source = tier->composite + tier->ofs[texturecolumn & tier->mask];
+    dc_texheight = tier->texheight;
+    dc_brightmap = tier->brightmap;
+}
+
+static void R_ComputeSegColumns (void)
 {
     angle_t		angle;
     unsigned		index;
+    fixed_t		scale = rw_scale;
+    int			x;
+    int* const		tangents = seg_texturecolumn + rw_x;
+
+    // calculate texture offset, each step over the whole seg
+    for (x = rw_x ; x < rw_stopx ; x++)
+    {
+	angle = (rw_centerangle + xtoviewangle[x])>>ANGLETOFINESHIFT;
+	tangents[x - rw_x] = finetangent[angle];
+    }
+    FixedMulScalarN (tangents, tangents, rw_distance, rw_stopx - rw_x);
+    for (x = rw_x ; x < rw_stopx ; x++)
+    {
+	seg_texturecolumn[x] = (rw_offset-seg_texturecolumn[x])>>FRACBITS;
+    }
+
+    for (x = rw_x ; x < rw_stopx ; x++)
+    {
+	// calculate lighting
+	index = scale>>(LIGHTSCALESHIFT + crispy->hires);
+
+	if (index >=  MAXLIGHTSCALE )
+	    index = MAXLIGHTSCALE-1;
+
+	seg_walllights[x] = walllights[index];
+	seg_iscale[x] = 0xffffffffu / (unsigned)scale;
+
+	scale += rw_scalestep;
+    }
+}
+
+void R_RenderSegLoop (void)
+{
     int			yl;
     int			yh;
     int			mid;
     fixed_t		texturecolumn;
     int			top;
     int			bottom;
+    segtier_t		midtier, toptier, bottomtier;
+
+    if (segtextured)
+    {
+	R_ComputeSegColumns ();
+
+	if (midtexture)
+	    R_SetupSegTier (&midtier, midtexture);
+	if (toptexture)
+	    R_SetupSegTier (&toptier, toptexture);
+	if (bottomtexture)
+	    R_SetupSegTier (&bottomtier, bottomtexture);
+    }
 
     for ( ; rw_x < rw_stopx ; rw_x++)
     {
@@ -379,21 +458,13 @@ void R_RenderSegLoop (void)
 	// texturecolumn and lighting are independent of wall tiers
 	if (segtextured)
 	{
-	    // calculate texture offset
-	    angle = (rw_centerangle + xtoviewangle[rw_x])>>ANGLETOFINESHIFT;
-	    texturecolumn = rw_offset-FixedMul(finetangent[angle],rw_distance);
-	    texturecolumn >>= FRACBITS;
-	    // calculate lighting
-	    index = rw_scale>>(LIGHTSCALESHIFT + crispy->hires);
-
-	    if (index >=  MAXLIGHTSCALE )
-		index = MAXLIGHTSCALE-1;
+	    texturecolumn = seg_texturecolumn[rw_x];
 
 	    // [crispy] optional brightmaps
-	    dc_colormap[0] = walllights[index];
+	    dc_colormap[0] = seg_walllights[rw_x];
 	    dc_colormap[1] = (!fixedcolormap && (crispy->brightmaps & BRIGHTMAPS_TEXTURES)) ? colormaps : dc_colormap[0];
 	    dc_x = rw_x;
-	    dc_iscale = 0xffffffffu / (unsigned)rw_scale;
+	    dc_iscale = seg_iscale[rw_x];
 	}
         else
         {
@@ -409,9 +480,7 @@ void R_RenderSegLoop (void)
 	    dc_yl = yl;
 	    dc_yh = yh;
 	    dc_texturemid = rw_midtexturemid;
-	    dc_source = R_GetColumn(midtexture,texturecolumn);
-	    dc_texheight = textureheight[midtexture]>>FRACBITS; // [crispy] Tutti-Frutti fix
-	    dc_brightmap = texturebrightmap[midtexture];
+	    R_SegTierColumn (&midtier, texturecolumn);
 	    colfunc ();
 	    ceilingclip[rw_x] = viewheight;
 	    floorclip[rw_x] = -1;
@@ -433,9 +502,7 @@ void R_RenderSegLoop (void)
 		    dc_yl = yl;
 		    dc_yh = mid;
 		    dc_texturemid = rw_toptexturemid;
-		    dc_source = R_GetColumn(toptexture,texturecolumn);
-		    dc_texheight = textureheight[toptexture]>>FRACBITS; // [crispy] Tutti-Frutti fix
-		    dc_brightmap = texturebrightmap[toptexture];
+		    R_SegTierColumn (&toptier, texturecolumn);
 		    colfunc ();
 		    ceilingclip[rw_x] = mid;
 		}
@@ -464,10 +531,7 @@ void R_RenderSegLoop (void)
 		    dc_yl = mid;
 		    dc_yh = yh;
 		    dc_texturemid = rw_bottomtexturemid;
-		    dc_source = R_GetColumn(bottomtexture,
-					    texturecolumn);
-		    dc_texheight = textureheight[bottomtexture]>>FRACBITS; // [crispy] Tutti-Frutti fix
-		    dc_brightmap = texturebrightmap[bottomtexture];
+		    R_SegTierColumn (&bottomtier, texturecolumn);
 		    colfunc ();
 		    floorclip[rw_x] = mid;
 		}
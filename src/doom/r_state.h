@@ -37,11 +37,11 @@
 // needed for texture pegging
 extern fixed_t*		textureheight;
 
-// needed for pre rendering (fracs)
-extern fixed_t*		spritewidth;
+// [AP] power of two width mask of each texture, for the sky's columns
+extern int*		texturewidthmask;
 
-extern fixed_t*		spriteoffset;
-extern fixed_t*		spritetopoffset;
+// needed for pre rendering (fracs)
+extern spritemetrics_t*	spritemetrics; // [AP]
 
 extern lighttable_t*	colormaps;
 
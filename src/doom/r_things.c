@@ -187,6 +187,34 @@ R_InstallSpriteLump
 
 
 
+//
+// R_InitSpriteViews
+// [AP] Fill in a frame's view table. Its 32 steps divide both the 8
+// rotation and the 16 rotation sectors exactly, so one index off the
+// view angle serves either, picking the same rotation as before.
+//
+#define SPRITEVIEW_OFFSET ((unsigned)(ANG45/4)*17)
+
+static void R_InitSpriteViews (spriteframe_t *sprframe)
+{
+    int		view;
+    int		rot;
+
+    for (view = 0; view < 32; view++)
+    {
+	if (sprframe->rotate == 2)
+	    rot = (view >> 2) + ((view & 2) << 2);
+	else if (sprframe->rotate == 1)
+	    rot = ((view + 1) >> 2) & 7;
+	else
+	    rot = 0;
+
+	sprframe->view[view].lump = sprframe->lump[rot];
+	sprframe->view[view].flip = sprframe->flip[rot];
+    }
+}
+
+
 //
 // R_InitSpriteDefs
 // Pass a null terminated list of sprite names
@@ -306,6 +334,8 @@ void R_InitSpriteDefs(const char **namelist)
 
 		break;
 	    }
+
+	    R_InitSpriteViews(&sprtemp[frame]);
 	}
 	
 	// allocate space for the frames present and copy sprtemp to it
@@ -459,6 +489,42 @@ void R_DrawMaskedColumn (column_t* column)
     dc_texturemid = basetexturemid;
 }
 
+// [AP] R_DrawMaskedColumn for a column decoded by R_GetMaskedRuns(),
+// the runs are the posts with their tops made absolute.
+void R_DrawMaskedRuns (byte* source, const maskedrun_t* run, int count)
+{
+    const fixed_t	basetexturemid = dc_texturemid;
+    const int		floorclip = mfloorclip[dc_x];
+    const int		ceilingclip = mceilingclip[dc_x];
+    int64_t		topscreen; // [crispy] WiggleFix
+    int64_t		bottomscreen; // [crispy] WiggleFix
+
+    dc_texheight = 0; // [crispy] Tutti-Frutti fix
+
+    for ( ; count > 0 ; count--, run++)
+    {
+	topscreen = sprtopscreen + spryscale*run->top;
+	bottomscreen = topscreen + spryscale*run->length;
+
+	dc_yl = (int)((topscreen+FRACUNIT-1)>>FRACBITS); // [crispy] WiggleFix
+	dc_yh = (int)((bottomscreen-1)>>FRACBITS); // [crispy] WiggleFix
+
+	if (dc_yh >= floorclip)
+	    dc_yh = floorclip-1;
+	if (dc_yl <= ceilingclip)
+	    dc_yl = ceilingclip+1;
+
+	if (dc_yl <= dc_yh)
+	{
+	    dc_source = source + run->top;
+	    dc_texturemid = basetexturemid - (run->top<<FRACBITS);
+	    colfunc ();
+	}
+    }
+
+    dc_texturemid = basetexturemid;
+}
+
 
 
 //
@@ -574,9 +640,10 @@ void R_ProjectSprite (mobj_t* thing)
 
     spritedef_t*	sprdef;
     spriteframe_t*	sprframe;
+    const spritemetrics_t*	metrics; // [AP]
     int			lump;
     
-    unsigned		rot;
+    unsigned		view;
     boolean		flip;
     
     int			index;
@@ -655,36 +722,30 @@ void R_ProjectSprite (mobj_t* thing)
 #endif
     sprframe = &sprdef->spriteframes[ thing->frame & FF_FRAMEMASK];
 
+    // [crispy] now made non-fatal
+    if (sprframe->rotate == -1)
+    {
+	return;
+    }
+
     if (sprframe->rotate)
     {
 	// choose a different rotation based on player view
-	ang = R_PointToAngle (interpx, interpy);
-	// [crispy] now made non-fatal
-	if (sprframe->rotate == -1)
-	{
-	    return;
-	}
-	else
 	// [crispy] support 16 sprite rotations
-	if (sprframe->rotate == 2)
-	{
-	    const unsigned rot2 = (ang-interpangle+(unsigned)(ANG45/4)*17);
-	    rot = (rot2>>29) + ((rot2>>25)&8);
-	}
-	else
-	{
-	rot = (ang-interpangle+(unsigned)(ANG45/2)*9)>>29;
-	}
-	lump = sprframe->lump[rot];
-	flip = (boolean)sprframe->flip[rot];
+	ang = R_PointToAngle (interpx, interpy);
+	view = (ang-interpangle+SPRITEVIEW_OFFSET)>>27;
     }
     else
     {
 	// use single rotation for all views
-	lump = sprframe->lump[0];
-	flip = (boolean)sprframe->flip[0];
+	view = 0;
     }
 
+    // [AP] one table lookup for whichever rotations the frame has
+    lump = sprframe->view[view].lump;
+    flip = (boolean)sprframe->view[view].flip;
+    metrics = &spritemetrics[lump];
+
     // [crispy] randomly flip corpse, blood and death animation sprites
     if (crispy->flipcorpses &&
         (thing->flags & MF_FLIPPABLE) &&
@@ -696,14 +757,14 @@ void R_ProjectSprite (mobj_t* thing)
     
     // calculate edges of the shape
     // [crispy] fix sprite offsets for mirrored sprites
-    tx -= flip ? spritewidth[lump] - spriteoffset[lump] : spriteoffset[lump];
+    tx -= flip ? metrics->width - metrics->offset : metrics->offset;
     x1 = (centerxfrac + FixedMul (tx,xscale) ) >>FRACBITS;
 
     // off the right side?
     if (x1 > viewwidth)
 	return;
     
-    tx +=  spritewidth[lump];
+    tx +=  metrics->width;
     x2 = ((centerxfrac + FixedMul (tx,xscale) ) >>FRACBITS) - 1;
 
     // off the left side
@@ -711,7 +772,7 @@ void R_ProjectSprite (mobj_t* thing)
 	return;
     
     // [JN] killough 4/9/98: clip things which are out of view due to height
-    gzt = interpz + spritetopoffset[lump];
+    gzt = interpz + metrics->topoffset;
     if (interpz > viewz + FixedDiv(viewheight << FRACBITS, xscale) ||
         gzt < (int64_t)viewz - FixedDiv((viewheight << FRACBITS)-viewheight, xscale))
     {
@@ -740,7 +801,7 @@ void R_ProjectSprite (mobj_t* thing)
 
     if (flip)
     {
-	vis->startfrac = spritewidth[lump]-1;
+	vis->startfrac = metrics->width-1;
 	vis->xiscale = -iscale;
     }
     else
@@ -824,17 +885,49 @@ void R_ProjectSprite (mobj_t* thing)
 
 extern void P_LineLaser (mobj_t* t1, angle_t angle, fixed_t distance, fixed_t slope);
 
+// [AP] The laser is a hitscan or three through the blockmap, too much to
+// redo for every rendered frame. It's traced once a tic, or as soon as
+// the view turns or tilts far enough to move the spot, and the result is
+// shared by the crosshair colour and the projected crosshair.
+#define LASER_ANGLE_SLOP (ANG1/4)
+#define LASER_SLOPE_SLOP (FRACUNIT/256)
+
+static boolean laserhit;
+
+static void R_UpdateLaser (void)
+{
+	static int lasttic = -1;
+	static int lastmode;
+	static mobj_t *lastmo;
+	static angle_t lastangle;
+	static fixed_t lastslope;
+	const fixed_t slope = PLAYER_SLOPE(viewplayer);
+
+	if (gametic == lasttic &&
+	    crispy->crosshair == lastmode &&
+	    viewplayer->mo == lastmo &&
+	    (angle_t) (viewangle - lastangle + LASER_ANGLE_SLOP) <= 2*LASER_ANGLE_SLOP &&
+	    abs(slope - lastslope) <= LASER_SLOPE_SLOP)
+	{
+		return;
+	}
+
+	lasttic = gametic;
+	lastmode = crispy->crosshair;
+	lastmo = viewplayer->mo;
+	lastangle = viewangle;
+	lastslope = slope;
+
+	P_LineLaser(viewplayer->mo, viewangle, 16*64*FRACUNIT, slope);
+	laserhit = (linetarget != NULL);
+}
+
 byte *R_LaserspotColor (void)
 {
 	if (crispy->crosshairtarget)
 	{
-		// [crispy] the projected crosshair code calls P_LineLaser() itself
-		if (crispy->crosshair == CROSSHAIR_STATIC)
-		{
-			P_LineLaser(viewplayer->mo, viewangle,
-			            16*64*FRACUNIT, PLAYER_SLOPE(viewplayer));
-		}
-		if (linetarget)
+		R_UpdateLaser(); // [AP]
+		if (laserhit)
 		{
 			return cr[CR_GRAY];
 		}
@@ -882,8 +975,7 @@ static void R_DrawLSprite (void)
 	patch = W_CacheLumpNum(lump, PU_STATIC);
     }
 
-    P_LineLaser(viewplayer->mo, viewangle,
-                16*64*FRACUNIT, PLAYER_SLOPE(viewplayer));
+    R_UpdateLaser(); // [AP]
 
     if (!laserspot->thinker.function.acv)
 	return;
@@ -1010,14 +1102,14 @@ void R_DrawPSprite (pspdef_t* psp, psprnum_t psprnum) // [crispy] differentiate
     tx = psp->sx2-(ORIGWIDTH/2)*FRACUNIT;
 	
     // [crispy] fix sprite offsets for mirrored sprites
-    tx -= flip ? 2 * tx - spriteoffset[lump] + spritewidth[lump] : spriteoffset[lump];
+    tx -= flip ? 2 * tx - spritemetrics[lump].offset + spritemetrics[lump].width : spritemetrics[lump].offset;
     x1 = (centerxfrac + FixedMul (tx,pspritescale) ) >>FRACBITS;
 
     // off the right side
     if (x1 > viewwidth)
 	return;		
 
-    tx +=  spritewidth[lump];
+    tx +=  spritemetrics[lump].width;
     x2 = ((centerxfrac + FixedMul (tx, pspritescale) ) >>FRACBITS) - 1;
 
     // off the left side
@@ -1029,7 +1121,7 @@ void R_DrawPSprite (pspdef_t* psp, psprnum_t psprnum) // [crispy] differentiate
     vis->translation = NULL; // [crispy] no color translation
     vis->mobjflags = 0;
     // [crispy] weapons drawn 1 pixel too high when player is idle
-    vis->texturemid = (BASEYCENTER<<FRACBITS)+FRACUNIT/4-(psp->sy2-spritetopoffset[lump]);
+    vis->texturemid = (BASEYCENTER<<FRACBITS)+FRACUNIT/4-(psp->sy2-spritemetrics[lump].topoffset);
     vis->x1 = x1 < 0 ? 0 : x1;
     vis->x2 = x2 >= viewwidth ? viewwidth-1 : x2;	
     vis->scale = pspritescale<<detailshift;
@@ -1037,7 +1129,7 @@ void R_DrawPSprite (pspdef_t* psp, psprnum_t psprnum) // [crispy] differentiate
     if (flip)
     {
 	vis->xiscale = -pspriteiscale;
-	vis->startfrac = spritewidth[lump]-1;
+	vis->startfrac = spritemetrics[lump].width-1;
     }
     else
     {
@@ -1172,91 +1264,78 @@ void R_DrawPlayerSprites (void)
 //
 // R_SortVisSprites
 //
-#ifdef HAVE_QSORT
-// [crispy] use stdlib's qsort() function for sorting the vissprites[] array
-static inline int cmp_vissprites (const void *a, const void *b)
-{
-    const vissprite_t *vsa = (const vissprite_t *) a;
-    const vissprite_t *vsb = (const vissprite_t *) b;
-
-    const int ret = vsa->scale - vsb->scale;
-
-    return ret ? ret : vsa->next - vsb->next;
-}
+// [AP] Stable LSD radix sort on scale over an index array, so the
+// vissprite_t structs themselves never move. Sprites with equal scale
+// keep their R_NewVisSprite order, same as the overlay-preserving
+// qsort tie-break the [crispy] code used.
+int*		vissprite_order = NULL;
+static int*	vissprite_order_tmp = NULL;
+static unsigned int*	vissprite_keys = NULL;
+static int	numvissprite_order;
 
 void R_SortVisSprites (void)
 {
-    int count;
-    vissprite_t *ds;
+    int		count;
+    int		i;
+    int		shift;
+    int		*src, *dst, *swap;
 
     count = vissprite_p - vissprites;
 
     if (!count)
 	return;
 
-    // [crispy] maintain a stable sort for deliberately overlaid sprites
-    for (ds = vissprites; ds < vissprite_p; ds++)
+    if (count > numvissprite_order)
     {
-	ds->next = ds + 1;
+	numvissprite_order = numvissprites;
+	vissprite_order = I_Realloc(vissprite_order, numvissprite_order * sizeof(*vissprite_order));
+	vissprite_order_tmp = I_Realloc(vissprite_order_tmp, numvissprite_order * sizeof(*vissprite_order_tmp));
+	vissprite_keys = I_Realloc(vissprite_keys, numvissprite_order * sizeof(*vissprite_keys));
     }
 
-    qsort(vissprites, count, sizeof(*vissprites), cmp_vissprites);
-}
-#else
-vissprite_t	vsprsortedhead;
+    // flip the sign bit so signed scales order correctly as unsigned keys
+    for (i = 0; i < count; i++)
+    {
+	vissprite_keys[i] = (unsigned int) vissprites[i].scale ^ 0x80000000u;
+	vissprite_order[i] = i;
+    }
 
+    src = vissprite_order;
+    dst = vissprite_order_tmp;
 
-void R_SortVisSprites (void)
-{
-    int			i;
-    int			count;
-    vissprite_t*	ds;
-    vissprite_t*	best;
-    vissprite_t		unsorted;
-    fixed_t		bestscale;
+    for (shift = 0; shift < 32; shift += 8)
+    {
+	int	counts[256] = {0};
+	int	sum;
 
-    count = vissprite_p - vissprites;
-	
-    unsorted.next = unsorted.prev = &unsorted;
+	for (i = 0; i < count; i++)
+	    counts[(vissprite_keys[i] >> shift) & 0xff]++;
 
-    if (!count)
-	return;
-		
-    for (ds=vissprites ; ds<vissprite_p ; ds++)
-    {
-	ds->next = ds+1;
-	ds->prev = ds-1;
-    }
-    
-    vissprites[0].prev = &unsorted;
-    unsorted.next = &vissprites[0];
-    (vissprite_p-1)->next = &unsorted;
-    unsorted.prev = vissprite_p-1;
-    
-    // pull the vissprites out by scale
+	// all keys share this digit, the pass would be a no-op
+	if (counts[(vissprite_keys[0] >> shift) & 0xff] == count)
+	    continue;
 
-    vsprsortedhead.next = vsprsortedhead.prev = &vsprsortedhead;
-    for (i=0 ; i<count ; i++)
-    {
-	bestscale = INT_MAX;
-        best = unsorted.next;
-	for (ds=unsorted.next ; ds!= &unsorted ; ds=ds->next)
+	for (i = 0, sum = 0; i < 256; i++)
 	{
-	    if (ds->scale < bestscale)
-	    {
-		bestscale = ds->scale;
-		best = ds;
-	    }
+	    const int c = counts[i];
+	    counts[i] = sum;
+	    sum += c;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+	    const int j = src[i];
+	    dst[counts[(vissprite_keys[j] >> shift) & 0xff]++] = j;
 	}
-	best->next->prev = best->prev;
-	best->prev->next = best->next;
-	best->next = &vsprsortedhead;
-	best->prev = vsprsortedhead.prev;
-	vsprsortedhead.prev->next = best;
-	vsprsortedhead.prev = best;
+
+	swap = src;
+	src = dst;
+	dst = swap;
     }
+
+    if (src != vissprite_order)
+	memcpy(vissprite_order, src, count * sizeof(*vissprite_order));
 }
-#endif
 
 
 
@@ -1381,7 +1460,6 @@ void R_DrawSprite (vissprite_t* spr)
 //
 void R_DrawMasked (void)
 {
-    vissprite_t*	spr;
     drawseg_t*		ds;
 	
     R_SortVisSprites ();
@@ -1389,18 +1467,12 @@ void R_DrawMasked (void)
     if (vissprite_p > vissprites)
     {
 	// draw all vissprites back to front
-#ifdef HAVE_QSORT
-	for (spr = vissprites;
-	     spr < vissprite_p;
-	     spr++)
-#else
-	for (spr = vsprsortedhead.next ;
-	     spr != &vsprsortedhead ;
-	     spr=spr->next)
-#endif
+	const int count = vissprite_p - vissprites;
+	int i;
+
+	for (i = 0; i < count; i++)
 	{
-	    
-	    R_DrawSprite (spr);
+	    R_DrawSprite (&vissprites[vissprite_order[i]]);
 	}
     }
     
@@ -26,7 +26,7 @@
 
 extern vissprite_t*	vissprites;
 extern vissprite_t*	vissprite_p;
-extern vissprite_t	vsprsortedhead;
+extern int*		vissprite_order; // [AP] draw order from R_SortVisSprites
 
 // Constant arrays used for psprite clipping
 //  and initializing clipping.
@@ -45,6 +45,7 @@ extern fixed_t		pspriteiscale;
 extern boolean pspr_interp; // interpolate weapon bobbing
 
 void R_DrawMaskedColumn (column_t* column);
+void R_DrawMaskedRuns (byte* source, const maskedrun_t* run, int count); // [AP]
 
 
 void R_SortVisSprites (void);
@@ -78,6 +78,13 @@ typedef struct
 
     int pitch;
 
+    // [AP] positions and base volume the sound was last adjusted for,
+    //  lastvolume is -1 until S_UpdateSounds has set its params
+    fixed_t lastx, lasty;
+    fixed_t lastlx, lastly;
+    angle_t lastangle;
+    int lastvolume;
+
 } channel_t;
 
 // The set of channels available
@@ -359,26 +366,13 @@ static void S_StopChannel(int cnum)
 //
 static short prevmap = -1;
 
-void S_Start(void)
+// [AP] Get the music that plays on the given level.
+
+int S_LevelMusic(int episode, int map)
 {
-    int cnum;
     int mnum;
 
-    // kill all playing sounds at start of level
-    //  (trust me - a good idea)
-    for (cnum=0 ; cnum<snd_channels ; cnum++)
-    {
-        if (channels[cnum].sfxinfo)
-        {
-            S_StopChannel(cnum);
-        }
-    }
-
-    // start new music for the level
-    if (musicVolume) // [crispy] do not reset pause state at zero music volume
-    mus_paused = 0;
-
-    ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
+    ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(episode, map));
     mnum = level_state->music;
     if (!mnum)
     {
@@ -397,13 +391,13 @@ void S_Start(void)
                 mus_ddtbl2,
             };
 
-            if ((gameepisode == 2 || gamemission == pack_nerve) &&
-                gamemap <= arrlen(nmus))
+            if ((episode == 2 || gamemission == pack_nerve) &&
+                map <= arrlen(nmus))
             {
-                mnum = nmus[gamemap - 1];
+                mnum = nmus[map - 1];
             }
             else
-            mnum = mus_runnin + gamemap - 1;
+            mnum = mus_runnin + map - 1;
         }
         else
         {
@@ -422,17 +416,17 @@ void S_Start(void)
                 mus_e1m9,        // Tim          e4m9
             };
 
-            if (gameepisode < 4 || gameepisode == 5) // [crispy] Sigil
+            if (episode < 4 || episode == 5) // [crispy] Sigil
             {
-                mnum = mus_e1m1 + (gameepisode-1)*9 + gamemap-1;
+                mnum = mus_e1m1 + (episode-1)*9 + map-1;
             }
             else
             {
-                mnum = spmus[gamemap-1];
+                mnum = spmus[map-1];
 
                 // [crispy] support dedicated music tracks for the 4th episode
                 {
-                    const int sp_mnum = mus_e1m1 + 3 * 9 + gamemap - 1;
+                    const int sp_mnum = mus_e1m1 + 3 * 9 + map - 1;
 
                     if (S_music[sp_mnum].lumpnum > 0)
                     {
@@ -443,6 +437,62 @@ void S_Start(void)
         }
     }
 
+    return mnum;
+}
+
+// [AP] Get the music of a level ready before the level is entered.
+
+void S_PrefetchLevelMusic(int episode, int map)
+{
+    char namebuf[9];
+    int musicnum;
+    int lumpnum;
+
+    musicnum = S_LevelMusic(episode, map);
+
+    if (musicnum <= mus_None || musicnum >= NUMMUSIC)
+    {
+        return;
+    }
+
+    lumpnum = S_music[musicnum].lumpnum;
+
+    if (!lumpnum)
+    {
+        M_snprintf(namebuf, sizeof(namebuf), "d_%s",
+                   DEH_String(S_music[musicnum].name));
+        lumpnum = W_CheckNumForName(namebuf);
+    }
+
+    if (lumpnum <= 0)
+    {
+        return;
+    }
+
+    I_PrefetchSong(W_CacheLumpNum(lumpnum, PU_CACHE), W_LumpLength(lumpnum));
+}
+
+void S_Start(void)
+{
+    int cnum;
+    int mnum;
+
+    // kill all playing sounds at start of level
+    //  (trust me - a good idea)
+    for (cnum=0 ; cnum<snd_channels ; cnum++)
+    {
+        if (channels[cnum].sfxinfo)
+        {
+            S_StopChannel(cnum);
+        }
+    }
+
+    // start new music for the level
+    if (musicVolume) // [crispy] do not reset pause state at zero music volume
+    mus_paused = 0;
+
+    mnum = S_LevelMusic(gameepisode, gamemap);
+
     // [crispy] do not change music if not changing map (preserves IDMUS choice)
     // [AP] Ok we actually want that for AP
  //   {
@@ -557,6 +607,7 @@ static int S_GetChannel(mobj_t *origin, sfxinfo_t *sfxinfo)
     // channel is decided to be cnum.
     c->sfxinfo = sfxinfo;
     c->origin = origin;
+    c->lastvolume = -1;
 
     return cnum;
 }
@@ -668,7 +719,9 @@ void S_StartSound(void *origin_p, int sfx_id)
     volume = snd_SfxVolume;
 
     // [crispy] make non-fatal, consider zero volume
-    if (sfx_id == sfx_None || !snd_SfxVolume || (nodrawers && singletics))
+    // [AP] a tic run again after a rollback has already been heard
+    if (sfx_id == sfx_None || !snd_SfxVolume || (nodrawers && singletics)
+     || replaying_tic)
     {
         return;
     }
@@ -862,6 +915,23 @@ void S_UpdateSounds(mobj_t *listener)
                 //  or modify their params
                 if (c->origin && listener != c->origin && c->origin != players[displayplayer].so) // [crispy] weapon sound source
                 {
+                    // [AP] nothing moved since the last update, the
+                    //  sound is still audible with the same params
+                    if (c->lastvolume == volume
+                     && c->lastx == c->origin->x && c->lasty == c->origin->y
+                     && c->lastlx == listener->x && c->lastly == listener->y
+                     && c->lastangle == listener->angle)
+                    {
+                        continue;
+                    }
+
+                    c->lastvolume = volume;
+                    c->lastx = c->origin->x;
+                    c->lasty = c->origin->y;
+                    c->lastlx = listener->x;
+                    c->lastly = listener->y;
+                    c->lastangle = listener->angle;
+
                     audible = S_AdjustSoundParams(listener,
                                                   c->origin,
                                                   &volume,
@@ -1145,6 +1215,8 @@ void S_UpdateSndChannels (int choice)
 
 void S_UpdateStereoSeparation (void)
 {
+	int i;
+
 	// [crispy] play all sound effects in mono
 	if (crispy->soundmono)
 	{
@@ -1159,4 +1231,10 @@ void S_UpdateStereoSeparation (void)
 	{
 		stereo_swing = S_STEREO_SWING;
 	}
+
+	// [AP] have S_UpdateSounds pan everything again
+	for (i = 0; i < snd_channels; i++)
+	{
+		channels[i].lastvolume = -1;
+	}
 }
@@ -46,6 +46,14 @@ void S_Shutdown(void);
 
 void S_Start(void);
 
+//
+// [AP] Music for a level, and warming it up before the level
+// is entered.
+//
+
+int S_LevelMusic(int episode, int map);
+void S_PrefetchLevelMusic(int episode, int map);
+
 //
 // Start sound for thing at <origin>
 //  using <sound_id> from sounds.h
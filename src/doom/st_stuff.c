@@ -477,74 +477,109 @@ static inline int cht_CheckCheatSP (cheatseq_t *cht, char key)
 //
 void ST_Stop(void);
 
-void ST_refreshBackground(boolean force)
-{
+// [AP] Everything the composed st_backing_screen depends on. Refreshes
+// that find it unchanged only copy the cached background to the screen
+// instead of redrawing the bezel and the status bar patches at hires.
+static int st_backing_key[7];
+static boolean st_backing_valid;
 
-    if (st_classicstatusbar || force)
+static boolean ST_BackingChanged(void)
+{
+    const int key[arrlen(st_backing_key)] = {
+        SCREENWIDTH,
+        crispy->hires,
+        WIDESCREENDELTA,
+        scaledviewwidth == SCREENWIDTH,
+        deathmatch,
+        netgame ? displayplayer : -1,
+        usegamma,
+    };
+
+    if (st_backing_valid && !memcmp(key, st_backing_key, sizeof(key)))
     {
-        V_UseBuffer(st_backing_screen);
+        return false;
+    }
 
-	// [crispy] this is our own local copy of R_FillBackScreen() to
-	// fill the entire background of st_backing_screen with the bezel pattern,
-	// so it appears to the left and right of the status bar in widescreen mode
-	if ((SCREENWIDTH >> crispy->hires) != ST_WIDTH)
-	{
-		int x, y;
-		byte *src;
-		pixel_t *dest;
-		const char *name = (gamemode == commercial) ? DEH_String("GRNROCK") : DEH_String("FLOOR7_2");
+    memcpy(st_backing_key, key, sizeof(key));
+    st_backing_valid = true;
+    return true;
+}
 
-		src = W_CacheLumpName(name, PU_CACHE);
-		dest = st_backing_screen;
+static void ST_composeBackground(void)
+{
+    V_UseBuffer(st_backing_screen);
 
-		for (y = SCREENHEIGHT-(ST_HEIGHT<<crispy->hires); y < SCREENHEIGHT; y++)
-		{
-			for (x = 0; x < SCREENWIDTH; x++)
-			{
+    // [crispy] this is our own local copy of R_FillBackScreen() to
+    // fill the entire background of st_backing_screen with the bezel pattern,
+    // so it appears to the left and right of the status bar in widescreen mode
+    if ((SCREENWIDTH >> crispy->hires) != ST_WIDTH)
+    {
+	    int x, y;
+	    byte *src;
+	    pixel_t *dest;
+	    const char *name = (gamemode == commercial) ? DEH_String("GRNROCK") : DEH_String("FLOOR7_2");
+
+	    src = W_CacheLumpName(name, PU_CACHE);
+	    dest = st_backing_screen;
+
+	    for (y = SCREENHEIGHT-(ST_HEIGHT<<crispy->hires); y < SCREENHEIGHT; y++)
+	    {
+		    for (x = 0; x < SCREENWIDTH; x++)
+		    {
 #ifndef CRISPY_TRUECOLOR
-				*dest++ = src[((y&63)<<6) + (x&63)];
+			    *dest++ = src[((y&63)<<6) + (x&63)];
 #else
-				*dest++ = colormaps[src[((y&63)<<6) + (x&63)]];
+			    *dest++ = colormaps[src[((y&63)<<6) + (x&63)]];
 #endif
-			}
-		}
+		    }
+	    }
 
-		// [crispy] preserve bezel bottom edge
-		if (scaledviewwidth == SCREENWIDTH)
-		{
-			patch_t *const patch = W_CacheLumpName(DEH_String("brdr_b"), PU_CACHE);
+	    // [crispy] preserve bezel bottom edge
+	    if (scaledviewwidth == SCREENWIDTH)
+	    {
+		    patch_t *const patch = W_CacheLumpName(DEH_String("brdr_b"), PU_CACHE);
 
-			for (x = 0; x < WIDESCREENDELTA; x += 8)
-			{
-				V_DrawPatch(x - WIDESCREENDELTA, 0, patch);
-				V_DrawPatch(ORIGWIDTH + WIDESCREENDELTA - x - 8, 0, patch);
-			}
-		}
-	}
+		    for (x = 0; x < WIDESCREENDELTA; x += 8)
+		    {
+			    V_DrawPatch(x - WIDESCREENDELTA, 0, patch);
+			    V_DrawPatch(ORIGWIDTH + WIDESCREENDELTA - x - 8, 0, patch);
+		    }
+	    }
+    }
 
-	// [crispy] center unity rerelease wide status bar
-	if (SHORT(sbar->width) > ORIGWIDTH && SHORT(sbar->leftoffset) == 0)
-	{
-	    V_DrawPatch(ST_X + (ORIGWIDTH - SHORT(sbar->width)) / 2, 0, sbar);
-	}
-	else
-	{
-	    V_DrawPatch(ST_X, 0, sbar);
-	}
+    // [crispy] center unity rerelease wide status bar
+    if (SHORT(sbar->width) > ORIGWIDTH && SHORT(sbar->leftoffset) == 0)
+    {
+	V_DrawPatch(ST_X + (ORIGWIDTH - SHORT(sbar->width)) / 2, 0, sbar);
+    }
+    else
+    {
+	V_DrawPatch(ST_X, 0, sbar);
+    }
+
+    // draw right side of bar if needed (Doom 1.0)
+    if (sbarr)
+	V_DrawPatch(ST_ARMSBGX, 0, sbarr);
+
+    // [crispy] back up arms widget background
+    if (!deathmatch)
+	V_DrawPatch(ST_ARMSBGX, 0, armsbg);
 
-	// draw right side of bar if needed (Doom 1.0)
-	if (sbarr)
-	    V_DrawPatch(ST_ARMSBGX, 0, sbarr);
+    // [crispy] killough 3/7/98: make face background change with displayplayer
+    if (netgame)
+	V_DrawPatch(ST_FX, 0, faceback[displayplayer]);
 
-	// [crispy] back up arms widget background
-	if (!deathmatch)
-	    V_DrawPatch(ST_ARMSBGX, 0, armsbg);
+    V_RestoreBuffer();
+}
 
-	// [crispy] killough 3/7/98: make face background change with displayplayer
-	if (netgame)
-	    V_DrawPatch(ST_FX, 0, faceback[displayplayer]);
+void ST_refreshBackground(boolean force)
+{
 
-        V_RestoreBuffer();
+    if (st_classicstatusbar || force)
+    {
+	// [AP] forced refreshes come from R_ExecuteSetViewSize, always rebuild
+	if (ST_BackingChanged() || force)
+	    ST_composeBackground();
 
 	// [crispy] copy entire SCREENWIDTH, to preserve the pattern
 	// to the left and right of the status bar in widescreen mode
@@ -2237,6 +2272,7 @@ void ST_initData(void)
     int		i;
 
     st_firsttime = true;
+    st_backing_valid = false; // [AP] graphics may have been reloaded
     plyr = &players[displayplayer];
 
     st_clock = 0;
@@ -25,9 +25,12 @@
 
 #include "d_player.h"
 #include "d_mode.h"
+#include "i_system.h"
+#include "i_timer.h"
 #include "m_argv.h"
 #include "m_misc.h"
 
+#include "apdoom.h"
 #include "statdump.h"
 
 /* Par times for E1M1-E1M9. */
@@ -355,3 +358,194 @@ void StatDump(void)
     }
 }
 
+
+/* [AP] Telemetry: one JSON object per line, one line per level played,
+ * for aggregating load, frame, save and AP item timings across sessions.
+ * Nothing is measured unless -telemetry is given. */
+
+static FILE *telemetry_file = NULL;
+
+static struct
+{
+    boolean open;
+    int episode, map;
+    int load_us;
+    uint64_t start_us, last_frame_us;
+    int frames;
+    uint64_t frame_total_us;
+    int frame_worst_us;
+    int saves;
+    uint64_t save_total_us;
+    int save_worst_us;
+} telemetry_level;
+
+static double TelemetryAverageMS(uint64_t total_us, int count)
+{
+    return count > 0 ? (double) total_us / count / 1000.0 : 0.0;
+}
+
+static void TelemetryEndLevel(const char *how)
+{
+    ap_item_stats_t items;
+
+    if (!telemetry_level.open)
+    {
+        return;
+    }
+
+    apdoom_take_item_stats(&items);
+
+    fprintf(telemetry_file,
+            "{\"event\":\"level\",\"episode\":%d,\"map\":%d,\"end\":\"%s\","
+            "\"load_ms\":%.2f,\"time_s\":%.1f,"
+            "\"frames\":%d,\"frame_avg_ms\":%.2f,\"frame_worst_ms\":%.2f,"
+            "\"saves\":%d,\"save_avg_ms\":%.2f,\"save_worst_ms\":%.2f,"
+            "\"ap_items\":%d,\"ap_latency_avg_ms\":%.1f,"
+            "\"ap_latency_worst_ms\":%d,\"ap_queue_max\":%d,"
+            "\"ap_queue_end\":%d,\"ap_locations\":%d,"
+            "\"ap_location_latency_worst_ms\":%d,\"ap_deathlinks\":%d,"
+            "\"ap_deathlink_latency_worst_ms\":%d,"
+            "\"ap_update_avg_ms\":%.3f,\"ap_update_worst_ms\":%.3f}\n",
+            telemetry_level.episode, telemetry_level.map, how,
+            telemetry_level.load_us / 1000.0,
+            (I_GetTimeUS() - telemetry_level.start_us) / 1000000.0,
+            telemetry_level.frames,
+            TelemetryAverageMS(telemetry_level.frame_total_us,
+                               telemetry_level.frames),
+            telemetry_level.frame_worst_us / 1000.0,
+            telemetry_level.saves,
+            TelemetryAverageMS(telemetry_level.save_total_us,
+                               telemetry_level.saves),
+            telemetry_level.save_worst_us / 1000.0,
+            items.items_given,
+            items.latency_count > 0
+              ? (double) items.latency_total_ms / items.latency_count : 0.0,
+            items.latency_max_ms, items.queue_depth_max, items.queue_depth,
+            items.locations, items.location_latency_max_ms,
+            items.deathlinks, items.deathlink_latency_max_ms,
+            TelemetryAverageMS(items.update_total_us, items.updates),
+            items.update_max_us / 1000.0);
+    fflush(telemetry_file);
+
+    telemetry_level.open = false;
+}
+
+static void TelemetryShutdown(void)
+{
+    TelemetryEndLevel("quit");
+    fclose(telemetry_file);
+    telemetry_file = NULL;
+}
+
+void StatTelemetryInit(void)
+{
+    int i;
+
+    //!
+    // @category obscure
+    // @arg <filename>
+    //
+    // Append newline-delimited JSON to the given file, with one record
+    // per level played: load time, frame and save times and how long
+    // Archipelago items, checked locations and DeathLinks took to reach
+    // the game.
+    //
+
+    i = M_CheckParmWithArgs("-telemetry", 1);
+
+    if (i > 0)
+    {
+        telemetry_file = M_fopen(myargv[i + 1], "a");
+
+        if (telemetry_file == NULL)
+        {
+            I_Error("StatTelemetryInit: Couldn't open '%s' for writing",
+                    myargv[i + 1]);
+        }
+
+        fprintf(telemetry_file,
+                "{\"event\":\"session\",\"version\":\"%s\"}\n",
+                APDOOM_VERSION_FULL_TEXT);
+
+        I_AtExit(TelemetryShutdown, true);
+    }
+}
+
+void StatLevelLoaded(int episode, int map, int load_us)
+{
+    if (telemetry_file == NULL)
+    {
+        return;
+    }
+
+    TelemetryEndLevel("left");
+
+    memset(&telemetry_level, 0, sizeof(telemetry_level));
+    telemetry_level.open = true;
+    telemetry_level.episode = episode;
+    telemetry_level.map = map;
+    telemetry_level.load_us = load_us;
+    telemetry_level.start_us = I_GetTimeUS();
+    telemetry_level.last_frame_us = telemetry_level.start_us;
+}
+
+void StatLevelCompleted(void)
+{
+    if (telemetry_file != NULL)
+    {
+        TelemetryEndLevel("completed");
+    }
+}
+
+void StatFrame(void)
+{
+    uint64_t now;
+    int frame_us;
+
+    if (!telemetry_level.open)
+    {
+        return;
+    }
+
+    now = I_GetTimeUS();
+    frame_us = (int) (now - telemetry_level.last_frame_us);
+    telemetry_level.last_frame_us = now;
+
+    telemetry_level.frames++;
+    telemetry_level.frame_total_us += frame_us;
+    if (frame_us > telemetry_level.frame_worst_us)
+    {
+        telemetry_level.frame_worst_us = frame_us;
+    }
+}
+
+void StatTimedemo(const char *mode, const char *demo, int gametics,
+                  int realtime_ms)
+{
+    if (telemetry_file == NULL)
+    {
+        return;
+    }
+
+    fprintf(telemetry_file,
+            "{\"event\":\"%s\",\"demo\":\"%s\",\"gametics\":%d,"
+            "\"ms\":%d,\"tics_per_s\":%.1f}\n",
+            mode, M_BaseName(demo), gametics, realtime_ms,
+            realtime_ms > 0 ? gametics * 1000.0 / realtime_ms : 0.0);
+    fflush(telemetry_file);
+}
+
+void StatSaved(int save_us)
+{
+    if (!telemetry_level.open)
+    {
+        return;
+    }
+
+    telemetry_level.saves++;
+    telemetry_level.save_total_us += save_us;
+    if (save_us > telemetry_level.save_worst_us)
+    {
+        telemetry_level.save_worst_us = save_us;
+    }
+}
@@ -20,4 +20,15 @@
 void StatCopy(const wbstartstruct_t *stats);
 void StatDump(void);
 
+// [AP] -telemetry hooks; they do nothing when it isn't given.
+void StatTelemetryInit(void);
+void StatLevelLoaded(int episode, int map, int load_us);
+void StatLevelCompleted(void);
+void StatFrame(void);
+void StatSaved(int save_us);
+
+// [AP] Result of a -timedemo or -simulate run, for comparing builds.
+void StatTimedemo(const char *mode, const char *demo, int gametics,
+                  int realtime_ms);
+
 #endif /* #ifndef DOOM_STATDUMP_H */
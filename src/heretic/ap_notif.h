@@ -1,6 +0,0 @@
-#ifndef __APNOTIF_H__
-#define __APNOTIF_H__
-
-void ap_notif_draw(void);
-
-#endif
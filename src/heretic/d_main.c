@@ -120,11 +120,12 @@ boolean P_GiveWeapon(player_t* player, weapontype_t weapon, boolean dropped);
 
 
 // Kind of a copy of P_TouchSpecialThing
-void on_ap_give_item(int doom_type, int ep, int map)
+// Returns the pickup sound, or sfx_None if nothing was given.
+static int give_ap_item(int doom_type, int ep, int map)
 {
     player_t* player = &players[consoleplayer];
     int sound = sfx_itemup;
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     switch (doom_type)
     {
@@ -269,37 +270,83 @@ void on_ap_give_item(int doom_type, int ep, int map)
         // Junk
         case 12: // Crystal Geode
             if (!P_GiveAmmo(player, am_goldwand, AMMO_GWND_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOGOLDWAND2);
             break;
         case 55: // Energy Orb
             if (!P_GiveAmmo(player, am_blaster, AMMO_BLSR_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOBLASTER2);
             break;
         case 21: // Greater Runes
             if (!P_GiveAmmo(player, am_skullrod, AMMO_SKRD_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOSKULLROD2);
             break;
         case 23: // Inferno Orb
             if (!P_GiveAmmo(player, am_phoenixrod, AMMO_PHRD_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOPHOENIXROD2);
             break;
         case 16: // Pile of Mace Spheres
             if (!P_GiveAmmo(player, am_mace, AMMO_MACE_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOMACE2);
             break;
         case 19: // Quiver of Ethereal Arrows
             if (!P_GiveAmmo(player, am_crossbow, AMMO_CBOW_HEFTY))
-                return;
+                return sfx_None;
             player->message = DEH_String(TXT_AMMOCROSSBOW2);
             break;
     }
 
-	S_StartSound(NULL, sound); // [NS] Fallback to itemup.
+    return sound;
+}
+
+
+// Louder pickups win when a batch plays a single sound
+static int give_sound_rank(int sound)
+{
+    if (sound == sfx_keyup) return 2;
+    if (sound == sfx_wpnup) return 1;
+    return 0;
+}
+
+
+void on_ap_give_item(int doom_type, int ep, int map)
+{
+    int sound = give_ap_item(doom_type, ep, map);
+
+    if (sound != sfx_None)
+    {
+        S_StartSound(NULL, sound);
+    }
+}
+
+
+// Batched delivery, used when the server hands us many items at once.
+// Every item is applied, but only one pickup sound is played and the HUD
+// keeps the message of the last item given.
+void on_ap_give_items(const ap_item_t* items, int count)
+{
+    int sound = sfx_None;
+    int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        int item_sound = give_ap_item(items[i].doom_type, items[i].ep, items[i].map);
+
+        if (item_sound != sfx_None
+         && (sound == sfx_None || give_sound_rank(item_sound) > give_sound_rank(sound)))
+        {
+            sound = item_sound;
+        }
+    }
+
+    if (sound != sfx_None)
+    {
+        S_StartSound(NULL, sound);
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -549,7 +596,7 @@ void D_Display(void)
     MN_Drawer();
     if (gamestate != GS_FINALE)
     {
-        ap_notif_draw();
+        ap_notif_draw(MN_DrTextA);
         HU_DrawAPMessages();   // [AP] Sticky messages on top of everything
     }
 
@@ -640,6 +687,9 @@ void D_DoomLoop(void)
         S_UpdateSounds(players[consoleplayer].mo);
         D_Display();
 
+        // [AP] the rest of a screenshot burst, one shot a frame
+        V_ScreenShotBurstFrame();
+
         // [crispy] post-rendering function pointer to apply config changes
         // that affect rendering and that are better applied after the current
         // frame has finished rendering
@@ -1319,6 +1369,18 @@ void D_DoomMain(void)
     if (!apserver_arg_id)
 	    I_Error("Make sure to launch the game using APDoomLauncher.exe.\nThe '-apserver' parameter requires an argument.");
 
+    //!
+    // @arg <seconds>
+    // @category net
+    //
+    // How long to wait for the Archipelago server before giving up.
+    // The default is 10 seconds.
+    //
+
+    int aptimeout_arg_id = M_CheckParmWithArgs("-aptimeout", 1);
+    if (aptimeout_arg_id)
+        ap_settings.connect_timeout = atoi(myargv[aptimeout_arg_id + 1]);
+
     int player_is_hex = 0;
     int applayer_arg_id = M_CheckParmWithArgs("-applayer", 1);
     if (!applayer_arg_id)
@@ -1364,6 +1426,16 @@ void D_DoomMain(void)
         ap_settings.item_rando = atoi(myargv[item_rando_id + 1]);
     }
 
+    //!
+    // @category net
+    //
+    // Publish the AP state in shared memory for local trackers and
+    // overlays, see ap_tracker_block_t.
+    //
+
+    if (M_CheckParm("-aptracker"))
+        ap_settings.tracker_export = 1;
+
     int music_rando_id = M_CheckParmWithArgs("-apmusicrando", 1);
     if (music_rando_id)
     {
@@ -1411,8 +1483,11 @@ void D_DoomMain(void)
     ap_settings.passwd = password;
     ap_settings.message_callback = on_ap_message;
     ap_settings.give_item_callback = on_ap_give_item;
+    ap_settings.give_items_callback = on_ap_give_items;
     ap_settings.victory_callback = on_ap_victory;
-    if (!apdoom_init(&ap_settings))
+    // [AP] Connect while the WADs, refresh and sound are set up, and only
+    // wait for the slot data once they're done
+    if (!apdoom_init_start(&ap_settings))
     {
 	    I_Error("Failed to initialize Archipelago.");
     }
@@ -1724,6 +1799,13 @@ void D_DoomMain(void)
 
     tprintf(DEH_String("S_Init: Setting up sound.\n"), 1);
     S_Init();
+
+    // [AP] S_Start picks the level music from the slot data
+    if (!apdoom_init_finish())
+    {
+	    I_Error("Failed to initialize Archipelago.");
+    }
+
     //IO_StartupTimer();
     S_Start();
 
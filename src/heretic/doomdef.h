@@ -715,6 +715,7 @@ void G_SaveGame(int slot, char *description);
 char *SV_Filename(int slot);
 void SV_Open(char *fileName);
 void SV_OpenRead(char *fileName);
+void SV_CloseRead(void);
 void SV_Close(char *fileName);
 void SV_Write(void *buffer, int size);
 void SV_WriteByte(byte val);
@@ -765,6 +766,7 @@ void P_Ticker(void);
 // carries out all thinking of monsters and players
 
 void P_SetupLevel(int episode, int map, int playermask, skill_t skill);
+void P_PrefetchMap(int episode, int map);
 // called by W_Ticker
 
 void P_Init(void);
@@ -1422,6 +1422,12 @@ void G_Ticker(void)
                     P_KillMobj_Real(NULL, players[consoleplayer].mo, false);
                 }
             }
+
+            if (players[consoleplayer].mo)
+            {
+                const mobj_t *mo = players[consoleplayer].mo;
+                apdoom_set_player_position(mo->x >> FRACBITS, mo->y >> FRACBITS, mo->angle / ANG1);
+            }
             break;
         case GS_INTERMISSION:
             IN_Ticker();
@@ -1810,7 +1816,7 @@ void set_ap_player_states()
 
     // Cards
     ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     p->keys[0] = level_state->keys[0];
     p->keys[1] = level_state->keys[1];
@@ -2077,6 +2083,7 @@ void G_DoLoadGame(void)
 
     if (strncmp(readversion, vcheck, VERSIONSIZE) != 0)
     {                           // Bad version
+        SV_CloseRead();
         return;
     }
     gameskill = SV_ReadByte();
@@ -2108,6 +2115,7 @@ void G_DoLoadGame(void)
     {                           // Missing savegame termination marker
         I_Error("Bad savegame");
     }
+    SV_CloseRead();
 
     // [AP] Move player back to player spawn and reset its velocity (Make sure z is set to floor too)
     if (!was_in_level)
@@ -46,15 +46,9 @@ void P_RemoveMobj(mobj_t* mobj);
 
 void A_check_collected(mobj_t *actor, player_t *player, pspdef_t *psp)
 {
-	int j, lenj;
-	ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-    for (j = 0, lenj = level_state->check_count; j < lenj; ++j)
+    if (apdoom_is_location_checked(ap_make_level_index(gameepisode, gamemap), actor->index))
     {
-        if (level_state->checks[j] == actor->index)
-        {
-			P_RemoveMobj(actor);
-			return;
-        }
+        P_RemoveMobj(actor);
     }
 }
 
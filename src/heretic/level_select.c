@@ -22,6 +22,7 @@
 #include "v_video.h"
 #include "doomkeys.h"
 #include "apdoom.h"
+#include "ap_notif.h"
 #include "i_video.h"
 #include "m_misc.h"
 #include "ap_msg.h"
@@ -480,6 +481,7 @@ void G_DoSaveGame(void);
 void ShowLevelSelect()
 {
     HU_ClearAPMessages();
+    ap_notif_precache();
 
     // If in a level, save current level
     if (gamestate == GS_LEVEL)
@@ -514,6 +516,38 @@ void ShowLevelSelect()
 }
 
 
+// Once the cursor rests on a level, warm its map lumps and music so
+// entering it doesn't stall on the WAD and music pack reads.
+#define PREFETCH_DELAY 8 // tics
+
+static int prefetch_ep = -1;
+static int prefetch_map = -1;
+static int prefetch_tics = 0;
+
+static void tick_prefetch()
+{
+    int ep = selected_ep;
+    int map = selected_level[selected_ep];
+
+    if (ep != prefetch_ep || map != prefetch_map)
+    {
+        prefetch_ep = ep;
+        prefetch_map = map;
+        prefetch_tics = 0;
+    }
+
+    if (prefetch_tics < PREFETCH_DELAY)
+    {
+        if (++prefetch_tics == PREFETCH_DELAY)
+        {
+            ap_level_index_t idx = {ep, map};
+            P_PrefetchMap(ap_index_to_ep(idx), ap_index_to_map(idx));
+            S_PrefetchLevelMusic(ap_index_to_ep(idx), ap_index_to_map(idx));
+        }
+    }
+}
+
+
 void TickLevelSelect()
 {
     if (activating_level_select_anim > 0)
@@ -529,6 +563,7 @@ void TickLevelSelect()
     else if (ep_anim < 0)
         ep_anim += 1;
     urh_anim = (urh_anim + 1) % 35;
+    tick_prefetch();
 }
 
 
@@ -555,7 +590,7 @@ void DrawEpisodicLevelSelectStats()
     for (int i = 0; i < map_count; ++i)
     {
         level_pos_t* level_pos = &level_pos_infos[selected_ep][i];
-        ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(selected_ep + 1, i + 1));
+        const ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(selected_ep + 1, i + 1));
         ap_level_state_t* ap_level_state = ap_get_level_state(ap_make_level_index(selected_ep + 1, i + 1));
 
         x = level_pos->x;
@@ -3003,7 +3003,7 @@ static void DrawCrispness1(void)
     DrawCrispnessItem(crispy->soundmono, 137, 145);
 
     // Sound Channels
-    DrawCrispnessMultiItem(snd_Channels >> 4, 181, 155, multiitem_sndchannels, false);
+    DrawCrispnessMultiItem(MIN(snd_Channels, 32) >> 4, 181, 155, multiitem_sndchannels, false); // [AP] more with snd_softmixer
 }
 
 static void DrawCrispness2(void)
@@ -22,12 +22,17 @@
 #include "i_swap.h"
 #include "i_system.h"
 #include "m_misc.h"
+#include "memio.h"
 #include "p_local.h"
 #include "v_video.h"
+#include "z_zone.h"
 
 #include "apdoom.h"
 
-static FILE *SaveGameFP;
+// [AP] Savegames are built and read in memory, and go to and from disk
+// in one go.
+static MEMFILE *SaveGameFP;
+static byte *SaveGameData;
 
 int vanilla_savegame_limit = 1;
 
@@ -66,17 +71,28 @@ char *SV_Filename(int slot)
 
 void SV_Open(char *fileName)
 {
-    SaveGameFP = M_fopen(fileName, "wb");
+    SaveGameFP = mem_fopen_write();
 }
 
 void SV_OpenRead(char *filename)
 {
-    SaveGameFP = M_fopen(filename, "rb");
+    int length;
 
-    if (SaveGameFP == NULL)
+    if (!M_FileExists(filename))
     {
         I_Error("Could not load savegame %s", filename);
     }
+
+    length = M_ReadFile(filename, &SaveGameData);
+    SaveGameFP = mem_fopen_read(SaveGameData, length);
+}
+
+void SV_CloseRead(void)
+{
+    mem_fclose(SaveGameFP);
+    Z_Free(SaveGameData);
+    SaveGameFP = NULL;
+    SaveGameData = NULL;
 }
 
 //==========================================================================
@@ -87,16 +103,36 @@ void SV_OpenRead(char *filename)
 
 void SV_Close(char *fileName)
 {
+    void *data;
+    size_t length;
+    char *tempFileName;
+
     SV_WriteByte(SAVE_GAME_TERMINATOR);
 
     // Enforce the same savegame size limit as in Vanilla Heretic
 
-    if (vanilla_savegame_limit && ftell(SaveGameFP) > SAVEGAMESIZE)
+    if (vanilla_savegame_limit && mem_ftell(SaveGameFP) > SAVEGAMESIZE)
     {
         I_Error("Savegame buffer overrun");
     }
 
-    fclose(SaveGameFP);
+    // [AP] Write to a temporary file and rename it over the old savegame,
+    // so that an existing save is never left half-written.
+
+    mem_get_buf(SaveGameFP, &data, &length);
+    tempFileName = M_StringJoin(fileName, ".tmp", NULL);
+
+    if (!M_WriteFile(tempFileName, data, length))
+    {
+        I_Error("Failed to write savegame '%s'.", tempFileName);
+    }
+
+    mem_fclose(SaveGameFP);
+    SaveGameFP = NULL;
+
+    M_remove(fileName);
+    M_rename(tempFileName, fileName);
+    free(tempFileName);
 }
 
 //==========================================================================
@@ -107,7 +143,7 @@ void SV_Close(char *fileName)
 
 void SV_Write(void *buffer, int size)
 {
-    fwrite(buffer, size, 1, SaveGameFP);
+    mem_fwrite(buffer, size, 1, SaveGameFP);
 }
 
 void SV_WriteByte(byte val)
@@ -142,7 +178,7 @@ void SV_WritePtr(const void *ptr)
 
 void SV_Read(void *buffer, int size)
 {
-    int retval = fread(buffer, 1, size, SaveGameFP);
+    int retval = mem_fread(buffer, 1, size, SaveGameFP);
     if (retval != size)
     {
         I_Error("Incomplete read in SV_Read: Expected %d, got %d bytes",
@@ -24,6 +24,7 @@
 #include "i_system.h"
 #include "m_argv.h"
 #include "m_bbox.h"
+#include "m_memory.h" // [AP] M_TrimMemory()
 #include "p_local.h"
 #include "s_sound.h"
 #include "p_extnodes.h"
@@ -543,17 +544,65 @@ void get_fit_dimensions(fixed_t x, fixed_t y, fixed_t* fit_radius, fixed_t* fit_
         }
     }
 
-    for (int i = 0, len = sizeof(radius_checks) / sizeof(fixed_t); i < len; ++i)
+    // A box that hits a line still hits it when grown, so whether a radius
+    // fits is monotonic. Binary search the largest one instead of probing
+    // them all from the biggest (and most expensive) down.
+    int lo = 0;
+    int hi = sizeof(radius_checks) / sizeof(fixed_t) - 1;
+    *fit_radius = radius_checks[hi];
+    while (lo <= hi)
     {
-        if (check_position(x, y, radius_checks[i]) || i == len - 1)
+        int mid = (lo + hi) / 2;
+        if (check_position(x, y, radius_checks[mid]))
         {
-            *fit_radius = radius_checks[i];
-            break;
+            *fit_radius = radius_checks[mid];
+            hi = mid - 1;
+        }
+        else
+        {
+            lo = mid + 1;
         }
     }
 }
 
 
+// Fit results only depend on the map geometry, so they are kept per map
+// lump for the whole session. Levels get reloaded a lot (reset on death,
+// coming back from the level select).
+typedef struct
+{
+    int lump;
+    int numthings;
+    fixed_t* fit_radius; // Per thing index, 0 until probed
+    fixed_t* fit_height;
+} fit_cache_t;
+
+static fit_cache_t* fit_caches = NULL;
+static int fit_cache_count = 0;
+
+static fit_cache_t* get_fit_cache(int lump, int numthings)
+{
+    fit_cache_t* fit_cache;
+    int i;
+
+    for (i = 0; i < fit_cache_count; ++i)
+    {
+        if (fit_caches[i].lump == lump && fit_caches[i].numthings == numthings)
+            return &fit_caches[i];
+    }
+
+    fit_caches = I_Realloc(fit_caches, sizeof(fit_cache_t) * (fit_cache_count + 1));
+    fit_cache = &fit_caches[fit_cache_count++];
+    fit_cache->lump = lump;
+    fit_cache->numthings = numthings;
+    fit_cache->fit_radius = Z_Malloc(sizeof(fixed_t) * numthings, PU_STATIC, NULL);
+    fit_cache->fit_height = Z_Malloc(sizeof(fixed_t) * numthings, PU_STATIC, NULL);
+    memset(fit_cache->fit_radius, 0, sizeof(fixed_t) * numthings);
+    memset(fit_cache->fit_height, 0, sizeof(fixed_t) * numthings);
+    return fit_cache;
+}
+
+
 /*
 =================
 =
@@ -565,7 +614,7 @@ void get_fit_dimensions(fixed_t x, fixed_t y, fixed_t* fit_radius, fixed_t* fit_
 void P_LoadThings(int lump)
 {
     byte *data;
-    int i, j;
+    int i;
     mapthing_t spawnthing;
     mapthing_t spawnthing_player1_start;
     mapthing_t *mt;
@@ -579,7 +628,8 @@ void P_LoadThings(int lump)
     const char* ap_seed = apdoom_get_seed();
     unsigned long long seed = hash_seed(ap_seed);
     seed += gameepisode * 9 + gamemap;
-    srand(seed);
+    ap_rng_t rng;
+    ap_rng_seed(&rng, seed);
 
     int things_type_remap[1024] = {0};
 
@@ -606,6 +656,7 @@ void P_LoadThings(int lump)
         int monster_count = 0;
         monster_spawn_def_t spawns[1024] = {0};
         int spawn_count = 0;
+        fit_cache_t* fit_cache = get_fit_cache(lump, numthings);
 
         // Collect spawn points
         mt = (mapthing_t *)data;
@@ -626,7 +677,10 @@ void P_LoadThings(int lump)
                 if (random_monster_defs[j].doom_type == mt->type)
                 {
                     tmtype = mt->type;
-                    get_fit_dimensions(mt->x * FRACUNIT, mt->y * FRACUNIT, &spawns[spawn_count].fit_radius, &spawns[spawn_count].fit_height);
+                    if (!fit_cache->fit_radius[i])
+                        get_fit_dimensions(mt->x * FRACUNIT, mt->y * FRACUNIT, &fit_cache->fit_radius[i], &fit_cache->fit_height[i]);
+                    spawns[spawn_count].fit_radius = fit_cache->fit_radius[i];
+                    spawns[spawn_count].fit_height = fit_cache->fit_height[i];
                     spawns[spawn_count].og_monster = &random_monster_defs[j];
                     spawns[spawn_count++].index = i;
                     break;
@@ -665,12 +719,12 @@ void P_LoadThings(int lump)
 
             while (monster_count < spawn_count)
             {
-                int rnd = rand() % total;
+                int rnd = ap_rng_range(&rng, total);
                 for (int i = 0; i < NUM_RMC; ++i)
                 {
                     if (rnd < ratios[i])
                     {
-                        rnd = rand() % rmc_ratios[i];
+                        rnd = ap_rng_range(&rng, rmc_ratios[i]);
                         for (int j = 0; j < defs_by_rmc_count[i]; ++j)
                         {
                             if (rnd < defs_by_rmc[i][j]->frequency)
@@ -698,7 +752,7 @@ void P_LoadThings(int lump)
 
             while (monster_count < spawn_count)
             {
-                int rnd = rand() % total;
+                int rnd = ap_rng_range(&rng, total);
                 for (int i = 0; i < monster_def_count; ++i)
                 {
                     random_monster_def_t* monster = &random_monster_defs[i];
@@ -722,7 +776,7 @@ void P_LoadThings(int lump)
                     iron_lynch_count++;
             while (iron_lynch_count < 2)
             {
-                int i = rand() % monster_count;
+                int i = ap_rng_range(&rng, monster_count);
                 if (monsters[i]->doom_type != 6)
                 {
                     monsters[i] = &random_monster_defs[12];
@@ -740,7 +794,7 @@ void P_LoadThings(int lump)
                     iron_lynch_count++;
             while (iron_lynch_count < 1)
             {
-                int i = rand() % monster_count;
+                int i = ap_rng_range(&rng, monster_count);
                 if (monsters[i]->doom_type != 6)
                 {
                     monsters[i] = &random_monster_defs[12];
@@ -752,7 +806,7 @@ void P_LoadThings(int lump)
         // Randomly pick them until empty, and place them in different spots
         for (i = 0; i < spawn_count; i++)
         {
-            int idx = rand() % monster_count;
+            int idx = ap_rng_range(&rng, monster_count);
             spawns[i].monster = monsters[idx];
             monsters[idx] = monsters[monster_count - 1];
             monster_count--;
@@ -769,7 +823,7 @@ void P_LoadThings(int lump)
                 int tries = 1000;
                 while (tries--)
                 {
-                    int j = rand() % spawn_count;
+                    int j = ap_rng_range(&rng, spawn_count);
                     if (j == i) continue;
                     monster_spawn_def_t* spawn2 = &spawns[j];
                     if (spawn1->monster->height <= spawn2->fit_height &&
@@ -848,7 +902,7 @@ void P_LoadThings(int lump)
             mt = (mapthing_t *)data;
             for (i = 0; i < index_count; i++)
             {
-                int idx = rand() % item_count;
+                int idx = ap_rng_range(&rng, item_count);
                 things_type_remap[indices[i]] = items[idx];
                 items[idx] = items[item_count - 1];
                 item_count--;
@@ -927,10 +981,10 @@ void P_LoadThings(int lump)
                     case 10: // Wand Crystal
                     case 81: // Crystal Vial
                     {
-                        int rnd = rand() % total;
+                        int rnd = ap_rng_range(&rng, total);
                         if (rnd < ratios[0])
                         {
-                            switch (rand()%2)
+                            switch (ap_rng_range(&rng, 2))
                             {
                                 case 0: things_type_remap[i] = 81; break; // Crystal Vial
                                 case 1: things_type_remap[i] = 10; break; // Wand Crystal
@@ -939,7 +993,7 @@ void P_LoadThings(int lump)
                         }
                         else if (rnd < ratios[0] + ratios[1])
                         {
-                            switch (rand()%4)
+                            switch (ap_rng_range(&rng, 4))
                             {
                                 case 0: things_type_remap[i] = 54; break; // Claw Orb
                                 case 1: things_type_remap[i] = 22; break; // Flame Orb
@@ -949,7 +1003,7 @@ void P_LoadThings(int lump)
                         }
                         else
                         {
-                            switch (rand()%6)
+                            switch (ap_rng_range(&rng, 6))
                             {
                                 case 0: things_type_remap[i] = 12; break; // Crystal Geode
                                 case 1: things_type_remap[i] = 55; break; // Energy Orb
@@ -1002,17 +1056,7 @@ void P_LoadThings(int lump)
                     spawnthing.type = 20001;
                 else
                     spawnthing.type = 20000;
-                int skip = 0;
-                ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-                for (j = 0; j < level_state->check_count; ++j)
-                {
-                    if (level_state->checks[j] == i)
-                    {
-                        skip = 1;
-                        break;
-                    }
-                }
-                if (skip)
+                if (apdoom_is_location_checked(ap_make_level_index(gameepisode, gamemap), i))
                     continue;
             }
         }
@@ -1380,6 +1424,37 @@ static void P_RemoveSlimeTrails(void)
     }
 }
 
+// [AP] Pull a map's lumps into the zone cache ahead of P_SetupLevel, so
+// entering it from the level select doesn't wait on the WAD reads. They're
+// hinted and read in file order; mapped WADs aren't read here at all, so
+// the hint is what saves their page faults later.
+void P_PrefetchMap(int episode, int map)
+{
+    char lumpname[9];
+    int lumpnum;
+    lumpindex_t lumps[ML_BLOCKMAP];
+    int i, count;
+
+    snprintf(lumpname, sizeof(lumpname), "E%dM%d", episode, map);
+    lumpnum = W_CheckNumForName(lumpname);
+    if (lumpnum < 0)
+        return;
+
+    for (i = ML_THINGS, count = 0; i <= ML_BLOCKMAP && lumpnum + i < numlumps; ++i)
+    {
+        lumps[count++] = lumpnum + i;
+    }
+
+    W_SortLumps(lumps, count);
+    W_PrefetchLumps(lumps, count);
+
+    for (i = 0; i < count; ++i)
+    {
+        W_CacheLumpNum(lumps[i], PU_STATIC);
+        W_ReleaseLumpNum(lumps[i]);
+    }
+}
+
 /*
 =================
 =
@@ -1416,6 +1491,7 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     S_Start();                  // make sure all sounds are stopped before Z_FreeTags
 
     Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+    M_TrimMemory(); // [AP] -lowmem empties the caches between levels
 
     P_InitThinkers();
 
@@ -1427,11 +1503,13 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     lumpname[2] = 'M';
     lumpname[3] = '0' + map;
     lumpname[4] = 0;
+    Z_StatsLevel(lumpname); // [AP] -zonestats
     leveltime = 0;
     leveltimesinceload = 0;
     oldleveltime = 0;  // [crispy] Track if game is running
 
     lumpnum = W_GetNumForName(lumpname);
+    P_PrefetchMap(episode, map); // [AP] one sweep instead of a seek per lump
 
     // [crispy] check and log map and nodes format
     crispy_mapformat = P_CheckMapFormat(lumpnum);
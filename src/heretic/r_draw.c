@@ -18,6 +18,7 @@
 #include "doomdef.h"
 #include "deh_str.h"
 #include "r_local.h"
+#include "r_kernels.h"
 #include "i_video.h"
 #include "v_video.h"
 
@@ -55,15 +56,32 @@ byte *dc_source;                // first pixel in a column (possibly virtual)
 
 int dccount;                    // just for profiling
 
+// [AP] Fill in what every column drawer passes to the kernel, see
+// r_kernels.h. Call once dc_yl to dc_yh are final.
+
+static void R_SetupColumn(r_column_t *column)
+{
+    column->dest = ylookup[dc_yl] + columnofs[dc_x];
+    column->pitch = SCREENWIDTH;
+    column->count = dc_yh - dc_yl + 1;
+    column->source = dc_source;
+    column->fracstep = dc_iscale;
+    column->frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
+    column->texheight = dc_texheight;
+    column->colormap[0] = dc_colormap[0];
+    column->colormap[1] = dc_colormap[1];
+    column->brightmap = NULL;
+    column->translation = NULL;
+    column->blend = NULL;
+    column->blendswap = false;
+    column->twin = 0;
+}
+
 void R_DrawColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1;
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -71,55 +89,16 @@ void R_DrawColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-  if (dc_texheight & heightmask) // not a power of 2 -- killough
-  {
-    heightmask++;
-    heightmask <<= FRACBITS;
-
-    if (frac < 0)
-	while ((frac += heightmask) < 0);
-    else
-	while (frac >= heightmask)
-	    frac -= heightmask;
-
-    do
-    {
-	// [crispy] brightmaps
-	const byte source = dc_source[frac>>FRACBITS];
-	*dest = dc_colormap[dc_brightmap[source]][source];
-	dest += SCREENWIDTH;
-	if ((frac += fracstep) >= heightmask)
-	    frac -= heightmask;
-    } while (count--);
-  }
-  else // texture height is a power of 2 -- killough
-  {
-    do
-    {
-        // [crispy] brightmaps
-        const byte source = dc_source[(frac >> FRACBITS) & heightmask];
-        *dest = dc_colormap[dc_brightmap[source]][source];
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    }
-    while (count--);
-  }
+    R_SetupColumn(&column);
+    column.brightmap = dc_brightmap;    // [crispy] brightmaps
+    R_KernelColumn(&column);
 }
 
 void R_DrawColumnLow(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -128,62 +107,23 @@ void R_DrawColumnLow(void)
 //      dccount++;
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[frac>>FRACBITS];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[(frac >> FRACBITS) & heightmask];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        }
-        while (count--);
-    }
+    R_SetupColumn(&column);
+    column.brightmap = dc_brightmap;    // [crispy] brightmaps
+    R_KernelColumn(&column);
 }
 
 // Translucent column draw - blended with background using tinttable.
 
 void R_DrawTLColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
     if (!dc_yl)
         dc_yl = 1;
     if (dc_yh == viewheight - 1)
         dc_yh = viewheight - 2;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -191,45 +131,9 @@ void R_DrawTLColumn(void)
         I_Error("R_DrawTLColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            *dest =
-                tinttable[((*dest) << 8) +
-                          dc_colormap[0][dc_source[frac >> FRACBITS]]];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            *dest =
-                tinttable[((*dest) << 8) +
-                          dc_colormap[0][dc_source[(frac >> FRACBITS) & heightmask]]];
-
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        }
-        while (count--);
-    }
+    R_SetupColumn(&column);
+    column.blend = tinttable;
+    R_KernelColumn(&column);
 }
 
 /*
@@ -245,12 +149,9 @@ byte *translationtables;
 
 void R_DrawTranslatedColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -258,28 +159,17 @@ void R_DrawTranslatedColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    do
-    {
-        *dest = dc_colormap[0][dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    }
-    while (count--);
+    R_SetupColumn(&column);
+    column.texheight = 0;
+    column.translation = dc_translation;
+    R_KernelColumn(&column);
 }
 
 void R_DrawTranslatedTLColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -287,21 +177,11 @@ void R_DrawTranslatedTLColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    do
-    {
-        *dest = tinttable[((*dest) << 8)
-                          +
-                          dc_colormap[0][dc_translation
-                                      [dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    }
-    while (count--);
+    R_SetupColumn(&column);
+    column.texheight = 0;
+    column.translation = dc_translation;
+    column.blend = tinttable;
+    R_KernelColumn(&column);
 }
 
 //--------------------------------------------------------------------------
@@ -357,11 +237,27 @@ const byte *ds_brightmap;       // [crispy] brightmaps
 
 int dscount;                    // just for profiling
 
+// [AP] Fill in what both span drawers pass to the kernel, see r_kernels.h
+
+static void R_SetupSpan(r_span_t *span)
+{
+    span->dest = ylookup[ds_y] + columnofs[ds_x1];
+    span->step = 1;
+    span->count = ds_x2 - ds_x1 + 1;
+    span->source = ds_source;
+    span->xfrac = ds_xfrac;
+    span->yfrac = ds_yfrac;
+    span->xstep = ds_xstep;
+    span->ystep = ds_ystep;
+    span->colormap[0] = ds_colormap[0];
+    span->colormap[1] = ds_colormap[1];
+    span->brightmap = ds_brightmap;     // [crispy] brightmaps
+    span->twin = 0;
+}
+
 void R_DrawSpan(void)
 {
-    fixed_t xfrac, yfrac;
-    byte *dest;
-    int count, spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1 || ds_x1 < 0 || ds_x2 >= SCREENWIDTH
@@ -370,28 +266,13 @@ void R_DrawSpan(void)
 //      dscount++;
 #endif
 
-    xfrac = ds_xfrac;
-    yfrac = ds_yfrac;
-
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-    count = ds_x2 - ds_x1;
-    do
-    {
-        byte source;
-        spot = ((yfrac >> (16 - 6)) & (63 * 64)) + ((xfrac >> 16) & 63);
-        source = ds_source[spot];
-        *dest++ = ds_colormap[ds_brightmap[source]][source];
-        xfrac += ds_xstep;
-        yfrac += ds_ystep;
-    }
-    while (count--);
+    R_SetupSpan(&span);
+    R_KernelSpan(&span);
 }
 
 void R_DrawSpanLow(void)
 {
-    fixed_t xfrac, yfrac;
-    byte *dest;
-    int count, spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1 || ds_x1 < 0 || ds_x2 >= SCREENWIDTH
@@ -400,21 +281,10 @@ void R_DrawSpanLow(void)
 //      dscount++;
 #endif
 
-    xfrac = ds_xfrac;
-    yfrac = ds_yfrac;
-
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-    count = ds_x2 - ds_x1;
-    do
-    {
-        byte source;
-        spot = ((yfrac >> (16 - 6)) & (63 * 64)) + ((xfrac >> 16) & 63);
-        source = ds_source[spot];
-        *dest = ds_colormap[ds_brightmap[source]][source];
-        xfrac += ds_xstep;
-        yfrac += ds_ystep;
-    }
-    while (count--);
+    // Every pixel lands on the first, as it always has
+    R_SetupSpan(&span);
+    span.step = 0;
+    R_KernelSpan(&span);
 }
 
 
@@ -925,6 +925,7 @@ void R_RenderPlayerView(player_t * player)
 {
     extern boolean automapactive;
 
+    I_LatchFracTic(); // [AP] -latelatch
     R_SetupFrame(player);
     R_ClearClipSegs();
     R_ClearDrawSegs();
@@ -38,87 +38,102 @@
 #define SEQUENCE 1024
 #define FLATSIZE (64 * 64)
 
-static int *offsets;
-static int *offset;
-
 #define AMP 2
 #define AMP2 2
 #define SPEED 40
 
-void R_InitDistortedFlats()
+// [AP] Both displaced coordinates are a sum of one term in x and one in y,
+// so a frame of the sequence is four 64 entry tables instead of a 4096
+// entry offset map. They're rebuilt when the tic changes, which replaces
+// the 16 MB table for all SEQUENCE frames.
+static int swirl_x_of_x[64];
+static int swirl_x_of_y[64];
+static int swirl_y_of_x[64];
+static int swirl_y_of_y[64];
+
+// [AP] Flats distorted this tic. More than one swirling flat can be in
+// view, so they don't keep undoing each other's work.
+#define SWIRL_CACHE_SIZE 8
+
+static byte swirl_flats[SWIRL_CACHE_SIZE][FLATSIZE];
+static int swirl_flatnums[SWIRL_CACHE_SIZE];
+static int swirl_next_slot;
+static int swirltic = -1;
+
+static void R_SwirlFrame(int i)
 {
-	if (!offsets)
-	{
-		int i;
-
-		offsets = I_Realloc(NULL, SEQUENCE * FLATSIZE * sizeof(*offsets));
-		offset = offsets;
-
-		for (i = 0; i < SEQUENCE; i++)
-		{
-			int x, y;
-
-			for (x = 0; x < 64; x++)
-			{
-				for (y = 0; y < 64; y++)
-				{
-					int x1, y1;
-					int sinvalue, sinvalue2;
-
-					sinvalue = (y * swirlfactor + i * SPEED * 5 + 900) & 8191;
-					sinvalue2 = (x * swirlfactor2 + i * SPEED * 4 + 300) & 8191;
-					x1 = x + 128
-					   + ((finesine[sinvalue] * AMP) >> FRACBITS)
-					   + ((finesine[sinvalue2] * AMP2) >> FRACBITS);
-
-					sinvalue = (x * swirlfactor + i * SPEED * 3 + 700) & 8191;
-					sinvalue2 = (y * swirlfactor2 + i * SPEED * 4 + 1200) & 8191;
-					y1 = y + 128
-					   + ((finesine[sinvalue] * AMP) >> FRACBITS)
-					   + ((finesine[sinvalue2] * AMP2) >> FRACBITS);
-
-					x1 &= 63;
-					y1 &= 63;
-
-					offset[(y << 6) + x] = (y1 << 6) + x1;
-				}
-			}
+	int j;
 
-			offset += FLATSIZE;
-		}
+	for (j = 0; j < 64; j++)
+	{
+		swirl_x_of_x[j] = j + 128
+		                + ((finesine[(j * swirlfactor2 + i * SPEED * 4 + 300) & 8191] * AMP2) >> FRACBITS);
+		swirl_x_of_y[j] = (finesine[(j * swirlfactor + i * SPEED * 5 + 900) & 8191] * AMP) >> FRACBITS;
+		swirl_y_of_x[j] = (finesine[(j * swirlfactor + i * SPEED * 3 + 700) & 8191] * AMP) >> FRACBITS;
+		swirl_y_of_y[j] = j + 128
+		                + ((finesine[(j * swirlfactor2 + i * SPEED * 4 + 1200) & 8191] * AMP2) >> FRACBITS);
 	}
 }
 
+void R_InitDistortedFlats()
+{
+	swirltic = -1;
+}
+
 byte *R_DistortedFlat(int flatnum)
 {
-	static int swirltic = -1;
-	static int swirlflat = -1;
-	static byte distortedflat[FLATSIZE];
+	byte *distortedflat;
+	int slot;
 
 	if (swirltic != leveltime)
 	{
-		offset = offsets + ((leveltime & (SEQUENCE - 1)) * FLATSIZE);
+		R_SwirlFrame(leveltime & (SEQUENCE - 1));
 
+		for (slot = 0; slot < SWIRL_CACHE_SIZE; slot++)
+		{
+			swirl_flatnums[slot] = -1;
+		}
+		swirl_next_slot = 0;
 		swirltic = leveltime;
-		swirlflat = -1;
 	}
 
-	if (swirlflat != flatnum)
+	for (slot = 0; slot < SWIRL_CACHE_SIZE; slot++)
+	{
+		if (swirl_flatnums[slot] == flatnum)
+		{
+			return swirl_flats[slot];
+		}
+	}
+
+	slot = swirl_next_slot;
+	swirl_next_slot = (swirl_next_slot + 1) % SWIRL_CACHE_SIZE;
+	distortedflat = swirl_flats[slot];
+
 	{
 		byte *normalflat;
-		int i;
+		int x, y;
 
 		normalflat = W_CacheLumpNum(flatnum, PU_STATIC);
 
-		for (i = 0; i < FLATSIZE; i++)
+		for (y = 0; y < 64; y++)
 		{
-			distortedflat[i] = normalflat[offset[i]];
+			const int x_of_y = swirl_x_of_y[y];
+			const int y_of_y = swirl_y_of_y[y];
+			byte *dest = distortedflat + (y << 6);
+
+			for (x = 0; x < 64; x++)
+			{
+				const int x1 = (swirl_x_of_x[x] + x_of_y) & 63;
+				const int y1 = (swirl_y_of_x[x] + y_of_y) & 63;
+
+				dest[x] = normalflat[(y1 << 6) + x1];
+			}
 		}
 
 		W_ReleaseLumpNum(flatnum);
-
-		swirlflat = flatnum;
 	}
 
+	swirl_flatnums[slot] = flatnum;
+
 	return distortedflat;
 }
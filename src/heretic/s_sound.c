@@ -113,6 +113,36 @@ void S_StartSong(int song, boolean loop)
     mus_song = song;
 }
 
+// [AP] Get the music of a level ready before the level is entered.
+
+void S_PrefetchLevelMusic(int episode, int map)
+{
+    ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(episode, map));
+    int song = level_state->music;
+    int lumpnum;
+
+    if (song < mus_e1m1 || song >= NUMMUSIC)
+    {
+        return;
+    }
+
+    if (S_music[song][1].name && W_CheckNumForName(S_music[song][1].name) > 0)
+    {
+        lumpnum = W_GetNumForName(S_music[song][1].name);
+    }
+    else
+    {
+        lumpnum = W_CheckNumForName(S_music[song][0].name);
+    }
+
+    if (lumpnum < 0)
+    {
+        return;
+    }
+
+    I_PrefetchSong(W_CacheLumpNum(lumpnum, PU_CACHE), W_LumpLength(lumpnum));
+}
+
 static mobj_t *GetSoundListener(void)
 {
     static degenmobj_t dummy_listener;
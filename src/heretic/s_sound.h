@@ -32,6 +32,7 @@ void S_PauseSound(void);
 void S_ResumeSound(void);
 void S_UpdateSounds(mobj_t * listener);
 void S_StartSong(int song, boolean loop);
+void S_PrefetchLevelMusic(int episode, int map); // [AP]
 void S_Init(void);
 void S_GetChannelInfo(SoundInfo_t * s);
 void S_SetMaxVolume(boolean fullprocess);
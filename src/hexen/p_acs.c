@@ -40,6 +40,10 @@
 #define TEXTURE_MIDDLE 1
 #define TEXTURE_BOTTOM 2
 
+// [AP] The condition is checked inline; only a failure costs a call.
+#define ACSAssert(condition, ...) \
+    do { if (!(condition)) ACSAssertFailed(__VA_ARGS__); } while (0)
+
 // TYPES -------------------------------------------------------------------
 
 typedef PACKED_STRUCT (
@@ -55,6 +59,7 @@ typedef PACKED_STRUCT (
 
 // PRIVATE FUNCTION PROTOTYPES ---------------------------------------------
 
+static void ACSAssertFailed(const char *fmt, ...) NORETURN PRINTF_ATTR(1, 2);
 static void StartOpenACS(int number, int infoIndex, int offset);
 static void ScriptFinished(int number);
 static boolean TagBusy(int tag);
@@ -185,6 +190,10 @@ acsstore_t ACSStore[MAX_ACS_STORE + 1]; // +1 for termination marker
 // PRIVATE DATA DEFINITIONS ------------------------------------------------
 
 static char EvalContext[64];
+static boolean Evaluating;
+static unsigned int EvalOffset;
+static int EvalCmd;
+static int *ActionCodeWords;
 static acs_t *ACScript;
 static unsigned int PCodeOffset;
 static byte SpecArgs[8];
@@ -303,21 +312,24 @@ static int (*PCodeCmds[]) (void) =
 
 //==========================================================================
 //
-// ACSAssert
+// ACSAssertFailed
 //
-// Check that the given condition evaluates to true. If it does not, exit
-// with an I_Error() printing the given message.
+// Called by ACSAssert() when its condition does not hold: exit with an
+// I_Error() printing the given message. While a script is running, the
+// context of the instruction is only formatted here, not for every
+// instruction.
 //
 //==========================================================================
 
-static void ACSAssert(int condition, const char *fmt, ...)
+static void ACSAssertFailed(const char *fmt, ...)
 {
     char buf[128];
     va_list args;
 
-    if (condition)
+    if (Evaluating)
     {
-        return;
+        M_snprintf(EvalContext, sizeof(EvalContext), "script %d @0x%x, cmd=%d",
+                   ACSInfo[ACScript->infoIndex].number, EvalOffset, EvalCmd);
     }
 
     va_start(args, fmt);
@@ -332,19 +344,27 @@ static void ACSAssert(int condition, const char *fmt, ...)
 //
 // Read a 32-bit value from the loaded ACS lump at the location pointed to
 // by PCodeOffset, advancing PCodeOffset to the next value in the process.
+// [AP] Aligned values, which is all of the code acc generates, come from
+// the copy decoded at load time.
 //
 //==========================================================================
 
 static int ReadCodeInt(void)
 {
     int result;
-    int *ptr;
 
     ACSAssert(PCodeOffset + 3 < ActionCodeSize,
               "unexpectedly reached end of ACS lump");
 
-    ptr = (int *) (ActionCodeBase + PCodeOffset);
-    result = LONG(*ptr);
+    if ((PCodeOffset & 3) == 0)
+    {
+        result = ActionCodeWords[PCodeOffset / 4];
+    }
+    else
+    {
+        memcpy(&result, ActionCodeBase + PCodeOffset, sizeof(result));
+        result = LONG(result);
+    }
     PCodeOffset += 4;
 
     return result;
@@ -455,6 +475,14 @@ void P_LoadACScripts(int lump)
     ActionCodeBase = W_CacheLumpNum(lump, PU_LEVEL);
     ActionCodeSize = W_LumpLength(lump);
 
+    // [AP] Decode the lump into native endian words up front.
+    ActionCodeWords = Z_Malloc((ActionCodeSize / 4 + 1) * sizeof(int),
+                               PU_LEVEL, NULL);
+    for (i = 0; i < ActionCodeSize / 4; i++)
+    {
+        ActionCodeWords[i] = LONG(((int *) ActionCodeBase)[i]);
+    }
+
     M_snprintf(EvalContext, sizeof(EvalContext),
                "header parsing of lump #%d", lump);
 
@@ -792,14 +820,14 @@ void T_InterpretACS(thinker_t *thinker)
     }
     ACScript = script;
     PCodeOffset = ACScript->ip;
+    Evaluating = true;
 
     do
     {
-        M_snprintf(EvalContext, sizeof(EvalContext), "script %d @0x%x",
-                   ACSInfo[script->infoIndex].number, PCodeOffset);
+        EvalOffset = PCodeOffset;
+        EvalCmd = -1;
         cmd = ReadCodeInt();
-        M_snprintf(EvalContext, sizeof(EvalContext), "script %d @0x%x, cmd=%d",
-                   ACSInfo[script->infoIndex].number, PCodeOffset, cmd);
+        EvalCmd = cmd;
         ACSAssert(cmd >= 0, "negative ACS instruction %d", cmd);
         ACSAssert(cmd < arrlen(PCodeCmds),
                   "invalid ACS instruction %d (maybe this WAD is designed "
@@ -808,6 +836,7 @@ void T_InterpretACS(thinker_t *thinker)
         action = PCodeCmds[cmd]();
     } while (action == SCRIPT_CONTINUE);
 
+    Evaluating = false;
     ACScript->ip = PCodeOffset;
 
     if (action == SCRIPT_TERMINATE)
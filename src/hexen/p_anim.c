@@ -60,6 +60,13 @@ typedef struct
     int endFrameDef;
 } animDef_t;
 
+// [AP] A sector lit by lightning, and its light level before the flash
+typedef struct
+{
+    sector_t *sector;
+    int lightlevel;
+} lightningSector_t;
+
 // EXTERNAL FUNCTION PROTOTYPES --------------------------------------------
 
 // PUBLIC FUNCTION PROTOTYPES ----------------------------------------------
@@ -84,7 +91,8 @@ static int AnimDefCount;
 static boolean LevelHasLightning;
 static int NextLightningFlash;
 static int LightningFlash;
-static int *LightningLightLevels;
+static lightningSector_t *LightningSectors;
+static int LightningSectorCount;
 
 // CODE --------------------------------------------------------------------
 
@@ -234,44 +242,32 @@ static void P_LightningFlash(void)
 {
     int i;
     sector_t *tempSec;
-    int *tempLight;
-    boolean foundSec;
+    lightningSector_t *tempLight;
     int flashLight;
 
+    // [AP] Only the sectors P_InitLightning found are visited; nothing
+    // else changes whether a sector is lit by lightning.
     if (LightningFlash)
     {
         LightningFlash--;
         if (LightningFlash)
         {
-            tempLight = LightningLightLevels;
-            tempSec = sectors;
-            for (i = 0; i < numsectors; i++, tempSec++)
+            tempLight = LightningSectors;
+            for (i = 0; i < LightningSectorCount; i++, tempLight++)
             {
-                if (tempSec->ceilingpic == skyflatnum
-                    || tempSec->special == LIGHTNING_SPECIAL
-                    || tempSec->special == LIGHTNING_SPECIAL2)
+                tempSec = tempLight->sector;
+                if (tempLight->lightlevel < tempSec->lightlevel - 4)
                 {
-                    if (*tempLight < tempSec->lightlevel - 4)
-                    {
-                        tempSec->lightlevel -= 4;
-                    }
-                    tempLight++;
+                    tempSec->lightlevel -= 4;
                 }
             }
         }
         else
         {                       // remove the alternate lightning flash special
-            tempLight = LightningLightLevels;
-            tempSec = sectors;
-            for (i = 0; i < numsectors; i++, tempSec++)
+            tempLight = LightningSectors;
+            for (i = 0; i < LightningSectorCount; i++, tempLight++)
             {
-                if (tempSec->ceilingpic == skyflatnum
-                    || tempSec->special == LIGHTNING_SPECIAL
-                    || tempSec->special == LIGHTNING_SPECIAL2)
-                {
-                    tempSec->lightlevel = *tempLight;
-                    tempLight++;
-                }
+                tempLight->sector->lightlevel = tempLight->lightlevel;
             }
             Sky1Texture = P_GetMapSky1Texture(gamemap);
         }
@@ -279,45 +275,37 @@ static void P_LightningFlash(void)
     }
     LightningFlash = (P_Random() & 7) + 8;
     flashLight = 200 + (P_Random() & 31);
-    tempSec = sectors;
-    tempLight = LightningLightLevels;
-    foundSec = false;
-    for (i = 0; i < numsectors; i++, tempSec++)
+    tempLight = LightningSectors;
+    for (i = 0; i < LightningSectorCount; i++, tempLight++)
     {
-        if (tempSec->ceilingpic == skyflatnum
-            || tempSec->special == LIGHTNING_SPECIAL
-            || tempSec->special == LIGHTNING_SPECIAL2)
+        tempSec = tempLight->sector;
+        tempLight->lightlevel = tempSec->lightlevel;
+        if (tempSec->special == LIGHTNING_SPECIAL)
         {
-            *tempLight = tempSec->lightlevel;
-            if (tempSec->special == LIGHTNING_SPECIAL)
-            {
-                tempSec->lightlevel += 64;
-                if (tempSec->lightlevel > flashLight)
-                {
-                    tempSec->lightlevel = flashLight;
-                }
-            }
-            else if (tempSec->special == LIGHTNING_SPECIAL2)
-            {
-                tempSec->lightlevel += 32;
-                if (tempSec->lightlevel > flashLight)
-                {
-                    tempSec->lightlevel = flashLight;
-                }
-            }
-            else
+            tempSec->lightlevel += 64;
+            if (tempSec->lightlevel > flashLight)
             {
                 tempSec->lightlevel = flashLight;
             }
-            if (tempSec->lightlevel < *tempLight)
+        }
+        else if (tempSec->special == LIGHTNING_SPECIAL2)
+        {
+            tempSec->lightlevel += 32;
+            if (tempSec->lightlevel > flashLight)
             {
-                tempSec->lightlevel = *tempLight;
+                tempSec->lightlevel = flashLight;
             }
-            tempLight++;
-            foundSec = true;
+        }
+        else
+        {
+            tempSec->lightlevel = flashLight;
+        }
+        if (tempSec->lightlevel < tempLight->lightlevel)
+        {
+            tempSec->lightlevel = tempLight->lightlevel;
         }
     }
-    if (foundSec)
+    if (LightningSectorCount)
     {
         Sky1Texture = P_GetMapSky2Texture(gamemap);     // set alternate sky                
         S_StartSound(NULL, SFX_THUNDER_CRASH);
@@ -364,11 +352,13 @@ void P_InitLightning(void)
 {
     int i;
     int secCount;
+    lightningSector_t *tempLight;
 
     if (!P_GetMapLightning(gamemap))
     {
         LevelHasLightning = false;
         LightningFlash = 0;
+        LightningSectorCount = 0;
         return;
     }
     LightningFlash = 0;
@@ -389,10 +379,23 @@ void P_InitLightning(void)
     else
     {
         LevelHasLightning = false;
+        LightningSectorCount = 0;
         return;
     }
-    LightningLightLevels = (int *) Z_Malloc(secCount * sizeof(int), PU_LEVEL,
-                                            NULL);
+    LightningSectors = Z_Malloc(secCount * sizeof(*LightningSectors),
+                                PU_LEVEL, NULL);
+    LightningSectorCount = secCount;
+    tempLight = LightningSectors;
+    for (i = 0; i < numsectors; i++)
+    {
+        if (sectors[i].ceilingpic == skyflatnum
+            || sectors[i].special == LIGHTNING_SPECIAL
+            || sectors[i].special == LIGHTNING_SPECIAL2)
+        {
+            tempLight->sector = &sectors[i];
+            tempLight++;
+        }
+    }
     NextLightningFlash = ((P_Random() & 15) + 5) * 35;  // don't flash at level start
 }
 
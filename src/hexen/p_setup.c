@@ -23,6 +23,7 @@
 #include "i_system.h"
 #include "m_argv.h"
 #include "m_bbox.h"
+#include "m_memory.h" // [AP] M_TrimMemory()
 #include "m_misc.h"
 #include "i_swap.h"
 #include "s_sound.h"
@@ -718,6 +719,7 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     }
 
     Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+    M_TrimMemory(); // [AP] -lowmem empties the caches between levels
 
     P_InitThinkers();
     leveltime = 0;
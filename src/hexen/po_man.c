@@ -45,6 +45,10 @@ static void RotatePt(int an, fixed_t * x, fixed_t * y, fixed_t startSpotX,
 static void UnLinkPolyobj(polyobj_t * po);
 static void LinkPolyobj(polyobj_t * po);
 static boolean CheckMobjBlocking(seg_t * seg, polyobj_t * po);
+static void ClearBox(fixed_t *box);
+static void AddToBox(fixed_t *box, fixed_t x, fixed_t y);
+static void AddBoxToBox(fixed_t *box, const fixed_t *other);
+static void FindBlockingThings(polyobj_t *po, const fixed_t *box);
 static void InitBlockMap(void);
 static void IterFindPolySegs(int x, int y, seg_t ** segList);
 static void SpawnPolyobj(int index, int tag, boolean crush);
@@ -64,6 +68,10 @@ static int PolySegCount;
 static fixed_t PolyStartX;
 static fixed_t PolyStartY;
 
+// [AP] Bounds of every thing that can block the polyobj being moved
+static fixed_t ThingsBox[4];
+static boolean ThingsBoxExact;
+
 // CODE --------------------------------------------------------------------
 
 // ===== Polyobj Event Code =====
@@ -774,6 +782,7 @@ boolean PO_MovePolyobj(int num, int x, int y, boolean interp)
     polyobj_t *po;
     vertex_t *prevPts;
     boolean blocked;
+    fixed_t box[4];
 
     if (!(po = GetPolyobj(num)))
     {
@@ -805,6 +814,13 @@ boolean PO_MovePolyobj(int num, int x, int y, boolean interp)
         (*prevPts).x += x;      // previous points are unique for each seg
         (*prevPts).y += y;
     }
+    ClearBox(box);
+    segList = po->segs;
+    for (count = po->numsegs; count; count--, segList++)
+    {
+        AddBoxToBox(box, (*segList)->linedef->bbox);
+    }
+    FindBlockingThings(po, box);
     segList = po->segs;
     for (count = po->numsegs; count; count--, segList++)
     {
@@ -985,6 +1001,7 @@ boolean PO_RotatePolyobj(int num, angle_t angle, boolean interp)
     vertex_t *prevPts;
     polyobj_t *po;
     boolean blocked;
+    fixed_t box[4];
 
     if (!(po = GetPolyobj(num)))
     {
@@ -997,6 +1014,19 @@ boolean PO_RotatePolyobj(int num, angle_t angle, boolean interp)
     po->rtheta = po->dtheta = 0; // [crispy]
     RotatePolyVertices(po, angle); // [crispy] prevPts get set here.
 
+    // [AP] Each seg is checked against its line's box from before or after
+    // the rotation, depending on whether another seg of the line came
+    // first, so the broadphase has to cover both.
+    ClearBox(box);
+    segList = po->segs;
+    for (count = po->numsegs; count; count--, segList++)
+    {
+        AddBoxToBox(box, (*segList)->linedef->bbox);
+        AddToBox(box, (*segList)->v1->x, (*segList)->v1->y);
+        AddToBox(box, (*segList)->v2->x, (*segList)->v2->y);
+    }
+    FindBlockingThings(po, box);
+
     segList = po->segs;
     blocked = false;
     validcount++;
@@ -1198,6 +1228,16 @@ static boolean CheckMobjBlocking(seg_t * seg, polyobj_t * po)
 
     ld = seg->linedef;
 
+    // [AP] Nothing to touch: the thing check below would reject them all.
+    if (ThingsBoxExact
+     && (ThingsBox[BOXRIGHT] <= ld->bbox[BOXLEFT]
+      || ThingsBox[BOXLEFT] >= ld->bbox[BOXRIGHT]
+      || ThingsBox[BOXTOP] <= ld->bbox[BOXBOTTOM]
+      || ThingsBox[BOXBOTTOM] >= ld->bbox[BOXTOP]))
+    {
+        return false;
+    }
+
     top = (ld->bbox[BOXTOP] - bmaporgy + MAXRADIUS) >> MAPBLOCKSHIFT;
     bottom = (ld->bbox[BOXBOTTOM] - bmaporgy - MAXRADIUS) >> MAPBLOCKSHIFT;
     left = (ld->bbox[BOXLEFT] - bmaporgx - MAXRADIUS) >> MAPBLOCKSHIFT;
@@ -1247,6 +1287,105 @@ static boolean CheckMobjBlocking(seg_t * seg, polyobj_t * po)
     return blocked;
 }
 
+//==========================================================================
+//
+// ClearBox
+//
+// Unlike M_AddToBox(), these helpers also work for the first point of a
+// cleared box.
+//
+//==========================================================================
+
+static void ClearBox(fixed_t *box)
+{
+    box[BOXTOP] = box[BOXRIGHT] = INT_MIN;
+    box[BOXBOTTOM] = box[BOXLEFT] = INT_MAX;
+}
+
+static void AddToBox(fixed_t *box, fixed_t x, fixed_t y)
+{
+    if (x < box[BOXLEFT])
+    {
+        box[BOXLEFT] = x;
+    }
+    if (x > box[BOXRIGHT])
+    {
+        box[BOXRIGHT] = x;
+    }
+    if (y < box[BOXBOTTOM])
+    {
+        box[BOXBOTTOM] = y;
+    }
+    if (y > box[BOXTOP])
+    {
+        box[BOXTOP] = y;
+    }
+}
+
+static void AddBoxToBox(fixed_t *box, const fixed_t *other)
+{
+    AddToBox(box, other[BOXLEFT], other[BOXBOTTOM]);
+    AddToBox(box, other[BOXRIGHT], other[BOXTOP]);
+}
+
+//==========================================================================
+//
+// FindBlockingThings
+//
+// [AP] Broadphase for CheckMobjBlocking(): one blockmap pass over the box
+// all the polyobj's segs can reach gathers the bounds of the things that
+// can block them, so segs away from every thing skip their own pass.
+// Crushing polyobjs may damage and kill things, which can change what is
+// in the blockmap, so for them this only skips the segs when there was
+// nothing near at all.
+//
+//==========================================================================
+
+static void FindBlockingThings(polyobj_t *po, const fixed_t *box)
+{
+    mobj_t *mobj;
+    int i, j;
+    int left, right, top, bottom;
+    boolean found;
+
+    top = (box[BOXTOP] - bmaporgy + MAXRADIUS) >> MAPBLOCKSHIFT;
+    bottom = (box[BOXBOTTOM] - bmaporgy - MAXRADIUS) >> MAPBLOCKSHIFT;
+    left = (box[BOXLEFT] - bmaporgx - MAXRADIUS) >> MAPBLOCKSHIFT;
+    right = (box[BOXRIGHT] - bmaporgx + MAXRADIUS) >> MAPBLOCKSHIFT;
+
+    bottom = bottom < 0 ? 0 : bottom;
+    bottom = bottom >= bmapheight ? bmapheight - 1 : bottom;
+    top = top < 0 ? 0 : top;
+    top = top >= bmapheight ? bmapheight - 1 : top;
+    left = left < 0 ? 0 : left;
+    left = left >= bmapwidth ? bmapwidth - 1 : left;
+    right = right < 0 ? 0 : right;
+    right = right >= bmapwidth ? bmapwidth - 1 : right;
+
+    ClearBox(ThingsBox);
+    found = false;
+
+    for (j = bottom * bmapwidth; j <= top * bmapwidth; j += bmapwidth)
+    {
+        for (i = left; i <= right; i++)
+        {
+            for (mobj = blocklinks[j + i]; mobj; mobj = mobj->bnext)
+            {
+                if (mobj->flags & MF_SOLID || mobj->player)
+                {
+                    AddToBox(ThingsBox, mobj->x - mobj->radius,
+                                        mobj->y - mobj->radius);
+                    AddToBox(ThingsBox, mobj->x + mobj->radius,
+                                        mobj->y + mobj->radius);
+                    found = true;
+                }
+            }
+        }
+    }
+
+    ThingsBoxExact = !po->crush || !found;
+}
+
 //==========================================================================
 //
 // InitBlockMap
@@ -19,6 +19,7 @@
 #include "i_system.h"
 #include "i_video.h"
 #include "r_local.h"
+#include "r_kernels.h"
 #include "v_video.h"
 
 /*
@@ -58,15 +59,32 @@ int dccount;                    // just for profiling
 // [crispy] Add Lee Killough tutti-frutti fix for all relevant DrawColumn
 // functions.
 
+// [AP] Fill in what every column drawer passes to the kernel, see
+// r_kernels.h. Call once dc_yl to dc_yh are final.
+
+static void R_SetupColumn(r_column_t *column)
+{
+    column->dest = ylookup[dc_yl] + columnofs[dc_x];
+    column->pitch = SCREENWIDTH;
+    column->count = dc_yh - dc_yl + 1;
+    column->source = dc_source;
+    column->fracstep = dc_iscale;
+    column->frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
+    column->texheight = dc_texheight;
+    column->colormap[0] = dc_colormap[0];
+    column->colormap[1] = dc_colormap[1];
+    column->brightmap = NULL;
+    column->translation = NULL;
+    column->blend = NULL;
+    column->blendswap = false;
+    column->twin = 0;
+}
+
 void R_DrawColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -74,54 +92,16 @@ void R_DrawColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[frac >> FRACBITS];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[(frac >> FRACBITS) & heightmask];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        } while (count--);
-    }
+    R_SetupColumn(&column);
+    column.brightmap = dc_brightmap;    // [crispy] brightmaps
+    R_KernelColumn(&column);
 }
 
 void R_DrawColumnLow(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -130,59 +110,21 @@ void R_DrawColumnLow(void)
 //      dccount++;
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[frac >> FRACBITS];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            // [crispy] brightmaps
-            const byte source = dc_source[(frac >> FRACBITS) & heightmask];
-            *dest = dc_colormap[dc_brightmap[source]][source];
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        } while (count--);
-    }
+    R_SetupColumn(&column);
+    column.brightmap = dc_brightmap;    // [crispy] brightmaps
+    R_KernelColumn(&column);
 }
 
 void R_DrawTLColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
     if (!dc_yl)
         dc_yl = 1;
     if (dc_yh == viewheight - 1)
         dc_yh = viewheight - 2;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -190,43 +132,10 @@ void R_DrawTLColumn(void)
         I_Error("R_DrawTLColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            *dest = tinttable[*dest +
-                              (dc_colormap[0][dc_source[frac >> FRACBITS]] <<
-                               8)];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            *dest = tinttable[*dest +
-                              (dc_colormap[0][dc_source[(frac >> FRACBITS) & heightmask]] <<
-                               8)];
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        } while (count--);
-    }
+    R_SetupColumn(&column);
+    column.blend = tinttable;
+    column.blendswap = true;
+    R_KernelColumn(&column);
 }
 
 //============================================================================
@@ -237,18 +146,14 @@ void R_DrawTLColumn(void)
 
 void R_DrawAltTLColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
-    int heightmask = dc_texheight - 1; // [crispy]
+    r_column_t column;
 
     if (!dc_yl)
         dc_yl = 1;
     if (dc_yh == viewheight - 1)
         dc_yh = viewheight - 2;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -256,41 +161,9 @@ void R_DrawAltTLColumn(void)
         I_Error("R_DrawAltTLColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    if (dc_texheight & heightmask) // not a power of 2 -- killough
-    {
-        heightmask++;
-        heightmask <<= FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        do
-        {
-            *dest = tinttable[((*dest) << 8)
-                              + dc_colormap[0][dc_source[frac >> FRACBITS]]];
-            dest += SCREENWIDTH;
-            if ((frac += fracstep) >= heightmask)
-                frac -= heightmask;
-        } while (count--);
-    }
-    else // texture height is a power of 2 -- killough
-    {
-        do
-        {
-            *dest = tinttable[((*dest) << 8)
-                              + dc_colormap[0][dc_source[(frac >> FRACBITS) & heightmask]]];
-            dest += SCREENWIDTH;
-            frac += fracstep;
-        } while (count--);
-    }
+    R_SetupColumn(&column);
+    column.blend = tinttable;
+    R_KernelColumn(&column);
 }
 
 /*
@@ -306,12 +179,9 @@ byte *translationtables;
 
 void R_DrawTranslatedColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -319,18 +189,10 @@ void R_DrawTranslatedColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    do
-    {
-        *dest = dc_colormap[0][dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    }
-    while (count--);
+    R_SetupColumn(&column);
+    column.texheight = 0;
+    column.translation = dc_translation;
+    R_KernelColumn(&column);
 }
 
 //============================================================================
@@ -341,12 +203,9 @@ void R_DrawTranslatedColumn(void)
 
 void R_DrawTranslatedTLColumn(void)
 {
-    int count;
-    byte *dest;
-    fixed_t frac, fracstep;
+    r_column_t column;
 
-    count = dc_yh - dc_yl;
-    if (count < 0)
+    if (dc_yh < dc_yl)
         return;
 
 #ifdef RANGECHECK
@@ -354,21 +213,11 @@ void R_DrawTranslatedTLColumn(void)
         I_Error("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x);
 #endif
 
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    fracstep = dc_iscale;
-    frac = dc_texturemid + (dc_yl - centery) * fracstep;
-
-    do
-    {
-        *dest = tinttable[((*dest) << 8)
-                          +
-                          dc_colormap[0][dc_translation
-                                      [dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    }
-    while (count--);
+    R_SetupColumn(&column);
+    column.texheight = 0;
+    column.translation = dc_translation;
+    column.blend = tinttable;
+    R_KernelColumn(&column);
 }
 
 //============================================================================
@@ -456,9 +305,7 @@ int dscount;                    // just for profiling
 
 void R_DrawSpan(void)
 {
-    fixed_t xfrac, yfrac;
-    byte *dest;
-    int count, spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1 || ds_x1 < 0 || ds_x2 >= SCREENWIDTH
@@ -467,26 +314,23 @@ void R_DrawSpan(void)
 //      dscount++;
 #endif
 
-    xfrac = ds_xfrac;
-    yfrac = ds_yfrac;
-
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-    count = ds_x2 - ds_x1;
-    do
-    {
-        spot = ((yfrac >> (16 - 6)) & (63 * 64)) + ((xfrac >> 16) & 63);
-        *dest++ = ds_colormap[ds_source[spot]];
-        xfrac += ds_xstep;
-        yfrac += ds_ystep;
-    }
-    while (count--);
+    span.dest = ylookup[ds_y] + columnofs[ds_x1];
+    span.step = 1;
+    span.count = ds_x2 - ds_x1 + 1;
+    span.source = ds_source;
+    span.xfrac = ds_xfrac;
+    span.yfrac = ds_yfrac;
+    span.xstep = ds_xstep;
+    span.ystep = ds_ystep;
+    span.colormap[0] = span.colormap[1] = ds_colormap;
+    span.brightmap = NULL;
+    span.twin = 0;
+    R_KernelSpan(&span);
 }
 
 void R_DrawSpanLow(void)
 {
-    fixed_t xfrac, yfrac;
-    byte *dest;
-    int count, spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1 || ds_x1 < 0 || ds_x2 >= SCREENWIDTH
@@ -495,19 +339,18 @@ void R_DrawSpanLow(void)
 //      dscount++;
 #endif
 
-    xfrac = ds_xfrac;
-    yfrac = ds_yfrac;
-
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-    count = ds_x2 - ds_x1;
-    do
-    {
-        spot = ((yfrac >> (16 - 6)) & (63 * 64)) + ((xfrac >> 16) & 63);
-        *dest++ = ds_colormap[ds_source[spot]];
-        xfrac += ds_xstep;
-        yfrac += ds_ystep;
-    }
-    while (count--);
+    span.dest = ylookup[ds_y] + columnofs[ds_x1];
+    span.step = 1;
+    span.count = ds_x2 - ds_x1 + 1;
+    span.source = ds_source;
+    span.xfrac = ds_xfrac;
+    span.yfrac = ds_yfrac;
+    span.xstep = ds_xstep;
+    span.ystep = ds_ystep;
+    span.colormap[0] = span.colormap[1] = ds_colormap;
+    span.brightmap = NULL;
+    span.twin = 0;
+    R_KernelSpan(&span);
 }
 
 
@@ -17,6 +17,7 @@
 
 // HEADER FILES ------------------------------------------------------------
 
+#include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
 #include "h2def.h"
@@ -30,9 +31,23 @@
 #define ASCII_QUOTE (34)
 #define LUMP_SCRIPT 1
 #define FILE_ZONE_SCRIPT 2
+#define MAX_MATCH_LISTS 8
+
+// [AP] Case-insensitive, so a token and a keyword that SC_Compare()
+// would match always hash the same.
+#define HASH_CHAR(hash, c) \
+    (((hash) << 5) + (hash) + toupper((unsigned char) (c)))
 
 // TYPES -------------------------------------------------------------------
 
+// [AP] A string array passed to SC_MatchString(), with the hash of each
+// keyword, worked out the first time the array is used.
+typedef struct
+{
+    const char **strings;
+    unsigned int *hashes;
+} matchList_t;
+
 // EXTERNAL FUNCTION PROTOTYPES --------------------------------------------
 
 // PUBLIC FUNCTION PROTOTYPES ----------------------------------------------
@@ -65,6 +80,9 @@ static int ScriptLumpNum;
 static boolean ScriptOpen = false;
 static int ScriptSize;
 static boolean AlreadyGot = false;
+static unsigned int StringHash;
+static matchList_t MatchLists[MAX_MATCH_LISTS];
+static int MatchListCount = 0;
 
 // CODE --------------------------------------------------------------------
 
@@ -179,6 +197,7 @@ boolean SC_GetString(void)
 {
     char *text;
     boolean foundToken;
+    unsigned int hash = 5381;
 
     CheckOpen();
     if (AlreadyGot)
@@ -232,6 +251,7 @@ boolean SC_GetString(void)
         ScriptPtr++;
         while (*ScriptPtr != ASCII_QUOTE)
         {
+            hash = HASH_CHAR(hash, *ScriptPtr);
             *text++ = *ScriptPtr++;
             if (ScriptPtr == ScriptEndPtr
                 || text == &sc_String[MAX_STRING_SIZE - 1])
@@ -245,6 +265,7 @@ boolean SC_GetString(void)
     {                           // Normal string
         while ((*ScriptPtr > 32) && (*ScriptPtr != ASCII_COMMENT))
         {
+            hash = HASH_CHAR(hash, *ScriptPtr);
             *text++ = *ScriptPtr++;
             if (ScriptPtr == ScriptEndPtr
                 || text == &sc_String[MAX_STRING_SIZE - 1])
@@ -254,6 +275,7 @@ boolean SC_GetString(void)
         }
     }
     *text = 0;
+    StringHash = hash;
     return true;
 }
 
@@ -388,10 +410,73 @@ boolean SC_Check(void)
 //
 //==========================================================================
 
+static unsigned int HashString(const char *s)
+{
+    unsigned int hash = 5381;
+
+    while (*s != '\0')
+    {
+        hash = HASH_CHAR(hash, *s);
+        s++;
+    }
+
+    return hash;
+}
+
+// [AP] The keyword hashes for an array, or NULL if there are already too
+// many arrays to keep them for.
+
+static const unsigned int *MatchListHashes(const char **strings)
+{
+    matchList_t *list;
+    int count;
+    int i;
+
+    for (i = 0; i < MatchListCount; i++)
+    {
+        if (MatchLists[i].strings == strings)
+        {
+            return MatchLists[i].hashes;
+        }
+    }
+
+    if (MatchListCount == MAX_MATCH_LISTS)
+    {
+        return NULL;
+    }
+
+    for (count = 0; strings[count] != NULL; count++);
+
+    list = &MatchLists[MatchListCount++];
+    list->strings = strings;
+    list->hashes = Z_Malloc(count * sizeof(*list->hashes), PU_STATIC, NULL);
+    for (i = 0; i < count; i++)
+    {
+        list->hashes[i] = HashString(strings[i]);
+    }
+
+    return list->hashes;
+}
+
 int SC_MatchString(const char **strings)
 {
+    const unsigned int *hashes;
     int i;
 
+    // [AP] Only a keyword with the token's hash needs comparing
+    hashes = MatchListHashes(strings);
+    if (hashes != NULL)
+    {
+        for (i = 0; strings[i] != NULL; i++)
+        {
+            if (hashes[i] == StringHash && SC_Compare(strings[i]))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
     for (i = 0; *strings != NULL; i++)
     {
         if (SC_Compare(*strings++))
@@ -65,6 +65,9 @@ typedef enum
 
 static void VerifySequencePtr(int *base, int *ptr);
 static int GetSoundOffset(char *name);
+static void UnlinkSequence(seqnode_t *node);
+static void ParkSequence(seqnode_t *node);
+static boolean SequenceSoundPlaying(seqnode_t *node);
 
 // EXTERNAL DATA DECLARATIONS ----------------------------------------------
 
@@ -126,6 +129,12 @@ static struct
 
 static int *SequenceData[SS_MAX_SCRIPTS];
 
+// [AP] Sequences that only wait for something else to stop them are kept
+// at the tail of the list, from IdleSequences on, where the per-tic update
+// doesn't visit them.
+static seqnode_t *SequenceListTail;
+static seqnode_t *IdleSequences;
+
 int ActiveSequences;
 seqnode_t *SequenceListHead;
 
@@ -327,7 +336,7 @@ void SN_StartSequence(mobj_t * mobj, int sequence)
 
     if (!SequenceListHead)
     {
-        SequenceListHead = node;
+        SequenceListHead = SequenceListTail = node;
         node->next = node->prev = NULL;
     }
     else
@@ -370,9 +379,11 @@ void SN_StartSequenceName(mobj_t * mobj, char *name)
 void SN_StopSequence(mobj_t * mobj)
 {
     seqnode_t *node;
+    seqnode_t *next;
 
-    for (node = SequenceListHead; node; node = node->next)
+    for (node = SequenceListHead; node; node = next)
     {
+        next = node->next;
         if (node->mobj == mobj)
         {
             S_StopSound(mobj);
@@ -380,24 +391,84 @@ void SN_StopSequence(mobj_t * mobj)
             {
                 S_StartSoundAtVolume(mobj, node->stopSound, node->volume);
             }
-            if (SequenceListHead == node)
-            {
-                SequenceListHead = node->next;
-            }
-            if (node->prev)
-            {
-                node->prev->next = node->next;
-            }
-            if (node->next)
-            {
-                node->next->prev = node->prev;
-            }
+            UnlinkSequence(node);
             Z_Free(node);
             ActiveSequences--;
         }
     }
 }
 
+//==========================================================================
+//
+//  UnlinkSequence
+//
+//==========================================================================
+
+static void UnlinkSequence(seqnode_t *node)
+{
+    if (IdleSequences == node)
+    {
+        IdleSequences = node->next;
+    }
+    if (SequenceListHead == node)
+    {
+        SequenceListHead = node->next;
+    }
+    if (SequenceListTail == node)
+    {
+        SequenceListTail = node->prev;
+    }
+    if (node->prev)
+    {
+        node->prev->next = node->next;
+    }
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    }
+}
+
+//==========================================================================
+//
+//  ParkSequence
+//
+//      Moves a sequence that has nothing left to do to the idle tail of
+//      the list.
+//==========================================================================
+
+static void ParkSequence(seqnode_t *node)
+{
+    UnlinkSequence(node);
+
+    node->next = NULL;
+    node->prev = SequenceListTail;
+    if (SequenceListTail)
+    {
+        SequenceListTail->next = node;
+    }
+    else
+    {
+        SequenceListHead = node;
+    }
+    SequenceListTail = node;
+
+    if (!IdleSequences)
+    {
+        IdleSequences = node;
+    }
+}
+
+//==========================================================================
+//
+//  SequenceSoundPlaying
+//
+//==========================================================================
+
+static boolean SequenceSoundPlaying(seqnode_t *node)
+{
+    return S_GetSoundPlayingInfo(node->mobj, node->currentSoundID);
+}
+
 //==========================================================================
 //
 //  SN_UpdateActiveSequences
@@ -407,24 +478,25 @@ void SN_StopSequence(mobj_t * mobj)
 void SN_UpdateActiveSequences(void)
 {
     seqnode_t *node;
-    boolean sndPlaying;
+    seqnode_t *next;
 
     if (!ActiveSequences || paused)
     {                           // No sequences currently playing/game is paused
         return;
     }
-    for (node = SequenceListHead; node; node = node->next)
+    for (node = SequenceListHead; node && node != IdleSequences; node = next)
     {
+        next = node->next;
         if (node->delayTics)
         {
             node->delayTics--;
             continue;
         }
-        sndPlaying = S_GetSoundPlayingInfo(node->mobj, node->currentSoundID);
+        // [AP] Only the play commands need to know if the sound is playing
         switch (*node->sequencePtr)
         {
             case SS_CMD_PLAY:
-                if (!sndPlaying)
+                if (!SequenceSoundPlaying(node))
                 {
                     node->currentSoundID = *(node->sequencePtr + 1);
                     S_StartSoundAtVolume(node->mobj, node->currentSoundID,
@@ -433,14 +505,14 @@ void SN_UpdateActiveSequences(void)
                 node->sequencePtr += 2;
                 break;
             case SS_CMD_WAITUNTILDONE:
-                if (!sndPlaying)
+                if (!SequenceSoundPlaying(node))
                 {
                     node->sequencePtr++;
                     node->currentSoundID = 0;
                 }
                 break;
             case SS_CMD_PLAYREPEAT:
-                if (!sndPlaying)
+                if (!SequenceSoundPlaying(node))
                 {
                     node->currentSoundID = *(node->sequencePtr + 1);
                     S_StartSoundAtVolume(node->mobj, node->currentSoundID,
@@ -465,6 +537,7 @@ void SN_UpdateActiveSequences(void)
                 break;
             case SS_CMD_STOPSOUND:
                 // Wait until something else stops the sequence
+                ParkSequence(node);
                 break;
             case SS_CMD_END:
                 SN_StopSequence(node->mobj);
@@ -484,9 +557,11 @@ void SN_UpdateActiveSequences(void)
 void SN_StopAllSequences(void)
 {
     seqnode_t *node;
+    seqnode_t *next;
 
-    for (node = SequenceListHead; node; node = node->next)
+    for (node = SequenceListHead; node; node = next)
     {
+        next = node->next;
         node->stopSound = 0;    // don't play any stop sounds
         SN_StopSequence(node->mobj);
     }
@@ -52,6 +52,10 @@ static const byte *bitmap = NULL;
 int graphical_startup = 0;
 static boolean using_graphical_startup;
 
+// [AP] The notches converted from planar once, when the screen is set up
+static byte *notchChunky = NULL;
+static byte *netnotchChunky = NULL;
+
 static const byte notchTable[] = {
     // plane 0
     0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
@@ -146,6 +150,12 @@ void ST_Init(void)
             I_SlamHR(bitmap);
             I_FadeToPaletteHR(pal);
             Z_Free(buffer);
+
+            notchChunky = I_ConvertBlockHR(ST_NOTCH_WIDTH, ST_NOTCH_HEIGHT,
+                                           notchTable);
+            netnotchChunky = I_ConvertBlockHR(ST_NETNOTCH_WIDTH,
+                                              ST_NETNOTCH_HEIGHT,
+                                              netnotchTable);
         }
     }
 }
@@ -156,6 +166,11 @@ void ST_Done(void)
     {
         I_ClearScreenHR();
         I_UnsetVideoModeHR();
+
+        free(notchChunky);
+        notchChunky = NULL;
+        free(netnotchChunky);
+        netnotchChunky = NULL;
     }
 }
 
@@ -170,7 +185,10 @@ void ST_UpdateNotches(int notchPosition)
 {
     int x = ST_PROGRESS_X + notchPosition * ST_NOTCH_WIDTH;
     int y = ST_PROGRESS_Y;
-    I_SlamBlockHR(x, y, ST_NOTCH_WIDTH, ST_NOTCH_HEIGHT, notchTable);
+    if (notchChunky != NULL)
+    {
+        I_DrawBlockHR(x, y, ST_NOTCH_WIDTH, ST_NOTCH_HEIGHT, notchChunky);
+    }
 }
 
 
@@ -184,7 +202,11 @@ void ST_UpdateNetNotches(int notchPosition)
 {
     int x = ST_NETPROGRESS_X + notchPosition * ST_NETNOTCH_WIDTH;
     int y = ST_NETPROGRESS_Y;
-    I_SlamBlockHR(x, y, ST_NETNOTCH_WIDTH, ST_NETNOTCH_HEIGHT, netnotchTable);
+    if (netnotchChunky != NULL)
+    {
+        I_DrawBlockHR(x, y, ST_NETNOTCH_WIDTH, ST_NETNOTCH_HEIGHT,
+                      netnotchChunky);
+    }
 }
 
 
@@ -20,9 +20,14 @@
 #include "h2def.h"
 #include "i_system.h"
 #include "m_misc.h"
+#include "memio.h"
 #include "i_swap.h"
 #include "p_local.h"
 
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
 // MACROS ------------------------------------------------------------------
 
 #define MAX_TARGET_PLAYERS 512
@@ -33,6 +38,7 @@
 #define REBORN_SLOT 7
 #define REBORN_DESCRIPTION "TEMP GAME"
 #define MAX_THINKER_SIZE 256
+#define GAME_FILE -1
 
 // TYPES -------------------------------------------------------------------
 
@@ -84,6 +90,23 @@ typedef struct
     sector_t *sector;
 } ssthinker_t;
 
+// [AP] One save file of a slot kept in memory, zlib packed when built
+// with it.
+
+typedef struct
+{
+    byte *data;
+    size_t length;              // Unpacked length
+    size_t stored_length;
+    boolean packed;
+} hubfile_t;
+
+typedef struct
+{
+    hubfile_t game;
+    hubfile_t maps[MAX_MAPS];
+} hubslot_t;
+
 // EXTERNAL FUNCTION PROTOTYPES --------------------------------------------
 
 void P_SpawnPlayer(mapthing_t * mthing);
@@ -116,11 +139,19 @@ static void RestoreSSThinker(thinker_t *sst);
 static void RestorePlatRaise(thinker_t *thinker);
 static void RestoreMoveCeiling(thinker_t *thinker);
 static void AssertSegment(gameArchiveSegment_t segType);
+static hubslot_t *GetHubSlot(int slot);
+static hubfile_t *GetHubFile(int slot, int map);
+static void SlotFileName(char *name, size_t name_len, int slot, int map);
+static void FreeHubFile(hubfile_t *file);
+static void StoreHubFile(hubfile_t *file, const byte *data, size_t length);
+static byte *UnpackHubFile(const hubfile_t *file);
 static void CopySaveSlot(int sourceSlot, int destSlot);
+static void CopySlotFile(int sourceSlot, int destSlot, int map);
+static boolean SlotFileExists(int slot, int map);
 static void CopyFile(char *sourceName, char *destName);
 static boolean ExistingFile(char *name);
-static void SV_OpenRead(char *fileName);
-static void SV_OpenWrite(char *fileName);
+static void SV_OpenRead(int map);
+static void SV_OpenWrite(int map);
 static void SV_Close(void);
 static void SV_Read(void *buffer, int size);
 static byte SV_ReadByte(void);
@@ -152,7 +183,15 @@ static mobj_t **MobjList;
 static mobj_t ***TargetPlayerAddrs;
 static int TargetPlayerCount;
 static boolean SavingPlayers;
-static FILE *SavingFP;
+static MEMFILE *SavingStream;
+static hubfile_t *SavingFile;
+static byte *SavingBuffer;
+
+// [AP] The base and reborn slots only live in memory, so moving between
+// the maps of a hub never touches the disk. They are written out in the
+// usual format when the game is saved to a slot, and read back in from
+// it when a slot is loaded.
+static hubslot_t HubSlots[2];
 
 // CODE --------------------------------------------------------------------
 
@@ -1976,7 +2015,6 @@ static void StreamOut_floorWaggle_t(thinker_t *thinker)
 
 void SV_SaveGame(int slot, const char *description)
 {
-    char fileName[100];
     char versionText[HXS_VERSION_TEXT_LENGTH];
     unsigned int i;
 
@@ -1987,8 +2025,7 @@ void SV_SaveGame(int slot, const char *description)
     }
 
     // Open the output file
-    M_snprintf(fileName, sizeof(fileName), "%shex%d.hxs", SavePath, BASE_SLOT);
-    SV_OpenWrite(fileName);
+    SV_OpenWrite(GAME_FILE);
 
     // Write game save description
     SV_Write(description, HXS_DESCRIPTION_LENGTH);
@@ -2042,14 +2079,10 @@ void SV_SaveGame(int slot, const char *description)
 
 void SV_SaveMap(boolean savePlayers)
 {
-    char fileName[100];
-
     SavingPlayers = savePlayers;
 
     // Open the output file
-    M_snprintf(fileName, sizeof(fileName), "%shex%d%02d.hxs",
-                SavePath, BASE_SLOT, gamemap);
-    SV_OpenWrite(fileName);
+    SV_OpenWrite(gamemap);
 
     // Place a header marker
     SV_WriteLong(ASEG_MAP_HEADER);
@@ -2084,7 +2117,6 @@ void SV_SaveMap(boolean savePlayers)
 void SV_LoadGame(int slot)
 {
     int i;
-    char fileName[100];
     char version_text[HXS_VERSION_TEXT_LENGTH];
     player_t playerBackup[MAXPLAYERS];
     mobj_t *mobj;
@@ -2102,14 +2134,11 @@ void SV_LoadGame(int slot)
         CopySaveSlot(slot, BASE_SLOT);
     }
 
-    // Create the name
-    M_snprintf(fileName, sizeof(fileName), "%shex%d.hxs", SavePath, BASE_SLOT);
-
     // Load the file
-    SV_OpenRead(fileName);
+    SV_OpenRead(GAME_FILE);
 
     // Set the save pointer and skip the description field
-    fseek(SavingFP, HXS_DESCRIPTION_LENGTH, SEEK_CUR);
+    mem_fseek(SavingStream, HXS_DESCRIPTION_LENGTH, MEM_SEEK_CUR);
 
     // Check the version text
 
@@ -2119,6 +2148,7 @@ void SV_LoadGame(int slot)
     }
     if (strncmp(version_text, HXS_VERSION_TEXT, HXS_VERSION_TEXT_LENGTH) != 0)
     {                           // Bad version
+        SV_Close();
         return;
     }
 
@@ -2209,7 +2239,6 @@ void SV_MapTeleport(int map, int position)
 {
     int i;
     int j;
-    char fileName[100];
     player_t playerBackup[MAXPLAYERS];
     mobj_t *targetPlayerMobj;
     mobj_t *mobj;
@@ -2251,9 +2280,7 @@ void SV_MapTeleport(int map, int position)
     TargetPlayerAddrs = NULL;
 
     gamemap = map;
-    M_snprintf(fileName, sizeof(fileName),
-                "%shex%d%02d.hxs", SavePath, BASE_SLOT, gamemap);
-    if (!deathmatch && ExistingFile(fileName))
+    if (!deathmatch && SlotFileExists(BASE_SLOT, gamemap))
     {                           // Unarchive map
         SV_LoadMap();
     }
@@ -2400,10 +2427,7 @@ int SV_GetRebornSlot(void)
 
 boolean SV_RebornSlotAvailable(void)
 {
-    char fileName[100];
-
-    M_snprintf(fileName, sizeof(fileName), "%shex%d.hxs", SavePath, REBORN_SLOT);
-    return ExistingFile(fileName);
+    return SlotFileExists(REBORN_SLOT, GAME_FILE);
 }
 
 //==========================================================================
@@ -2414,20 +2438,14 @@ boolean SV_RebornSlotAvailable(void)
 
 void SV_LoadMap(void)
 {
-    char fileName[100];
-
     // Load a base level
     G_InitNew(gameskill, gameepisode, gamemap);
 
     // Remove all thinkers
     RemoveAllThinkers();
 
-    // Create the name
-    M_snprintf(fileName, sizeof(fileName),
-                "%shex%d%02d.hxs", SavePath, BASE_SLOT, gamemap);
-
     // Load the file
-    SV_OpenRead(fileName);
+    SV_OpenRead(gamemap);
 
     AssertSegment(ASEG_MAP_HEADER);
 
@@ -3258,6 +3276,110 @@ static void AssertSegment(gameArchiveSegment_t segType)
     }
 }
 
+//==========================================================================
+//
+// Hub slots
+//
+//==========================================================================
+
+static hubslot_t *GetHubSlot(int slot)
+{
+    switch (slot)
+    {
+        case BASE_SLOT:
+            return &HubSlots[0];
+        case REBORN_SLOT:
+            return &HubSlots[1];
+        default:
+            return NULL;
+    }
+}
+
+// Returns NULL if the slot is kept on disk.
+
+static hubfile_t *GetHubFile(int slot, int map)
+{
+    hubslot_t *hub = GetHubSlot(slot);
+
+    if (hub == NULL)
+    {
+        return NULL;
+    }
+
+    return map == GAME_FILE ? &hub->game : &hub->maps[map];
+}
+
+static void SlotFileName(char *name, size_t name_len, int slot, int map)
+{
+    if (map == GAME_FILE)
+    {
+        M_snprintf(name, name_len, "%shex%d.hxs", SavePath, slot);
+    }
+    else
+    {
+        M_snprintf(name, name_len, "%shex%d%02d.hxs", SavePath, slot, map);
+    }
+}
+
+static void FreeHubFile(hubfile_t *file)
+{
+    free(file->data);
+    memset(file, 0, sizeof(*file));
+}
+
+static void StoreHubFile(hubfile_t *file, const byte *data, size_t length)
+{
+    FreeHubFile(file);
+    file->length = length;
+
+#ifdef HAVE_LIBZ
+    {
+        uLongf zlength = compressBound(length);
+
+        file->data = malloc(zlength);
+        if (compress2(file->data, &zlength, data, length,
+                      Z_BEST_SPEED) == Z_OK)
+        {
+            file->stored_length = zlength;
+            file->packed = true;
+            return;
+        }
+        free(file->data);
+    }
+#endif
+
+    file->data = malloc(length);
+    memcpy(file->data, data, length);
+    file->stored_length = length;
+}
+
+// Returns a malloc'd copy of the file as it is stored on disk.
+
+static byte *UnpackHubFile(const hubfile_t *file)
+{
+    byte *data = malloc(file->length);
+
+    if (!file->packed)
+    {
+        memcpy(data, file->data, file->length);
+        return data;
+    }
+
+#ifdef HAVE_LIBZ
+    {
+        uLongf zlength = file->length;
+
+        if (uncompress(data, &zlength, file->data, file->stored_length) != Z_OK
+         || zlength != file->length)
+        {
+            I_Error("Corrupt save game: Hub snapshot failed to unpack");
+        }
+    }
+#endif
+
+    return data;
+}
+
 //==========================================================================
 //
 // SV_ClearSaveSlot
@@ -3270,6 +3392,7 @@ void SV_ClearSaveSlot(int slot)
 {
     int i;
     char fileName[100];
+    hubslot_t *hub;
 
     // [crispy] get expanded save slot number
     if (slot != BASE_SLOT && slot != REBORN_SLOT)
@@ -3277,6 +3400,17 @@ void SV_ClearSaveSlot(int slot)
         slot += savepage * 10;
     }
 
+    hub = GetHubSlot(slot);
+    if (hub != NULL)
+    {
+        FreeHubFile(&hub->game);
+        for (i = 0; i < MAX_MAPS; i++)
+        {
+            FreeHubFile(&hub->maps[i]);
+        }
+        return;
+    }
+
     for (i = 0; i < MAX_MAPS; i++)
     {
         M_snprintf(fileName, sizeof(fileName),
@@ -3299,33 +3433,95 @@ static void CopySaveSlot(int sourceSlot, int destSlot)
 {
     int i;
     char sourceName[100];
-    char destName[100];
 
     for (i = 0; i < MAX_MAPS; i++)
     {
-        M_snprintf(sourceName, sizeof(sourceName),
-                   "%shex%d%02d.hxs", SavePath, sourceSlot, i);
-        if (ExistingFile(sourceName))
+        if (SlotFileExists(sourceSlot, i))
         {
-            M_snprintf(destName, sizeof(destName),
-                       "%shex%d%02d.hxs", SavePath, destSlot, i);
-            CopyFile(sourceName, destName);
+            CopySlotFile(sourceSlot, destSlot, i);
         }
     }
-    M_snprintf(sourceName, sizeof(sourceName),
-               "%shex%d.hxs", SavePath, sourceSlot);
-    if (ExistingFile(sourceName))
+    if (SlotFileExists(sourceSlot, GAME_FILE))
     {
-        M_snprintf(destName, sizeof(destName),
-                   "%shex%d.hxs", SavePath, destSlot);
-        CopyFile(sourceName, destName);
+        CopySlotFile(sourceSlot, destSlot, GAME_FILE);
     }
     else
     {
+        SlotFileName(sourceName, sizeof(sourceName), sourceSlot, GAME_FILE);
         I_Error("Could not load savegame %s", sourceName);
     }
 }
 
+//==========================================================================
+//
+// CopySlotFile
+//
+// Copies one save file between slots, in memory or on disk.
+//
+//==========================================================================
+
+static void CopySlotFile(int sourceSlot, int destSlot, int map)
+{
+    hubfile_t *source = GetHubFile(sourceSlot, map);
+    hubfile_t *dest = GetHubFile(destSlot, map);
+    char sourceName[100];
+    char destName[100];
+    byte *buffer;
+    int length;
+
+    SlotFileName(sourceName, sizeof(sourceName), sourceSlot, map);
+    SlotFileName(destName, sizeof(destName), destSlot, map);
+
+    if (source != NULL && dest != NULL)
+    {
+        FreeHubFile(dest);
+        *dest = *source;
+        dest->data = malloc(source->stored_length);
+        memcpy(dest->data, source->data, source->stored_length);
+    }
+    else if (source != NULL)
+    {
+        buffer = UnpackHubFile(source);
+        if (!M_WriteFile(destName, buffer, source->length))
+        {
+            I_Error("Couldn't write to file %s", destName);
+        }
+        free(buffer);
+    }
+    else if (dest != NULL)
+    {
+        // M_ReadFile() holds the entire file in zone memory, so the
+        // vanilla savegame limit still applies here.
+        length = M_ReadFile(sourceName, &buffer);
+        StoreHubFile(dest, buffer, length);
+        Z_Free(buffer);
+    }
+    else
+    {
+        CopyFile(sourceName, destName);
+    }
+}
+
+//==========================================================================
+//
+// SlotFileExists
+//
+//==========================================================================
+
+static boolean SlotFileExists(int slot, int map)
+{
+    hubfile_t *file = GetHubFile(slot, map);
+    char fileName[100];
+
+    if (file != NULL)
+    {
+        return file->data != NULL;
+    }
+
+    SlotFileName(fileName, sizeof(fileName), slot, map);
+    return ExistingFile(fileName);
+}
+
 //==========================================================================
 //
 // CopyFile
@@ -3426,20 +3622,28 @@ static boolean ExistingFile(char *name)
 //
 //==========================================================================
 
-static void SV_OpenRead(char *fileName)
+static void SV_OpenRead(int map)
 {
-    SavingFP = M_fopen(fileName, "rb");
+    hubfile_t *file = GetHubFile(BASE_SLOT, map);
+    char fileName[100];
 
     // Should never happen, only if hex6.hxs cannot ever be created.
-    if (SavingFP == NULL)
+    if (file->data == NULL)
     {
+        SlotFileName(fileName, sizeof(fileName), BASE_SLOT, map);
         I_Error("Could not load savegame %s", fileName);
     }
+
+    SavingFile = NULL;
+    SavingBuffer = UnpackHubFile(file);
+    SavingStream = mem_fopen_read(SavingBuffer, file->length);
 }
 
-static void SV_OpenWrite(char *fileName)
+static void SV_OpenWrite(int map)
 {
-    SavingFP = M_fopen(fileName, "wb");
+    SavingFile = GetHubFile(BASE_SLOT, map);
+    SavingBuffer = NULL;
+    SavingStream = mem_fopen_write();
 }
 
 //==========================================================================
@@ -3450,10 +3654,20 @@ static void SV_OpenWrite(char *fileName)
 
 static void SV_Close(void)
 {
-    if (SavingFP)
+    void *data;
+    size_t length;
+
+    if (SavingFile != NULL)
     {
-        fclose(SavingFP);
+        mem_get_buf(SavingStream, &data, &length);
+        StoreHubFile(SavingFile, data, length);
+        SavingFile = NULL;
     }
+
+    mem_fclose(SavingStream);
+    free(SavingBuffer);
+    SavingStream = NULL;
+    SavingBuffer = NULL;
 }
 
 //==========================================================================
@@ -3464,7 +3678,7 @@ static void SV_Close(void)
 
 static void SV_Read(void *buffer, int size)
 {
-    int retval = fread(buffer, 1, size, SavingFP);
+    int retval = mem_fread(buffer, 1, size, SavingStream);
     if (retval != size)
     {
         I_Error("Incomplete read in SV_Read: Expected %d, got %d bytes",
@@ -3506,24 +3720,24 @@ static void *SV_ReadPtr(void)
 
 static void SV_Write(const void *buffer, int size)
 {
-    fwrite(buffer, size, 1, SavingFP);
+    mem_fwrite(buffer, size, 1, SavingStream);
 }
 
 static void SV_WriteByte(byte val)
 {
-    fwrite(&val, sizeof(byte), 1, SavingFP);
+    mem_fwrite(&val, sizeof(byte), 1, SavingStream);
 }
 
 static void SV_WriteWord(unsigned short val)
 {
     val = SHORT(val);
-    fwrite(&val, sizeof(unsigned short), 1, SavingFP);
+    mem_fwrite(&val, sizeof(unsigned short), 1, SavingStream);
 }
 
 static void SV_WriteLong(unsigned int val)
 {
     val = LONG(val);
-    fwrite(&val, sizeof(int), 1, SavingFP);
+    mem_fwrite(&val, sizeof(int), 1, SavingStream);
 }
 
 static void SV_WritePtr(void *val)
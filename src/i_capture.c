@@ -0,0 +1,426 @@
+// [AP] Frame capture, see i_capture.h. The game copies each frame into one
+// of a few pooled buffers and carries on; a thread hands the frames to the
+// outputs, so a slow reader only ever costs dropped frames.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "SDL.h"
+
+#include "i_capture.h"
+#include "i_system.h"
+#include "i_video.h"
+#include "m_argv.h"
+#include "m_misc.h"
+
+#define CAPTURE_FRAMES 4
+#define CAPTURE_MAX_PIXELS (MAXWIDTH * MAXHEIGHT)
+
+typedef struct
+{
+    uint32_t *pixels;
+    int width, height;
+} captureframe_t;
+
+// Filled frames are frames[frame_start] onwards, frame_count of them. The
+// one after those is the game's to fill.
+
+static captureframe_t frames[CAPTURE_FRAMES];
+static int frame_start = 0;
+static int frame_count = 0;
+static uint32_t frames_dropped = 0;
+
+static boolean capture_closing = false;
+static SDL_mutex *capture_mutex = NULL;
+static SDL_cond *capture_cond = NULL;   // frames to capture or closing
+static SDL_Thread *capture_thread = NULL;
+
+// -capture output, opened on the thread since opening a pipe waits for
+// the reader
+
+static char *capture_path = NULL;
+static FILE *capture_file = NULL;
+#ifdef _WIN32
+static HANDLE capture_pipe = INVALID_HANDLE_VALUE;
+#endif
+static boolean capture_failed = false;
+static int stream_width = 0, stream_height = 0;
+
+// -captureshm output
+
+static capture_shm_header_t *capture_shm = NULL;
+#ifdef _WIN32
+static HANDLE capture_shm_mapping = NULL;
+#endif
+
+#ifdef _WIN32
+static boolean IsPipeName(const char *path)
+{
+    return !strncmp(path, "\\\\.\\pipe\\", 9);
+}
+#endif
+
+static boolean OpenOutput(void)
+{
+#ifdef _WIN32
+    if (IsPipeName(capture_path))
+    {
+        capture_pipe = CreateNamedPipeA(capture_path, PIPE_ACCESS_OUTBOUND,
+                                        PIPE_TYPE_BYTE | PIPE_WAIT, 1,
+                                        1 << 20, 0, 0, NULL);
+        if (capture_pipe == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        if (!ConnectNamedPipe(capture_pipe, NULL)
+         && GetLastError() != ERROR_PIPE_CONNECTED)
+        {
+            CloseHandle(capture_pipe);
+            capture_pipe = INVALID_HANDLE_VALUE;
+            return false;
+        }
+        return true;
+    }
+#endif
+
+    capture_file = M_fopen(capture_path, "wb");
+
+    return capture_file != NULL;
+}
+
+static boolean WriteOutput(const void *data, size_t length)
+{
+#ifdef _WIN32
+    if (capture_pipe != INVALID_HANDLE_VALUE)
+    {
+        DWORD written;
+
+        return WriteFile(capture_pipe, data, (DWORD) length, &written, NULL)
+            && written == length;
+    }
+#endif
+
+    return fwrite(data, 1, length, capture_file) == length;
+}
+
+static void CloseOutput(void)
+{
+#ifdef _WIN32
+    if (capture_pipe != INVALID_HANDLE_VALUE)
+    {
+        FlushFileBuffers(capture_pipe);
+        DisconnectNamedPipe(capture_pipe);
+        CloseHandle(capture_pipe);
+        capture_pipe = INVALID_HANDLE_VALUE;
+    }
+#endif
+
+    if (capture_file != NULL)
+    {
+        fclose(capture_file);
+        capture_file = NULL;
+    }
+}
+
+// A raw stream has no room to say its size changed, so it keeps the size
+// of its first frame and frames of another size are left out of it.
+
+static void StreamFrame(const captureframe_t *frame)
+{
+    if (capture_failed)
+    {
+        return;
+    }
+
+    if (stream_width == 0)
+    {
+        if (!OpenOutput())
+        {
+            printf("I_Capture: Failed to open '%s'\n", capture_path);
+            capture_failed = true;
+            return;
+        }
+
+        stream_width = frame->width;
+        stream_height = frame->height;
+        printf("I_Capture: Writing %dx%d bgr0 frames to '%s'\n",
+               stream_width, stream_height, capture_path);
+    }
+
+    if (frame->width != stream_width || frame->height != stream_height)
+    {
+        return;
+    }
+
+    if (!WriteOutput(frame->pixels,
+                     (size_t) frame->width * frame->height * 4))
+    {
+        printf("I_Capture: Stopped writing to '%s'\n", capture_path);
+        CloseOutput();
+        capture_failed = true;
+    }
+}
+
+// Seqlock write. There's only the one writer, this thread.
+
+static void PublishFrame(const captureframe_t *frame)
+{
+    uint32_t sequence = capture_shm->sequence + 1;
+
+    capture_shm->sequence = sequence;
+    SDL_MemoryBarrierRelease();
+
+    capture_shm->frame++;
+    capture_shm->width = frame->width;
+    capture_shm->height = frame->height;
+    capture_shm->pitch = frame->width * 4;
+    capture_shm->dropped = frames_dropped;
+    memcpy(capture_shm + 1, frame->pixels,
+           (size_t) frame->width * frame->height * 4);
+
+    SDL_MemoryBarrierRelease();
+    capture_shm->sequence = sequence + 1;
+}
+
+static int CaptureThread(void *unused)
+{
+    captureframe_t *frame;
+
+    SDL_LockMutex(capture_mutex);
+
+    while (1)
+    {
+        while (frame_count == 0 && !capture_closing)
+        {
+            SDL_CondWait(capture_cond, capture_mutex);
+        }
+
+        if (frame_count == 0)
+        {
+            break;
+        }
+
+        // The game doesn't touch a filled frame, so it's handed on without
+        // holding the lock.
+        frame = &frames[frame_start];
+        SDL_UnlockMutex(capture_mutex);
+
+        if (capture_shm != NULL)
+        {
+            PublishFrame(frame);
+        }
+        if (capture_path != NULL)
+        {
+            StreamFrame(frame);
+        }
+
+        SDL_LockMutex(capture_mutex);
+        frame_start = (frame_start + 1) % CAPTURE_FRAMES;
+        frame_count--;
+    }
+
+    SDL_UnlockMutex(capture_mutex);
+
+    return 0;
+}
+
+static boolean OpenSharedMemory(void)
+{
+    const size_t size = sizeof(capture_shm_header_t)
+                      + CAPTURE_MAX_PIXELS * sizeof(uint32_t);
+    void *view = NULL;
+#ifdef _WIN32
+    capture_shm_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL,
+                                             PAGE_READWRITE, 0, (DWORD) size,
+                                             "Local\\" CAPTURE_SHM_NAME);
+    if (capture_shm_mapping != NULL)
+    {
+        view = MapViewOfFile(capture_shm_mapping, FILE_MAP_ALL_ACCESS,
+                             0, 0, size);
+        if (view == NULL)
+        {
+            CloseHandle(capture_shm_mapping);
+            capture_shm_mapping = NULL;
+        }
+    }
+#else
+    int fd = shm_open("/" CAPTURE_SHM_NAME, O_CREAT | O_RDWR, 0644);
+
+    if (fd >= 0)
+    {
+        if (ftruncate(fd, (off_t) size) == 0)
+        {
+            view = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (view == MAP_FAILED)
+            {
+                view = NULL;
+            }
+        }
+        close(fd); // The mapping keeps it alive
+    }
+#endif
+
+    if (view == NULL)
+    {
+        return false;
+    }
+
+    // A previous run may have left its block behind, pick up where its
+    // sequence was so readers see the change.
+    capture_shm = view;
+    capture_shm->sequence &= ~1u;
+    capture_shm->magic = CAPTURE_SHM_MAGIC;
+    capture_shm->version = CAPTURE_SHM_VERSION;
+    capture_shm->size = (uint32_t) size;
+    capture_shm->frame = 0;
+
+    return true;
+}
+
+static void I_ShutdownCapture(void)
+{
+    int i;
+
+    SDL_LockMutex(capture_mutex);
+    capture_closing = true;
+    SDL_CondBroadcast(capture_cond);
+    SDL_UnlockMutex(capture_mutex);
+
+    // The thread may still be waiting for a pipe's reader, which would
+    // hold up quitting. Leave it, and what it uses, to the exit.
+    if (capture_path != NULL && stream_width == 0 && !capture_failed)
+    {
+        SDL_DetachThread(capture_thread);
+        capture_thread = NULL;
+        return;
+    }
+
+    SDL_WaitThread(capture_thread, NULL);
+    capture_thread = NULL;
+    CloseOutput();
+
+    if (capture_shm != NULL)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(capture_shm);
+        CloseHandle(capture_shm_mapping);
+        capture_shm_mapping = NULL;
+#else
+        munmap(capture_shm, capture_shm->size);
+#endif
+        capture_shm = NULL;
+    }
+
+    for (i = 0; i < CAPTURE_FRAMES; ++i)
+    {
+        free(frames[i].pixels);
+        frames[i].pixels = NULL;
+    }
+}
+
+void I_InitCapture(void)
+{
+    int i;
+
+    //!
+    // @category video
+    // @arg <file>
+    //
+    // Write every frame shown to the given file or named pipe, as raw
+    // "bgr0" pixels at the internal resolution. On Windows, a name like
+    // \\.\pipe\apdoom creates the pipe.
+    //
+
+    i = M_CheckParmWithArgs("-capture", 1);
+
+    if (i > 0)
+    {
+        capture_path = M_StringDuplicate(myargv[i + 1]);
+    }
+
+    //!
+    // @category video
+    //
+    // Publish the latest frame shown in shared memory named
+    // "apdoom_capture", for streaming software to pick up.
+    //
+
+    if (M_ParmExists("-captureshm") && !OpenSharedMemory())
+    {
+        printf("I_InitCapture: Failed to create the shared memory block "
+               "\"%s\"\n", CAPTURE_SHM_NAME);
+    }
+
+    if (capture_path == NULL && capture_shm == NULL)
+    {
+        return;
+    }
+
+#ifndef _WIN32
+    // A pipe's reader going away should end the capture, not the game
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    for (i = 0; i < CAPTURE_FRAMES; ++i)
+    {
+        frames[i].pixels = malloc(CAPTURE_MAX_PIXELS * sizeof(uint32_t));
+    }
+
+    capture_mutex = SDL_CreateMutex();
+    capture_cond = SDL_CreateCond();
+    capture_thread = SDL_CreateThread(CaptureThread, "capture", NULL);
+
+    if (capture_thread == NULL)
+    {
+        printf("I_InitCapture: Failed to start the capture thread\n");
+        free(capture_path);
+        capture_path = NULL;
+        return;
+    }
+
+    I_AtExit(I_ShutdownCapture, true);
+}
+
+uint32_t *I_CaptureBeginFrame(int width, int height)
+{
+    captureframe_t *frame;
+
+    if (capture_thread == NULL || width * height > CAPTURE_MAX_PIXELS)
+    {
+        return NULL;
+    }
+
+    SDL_LockMutex(capture_mutex);
+    if (frame_count == CAPTURE_FRAMES)
+    {
+        frames_dropped++;
+        SDL_UnlockMutex(capture_mutex);
+        return NULL;
+    }
+    frame = &frames[(frame_start + frame_count) % CAPTURE_FRAMES];
+    SDL_UnlockMutex(capture_mutex);
+
+    frame->width = width;
+    frame->height = height;
+
+    return frame->pixels;
+}
+
+void I_CaptureEndFrame(void)
+{
+    SDL_LockMutex(capture_mutex);
+    frame_count++;
+    SDL_CondSignal(capture_cond);
+    SDL_UnlockMutex(capture_mutex);
+}
@@ -0,0 +1,45 @@
+#ifndef __I_CAPTURE__
+#define __I_CAPTURE__
+
+// [AP] Frame capture for streaming and recording. The frames are taken at
+// the internal resolution just before they're presented, so capturing
+// doesn't scale with the window. They go out as raw 32 bit pixels, bytes
+// blue, green, red and one unused (ffmpeg's "bgr0"), to a file or named
+// pipe with -capture, and/or to shared memory for OBS and the like with
+// -captureshm.
+
+#include "doomtype.h"
+
+// The shared memory block is named CAPTURE_SHM_NAME, "Local\\" prefixed on
+// Windows and "/" prefixed elsewhere. Pixels follow the header, pitch bytes
+// per row. Readers must not lock or write it. To read: load sequence, skip
+// if it's odd, copy the frame, then load sequence again and retry if it
+// changed.
+#define CAPTURE_SHM_NAME "apdoom_capture"
+#define CAPTURE_SHM_MAGIC 0x46435041 // "APCF"
+#define CAPTURE_SHM_VERSION 1
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size; // Of the block, header and room for the largest frame
+    volatile uint32_t sequence; // Odd while a frame is being written
+    uint32_t frame; // Frames published so far
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;
+    uint32_t dropped; // Frames skipped because capture fell behind
+    uint32_t reserved[7];
+} capture_shm_header_t;
+
+void I_InitCapture(void);
+
+// Returns a width * height buffer to fill with the frame being presented,
+// or NULL if capture is off or still busy with earlier frames, in which
+// case the frame is dropped rather than holding up the game. Pass a filled
+// buffer on with I_CaptureEndFrame.
+uint32_t *I_CaptureBeginFrame(int width, int height);
+void I_CaptureEndFrame(void);
+
+#endif
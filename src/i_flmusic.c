@@ -19,6 +19,9 @@
 
 #ifdef HAVE_FLUIDSYNTH
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "fluidsynth.h"
 
 #if (FLUIDSYNTH_VERSION_MAJOR < 2 ||                                           \
@@ -35,19 +38,20 @@ typedef fluid_long_long_t fluid_int_t;
 
 #include "SDL_mixer.h"
 
+#include "crispy.h" // [AP] MIN(), MAX(), BETWEEN()
 #include "doomtype.h"
 #include "i_system.h"
 #include "i_sound.h"
 #include "m_misc.h"
-#include "memio.h"
-#include "mus2mid.h"
 
 char *fsynth_sf_path = "";
+int fsynth_block_size = 256; // [AP]
 int fsynth_chorus_active = 1;
 float fsynth_chorus_depth = 5.0f;
 float fsynth_chorus_level = 0.35f;
 int fsynth_chorus_nr = 3;
 float fsynth_chorus_speed = 0.3f;
+int fsynth_latency = 40; // [AP]
 char *fsynth_midibankselect = "gs";
 int fsynth_polyphony = 256;
 int fsynth_reverb_active = 1;
@@ -73,6 +77,206 @@ static void FL_Mix_Callback(void *udata, Uint8 *stream, int len)
     }
 }
 
+// [AP] Rendering ahead on a thread. With fsynth_latency set, the thread
+// keeps a ring of stereo frames filled that far ahead, fsynth_block_size
+// frames at a time, and the music hook only copies out of the ring. If the
+// ring runs dry the hook plays silence and counts a dropout, and the
+// thread lowers the polyphony so that it can keep up. The ring has one
+// writer and one reader, so the hook never takes a lock.
+
+#define FL_MIN_POLYPHONY 64
+
+static int16_t *ring = NULL;
+static unsigned int ring_size;          // frames, a power of two
+static unsigned int ring_target;        // frames the thread renders ahead
+static unsigned int render_block;       // frames per render
+static SDL_atomic_t ring_read;          // frames read and written so far
+static SDL_atomic_t ring_write;
+static SDL_atomic_t ring_primed;        // filled since the last flush
+static SDL_atomic_t dropouts;
+
+static SDL_Thread *render_thread = NULL;
+static SDL_mutex *render_mutex = NULL;  // the player and the ring's writer
+static SDL_sem *render_wake = NULL;     // the hook took frames out
+static SDL_atomic_t render_quit;
+static int render_polyphony;
+static int dropouts_seen;
+
+static void FL_Ring_Callback(void *udata, Uint8 *stream, int len)
+{
+    int16_t *out = (int16_t *) stream;
+    unsigned int frames = len / 4;
+    unsigned int read, count, start, first;
+
+    read = SDL_AtomicGet(&ring_read);
+    count = SDL_AtomicGet(&ring_write) - read;
+    if (count > frames)
+    {
+        count = frames;
+    }
+
+    start = read & (ring_size - 1);
+    first = ring_size - start;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(out, ring + start * 2, first * 4);
+    memcpy(out + first * 2, ring, (count - first) * 4);
+
+    if (count < frames)
+    {
+        memset(out + count * 2, 0, (frames - count) * 4);
+        if (SDL_AtomicGet(&ring_primed))
+        {
+            SDL_AtomicAdd(&dropouts, 1);
+        }
+    }
+
+    SDL_AtomicSet(&ring_read, read + count);
+    SDL_SemPost(render_wake);
+}
+
+// Gives up voices for every dropout, down to FL_MIN_POLYPHONY.
+
+static void FL_GuardPolyphony(void)
+{
+    int count = SDL_AtomicGet(&dropouts);
+
+    if (count == dropouts_seen)
+    {
+        return;
+    }
+
+    dropouts_seen = count;
+
+    if (render_polyphony > FL_MIN_POLYPHONY)
+    {
+        render_polyphony = MAX(render_polyphony * 3 / 4, FL_MIN_POLYPHONY);
+        fluid_synth_set_polyphony(synth, render_polyphony);
+        fprintf(stderr, "FL_RenderThread: %d dropouts, polyphony lowered "
+                "to %d.\n", count, render_polyphony);
+    }
+}
+
+static int FL_RenderThread(void *unused)
+{
+    int16_t *block = malloc(render_block * 4);
+    unsigned int write, start, first;
+
+    while (!SDL_AtomicGet(&render_quit))
+    {
+        SDL_LockMutex(render_mutex);
+
+        write = SDL_AtomicGet(&ring_write);
+
+        if (player == NULL
+         || write - SDL_AtomicGet(&ring_read) + render_block > ring_target)
+        {
+            if (player != NULL)
+            {
+                SDL_AtomicSet(&ring_primed, 1);
+            }
+            SDL_UnlockMutex(render_mutex);
+            SDL_SemWaitTimeout(render_wake, 10);
+            continue;
+        }
+
+        if (fluid_synth_write_s16(synth, render_block, block, 0, 2,
+                                  block, 1, 2) != FLUID_OK)
+        {
+            memset(block, 0, render_block * 4);
+        }
+
+        start = write & (ring_size - 1);
+        first = MIN(render_block, ring_size - start);
+        memcpy(ring + start * 2, block, first * 4);
+        memcpy(ring, block + first * 2, (render_block - first) * 4);
+        SDL_AtomicSet(&ring_write, write + render_block);
+
+        FL_GuardPolyphony();
+
+        SDL_UnlockMutex(render_mutex);
+    }
+
+    free(block);
+
+    return 0;
+}
+
+static void FL_StartRenderThread(void)
+{
+    if (fsynth_latency <= 0)
+    {
+        return;
+    }
+
+    render_block = BETWEEN(64, 8192, fsynth_block_size);
+    ring_target = MAX(snd_samplerate / 1000 * fsynth_latency,
+                      2 * render_block);
+    for (ring_size = 1; ring_size < ring_target; ring_size <<= 1);
+    ring = malloc(ring_size * 4);
+
+    SDL_AtomicSet(&ring_read, 0);
+    SDL_AtomicSet(&ring_write, 0);
+    SDL_AtomicSet(&ring_primed, 0);
+    SDL_AtomicSet(&dropouts, 0);
+    SDL_AtomicSet(&render_quit, 0);
+    dropouts_seen = 0;
+    render_polyphony = fsynth_polyphony;
+
+    render_mutex = SDL_CreateMutex();
+    render_wake = SDL_CreateSemaphore(0);
+    render_thread = SDL_CreateThread(FL_RenderThread, "fluidsynth", NULL);
+
+    if (render_thread == NULL)
+    {
+        // The hook renders, as without fsynth_latency
+        SDL_DestroySemaphore(render_wake);
+        SDL_DestroyMutex(render_mutex);
+        render_wake = NULL;
+        render_mutex = NULL;
+        free(ring);
+        ring = NULL;
+    }
+}
+
+static void FL_StopRenderThread(void)
+{
+    if (render_thread == NULL)
+    {
+        return;
+    }
+
+    SDL_AtomicSet(&render_quit, 1);
+    SDL_SemPost(render_wake);
+    SDL_WaitThread(render_thread, NULL);
+    render_thread = NULL;
+
+    SDL_DestroySemaphore(render_wake);
+    SDL_DestroyMutex(render_mutex);
+    render_wake = NULL;
+    render_mutex = NULL;
+    free(ring);
+    ring = NULL;
+}
+
+static void FL_LockRender(void)
+{
+    if (render_thread != NULL)
+    {
+        SDL_LockMutex(render_mutex);
+    }
+}
+
+static void FL_UnlockRender(void)
+{
+    if (render_thread != NULL)
+    {
+        SDL_UnlockMutex(render_mutex);
+    }
+}
+
 static boolean I_FL_InitMusic(void)
 {
     int sf_id;
@@ -136,6 +340,8 @@ static boolean I_FL_InitMusic(void)
 
     printf("I_FL_InitMusic: Using '%s'.\n", fsynth_sf_path);
 
+    FL_StartRenderThread(); // [AP]
+
     return true;
 }
 
@@ -173,49 +379,32 @@ static void I_FL_StopSong(void)
 static void *I_FL_RegisterSong(void *data, int len)
 {
     int result = FLUID_FAILED;
+    byte *midi;
+    size_t midi_len;
 
+    FL_LockRender(); // [AP]
     player = new_fluid_player(synth);
+    FL_UnlockRender();
 
-    if (IsMid(data, len))
-    {
-        result = fluid_player_add_mem(player, data, len);
+    // [AP] MUS comes converted from the cache. FluidSynth keeps a copy.
+    midi = I_SongMidi(data, len, &midi_len);
 
-        if (result == FLUID_FAILED)
-        {
-            fprintf(stderr,
-                    "I_FL_RegisterSong: FluidSynth failed to load MIDI.\n");
-            return NULL;
-        }
-    }
-    else
+    if (midi != NULL)
     {
-        // Assume a MUS file and try to convert
-        MEMFILE *instream;
-        MEMFILE *outstream;
-        void *outbuf;
-        size_t outbuf_len;
-
-        instream = mem_fopen_read(data, len);
-        outstream = mem_fopen_write();
-
-        if (mus2mid(instream, outstream) == 0)
-        {
-            mem_get_buf(outstream, &outbuf, &outbuf_len);
-            result = fluid_player_add_mem(player, outbuf, outbuf_len);
-        }
-
-        mem_fclose(instream);
-        mem_fclose(outstream);
+        result = fluid_player_add_mem(player, midi, midi_len);
+    }
 
-        if (result == FLUID_FAILED)
-        {
-            fprintf(stderr,
-                    "I_FL_RegisterSong: FluidSynth failed to load MUS.\n");
-            return NULL;
-        }
+    if (result == FLUID_FAILED)
+    {
+        fprintf(stderr,
+                "I_FL_RegisterSong: FluidSynth failed to load %s.\n",
+                IsMus(data, len) ? "MUS" : "MIDI");
+        return NULL;
     }
 
-    Mix_HookMusic(FL_Mix_Callback, NULL);
+    // [AP] Rendered ahead if there's a thread for it
+    Mix_HookMusic(render_thread != NULL ? FL_Ring_Callback : FL_Mix_Callback,
+                  NULL);
     return player;
 }
 
@@ -228,8 +417,22 @@ static void I_FL_UnRegisterSong(void *handle)
 
         Mix_HookMusic(NULL, NULL);
 
+        // [AP] Neither the hook nor the thread is using the ring now, so
+        // what's left in it of this song can go
+        FL_LockRender();
         delete_fluid_player(player);
         player = NULL;
+        if (render_thread != NULL)
+        {
+            if (SDL_AtomicGet(&dropouts) > 0)
+            {
+                printf("I_FL_UnRegisterSong: %d dropouts so far.\n",
+                       SDL_AtomicGet(&dropouts));
+            }
+            SDL_AtomicSet(&ring_read, SDL_AtomicGet(&ring_write));
+            SDL_AtomicSet(&ring_primed, 0);
+        }
+        FL_UnlockRender();
     }
 }
 
@@ -237,6 +440,7 @@ static void I_FL_ShutdownMusic(void)
 {
     I_FL_StopSong();
     I_FL_UnRegisterSong(NULL);
+    FL_StopRenderThread(); // [AP]
 
     if (synth)
     {
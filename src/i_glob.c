@@ -248,6 +248,8 @@ static char *NextGlob(glob_t *glob)
     struct dirent *de;
     char *temp, *ret;
 
+    // [AP] Match the name first: without d_type, IsDirectory() costs a
+    // stat, which only the few entries that match the patterns should pay.
     do
     {
         de = readdir(glob->dir);
@@ -255,8 +257,8 @@ static char *NextGlob(glob_t *glob)
         {
             return NULL;
         }
-    } while (IsDirectory(glob->directory, de)
-          || !MatchesAnyGlob(de->d_name, glob));
+    } while (!MatchesAnyGlob(de->d_name, glob)
+          || IsDirectory(glob->directory, de));
 
     // Return the fully-qualified path, not just the bare filename.
     temp = M_StringJoin(glob->directory, DIR_SEPARATOR_S, de->d_name, NULL);
@@ -456,13 +456,19 @@ static int AccelerateMouseY(int val)
     }
 }
 
+// [crispy] Mouse movement held back for the next tic by SmoothMouse
+static int x_remainder_old = 0;
+static int y_remainder_old = 0;
+
+// [AP] Mouse movement read by I_SampleMouse since the last tic
+static int x_sampled = 0;
+static int y_sampled = 0;
+
 // [crispy] Distribute the mouse movement between the current tic and the next
 // based on how far we are into the current tic. Compensates for mouse sampling
 // jitter.
 static void SmoothMouse(int* x, int* y)
 {
-    static int x_remainder_old = 0;
-    static int y_remainder_old = 0;
     int x_remainder, y_remainder;
     fixed_t correction_factor;
     fixed_t fractic;
@@ -494,6 +500,11 @@ void I_ReadMouse(void)
 
     SDL_GetRelativeMouseState(&x, &y);
 
+    // [AP] Along with what was sampled between tics
+    x += x_sampled;
+    y += y_sampled;
+    x_sampled = y_sampled = 0;
+
     if (crispy->uncapped)
     {
         SmoothMouse(&x, &y);
@@ -520,6 +531,28 @@ void I_ReadMouse(void)
     }
 }
 
+// [AP] Read the mouse between tics, for turning the view every frame. The
+// movement is kept for the next I_ReadMouse, so the tic's event is the same
+// as without sampling. Returns the sideways movement that event will carry
+// so far, as in its data2.
+int I_SampleMouse(void)
+{
+    int x, y;
+
+    SDL_GetRelativeMouseState(&x, &y);
+    x_sampled += x;
+    y_sampled += y;
+
+    x = x_sampled;
+
+    if (crispy->uncapped)
+    {
+        x += x_remainder_old;
+    }
+
+    return AccelerateMouse(x);
+}
+
 // [crispy]
 void I_BindStrifeInputVariables(void)
 {
@@ -38,6 +38,7 @@ extern int runcentering; // [crispy]
 void I_BindStrifeInputVariables(void); // [crispy]
 void I_BindInputVariables(void);
 void I_ReadMouse(void);
+int I_SampleMouse(void); // [AP]
 
 // I_StartTextInput begins text input, activating the on-screen keyboard
 // (if one is used). The caller indicates that any entered text will be
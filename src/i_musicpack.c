@@ -102,8 +102,28 @@ typedef struct
 {
     const char *hash_prefix;
     const char *filename;
+    unsigned int next;  // [AP] Next entry in the same index bucket, plus one
 } subst_music_t;
 
+// [AP] Index of subst_music by the first byte of the hash prefix. Each
+// bucket is a chain of entries in list order (head and tail are stored
+// plus one, so zero means empty). Prefixes of a single character cover
+// several first bytes and go in the extra bucket at the end, which
+// every lookup also walks.
+
+#define SUBST_BUCKETS 257
+
+static unsigned int subst_bucket_head[SUBST_BUCKETS];
+static unsigned int subst_bucket_tail[SUBST_BUCKETS];
+
+// [AP] SHA1 of each music lump, computed the first time it is looked
+// up, so that replaying a song doesn't hash it again. Reset whenever
+// the number of loaded lumps changes.
+
+static sha1_digest_t *lump_hashes = NULL;
+static byte *lump_hashed = NULL;
+static unsigned int lump_hashes_len = 0;
+
 #if !USE_SDL_MIXER_LOOPING
 // Structure containing parsed metadata read from a digital music track:
 typedef struct
@@ -656,18 +676,290 @@ static void ReadLoopPoints(const char *filename, file_metadata_t *metadata)
         metadata->valid = false;
     }
 }
+
+// [AP] Loop points read from each file are kept in an index in the
+// config directory, so that files don't have to be scanned every time
+// a level starts. Entries are checked against the file's size and
+// modification time.
+
+typedef struct
+{
+    char *filename;
+    long mtime, size;
+    file_metadata_t metadata;
+} loop_index_entry_t;
+
+static loop_index_entry_t *loop_index = NULL;
+static unsigned int loop_index_len = 0;
+static boolean loop_index_dirty = false;
+
+static char *LoopIndexPath(void)
+{
+    return M_StringJoin(configdir, "musicloops.idx", NULL);
+}
+
+static boolean GetFileStamp(const char *filename, long *mtime, long *size)
+{
+    struct stat st;
+
+    if (M_stat(filename, &st) != 0)
+    {
+        return false;
+    }
+
+    *mtime = (long) st.st_mtime;
+    *size = (long) st.st_size;
+
+    return true;
+}
+
+static loop_index_entry_t *FindLoopIndex(const char *filename)
+{
+    unsigned int i;
+
+    for (i = 0; i < loop_index_len; ++i)
+    {
+        if (!strcmp(loop_index[i].filename, filename))
+        {
+            return &loop_index[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void AddLoopIndex(const char *filename, long mtime, long size,
+                         const file_metadata_t *metadata)
+{
+    loop_index_entry_t *entry;
+
+    entry = FindLoopIndex(filename);
+
+    if (entry == NULL)
+    {
+        ++loop_index_len;
+        loop_index = I_Realloc(loop_index,
+                               sizeof(loop_index_entry_t) * loop_index_len);
+        entry = &loop_index[loop_index_len - 1];
+        entry->filename = M_StringDuplicate(filename);
+    }
+
+    entry->mtime = mtime;
+    entry->size = size;
+    entry->metadata = *metadata;
+    loop_index_dirty = true;
+}
+
+// Look up the loop points of a file in the index. On success, the
+// file's current size and modification time are returned as well.
+
+static boolean LookupLoopIndex(const char *filename, long *mtime, long *size,
+                               file_metadata_t *metadata)
+{
+    loop_index_entry_t *entry;
+
+    if (!GetFileStamp(filename, mtime, size))
+    {
+        *mtime = *size = -1;
+        return false;
+    }
+
+    entry = FindLoopIndex(filename);
+
+    if (entry == NULL || entry->mtime != *mtime || entry->size != *size)
+    {
+        return false;
+    }
+
+    *metadata = entry->metadata;
+
+    return true;
+}
+
+static void GetLoopPoints(const char *filename, file_metadata_t *metadata)
+{
+    long mtime, size;
+
+    if (LookupLoopIndex(filename, &mtime, &size, metadata))
+    {
+        return;
+    }
+
+    ReadLoopPoints(filename, metadata);
+
+    if (mtime >= 0)
+    {
+        AddLoopIndex(filename, mtime, size, metadata);
+    }
+}
+
+static void LoadLoopIndex(void)
+{
+    char line[1024];
+    char *path;
+    FILE *fs;
+    file_metadata_t metadata;
+    long mtime, size;
+    int valid, name_start;
+    size_t len;
+
+    path = LoopIndexPath();
+    fs = M_fopen(path, "r");
+    free(path);
+
+    if (fs == NULL)
+    {
+        return;
+    }
+
+    while (fgets(line, sizeof(line), fs) != NULL)
+    {
+        len = strlen(line);
+
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+        {
+            line[--len] = '\0';
+        }
+
+        if (sscanf(line, "%ld %ld %d %u %d %d %n", &mtime, &size, &valid,
+                   &metadata.samplerate_hz, &metadata.start_time,
+                   &metadata.end_time, &name_start) != 6
+         || line[name_start] == '\0')
+        {
+            continue;
+        }
+
+        metadata.valid = valid != 0;
+        AddLoopIndex(line + name_start, mtime, size, &metadata);
+    }
+
+    fclose(fs);
+
+    loop_index_dirty = false;
+}
+
+static void SaveLoopIndex(void)
+{
+    char *path;
+    FILE *fs;
+    unsigned int i;
+
+    if (!loop_index_dirty)
+    {
+        return;
+    }
+
+    path = LoopIndexPath();
+    fs = M_fopen(path, "w");
+    free(path);
+
+    if (fs == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < loop_index_len; ++i)
+    {
+        fprintf(fs, "%ld %ld %d %u %d %d %s\n",
+                loop_index[i].mtime, loop_index[i].size,
+                loop_index[i].metadata.valid,
+                loop_index[i].metadata.samplerate_hz,
+                loop_index[i].metadata.start_time,
+                loop_index[i].metadata.end_time,
+                loop_index[i].filename);
+    }
+
+    fclose(fs);
+
+    loop_index_dirty = false;
+}
 #endif // !USE_SDL_MIXER_LOOPING
 
 // Given a MUS lump, look up a substitute MUS file to play instead
 // (or NULL to just use normal MIDI playback).
 
-static const char *GetSubstituteMusicFile(void *data, size_t data_len)
+static int HexDigit(char c)
+{
+    c = tolower(c);
+
+    return c >= 'a' ? c - 'a' + 10 : c - '0';
+}
+
+// Index bucket for a hash prefix.
+
+static unsigned int SubstBucket(const char *hash_prefix)
+{
+    if (hash_prefix[0] == '\0' || hash_prefix[1] == '\0')
+    {
+        return SUBST_BUCKETS - 1;
+    }
+
+    return (HexDigit(hash_prefix[0]) << 4) | HexDigit(hash_prefix[1]);
+}
+
+// Find the lump that a block of music data was read from, or -1.
+
+static int LumpForData(void *data, size_t data_len)
+{
+    lumpinfo_t *lump;
+    unsigned int i;
+
+    for (i = 0; i < numlumps; ++i)
+    {
+        lump = lumpinfo[i];
+
+        if (lump->size == data_len
+         && (lump->cache == data
+          || (lump->wad_file->mapped != NULL
+           && lump->wad_file->mapped + lump->position == data)))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void HashMusicData(void *data, size_t data_len, sha1_digest_t hash)
 {
     sha1_context_t context;
+    int lumpnum;
+
+    if (lump_hashes_len != numlumps)
+    {
+        free(lump_hashes);
+        free(lump_hashed);
+        lump_hashes = calloc(numlumps, sizeof(sha1_digest_t));
+        lump_hashed = calloc(numlumps, 1);
+        lump_hashes_len = lump_hashes != NULL && lump_hashed != NULL
+                        ? numlumps : 0;
+    }
+
+    lumpnum = lump_hashes_len > 0 ? LumpForData(data, data_len) : -1;
+
+    if (lumpnum >= 0 && lump_hashed[lumpnum])
+    {
+        memcpy(hash, lump_hashes[lumpnum], sizeof(sha1_digest_t));
+        return;
+    }
+
+    SHA1_Init(&context);
+    SHA1_Update(&context, data, data_len);
+    SHA1_Final(hash, &context);
+
+    if (lumpnum >= 0)
+    {
+        memcpy(lump_hashes[lumpnum], hash, sizeof(sha1_digest_t));
+        lump_hashed[lumpnum] = 1;
+    }
+}
+
+static const char *GetSubstituteMusicFile(void *data, size_t data_len)
+{
     sha1_digest_t hash;
     const char *filename;
     char hash_str[sizeof(sha1_digest_t) * 2 + 1];
-    unsigned int i;
+    unsigned int i, j, k;
 
     // Don't bother doing a hash if we're never going to find anything.
     if (subst_music_len == 0)
@@ -675,9 +967,7 @@ static const char *GetSubstituteMusicFile(void *data, size_t data_len)
         return NULL;
     }
 
-    SHA1_Init(&context);
-    SHA1_Update(&context, data, data_len);
-    SHA1_Final(hash, &context);
+    HashMusicData(data, data_len, hash);
 
     // Build a string representation of the hash.
     for (i = 0; i < sizeof(sha1_digest_t); ++i)
@@ -691,13 +981,30 @@ static const char *GetSubstituteMusicFile(void *data, size_t data_len)
     // filename mappings for the same hash. This allows us to try
     // different files and fall back if our first choice isn't found.
 
+    // [AP] Only the bucket for the first byte and the short prefix
+    // bucket can match. Walk them together in list order.
+
     filename = NULL;
 
-    for (i = 0; i < subst_music_len; ++i)
+    i = subst_bucket_head[SubstBucket(hash_str)];
+    j = subst_bucket_head[SUBST_BUCKETS - 1];
+
+    while (i != 0 || j != 0)
     {
-        if (M_StringStartsWith(hash_str, subst_music[i].hash_prefix))
+        if (j == 0 || (i != 0 && i < j))
+        {
+            k = i - 1;
+            i = subst_music[k].next;
+        }
+        else
         {
-            filename = subst_music[i].filename;
+            k = j - 1;
+            j = subst_music[k].next;
+        }
+
+        if (M_StringStartsWith(hash_str, subst_music[k].hash_prefix))
+        {
+            filename = subst_music[k].filename;
 
             // If the file exists, then use this file in preference to
             // any fallbacks. But we always return a filename if it's
@@ -781,6 +1088,7 @@ static void AddSubstituteMusic(const char *musicdir, const char *hash_prefix,
                                const char *filename)
 {
     subst_music_t *s;
+    unsigned int bucket;
     char *path;
 
     path = ExpandFileExtension(musicdir, filename);
@@ -795,6 +1103,20 @@ static void AddSubstituteMusic(const char *musicdir, const char *hash_prefix,
     s = &subst_music[subst_music_len - 1];
     s->hash_prefix = hash_prefix;
     s->filename = path;
+    s->next = 0;
+
+    bucket = SubstBucket(hash_prefix);
+
+    if (subst_bucket_tail[bucket] != 0)
+    {
+        subst_music[subst_bucket_tail[bucket] - 1].next = subst_music_len;
+    }
+    else
+    {
+        subst_bucket_head[bucket] = subst_music_len;
+    }
+
+    subst_bucket_tail[bucket] = subst_music_len;
 }
 
 static const char *ReadHashPrefix(char *line)
@@ -1019,6 +1341,67 @@ static void LoadSubstituteConfigs(void)
     free(musicdir);
 }
 
+// [AP] Add a recording made by the OPL music module.
+
+void I_MP_AddCachedMusic(const char *hash, const char *filename)
+{
+    if (music_initialized)
+    {
+        AddSubstituteMusic("", M_StringDuplicate(hash), filename);
+    }
+}
+
+// [AP] Add the recordings the OPL music module made in earlier
+// sessions. This is done on the first song rather than at startup,
+// as the game only selects the OPL driver version after sound init.
+
+static void LoadCachedMusic(void)
+{
+    static boolean loaded = false;
+    glob_t *glob;
+    char *dir, *hash;
+    const char *path, *name;
+    unsigned int old_music_len;
+
+    dir = I_OPL_MusicCacheDir();
+
+    if (loaded || dir == NULL)
+    {
+        return;
+    }
+
+    loaded = true;
+    old_music_len = subst_music_len;
+
+    glob = I_StartGlob(dir, "*.wav", GLOB_FLAG_NOCASE);
+    for (;;)
+    {
+        path = I_NextGlob(glob);
+        if (path == NULL)
+        {
+            break;
+        }
+
+        name = M_BaseName(path);
+        if (strlen(name) != sizeof(sha1_digest_t) * 2 + 4)
+        {
+            continue;
+        }
+
+        hash = M_StringDuplicate(name);
+        hash[sizeof(sha1_digest_t) * 2] = '\0';
+        I_MP_AddCachedMusic(hash, path);
+        free(hash);
+    }
+    I_EndGlob(glob);
+
+    if (subst_music_len > old_music_len)
+    {
+        printf("Loaded %u recorded OPL songs.\n",
+               subst_music_len - old_music_len);
+    }
+}
+
 // Returns true if the given lump number is a music lump that should
 // be included in substitute configs.
 // Identifying music lumps by name is not feasible; some games (eg.
@@ -1103,11 +1486,174 @@ static void DumpSubstituteConfig(const char *filename)
 
 // Shutdown music
 
+// [AP] I_MP_PrefetchSong() reads a substitute file into memory on a
+// background thread, so that it can be played without touching the
+// disk when the song is registered.
+
+typedef struct
+{
+    char *filename;
+    void *data;
+    size_t len;
+#if !USE_SDL_MIXER_LOOPING
+    boolean indexed;
+    long mtime, size;
+    file_metadata_t metadata;
+#endif
+} prefetch_t;
+
+static prefetch_t prefetch;
+static SDL_Thread *prefetch_thread = NULL;
+
+// Memory backing the registered song, if it came from a prefetch.
+
+static void *song_buffer = NULL;
+static Mix_Music *song_buffer_music = NULL;
+
+static int PrefetchThread(void *unused)
+{
+    FILE *fs;
+    long len;
+
+    prefetch.data = NULL;
+
+    fs = M_fopen(prefetch.filename, "rb");
+
+    if (fs == NULL)
+    {
+        return 0;
+    }
+
+    len = M_FileLength(fs);
+
+    if (len > 0)
+    {
+        prefetch.data = malloc(len);
+
+        if (prefetch.data != NULL
+         && fread(prefetch.data, 1, len, fs) != (size_t) len)
+        {
+            free(prefetch.data);
+            prefetch.data = NULL;
+        }
+
+        prefetch.len = len;
+    }
+
+    fclose(fs);
+
+#if !USE_SDL_MIXER_LOOPING
+    if (prefetch.data != NULL && !prefetch.indexed)
+    {
+        ReadLoopPoints(prefetch.filename, &prefetch.metadata);
+    }
+#endif
+
+    return 0;
+}
+
+static void ClearPrefetch(void)
+{
+    if (prefetch_thread != NULL)
+    {
+        SDL_WaitThread(prefetch_thread, NULL);
+        prefetch_thread = NULL;
+    }
+
+    free(prefetch.filename);
+    free(prefetch.data);
+    prefetch.filename = NULL;
+    prefetch.data = NULL;
+}
+
+void I_MP_PrefetchSong(void *data, int len)
+{
+    const char *filename;
+
+    if (!music_initialized)
+    {
+        return;
+    }
+
+    LoadCachedMusic();
+
+    filename = GetSubstituteMusicFile(data, len);
+
+    if (filename == NULL
+     || (prefetch.filename != NULL && !strcmp(prefetch.filename, filename)))
+    {
+        return;
+    }
+
+    ClearPrefetch();
+
+    prefetch.filename = M_StringDuplicate(filename);
+
+#if !USE_SDL_MIXER_LOOPING
+    prefetch.indexed = LookupLoopIndex(filename, &prefetch.mtime,
+                                       &prefetch.size, &prefetch.metadata);
+#endif
+
+    prefetch_thread = SDL_CreateThread(PrefetchThread, "Music prefetch",
+                                       NULL);
+
+    if (prefetch_thread == NULL)
+    {
+        ClearPrefetch();
+    }
+}
+
+// Load the prefetched file if it is the one wanted.
+
+static Mix_Music *LoadPrefetchedSong(const char *filename)
+{
+    Mix_Music *music = NULL;
+
+    if (prefetch.filename == NULL || strcmp(prefetch.filename, filename))
+    {
+        return NULL;
+    }
+
+    SDL_WaitThread(prefetch_thread, NULL);
+    prefetch_thread = NULL;
+
+    if (prefetch.data != NULL && song_buffer == NULL)
+    {
+        music = Mix_LoadMUS_RW(SDL_RWFromConstMem(prefetch.data,
+                                                  prefetch.len), 1);
+    }
+
+    if (music != NULL)
+    {
+        song_buffer = prefetch.data;
+        song_buffer_music = music;
+        prefetch.data = NULL;
+
+#if !USE_SDL_MIXER_LOOPING
+        file_metadata = prefetch.metadata;
+
+        if (!prefetch.indexed && prefetch.mtime >= 0)
+        {
+            AddLoopIndex(filename, prefetch.mtime, prefetch.size,
+                         &prefetch.metadata);
+        }
+#endif
+    }
+
+    ClearPrefetch();
+
+    return music;
+}
+
 static void I_MP_ShutdownMusic(void)
 {
     if (music_initialized)
     {
         Mix_HaltMusic();
+        ClearPrefetch();
+#if !USE_SDL_MIXER_LOOPING
+        SaveLoopIndex();
+#endif
         music_initialized = false;
 
         if (sdl_was_initialized)
@@ -1158,9 +1704,14 @@ static boolean I_MP_InitMusic(void)
     // If we're in GENMIDI mode, try to load sound packs.
     LoadSubstituteConfigs();
 
+#if !USE_SDL_MIXER_LOOPING
+    LoadLoopIndex();
+#endif
+
     // We can't initialize if we don't have any substitute files to work with.
     // If so, don't bother with SDL initialization etc.
-    if (subst_music_len == 0)
+    // [AP] Unless the OPL music module will be recording some.
+    if (subst_music_len == 0 && I_OPL_MusicCacheDir() == NULL)
     {
         return false;
     }
@@ -1300,6 +1851,13 @@ static void I_MP_UnRegisterSong(void *handle)
     }
 
     Mix_FreeMusic(music);
+
+    if (music == song_buffer_music)
+    {
+        free(song_buffer);
+        song_buffer = NULL;
+        song_buffer_music = NULL;
+    }
 }
 
 static void *I_MP_RegisterSong(void *data, int len)
@@ -1312,6 +1870,8 @@ static void *I_MP_RegisterSong(void *data, int len)
         return NULL;
     }
 
+    LoadCachedMusic();
+
     // See if we're substituting this MUS for a high-quality replacement.
     filename = GetSubstituteMusicFile(data, len);
     if (filename == NULL)
@@ -1319,6 +1879,12 @@ static void *I_MP_RegisterSong(void *data, int len)
         return NULL;
     }
 
+    music = LoadPrefetchedSong(filename);
+    if (music != NULL)
+    {
+        return music;
+    }
+
     music = Mix_LoadMUS(filename);
     if (music == NULL)
     {
@@ -1332,7 +1898,7 @@ static void *I_MP_RegisterSong(void *data, int len)
 #if !USE_SDL_MIXER_LOOPING
     // Read loop point metadata from the file so that we know where
     // to loop the music.
-    ReadLoopPoints(filename, &file_metadata);
+    GetLoopPoints(filename, &file_metadata);
 #endif // !USE_SDL_MIXER_LOOPING
     return music;
 }
@@ -1488,6 +2054,14 @@ static void I_NULL_PollMusic(void)
 {
 }
 
+void I_MP_AddCachedMusic(const char *hash, const char *filename)
+{
+}
+
+void I_MP_PrefetchSong(void *data, int len)
+{
+}
+
 const music_module_t music_pack_module =
 {
     NULL,
@@ -21,13 +21,15 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "memio.h"
-#include "mus2mid.h"
+#include "SDL.h"
+
 
 #include "deh_main.h"
 #include "i_sound.h"
 #include "i_swap.h"
+#include "m_config.h"
 #include "m_misc.h"
+#include "sha1.h"
 #include "w_wad.h"
 #include "z_zone.h"
 
@@ -97,15 +99,6 @@ typedef struct
 
 } opl_channel_data_t;
 
-// Data associated with a track that is currently playing.
-
-typedef struct
-{
-    // Track iterator used to read new events.
-
-    midi_track_iter_t *iter;
-} opl_track_data_t;
-
 typedef struct opl_voice_s opl_voice_t;
 
 struct opl_voice_s
@@ -320,20 +313,45 @@ static char (*percussion_names)[32];
 static opl_voice_t voices[OPL_NUM_VOICES * 2];
 static opl_voice_t *voice_free_list[OPL_NUM_VOICES * 2];
 static opl_voice_t *voice_alloced_list[OPL_NUM_VOICES * 2];
+static int voice_free_head;  // [AP] free list is a ring starting here
 static int voice_free_num;
 static int voice_alloced_num;
 static int opl_opl3mode;
 static int num_opl_voices;
 
+// [AP] Music cache: the first pass of each looping song is recorded
+// and written out as a WAV file that the music pack module can play
+// instead. The file is named after the hash of the song lump, in a
+// directory named after the settings that affect the output.
+
+typedef struct
+{
+    int16_t *samples;
+    unsigned int nsamples;
+    unsigned int rate;
+    char *path;
+    char hash[sizeof(sha1_digest_t) * 2 + 1];
+    boolean ok;
+    SDL_atomic_t done;
+} cache_write_t;
+
+static boolean music_cache_enabled = false;
+static char genmidi_hash[9];
+static char song_hash[sizeof(sha1_digest_t) * 2 + 1];
+static char capture_hash[sizeof(sha1_digest_t) * 2 + 1];
+static boolean song_capturing = false;
+static SDL_Thread *cache_thread = NULL;
+static cache_write_t cache_write;
+
 // Data for each channel.
 
 static opl_channel_data_t channels[MIDI_CHANNELS_PER_TRACK];
 
-// Track data for playing tracks:
+// Events of the playing song, merged from all of its tracks:
 
-static opl_track_data_t *tracks;
-static unsigned int num_tracks = 0;
-static unsigned int running_tracks = 0;
+static midi_event_t *song_events;
+static unsigned int num_song_events = 0;
+static unsigned int song_position;
 static boolean song_looping;
 
 // Tempo control variables
@@ -366,6 +384,20 @@ static boolean LoadInstrumentTable(void)
 
     lump = W_CacheLumpName(DEH_String("genmidi"), PU_STATIC);
 
+    // [AP] Recordings made with different instruments can't be reused.
+    if (music_cache_enabled)
+    {
+        sha1_context_t context;
+        sha1_digest_t hash;
+
+        SHA1_Init(&context);
+        SHA1_Update(&context, lump,
+                    W_LumpLength(W_GetNumForName(DEH_String("genmidi"))));
+        SHA1_Final(hash, &context);
+        M_snprintf(genmidi_hash, sizeof(genmidi_hash), "%02x%02x%02x%02x",
+                   hash[0], hash[1], hash[2], hash[3]);
+    }
+
     // DMX does not check header
 
     main_instrs = (genmidi_instr_t *) (lump + strlen(GENMIDI_HEADER));
@@ -382,7 +414,6 @@ static boolean LoadInstrumentTable(void)
 static opl_voice_t *GetFreeVoice(void)
 {
     opl_voice_t *result;
-    int i;
 
     // None available?
 
@@ -393,15 +424,11 @@ static opl_voice_t *GetFreeVoice(void)
 
     // Remove from free list
 
-    result = voice_free_list[0];
+    result = voice_free_list[voice_free_head];
 
+    voice_free_head = (voice_free_head + 1) % arrlen(voice_free_list);
     voice_free_num--;
 
-    for (i = 0; i < voice_free_num; i++)
-    {
-        voice_free_list[i] = voice_free_list[i + 1];
-    }
-
     // Add to allocated list
 
     voice_alloced_list[voice_alloced_num++] = result;
@@ -448,7 +475,8 @@ static void ReleaseVoice(int index)
 
     // Search to the end of the freelist (This is how Doom behaves!)
 
-    voice_free_list[voice_free_num++] = voice;
+    voice_free_list[(voice_free_head + voice_free_num++)
+                    % arrlen(voice_free_list)] = voice;
 
     if (double_voice && opl_drv_ver < opl_doom_1_9)
     {
@@ -610,6 +638,7 @@ static void InitVoices(void)
 
     // Start with an empty free list.
     
+    voice_free_head = 0;
     voice_free_num = num_opl_voices;
     voice_alloced_num = 0;
 
@@ -638,6 +667,16 @@ static void I_OPL_SetMusicVolume(int volume)
 {
     unsigned int i;
 
+    // [AP] While caching, voices always play at full volume and the
+    // emulator output is scaled instead, the same way the music pack
+    // module scales the recordings. Otherwise the volume at the time
+    // a song was recorded would be baked into it.
+    if (music_cache_enabled)
+    {
+        OPL_SetOutputVolume((volume * 128) / 127);
+        volume = 127;
+    }
+
     if (current_music_volume == volume)
     {
         return;
@@ -668,8 +707,7 @@ static void VoiceKeyOff(opl_voice_t *voice)
                       voice->freq >> 8);
 }
 
-static opl_channel_data_t *TrackChannelForEvent(opl_track_data_t *track,
-                                                midi_event_t *event)
+static opl_channel_data_t *TrackChannelForEvent(midi_event_t *event)
 {
     unsigned int channel_num = event->data.channel.channel;
 
@@ -690,7 +728,7 @@ static opl_channel_data_t *TrackChannelForEvent(opl_track_data_t *track,
 
 // Get the frequency that we should be using for a voice.
 
-static void KeyOffEvent(opl_track_data_t *track, midi_event_t *event)
+static void KeyOffEvent(midi_event_t *event)
 {
     opl_channel_data_t *channel;
     int i;
@@ -703,7 +741,7 @@ static void KeyOffEvent(opl_track_data_t *track, midi_event_t *event)
            event->data.channel.param2);
 */
 
-    channel = TrackChannelForEvent(track, event);
+    channel = TrackChannelForEvent(event);
     key = event->data.channel.param1;
 
     // Turn off voices being used to play this key.
@@ -802,12 +840,58 @@ static void ReplaceExistingVoiceDoom2(opl_channel_data_t *channel)
 }
 
 
+// [AP] Register value for every frequency index FrequencyForVoice()
+// can produce: the highest note, plus the maximum pitch bend and fine
+// tuning offsets.
+
+#define FREQUENCY_TABLE_LEN (64 + 32 * 95 + 63 + 63 + 1)
+
+static unsigned short frequency_table[FREQUENCY_TABLE_LEN];
+
+static void InitFrequencyTable(void)
+{
+    unsigned int freq_index;
+    unsigned int octave;
+    unsigned int sub_index;
+
+    for (freq_index = 0; freq_index < FREQUENCY_TABLE_LEN; ++freq_index)
+    {
+        // The first 7 notes use the start of the table, while
+        // consecutive notes loop around the latter part.
+
+        if (freq_index < 284)
+        {
+            frequency_table[freq_index] = frequency_curve[freq_index];
+            continue;
+        }
+
+        sub_index = (freq_index - 284) % (12 * 32);
+        octave = (freq_index - 284) / (12 * 32);
+
+        // Once the seventh octave is reached, things break down.
+        // We can only go up to octave 7 as a maximum anyway (the OPL
+        // register only has three bits for octave number), but for the
+        // notes in octave 7, the first five bits have octave=7, the
+        // following notes have octave=6.  This 7/6 pattern repeats in
+        // following octaves (which are technically impossible to
+        // represent anyway).
+
+        if (octave >= 7)
+        {
+            octave = 7;
+        }
+
+        // Calculate the resulting register value to use for the frequency.
+
+        frequency_table[freq_index] =
+            frequency_curve[sub_index + 284] | (octave << 10);
+    }
+}
+
 static unsigned int FrequencyForVoice(opl_voice_t *voice)
 {
     genmidi_voice_t *gm_voice;
     signed int freq_index;
-    unsigned int octave;
-    unsigned int sub_index;
     signed int note;
 
     note = voice->note;
@@ -849,33 +933,7 @@ static unsigned int FrequencyForVoice(opl_voice_t *voice)
         freq_index = 0;
     }
 
-    // The first 7 notes use the start of the table, while
-    // consecutive notes loop around the latter part.
-
-    if (freq_index < 284)
-    {
-        return frequency_curve[freq_index];
-    }
-
-    sub_index = (freq_index - 284) % (12 * 32);
-    octave = (freq_index - 284) / (12 * 32);
-
-    // Once the seventh octave is reached, things break down.
-    // We can only go up to octave 7 as a maximum anyway (the OPL
-    // register only has three bits for octave number), but for the
-    // notes in octave 7, the first five bits have octave=7, the
-    // following notes have octave=6.  This 7/6 pattern repeats in
-    // following octaves (which are technically impossible to
-    // represent anyway).
-
-    if (octave >= 7)
-    {
-        octave = 7;
-    }
-
-    // Calculate the resulting register value to use for the frequency.
-
-    return frequency_curve[sub_index + 284] | (octave << 10);
+    return frequency_table[freq_index];
 }
 
 // Update the frequency that a voice is programmed to use.
@@ -958,7 +1016,7 @@ static void VoiceKeyOn(opl_channel_data_t *channel,
     UpdateVoiceFrequency(voice);
 }
 
-static void KeyOnEvent(opl_track_data_t *track, midi_event_t *event)
+static void KeyOnEvent(midi_event_t *event)
 {
     genmidi_instr_t *instrument;
     opl_channel_data_t *channel;
@@ -981,12 +1039,12 @@ static void KeyOnEvent(opl_track_data_t *track, midi_event_t *event)
     // key off.
     if (volume <= 0)
     {
-        KeyOffEvent(track, event);
+        KeyOffEvent(event);
         return;
     }
 
     // The channel.
-    channel = TrackChannelForEvent(track, event);
+    channel = TrackChannelForEvent(event);
 
     // Percussion channel is treated differently.
     if (event->data.channel.channel == 9)
@@ -1072,14 +1130,14 @@ static void KeyOnEvent(opl_track_data_t *track, midi_event_t *event)
     }
 }
 
-static void ProgramChangeEvent(opl_track_data_t *track, midi_event_t *event)
+static void ProgramChangeEvent(midi_event_t *event)
 {
     opl_channel_data_t *channel;
     int instrument;
 
     // Set the instrument used on this channel.
 
-    channel = TrackChannelForEvent(track, event);
+    channel = TrackChannelForEvent(event);
     instrument = event->data.channel.param1;
     channel->instrument = &main_instrs[instrument];
 
@@ -1178,7 +1236,7 @@ static void AllNotesOff(opl_channel_data_t *channel, unsigned int param)
     }
 }
 
-static void ControllerEvent(opl_track_data_t *track, midi_event_t *event)
+static void ControllerEvent(midi_event_t *event)
 {
     opl_channel_data_t *channel;
     unsigned int controller;
@@ -1191,7 +1249,7 @@ static void ControllerEvent(opl_track_data_t *track, midi_event_t *event)
            event->data.channel.param2);
 */
 
-    channel = TrackChannelForEvent(track, event);
+    channel = TrackChannelForEvent(event);
     controller = event->data.channel.param1;
     param = event->data.channel.param2;
 
@@ -1219,7 +1277,7 @@ static void ControllerEvent(opl_track_data_t *track, midi_event_t *event)
 
 // Process a pitch bend event.
 
-static void PitchBendEvent(opl_track_data_t *track, midi_event_t *event)
+static void PitchBendEvent(midi_event_t *event)
 {
     opl_channel_data_t *channel;
     int i;
@@ -1231,7 +1289,7 @@ static void PitchBendEvent(opl_track_data_t *track, midi_event_t *event)
     // Update the channel bend value.  Only the MSB of the pitch bend
     // value is considered: this is what Doom does.
 
-    channel = TrackChannelForEvent(track, event);
+    channel = TrackChannelForEvent(event);
     channel->bend = event->data.channel.param2 - 64;
 
     // Update all voices for this channel.
@@ -1269,7 +1327,7 @@ static void MetaSetTempo(unsigned int tempo)
 
 // Process a meta event.
 
-static void MetaEvent(opl_track_data_t *track, midi_event_t *event)
+static void MetaEvent(midi_event_t *event)
 {
     byte *data = event->data.meta.data;
     unsigned int data_len = event->data.meta.length;
@@ -1297,7 +1355,7 @@ static void MetaEvent(opl_track_data_t *track, midi_event_t *event)
             break;
 
         // End of track - actually handled when we run out of events
-        // in the track, see below.
+        // in the song, see SongTimerCallback().
 
         case MIDI_META_END_OF_TRACK:
             break;
@@ -1313,32 +1371,32 @@ static void MetaEvent(opl_track_data_t *track, midi_event_t *event)
 
 // Process a MIDI event from a track.
 
-static void ProcessEvent(opl_track_data_t *track, midi_event_t *event)
+static void ProcessEvent(midi_event_t *event)
 {
     switch (event->event_type)
     {
         case MIDI_EVENT_NOTE_OFF:
-            KeyOffEvent(track, event);
+            KeyOffEvent(event);
             break;
 
         case MIDI_EVENT_NOTE_ON:
-            KeyOnEvent(track, event);
+            KeyOnEvent(event);
             break;
 
         case MIDI_EVENT_CONTROLLER:
-            ControllerEvent(track, event);
+            ControllerEvent(event);
             break;
 
         case MIDI_EVENT_PROGRAM_CHANGE:
-            ProgramChangeEvent(track, event);
+            ProgramChangeEvent(event);
             break;
 
         case MIDI_EVENT_PITCH_BEND:
-            PitchBendEvent(track, event);
+            PitchBendEvent(event);
             break;
 
         case MIDI_EVENT_META:
-            MetaEvent(track, event);
+            MetaEvent(event);
             break;
 
         // SysEx events can be ignored.
@@ -1355,7 +1413,7 @@ static void ProcessEvent(opl_track_data_t *track, midi_event_t *event)
     }
 }
 
-static void ScheduleTrack(opl_track_data_t *track);
+static void ScheduleNextEvent(void);
 static void InitChannel(opl_channel_data_t *channel);
 
 // Restart a song from the beginning.
@@ -1364,54 +1422,50 @@ static void RestartSong(void *unused)
 {
     unsigned int i;
 
-    running_tracks = num_tracks;
+    song_position = 0;
 
     start_music_volume = current_music_volume;
 
-    for (i = 0; i < num_tracks; ++i)
+    // [AP] One pass through the song is all the cache needs.
+    if (song_capturing)
     {
-        MIDI_RestartIterator(tracks[i].iter);
-        ScheduleTrack(&tracks[i]);
+        OPL_StopCapture();
+        song_capturing = false;
     }
 
+    ScheduleNextEvent();
+
     for (i = 0; i < MIDI_CHANNELS_PER_TRACK; ++i)
     {
         InitChannel(&channels[i]);
     }
 }
 
-// Callback function invoked when another event needs to be read from
-// a track.
+// Callback function invoked when the next event in the song needs to
+// be played.
 
-static void TrackTimerCallback(void *arg)
+static void SongTimerCallback(void *unused)
 {
-    opl_track_data_t *track = arg;
-    midi_event_t *event;
-
-    // Get the next event and process it.
+    // Play this event and any others that are due at the same time.
 
-    if (!MIDI_GetNextEvent(track->iter, &event))
+    do
     {
-        return;
-    }
-
-    ProcessEvent(track, event);
+        ProcessEvent(&song_events[song_position]);
+        ++song_position;
+    } while (song_position < num_song_events
+          && song_events[song_position].delta_time == 0);
 
-    // End of track?
+    // End of song?
 
-    if (event->event_type == MIDI_EVENT_META
-     && event->data.meta.type == MIDI_META_END_OF_TRACK)
+    if (song_position >= num_song_events)
     {
-        --running_tracks;
-
-        // When all tracks have finished, restart the song.
         // Don't restart the song immediately, but wait for 5ms
         // before triggering a restart.  Otherwise it is possible
         // to construct an empty MIDI file that causes the game
         // to lock up in an infinite loop. (5ms should be short
         // enough not to be noticeable by the listener).
 
-        if (running_tracks <= 0 && song_looping)
+        if (song_looping)
         {
             OPL_SetCallback(5000, RestartSong, NULL);
         }
@@ -1419,25 +1473,23 @@ static void TrackTimerCallback(void *arg)
         return;
     }
 
-    // Reschedule the callback for the next event in the track.
-
-    ScheduleTrack(track);
+    ScheduleNextEvent();
 }
 
-static void ScheduleTrack(opl_track_data_t *track)
+static void ScheduleNextEvent(void)
 {
     unsigned int nticks;
     uint64_t us;
 
     // Get the number of microseconds until the next event.
 
-    nticks = MIDI_GetDeltaTime(track->iter);
+    nticks = song_events[song_position].delta_time;
     us = ((uint64_t) nticks * us_per_beat) / ticks_per_beat;
 
     // Set a timer to be invoked when the next event is
     // ready to play.
 
-    OPL_SetCallback(us, TrackTimerCallback, track);
+    OPL_SetCallback(us, SongTimerCallback, NULL);
 }
 
 // Initialize a channel.
@@ -1457,20 +1509,6 @@ static void InitChannel(opl_channel_data_t *channel)
     channel->bend = 0;
 }
 
-// Start a MIDI track playing:
-
-static void StartTrack(midi_file_t *file, unsigned int track_num)
-{
-    opl_track_data_t *track;
-
-    track = &tracks[track_num];
-    track->iter = MIDI_IterateTrack(file, track_num);
-
-    // Schedule the first event.
-
-    ScheduleTrack(track);
-}
-
 // Start playing a mid
 
 static void I_OPL_PlaySong(void *handle, boolean looping)
@@ -1485,12 +1523,17 @@ static void I_OPL_PlaySong(void *handle, boolean looping)
 
     file = handle;
 
-    // Allocate track data.
+    // All tracks are played from a single stream of events.
 
-    tracks = malloc(MIDI_NumTracks(file) * sizeof(opl_track_data_t));
+    song_events = MIDI_GetEventStream(file, &num_song_events);
 
-    num_tracks = MIDI_NumTracks(file);
-    running_tracks = num_tracks;
+    if (song_events == NULL)
+    {
+        num_song_events = 0;
+        return;
+    }
+
+    song_position = 0;
     song_looping = looping;
 
     ticks_per_beat = MIDI_GetFileTimeDivision(file);
@@ -1502,11 +1545,25 @@ static void I_OPL_PlaySong(void *handle, boolean looping)
 
     start_music_volume = current_music_volume;
 
-    for (i = 0; i < num_tracks; ++i)
+    // [AP] Record the song if it isn't in the cache yet. Only one
+    // recording is written out at a time.
+    if (looping && song_hash[0] != '\0' && cache_thread == NULL)
     {
-        StartTrack(file, i);
+        char *path;
+
+        path = M_StringJoin(I_OPL_MusicCacheDir(), song_hash, ".wav", NULL);
+
+        if (!M_FileExists(path) && OPL_StartCapture())
+        {
+            M_StringCopy(capture_hash, song_hash, sizeof(capture_hash));
+            song_capturing = true;
+        }
+
+        free(path);
     }
 
+    ScheduleNextEvent();
+
     for (i = 0; i < MIDI_CHANNELS_PER_TRACK; ++i)
     {
         InitChannel(&channels[i]);
@@ -1532,6 +1589,18 @@ static void I_OPL_PauseSong(void)
 
     OPL_SetPaused(1);
 
+    // [AP] Pausing cuts off notes, so the recording would be wrong.
+
+    OPL_Lock();
+
+    if (song_capturing)
+    {
+        OPL_CancelCapture();
+        song_capturing = false;
+    }
+
+    OPL_Unlock();
+
     // Turn off all main instrument voices (not percussion).
     // This is what Vanilla does.
 
@@ -1570,24 +1639,25 @@ static void I_OPL_StopSong(void)
 
     OPL_ClearCallbacks();
 
-    // Free all voices.
+    // A song stopped before it looped can't be cached.
 
-    for (i = 0; i < MIDI_CHANNELS_PER_TRACK; ++i)
+    if (song_capturing)
     {
-        AllNotesOff(&channels[i], 0);
+        OPL_CancelCapture();
+        song_capturing = false;
     }
 
-    // Free all track data.
+    // Free all voices.
 
-    for (i = 0; i < num_tracks; ++i)
+    for (i = 0; i < MIDI_CHANNELS_PER_TRACK; ++i)
     {
-        MIDI_FreeIterator(tracks[i].iter);
+        AllNotesOff(&channels[i], 0);
     }
 
-    free(tracks);
+    // The event stream belongs to the song handle.
 
-    tracks = NULL;
-    num_tracks = 0;
+    song_events = NULL;
+    num_song_events = 0;
 
     OPL_Unlock();
 }
@@ -1605,72 +1675,213 @@ static void I_OPL_UnRegisterSong(void *handle)
     }
 }
 
-static boolean ConvertMus(byte *musdata, int len, char *filename)
+static void *I_OPL_RegisterSong(void *data, int len)
 {
-    MEMFILE *instream;
-    MEMFILE *outstream;
-    void *outbuf;
-    size_t outbuf_len;
-    int result;
+    midi_file_t *result;
+    byte *midi;
+    size_t midi_len;
 
-    instream = mem_fopen_read(musdata, len);
-    outstream = mem_fopen_write();
+    if (!music_initialized)
+    {
+        return NULL;
+    }
 
-    result = mus2mid(instream, outstream);
+    // [AP] The music pack module looks recordings up by the same hash.
+    song_hash[0] = '\0';
 
-    if (result == 0)
+    if (I_OPL_MusicCacheDir() != NULL)
     {
-        mem_get_buf(outstream, &outbuf, &outbuf_len);
+        sha1_context_t context;
+        sha1_digest_t hash;
+        unsigned int i;
+
+        SHA1_Init(&context);
+        SHA1_Update(&context, data, len);
+        SHA1_Final(hash, &context);
 
-        M_WriteFile(filename, outbuf, outbuf_len);
+        for (i = 0; i < sizeof(sha1_digest_t); ++i)
+        {
+            M_snprintf(song_hash + i * 2, sizeof(song_hash) - i * 2,
+                       "%02x", hash[i]);
+        }
     }
 
-    mem_fclose(instream);
-    mem_fclose(outstream);
+    // [crispy] remove MID file size limit
+    // [AP] MUS comes converted from the cache, and is read from memory
+    // rather than a temporary file.
+    midi = I_SongMidi(data, len, &midi_len);
+    result = midi != NULL ? MIDI_LoadMemory(midi, midi_len) : NULL;
+
+    if (result == NULL)
+    {
+        fprintf(stderr, "I_OPL_RegisterSong: Failed to load MID.\n");
+    }
 
     return result;
 }
 
-static void *I_OPL_RegisterSong(void *data, int len)
+// [AP] Directory holding recordings made with the current settings,
+// or NULL if songs aren't being recorded.
+
+char *I_OPL_MusicCacheDir(void)
 {
-    midi_file_t *result;
-    char *filename;
+    static char dir[256];
 
-    if (!music_initialized)
+    if (!music_initialized || !music_cache_enabled)
     {
         return NULL;
     }
 
-    // MUS files begin with "MUS"
-    // Reject anything which doesnt have this signature
+    M_snprintf(dir, sizeof(dir), "%soplcache%sopl%d%s-%d-%s%s",
+               configdir, DIR_SEPARATOR_S, opl_opl3mode ? 3 : 2,
+               opl_stereo_correct ? "r" : "", opl_drv_ver, genmidi_hash,
+               DIR_SEPARATOR_S);
 
-    filename = M_TempFile("doom.mid");
+    return dir;
+}
 
-    // [crispy] remove MID file size limit
-    if (IsMid(data, len) /* && len < MAXMIDLENGTH */)
+static void WriteLong(byte *p, unsigned int value)
+{
+    p[0] = value & 0xff;
+    p[1] = (value >> 8) & 0xff;
+    p[2] = (value >> 16) & 0xff;
+    p[3] = (value >> 24) & 0xff;
+}
+
+static boolean WriteCacheFile(cache_write_t *job)
+{
+    byte header[44];
+    unsigned int datalen, i;
+    char *tmpname;
+    FILE *fstream;
+    boolean result;
+
+    datalen = job->nsamples * 4;
+
+    memcpy(header, "RIFF", 4);
+    WriteLong(header + 4, datalen + 36);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    WriteLong(header + 16, 16);
+    WriteLong(header + 20, 1 | (2 << 16));      // PCM, stereo
+    WriteLong(header + 24, job->rate);
+    WriteLong(header + 28, job->rate * 4);
+    WriteLong(header + 32, 4 | (16 << 16));     // block align, bits
+    memcpy(header + 36, "data", 4);
+    WriteLong(header + 40, datalen);
+
+    for (i = 0; i < job->nsamples * 2; ++i)
+    {
+        job->samples[i] = SHORT(job->samples[i]);
+    }
+
+    // Write under a temporary name so that a partial file is never
+    // picked up as a recording.
+
+    tmpname = M_StringJoin(job->path, ".tmp", NULL);
+    fstream = M_fopen(tmpname, "wb");
+
+    if (fstream == NULL)
+    {
+        free(tmpname);
+        return false;
+    }
+
+    result = fwrite(header, 1, sizeof(header), fstream) == sizeof(header)
+          && fwrite(job->samples, 1, datalen, fstream) == datalen;
+    result = fclose(fstream) == 0 && result;
+
+    if (result)
     {
-        M_WriteFile(filename, data, len);
+        M_remove(job->path);
+        result = M_rename(tmpname, job->path) == 0;
+    }
+
+    if (!result)
+    {
+        M_remove(tmpname);
+    }
+
+    free(tmpname);
+
+    return result;
+}
+
+static int CacheWriteThread(void *data)
+{
+    cache_write_t *job = data;
+
+    job->ok = WriteCacheFile(job);
+    SDL_AtomicSet(&job->done, 1);
+
+    return 0;
+}
+
+static void FinishCacheWrite(void)
+{
+    SDL_WaitThread(cache_thread, NULL);
+    cache_thread = NULL;
+
+    if (cache_write.ok)
+    {
+        I_MP_AddCachedMusic(cache_write.hash, cache_write.path);
     }
     else
     {
-        // Assume a MUS file and try to convert
+        fprintf(stderr, "I_OPL_PollMusic: Failed to write %s\n",
+                cache_write.path);
+    }
+
+    free(cache_write.samples);
+    free(cache_write.path);
+}
+
+static void I_OPL_PollMusic(void)
+{
+    int16_t *samples;
+    unsigned int nsamples, rate;
+    char *dir, *parent;
+
+    if (cache_thread != NULL)
+    {
+        if (!SDL_AtomicGet(&cache_write.done))
+        {
+            return;
+        }
 
-        ConvertMus(data, len, filename);
+        FinishCacheWrite();
     }
 
-    result = MIDI_LoadFile(filename);
+    samples = OPL_GetCapture(&nsamples, &rate);
+    dir = I_OPL_MusicCacheDir();
 
-    if (result == NULL)
+    if (samples == NULL || dir == NULL)
     {
-        fprintf(stderr, "I_OPL_RegisterSong: Failed to load MID.\n");
+        free(samples);
+        return;
     }
 
-    // remove file now
+    parent = M_StringJoin(configdir, "oplcache", NULL);
+    M_MakeDirectory(parent);
+    M_MakeDirectory(dir);
+    free(parent);
 
-    M_remove(filename);
-    free(filename);
+    cache_write.samples = samples;
+    cache_write.nsamples = nsamples;
+    cache_write.rate = rate;
+    cache_write.path = M_StringJoin(dir, capture_hash, ".wav", NULL);
+    M_StringCopy(cache_write.hash, capture_hash, sizeof(cache_write.hash));
+    SDL_AtomicSet(&cache_write.done, 0);
 
-    return result;
+    // Writing tens of megabytes would cause a visible stall.
+
+    cache_thread = SDL_CreateThread(CacheWriteThread, "OPL music cache",
+                                    &cache_write);
+
+    if (cache_thread == NULL)
+    {
+        free(cache_write.samples);
+        free(cache_write.path);
+    }
 }
 
 // Is the song playing?
@@ -1682,7 +1893,7 @@ static boolean I_OPL_MusicIsPlaying(void)
         return false;
     }
 
-    return num_tracks > 0;
+    return num_song_events > 0;
 }
 
 // Shutdown music
@@ -1695,6 +1906,14 @@ static void I_OPL_ShutdownMusic(void)
 
         I_OPL_StopSong();
 
+        if (cache_thread != NULL)
+        {
+            SDL_WaitThread(cache_thread, NULL);
+            cache_thread = NULL;
+            free(cache_write.samples);
+            free(cache_write.path);
+        }
+
         OPL_Shutdown();
 
         // Release GENMIDI lump
@@ -1744,6 +1963,16 @@ static boolean I_OPL_InitMusic(void)
     // into their correct orientation.
     opl_stereo_correct = strstr(dmxoption, "-reverse") != NULL;
 
+    // [AP] Recording needs the software emulator.
+
+    music_cache_enabled = false;
+
+    if (snd_oplmusiccache && OPL_StartCapture())
+    {
+        OPL_CancelCapture();
+        music_cache_enabled = true;
+    }
+
     // Initialize all registers.
 
     OPL_InitRegisters(opl_opl3mode);
@@ -1757,9 +1986,10 @@ static boolean I_OPL_InitMusic(void)
     }
 
     InitVoices();
+    InitFrequencyTable();
 
-    tracks = NULL;
-    num_tracks = 0;
+    song_events = NULL;
+    num_song_events = 0;
     music_initialized = true;
 
     return true;
@@ -1785,7 +2015,7 @@ const music_module_t music_opl_module =
     I_OPL_PlaySong,
     I_OPL_StopSong,
     I_OPL_MusicIsPlaying,
-    NULL,  // Poll
+    I_OPL_PollMusic,
 };
 
 void I_SetOPLDriverVer(opl_driver_ver_t ver)
@@ -1837,7 +2067,7 @@ void I_OPL_DevMessages(char *result, size_t result_len)
     int lines;
     int i;
 
-    if (num_tracks == 0)
+    if (num_song_events == 0)
     {
         M_snprintf(result, result_len, "No OPL track!");
         return;
@@ -27,8 +27,6 @@
 
 #include "config.h"
 #include "doomtype.h"
-#include "memio.h"
-#include "mus2mid.h"
 
 #include "deh_str.h"
 #include "gusconf.h"
@@ -334,35 +332,11 @@ static void I_SDL_UnRegisterSong(void *handle)
     }
 }
 
-static boolean ConvertMus(byte *musdata, int len, const char *filename)
-{
-    MEMFILE *instream;
-    MEMFILE *outstream;
-    void *outbuf;
-    size_t outbuf_len;
-    int result;
-
-    instream = mem_fopen_read(musdata, len);
-    outstream = mem_fopen_write();
-
-    result = mus2mid(instream, outstream);
-
-    if (result == 0)
-    {
-        mem_get_buf(outstream, &outbuf, &outbuf_len);
-
-        M_WriteFile(filename, outbuf, outbuf_len);
-    }
-
-    mem_fclose(instream);
-    mem_fclose(outstream);
-
-    return result;
-}
-
 static void *I_SDL_RegisterSong(void *data, int len)
 {
     char *filename;
+    byte *midi;
+    size_t midi_len;
     Mix_Music *music;
 
     if (!music_initialized)
@@ -381,15 +355,12 @@ static void *I_SDL_RegisterSong(void *data, int len)
 /*
     if (IsMid(data, len) && len < MAXMIDLENGTH)
 */
-    if (!IsMus(data, len)) // [crispy] MUS_HEADER_MAGIC
-    {
-        M_WriteFile(filename, data, len);
-    }
-    else
-    {
-	// Assume a MUS file and try to convert
+    // [AP] MUS comes converted from the cache
+    midi = I_SongMidi(data, len, &midi_len);
 
-        ConvertMus(data, len, filename);
+    if (midi != NULL)
+    {
+        M_WriteFile(filename, midi, midi_len);
     }
 
     // Load the MIDI. In an ideal world we'd be using Mix_LoadMUS_RW()
@@ -23,6 +23,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+
+// [AP] SSE2 for the in-tree mixer, always there on x86-64
+#ifdef __SSE2__
+#define HAVE_SOFTMIX_SSE2
+#include <emmintrin.h>
+#endif
+
 #include "SDL.h"
 #include "SDL_mixer.h"
 
@@ -34,12 +41,17 @@
 #include "i_sound.h"
 #include "i_system.h"
 #include "i_swap.h"
+#include "i_task.h"
 #include "m_argv.h"
+#include "m_config.h"
+#include "m_memory.h"
 #include "m_misc.h"
+#include "sha1.h"
 #include "w_wad.h"
 #include "z_zone.h"
 
 #include "doomtype.h"
+#include "crispy.h" // [AP] MIN(), BETWEEN()
 
 
 // [crispy] values 3 and higher might reproduce DOOM.EXE more accurately,
@@ -62,6 +74,7 @@ float libsamplerate_scale = 0.65f;
 #define LOW_PASS_FILTER
 //#define DEBUG_DUMP_WAVS
 #define NUM_CHANNELS 16*2 // [crispy] support up to 32 sound channels
+#define SOFT_CHANNELS 256 // [AP] with snd_softmixer
 
 typedef struct allocated_sound_s allocated_sound_t;
 
@@ -78,15 +91,43 @@ static boolean sound_initialized = false;
 
 static allocated_sound_t *channels_playing[NUM_CHANNELS];
 
+// [AP] Left volume << 8 | right volume per channel, for PanEffect and
+// the in-tree mixer.
+
+static SDL_atomic_t channel_pan[SOFT_CHANNELS];
+static boolean use_pan_effect;
+static boolean use_soft_mixer;
+static int num_channels = NUM_CHANNELS;
+
 static int mixer_freq;
 static Uint16 mixer_format;
 static int mixer_channels;
 static boolean use_sfx_prefix;
-static boolean (*ExpandSoundData)(sfxinfo_t *sfxinfo,
-                                  byte *data,
-                                  int samplerate,
-                                  int bits,
-                                  int length) = NULL;
+static allocated_sound_t *(*ExpandSoundData)(sfxinfo_t *sfxinfo,
+                                             byte *data,
+                                             int samplerate,
+                                             int bits,
+                                             int length) = NULL;
+
+// [AP] Sounds can be expanded on a background thread while the game
+// runs. This guards the allocated sounds list and its size; the
+// game's entry points hold it throughout. SDL mutexes are recursive.
+
+static SDL_mutex *sound_lock;
+
+// [AP] Where converted sounds are kept between sessions, NULL when
+// the disk cache is not in use.
+
+static char *sfxcache_dir = NULL;
+
+// [AP] Background precache state. The lumps stay cached while the
+// task runs and are released by the main thread once it has finished.
+
+static task_t *precache_task = NULL;
+static sfxinfo_t *precache_sounds;
+static byte **precache_data;
+static unsigned int *precache_lens;
+static int precache_num;
 
 // Doubly-linked list of allocated sounds.
 // When a sound is played, it is moved to the head, so that the oldest
@@ -96,6 +137,9 @@ static allocated_sound_t *allocated_sounds_head = NULL;
 static allocated_sound_t *allocated_sounds_tail = NULL;
 static int allocated_sounds_size = 0;
 
+// [AP] Cache limit with -lowmem, whatever snd_cachesize says
+#define LOWMEM_SFX_CACHE (8 * 1024 * 1024)
+
 
 // Hook a sound into the linked list at the head.
 
@@ -184,7 +228,14 @@ static boolean FindAndFreeSound(void)
 
 static void ReserveCacheSpace(size_t len)
 {
-    if (snd_cachesize <= 0)
+    int cachesize = snd_cachesize;
+
+    if (M_LowMemory() && (cachesize <= 0 || cachesize > LOWMEM_SFX_CACHE))
+    {
+        cachesize = LOWMEM_SFX_CACHE;
+    }
+
+    if (cachesize <= 0)
     {
         return;
     }
@@ -192,7 +243,7 @@ static void ReserveCacheSpace(size_t len)
     // Keep freeing sound effects that aren't currently being played,
     // until there is enough space for the new sound.
 
-    while (allocated_sounds_size + len > snd_cachesize)
+    while (allocated_sounds_size + len > cachesize)
     {
         // Free a sound.  If there is nothing more to free, stop.
 
@@ -203,12 +254,28 @@ static void ReserveCacheSpace(size_t len)
     }
 }
 
+// [AP] For the memory report and -lowmem
+
+static size_t SoundCacheBytes(void)
+{
+    return allocated_sounds_size;
+}
+
+static void PurgeSoundCache(void)
+{
+    SDL_LockMutex(sound_lock);
+    while (FindAndFreeSound());
+    SDL_UnlockMutex(sound_lock);
+}
+
 // Allocate a block for a new sound effect.
 
 static allocated_sound_t *AllocateSound(sfxinfo_t *sfxinfo, size_t len)
 {
     allocated_sound_t *snd;
 
+    SDL_LockMutex(sound_lock);
+
     // Keep allocated sounds within the cache size.
 
     ReserveCacheSpace(len);
@@ -225,6 +292,7 @@ static allocated_sound_t *AllocateSound(sfxinfo_t *sfxinfo, size_t len)
 
         if (snd == NULL && !FindAndFreeSound())
         {
+            SDL_UnlockMutex(sound_lock);
             return NULL;
         }
 
@@ -245,11 +313,26 @@ static allocated_sound_t *AllocateSound(sfxinfo_t *sfxinfo, size_t len)
 
     allocated_sounds_size += len;
 
-    AllocatedSoundLink(snd);
+    SDL_UnlockMutex(sound_lock);
+
+    // [AP] The caller links the sound into the list once the data has
+    // been filled in, so that it is never found half written.
 
     return snd;
 }
 
+// [AP] Free a sound that AllocateSound returned but that never made
+// it into the list.
+
+static void FreeUnlinkedSound(allocated_sound_t *snd)
+{
+    SDL_LockMutex(sound_lock);
+    allocated_sounds_size -= snd->chunk.alen;
+    SDL_UnlockMutex(sound_lock);
+
+    free(snd);
+}
+
 // Lock a sound, to indicate that it may not be freed.
 
 static void LockAllocatedSound(allocated_sound_t *snd)
@@ -340,16 +423,242 @@ static allocated_sound_t * PitchShift(allocated_sound_t *insnd, int pitch)
         *outp = *inp;
     }
 
+    AllocatedSoundLink(outsnd);
+
     return outsnd;
 }
 
+// [AP] Done with a sound that was playing
+
+static void ReleaseSound(allocated_sound_t *snd)
+{
+    UnlockAllocatedSound(snd);
+
+    // if the sound is a pitch-shift and it's not in use, immediately
+    // free it
+    if (snd->pitch != NORM_PITCH && snd->use_count <= 0)
+    {
+        FreeAllocatedSound(snd);
+    }
+}
+
+// [AP] In-tree mixer, with snd_softmixer. Sound effects are mixed in a
+// SDL_mixer post-mix hook instead of on SDL_mixer's channels: accumulated
+// as floats over the music, then clipped once. Each voice costs one pass
+// over its samples, and a voice with both volumes at zero isn't mixed at
+// all, only kept in step, so CPU use grows with the audible voices alone.
+//
+// The game and the hook share the voices without a lock. A voice belongs
+// to the game while it's free or done and to the hook while it's playing;
+// stopping only asks the hook to let go, and the game takes the voice and
+// its sound back in I_SDL_UpdateSound. There are twice as many voices as
+// channels, so a channel can start a sound while its last one winds down.
+
+#define SOFT_VOICES (SOFT_CHANNELS * 2)
+#define SOFT_MIX_FRAMES 512
+
+enum
+{
+    VOICE_FREE,
+    VOICE_PLAYING,
+    VOICE_STOPPING,
+    VOICE_DONE,
+};
+
+typedef struct
+{
+    SDL_atomic_t state;
+    int channel;                        // for channel_pan
+    const Sint16 *samples;              // stereo frames
+    unsigned int length;                // in frames
+    unsigned int pos;                   // the hook's
+    allocated_sound_t *snd;             // the game's
+} voice_t;
+
+static voice_t voices[SOFT_VOICES];
+static int channel_voices[SOFT_CHANNELS];
+
+static void SoftMixVoice(float *mix, const Sint16 *samples, int count,
+                         float left, float right)
+{
+    int i = 0;
+
+#ifdef HAVE_SOFTMIX_SSE2
+    const __m128 gain = _mm_setr_ps(left, right, left, right);
+
+    for (; i + 8 <= count * 2; i += 8)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i *) (samples + i));
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16));
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16));
+
+        _mm_storeu_ps(mix + i, _mm_add_ps(_mm_loadu_ps(mix + i),
+                                          _mm_mul_ps(lo, gain)));
+        _mm_storeu_ps(mix + i + 4, _mm_add_ps(_mm_loadu_ps(mix + i + 4),
+                                              _mm_mul_ps(hi, gain)));
+    }
+#endif
+
+    for (; i < count * 2; i += 2)
+    {
+        mix[i] += samples[i] * left;
+        mix[i + 1] += samples[i + 1] * right;
+    }
+}
+
+static void SoftClip(Sint16 *out, const float *mix, int count)
+{
+    int i = 0;
+
+#ifdef HAVE_SOFTMIX_SSE2
+    // Packing saturates
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i lo = _mm_cvtps_epi32(_mm_loadu_ps(mix + i));
+        __m128i hi = _mm_cvtps_epi32(_mm_loadu_ps(mix + i + 4));
+
+        _mm_storeu_si128((__m128i *) (out + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = (Sint16) BETWEEN(-32768.0f, 32767.0f, mix[i]);
+    }
+}
+
+static void SDLCALL SoftMixEffect(void *udata, Uint8 *stream, int len)
+{
+    static float mix[SOFT_MIX_FRAMES * 2];
+    Sint16 *out = (Sint16 *) stream;
+    int frames = len / 4;
+    int count, n, i, pan;
+    voice_t *voice;
+
+    for (; frames > 0; frames -= count, out += count * 2)
+    {
+        count = MIN(frames, SOFT_MIX_FRAMES);
+
+        for (i = 0; i < count * 2; ++i)
+        {
+            mix[i] = out[i];
+        }
+
+        for (voice = voices; voice < voices + SOFT_VOICES; ++voice)
+        {
+            switch (SDL_AtomicGet(&voice->state))
+            {
+                case VOICE_PLAYING:
+                    break;
+
+                case VOICE_STOPPING:
+                    SDL_AtomicSet(&voice->state, VOICE_DONE);
+                    // fall through
+
+                default:
+                    continue;
+            }
+
+            n = MIN(count, voice->length - voice->pos);
+            pan = SDL_AtomicGet(&channel_pan[voice->channel]);
+
+            if (pan != 0)
+            {
+                SoftMixVoice(mix, voice->samples + voice->pos * 2, n,
+                             (pan >> 8) / 255.0f, (pan & 0xff) / 255.0f);
+            }
+
+            voice->pos += n;
+
+            if (voice->pos >= voice->length)
+            {
+                SDL_AtomicSet(&voice->state, VOICE_DONE);
+            }
+        }
+
+        SoftClip(out, mix, count * 2);
+    }
+}
+
+// Takes back the voices the hook is done with.
+
+static void SoftReclaimVoices(void)
+{
+    voice_t *voice;
+
+    for (voice = voices; voice < voices + SOFT_VOICES; ++voice)
+    {
+        if (SDL_AtomicGet(&voice->state) == VOICE_DONE)
+        {
+            ReleaseSound(voice->snd);
+            voice->snd = NULL;
+            SDL_AtomicSet(&voice->state, VOICE_FREE);
+        }
+    }
+}
+
+static void SoftStopChannel(int channel)
+{
+    int v = channel_voices[channel];
+
+    if (v >= 0)
+    {
+        SDL_AtomicCAS(&voices[v].state, VOICE_PLAYING, VOICE_STOPPING);
+        channel_voices[channel] = -1;
+    }
+}
+
+static boolean SoftPlay(int channel, allocated_sound_t *snd)
+{
+    voice_t *voice;
+    int pass;
+
+    for (pass = 0; pass < 2; ++pass)
+    {
+        for (voice = voices; voice < voices + SOFT_VOICES; ++voice)
+        {
+            if (SDL_AtomicGet(&voice->state) == VOICE_FREE)
+            {
+                voice->channel = channel;
+                voice->samples = (const Sint16 *) snd->chunk.abuf;
+                voice->length = snd->chunk.alen / 4;
+                voice->pos = 0;
+                voice->snd = snd;
+                SDL_AtomicSet(&voice->state, VOICE_PLAYING);
+
+                channel_voices[channel] = voice - voices;
+                return true;
+            }
+        }
+
+        SoftReclaimVoices();
+    }
+
+    return false;
+}
+
+static boolean SoftIsPlaying(int channel)
+{
+    int v = channel_voices[channel];
+
+    return v >= 0 && SDL_AtomicGet(&voices[v].state) == VOICE_PLAYING;
+}
+
 // When a sound stops, check if it is still playing.  If it is not,
 // we can mark the sound data as CACHE to be freed back for other
 // means.
 
 static void ReleaseSoundOnChannel(int channel)
 {
-    allocated_sound_t *snd = channels_playing[channel];
+    allocated_sound_t *snd;
+
+    if (use_soft_mixer)
+    {
+        SoftStopChannel(channel); // [AP]
+        return;
+    }
+
+    snd = channels_playing[channel];
 
     Mix_HaltChannel(channel);
 
@@ -360,14 +669,7 @@ static void ReleaseSoundOnChannel(int channel)
 
     channels_playing[channel] = NULL;
 
-    UnlockAllocatedSound(snd);
-
-    // if the sound is a pitch-shift and it's not in use, immediately
-    // free it
-    if (snd->pitch != NORM_PITCH && snd->use_count <= 0)
-    {
-        FreeAllocatedSound(snd);
-    }
+    ReleaseSound(snd);
 }
 
 #ifdef HAVE_LIBSAMPLERATE
@@ -406,11 +708,11 @@ static int SRC_ConversionMode(void)
 // Returns number of clipped samples.
 // DWF 2008-02-10 with cleanups by Simon Howard.
 
-static boolean ExpandSoundData_SRC(sfxinfo_t *sfxinfo,
-                                   byte *data,
-                                   int samplerate,
-                                   int bits,
-                                   int length)
+static allocated_sound_t *ExpandSoundData_SRC(sfxinfo_t *sfxinfo,
+                                              byte *data,
+                                              int samplerate,
+                                              int bits,
+                                              int length)
 {
     SRC_DATA src_data;
     float *data_in;
@@ -467,7 +769,9 @@ static boolean ExpandSoundData_SRC(sfxinfo_t *sfxinfo,
 
     if (snd == NULL)
     {
-        return false;
+        free(data_in);
+        free(src_data.data_out);
+        return NULL;
     }
 
     chunk = &snd->chunk;
@@ -530,7 +834,7 @@ static boolean ExpandSoundData_SRC(sfxinfo_t *sfxinfo,
                         400.0 * clipped / chunk->alen);
     }
 
-    return true;
+    return snd;
 }
 
 #endif
@@ -617,11 +921,11 @@ static void WriteWAV(char *filename, byte *data,
 // Generic sound expansion function for any sample rate.
 // Returns number of clipped samples (always 0).
 
-static boolean ExpandSoundData_SDL(sfxinfo_t *sfxinfo,
-                                   byte *data,
-                                   int samplerate,
-                                   int bits,
-                                   int length)
+static allocated_sound_t *ExpandSoundData_SDL(sfxinfo_t *sfxinfo,
+                                              byte *data,
+                                              int samplerate,
+                                              int bits,
+                                              int length)
 {
     SDL_AudioCVT convertor;
     allocated_sound_t *snd;
@@ -643,7 +947,7 @@ static boolean ExpandSoundData_SDL(sfxinfo_t *sfxinfo,
 
     if (snd == NULL)
     {
-        return false;
+        return NULL;
     }
 
     chunk = &snd->chunk;
@@ -738,26 +1042,141 @@ static boolean ExpandSoundData_SDL(sfxinfo_t *sfxinfo,
 #endif /* #ifdef LOW_PASS_FILTER */
     }
 
-    return true;
+    return snd;
 }
 
-// Load and convert a sound effect
+// [AP] Disk cache of converted sounds. Entries are named by a hash of
+// the lump and of everything that affects the conversion, so a change
+// of output rate or resampler quality simply misses.
+
+static void GetSFXCacheKey(byte *data, unsigned int lumplen, char *key)
+{
+    sha1_context_t context;
+    sha1_digest_t digest;
+    uint32_t scale;
+    int i;
+
+    memcpy(&scale, &libsamplerate_scale, sizeof(scale));
+
+    SHA1_Init(&context);
+    SHA1_Update(&context, data, lumplen);
+    SHA1_UpdateInt32(&context, mixer_freq);
+    SHA1_UpdateInt32(&context, mixer_format);
+    SHA1_UpdateInt32(&context, mixer_channels);
+    SHA1_UpdateInt32(&context, use_libsamplerate);
+    SHA1_UpdateInt32(&context, scale);
+    SHA1_Final(digest, &context);
+
+    for (i = 0; i < sizeof(sha1_digest_t); ++i)
+    {
+        M_snprintf(key + i * 2, 3, "%02x", digest[i]);
+    }
+}
+
+// Each file is "SFXC", the data length (little endian) and the data.
+
+static allocated_sound_t *LoadCachedSFX(sfxinfo_t *sfxinfo, const char *key)
+{
+    allocated_sound_t *snd;
+    byte header[8];
+    char *filename;
+    FILE *fstream;
+    long filelen;
+    uint32_t len;
+
+    filename = M_StringJoin(sfxcache_dir, key, ".pcm", NULL);
+    fstream = M_fopen(filename, "rb");
+    free(filename);
+
+    if (fstream == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(fstream, 0, SEEK_END);
+    filelen = ftell(fstream);
+    fseek(fstream, 0, SEEK_SET);
+
+    if (fread(header, 1, sizeof(header), fstream) != sizeof(header)
+     || memcmp(header, "SFXC", 4) != 0)
+    {
+        fclose(fstream);
+        return NULL;
+    }
+
+    len = header[4] | (header[5] << 8) | (header[6] << 16)
+        | ((uint32_t) header[7] << 24);
+
+    // Truncated by a crash, or still being written by the other thread
+
+    if (len == 0 || len != filelen - sizeof(header))
+    {
+        fclose(fstream);
+        return NULL;
+    }
+
+    snd = AllocateSound(sfxinfo, len);
+
+    if (snd != NULL && fread(snd->chunk.abuf, 1, len, fstream) != len)
+    {
+        FreeUnlinkedSound(snd);
+        snd = NULL;
+    }
+
+    fclose(fstream);
+
+    return snd;
+}
+
+static void SaveCachedSFX(const char *key, allocated_sound_t *snd)
+{
+    byte header[8];
+    char *filename;
+    FILE *fstream;
+    uint32_t len = snd->chunk.alen;
+
+    filename = M_StringJoin(sfxcache_dir, key, ".pcm", NULL);
+    fstream = M_fopen(filename, "wb");
+    free(filename);
+
+    if (fstream == NULL)
+    {
+        return;
+    }
+
+    memcpy(header, "SFXC", 4);
+    header[4] = len & 0xff;
+    header[5] = (len >> 8) & 0xff;
+    header[6] = (len >> 16) & 0xff;
+    header[7] = (len >> 24) & 0xff;
+
+    fwrite(header, 1, sizeof(header), fstream);
+    fwrite(snd->chunk.abuf, 1, len, fstream);
+    fclose(fstream);
+}
+
+// Convert a sound effect from its lump data and add it to the list.
+// Safe to call from the precache thread, as it does not touch the zone.
 // Returns true if successful
 
-static boolean CacheSFX(sfxinfo_t *sfxinfo)
+static boolean ExpandSFX(sfxinfo_t *sfxinfo, byte *data, unsigned int lumplen)
 {
-    int lumpnum;
-    unsigned int lumplen;
+    allocated_sound_t *snd = NULL;
+    char key[sizeof(sha1_digest_t) * 2 + 1];
     int samplerate;
     unsigned int bits;
     unsigned int length;
-    byte *data;
 
-    // need to load the sound
+    if (sfxcache_dir != NULL)
+    {
+        GetSFXCacheKey(data, lumplen, key);
+        snd = LoadCachedSFX(sfxinfo, key);
+    }
 
-    lumpnum = sfxinfo->lumpnum;
-    data = W_CacheLumpNum(lumpnum, PU_STATIC);
-    lumplen = W_LumpLength(lumpnum);
+    if (snd != NULL)
+    {
+        goto link;
+    }
 
     // [crispy] Check if this is a valid RIFF wav file
     if (lumplen > 44 && memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "WAVEfmt ", 8) == 0)
@@ -836,11 +1255,34 @@ static boolean CacheSFX(sfxinfo_t *sfxinfo)
 
     // Sample rate conversion
 
-    if (!ExpandSoundData(sfxinfo, data + 8, samplerate, bits, length))
+    snd = ExpandSoundData(sfxinfo, data + 8, samplerate, bits, length);
+
+    if (snd == NULL)
     {
         return false;
     }
 
+    if (sfxcache_dir != NULL)
+    {
+        SaveCachedSFX(key, snd);
+    }
+
+link:
+    SDL_LockMutex(sound_lock);
+
+    // The other thread may have got here first.
+
+    if (GetAllocatedSoundBySfxInfoAndPitch(sfxinfo, NORM_PITCH) != NULL)
+    {
+        FreeUnlinkedSound(snd);
+    }
+    else
+    {
+        AllocatedSoundLink(snd);
+    }
+
+    SDL_UnlockMutex(sound_lock);
+
 #ifdef DEBUG_DUMP_WAVS
     {
         char filename[16];
@@ -853,13 +1295,34 @@ static boolean CacheSFX(sfxinfo_t *sfxinfo)
     }
 #endif
 
-    // don't need the original lump any more
-  
-    W_ReleaseLumpNum(lumpnum);
-
     return true;
 }
 
+// Load and convert a sound effect
+// Returns true if successful
+
+static boolean CacheSFX(sfxinfo_t *sfxinfo)
+{
+    int lumpnum;
+    boolean result;
+
+    // need to load the sound
+
+    lumpnum = sfxinfo->lumpnum;
+    result = ExpandSFX(sfxinfo, W_CacheLumpNum(lumpnum, PU_STATIC),
+                       W_LumpLength(lumpnum));
+
+    // don't need the original lump any more, unless the precache
+    // task may still be reading it
+
+    if (precache_task == NULL)
+    {
+        W_ReleaseLumpNum(lumpnum);
+    }
+
+    return result;
+}
+
 static void GetSfxLumpName(sfxinfo_t *sfx, char *buf, size_t buf_len)
 {
     // Linked sfx lumps? Get the lump number for the sound linked to.
@@ -882,6 +1345,63 @@ static void GetSfxLumpName(sfxinfo_t *sfx, char *buf, size_t buf_len)
     }
 }
 
+// [AP] Background precache, run on the task pool. Only the conversion
+// happens here; the lumps were cached by the main thread beforehand.
+
+static void PrecacheTask(void *unused)
+{
+    allocated_sound_t *snd;
+    int i;
+
+    for (i = 0; i < precache_num; ++i)
+    {
+        if (precache_data[i] == NULL)
+        {
+            continue;
+        }
+
+        SDL_LockMutex(sound_lock);
+        snd = GetAllocatedSoundBySfxInfoAndPitch(&precache_sounds[i], NORM_PITCH);
+        SDL_UnlockMutex(sound_lock);
+
+        // Already played, and cached, by the game
+
+        if (snd == NULL)
+        {
+            ExpandSFX(&precache_sounds[i], precache_data[i], precache_lens[i]);
+        }
+    }
+}
+
+// [AP] Once the precache task is done (or, with wait, after waiting
+// for it), release the lumps it was working from.
+
+static void FinishPrecache(boolean wait)
+{
+    int i;
+
+    if (precache_task == NULL
+     || (!wait && !I_TaskFinished(precache_task)))
+    {
+        return;
+    }
+
+    I_WaitTask(precache_task);
+    precache_task = NULL;
+
+    for (i = 0; i < precache_num; ++i)
+    {
+        if (precache_data[i] != NULL)
+        {
+            W_ReleaseLumpNum(precache_sounds[i].lumpnum);
+        }
+    }
+
+    free(precache_data);
+    free(precache_lens);
+    precache_data = NULL;
+}
+
 // Preload all the sound effects - stops nasty ingame freezes
 
 static void I_SDL_PrecacheSounds(sfxinfo_t *sounds, int num_sounds)
@@ -889,6 +1409,40 @@ static void I_SDL_PrecacheSounds(sfxinfo_t *sounds, int num_sounds)
     char namebuf[9];
     int i;
 
+    // Without workers the task would run right here anyway
+
+    if (snd_precachethread && precache_task == NULL && I_TaskWorkers() > 0)
+    {
+        precache_sounds = sounds;
+        precache_num = num_sounds;
+        precache_data = malloc(num_sounds * sizeof(*precache_data));
+        precache_lens = malloc(num_sounds * sizeof(*precache_lens));
+
+        for (i=0; i<num_sounds; ++i)
+        {
+            GetSfxLumpName(&sounds[i], namebuf, sizeof(namebuf));
+
+            sounds[i].lumpnum = W_CheckNumForName(namebuf);
+
+            if (sounds[i].lumpnum != -1)
+            {
+                precache_data[i] = W_CacheLumpNum(sounds[i].lumpnum, PU_STATIC);
+                precache_lens[i] = W_LumpLength(sounds[i].lumpnum);
+            }
+            else
+            {
+                precache_data[i] = NULL;
+            }
+        }
+
+        precache_task = I_CreateTask("sfx precache", PrecacheTask, NULL, NULL);
+        I_SubmitTask(precache_task);
+
+        printf("I_SDL_PrecacheSounds: Precaching all sound effects "
+               "in the background\n");
+        return;
+    }
+
     printf("I_SDL_PrecacheSounds: Precaching all sound effects..");
 
     for (i=0; i<num_sounds; ++i)
@@ -945,11 +1499,31 @@ static int I_SDL_GetSfxLumpNum(sfxinfo_t *sfx)
     return W_CheckNumForName(namebuf);
 }
 
+// [AP] Panning effect. Rather than Mix_SetPanning, which takes the
+// audio lock for every update, each playing channel has this effect
+// registered and reads the volumes last stored by the game thread.
+// The arithmetic is that of SDL_mixer's own effect for S16 stereo.
+
+static void SDLCALL PanEffect(int chan, void *stream, int len, void *udata)
+{
+    const int pan = SDL_AtomicGet(&channel_pan[chan]);
+    const float left_f = (pan >> 8) / 255.0f;
+    const float right_f = (pan & 0xff) / 255.0f;
+    Sint16 *samples = stream;
+    int i;
+
+    for (i = 0; i + 1 < len / 2; i += 2)
+    {
+        samples[i] = (Sint16) (samples[i] * left_f);
+        samples[i + 1] = (Sint16) (samples[i + 1] * right_f);
+    }
+}
+
 static void I_SDL_UpdateSoundParams(int handle, int vol, int sep)
 {
     int left, right;
 
-    if (!sound_initialized || handle < 0 || handle >= NUM_CHANNELS)
+    if (!sound_initialized || handle < 0 || handle >= num_channels)
     {
         return;
     }
@@ -962,31 +1536,24 @@ static void I_SDL_UpdateSoundParams(int handle, int vol, int sep)
     if (right < 0) right = 0;
     else if (right > 255) right = 255;
 
-    Mix_SetPanning(handle, left, right);
+    if (use_pan_effect || use_soft_mixer)
+    {
+        // Picked up by PanEffect or SoftMixEffect on the next mix
+        SDL_AtomicSet(&channel_pan[handle], (left << 8) | right);
+    }
+    else
+    {
+        Mix_SetPanning(handle, left, right);
+    }
 }
 
-//
-// Starting a sound means adding it
-//  to the current list of active sounds
-//  in the internal channels.
-// As the SFX info struct contains
-//  e.g. a pointer to the raw data,
-//  it is ignored.
-// As our sound handling does not handle
-//  priority, it is ignored.
-// Pitching (that is, increased speed of playback)
-//  is set, but currently not used by mixing.
-//
+// [AP] The list-handling part of I_SDL_StartSound, run with
+// sound_lock held.
 
-static int I_SDL_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, int pitch)
+static allocated_sound_t *StartSoundLocked(sfxinfo_t *sfxinfo, int channel, int pitch)
 {
     allocated_sound_t *snd;
 
-    if (!sound_initialized || channel < 0 || channel >= NUM_CHANNELS)
-    {
-        return -1;
-    }
-
     // Release a sound effect if there is already one playing
     // on this channel
 
@@ -996,7 +1563,7 @@ static int I_SDL_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, i
 
     if (!LockSound(sfxinfo))
     {
-        return -1;
+        return NULL;
     }
 
     snd = GetAllocatedSoundBySfxInfoAndPitch(sfxinfo, pitch);
@@ -1009,7 +1576,7 @@ static int I_SDL_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, i
 
         if (snd == NULL)
         {
-            return -1;
+            return NULL;
         }
 
         if (snd_pitchshift)
@@ -1029,22 +1596,93 @@ static int I_SDL_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, i
         LockAllocatedSound(snd);
     }
 
+    // [AP] Handed to the in-tree mixer instead
+
+    if (use_soft_mixer)
+    {
+        if (!SoftPlay(channel, snd))
+        {
+            ReleaseSound(snd);
+            return NULL;
+        }
+
+        return snd;
+    }
+
+    // [AP] The channel has just been halted, which drops its effects.
+    // Registering before playing means the first mix is already panned.
+
+    if (use_pan_effect)
+    {
+        Mix_RegisterEffect(channel, PanEffect, NULL, NULL);
+    }
+
     // play sound
 
-    Mix_PlayChannel(channel, &snd->chunk, 0);
+    if (Mix_PlayChannel(channel, &snd->chunk, 0) < 0 && use_pan_effect)
+    {
+        // Not playing, so nothing would remove it
+        Mix_UnregisterEffect(channel, PanEffect);
+    }
 
     channels_playing[channel] = snd;
 
+    return snd;
+}
+
+//
+// Starting a sound means adding it
+//  to the current list of active sounds
+//  in the internal channels.
+// As the SFX info struct contains
+//  e.g. a pointer to the raw data,
+//  it is ignored.
+// As our sound handling does not handle
+//  priority, it is ignored.
+// Pitching (that is, increased speed of playback)
+//  is set, but currently not used by mixing.
+//
+
+static int I_SDL_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, int pitch)
+{
+    allocated_sound_t *snd;
+
+    if (!sound_initialized || channel < 0 || channel >= num_channels)
+    {
+        return -1;
+    }
+
+    // [AP] With the pan effect, set separation etc. before the sound
+    // starts rather than after its first mix.
+
+    if (use_pan_effect || use_soft_mixer)
+    {
+        I_SDL_UpdateSoundParams(channel, vol, sep);
+    }
+
+    SDL_LockMutex(sound_lock);
+    snd = StartSoundLocked(sfxinfo, channel, pitch);
+    SDL_UnlockMutex(sound_lock);
+
+    if (snd == NULL)
+    {
+        return -1;
+    }
+
     // set separation, etc.
 
-    I_SDL_UpdateSoundParams(channel, vol, sep);
+    if (!use_pan_effect && !use_soft_mixer)
+    {
+        I_SDL_UpdateSoundParams(channel, vol, sep);
+    }
 
     return channel;
 }
 
+
 static void I_SDL_StopSound(int handle)
 {
-    if (!sound_initialized || handle < 0 || handle >= NUM_CHANNELS)
+    if (!sound_initialized || handle < 0 || handle >= num_channels)
     {
         return;
     }
@@ -1052,17 +1690,24 @@ static void I_SDL_StopSound(int handle)
     // Sound data is no longer needed; release the
     // sound data being used for this channel
 
+    SDL_LockMutex(sound_lock);
     ReleaseSoundOnChannel(handle);
+    SDL_UnlockMutex(sound_lock);
 }
 
 
 static boolean I_SDL_SoundIsPlaying(int handle)
 {
-    if (!sound_initialized || handle < 0 || handle >= NUM_CHANNELS)
+    if (!sound_initialized || handle < 0 || handle >= num_channels)
     {
         return false;
     }
 
+    if (use_soft_mixer)
+    {
+        return SoftIsPlaying(handle); // [AP]
+    }
+
     return Mix_Playing(handle);
 }
 
@@ -1074,6 +1719,19 @@ static void I_SDL_UpdateSound(void)
 {
     int i;
 
+    FinishPrecache(false);
+
+    SDL_LockMutex(sound_lock);
+
+    // [AP] The in-tree mixer's finished sounds are in its voices
+
+    if (use_soft_mixer)
+    {
+        SoftReclaimVoices();
+        SDL_UnlockMutex(sound_lock);
+        return;
+    }
+
     // Check all channels to see if a sound has finished
 
     for (i=0; i<NUM_CHANNELS; ++i)
@@ -1086,6 +1744,8 @@ static void I_SDL_UpdateSound(void)
             ReleaseSoundOnChannel(i);
         }
     }
+
+    SDL_UnlockMutex(sound_lock);
 }
 
 static void I_SDL_ShutdownSound(void)
@@ -1095,6 +1755,8 @@ static void I_SDL_ShutdownSound(void)
         return;
     }
 
+    FinishPrecache(true);
+
     Mix_CloseAudio();
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
@@ -1134,6 +1796,12 @@ static boolean I_SDL_InitSound(boolean _use_sfx_prefix)
 
     use_sfx_prefix = _use_sfx_prefix;
 
+    if (sound_lock == NULL)
+    {
+        sound_lock = SDL_CreateMutex();
+        M_AddMemoryUser("sound effects", SoundCacheBytes, PurgeSoundCache);
+    }
+
     // No sounds yet
     for (i=0; i<NUM_CHANNELS; ++i)
     {
@@ -1156,6 +1824,12 @@ static boolean I_SDL_InitSound(boolean _use_sfx_prefix)
 
     Mix_QuerySpec(&mixer_freq, &mixer_format, &mixer_channels);
 
+    // [AP] PanEffect only handles the format we ask for, and so does the
+    // in-tree mixer.
+
+    use_pan_effect = mixer_format == AUDIO_S16SYS && mixer_channels == 2;
+    use_soft_mixer = use_pan_effect && snd_softmixer;
+
 #ifdef HAVE_LIBSAMPLERATE
     if (use_libsamplerate != 0)
     {
@@ -1166,6 +1840,15 @@ static boolean I_SDL_InitSound(boolean _use_sfx_prefix)
         }
 
         ExpandSoundData = ExpandSoundData_SRC;
+
+        // [AP] Only libsamplerate is slow enough to be worth caching.
+
+        if (snd_sfxdiskcache)
+        {
+            sfxcache_dir = M_StringJoin(configdir, "sfxcache",
+                                        DIR_SEPARATOR_S, NULL);
+            M_MakeDirectory(sfxcache_dir);
+        }
     }
 #else
     if (use_libsamplerate != 0)
@@ -1178,6 +1861,22 @@ static boolean I_SDL_InitSound(boolean _use_sfx_prefix)
 
     Mix_AllocateChannels(NUM_CHANNELS);
 
+    if (use_soft_mixer)
+    {
+        for (i = 0; i < SOFT_VOICES; ++i)
+        {
+            SDL_AtomicSet(&voices[i].state, VOICE_FREE);
+            voices[i].snd = NULL;
+        }
+        for (i = 0; i < SOFT_CHANNELS; ++i)
+        {
+            channel_voices[i] = -1;
+        }
+        num_channels = SOFT_CHANNELS;
+        use_pan_effect = false;
+        Mix_SetPostMix(SoftMixEffect, NULL);
+    }
+
     SDL_PauseAudio(0);
 
     sound_initialized = true;
@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "SDL_mixer.h"
 
@@ -28,6 +29,11 @@
 #include "i_video.h"
 #include "m_argv.h"
 #include "m_config.h"
+#include "m_memory.h" // [AP] M_LowMemory()
+#include "m_misc.h"
+#include "memio.h"
+#include "mus2mid.h"
+#include "sha1.h"
 
 // Sound sample rate to use for digital output (Hz)
 
@@ -52,6 +58,27 @@ char *snd_musiccmd = "";
 
 int snd_pitchshift = -1;
 
+// [AP] Keep libsamplerate conversions on disk between sessions.
+
+int snd_sfxdiskcache = 1;
+
+// [AP] Convert sound effects on a background thread at startup.
+
+int snd_precachethread = 1;
+
+// [AP] Record OPL music and replay it through the music pack module.
+
+int snd_oplmusiccache = 0;
+
+// [AP] Mix sound effects with the in-tree mixer rather than SDL_mixer's
+// channels.
+
+int snd_softmixer = 0;
+
+// [AP] Keep MUS lumps converted to MIDI on disk between sessions.
+
+int snd_mididiskcache = 0;
+
 int snd_musicdevice = SNDDEVICE_SB;
 int snd_sfxdevice = SNDDEVICE_SB;
 
@@ -215,6 +242,9 @@ void I_InitSound(boolean use_sfx_prefix)
 
     nosound = M_CheckParm("-nosound") > 0;
 
+    // [AP] -simulate runs headless
+    nosound |= M_ParmExists("-simulate");
+
     //!
     // @vanilla
     //
@@ -331,6 +361,14 @@ void I_UpdateSound(void)
     {
         active_music_module->Poll();
     }
+
+    // [AP] The OPL module keeps writing its music cache while one of
+    // its recordings is being played by the music pack module.
+    if (music_module == &music_opl_module
+     && active_music_module != music_module)
+    {
+        music_module->Poll();
+    }
 }
 
 static void CheckVolumeSeparation(int *vol, int *sep)
@@ -398,6 +436,13 @@ boolean I_SoundIsPlaying(int channel)
 
 void I_PrecacheSounds(sfxinfo_t *sounds, int num_sounds)
 {
+    // [AP] Every sound expanded at once is more than -lowmem can spare;
+    // they're loaded as they're first played instead.
+    if (M_LowMemory())
+    {
+        return;
+    }
+
     if (sound_module != NULL && sound_module->CacheSounds != NULL)
     {
         sound_module->CacheSounds(sounds, num_sounds);
@@ -456,6 +501,223 @@ boolean IsMus(byte *mem, int len)
     return len > 4 && !memcmp(mem, "MUS\x1a", 4);
 }
 
+// [AP] MUS lumps converted to MIDI, by the hash of the lump. A game only
+// has a few dozen songs and levels share them, so every backend gets its
+// MIDI from here instead of running mus2mid each time a song starts.
+
+#define MIDI_CACHE_SIZE 16
+#define MIDI_CACHE_SIZE_LOWMEM 2
+
+typedef struct
+{
+    sha1_digest_t hash;
+    byte *data;
+    size_t len;
+    unsigned int last_used;
+} cached_midi_t;
+
+static cached_midi_t midi_cache[MIDI_CACHE_SIZE];
+static unsigned int midi_cache_clock = 0;
+static boolean midi_cache_initted = false;
+static char *midicache_dir = NULL;
+
+static size_t MidiCacheBytes(void)
+{
+    size_t total = 0;
+    int i;
+
+    for (i = 0; i < MIDI_CACHE_SIZE; ++i)
+    {
+        total += midi_cache[i].len;
+    }
+
+    return total;
+}
+
+static void PurgeMidiCache(void)
+{
+    int i;
+
+    for (i = 0; i < MIDI_CACHE_SIZE; ++i)
+    {
+        free(midi_cache[i].data);
+        midi_cache[i].data = NULL;
+        midi_cache[i].len = 0;
+    }
+}
+
+static void InitMidiCache(void)
+{
+    midi_cache_initted = true;
+
+    M_AddMemoryUser("converted MIDI", MidiCacheBytes, PurgeMidiCache);
+
+    if (snd_mididiskcache)
+    {
+        midicache_dir = M_StringJoin(configdir, "midicache",
+                                     DIR_SEPARATOR_S, NULL);
+        M_MakeDirectory(midicache_dir);
+    }
+}
+
+static char *MidiCacheFilename(const sha1_digest_t hash)
+{
+    char key[sizeof(sha1_digest_t) * 2 + 1];
+    unsigned int i;
+
+    for (i = 0; i < sizeof(sha1_digest_t); ++i)
+    {
+        M_snprintf(key + i * 2, sizeof(key) - i * 2, "%02x", hash[i]);
+    }
+
+    return M_StringJoin(midicache_dir, key, ".mid", NULL);
+}
+
+// Anything that doesn't start like a MIDI file was cut short by a crash
+// and is converted again.
+
+static boolean LoadDiskMidi(cached_midi_t *entry)
+{
+    char *filename;
+    FILE *fstream;
+    long filelen;
+
+    filename = MidiCacheFilename(entry->hash);
+    fstream = M_fopen(filename, "rb");
+    free(filename);
+
+    if (fstream == NULL)
+    {
+        return false;
+    }
+
+    filelen = M_FileLength(fstream);
+
+    if (filelen > 4)
+    {
+        entry->data = malloc(filelen);
+
+        if (entry->data != NULL
+         && fread(entry->data, 1, filelen, fstream) == (size_t) filelen
+         && IsMid(entry->data, filelen))
+        {
+            entry->len = filelen;
+        }
+        else
+        {
+            free(entry->data);
+            entry->data = NULL;
+        }
+    }
+
+    fclose(fstream);
+
+    return entry->data != NULL;
+}
+
+static boolean ConvertMusToCache(cached_midi_t *entry, void *data, int len)
+{
+    MEMFILE *instream;
+    MEMFILE *outstream;
+    void *outbuf;
+    size_t outbuf_len;
+
+    instream = mem_fopen_read(data, len);
+    outstream = mem_fopen_write();
+
+    if (mus2mid(instream, outstream) == 0)
+    {
+        mem_get_buf(outstream, &outbuf, &outbuf_len);
+
+        entry->data = malloc(outbuf_len);
+
+        if (entry->data != NULL)
+        {
+            memcpy(entry->data, outbuf, outbuf_len);
+            entry->len = outbuf_len;
+        }
+    }
+
+    mem_fclose(instream);
+    mem_fclose(outstream);
+
+    return entry->data != NULL;
+}
+
+byte *I_SongMidi(void *data, int len, size_t *midi_len)
+{
+    sha1_context_t context;
+    sha1_digest_t hash;
+    cached_midi_t *entry;
+    char *filename;
+    const int cache_size = M_LowMemory() ? MIDI_CACHE_SIZE_LOWMEM
+                                         : MIDI_CACHE_SIZE;
+    int i;
+
+    if (!IsMus(data, len))
+    {
+        *midi_len = len;
+        return data;
+    }
+
+    if (!midi_cache_initted)
+    {
+        InitMidiCache();
+    }
+
+    SHA1_Init(&context);
+    SHA1_Update(&context, data, len);
+    SHA1_Final(hash, &context);
+
+    // A hit, or else the empty or least recently used entry
+
+    entry = &midi_cache[0];
+
+    for (i = 0; i < cache_size; ++i)
+    {
+        if (midi_cache[i].data != NULL
+         && !memcmp(midi_cache[i].hash, hash, sizeof(hash)))
+        {
+            entry = &midi_cache[i];
+            entry->last_used = ++midi_cache_clock;
+            *midi_len = entry->len;
+            return entry->data;
+        }
+
+        if (entry->data != NULL
+         && (midi_cache[i].data == NULL
+          || midi_cache[i].last_used < entry->last_used))
+        {
+            entry = &midi_cache[i];
+        }
+    }
+
+    free(entry->data);
+    entry->data = NULL;
+    entry->len = 0;
+    memcpy(entry->hash, hash, sizeof(hash));
+
+    if (midicache_dir == NULL || !LoadDiskMidi(entry))
+    {
+        if (!ConvertMusToCache(entry, data, len))
+        {
+            *midi_len = 0;
+            return NULL;
+        }
+
+        if (midicache_dir != NULL)
+        {
+            filename = MidiCacheFilename(hash);
+            M_WriteFile(filename, entry->data, entry->len);
+            free(filename);
+        }
+    }
+
+    entry->last_used = ++midi_cache_clock;
+    *midi_len = entry->len;
+    return entry->data;
+}
+
 void *I_RegisterSong(void *data, int len)
 {
     // If the music pack module is active, check to see if there is a
@@ -505,6 +767,25 @@ void I_UnRegisterSong(void *handle)
     }
 }
 
+// [AP] Prepare a song that is likely to be played soon: the music pack
+// looks for a substitute, and a MUS lump is converted so that starting
+// it later is only a cache hit.
+
+void I_PrefetchSong(void *data, int len)
+{
+    size_t midi_len;
+
+    if (music_packs_active)
+    {
+        I_MP_PrefetchSong(data, len);
+    }
+
+    if (music_module != NULL)
+    {
+        I_SongMidi(data, len, &midi_len);
+    }
+}
+
 void I_PlaySong(void *handle, boolean looping)
 {
     if (active_music_module != NULL)
@@ -548,6 +829,11 @@ void I_BindSoundVariables(void)
     M_BindIntVariable("snd_cachesize",           &snd_cachesize);
     M_BindIntVariable("opl_io_port",             &opl_io_port);
     M_BindIntVariable("snd_pitchshift",          &snd_pitchshift);
+    M_BindIntVariable("snd_sfxdiskcache",        &snd_sfxdiskcache);
+    M_BindIntVariable("snd_precachethread",      &snd_precachethread);
+    M_BindIntVariable("snd_oplmusiccache",       &snd_oplmusiccache);
+    M_BindIntVariable("snd_softmixer",           &snd_softmixer);
+    M_BindIntVariable("snd_mididiskcache",       &snd_mididiskcache);
 
     M_BindStringVariable("music_pack_path",      &music_pack_path);
     M_BindStringVariable("timidity_cfg_path",    &timidity_cfg_path);
@@ -562,11 +848,13 @@ void I_BindSoundVariables(void)
 #endif
 
 #ifdef HAVE_FLUIDSYNTH
+    M_BindIntVariable("fsynth_block_size",          &fsynth_block_size); // [AP]
     M_BindIntVariable("fsynth_chorus_active",       &fsynth_chorus_active);
     M_BindFloatVariable("fsynth_chorus_depth",      &fsynth_chorus_depth);
     M_BindFloatVariable("fsynth_chorus_level",      &fsynth_chorus_level);
     M_BindIntVariable("fsynth_chorus_nr",           &fsynth_chorus_nr);
     M_BindFloatVariable("fsynth_chorus_speed",      &fsynth_chorus_speed);
+    M_BindIntVariable("fsynth_latency",             &fsynth_latency); // [AP]
     M_BindStringVariable("fsynth_midibankselect",   &fsynth_midibankselect);
     M_BindIntVariable("fsynth_polyphony",           &fsynth_polyphony);
     M_BindIntVariable("fsynth_reverb_active",       &fsynth_reverb_active);
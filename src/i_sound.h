@@ -224,6 +224,7 @@ void I_PauseSong(void);
 void I_ResumeSong(void);
 void *I_RegisterSong(void *data, int len);
 void I_UnRegisterSong(void *handle);
+void I_PrefetchSong(void *data, int len);
 void I_PlaySong(void *handle, boolean looping);
 void I_StopSong(void);
 boolean I_MusicIsPlaying(void);
@@ -231,6 +232,11 @@ boolean I_MusicIsPlaying(void);
 boolean IsMid(byte *mem, int len);
 boolean IsMus(byte *mem, int len);
 
+// [AP] A song as MIDI: the data itself unless it's MUS, which is converted
+// once and cached. The pointer stays valid until the next call, or NULL
+// if the conversion failed.
+byte *I_SongMidi(void *data, int len, size_t *midi_len);
+
 extern int snd_sfxdevice;
 extern int snd_musicdevice;
 extern int snd_samplerate;
@@ -238,6 +244,11 @@ extern int snd_cachesize;
 extern int snd_maxslicetime_ms;
 extern char *snd_musiccmd;
 extern int snd_pitchshift;
+extern int snd_sfxdiskcache;
+extern int snd_precachethread;
+extern int snd_oplmusiccache;
+extern int snd_softmixer;
+extern int snd_mididiskcache;
 extern char *snd_dmxoption;
 extern int use_libsamplerate;
 extern float libsamplerate_scale;
@@ -253,6 +264,9 @@ typedef enum {
 
 void I_SetOPLDriverVer(opl_driver_ver_t ver);
 void I_OPL_DevMessages(char *, size_t);
+char *I_OPL_MusicCacheDir(void);
+void I_MP_AddCachedMusic(const char *hash, const char *filename);
+void I_MP_PrefetchSong(void *data, int len);
 
 // Sound modules
 
@@ -285,11 +299,13 @@ extern int winmm_chorus_level;
 
 #ifdef HAVE_FLUIDSYNTH
 extern char *fsynth_sf_path;
+extern int fsynth_block_size; // [AP]
 extern int fsynth_chorus_active;
 extern float fsynth_chorus_depth;
 extern float fsynth_chorus_level;
 extern int fsynth_chorus_nr;
 extern float fsynth_chorus_speed;
+extern int fsynth_latency; // [AP]
 extern char *fsynth_midibankselect;
 extern int fsynth_polyphony;
 extern int fsynth_reverb_active;
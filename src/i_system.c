@@ -26,6 +26,7 @@
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <io.h>
 #else
 #include <unistd.h>
 #endif
@@ -55,6 +56,8 @@
 
 #define DEFAULT_RAM 16*2 /* MiB [crispy] */
 #define MIN_RAM     4*4  /* MiB [crispy] */
+#define LOWMEM_RAM  8    /* MiB [AP] -lowmem, more zones follow if needed */
+#define LOWMEM_MIN  4
 
 
 typedef struct atexit_listentry_s atexit_listentry_t;
@@ -86,6 +89,452 @@ void I_Tactile(int on, int off, int total)
 {
 }
 
+// [AP] Background file writes. Only one write is in flight at a time: a
+// new one waits for the previous to land first, which keeps their temp
+// files from clobbering each other.
+
+typedef struct
+{
+    char *filename;
+    char *temp_filename;
+    byte *data;
+    size_t length;
+    write_pack_func_t pack;
+    write_done_func_t done;
+    SDL_Thread *thread;
+    SDL_atomic_t finished;
+    boolean success;
+} file_write_t;
+
+static file_write_t *pending_write = NULL;
+
+static boolean WriteFileSynced(const char *filename, const byte *data,
+                               size_t length)
+{
+    FILE *handle;
+    boolean result;
+
+    handle = M_fopen(filename, "wb");
+
+    if (handle == NULL)
+    {
+        return false;
+    }
+
+    result = fwrite(data, 1, length, handle) == length
+          && fflush(handle) == 0;
+
+    // Make sure the data is on disk before the rename makes it live.
+#ifdef _WIN32
+    result = result && _commit(_fileno(handle)) == 0;
+#else
+    result = result && fsync(fileno(handle)) == 0;
+#endif
+
+    return fclose(handle) == 0 && result;
+}
+
+static int FileWriteThread(void *arg)
+{
+    file_write_t *write = arg;
+    byte *packed = NULL;
+    size_t packed_length;
+    const byte *data = write->data;
+    size_t length = write->length;
+
+    if (write->pack != NULL)
+    {
+        packed = write->pack(write->data, write->length, &packed_length);
+        if (packed != NULL)
+        {
+            data = packed;
+            length = packed_length;
+        }
+    }
+
+    write->success = WriteFileSynced(write->temp_filename, data, length);
+    free(packed);
+
+    if (write->success)
+    {
+        M_remove(write->filename);
+        write->success = M_rename(write->temp_filename, write->filename) == 0;
+    }
+
+    SDL_AtomicSet(&write->finished, 1);
+
+    return 0;
+}
+
+void I_FinishFileWrites(void)
+{
+    file_write_t *write = pending_write;
+
+    if (write == NULL)
+    {
+        return;
+    }
+
+    pending_write = NULL;
+    SDL_WaitThread(write->thread, NULL);
+
+    if (write->done != NULL)
+    {
+        write->done(write->filename, write->success);
+    }
+    else if (!write->success)
+    {
+        fprintf(stderr, "I_FinishFileWrites: Failed to write '%s'.\n",
+                write->filename);
+    }
+
+    free(write->filename);
+    free(write->temp_filename);
+    free(write->data);
+    free(write);
+}
+
+// Nothing is left to report when exiting, only make sure the last write
+// isn't cut short.
+
+static void WaitForFileWrites(void)
+{
+    if (pending_write != NULL)
+    {
+        pending_write->done = NULL;
+        I_FinishFileWrites();
+    }
+}
+
+void I_PollFileWrites(void)
+{
+    if (pending_write != NULL && SDL_AtomicGet(&pending_write->finished))
+    {
+        I_FinishFileWrites();
+    }
+}
+
+void I_WriteFileAsync(const char *filename, const char *temp_filename,
+                      const void *data, size_t length,
+                      write_pack_func_t pack, write_done_func_t done)
+{
+    static boolean registered = false;
+    file_write_t *write;
+
+    I_FinishFileWrites();
+
+    if (!registered)
+    {
+        I_AtExit(WaitForFileWrites, true);
+        registered = true;
+    }
+
+    write = calloc(1, sizeof(*write));
+    write->filename = M_StringDuplicate(filename);
+    write->temp_filename = M_StringDuplicate(temp_filename);
+    write->data = malloc(length);
+    memcpy(write->data, data, length);
+    write->length = length;
+    write->pack = pack;
+    write->done = done;
+    SDL_AtomicSet(&write->finished, 0);
+
+    write->thread = SDL_CreateThread(FileWriteThread, "file write", write);
+
+    if (write->thread == NULL)
+    {
+        // No thread to hand it to; write it here and now instead.
+        FileWriteThread(write);
+    }
+
+    pending_write = write;
+}
+
+// [AP] Streamed file writes
+
+#define STREAM_RING_SIZE (64 * 1024)
+
+struct stream_writer_s
+{
+    FILE *handle;
+    byte *tail;
+    size_t tail_length;
+    long data_end;              // where the tail goes, on the thread
+
+    byte ring[STREAM_RING_SIZE];
+    size_t ring_start;
+    size_t ring_count;
+    boolean closing;
+    boolean failed;
+    SDL_mutex *mutex;
+    SDL_cond *cond;             // data to write, room to write it or closing
+    SDL_Thread *thread;
+
+    stream_writer_t *next;
+};
+
+static stream_writer_t *stream_writers = NULL;
+
+// Writes data and then the tail, on the stream's thread or after it's
+// gone.
+
+static boolean StreamWriteOut(stream_writer_t *stream,
+                              const byte *data, size_t length)
+{
+    boolean result;
+
+    result = fseek(stream->handle, stream->data_end, SEEK_SET) == 0
+          && fwrite(data, 1, length, stream->handle) == length;
+
+    stream->data_end += length;
+
+    return result
+        && fwrite(stream->tail, 1, stream->tail_length, stream->handle)
+               == stream->tail_length
+        && fflush(stream->handle) == 0;
+}
+
+static int StreamWriterThread(void *arg)
+{
+    stream_writer_t *stream = arg;
+    byte *chunk = malloc(STREAM_RING_SIZE);
+    size_t length, first;
+
+    SDL_LockMutex(stream->mutex);
+
+    while (1)
+    {
+        while (stream->ring_count == 0 && !stream->closing)
+        {
+            SDL_CondWait(stream->cond, stream->mutex);
+        }
+
+        if (stream->ring_count == 0)
+        {
+            break;
+        }
+
+        // Take everything there is, and write it without holding the lock
+        length = stream->ring_count;
+        first = STREAM_RING_SIZE - stream->ring_start;
+        if (first > length)
+        {
+            first = length;
+        }
+        memcpy(chunk, stream->ring + stream->ring_start, first);
+        memcpy(chunk + first, stream->ring, length - first);
+        stream->ring_start = (stream->ring_start + length) % STREAM_RING_SIZE;
+        stream->ring_count = 0;
+        SDL_CondBroadcast(stream->cond);
+        SDL_UnlockMutex(stream->mutex);
+
+        if (!StreamWriteOut(stream, chunk, length))
+        {
+            stream->failed = true;
+        }
+
+        SDL_LockMutex(stream->mutex);
+    }
+
+    SDL_UnlockMutex(stream->mutex);
+    free(chunk);
+
+    return 0;
+}
+
+static void CloseStreamWriters(void)
+{
+    while (stream_writers != NULL)
+    {
+        I_CloseStreamWriter(stream_writers);
+    }
+}
+
+stream_writer_t *I_OpenStreamWriter(const char *filename,
+                                    const void *tail, size_t tail_length)
+{
+    static boolean registered = false;
+    stream_writer_t *stream;
+
+    stream = calloc(1, sizeof(*stream));
+    stream->handle = M_fopen(filename, "wb");
+
+    if (stream->handle == NULL)
+    {
+        free(stream);
+        return NULL;
+    }
+
+    stream->tail = malloc(tail_length);
+    memcpy(stream->tail, tail, tail_length);
+    stream->tail_length = tail_length;
+
+    // The file is never without its tail, even before any data.
+    if (!StreamWriteOut(stream, stream->tail, 0))
+    {
+        stream->failed = true;
+    }
+
+    stream->mutex = SDL_CreateMutex();
+    stream->cond = SDL_CreateCond();
+    stream->thread = SDL_CreateThread(StreamWriterThread, "stream write",
+                                      stream);
+
+    // Without a thread, I_StreamWrite writes through instead.
+
+    if (!registered)
+    {
+        I_AtExit(CloseStreamWriters, true);
+        registered = true;
+    }
+
+    stream->next = stream_writers;
+    stream_writers = stream;
+
+    return stream;
+}
+
+void I_StreamWrite(stream_writer_t *stream, const void *data, size_t length)
+{
+    const byte *p = data;
+    size_t room, end, first;
+
+    if (stream->thread == NULL)
+    {
+        if (!StreamWriteOut(stream, p, length))
+        {
+            stream->failed = true;
+        }
+        return;
+    }
+
+    SDL_LockMutex(stream->mutex);
+
+    while (length > 0)
+    {
+        while (stream->ring_count == STREAM_RING_SIZE)
+        {
+            SDL_CondWait(stream->cond, stream->mutex);
+        }
+
+        room = STREAM_RING_SIZE - stream->ring_count;
+        if (room > length)
+        {
+            room = length;
+        }
+        end = (stream->ring_start + stream->ring_count) % STREAM_RING_SIZE;
+        first = STREAM_RING_SIZE - end;
+        if (first > room)
+        {
+            first = room;
+        }
+        memcpy(stream->ring + end, p, first);
+        memcpy(stream->ring, p + first, room - first);
+        stream->ring_count += room;
+        p += room;
+        length -= room;
+
+        SDL_CondBroadcast(stream->cond);
+    }
+
+    SDL_UnlockMutex(stream->mutex);
+}
+
+boolean I_CloseStreamWriter(stream_writer_t *stream)
+{
+    stream_writer_t **prev;
+    boolean success;
+
+    if (stream->thread != NULL)
+    {
+        SDL_LockMutex(stream->mutex);
+        stream->closing = true;
+        SDL_CondBroadcast(stream->cond);
+        SDL_UnlockMutex(stream->mutex);
+        SDL_WaitThread(stream->thread, NULL);
+    }
+
+    success = !stream->failed && fclose(stream->handle) == 0;
+
+    for (prev = &stream_writers; *prev != NULL; prev = &(*prev)->next)
+    {
+        if (*prev == stream)
+        {
+            *prev = stream->next;
+            break;
+        }
+    }
+
+    SDL_DestroyCond(stream->cond);
+    SDL_DestroyMutex(stream->mutex);
+    free(stream->tail);
+    free(stream);
+
+    return success;
+}
+
+struct job_s
+{
+    job_func_t func;
+    void *data;
+    SDL_Thread *thread;
+    SDL_atomic_t cancelled;
+    SDL_atomic_t finished;
+};
+
+static int JobThread(void *arg)
+{
+    job_t *job = arg;
+
+    job->func(job, job->data);
+    SDL_AtomicSet(&job->finished, 1);
+
+    return 0;
+}
+
+job_t *I_StartJob(const char *name, job_func_t func, void *data)
+{
+    job_t *job;
+
+    job = calloc(1, sizeof(*job));
+    job->func = func;
+    job->data = data;
+    SDL_AtomicSet(&job->cancelled, 0);
+    SDL_AtomicSet(&job->finished, 0);
+
+    job->thread = SDL_CreateThread(JobThread, name, job);
+
+    if (job->thread == NULL)
+    {
+        free(job);
+        return NULL;
+    }
+
+    return job;
+}
+
+boolean I_JobCancelled(job_t *job)
+{
+    return SDL_AtomicGet(&job->cancelled) != 0;
+}
+
+boolean I_JobFinished(job_t *job)
+{
+    return SDL_AtomicGet(&job->finished) != 0;
+}
+
+void I_FinishJob(job_t *job)
+{
+    SDL_WaitThread(job->thread, NULL);
+    free(job);
+}
+
+void I_CancelJob(job_t *job)
+{
+    SDL_AtomicSet(&job->cancelled, 1);
+    I_FinishJob(job);
+}
+
 // Zone memory auto-allocation function that allocates the zone size
 // by trying progressively smaller zone sizes until one is found that
 // works.
@@ -149,6 +598,13 @@ byte *I_ZoneBase (int *size)
         default_ram = atoi(myargv[p+1]);
         min_ram = default_ram;
     }
+    // [AP] The low memory profile, see M_LowMemory. Parsed here as well,
+    // since the tools built with this file don't have m_memory.c.
+    else if (M_ParmExists("-lowmem"))
+    {
+        default_ram = LOWMEM_RAM;
+        min_ram = LOWMEM_MIN;
+    }
     else
     {
         default_ram = DEFAULT_RAM;
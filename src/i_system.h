@@ -66,6 +66,63 @@ boolean I_GetMemoryValue(unsigned int offset, void *value, int size);
 
 void I_AtExit(atexit_func_t func, boolean run_if_error);
 
+// [AP] Write a file on a background thread. The data is copied, optionally
+// packed by pack() on the worker, written and synced to temp_filename and
+// then renamed over filename. done() is called from the main thread by
+// I_PollFileWrites() or I_FinishFileWrites() once the write has landed.
+
+typedef byte *(*write_pack_func_t)(const byte *data, size_t length,
+                                   size_t *packed_length);
+typedef void (*write_done_func_t)(const char *filename, boolean success);
+
+void I_WriteFileAsync(const char *filename, const char *temp_filename,
+                      const void *data, size_t length,
+                      write_pack_func_t pack, write_done_func_t done);
+
+// Report a background write if it has finished.
+
+void I_PollFileWrites(void);
+
+// Wait for the background write in flight, if any, and report it.
+
+void I_FinishFileWrites(void);
+
+// [AP] A file appended to from a background thread. I_StreamWrite copies
+// the data into a ring buffer the thread empties into the file, so it
+// only blocks when the ring is full. Each time the thread has written
+// what it had, it writes tail after it and flushes, so the file holds a
+// complete tail whenever the program stops; the next data overwrites it.
+// Open streams are closed at exit, even after I_Error.
+
+typedef struct stream_writer_s stream_writer_t;
+
+stream_writer_t *I_OpenStreamWriter(const char *filename,
+                                    const void *tail, size_t tail_length);
+void I_StreamWrite(stream_writer_t *stream, const void *data, size_t length);
+
+// Write out what is left and the tail, close the file and free the
+// stream. False if anything could not be written.
+
+boolean I_CloseStreamWriter(stream_writer_t *stream);
+
+// [AP] Background jobs. func runs on a thread of its own and should return
+// early once I_JobCancelled() says so. I_StartJob returns NULL if no thread
+// could be started. Short work to spread across cores goes to the worker
+// pool in i_task.h instead.
+
+typedef struct job_s job_t;
+typedef void (*job_func_t)(job_t *job, void *data);
+
+job_t *I_StartJob(const char *name, job_func_t func, void *data);
+boolean I_JobCancelled(job_t *job);
+boolean I_JobFinished(job_t *job);
+
+// Wait for the job to return and free it. I_CancelJob asks it to stop
+// first.
+
+void I_FinishJob(job_t *job);
+void I_CancelJob(job_t *job);
+
 // Add all system-specific config file variable bindings.
 
 void I_BindVariables(void);
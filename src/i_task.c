@@ -0,0 +1,644 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Worker thread pool. Each worker has a queue of its own that
+//	it takes from the back of; idle workers steal from the front of
+//	the others'.
+//
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#include "i_system.h"
+#include "i_task.h"
+#include "i_timer.h"
+#include "m_argv.h"
+
+#define MAX_WORKERS 16
+#define QUEUE_INITIAL_SIZE 64 // a power of two
+#define MAX_RANGES ((MAX_WORKERS + 1) * 4)
+
+struct task_s
+{
+    const char *name;
+    task_func_t func;
+    void *data;
+    task_done_t done;
+
+    // The rest is guarded by pool_mutex.
+
+    int refs; // the caller's handle, and the pool's once submitted
+    int pending; // dependencies that haven't finished
+    boolean submitted;
+    boolean finished;
+    task_t **dependents;
+    int num_dependents;
+    task_t *next_done;
+};
+
+typedef struct
+{
+    SDL_mutex *mutex;
+    task_t **tasks;
+    unsigned int size;
+    unsigned int head; // stolen from
+    unsigned int tail; // pushed and popped by the worker itself
+    SDL_Thread *thread;
+} worker_t;
+
+typedef struct
+{
+    task_range_t func;
+    void *data;
+    int start, end;
+} task_range_args_t;
+
+static worker_t workers[MAX_WORKERS];
+static int num_workers = -1; // until the pool is started
+
+static SDL_mutex *pool_mutex;
+static SDL_cond *pool_cond; // a task was queued or finished, or quitting
+static boolean quitting = false;
+static SDL_atomic_t queued;
+static SDL_atomic_t next_worker;
+static SDL_threadID main_thread;
+
+static task_t *done_head = NULL;
+static task_t *done_tail = NULL;
+
+static task_timing_t timing_hook = NULL;
+
+static void PushTask(worker_t *worker, task_t *task)
+{
+    task_t **tasks;
+    unsigned int i;
+
+    SDL_LockMutex(worker->mutex);
+
+    if (worker->tail - worker->head == worker->size)
+    {
+        tasks = malloc(worker->size * 2 * sizeof(*tasks));
+
+        for (i = worker->head; i != worker->tail; ++i)
+        {
+            tasks[i & (worker->size * 2 - 1)] =
+                worker->tasks[i & (worker->size - 1)];
+        }
+
+        free(worker->tasks);
+        worker->tasks = tasks;
+        worker->size *= 2;
+    }
+
+    worker->tasks[worker->tail++ & (worker->size - 1)] = task;
+
+    SDL_UnlockMutex(worker->mutex);
+}
+
+static task_t *PopTask(worker_t *worker, boolean steal)
+{
+    task_t *task = NULL;
+
+    SDL_LockMutex(worker->mutex);
+
+    if (worker->head != worker->tail)
+    {
+        if (steal)
+        {
+            task = worker->tasks[worker->head++ & (worker->size - 1)];
+        }
+        else
+        {
+            task = worker->tasks[--worker->tail & (worker->size - 1)];
+        }
+    }
+
+    SDL_UnlockMutex(worker->mutex);
+
+    return task;
+}
+
+// The newest task in the worker's own queue, or else the oldest in any
+// other. worker is -1 for a thread that isn't one of the pool's.
+
+static task_t *TakeTask(int worker)
+{
+    task_t *task = NULL;
+    int i;
+
+    if (SDL_AtomicGet(&queued) <= 0)
+    {
+        return NULL;
+    }
+
+    if (worker >= 0)
+    {
+        task = PopTask(&workers[worker], false);
+    }
+
+    for (i = 1; task == NULL && i <= num_workers; ++i)
+    {
+        task = PopTask(&workers[(worker + i + num_workers) % num_workers],
+                       true);
+    }
+
+    if (task != NULL)
+    {
+        SDL_AtomicAdd(&queued, -1);
+    }
+
+    return task;
+}
+
+static void ReleaseRef(task_t *task)
+{
+    boolean unused;
+
+    SDL_LockMutex(pool_mutex);
+    unused = --task->refs == 0;
+    SDL_UnlockMutex(pool_mutex);
+
+    if (unused)
+    {
+        free(task);
+    }
+}
+
+static void RunTask(task_t *task, int worker);
+
+// Tasks released by one that a worker finished go on that worker's own
+// queue, where it will find them first.
+
+static void QueueTask(task_t *task, int worker)
+{
+    if (num_workers == 0)
+    {
+        RunTask(task, -1);
+        return;
+    }
+
+    if (worker < 0)
+    {
+        worker = (unsigned int) SDL_AtomicAdd(&next_worker, 1) % num_workers;
+    }
+
+    PushTask(&workers[worker], task);
+    SDL_AtomicAdd(&queued, 1);
+
+    SDL_LockMutex(pool_mutex);
+    SDL_CondBroadcast(pool_cond);
+    SDL_UnlockMutex(pool_mutex);
+}
+
+static void FinishTask(task_t *task, int worker)
+{
+    task_t **ready;
+    task_t *dependent;
+    int num_ready = 0;
+    int num_dependents;
+    boolean keep_ref;
+    int i;
+
+    SDL_LockMutex(pool_mutex);
+
+    task->finished = true;
+
+    // Once it's finished nothing is added to the list, so it can be
+    // taken and reused to hold the dependents that are ready to run.
+    ready = task->dependents;
+    num_dependents = task->num_dependents;
+    task->dependents = NULL;
+    task->num_dependents = 0;
+
+    for (i = 0; i < num_dependents; ++i)
+    {
+        dependent = ready[i];
+
+        if (--dependent->pending == 0 && dependent->submitted)
+        {
+            ready[num_ready++] = dependent;
+        }
+    }
+
+    // The completion queue holds on to the pool's reference until the
+    // callback has run.
+    keep_ref = task->done != NULL;
+
+    if (keep_ref)
+    {
+        task->next_done = NULL;
+
+        if (done_tail != NULL)
+        {
+            done_tail->next_done = task;
+        }
+        else
+        {
+            done_head = task;
+        }
+
+        done_tail = task;
+    }
+
+    SDL_CondBroadcast(pool_cond);
+    SDL_UnlockMutex(pool_mutex);
+
+    for (i = 0; i < num_ready; ++i)
+    {
+        QueueTask(ready[i], worker);
+    }
+
+    free(ready);
+
+    if (!keep_ref)
+    {
+        ReleaseRef(task);
+    }
+}
+
+static void RunTask(task_t *task, int worker)
+{
+    const task_timing_t hook = timing_hook;
+    uint64_t start;
+
+    if (hook != NULL)
+    {
+        start = I_GetCounter();
+        task->func(task->data);
+        hook(task->name, worker, start, I_GetCounter());
+    }
+    else
+    {
+        task->func(task->data);
+    }
+
+    FinishTask(task, worker);
+}
+
+static int SDLCALL WorkerThread(void *arg)
+{
+    const int worker = (int) (intptr_t) arg;
+    task_t *task;
+
+    for (;;)
+    {
+        task = TakeTask(worker);
+
+        if (task != NULL)
+        {
+            RunTask(task, worker);
+            continue;
+        }
+
+        SDL_LockMutex(pool_mutex);
+
+        while (!quitting && SDL_AtomicGet(&queued) <= 0)
+        {
+            SDL_CondWait(pool_cond, pool_mutex);
+        }
+
+        if (quitting)
+        {
+            SDL_UnlockMutex(pool_mutex);
+            return 0;
+        }
+
+        SDL_UnlockMutex(pool_mutex);
+    }
+}
+
+// Tasks still queued at exit are dropped; the ones running are waited
+// for.
+
+static void StopPool(void)
+{
+    int i;
+
+    SDL_LockMutex(pool_mutex);
+    quitting = true;
+    SDL_CondBroadcast(pool_cond);
+    SDL_UnlockMutex(pool_mutex);
+
+    for (i = 0; i < num_workers; ++i)
+    {
+        if (workers[i].thread != NULL)
+        {
+            SDL_WaitThread(workers[i].thread, NULL);
+            workers[i].thread = NULL;
+        }
+    }
+}
+
+static void StartPool(void)
+{
+    int started;
+    int n;
+    int p;
+    int i;
+
+    if (num_workers >= 0)
+    {
+        return;
+    }
+
+    main_thread = SDL_ThreadID();
+
+    n = SDL_GetCPUCount() - 1;
+
+    //!
+    // @arg <n>
+    // @category obscure
+    //
+    // Number of worker threads for work split across the cores. The
+    // default is one fewer than the number of cores. With 0, everything
+    // runs on the main thread.
+    //
+
+    p = M_CheckParmWithArgs("-taskthreads", 1);
+
+    if (p > 0)
+    {
+        n = atoi(myargv[p + 1]);
+    }
+    else if (n < 1)
+    {
+        n = 1;
+    }
+
+    if (n < 0)
+    {
+        n = 0;
+    }
+    else if (n > MAX_WORKERS)
+    {
+        n = MAX_WORKERS;
+    }
+
+    pool_mutex = SDL_CreateMutex();
+    pool_cond = SDL_CreateCond();
+    SDL_AtomicSet(&queued, 0);
+    SDL_AtomicSet(&next_worker, 0);
+
+    // Every queue exists before the workers start stealing from them.
+    for (i = 0; i < n; ++i)
+    {
+        workers[i].mutex = SDL_CreateMutex();
+        workers[i].size = QUEUE_INITIAL_SIZE;
+        workers[i].tasks = malloc(QUEUE_INITIAL_SIZE
+                                  * sizeof(*workers[i].tasks));
+        workers[i].head = 0;
+        workers[i].tail = 0;
+    }
+
+    num_workers = n;
+    started = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        workers[i].thread = SDL_CreateThread(WorkerThread, "task worker",
+                                             (void *) (intptr_t) i);
+
+        if (workers[i].thread != NULL)
+        {
+            ++started;
+        }
+    }
+
+    // A queue without a thread is emptied by the others stealing from it,
+    // but with no threads at all tasks run where they're submitted.
+    if (started == 0)
+    {
+        num_workers = 0;
+    }
+
+    I_AtExit(StopPool, false);
+}
+
+int I_TaskWorkers(void)
+{
+    StartPool();
+
+    return num_workers;
+}
+
+task_t *I_CreateTask(const char *name, task_func_t func, void *data,
+                     task_done_t done)
+{
+    task_t *task;
+
+    StartPool();
+
+    task = calloc(1, sizeof(*task));
+
+    if (task == NULL)
+    {
+        I_Error("I_CreateTask: out of memory");
+    }
+
+    task->name = name;
+    task->func = func;
+    task->data = data;
+    task->done = done;
+    task->refs = 1;
+
+    return task;
+}
+
+void I_TaskDependsOn(task_t *task, task_t *dependency)
+{
+    SDL_LockMutex(pool_mutex);
+
+    if (!dependency->finished)
+    {
+        dependency->dependents =
+            I_Realloc(dependency->dependents,
+                      (dependency->num_dependents + 1)
+                      * sizeof(*dependency->dependents));
+        dependency->dependents[dependency->num_dependents++] = task;
+        ++task->pending;
+    }
+
+    SDL_UnlockMutex(pool_mutex);
+}
+
+void I_SubmitTask(task_t *task)
+{
+    boolean ready;
+
+    SDL_LockMutex(pool_mutex);
+    task->submitted = true;
+    ++task->refs;
+    ready = task->pending == 0;
+    SDL_UnlockMutex(pool_mutex);
+
+    if (ready)
+    {
+        QueueTask(task, -1);
+    }
+}
+
+boolean I_TaskFinished(task_t *task)
+{
+    boolean finished;
+
+    SDL_LockMutex(pool_mutex);
+    finished = task->finished;
+    SDL_UnlockMutex(pool_mutex);
+
+    return finished;
+}
+
+void I_WaitTask(task_t *task)
+{
+    task_t *other;
+
+    while (!I_TaskFinished(task))
+    {
+        // Help rather than sleep, and a task waiting on another from a
+        // worker can't hold up the pool.
+        other = TakeTask(-1);
+
+        if (other != NULL)
+        {
+            RunTask(other, -1);
+            continue;
+        }
+
+        SDL_LockMutex(pool_mutex);
+
+        while (!task->finished && SDL_AtomicGet(&queued) <= 0)
+        {
+            SDL_CondWait(pool_cond, pool_mutex);
+        }
+
+        SDL_UnlockMutex(pool_mutex);
+    }
+
+    if (SDL_ThreadID() == main_thread)
+    {
+        I_RunTaskCallbacks();
+    }
+
+    ReleaseRef(task);
+}
+
+void I_ReleaseTask(task_t *task)
+{
+    ReleaseRef(task);
+}
+
+static void RunRange(void *arg)
+{
+    const task_range_args_t *range = arg;
+
+    range->func(range->data, range->start, range->end);
+}
+
+void I_ParallelFor(const char *name, int count, int grain,
+                   task_range_t func, void *data)
+{
+    task_range_args_t ranges[MAX_RANGES];
+    task_t *tasks[MAX_RANGES];
+    int num_ranges;
+    int i;
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    // A few ranges for each thread, so one that gets a slow range doesn't
+    // leave the others waiting.
+    num_ranges = (I_TaskWorkers() + 1) * 4;
+
+    if (grain > 1 && num_ranges > count / grain)
+    {
+        num_ranges = count / grain;
+    }
+
+    if (num_ranges > count)
+    {
+        num_ranges = count;
+    }
+
+    if (num_ranges <= 1)
+    {
+        func(data, 0, count);
+        return;
+    }
+
+    for (i = 0; i < num_ranges; ++i)
+    {
+        ranges[i].func = func;
+        ranges[i].data = data;
+        ranges[i].start = (int) ((int64_t) count * i / num_ranges);
+        ranges[i].end = (int) ((int64_t) count * (i + 1) / num_ranges);
+    }
+
+    for (i = 1; i < num_ranges; ++i)
+    {
+        tasks[i] = I_CreateTask(name, RunRange, &ranges[i], NULL);
+        I_SubmitTask(tasks[i]);
+    }
+
+    RunRange(&ranges[0]);
+
+    for (i = 1; i < num_ranges; ++i)
+    {
+        I_WaitTask(tasks[i]);
+    }
+}
+
+void I_RunTaskCallbacks(void)
+{
+    task_t *task;
+
+    if (num_workers < 0)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        SDL_LockMutex(pool_mutex);
+
+        task = done_head;
+
+        if (task != NULL)
+        {
+            done_head = task->next_done;
+
+            if (done_head == NULL)
+            {
+                done_tail = NULL;
+            }
+        }
+
+        SDL_UnlockMutex(pool_mutex);
+
+        if (task == NULL)
+        {
+            break;
+        }
+
+        task->done(task->data);
+        ReleaseRef(task);
+    }
+}
+
+void I_SetTaskTiming(task_timing_t hook)
+{
+    timing_hook = hook;
+}
@@ -0,0 +1,77 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Worker thread pool for short pieces of work that can run in
+//	parallel. Long running background work that wants a thread to
+//	itself still uses I_StartJob.
+//
+
+#ifndef __I_TASK__
+#define __I_TASK__
+
+#include "doomtype.h"
+
+typedef struct task_s task_t;
+
+// Runs on a worker thread, or on a thread waiting for tasks to finish.
+typedef void (*task_func_t)(void *data);
+
+// Runs on the main thread, from I_RunTaskCallbacks, once func returns.
+typedef void (*task_done_t)(void *data);
+
+// Runs on [start, end) of an I_ParallelFor range.
+typedef void (*task_range_t)(void *data, int start, int end);
+
+// Called after every task with its name, the worker that ran it (-1 for a
+// thread that was waiting) and I_GetCounter at its start and end.
+typedef void (*task_timing_t)(const char *name, int worker,
+                              uint64_t start, uint64_t end);
+
+// Number of worker threads: one fewer than the cores, at least one,
+// or -taskthreads. Starts the pool if it isn't running.
+int I_TaskWorkers(void);
+
+// Create a task that doesn't run until it's submitted. done may be NULL.
+// The name isn't copied. The caller holds the returned handle until it
+// calls I_WaitTask or I_ReleaseTask.
+task_t *I_CreateTask(const char *name, task_func_t func, void *data,
+                     task_done_t done);
+
+// The task doesn't start until dependency has finished. Only before the
+// task is submitted.
+void I_TaskDependsOn(task_t *task, task_t *dependency);
+
+void I_SubmitTask(task_t *task);
+
+boolean I_TaskFinished(task_t *task);
+
+// Run queued tasks until this one has finished, then give up the handle.
+// On the main thread, completion callbacks are run before it returns.
+void I_WaitTask(task_t *task);
+
+// Give up the handle without waiting. The task still runs.
+void I_ReleaseTask(task_t *task);
+
+// Split [0, count) into ranges of at least grain items, run them across
+// the workers and this thread, and return when all are done.
+void I_ParallelFor(const char *name, int count, int grain,
+                   task_range_t func, void *data);
+
+// Call the completion callbacks of the tasks that have finished. Called
+// from the main loop once a frame.
+void I_RunTaskCallbacks(void);
+
+void I_SetTaskTiming(task_timing_t hook);
+
+#endif
@@ -75,6 +75,18 @@ uint64_t I_GetTimeUS(void)
     return ((counter - basecounter) * 1000000ull) / basefreq;
 }
 
+// [AP] The counter itself, for -thinkstats
+
+uint64_t I_GetCounter(void)
+{
+    return SDL_GetPerformanceCounter();
+}
+
+uint64_t I_GetCounterFreq(void)
+{
+    return basefreq;
+}
+
 // Sleep for a specified number of ms
 
 void I_Sleep(int ms)
@@ -34,6 +34,11 @@ int I_GetTimeMS (void);
 // returns current time in us
 uint64_t I_GetTimeUS(void); // [crispy]
 
+// [AP] Raw high resolution counter, for timing calls too short for
+// I_GetTimeUS. I_GetCounterFreq is its ticks per second.
+uint64_t I_GetCounter(void);
+uint64_t I_GetCounterFreq(void);
+
 // Pause for a specified number of ms
 void I_Sleep(int ms);
 
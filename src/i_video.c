@@ -20,6 +20,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+// [AP] AVX2 gather for the paletted present path, picked at run time
+#if !defined(CRISPY_TRUECOLOR) && defined(__GNUC__) \
+ && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_PALETTE_AVX2
+#include <immintrin.h>
+#endif
+
 #include "SDL.h"
 #include "SDL_opengl.h"
 
@@ -36,13 +43,16 @@
 #include "d_loop.h"
 #include "deh_str.h"
 #include "doomtype.h"
+#include "i_capture.h" // [AP]
 #include "i_input.h"
 #include "i_joystick.h"
 #include "i_system.h"
 #include "i_timer.h"
 #include "i_video.h"
+#include "i_videogl.h" // [AP]
 #include "m_argv.h"
 #include "m_config.h"
+#include "m_memory.h" // [AP]
 #include "m_misc.h"
 #include "tables.h"
 #include "v_diskicon.h"
@@ -102,6 +112,12 @@ static const uint8_t blend_alpha = 0xa8;
 extern pixel_t* colormaps; // [crispy] evil hack to get FPS dots working as in Vanilla
 #else
 static SDL_Color palette[256];
+// [AP] palette mapped to the texture's pixel format, see BlitToTexture
+static uint32_t palette_pixels[256];
+static uint32_t palette_pixels_format;
+// [AP] palette as frame capture wants it, see CaptureFrame
+static uint32_t capture_palette[256];
+static boolean capture_palette_valid;
 #endif
 static boolean palette_to_set;
 
@@ -118,6 +134,10 @@ int usemouse = 1;
 
 int png_screenshots = 1; // [crispy]
 
+// [AP] Frames captured per screenshot, one per frame drawn.
+
+int screenshot_burst = 1;
+
 // SDL video driver name
 
 char *video_driver = "";
@@ -165,6 +185,14 @@ int vga_porch_flash = false;
 
 int force_software_renderer = false;
 
+// [AP] Look the palette up in a shader when SDL renders with OpenGL,
+// instead of converting every pixel on the CPU.
+
+int gpu_palette = false;
+#ifndef CRISPY_TRUECOLOR
+static boolean gl_palette = false;
+#endif
+
 // Time to wait for the screen to settle on startup before starting the
 // game (ms)
 
@@ -518,6 +546,21 @@ void I_GetEvent(void)
     }
 }
 
+// [AP] Reads the mouse between tics, see I_SampleMouse. Returns 0 when
+// the tics don't read it either.
+
+int I_SampleMouseFrame(void)
+{
+    if (!initialized || !usemouse || nomouse || !window_focused)
+    {
+        return 0;
+    }
+
+    SDL_PumpEvents();
+
+    return I_SampleMouse();
+}
+
 //
 // I_StartTic
 //
@@ -530,6 +573,8 @@ void I_StartTic (void)
 
     I_GetEvent();
 
+    M_CheckMemoryReport(); // [AP] kill -USR1
+
     if (usemouse && !nomouse && window_focused)
     {
         I_ReadMouse();
@@ -743,9 +788,263 @@ static void CreateUpscaledTexture(boolean force)
 //      range of [0.0, 1.0).  Used for interpolation.
 fixed_t fractionaltic;
 
+// [AP] re-sample fractionaltic right before rendering, see I_LatchFracTic
+static boolean late_latch;
+
+// [AP] Frame pacing for the uncapped fps limiter. Frames are scheduled
+// against absolute deadlines, so a slightly late frame shortens the next
+// wait instead of shifting every following frame. The wait sleeps while
+// it safely can and spins the rest; the safety margin follows how late
+// I_Sleep has been waking up, which is much worse on some platforms.
+
+#define PACE_MIN_MARGIN 500    // us
+#define PACE_MAX_MARGIN 16000  // us
+
+static void PaceFrame(int fpslimit)
+{
+    static uint64_t deadline;
+    static uint64_t margin = 2000;
+    const uint64_t period = 1000000ull / fpslimit;
+    uint64_t now = I_GetTimeUS();
+
+    deadline += period;
+
+    if (now >= deadline)
+    {
+        // Missed the slot. Too far behind (first frame, a hitch): start
+        // the schedule over rather than rushing frames to catch up.
+        if (now - deadline > period)
+        {
+            deadline = now;
+        }
+        return;
+    }
+
+    if (deadline - now > 2 * period)
+    {
+        // The limit was lowered, or the clock jumped.
+        deadline = now + period;
+    }
+
+    while (now < deadline)
+    {
+        const uint64_t remaining = deadline - now;
+
+        if (remaining > margin + 1000)
+        {
+            const uint64_t request = (remaining - margin) / 1000;
+            const uint64_t before = now;
+            uint64_t late;
+
+            I_Sleep(request);
+            now = I_GetTimeUS();
+
+            // Grow the margin at once on an oversleep, shrink it slowly.
+            late = now - before > request * 1000 ? now - before - request * 1000 : 0;
+            margin = MAX(late + 250, margin - margin / 16);
+            margin = BETWEEN(PACE_MIN_MARGIN, PACE_MAX_MARGIN, margin);
+        }
+        else
+        {
+            now = I_GetTimeUS();
+        }
+    }
+}
+
+void I_LatchFracTic(void)
+{
+    if (late_latch && crispy->uncapped && !singletics)
+    {
+        fractionaltic = I_GetFracRealTime();
+    }
+}
+
 //
 // I_FinishUpdate
 //
+#ifndef CRISPY_TRUECOLOR
+// [AP] Expand one row of palette indices into palette_pixels values.
+
+static void PaletteRow(uint32_t *dst, const byte *src, int width)
+{
+    int x;
+
+    for (x = 0; x < width; ++x)
+    {
+        dst[x] = palette_pixels[src[x]];
+    }
+}
+
+#ifdef HAVE_PALETTE_AVX2
+__attribute__((target("avx2")))
+static void PaletteRowAVX2(uint32_t *dst, const byte *src, int width)
+{
+    int x;
+
+    // Eight indices widened to 32 bits, then one table gather.
+    for (x = 0; x + 8 <= width; x += 8)
+    {
+        const __m128i bytes = _mm_loadl_epi64((const __m128i *) (src + x));
+        const __m256i index = _mm256_cvtepu8_epi32(bytes);
+
+        _mm256_storeu_si256((__m256i *) (dst + x),
+            _mm256_i32gather_epi32((const int *) palette_pixels, index, 4));
+    }
+
+    PaletteRow(dst + x, src + x, width - x);
+}
+#endif
+
+static void (*palette_row)(uint32_t *dst, const byte *src, int width);
+
+// [AP] Convert the paletted screen buffer straight into the locked
+// streaming texture, instead of blitting it into argbbuffer and then
+// copying that into the texture. Falls back to the two-step path for
+// pixel formats that aren't 32 bits wide.
+
+static void BlitToTexture(void)
+{
+    const byte *src;
+    byte *dst;
+    void *pixels;
+    int pitch;
+    int x, y;
+
+    if (argbbuffer->format->BytesPerPixel != 4
+     || SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0)
+    {
+        SDL_LowerBlit(screenbuffer, &blit_rect, argbbuffer, &blit_rect);
+        SDL_UpdateTexture(texture, NULL, argbbuffer->pixels, argbbuffer->pitch);
+        return;
+    }
+
+    if (palette_pixels_format != argbbuffer->format->format)
+    {
+        for (x = 0; x < 256; ++x)
+        {
+            palette_pixels[x] = SDL_MapRGB(argbbuffer->format, palette[x].r,
+                                           palette[x].g, palette[x].b);
+        }
+        palette_pixels_format = argbbuffer->format->format;
+    }
+
+    if (palette_row == NULL)
+    {
+        palette_row = PaletteRow;
+#ifdef HAVE_PALETTE_AVX2
+        if (__builtin_cpu_supports("avx2"))
+        {
+            palette_row = PaletteRowAVX2;
+        }
+#endif
+    }
+
+    src = screenbuffer->pixels;
+    dst = pixels;
+
+    for (y = 0; y < SCREENHEIGHT; ++y)
+    {
+        palette_row((uint32_t *) dst, src, SCREENWIDTH);
+
+        src += screenbuffer->pitch;
+        dst += pitch;
+    }
+
+    SDL_UnlockTexture(texture);
+}
+
+// [AP] Draw the paletted screen buffer with the palette shader. The
+// upscale factors are the ones the CPU path would scale up by, if it
+// scales up at all.
+
+static void DrawFrameGL(void)
+{
+    int w_upscale = 0, h_upscale = 0;
+
+    if (crispy->smoothscaling
+     && SDL_QueryTexture(texture_upscaled, NULL, NULL,
+                         &w_upscale, &h_upscale) == 0)
+    {
+        w_upscale /= SCREENWIDTH;
+        h_upscale /= SCREENHEIGHT;
+    }
+    else
+    {
+        w_upscale = h_upscale = 0;
+    }
+
+    I_GL_DrawFrame(renderer, screenbuffer->pixels, screenbuffer->pitch,
+                   SCREENWIDTH, SCREENHEIGHT, w_upscale, h_upscale);
+}
+#endif
+
+// [AP] Hand the frame to frame capture at the internal resolution, in the
+// capture's pixel format. The truecolor palette flash panes are only
+// blended by the renderer, so they aren't captured.
+
+static void CaptureFrame(void)
+{
+    uint32_t *dst;
+    const byte *src;
+    int y;
+#ifndef CRISPY_TRUECOLOR
+    int x;
+#endif
+
+#ifdef CRISPY_TRUECOLOR
+    if (argbbuffer->format->BytesPerPixel != 4
+     || argbbuffer->format->Rmask != 0xff0000
+     || argbbuffer->format->Bmask != 0xff)
+    {
+        return;
+    }
+#endif
+
+    dst = I_CaptureBeginFrame(SCREENWIDTH, SCREENHEIGHT);
+
+    if (dst == NULL)
+    {
+        return;
+    }
+
+#ifndef CRISPY_TRUECOLOR
+    if (!capture_palette_valid)
+    {
+        for (x = 0; x < 256; ++x)
+        {
+            capture_palette[x] = 0xff000000 | (palette[x].r << 16)
+                               | (palette[x].g << 8) | palette[x].b;
+        }
+        capture_palette_valid = true;
+    }
+
+    src = screenbuffer->pixels;
+
+    for (y = 0; y < SCREENHEIGHT; ++y)
+    {
+        for (x = 0; x < SCREENWIDTH; ++x)
+        {
+            dst[x] = capture_palette[src[x]];
+        }
+
+        src += screenbuffer->pitch;
+        dst += SCREENWIDTH;
+    }
+#else
+    src = argbbuffer->pixels;
+
+    for (y = 0; y < SCREENHEIGHT; ++y)
+    {
+        memcpy(dst, src, SCREENWIDTH * sizeof(*dst));
+
+        src += argbbuffer->pitch;
+        dst += SCREENWIDTH;
+    }
+#endif
+
+    I_CaptureEndFrame();
+}
+
 void I_FinishUpdate (void)
 {
     static int lasttic;
@@ -847,6 +1146,10 @@ void I_FinishUpdate (void)
     {
         SDL_SetPaletteColors(screenbuffer->format->palette, palette, 0, 256);
         palette_to_set = false;
+        palette_pixels_format = SDL_PIXELFORMAT_UNKNOWN;
+        capture_palette_valid = false;
+
+        I_GL_SetPalette(palette); // [AP]
 
         if (vga_porch_flash)
         {
@@ -857,20 +1160,31 @@ void I_FinishUpdate (void)
         }
     }
 
-    // Blit from the paletted 8-bit screen buffer to the intermediate
-    // 32-bit RGBA buffer that we can load into the texture.
-
-    SDL_LowerBlit(screenbuffer, &blit_rect, argbbuffer, &blit_rect);
-#endif
+    // Convert the paletted 8-bit screen buffer into the intermediate
+    // texture.
 
+    if (!gl_palette)
+    {
+        BlitToTexture();
+    }
+#else
     // Update the intermediate texture with the contents of the RGBA buffer.
 
     SDL_UpdateTexture(texture, NULL, argbbuffer->pixels, argbbuffer->pitch);
+#endif
 
     // Make sure the pillarboxes are kept clear each frame.
 
     SDL_RenderClear(renderer);
 
+#ifndef CRISPY_TRUECOLOR
+    if (gl_palette)
+    {
+        // [AP] The shader does the conversion, straight to the screen.
+        DrawFrameGL();
+    }
+    else
+#endif
     if (crispy->smoothscaling && !force_software_renderer)
     {
     // Render this intermediate texture into the upscaled texture
@@ -898,6 +1212,8 @@ void I_FinishUpdate (void)
     }
 #endif
 
+    CaptureFrame(); // [AP]
+
     // Draw!
 
     SDL_RenderPresent(renderer);
@@ -907,28 +1223,7 @@ void I_FinishUpdate (void)
         // Limit framerate
         if (crispy->fpslimit >= TICRATE)
         {
-            uint64_t target_time = 1000000ull / crispy->fpslimit;
-            static uint64_t start_time;
-
-            while (1)
-            {
-                uint64_t current_time = I_GetTimeUS();
-                uint64_t elapsed_time = current_time - start_time;
-                uint64_t remaining_time = 0;
-
-                if (elapsed_time >= target_time)
-                {
-                    start_time = current_time;
-                    break;
-                }
-
-                remaining_time = target_time - elapsed_time;
-
-                if (remaining_time > 1000)
-                {
-                    I_Sleep((remaining_time - 1000) / 1000);
-                }
-            }
+            PaceFrame(crispy->fpslimit);
         }
 
         // [AM] Figure out how far into the current tic we're in as a fixed_t.
@@ -1148,6 +1443,16 @@ void I_GraphicsCheckCommandLine(void)
 
     nograbmouse_override = M_ParmExists("-nograbmouse");
 
+    //!
+    // @category video
+    //
+    // With uncapped framerate, take the interpolation point for each
+    // frame right before the view is rendered instead of after the
+    // previous frame was presented.
+    //
+
+    late_latch = M_ParmExists("-latelatch");
+
     // default to fullscreen mode, allow override with command line
     // nofullscreen because we love prboom
 
@@ -1483,6 +1788,14 @@ static void SetVideoMode(void)
         texture_upscaled = NULL;
     }
 
+#ifndef CRISPY_TRUECOLOR
+    // [AP] SDL tries the other drivers if the OpenGL one fails.
+    if (gpu_palette && !force_software_renderer)
+    {
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
+    }
+#endif
+
     renderer = SDL_CreateRenderer(screen, -1, renderer_flags);
 
     // If we could not find a matching render driver,
@@ -1615,6 +1928,10 @@ static void SetVideoMode(void)
     // Initially create the upscaled texture for rendering to screen
 
     CreateUpscaledTexture(true);
+
+#ifndef CRISPY_TRUECOLOR
+    gl_palette = gpu_palette && I_GL_InitPalette(renderer); // [AP]
+#endif
 }
 
 // [crispy] re-calculate SCREENWIDTH, SCREENHEIGHT, NONWIDEWIDTH and WIDESCREENDELTA
@@ -1787,6 +2104,8 @@ void I_InitGraphics(void)
     // Call I_ShutdownGraphics on quit
 
     I_AtExit(I_ShutdownGraphics, true);
+
+    I_InitCapture(); // [AP]
 }
 
 // [crispy] re-initialize only the parts of the rendering stack that are really necessary
@@ -1858,6 +2177,11 @@ void I_ReInitGraphics (int reinit)
 
 		// [crispy] the texture gets destroyed in SDL_DestroyRenderer(), force its re-creation
 		texture_upscaled = NULL;
+
+#ifndef CRISPY_TRUECOLOR
+		// [AP] and so do the GL objects
+		gl_palette = gpu_palette && I_GL_InitPalette(renderer);
+#endif
 	}
 
 	// [crispy] re-create textures
@@ -1908,6 +2232,59 @@ void I_ReInitGraphics (int reinit)
 
 // [crispy] take screenshot of the rendered image
 
+// [AP] Read back frames are pooled, so that a screenshot burst isn't a
+// frame sized allocation a frame. Each buffer starts with its size.
+
+#define READPIXELS_POOL_SIZE 4
+
+static byte *readpixels_pool[READPIXELS_POOL_SIZE];
+static SDL_SpinLock readpixels_lock;
+
+static byte *AllocReadPixels(size_t size)
+{
+	byte *buffer = NULL;
+	int i;
+
+	SDL_AtomicLock(&readpixels_lock);
+	for (i = 0; i < READPIXELS_POOL_SIZE; i++)
+	{
+		if (readpixels_pool[i] != NULL && *(size_t *) readpixels_pool[i] >= size)
+		{
+			buffer = readpixels_pool[i];
+			readpixels_pool[i] = NULL;
+			break;
+		}
+	}
+	SDL_AtomicUnlock(&readpixels_lock);
+
+	if (buffer == NULL)
+	{
+		buffer = malloc(sizeof(size_t) + size);
+		*(size_t *) buffer = size;
+	}
+
+	return buffer + sizeof(size_t);
+}
+
+void I_ReleaseReadPixels(byte *data)
+{
+	byte *buffer = data - sizeof(size_t);
+	int i;
+
+	SDL_AtomicLock(&readpixels_lock);
+	for (i = 0; i < READPIXELS_POOL_SIZE && buffer != NULL; i++)
+	{
+		if (readpixels_pool[i] == NULL)
+		{
+			readpixels_pool[i] = buffer;
+			buffer = NULL;
+		}
+	}
+	SDL_AtomicUnlock(&readpixels_lock);
+
+	free(buffer);
+}
+
 void I_RenderReadPixels(byte **data, int *w, int *h, int *p)
 {
 	SDL_Rect rect;
@@ -1978,7 +2355,7 @@ void I_RenderReadPixels(byte **data, int *w, int *h, int *p)
 	}
 
 	// [crispy] allocate memory for screenshot image
-	pixels = malloc(rect.h * temp);
+	pixels = AllocReadPixels(rect.h * temp); // [AP]
 	SDL_RenderReadPixels(renderer, &rect, format->format, pixels, temp);
 
 	*data = pixels;
@@ -2003,6 +2380,7 @@ void I_BindVideoVariables(void)
     M_BindIntVariable("fullscreen_width",          &fullscreen_width);
     M_BindIntVariable("fullscreen_height",         &fullscreen_height);
     M_BindIntVariable("force_software_renderer",   &force_software_renderer);
+    M_BindIntVariable("gpu_palette",               &gpu_palette); // [AP]
     M_BindIntVariable("max_scaling_buffer_pixels", &max_scaling_buffer_pixels);
     M_BindIntVariable("window_width",              &window_width);
     M_BindIntVariable("window_height",             &window_height);
@@ -2011,6 +2389,7 @@ void I_BindVideoVariables(void)
     M_BindStringVariable("window_position",        &window_position);
     M_BindIntVariable("usegamma",                  &usegamma);
     M_BindIntVariable("png_screenshots",           &png_screenshots);
+    M_BindIntVariable("screenshot_burst",          &screenshot_burst);
 }
 
 #ifdef CRISPY_TRUECOLOR
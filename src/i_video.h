@@ -66,6 +66,7 @@ extern const pixel_t I_MapRGB (const uint8_t r, const uint8_t g, const uint8_t b
 
 void I_UpdateNoBlit (void);
 void I_FinishUpdate (void);
+void I_LatchFracTic (void); // [AP]
 
 void I_ReadScreen (pixel_t* scr);
 
@@ -93,6 +94,11 @@ void I_StartFrame (void);
 
 void I_StartTic (void);
 
+// [AP] Called before rendering a frame, for the sideways mouse movement
+// the next I_StartTic will read so far.
+
+int I_SampleMouseFrame(void);
+
 // Enable the loading disk image displayed when reading from disk.
 
 void I_EnableLoadingDisk(int xoffs, int yoffs);
@@ -112,8 +118,16 @@ extern int aspect_ratio_correct;
 extern int integer_scaling;
 extern int vga_porch_flash;
 extern int force_software_renderer;
+extern int gpu_palette; // [AP]
 
 extern int png_screenshots;
+extern int screenshot_burst;
+
+// [AP] Reads back the frame as shown, for a screenshot. The buffer comes
+// from a small pool and goes back with I_ReleaseReadPixels, which may be
+// called from any thread.
+void I_RenderReadPixels(byte **data, int *w, int *h, int *p);
+void I_ReleaseReadPixels(byte *data);
 
 extern char *window_position;
 void I_GetWindowPosition(int *x, int *y, int w, int h);
@@ -0,0 +1,388 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Paletted frames drawn with OpenGL: the 8-bit frame is uploaded
+//	as it is and a shader looks its colours up in the palette.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_opengl.h"
+
+#include "i_videogl.h"
+
+// The functions are fetched from SDL, which loaded the GL library for its
+// renderer; the game isn't linked against it.
+
+#define GL_FUNCTIONS(X) \
+    X(void, GetIntegerv, (GLenum pname, GLint *params)) \
+    X(const GLubyte *, GetString, (GLenum name)) \
+    X(void, PushAttrib, (GLbitfield mask)) \
+    X(void, PopAttrib, (void)) \
+    X(void, PushClientAttrib, (GLbitfield mask)) \
+    X(void, PopClientAttrib, (void)) \
+    X(void, Disable, (GLenum cap)) \
+    X(void, Viewport, (GLint x, GLint y, GLsizei w, GLsizei h)) \
+    X(void, GenTextures, (GLsizei n, GLuint *textures)) \
+    X(void, BindTexture, (GLenum target, GLuint texture)) \
+    X(void, TexParameteri, (GLenum target, GLenum pname, GLint param)) \
+    X(void, TexImage2D, (GLenum target, GLint level, GLint internalformat, \
+                         GLsizei w, GLsizei h, GLint border, GLenum format, \
+                         GLenum type, const void *pixels)) \
+    X(void, TexSubImage2D, (GLenum target, GLint level, GLint x, GLint y, \
+                            GLsizei w, GLsizei h, GLenum format, \
+                            GLenum type, const void *pixels)) \
+    X(void, PixelStorei, (GLenum pname, GLint param)) \
+    X(void, Begin, (GLenum mode)) \
+    X(void, End, (void)) \
+    X(void, TexCoord2f, (GLfloat s, GLfloat t)) \
+    X(void, Vertex2f, (GLfloat x, GLfloat y)) \
+    X(void, ActiveTexture, (GLenum texture)) \
+    X(GLuint, CreateShader, (GLenum type)) \
+    X(void, ShaderSource, (GLuint shader, GLsizei count, \
+                           const GLchar *const *string, const GLint *length)) \
+    X(void, CompileShader, (GLuint shader)) \
+    X(void, GetShaderiv, (GLuint shader, GLenum pname, GLint *params)) \
+    X(void, GetShaderInfoLog, (GLuint shader, GLsizei size, GLsizei *length, \
+                               GLchar *log)) \
+    X(void, DeleteShader, (GLuint shader)) \
+    X(GLuint, CreateProgram, (void)) \
+    X(void, AttachShader, (GLuint program, GLuint shader)) \
+    X(void, LinkProgram, (GLuint program)) \
+    X(void, GetProgramiv, (GLuint program, GLenum pname, GLint *params)) \
+    X(void, GetProgramInfoLog, (GLuint program, GLsizei size, \
+                                GLsizei *length, GLchar *log)) \
+    X(void, DeleteProgram, (GLuint program)) \
+    X(void, UseProgram, (GLuint program)) \
+    X(GLint, GetUniformLocation, (GLuint program, const GLchar *name)) \
+    X(void, Uniform1i, (GLint location, GLint v0)) \
+    X(void, Uniform2f, (GLint location, GLfloat v0, GLfloat v1))
+
+#define DECLARE_FUNCTION(ret, name, args) ret (APIENTRY *name) args;
+
+static struct
+{
+    GL_FUNCTIONS(DECLARE_FUNCTION)
+} gl;
+
+static const char vertex_source[] =
+    "#version 110\n"
+    "varying vec2 texcoord;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = gl_Vertex;\n"
+    "    texcoord = gl_MultiTexCoord0.xy;\n"
+    "}\n";
+
+// With smooth scaling on, the CPU path scales the frame up by whole
+// factors with "nearest" and then down to the window with "linear". The
+// four taps of that linear filter are worked out here in the upscaled
+// texture's pixels and each one is mapped back to the frame pixel it
+// would have been copied from.
+
+static const char fragment_source[] =
+    "#version 110\n"
+    "uniform sampler2D frame;\n"
+    "uniform sampler2D palette;\n"
+    "uniform vec2 size;\n"
+    "uniform vec2 upscale;\n"
+    "varying vec2 texcoord;\n"
+    "vec3 Lookup(vec2 pixel)\n"
+    "{\n"
+    "    float index = texture2D(frame, (pixel + 0.5) / size).r;\n"
+    "    return texture2D(palette,\n"
+    "                     vec2((index * 255.0 + 0.5) / 256.0, 0.5)).rgb;\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 pos = texcoord * size;\n"
+    "    vec3 color;\n"
+    "    if (upscale.x == 0.0)\n"
+    "    {\n"
+    "        color = Lookup(clamp(floor(pos), vec2(0.0), size - 1.0));\n"
+    "    }\n"
+    "    else\n"
+    "    {\n"
+    "        vec2 p = pos * upscale - 0.5;\n"
+    "        vec2 base = floor(p);\n"
+    "        vec2 f = p - base;\n"
+    "        vec2 p0 = clamp(floor((base + 0.5) / upscale),\n"
+    "                        vec2(0.0), size - 1.0);\n"
+    "        vec2 p1 = clamp(floor((base + 1.5) / upscale),\n"
+    "                        vec2(0.0), size - 1.0);\n"
+    "        color = mix(mix(Lookup(p0), Lookup(vec2(p1.x, p0.y)), f.x),\n"
+    "                    mix(Lookup(vec2(p0.x, p1.y)), Lookup(p1), f.x),\n"
+    "                    f.y);\n"
+    "    }\n"
+    "    gl_FragColor = vec4(color, 1.0);\n"
+    "}\n";
+
+static GLuint program;
+static GLint size_uniform, upscale_uniform;
+static GLuint frame_texture, palette_texture;
+static int frame_width, frame_height;
+
+static SDL_Color gl_palette[256];
+static boolean palette_dirty;
+
+static boolean LoadFunctions(void)
+{
+    const char *version;
+
+#define LOAD_FUNCTION(ret, name, args) \
+    gl.name = (ret (APIENTRY *) args) SDL_GL_GetProcAddress("gl" #name); \
+    if (gl.name == NULL) \
+    { \
+        fprintf(stderr, "I_GL_InitPalette: gl" #name " is missing\n"); \
+        return false; \
+    }
+
+    GL_FUNCTIONS(LOAD_FUNCTION)
+
+    // The entry points can exist in libraries whose context is older
+    // than the GL 2.0 the shaders need.
+
+    version = (const char *) gl.GetString(GL_VERSION);
+
+    if (version == NULL || atoi(version) < 2)
+    {
+        fprintf(stderr, "I_GL_InitPalette: OpenGL 2.0 needed, have %s\n",
+                version != NULL ? version : "none");
+        return false;
+    }
+
+    return true;
+}
+
+static GLuint CompileShader(GLenum type, const char *source)
+{
+    GLuint shader;
+    GLint status;
+    char log[512];
+
+    shader = gl.CreateShader(type);
+    gl.ShaderSource(shader, 1, &source, NULL);
+    gl.CompileShader(shader);
+    gl.GetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+    if (!status)
+    {
+        gl.GetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "I_GL_InitPalette: shader failed to compile: %s\n",
+                log);
+        gl.DeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+static boolean BuildProgram(void)
+{
+    GLuint vertex, fragment;
+    GLint status, old_program;
+    char log[512];
+
+    vertex = CompileShader(GL_VERTEX_SHADER, vertex_source);
+    fragment = CompileShader(GL_FRAGMENT_SHADER, fragment_source);
+
+    if (vertex == 0 || fragment == 0)
+    {
+        if (vertex != 0)
+            gl.DeleteShader(vertex);
+        if (fragment != 0)
+            gl.DeleteShader(fragment);
+        return false;
+    }
+
+    program = gl.CreateProgram();
+    gl.AttachShader(program, vertex);
+    gl.AttachShader(program, fragment);
+    gl.LinkProgram(program);
+
+    // The program keeps them for as long as it lives.
+
+    gl.DeleteShader(vertex);
+    gl.DeleteShader(fragment);
+
+    gl.GetProgramiv(program, GL_LINK_STATUS, &status);
+
+    if (!status)
+    {
+        gl.GetProgramInfoLog(program, sizeof(log), NULL, log);
+        fprintf(stderr, "I_GL_InitPalette: shader failed to link: %s\n", log);
+        gl.DeleteProgram(program);
+        program = 0;
+        return false;
+    }
+
+    // The samplers never change, so they're set once here.
+
+    gl.GetIntegerv(GL_CURRENT_PROGRAM, &old_program);
+    gl.UseProgram(program);
+    gl.Uniform1i(gl.GetUniformLocation(program, "frame"), 0);
+    gl.Uniform1i(gl.GetUniformLocation(program, "palette"), 1);
+    gl.UseProgram(old_program);
+
+    size_uniform = gl.GetUniformLocation(program, "size");
+    upscale_uniform = gl.GetUniformLocation(program, "upscale");
+
+    return true;
+}
+
+static GLuint CreateTexture(GLint format, int width, int height)
+{
+    GLuint tex;
+
+    gl.GenTextures(1, &tex);
+    gl.BindTexture(GL_TEXTURE_2D, tex);
+    gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    gl.TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0,
+                  format == GL_LUMINANCE8 ? GL_LUMINANCE : GL_RGBA,
+                  GL_UNSIGNED_BYTE, NULL);
+
+    return tex;
+}
+
+boolean I_GL_InitPalette(SDL_Renderer *renderer)
+{
+    SDL_RendererInfo info;
+
+    // Whatever was made before went with the old renderer's context.
+
+    program = 0;
+    frame_texture = 0;
+    palette_texture = 0;
+    frame_width = frame_height = 0;
+    palette_dirty = true;
+
+    if (SDL_GetRendererInfo(renderer, &info) != 0
+     || strcmp(info.name, "opengl") != 0)
+    {
+        return false;
+    }
+
+    // Any SDL render call makes the renderer's context current.
+
+    SDL_RenderClear(renderer);
+
+    if (!LoadFunctions() || !BuildProgram())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void I_GL_SetPalette(const SDL_Color *palette)
+{
+    memcpy(gl_palette, palette, sizeof(gl_palette));
+    palette_dirty = true;
+}
+
+void I_GL_DrawFrame(SDL_Renderer *renderer, const byte *pixels, int pitch,
+                    int width, int height, int w_upscale, int h_upscale)
+{
+    SDL_Rect viewport;
+    float scale_x, scale_y;
+    int out_w, out_h;
+    GLint old_program, old_active;
+
+    SDL_SetRenderTarget(renderer, NULL);
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    // Anything SDL has batched up has to be drawn before the frame is.
+    SDL_RenderFlush(renderer);
+#endif
+
+    SDL_RenderGetViewport(renderer, &viewport);
+    SDL_RenderGetScale(renderer, &scale_x, &scale_y);
+    SDL_GetRendererOutputSize(renderer, &out_w, &out_h);
+
+    // SDL keeps its own record of the GL state, so everything touched here
+    // is put back the way it was.
+
+    gl.GetIntegerv(GL_CURRENT_PROGRAM, &old_program);
+    gl.GetIntegerv(GL_ACTIVE_TEXTURE, &old_active);
+    gl.PushAttrib(GL_ENABLE_BIT | GL_TEXTURE_BIT | GL_VIEWPORT_BIT
+                | GL_COLOR_BUFFER_BIT | GL_SCISSOR_BIT);
+    gl.PushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+
+    gl.Disable(GL_BLEND);
+    gl.Disable(GL_SCISSOR_TEST);
+    gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    gl.ActiveTexture(GL_TEXTURE1);
+
+    if (palette_texture == 0)
+    {
+        palette_texture = CreateTexture(GL_RGBA8, 256, 1);
+    }
+
+    gl.BindTexture(GL_TEXTURE_2D, palette_texture);
+
+    if (palette_dirty)
+    {
+        gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 256, 1, GL_RGBA,
+                         GL_UNSIGNED_BYTE, gl_palette);
+        palette_dirty = false;
+    }
+
+    gl.ActiveTexture(GL_TEXTURE0);
+
+    if (frame_texture == 0 || frame_width != width || frame_height != height)
+    {
+        frame_texture = CreateTexture(GL_LUMINANCE8, width, height);
+        frame_width = width;
+        frame_height = height;
+    }
+
+    gl.BindTexture(GL_TEXTURE_2D, frame_texture);
+    gl.PixelStorei(GL_UNPACK_ROW_LENGTH, pitch);
+    gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_LUMINANCE,
+                     GL_UNSIGNED_BYTE, pixels);
+
+    // GL counts the viewport from the bottom of the window.
+
+    gl.Viewport((GLint) (viewport.x * scale_x),
+                out_h - (GLint) ((viewport.y + viewport.h) * scale_y),
+                (GLsizei) (viewport.w * scale_x),
+                (GLsizei) (viewport.h * scale_y));
+
+    gl.UseProgram(program);
+    gl.Uniform2f(size_uniform, (GLfloat) width, (GLfloat) height);
+    gl.Uniform2f(upscale_uniform, (GLfloat) w_upscale, (GLfloat) h_upscale);
+
+    gl.Begin(GL_TRIANGLE_STRIP);
+    gl.TexCoord2f(0.0f, 1.0f);
+    gl.Vertex2f(-1.0f, -1.0f);
+    gl.TexCoord2f(1.0f, 1.0f);
+    gl.Vertex2f(1.0f, -1.0f);
+    gl.TexCoord2f(0.0f, 0.0f);
+    gl.Vertex2f(-1.0f, 1.0f);
+    gl.TexCoord2f(1.0f, 0.0f);
+    gl.Vertex2f(1.0f, 1.0f);
+    gl.End();
+
+    gl.UseProgram(old_program);
+    gl.PopClientAttrib();
+    gl.PopAttrib();
+    gl.ActiveTexture(old_active);
+}
@@ -0,0 +1,39 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Paletted frames drawn with OpenGL: the 8-bit frame is uploaded
+//	as it is and a shader looks its colours up in the palette.
+//
+
+#ifndef __I_VIDEOGL__
+#define __I_VIDEOGL__
+
+#include "SDL.h"
+
+#include "doomtype.h"
+
+// True if the renderer is SDL's OpenGL one and the shader could be built.
+// Must be called again whenever the renderer is recreated.
+boolean I_GL_InitPalette(SDL_Renderer *renderer);
+
+// Takes effect on the next frame drawn.
+void I_GL_SetPalette(const SDL_Color *palette);
+
+// Draw the frame into the renderer's viewport. With upscale factors of 0
+// pixels are scaled with "nearest"; otherwise the result matches scaling
+// up by those whole factors and then down to the window with "linear".
+void I_GL_DrawFrame(SDL_Renderer *renderer, const byte *pixels, int pitch,
+                    int width, int height, int w_upscale, int h_upscale);
+
+#endif
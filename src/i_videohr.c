@@ -16,6 +16,8 @@
 //     for Hexen startup loading screen.
 //
 
+#include <stdlib.h>
+
 #include "SDL.h"
 #include "string.h"
 
@@ -87,60 +89,87 @@ void I_ClearScreenHR(void)
     SDL_FillRect(hr_surface, &area, 0);
 }
 
-void I_SlamBlockHR(int x, int y, int w, int h, const byte *src)
-{
-    SDL_Rect blit_rect;
-    const byte *srcptrs[4];
-    byte srcbits[4];
-    byte *dest;
-    int x1, y1;
-    int i;
-    int bit;
+// [AP] planar_spread[b] has bit 7 - i of b in byte i, so ORing the
+// spreads of the four plane bytes, shifted by plane, gives eight chunky
+// pixels at once.
 
-    // Set up source pointers to read from source buffer - each 4-bit 
-    // pixel has its bits split into four sub-buffers
+static uint64_t planar_spread[256];
+static boolean planar_spread_ready = false;
 
-    for (i=0; i<4; ++i)
-    {
-        srcptrs[i] = src + (i * w * h / 8);
-    }
+static void InitPlanarSpread(void)
+{
+    byte pixels[8];
+    int b, i;
 
-    if (SDL_LockSurface(hr_surface) < 0)
+    for (b = 0; b < 256; ++b)
     {
-        return;
+        for (i = 0; i < 8; ++i)
+        {
+            pixels[i] = (b >> (7 - i)) & 0x1;
+        }
+
+        memcpy(&planar_spread[b], pixels, sizeof(pixels));
     }
 
-    // Draw each pixel
+    planar_spread_ready = true;
+}
+
+// Convert w * h planar pixels to one byte per pixel. Pixels run on from
+// one row to the next in the planes, so this doesn't care about rows.
 
-    bit = 0;
+static void PlanarToChunky(byte *dest, const byte *src, int w, int h)
+{
+    const int plane_size = w * h / 8;
+    const byte *src0 = src;
+    const byte *src1 = src + plane_size;
+    const byte *src2 = src + plane_size * 2;
+    const byte *src3 = src + plane_size * 3;
+    uint64_t pixels;
+    int i;
 
-    for (y1=y; y1<y+h; ++y1)
+    if (!planar_spread_ready)
     {
-        dest = ((byte *) hr_surface->pixels) + y1 * hr_surface->pitch + x;
+        InitPlanarSpread();
+    }
 
-        for (x1=x; x1<x+w; ++x1)
-        {
-            // Get the bits for this pixel
-            // For each bit, find the byte containing it, shift down
-            // and mask out the specific bit wanted.
+    for (i = 0; i < plane_size; ++i)
+    {
+        pixels = planar_spread[src0[i]]
+               | (planar_spread[src1[i]] << 1)
+               | (planar_spread[src2[i]] << 2)
+               | (planar_spread[src3[i]] << 3);
 
-            for (i=0; i<4; ++i)
-            {
-                srcbits[i] = (srcptrs[i][bit / 8] >> (7 - (bit % 8))) & 0x1;
-            }
+        memcpy(dest + i * 8, &pixels, sizeof(pixels));
+    }
+}
 
-            // Reassemble the pixel value
+byte *I_ConvertBlockHR(int w, int h, const byte *src)
+{
+    byte *chunky = malloc(w * h);
 
-            *dest = (srcbits[0] << 0) 
-                  | (srcbits[1] << 1)
-                  | (srcbits[2] << 2)
-                  | (srcbits[3] << 3);
+    if (chunky != NULL)
+    {
+        PlanarToChunky(chunky, src, w, h);
+    }
 
-            // Next pixel!
+    return chunky;
+}
 
-            ++dest;
-            ++bit;
-        }
+void I_DrawBlockHR(int x, int y, int w, int h, const byte *chunky)
+{
+    SDL_Rect blit_rect;
+    byte *dest;
+    int y1;
+
+    if (SDL_LockSurface(hr_surface) < 0)
+    {
+        return;
+    }
+
+    for (y1 = 0; y1 < h; ++y1)
+    {
+        dest = ((byte *) hr_surface->pixels) + (y + y1) * hr_surface->pitch + x;
+        memcpy(dest, chunky + y1 * w, w);
     }
 
     SDL_UnlockSurface(hr_surface);
@@ -155,6 +184,17 @@ void I_SlamBlockHR(int x, int y, int w, int h, const byte *src)
     SDL_UpdateWindowSurfaceRects(hr_screen, &blit_rect, 1);
 }
 
+void I_SlamBlockHR(int x, int y, int w, int h, const byte *src)
+{
+    byte *chunky = I_ConvertBlockHR(w, h, src);
+
+    if (chunky != NULL)
+    {
+        I_DrawBlockHR(x, y, w, h, chunky);
+        free(chunky);
+    }
+}
+
 void I_SlamHR(const byte *buffer)
 {
     I_SlamBlockHR(0, 0, HR_SCREENWIDTH, HR_SCREENHEIGHT, buffer);
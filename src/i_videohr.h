@@ -24,6 +24,11 @@ void I_UnsetVideoModeHR(void);
 void I_SetWindowTitleHR(const char *title);
 void I_ClearScreenHR(void);
 void I_SlamBlockHR(int x, int y, int w, int h, const byte *src);
+
+// [AP] For blocks drawn more than once: convert the planar data once,
+// into a buffer to free() when done, and draw that.
+byte *I_ConvertBlockHR(int w, int h, const byte *src);
+void I_DrawBlockHR(int x, int y, int w, int h, const byte *chunky);
 void I_SlamHR(const byte *buffer);
 void I_InitPaletteHR(void);
 void I_SetPaletteHR(const byte *palette);
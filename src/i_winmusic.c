@@ -29,8 +29,6 @@
 #include "i_sound.h"
 #include "i_system.h"
 #include "m_misc.h"
-#include "memio.h"
-#include "mus2mid.h"
 #include "midifile.h"
 #include "midifallback.h"
 
@@ -82,7 +80,6 @@ static DWORD tempo;
 
 static UINT MidiDevice;
 static HMIDISTRM hMidiStream;
-static MIDIHDR MidiStreamHdr;
 static HANDLE hBufferReturnEvent;
 static HANDLE hExitEvent;
 static HANDLE hPlayerThread;
@@ -132,20 +129,27 @@ typedef struct
 
 static win_midi_song_t song;
 
-#define BUFFER_INITIAL_SIZE 1024
+// [AP] Two buffers, so the device always has one queued while the other
+// is being filled; with one, it sat idle between buffers and fell behind
+// on busy songs. Each holds about STREAM_BLOCK_MS of the song, which is
+// also how long a volume change can take to be heard.
+
+#define STREAM_NUM_BUFFERS  2
+#define BUFFER_INITIAL_SIZE (64 * 1024)
 
 typedef struct
 {
     byte *data;
     unsigned int size;
     unsigned int position;
+    MIDIHDR hdr;
 } buffer_t;
 
-static buffer_t buffer;
-
-// Maximum of 4 events in the buffer for faster volume updates.
+static buffer_t buffers[STREAM_NUM_BUFFERS];
+static buffer_t *buffer = &buffers[0];
 
-#define STREAM_MAX_EVENTS   4
+#define STREAM_BLOCK_MS     50
+#define STREAM_MAX_EVENTS   1024
 
 #define MAKE_EVT(a, b, c, d) ((DWORD)((a) | ((b) << 8) | ((c) << 16) | ((d) << 24)))
 
@@ -187,10 +191,10 @@ static void CALLBACK MidiStreamProc(HMIDIOUT hMidi, UINT uMsg,
 
 static void AllocateBuffer(const unsigned int size)
 {
-    MIDIHDR *hdr = &MidiStreamHdr;
+    MIDIHDR *hdr = &buffer->hdr;
     MMRESULT mmr;
 
-    if (buffer.data)
+    if (buffer->data)
     {
         mmr = midiOutUnprepareHeader((HMIDIOUT)hMidiStream, hdr, sizeof(MIDIHDR));
         if (mmr != MMSYSERR_NOERROR)
@@ -199,12 +203,12 @@ static void AllocateBuffer(const unsigned int size)
         }
     }
 
-    buffer.size = PADDED_SIZE(size);
-    buffer.data = I_Realloc(buffer.data, buffer.size);
+    buffer->size = PADDED_SIZE(size);
+    buffer->data = I_Realloc(buffer->data, buffer->size);
 
-    hdr->lpData = (LPSTR)buffer.data;
+    hdr->lpData = (LPSTR)buffer->data;
     hdr->dwBytesRecorded = 0;
-    hdr->dwBufferLength = buffer.size;
+    hdr->dwBufferLength = buffer->size;
     mmr = midiOutPrepareHeader((HMIDIOUT)hMidiStream, hdr, sizeof(MIDIHDR));
     if (mmr != MMSYSERR_NOERROR)
     {
@@ -214,29 +218,29 @@ static void AllocateBuffer(const unsigned int size)
 
 static void WriteBufferPad(void)
 {
-    unsigned int padding = PADDED_SIZE(buffer.position);
-    memset(buffer.data + buffer.position, 0, padding - buffer.position);
-    buffer.position = padding;
+    unsigned int padding = PADDED_SIZE(buffer->position);
+    memset(buffer->data + buffer->position, 0, padding - buffer->position);
+    buffer->position = padding;
 }
 
 static void WriteBuffer(const byte *ptr, unsigned int size)
 {
-    if (buffer.position + size >= buffer.size)
+    if (buffer->position + size >= buffer->size)
     {
-        AllocateBuffer(size + buffer.size * 2);
+        AllocateBuffer(size + buffer->size * 2);
     }
 
-    memcpy(buffer.data + buffer.position, ptr, size);
-    buffer.position += size;
+    memcpy(buffer->data + buffer->position, ptr, size);
+    buffer->position += size;
 }
 
 static void StreamOut(void)
 {
-    MIDIHDR *hdr = &MidiStreamHdr;
+    MIDIHDR *hdr = &buffer->hdr;
     MMRESULT mmr;
 
-    hdr->lpData = (LPSTR)buffer.data;
-    hdr->dwBytesRecorded = buffer.position;
+    hdr->lpData = (LPSTR)buffer->data;
+    hdr->dwBytesRecorded = buffer->position;
 
     mmr = midiStreamOut(hMidiStream, hdr, sizeof(MIDIHDR));
     if (mmr != MMSYSERR_NOERROR)
@@ -1036,12 +1040,18 @@ static boolean IsRPGLoop(void)
     return (num_rpg_events == 1 && num_emidi_events == 0);
 }
 
-static void FillBuffer(void)
+// Fills the current buffer and queues it. Returns false if there was
+// nothing left to play.
+
+static boolean FillBuffer(void)
 {
     unsigned int i;
     int num_events;
+    unsigned int block_ticks = 0;
+    const unsigned int max_block_ticks =
+        (float)STREAM_BLOCK_MS * 1000 * timediv / tempo + 0.5f;
 
-    buffer.position = 0;
+    buffer->position = 0;
 
     if (initial_playback)
     {
@@ -1049,7 +1059,7 @@ static void FillBuffer(void)
         StreamOut();
         song.rpg_loop = IsRPGLoop();
         initial_playback = false;
-        return;
+        return true;
     }
 
     if (update_volume)
@@ -1057,7 +1067,7 @@ static void FillBuffer(void)
         update_volume = false;
         UpdateVolume();
         StreamOut();
-        return;
+        return true;
     }
 
     for (num_events = 0; num_events < STREAM_MAX_EVENTS; )
@@ -1138,16 +1148,48 @@ static void FillBuffer(void)
         if (!AddToBuffer(delta_time, event, track))
         {
             StreamOut();
-            return;
+            return true;
         }
 
         num_events++;
+
+        // [AP] Enough queued, leave the rest for the next buffer.
+        block_ticks += delta_time;
+        if (block_ticks >= max_block_ticks)
+        {
+            break;
+        }
     }
 
     if (num_events)
     {
         StreamOut();
     }
+
+    return num_events > 0;
+}
+
+// [AP] The return event is set once however many buffers came back, so
+// refill every one that isn't queued.
+
+static void FillBuffers(void)
+{
+    int i;
+
+    for (i = 0; i < STREAM_NUM_BUFFERS; ++i)
+    {
+        if (buffers[i].hdr.dwFlags & MHDR_INQUEUE)
+        {
+            continue;
+        }
+
+        buffer = &buffers[i];
+
+        if (!FillBuffer())
+        {
+            break;
+        }
+    }
 }
 
 // The Windows API documentation states: "Applications should not call any
@@ -1163,7 +1205,7 @@ static DWORD WINAPI PlayerProc(void)
         switch (WaitForMultipleObjects(2, events, FALSE, INFINITE))
         {
             case WAIT_OBJECT_0:
-                FillBuffer();
+                FillBuffers();
                 break;
 
             case WAIT_OBJECT_0 + 1:
@@ -1234,7 +1276,11 @@ static boolean I_WIN_InitMusic(void)
         return false;
     }
 
-    AllocateBuffer(BUFFER_INITIAL_SIZE);
+    for (i = 0; i < STREAM_NUM_BUFFERS; ++i)
+    {
+        buffer = &buffers[i];
+        AllocateBuffer(BUFFER_INITIAL_SIZE);
+    }
 
     hBufferReturnEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
     hExitEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
@@ -1263,6 +1309,7 @@ static void I_WIN_SetMusicVolume(int volume)
 
 static void I_WIN_StopSong(void)
 {
+    int i;
     MMRESULT mmr;
 
     if (!hPlayerThread)
@@ -1280,6 +1327,13 @@ static void I_WIN_StopSong(void)
     {
         MidiError("midiStreamStop", mmr);
     }
+
+    // [AP] As at shutdown, the flag can outlive midiStreamStop(), and
+    // FillBuffers() would never queue a buffer that still has it.
+    for (i = 0; i < STREAM_NUM_BUFFERS; ++i)
+    {
+        buffers[i].hdr.dwFlags &= ~MHDR_INQUEUE;
+    }
 }
 
 static void I_WIN_PlaySong(void *handle, boolean looping)
@@ -1325,62 +1379,21 @@ static void I_WIN_ResumeSong(void)
     }
 }
 
-static boolean ConvertMus(byte *musdata, int len, const char *filename)
-{
-    MEMFILE *instream;
-    MEMFILE *outstream;
-    void *outbuf;
-    size_t outbuf_len;
-    int result;
-
-    instream = mem_fopen_read(musdata, len);
-    outstream = mem_fopen_write();
-
-    result = mus2mid(instream, outstream);
-
-    if (result == 0)
-    {
-        mem_get_buf(outstream, &outbuf, &outbuf_len);
-
-        M_WriteFile(filename, outbuf, outbuf_len);
-    }
-
-    mem_fclose(instream);
-    mem_fclose(outstream);
-
-    return result;
-}
-
 static void *I_WIN_RegisterSong(void *data, int len)
 {
     unsigned int i;
-    char *filename;
+    byte *midi;
+    size_t midi_len;
     midi_file_t *file;
 
     MIDIPROPTIMEDIV prop_timediv;
     MIDIPROPTEMPO prop_tempo;
     MMRESULT mmr;
 
-    // MUS files begin with "MUS"
-    // Reject anything which doesnt have this signature
-
-    filename = M_TempFile("doom.mid");
-
-    if (IsMid(data, len))
-    {
-        M_WriteFile(filename, data, len);
-    }
-    else
-    {
-        // Assume a MUS file and try to convert
-
-        ConvertMus(data, len, filename);
-    }
-
-    file = MIDI_LoadFile(filename);
-
-    M_remove(filename);
-    free(filename);
+    // [AP] MUS comes converted from the cache, and is read from memory
+    // rather than a temporary file.
+    midi = I_SongMidi(data, len, &midi_len);
+    file = midi != NULL ? MIDI_LoadMemory(midi, midi_len) : NULL;
 
     if (file == NULL)
     {
@@ -1454,6 +1467,7 @@ static void I_WIN_UnRegisterSong(void *handle)
 
 static void I_WIN_ShutdownMusic(void)
 {
+    int i;
     MMRESULT mmr;
 
     if (!hMidiStream)
@@ -1465,7 +1479,8 @@ static void I_WIN_ShutdownMusic(void)
     I_WIN_UnRegisterSong(NULL);
 
     // Reset device at shutdown.
-    buffer.position = 0;
+    buffer = &buffers[0];
+    buffer->position = 0;
     ResetDevice();
     StreamOut();
     mmr = midiStreamRestart(hMidiStream);
@@ -1480,22 +1495,29 @@ static void I_WIN_ShutdownMusic(void)
         MidiError("midiStreamStop", mmr);
     }
 
-    if (buffer.data)
+    for (i = 0; i < STREAM_NUM_BUFFERS; ++i)
     {
+        buffer = &buffers[i];
+
+        if (!buffer->data)
+        {
+            continue;
+        }
+
         // Windows doesn't always immediately clear the MHDR_INQUEUE flag, even
         // after midiStreamStop() is called. There doesn't seem to be any side
         // effect to just forcing the flag off.
-        MidiStreamHdr.dwFlags &= ~MHDR_INQUEUE;
-        mmr = midiOutUnprepareHeader((HMIDIOUT)hMidiStream, &MidiStreamHdr,
+        buffer->hdr.dwFlags &= ~MHDR_INQUEUE;
+        mmr = midiOutUnprepareHeader((HMIDIOUT)hMidiStream, &buffer->hdr,
                                      sizeof(MIDIHDR));
         if (mmr != MMSYSERR_NOERROR)
         {
             MidiError("midiOutUnprepareHeader", mmr);
         }
-        free(buffer.data);
-        buffer.data = NULL;
-        buffer.size = 0;
-        buffer.position = 0;
+        free(buffer->data);
+        buffer->data = NULL;
+        buffer->size = 0;
+        buffer->position = 0;
     }
 
     mmr = midiStreamClose(hMidiStream);
@@ -100,6 +100,11 @@ typedef struct
     default_t *defaults;
     int numdefaults;
     const char *filename;
+
+    // [AP] Open addressing index of defaults by name, built on the first
+    // search. Slots hold index + 1, 0 is empty.
+    int *hash;
+    int hashsize;
 } default_collection_t;
 
 #define CONFIG_VARIABLE_GENERIC(name, type) \
@@ -844,6 +849,14 @@ static default_t extra_defaults_list[] =
 
     CONFIG_VARIABLE_INT(force_software_renderer),
 
+    //!
+    // [AP] If non-zero, ask SDL for its OpenGL renderer and have a shader
+    // look up the palette, instead of converting each frame on the CPU.
+    // Has no effect with other renderers or in true color builds.
+    //
+
+    CONFIG_VARIABLE_INT(gpu_palette),
+
     //!
     // Maximum number of pixels to use for intermediate scaling buffer.
     // More pixels mean that the screen can be rendered more precisely,
@@ -894,6 +907,12 @@ static default_t extra_defaults_list[] =
 
     CONFIG_VARIABLE_INT(png_screenshots),
 
+    //!
+    // Number of consecutive frames saved each time a screenshot is taken.
+    //
+
+    CONFIG_VARIABLE_INT(screenshot_burst),
+
     //!
     // Vertical mouse acceleration factor.  When the speed of mouse movement
     // exceeds the threshold value (mouse_threshold), the speed is
@@ -942,6 +961,44 @@ static default_t extra_defaults_list[] =
 
     CONFIG_VARIABLE_INT(snd_pitchshift),
 
+    //!
+    // If non-zero, sound effects converted with libsamplerate are saved
+    // to the sfxcache directory in the configuration directory and
+    // reused by later sessions with the same output settings.
+    //
+
+    CONFIG_VARIABLE_INT(snd_sfxdiskcache),
+
+    //!
+    // If non-zero, sound effects are converted on a background thread
+    // at startup instead of before the game starts.
+    //
+
+    CONFIG_VARIABLE_INT(snd_precachethread),
+
+    //!
+    // If non-zero, each song played through OPL emulation is recorded
+    // the first time it loops and replayed from the recording afterwards.
+    //
+
+    CONFIG_VARIABLE_INT(snd_oplmusiccache),
+
+    //!
+    // If non-zero, sound effects are mixed by the game itself instead of
+    // SDL_mixer, which allows up to 256 sound channels (snd_channels) at
+    // little extra cost.
+    //
+
+    CONFIG_VARIABLE_INT(snd_softmixer),
+
+    //!
+    // If non-zero, MUS music lumps converted to MIDI are saved to the
+    // midicache directory in the configuration directory and reused by
+    // later sessions.
+    //
+
+    CONFIG_VARIABLE_INT(snd_mididiskcache),
+
     //!
     // External command to invoke to perform MIDI playback. If set to
     // the empty string, SDL_mixer's internal MIDI playback is used.
@@ -1011,6 +1068,13 @@ static default_t extra_defaults_list[] =
     CONFIG_VARIABLE_STRING(music_pack_path),
 
 #ifdef HAVE_FLUIDSYNTH
+    //!
+    // [AP] Number of frames FluidSynth renders at a time when it renders
+    // ahead, see fsynth_latency. Default is 256, range is 64 - 8192.
+    //
+
+    CONFIG_VARIABLE_INT(fsynth_block_size),
+
     //!
     // If 1, activate the FluidSynth chorus effects module. If 0, no chorus
     // will be added to the output signal.
@@ -1046,6 +1110,14 @@ static default_t extra_defaults_list[] =
 
     CONFIG_VARIABLE_FLOAT(fsynth_chorus_speed),
 
+    //!
+    // [AP] How far ahead FluidSynth renders, in milliseconds, on a thread
+    // of its own. Raise it if large soundfonts stutter. If 0, FluidSynth
+    // renders in the audio callback instead.
+    //
+
+    CONFIG_VARIABLE_INT(fsynth_latency),
+
     //!
     // This setting defines how FluidSynth interprets Bank Select messages. The
     // default is "gs". Other possible values are "gm", "xg" and "mma".
@@ -2271,6 +2343,15 @@ static default_t extra_defaults_list[] =
 
     CONFIG_VARIABLE_INT(crispy_ap_levelselectmusic),
 
+    //!
+    // @game doom
+    //
+    // Target frame time in milliseconds. While drawing a frame takes
+    // longer, the 3D view drops to low detail. 0 turns it off.
+    //
+
+    CONFIG_VARIABLE_INT(crispy_ap_dynamicdetail),
+
     //!
     // @game doom
     //
@@ -2497,18 +2578,67 @@ static default_collection_t extra_defaults =
     NULL,
 };
 
+// [AP] FNV-1a of a variable name
+
+static unsigned int HashDefaultName(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*name != '\0')
+    {
+        hash = (hash ^ (unsigned char) *name++) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void BuildCollectionHash(default_collection_t *collection)
+{
+    int i;
+
+    // Power of two, at most half full
+    collection->hashsize = 16;
+    while (collection->hashsize < collection->numdefaults * 2)
+    {
+        collection->hashsize *= 2;
+    }
+    collection->hash = calloc(collection->hashsize, sizeof(*collection->hash));
+
+    for (i = 0; i < collection->numdefaults; ++i)
+    {
+        unsigned int slot = HashDefaultName(collection->defaults[i].name)
+                          & (collection->hashsize - 1);
+
+        while (collection->hash[slot] != 0)
+        {
+            slot = (slot + 1) & (collection->hashsize - 1);
+        }
+        collection->hash[slot] = i + 1;
+    }
+}
+
 // Search a collection for a variable
 
 static default_t *SearchCollection(default_collection_t *collection, const char *name)
 {
-    int i;
+    unsigned int slot;
+
+    if (collection->hash == NULL)
+    {
+        BuildCollectionHash(collection);
+    }
+
+    slot = HashDefaultName(name) & (collection->hashsize - 1);
 
-    for (i=0; i<collection->numdefaults; ++i) 
+    while (collection->hash[slot] != 0)
     {
-        if (!strcmp(name, collection->defaults[i].name))
+        default_t *def = &collection->defaults[collection->hash[slot] - 1];
+
+        if (!strcmp(name, def->name))
         {
-            return &collection->defaults[i];
+            return def;
         }
+        slot = (slot + 1) & (collection->hashsize - 1);
     }
 
     return NULL;
@@ -2745,9 +2875,11 @@ static void LoadDefaultCollection(default_collection_t *collection)
     default_t *def;
     char defname[80];
     char strparm[100];
+    char *buf, *p;
+    long length;
 
     // read the file in, overriding any set defaults
-    f = M_fopen(collection->filename, "r");
+    f = M_fopen(collection->filename, "rb");
 
     if (f == NULL)
     {
@@ -2757,14 +2889,47 @@ static void LoadDefaultCollection(default_collection_t *collection)
         return;
     }
 
-    while (!feof(f))
+    // [AP] Read it in one go and parse the buffer, rather than a scanf
+    // call per line
+    length = M_FileLength(f);
+    if (length < 0)
+    {
+        length = 0;
+    }
+    buf = malloc(length + 1);
+    length = (long) fread(buf, 1, length, f);
+    buf[length] = '\0';
+    fclose (f);
+
+    p = buf;
+
+    for (;;)
     {
-        if (fscanf(f, "%79s %99[^\n]\n", defname, strparm) != 2)
+        size_t len;
+
+        // Same fields as "%79s %99[^\n]\n": a name, then the rest of
+        // the line
+        while (*p != '\0' && isspace((unsigned char) *p)) ++p;
+        if (*p == '\0') break;
+
+        len = 0;
+        while (*p != '\0' && !isspace((unsigned char) *p))
         {
-            // This line doesn't match
+            if (len < sizeof(defname) - 1) defname[len++] = *p;
+            ++p;
+        }
+        defname[len] = '\0';
 
-            continue;
+        while (*p != '\0' && isspace((unsigned char) *p)) ++p;
+        if (*p == '\0') break;
+
+        len = 0;
+        while (*p != '\0' && *p != '\n')
+        {
+            if (len < sizeof(strparm) - 1) strparm[len++] = *p;
+            ++p;
         }
+        strparm[len] = '\0';
 
         // Find the setting in the list
 
@@ -2781,23 +2946,23 @@ static void LoadDefaultCollection(default_collection_t *collection)
         // Strip off trailing non-printable characters (\r characters
         // from DOS text files)
 
-        while (strlen(strparm) > 0 && !isprint(strparm[strlen(strparm)-1]))
+        while (len > 0 && !isprint((unsigned char) strparm[len - 1]))
         {
-            strparm[strlen(strparm)-1] = '\0';
+            strparm[--len] = '\0';
         }
 
         // Surrounded by quotes? If so, remove them.
-        if (strlen(strparm) >= 2
-         && strparm[0] == '"' && strparm[strlen(strparm) - 1] == '"')
+        if (len >= 2
+         && strparm[0] == '"' && strparm[len - 1] == '"')
         {
-            strparm[strlen(strparm) - 1] = '\0';
+            strparm[len - 1] = '\0';
             memmove(strparm, strparm + 1, sizeof(strparm) - 1);
         }
 
         SetVariable(def, strparm);
     }
 
-    fclose (f);
+    free(buf);
 }
 
 // Set the default filenames to use for configuration files.
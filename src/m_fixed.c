@@ -38,6 +38,26 @@ FixedMul
     return ((int64_t) a * (int64_t) b) >> FRACBITS;
 }
 
+void FixedMulN(fixed_t *dest, const fixed_t *a, const fixed_t *b, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+	dest[i] = ((int64_t) a[i] * (int64_t) b[i]) >> FRACBITS;
+    }
+}
+
+void FixedMulScalarN(fixed_t *dest, const fixed_t *a, fixed_t b, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+	dest[i] = ((int64_t) a[i] * (int64_t) b) >> FRACBITS;
+    }
+}
+
 
 
 //
@@ -35,6 +35,12 @@ typedef int fixed_t;
 fixed_t FixedMul	(fixed_t a, fixed_t b);
 fixed_t FixedDiv	(fixed_t a, fixed_t b);
 
+// [AP] FixedMul over arrays, dest[i] = a[i] * b[i] or a[i] * b. Plain
+// loops without calls, so compilers can vectorize them. The results are
+// those of FixedMul, and dest may be a.
+void FixedMulN		(fixed_t *dest, const fixed_t *a, const fixed_t *b, int n);
+void FixedMulScalarN	(fixed_t *dest, const fixed_t *a, fixed_t b, int n);
+
 
 
 #endif
@@ -0,0 +1,197 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Low memory profile, and a report of where memory goes.
+//
+
+#include <stdio.h>
+#include <signal.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define PSAPI_VERSION 2 // K32GetProcessMemoryInfo, in kernel32
+#include <psapi.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "i_system.h"
+#include "m_argv.h"
+#include "m_memory.h"
+
+#define MAX_MEMORY_USERS 16
+
+typedef struct
+{
+    const char *name;
+    m_memory_bytes_t bytes;
+    m_memory_purge_t purge;
+} memory_user_t;
+
+static memory_user_t memory_users[MAX_MEMORY_USERS];
+static int num_memory_users = 0;
+
+static int low_memory = -1;
+
+static boolean report_initted = false;
+static volatile sig_atomic_t report_wanted = 0;
+
+boolean M_LowMemory(void)
+{
+    if (low_memory < 0)
+    {
+        //!
+        // @category obscure
+        //
+        // Use less memory, for handhelds and other small machines: a
+        // smaller zone heap, smaller texture, patch and sound caches, and
+        // caches emptied between levels. Sounds are loaded as they're
+        // played rather than all at startup.
+        //
+
+        low_memory = M_ParmExists("-lowmem");
+    }
+
+    return low_memory;
+}
+
+void M_AddMemoryUser(const char *name, m_memory_bytes_t bytes,
+                     m_memory_purge_t purge)
+{
+    if (num_memory_users == MAX_MEMORY_USERS)
+    {
+        return;
+    }
+
+    memory_users[num_memory_users].name = name;
+    memory_users[num_memory_users].bytes = bytes;
+    memory_users[num_memory_users].purge = purge;
+    ++num_memory_users;
+}
+
+void M_TrimMemory(void)
+{
+    int i;
+
+    if (!M_LowMemory())
+    {
+        return;
+    }
+
+    for (i = 0; i < num_memory_users; ++i)
+    {
+        if (memory_users[i].purge != NULL)
+        {
+            memory_users[i].purge();
+        }
+    }
+}
+
+// Resident set size of the process, or 0 where it can't be found.
+
+static size_t ResidentBytes(void)
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.WorkingSetSize;
+    }
+#elif defined(__linux__)
+    FILE *statm = fopen("/proc/self/statm", "r");
+    unsigned long pages_total, pages_resident;
+    size_t result = 0;
+
+    if (statm != NULL)
+    {
+        if (fscanf(statm, "%lu %lu", &pages_total, &pages_resident) == 2)
+        {
+            result = (size_t) pages_resident * sysconf(_SC_PAGESIZE);
+        }
+        fclose(statm);
+    }
+
+    return result;
+#endif
+
+    return 0;
+}
+
+void M_PrintMemoryReport(void)
+{
+    const size_t resident = ResidentBytes();
+    size_t total = 0;
+    size_t bytes;
+    int i;
+
+    printf("Memory report%s:\n", M_LowMemory() ? " (low memory profile)" : "");
+
+    for (i = 0; i < num_memory_users; ++i)
+    {
+        bytes = memory_users[i].bytes();
+        total += bytes;
+        printf("  %-20s %8.1f MiB\n", memory_users[i].name,
+               bytes / (1024.0 * 1024.0));
+    }
+
+    // The zone heap and the caches are counted as allocated, not as
+    // touched, so they can add up to more than what's resident.
+    if (resident > 0)
+    {
+        printf("  %-20s %8.1f MiB\n", "everything else",
+               resident > total ? (resident - total) / (1024.0 * 1024.0) : 0.0);
+        printf("  %-20s %8.1f MiB\n", "resident",
+               resident / (1024.0 * 1024.0));
+    }
+}
+
+#ifdef SIGUSR1
+static void RequestReport(int sig)
+{
+    report_wanted = 1;
+}
+#endif
+
+void M_CheckMemoryReport(void)
+{
+    if (!report_initted)
+    {
+        report_initted = true;
+
+#ifdef SIGUSR1
+        // kill -USR1 prints the report, there's no calling printf from
+        // the handler itself
+        signal(SIGUSR1, RequestReport);
+#endif
+
+        //!
+        // @category obscure
+        //
+        // Print how much memory the game's subsystems hold on exit.
+        //
+
+        if (M_ParmExists("-memreport"))
+        {
+            I_AtExit(M_PrintMemoryReport, true);
+        }
+    }
+
+    if (report_wanted)
+    {
+        report_wanted = 0;
+        M_PrintMemoryReport();
+    }
+}
@@ -0,0 +1,49 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Low memory profile, and a report of where memory goes.
+//
+
+#ifndef __M_MEMORY__
+#define __M_MEMORY__
+
+#include <stddef.h>
+
+#include "doomtype.h"
+
+// True with -lowmem. The zone starts smaller and the caches get smaller
+// budgets and are emptied between levels; nothing is left out, it's
+// loaded when it's needed instead of up front.
+boolean M_LowMemory(void);
+
+// Subsystems holding memory of their own add themselves here once, with
+// a function returning the bytes they hold, and optionally one that
+// frees what they can do without.
+typedef size_t (*m_memory_bytes_t)(void);
+typedef void (*m_memory_purge_t)(void);
+
+void M_AddMemoryUser(const char *name, m_memory_bytes_t bytes,
+                     m_memory_purge_t purge);
+
+// Empties the caches in the low memory profile, does nothing otherwise.
+// For between levels, when everything has to be loaded again anyway.
+void M_TrimMemory(void);
+
+// Prints the resident size and each subsystem's share to stdout.
+void M_PrintMemoryReport(void);
+
+// Called once a frame. Prints the report when SIGUSR1 asked for one.
+void M_CheckMemoryReport(void);
+
+#endif
@@ -0,0 +1,213 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Per-stage frame timers for the profiling overlay.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "i_system.h"
+#include "i_timer.h"
+#include "m_argv.h"
+#include "m_misc.h"
+#include "m_prof.h"
+
+boolean prof_enabled = false;
+
+static const char *const prof_names[NUMPROFSTAGES] =
+{
+    "BSP",
+    "PLANES",
+    "MASKED",
+    "HUD",
+    "BLIT",
+    "TICKER",
+    "AP",
+    "FRAME",
+};
+
+static uint64_t prof_start[NUMPROFSTAGES];
+static uint64_t prof_frame[NUMPROFSTAGES];
+static int prof_window[NUMPROFSTAGES][PROFWINDOW];
+static int prof_head, prof_count;
+
+static FILE *prof_csv = NULL;
+static unsigned int prof_frameno;
+static uint64_t prof_lastframe;
+
+static void M_ProfShutdown(void)
+{
+    if (prof_csv != NULL)
+    {
+        fclose(prof_csv);
+        prof_csv = NULL;
+    }
+}
+
+void M_ProfInit(void)
+{
+    int i;
+
+    //!
+    // @category obscure
+    //
+    // Time the stages of each frame and show them on an overlay.
+    //
+
+    prof_enabled = M_ParmExists("-profile");
+
+    //!
+    // @arg <file>
+    // @category obscure
+    //
+    // Like -profile, and also write the per-frame stage timings
+    // (in microseconds) to the given CSV file.
+    //
+
+    i = M_CheckParmWithArgs("-profilecsv", 1);
+
+    if (i > 0)
+    {
+        prof_csv = M_fopen(myargv[i + 1], "w");
+
+        if (prof_csv == NULL)
+        {
+            I_Error("M_ProfInit: Couldn't open '%s' for writing", myargv[i + 1]);
+        }
+
+        fprintf(prof_csv, "frame");
+        for (i = 0; i < NUMPROFSTAGES; i++)
+        {
+            fprintf(prof_csv, ",%s", prof_names[i]);
+        }
+        fprintf(prof_csv, "\n");
+
+        I_AtExit(M_ProfShutdown, true);
+        prof_enabled = true;
+    }
+}
+
+void M_ProfBegin(profstage_t stage)
+{
+    if (prof_enabled)
+    {
+        prof_start[stage] = I_GetTimeUS();
+    }
+}
+
+void M_ProfEnd(profstage_t stage)
+{
+    if (prof_enabled)
+    {
+        prof_frame[stage] += I_GetTimeUS() - prof_start[stage];
+    }
+}
+
+void M_ProfEndFrame(void)
+{
+    uint64_t now;
+    int i;
+
+    if (!prof_enabled)
+    {
+        return;
+    }
+
+    now = I_GetTimeUS();
+    if (prof_lastframe != 0)
+    {
+        prof_frame[PROF_FRAME] = now - prof_lastframe;
+    }
+    prof_lastframe = now;
+
+    for (i = 0; i < NUMPROFSTAGES; i++)
+    {
+        prof_window[i][prof_head] = (int) prof_frame[i];
+    }
+
+    if (prof_csv != NULL)
+    {
+        fprintf(prof_csv, "%u", prof_frameno);
+        for (i = 0; i < NUMPROFSTAGES; i++)
+        {
+            fprintf(prof_csv, ",%d", (int) prof_frame[i]);
+        }
+        fprintf(prof_csv, "\n");
+    }
+
+    memset(prof_frame, 0, sizeof(prof_frame));
+    prof_head = (prof_head + 1) % PROFWINDOW;
+    if (prof_count < PROFWINDOW)
+    {
+        prof_count++;
+    }
+    prof_frameno++;
+}
+
+const char *M_ProfStageName(profstage_t stage)
+{
+    return prof_names[stage];
+}
+
+void M_ProfStats(profstage_t stage, int *min_us, int *avg_us, int *max_us)
+{
+    int i, lo, hi, sum;
+
+    if (prof_count == 0)
+    {
+        *min_us = *avg_us = *max_us = 0;
+        return;
+    }
+
+    lo = hi = sum = prof_window[stage][0];
+    for (i = 1; i < prof_count; i++)
+    {
+        const int t = prof_window[stage][i];
+
+        if (t < lo)
+            lo = t;
+        if (t > hi)
+            hi = t;
+        sum += t;
+    }
+
+    *min_us = lo;
+    *avg_us = sum / prof_count;
+    *max_us = hi;
+}
+
+// Standard deviation over the window, to show frame pacing jitter.
+int M_ProfDeviation(profstage_t stage)
+{
+    int i, lo, avg, hi;
+    uint64_t sum = 0;
+
+    if (prof_count < 2)
+    {
+        return 0;
+    }
+
+    M_ProfStats(stage, &lo, &avg, &hi);
+
+    for (i = 0; i < prof_count; i++)
+    {
+        const int64_t d = prof_window[stage][i] - avg;
+
+        sum += d * d;
+    }
+
+    return (int) sqrt((double) sum / prof_count);
+}
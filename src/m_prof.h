@@ -0,0 +1,56 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Per-stage frame timers for the profiling overlay.
+//
+
+
+#ifndef __M_PROF__
+#define __M_PROF__
+
+#include "doomtype.h"
+
+typedef enum
+{
+    PROF_BSP,
+    PROF_PLANES,
+    PROF_MASKED,
+    PROF_HUD,
+    PROF_BLIT,
+    PROF_TICKER,
+    PROF_AP,
+    PROF_FRAME,     // time between frames, for pacing
+    NUMPROFSTAGES
+} profstage_t;
+
+// Number of frames the min/avg/max figures are taken over.
+#define PROFWINDOW 64
+
+extern boolean prof_enabled;
+
+void M_ProfInit(void);
+
+// Stages may be entered several times per frame; the time adds up.
+void M_ProfBegin(profstage_t stage);
+void M_ProfEnd(profstage_t stage);
+
+// Closes the current frame, pushing its totals into the rolling window
+// and the CSV dump.
+void M_ProfEndFrame(void);
+
+const char *M_ProfStageName(profstage_t stage);
+void M_ProfStats(profstage_t stage, int *min_us, int *avg_us, int *max_us);
+int M_ProfDeviation(profstage_t stage);
+
+#endif
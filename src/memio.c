@@ -150,6 +150,35 @@ int mem_fputs(const char *str, MEMFILE *stream)
 	return mem_fwrite(str, sizeof(char), strlen(str), stream);
 }
 
+// Read a line, like fgets()
+
+char *mem_fgets(char *str, int count, MEMFILE *stream)
+{
+	int i;
+
+	if (stream->mode != MODE_READ || count <= 0
+	 || stream->position >= stream->buflen)
+	{
+		return NULL;
+	}
+
+	for (i = 0; i < count - 1 && stream->position < stream->buflen; )
+	{
+		char c = (char) stream->buf[stream->position++];
+
+		str[i++] = c;
+
+		if (c == '\n')
+		{
+			break;
+		}
+	}
+
+	str[i] = '\0';
+
+	return str;
+}
+
 void mem_get_buf(MEMFILE *stream, void **buf, size_t *buflen)
 {
 	*buf = stream->buf;
@@ -192,7 +221,9 @@ int mem_fseek(MEMFILE *stream, signed long position, mem_rel_t whence)
 			return -1;
 	}
 
-	if (newpos < stream->buflen)
+	// Seeking to the very end is allowed, like fseek()
+
+	if (newpos <= stream->buflen)
 	{
 		stream->position = newpos;
 		return 0;
@@ -24,6 +24,7 @@
 #include "i_swap.h"
 #include "i_system.h"
 #include "m_misc.h"
+#include "memio.h"
 #include "midifile.h"
 
 #define HEADER_CHUNK_ID "MThd"
@@ -84,6 +85,10 @@ struct midi_file_s
     // Data buffer used to store data read for SysEx or meta events:
     byte *buffer;
     unsigned int buffer_size;
+
+    // Events of all tracks merged by time; see MIDI_GetEventStream():
+    midi_event_t *stream;
+    unsigned int stream_len;
 };
 
 // Check the header of a chunk:
@@ -109,28 +114,20 @@ static boolean CheckChunkHeader(chunk_header_t *chunk,
 
 // Read a single byte.  Returns false on error.
 
-static boolean ReadByte(byte *result, FILE *stream)
+static boolean ReadByte(byte *result, MEMFILE *stream)
 {
-    int c;
-
-    c = fgetc(stream);
-
-    if (c == EOF)
+    if (mem_fread(result, 1, 1, stream) < 1)
     {
         fprintf(stderr, "ReadByte: Unexpected end of file\n");
         return false;
     }
-    else
-    {
-        *result = (byte) c;
 
-        return true;
-    }
+    return true;
 }
 
 // Read a variable-length value.
 
-static boolean ReadVariableLength(unsigned int *result, FILE *stream)
+static boolean ReadVariableLength(unsigned int *result, MEMFILE *stream)
 {
     int i;
     byte b = 0;
@@ -166,7 +163,7 @@ static boolean ReadVariableLength(unsigned int *result, FILE *stream)
 
 // Read a byte sequence into the data buffer.
 
-static void *ReadByteSequence(unsigned int num_bytes, FILE *stream)
+static void *ReadByteSequence(unsigned int num_bytes, MEMFILE *stream)
 {
     unsigned int i;
     byte *result;
@@ -204,7 +201,7 @@ static void *ReadByteSequence(unsigned int num_bytes, FILE *stream)
 
 static boolean ReadChannelEvent(midi_event_t *event,
                                 byte event_type, boolean two_param,
-                                FILE *stream)
+                                MEMFILE *stream)
 {
     byte b = 0;
 
@@ -244,7 +241,7 @@ static boolean ReadChannelEvent(midi_event_t *event,
 // Read sysex event:
 
 static boolean ReadSysExEvent(midi_event_t *event, int event_type,
-                              FILE *stream)
+                              MEMFILE *stream)
 {
     event->event_type = event_type;
 
@@ -270,7 +267,7 @@ static boolean ReadSysExEvent(midi_event_t *event, int event_type,
 
 // Read meta event:
 
-static boolean ReadMetaEvent(midi_event_t *event, FILE *stream)
+static boolean ReadMetaEvent(midi_event_t *event, MEMFILE *stream)
 {
     byte b = 0;
 
@@ -309,7 +306,7 @@ static boolean ReadMetaEvent(midi_event_t *event, FILE *stream)
 }
 
 static boolean ReadEvent(midi_event_t *event, unsigned int *last_event_type,
-                         FILE *stream)
+                         MEMFILE *stream)
 {
     byte event_type = 0;
 
@@ -334,7 +331,7 @@ static boolean ReadEvent(midi_event_t *event, unsigned int *last_event_type,
     {
         event_type = *last_event_type;
 
-        if (fseek(stream, -1, SEEK_CUR) < 0)
+        if (mem_fseek(stream, -1, MEM_SEEK_CUR) < 0)
         {
             fprintf(stderr, "ReadEvent: Unable to seek in stream\n");
             return false;
@@ -413,12 +410,12 @@ static void FreeEvent(midi_event_t *event)
 
 // Read and check the track chunk header
 
-static boolean ReadTrackHeader(midi_track_t *track, FILE *stream)
+static boolean ReadTrackHeader(midi_track_t *track, MEMFILE *stream)
 {
     size_t records_read;
     chunk_header_t chunk_header;
 
-    records_read = fread(&chunk_header, sizeof(chunk_header_t), 1, stream);
+    records_read = mem_fread(&chunk_header, sizeof(chunk_header_t), 1, stream);
 
     if (records_read < 1)
     {
@@ -435,7 +432,7 @@ static boolean ReadTrackHeader(midi_track_t *track, FILE *stream)
     return true;
 }
 
-static boolean ReadTrack(midi_track_t *track, FILE *stream)
+static boolean ReadTrack(midi_track_t *track, MEMFILE *stream)
 {
     midi_event_t *new_events;
     midi_event_t *event;
@@ -499,7 +496,7 @@ static void FreeTrack(midi_track_t *track)
     free(track->events);
 }
 
-static boolean ReadAllTracks(midi_file_t *file, FILE *stream)
+static boolean ReadAllTracks(midi_file_t *file, MEMFILE *stream)
 {
     unsigned int i;
 
@@ -529,12 +526,12 @@ static boolean ReadAllTracks(midi_file_t *file, FILE *stream)
 
 // Read and check the header chunk.
 
-static boolean ReadFileHeader(midi_file_t *file, FILE *stream)
+static boolean ReadFileHeader(midi_file_t *file, MEMFILE *stream)
 {
     size_t records_read;
     unsigned int format_type;
 
-    records_read = fread(&file->header, sizeof(midi_header_t), 1, stream);
+    records_read = mem_fread(&file->header, sizeof(midi_header_t), 1, stream);
 
     if (records_read < 1)
     {
@@ -578,13 +575,16 @@ void MIDI_FreeFile(midi_file_t *file)
         free(file->tracks);
     }
 
+    // The stream shares its SysEx and meta data with the tracks.
+    free(file->stream);
+
     free(file);
 }
 
-midi_file_t *MIDI_LoadFile(char *filename)
+midi_file_t *MIDI_LoadMemory(void *data, size_t len)
 {
     midi_file_t *file;
-    FILE *stream;
+    MEMFILE *stream;
 
     file = malloc(sizeof(midi_file_t));
 
@@ -597,38 +597,67 @@ midi_file_t *MIDI_LoadFile(char *filename)
     file->num_tracks = 0;
     file->buffer = NULL;
     file->buffer_size = 0;
+    file->stream = NULL;
+    file->stream_len = 0;
 
-    // Open file
+    stream = mem_fopen_read(data, len);
 
-    stream = M_fopen(filename, "rb");
+    // Read MIDI file header
 
-    if (stream == NULL)
+    if (!ReadFileHeader(file, stream))
     {
-        fprintf(stderr, "MIDI_LoadFile: Failed to open '%s'\n", filename);
+        mem_fclose(stream);
         MIDI_FreeFile(file);
         return NULL;
     }
 
-    // Read MIDI file header
+    // Read all tracks:
 
-    if (!ReadFileHeader(file, stream))
+    if (!ReadAllTracks(file, stream))
     {
-        fclose(stream);
+        mem_fclose(stream);
         MIDI_FreeFile(file);
         return NULL;
     }
 
-    // Read all tracks:
+    mem_fclose(stream);
 
-    if (!ReadAllTracks(file, stream))
+    return file;
+}
+
+midi_file_t *MIDI_LoadFile(char *filename)
+{
+    midi_file_t *file;
+    FILE *stream;
+    byte *data;
+    long len;
+
+    // [AP] Read it in whole and parse it from memory
+
+    stream = M_fopen(filename, "rb");
+
+    if (stream == NULL)
     {
+        fprintf(stderr, "MIDI_LoadFile: Failed to open '%s'\n", filename);
+        return NULL;
+    }
+
+    len = M_FileLength(stream);
+    data = malloc(len > 0 ? len : 1);
+
+    if (data == NULL || (len > 0 && fread(data, 1, len, stream) != (size_t) len))
+    {
+        fprintf(stderr, "MIDI_LoadFile: Failed to read '%s'\n", filename);
+        free(data);
         fclose(stream);
-        MIDI_FreeFile(file);
         return NULL;
     }
 
     fclose(stream);
 
+    file = MIDI_LoadMemory(data, len);
+    free(data);
+
     return file;
 }
 
@@ -728,6 +757,133 @@ void MIDI_RestartAtLoopPoint(midi_track_iter_t *iter)
     iter->position = iter->loop_point;
 }
 
+// Merge the tracks of a file into a single stream of events.
+
+static boolean BuildEventStream(midi_file_t *file)
+{
+    unsigned int *position, *next_time;
+    unsigned int num_events, last_time, end_time;
+    unsigned int i, best;
+    midi_track_t *track;
+    midi_event_t *event;
+
+    num_events = 0;
+
+    for (i = 0; i < file->num_tracks; ++i)
+    {
+        num_events += file->tracks[i].num_events;
+    }
+
+    // Each track ends with an end of track event; these are replaced
+    // by a single one at the end of the stream.
+
+    file->stream = malloc(sizeof(midi_event_t) * (num_events + 1));
+    position = calloc(file->num_tracks, sizeof(unsigned int));
+    next_time = calloc(file->num_tracks, sizeof(unsigned int));
+
+    if (file->stream == NULL || position == NULL || next_time == NULL)
+    {
+        free(file->stream);
+        free(position);
+        free(next_time);
+        file->stream = NULL;
+        return false;
+    }
+
+    for (i = 0; i < file->num_tracks; ++i)
+    {
+        next_time[i] = file->tracks[i].events[0].delta_time;
+    }
+
+    file->stream_len = 0;
+    last_time = 0;
+    end_time = 0;
+
+    for (;;)
+    {
+        // Find the track with the earliest next event. On a tie the
+        // lower numbered track goes first.
+
+        best = file->num_tracks;
+
+        for (i = 0; i < file->num_tracks; ++i)
+        {
+            track = &file->tracks[i];
+
+            if (position[i] >= track->num_events)
+            {
+                continue;
+            }
+
+            event = &track->events[position[i]];
+
+            if (event->event_type == MIDI_EVENT_META
+             && event->data.meta.type == MIDI_META_END_OF_TRACK)
+            {
+                if (next_time[i] > end_time)
+                {
+                    end_time = next_time[i];
+                }
+
+                position[i] = track->num_events;
+                continue;
+            }
+
+            if (best == file->num_tracks || next_time[i] < next_time[best])
+            {
+                best = i;
+            }
+        }
+
+        if (best == file->num_tracks)
+        {
+            break;
+        }
+
+        track = &file->tracks[best];
+        event = &file->stream[file->stream_len];
+        *event = track->events[position[best]];
+        event->delta_time = next_time[best] - last_time;
+        last_time = next_time[best];
+        ++file->stream_len;
+
+        ++position[best];
+
+        if (position[best] < track->num_events)
+        {
+            next_time[best] += track->events[position[best]].delta_time;
+        }
+    }
+
+    // Finish with the end of the longest track.
+
+    event = &file->stream[file->stream_len];
+    event->delta_time = end_time > last_time ? end_time - last_time : 0;
+    event->event_type = MIDI_EVENT_META;
+    event->data.meta.type = MIDI_META_END_OF_TRACK;
+    event->data.meta.length = 0;
+    event->data.meta.data = NULL;
+    ++file->stream_len;
+
+    free(position);
+    free(next_time);
+
+    return true;
+}
+
+midi_event_t *MIDI_GetEventStream(midi_file_t *file,
+                                  unsigned int *num_events)
+{
+    if (file->stream == NULL && !BuildEventStream(file))
+    {
+        return NULL;
+    }
+
+    *num_events = file->stream_len;
+
+    return file->stream;
+}
+
 #ifdef TEST
 
 static char *MIDI_EventTypeToString(midi_event_type_t event_type)
@@ -173,6 +173,11 @@ typedef struct
 
 midi_file_t *MIDI_LoadFile(char *filename);
 
+// [AP] Load a MIDI file that's already in memory. Nothing refers to the
+// data once it returns.
+
+midi_file_t *MIDI_LoadMemory(void *data, size_t len);
+
 // Free a MIDI file.
 
 void MIDI_FreeFile(midi_file_t *file);
@@ -213,5 +218,13 @@ void MIDI_SetLoopPoint(midi_track_iter_t *iter);
 
 void MIDI_RestartAtLoopPoint(midi_track_iter_t *iter);
 
+// Get the events of all tracks merged into a single array, ordered by
+// time. The delta time of each event is relative to the previous event
+// in the array, and a single end of track event finishes it. The array
+// belongs to the file and is freed with it.
+
+midi_event_t *MIDI_GetEventStream(midi_file_t *file,
+                                  unsigned int *num_events);
+
 #endif /* #ifndef MIDIFILE_H */
 
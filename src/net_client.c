@@ -364,6 +364,14 @@ static void NET_CL_SendTics(int start, int end)
     NET_WriteInt8(packet, start & 0xff);
     NET_WriteInt8(packet, end - start + 1);
 
+    // [AP] Every tic carries the same latency, so the compact encoding
+    // only sends it once.
+
+    if (client_connection.protocol == NET_PROTOCOL_APDOOM_0)
+    {
+        NET_WriteInt16(packet, last_latency);
+    }
+
     // Add the tics.
 
     for (i=start; i<=end; ++i)
@@ -372,10 +380,16 @@ static void NET_CL_SendTics(int start, int end)
 
         sendobj = &send_queue[i % BACKUPTICS];
 
-        NET_WriteInt16(packet, last_latency);
+        if (client_connection.protocol != NET_PROTOCOL_APDOOM_0)
+        {
+            NET_WriteInt16(packet, last_latency);
+        }
 
         NET_WriteTiccmdDiff(packet, &sendobj->cmd, settings.lowres_turn);
     }
+
+    NET_Log("client: sending %d tics in %d bytes", end - start + 1,
+            (int) packet->len);
     
     // Send the packet
 
@@ -733,6 +747,8 @@ static void NET_CL_CheckResends(void)
 static void NET_CL_ParseGameData(net_packet_t *packet)
 {
     net_server_recv_t *recvobj;
+    net_full_ticcmd_t cmd, prev;
+    boolean result;
     unsigned int seq, num_tics;
     unsigned int nowtime;
     int resend_start, resend_end;
@@ -766,16 +782,27 @@ static void NET_CL_ParseGameData(net_packet_t *packet)
 
     for (i=0; i<num_tics; ++i)
     {
-        net_full_ticcmd_t cmd;
-
         index = seq - recvwindow_start + i;
 
-        if (!NET_ReadFullTiccmd(packet, &cmd, settings.lowres_turn))
+        if (client_connection.protocol == NET_PROTOCOL_APDOOM_0)
+        {
+            result = NET_ReadCompactFullTiccmd(packet, &cmd,
+                                               i > 0 ? &prev : NULL,
+                                               settings.lowres_turn);
+        }
+        else
+        {
+            result = NET_ReadFullTiccmd(packet, &cmd, settings.lowres_turn);
+        }
+
+        if (!result)
         {
             NET_Log("client: error: failed to read ticcmd %d", i);
             return;
         }
 
+        prev = cmd;
+
         if (index < 0 || index >= BACKUPTICS)
         {
             // Out of range of the recv window
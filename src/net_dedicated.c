@@ -28,6 +28,7 @@
 #include "net_common.h"
 #include "net_sdl.h"
 #include "net_server.h"
+#include "net_udp.h"
 
 // 
 // People can become confused about how dedicated servers work.  Game
@@ -67,14 +68,30 @@ void NET_DedicatedServer(void)
 
     NET_OpenLog();
     NET_SV_Init();
-    NET_SV_AddModule(&net_sdl_module);
+
+    //!
+    // @category net
+    //
+    // Run the dedicated server on SDL_net instead of the system's own
+    // sockets.
+    //
+
+    if (M_ParmExists("-sdlnet"))
+    {
+        NET_SV_AddModule(&net_sdl_module);
+    }
+    else
+    {
+        // [AP] Batches its sends and receives, and takes IPv6 too
+        NET_SV_AddModule(&net_udp_module);
+    }
+
     NET_SV_RegisterWithMaster();
 
     while (true)
     {
         NET_SV_Run();
-        // TODO: Block on socket instead of polling.
-        I_Sleep(1);
+        NET_SV_WaitForPacket();
     }
 }
 
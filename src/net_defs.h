@@ -48,6 +48,7 @@ typedef struct _net_module_s net_module_t;
 typedef struct _net_packet_s net_packet_t;
 typedef struct _net_addr_s net_addr_t;
 typedef struct _net_context_s net_context_t;
+typedef struct _net_packet_buffer_s net_packet_buffer_t;
 
 struct _net_packet_s
 {
@@ -55,6 +56,10 @@ struct _net_packet_s
     size_t len;
     size_t alloced;
     unsigned int pos;
+
+    // [AP] Reference counted storage for data, shared by duplicates of
+    // this packet until one of them is written to.
+    net_packet_buffer_t *buffer;
 };
 
 struct _net_module_s
@@ -88,6 +93,15 @@ struct _net_module_s
     // Try to resolve a name to an address
 
     net_addr_t *(*ResolveAddress)(const char *addr);
+
+    // [AP] Optional: block for up to timeout_ms until a packet arrives
+
+    void (*WaitPacket)(int timeout_ms);
+
+    // [AP] Optional: send any packets the module is holding back to send
+    // together
+
+    void (*FlushPackets)(void);
 };
 
 // net_addr_t
@@ -123,6 +137,11 @@ typedef enum
     // number in this enum.
     NET_PROTOCOL_CHOCOLATE_DOOM_0,
 
+    // [AP] As above, but with the compact game data encoding: tics sent
+    // to clients only carry what changed since the previous tic in the
+    // same packet, and clients send their latency once per packet.
+    NET_PROTOCOL_APDOOM_0,
+
     // Add your own protocol here; be sure to add a name for it to the list
     // in net_common.c too.
 
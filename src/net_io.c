@@ -19,6 +19,7 @@
 #include <stdio.h>
 
 #include "i_system.h"
+#include "i_timer.h"
 #include "net_defs.h"
 #include "net_io.h"
 #include "z_zone.h"
@@ -111,6 +112,36 @@ boolean NET_RecvPacket(net_context_t *context,
 // Note: this prints into a static buffer, calling again overwrites
 // the first result
 
+void NET_WaitForPacket(net_context_t *context, int timeout_ms)
+{
+    // [AP] Nothing waits on a reply to a packet that hasn't gone yet
+    NET_FlushPackets(context);
+
+    // Only a single module can be blocked on.
+
+    if (context->num_modules == 1 && context->modules[0]->WaitPacket != NULL)
+    {
+        context->modules[0]->WaitPacket(timeout_ms);
+    }
+    else
+    {
+        I_Sleep(1);
+    }
+}
+
+void NET_FlushPackets(net_context_t *context)
+{
+    int i;
+
+    for (i=0; i<context->num_modules; ++i)
+    {
+        if (context->modules[i]->FlushPackets != NULL)
+        {
+            context->modules[i]->FlushPackets();
+        }
+    }
+}
+
 char *NET_AddrToString(net_addr_t *addr)
 {
     static char buf[128];
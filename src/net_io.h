@@ -41,6 +41,15 @@ void NET_SendBroadcast(net_context_t *context, net_packet_t *packet);
 boolean NET_RecvPacket(net_context_t *context, net_addr_t **addr,
                        net_packet_t **packet);
 
+// [AP] Block for up to timeout_ms until a packet arrives for the given
+// context. If its modules cannot wait on their sockets, this just sleeps
+// briefly instead.
+void NET_WaitForPacket(net_context_t *context, int timeout_ms);
+
+// [AP] Send the packets the context's modules are holding back to batch.
+// Call once done sending for a while; NET_WaitForPacket also does this.
+void NET_FlushPackets(net_context_t *context);
+
 // Return a string representation of the given address. The result points to a
 // static buffer and will become invalid with the next call.
 char *NET_AddrToString(net_addr_t *addr);
@@ -25,7 +25,10 @@
 #include "net_loop.h"
 #include "net_packet.h"
 
-#define MAX_QUEUE_SIZE 16
+// [AP] Room for a burst of tic sets after a slow frame. On a real network
+// a packet that doesn't fit would be lost and sent again; there's no need
+// to pay for that locally.
+#define MAX_QUEUE_SIZE 64
 
 typedef struct
 {
@@ -38,10 +41,9 @@ static packet_queue_t server_queue;
 static net_addr_t client_addr;
 static net_addr_t server_addr;
 
-static void QueueInit(packet_queue_t *queue)
-{
-    queue->head = queue->tail = 0;
-}
+// [AP] The queue takes the packet given. Pushing a duplicate only copies
+// the header, the data is shared with the sender's packet (see
+// NET_PacketDup), so nothing is copied between the two ends.
 
 static void QueuePush(packet_queue_t *queue, net_packet_t *packet)
 {
@@ -52,7 +54,8 @@ static void QueuePush(packet_queue_t *queue, net_packet_t *packet)
     if (new_tail == queue->head)
     {
         // queue is full
-        
+
+        NET_FreePacket(packet);
         return;
     }
 
@@ -77,6 +80,19 @@ static net_packet_t *QueuePop(packet_queue_t *queue)
     return packet;
 }
 
+static void QueueInit(packet_queue_t *queue)
+{
+    net_packet_t *packet;
+
+    // [AP] Anything left from an earlier game
+    while ((packet = QueuePop(queue)) != NULL)
+    {
+        NET_FreePacket(packet);
+    }
+
+    queue->head = queue->tail = 0;
+}
+
 //-----------------------------------------------------------------------------
 //
 // Client end code
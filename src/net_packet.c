@@ -23,37 +23,122 @@
 
 static int total_packet_memory = 0;
 
+// [AP] Packets are made and freed several times per tic, so their headers
+// and buffers are recycled through free lists rather than going back to
+// the zone each time. Buffers up to POOLED_BUFFER_SIZE bytes, which holds
+// any UDP packet we receive, all come from the pool at that size.
+
+#define POOLED_BUFFER_SIZE  1500
+#define MAX_POOLED          64
+
+struct _net_packet_buffer_s
+{
+    int refcount;
+    size_t size;
+    net_packet_buffer_t *next;  // in the free list
+    byte data[1];
+};
+
+static net_packet_buffer_t *free_buffers = NULL;
+static int num_free_buffers = 0;
+static net_packet_t *free_packets[MAX_POOLED];
+static int num_free_packets = 0;
+
+static net_packet_buffer_t *NET_NewBuffer(size_t size)
+{
+    net_packet_buffer_t *buffer;
+
+    if (size <= POOLED_BUFFER_SIZE && free_buffers != NULL)
+    {
+        buffer = free_buffers;
+        free_buffers = buffer->next;
+        --num_free_buffers;
+    }
+    else
+    {
+        if (size <= POOLED_BUFFER_SIZE)
+        {
+            size = POOLED_BUFFER_SIZE;
+        }
+
+        buffer = Z_Malloc(sizeof(net_packet_buffer_t) + size, PU_STATIC, 0);
+        buffer->size = size;
+        total_packet_memory += size;
+    }
+
+    buffer->refcount = 1;
+    buffer->next = NULL;
+
+    return buffer;
+}
+
+static void NET_ReleaseBuffer(net_packet_buffer_t *buffer)
+{
+    --buffer->refcount;
+
+    if (buffer->refcount > 0)
+    {
+        return;
+    }
+
+    if (buffer->size == POOLED_BUFFER_SIZE && num_free_buffers < MAX_POOLED)
+    {
+        buffer->next = free_buffers;
+        free_buffers = buffer;
+        ++num_free_buffers;
+    }
+    else
+    {
+        total_packet_memory -= buffer->size;
+        Z_Free(buffer);
+    }
+}
+
+static net_packet_t *NET_NewPacketHeader(void)
+{
+    if (num_free_packets > 0)
+    {
+        return free_packets[--num_free_packets];
+    }
+
+    total_packet_memory += sizeof(net_packet_t);
+
+    return Z_Malloc(sizeof(net_packet_t), PU_STATIC, 0);
+}
+
 net_packet_t *NET_NewPacket(int initial_size)
 {
     net_packet_t *packet;
 
-    packet = (net_packet_t *) Z_Malloc(sizeof(net_packet_t), PU_STATIC, 0);
+    packet = NET_NewPacketHeader();
     
     if (initial_size == 0)
         initial_size = 256;
 
-    packet->alloced = initial_size;
-    packet->data = Z_Malloc(initial_size, PU_STATIC, 0);
+    packet->buffer = NET_NewBuffer(initial_size);
+    packet->data = packet->buffer->data;
+    packet->alloced = packet->buffer->size;
     packet->len = 0;
     packet->pos = 0;
 
-    total_packet_memory += sizeof(net_packet_t) + initial_size;
-
     //printf("total packet memory: %i bytes\n", total_packet_memory);
     //printf("%p: allocated\n", packet);
 
     return packet;
 }
 
-// duplicates an existing packet
+// duplicates an existing packet; the data is shared until either of the
+// two is written to
 
 net_packet_t *NET_PacketDup(net_packet_t *packet)
 {
     net_packet_t *newpacket;
 
-    newpacket = NET_NewPacket(packet->len);
-    memcpy(newpacket->data, packet->data, packet->len);
-    newpacket->len = packet->len;
+    newpacket = NET_NewPacketHeader();
+    *newpacket = *packet;
+    newpacket->pos = 0;
+
+    ++packet->buffer->refcount;
 
     return newpacket;
 }
@@ -62,9 +147,17 @@ void NET_FreePacket(net_packet_t *packet)
 {
     //printf("%p: destroyed\n", packet);
     
-    total_packet_memory -= sizeof(net_packet_t) + packet->alloced;
-    Z_Free(packet->data);
-    Z_Free(packet);
+    NET_ReleaseBuffer(packet->buffer);
+
+    if (num_free_packets < MAX_POOLED)
+    {
+        free_packets[num_free_packets++] = packet;
+    }
+    else
+    {
+        total_packet_memory -= sizeof(net_packet_t);
+        Z_Free(packet);
+    }
 }
 
 // Read a byte from the packet, returning true if read
@@ -234,32 +327,42 @@ char *NET_ReadSafeString(net_packet_t *packet)
     return result;
 }
 
-// Dynamically increases the size of a packet
+// Make room to write the given number of bytes to a packet: increase its
+// size as needed, and give it its own copy of the data if it shares it
+// with a duplicate.
 
-static void NET_IncreasePacket(net_packet_t *packet)
+static void NET_ReservePacket(net_packet_t *packet, size_t bytes)
 {
-    byte *newdata;
+    net_packet_buffer_t *newbuffer;
+    size_t size;
+
+    if (packet->len + bytes <= packet->alloced && packet->buffer->refcount == 1)
+    {
+        return;
+    }
 
-    total_packet_memory -= packet->alloced;
-   
-    packet->alloced *= 2;
+    size = packet->alloced;
 
-    newdata = Z_Malloc(packet->alloced, PU_STATIC, 0);
+    while (packet->len + bytes > size)
+    {
+        size *= 2;
+    }
 
-    memcpy(newdata, packet->data, packet->len);
+    newbuffer = NET_NewBuffer(size);
 
-    Z_Free(packet->data);
-    packet->data = newdata;
+    memcpy(newbuffer->data, packet->data, packet->len);
 
-    total_packet_memory += packet->alloced;
+    NET_ReleaseBuffer(packet->buffer);
+    packet->buffer = newbuffer;
+    packet->data = newbuffer->data;
+    packet->alloced = newbuffer->size;
 }
 
 // Write a single byte to the packet
 
 void NET_WriteInt8(net_packet_t *packet, unsigned int i)
 {
-    if (packet->len + 1 > packet->alloced)
-        NET_IncreasePacket(packet);
+    NET_ReservePacket(packet, 1);
 
     packet->data[packet->len] = i;
     packet->len += 1;
@@ -271,8 +374,7 @@ void NET_WriteInt16(net_packet_t *packet, unsigned int i)
 {
     byte *p;
     
-    if (packet->len + 2 > packet->alloced)
-        NET_IncreasePacket(packet);
+    NET_ReservePacket(packet, 2);
 
     p = packet->data + packet->len;
 
@@ -289,8 +391,7 @@ void NET_WriteInt32(net_packet_t *packet, unsigned int i)
 {
     byte *p;
 
-    if (packet->len + 4 > packet->alloced)
-        NET_IncreasePacket(packet);
+    NET_ReservePacket(packet, 4);
 
     p = packet->data + packet->len;
 
@@ -311,10 +412,7 @@ void NET_WriteString(net_packet_t *packet, const char *string)
 
     // Increase the packet size until large enough to hold the string
 
-    while (packet->len + string_size > packet->alloced)
-    {
-        NET_IncreasePacket(packet);
-    }
+    NET_ReservePacket(packet, string_size);
 
     p = packet->data + packet->len;
 
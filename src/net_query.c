@@ -22,6 +22,7 @@
 
 #include "i_system.h"
 #include "i_timer.h"
+#include "m_argv.h"
 #include "m_misc.h"
 
 #include "net_common.h"
@@ -48,6 +49,15 @@
 
 #define QUERY_MAX_ATTEMPTS 3
 
+// [AP] Queries awaiting a response at once, unless -querywindow is given.
+
+#define QUERY_DEFAULT_WINDOW 16
+
+// [AP] Shortest time to wait before asking a target again, however
+// quickly the others have been answering.
+
+#define QUERY_MIN_TIMEOUT_MS 250
+
 typedef enum
 {
     QUERY_TARGET_SERVER,       // Normal server target.
@@ -82,9 +92,20 @@ static net_context_t *query_context;
 static query_target_t *targets;
 static int num_targets;
 
+// [AP] Open addressed index of targets by address, holding each target's
+// index plus one, or zero if the slot is empty. Kept at most half full.
+static int *target_index;
+static int target_index_size;
+
 static boolean query_loop_running = false;
 static boolean printed_header = false;
-static int last_query_time = 0;
+
+// [AP] Smoothed round trip time and its mean deviation, in milliseconds,
+// from the targets that answered their first query. Until there's one,
+// queries wait the whole QUERY_TIMEOUT_SECS.
+static int query_window = 0;
+static int srtt_ms = -1;
+static int rttvar_ms;
 
 static char *securedemo_start_message = NULL;
 
@@ -205,19 +226,55 @@ void NET_RequestHolePunch(net_context_t *context, net_addr_t *addr)
     NET_ReleaseAddress(master_addr);
 }
 
+// [AP] The target for an address is one hash probe away instead of a
+// scan of every target, which adds up with a long master server list.
+
+static unsigned int TargetIndexSlot(net_addr_t *addr)
+{
+    return ((unsigned int) ((uintptr_t) addr >> 4) * 2654435761u)
+         & (target_index_size - 1);
+}
+
+static void AddTargetIndex(int i)
+{
+    unsigned int slot = TargetIndexSlot(targets[i].addr);
+
+    while (target_index[slot] != 0)
+    {
+        slot = (slot + 1) & (target_index_size - 1);
+    }
+
+    target_index[slot] = i + 1;
+}
+
+static void ClearTargetIndex(void)
+{
+    free(target_index);
+    target_index = NULL;
+    target_index_size = 0;
+}
+
 // Given the specified address, find the target associated.  If no
 // target is found, and 'create' is true, a new target is created.
 
 static query_target_t *GetTargetForAddr(net_addr_t *addr, boolean create)
 {
     query_target_t *target;
+    unsigned int slot;
     int i;
 
-    for (i=0; i<num_targets; ++i)
+    if (target_index_size > 0)
     {
-        if (targets[i].addr == addr)
+        slot = TargetIndexSlot(addr);
+
+        while (target_index[slot] != 0)
         {
-            return &targets[i];
+            if (targets[target_index[slot] - 1].addr == addr)
+            {
+                return &targets[target_index[slot] - 1];
+            }
+
+            slot = (slot + 1) & (target_index_size - 1);
         }
     }
 
@@ -226,6 +283,19 @@ static query_target_t *GetTargetForAddr(net_addr_t *addr, boolean create)
         return NULL;
     }
 
+    // Grow the index before adding, and fill it again from the targets
+    if ((num_targets + 1) * 2 > target_index_size)
+    {
+        free(target_index);
+        target_index_size = target_index_size > 0 ? target_index_size * 2 : 64;
+        target_index = calloc(target_index_size, sizeof(*target_index));
+
+        for (i = 0; i < num_targets; ++i)
+        {
+            AddTargetIndex(i);
+        }
+    }
+
     targets = I_Realloc(targets, sizeof(query_target_t) * (num_targets + 1));
 
     target = &targets[num_targets];
@@ -235,6 +305,7 @@ static query_target_t *GetTargetForAddr(net_addr_t *addr, boolean create)
     target->query_attempts = 0;
     target->addr = addr;
     NET_ReferenceAddress(addr);
+    AddTargetIndex(num_targets);
     ++num_targets;
 
     return target;
@@ -251,6 +322,7 @@ static void FreeTargets(void)
     free(targets);
     targets = NULL;
     num_targets = 0;
+    ClearTargetIndex();
 }
 
 // Transmit a query packet
@@ -274,6 +346,22 @@ static void NET_Query_SendQuery(net_addr_t *addr)
     NET_FreePacket(request);
 }
 
+// [AP] Fold a round trip time into the estimate, as TCP does (RFC 6298).
+
+static void UpdateRTT(int rtt_ms)
+{
+    if (srtt_ms < 0)
+    {
+        srtt_ms = rtt_ms;
+        rttvar_ms = rtt_ms / 2;
+    }
+    else
+    {
+        rttvar_ms += (abs(srtt_ms - rtt_ms) - rttvar_ms) / 4;
+        srtt_ms += (rtt_ms - srtt_ms) / 8;
+    }
+}
+
 static void NET_Query_ParseResponse(net_addr_t *addr, net_packet_t *packet,
                                     net_query_callback_t callback,
                                     void *user_data)
@@ -336,6 +424,12 @@ static void NET_Query_ParseResponse(net_addr_t *addr, net_packet_t *packet,
 
         target->ping_time = I_GetTimeMS() - target->query_time;
 
+        // [AP] A reply after a retry may answer either query
+        if (target->query_attempts == 1)
+        {
+            UpdateRTT(target->ping_time);
+        }
+
         // Invoke callback to signal that we have a new address.
 
         callback(addr, &target->data, target->ping_time, user_data);
@@ -409,8 +503,8 @@ static void NET_Query_ParsePacket(net_addr_t *addr, net_packet_t *packet,
     }
 }
 
-static void NET_Query_GetResponse(net_query_callback_t callback,
-                                  void *user_data)
+static boolean NET_Query_GetResponse(net_query_callback_t callback,
+                                     void *user_data)
 {
     net_addr_t *addr;
     net_packet_t *packet;
@@ -420,50 +514,49 @@ static void NET_Query_GetResponse(net_query_callback_t callback,
         NET_Query_ParsePacket(addr, packet, callback, user_data);
         NET_ReleaseAddress(addr);
         NET_FreePacket(packet);
+        return true;
     }
+
+    return false;
 }
 
-// Find a target we have not yet queried and send a query.
+// [AP] Time to wait for a target to answer before asking again, doubled
+// for each query it has ignored.
 
-static void SendOneQuery(void)
+static unsigned int TargetTimeout(const query_target_t *target)
 {
-    unsigned int now;
-    unsigned int i;
-
-    now = I_GetTimeMS();
-
-    // Rate limit - only send one query every 50ms.
+    int timeout = QUERY_TIMEOUT_SECS * 1000;
 
-    if (now - last_query_time < 50)
+    if (srtt_ms >= 0)
     {
-        return;
-    }
+        timeout = srtt_ms + 4 * rttvar_ms;
 
-    for (i = 0; i < num_targets; ++i)
-    {
-        // Not queried yet?
-        // Or last query timed out without a response?
-
-        if (targets[i].state == QUERY_TARGET_QUEUED
-         || (targets[i].state == QUERY_TARGET_QUERIED
-             && now - targets[i].query_time > QUERY_TIMEOUT_SECS * 1000))
+        if (timeout < QUERY_MIN_TIMEOUT_MS)
         {
-            break;
+            timeout = QUERY_MIN_TIMEOUT_MS;
+        }
+        else if (timeout > QUERY_TIMEOUT_SECS * 1000)
+        {
+            timeout = QUERY_TIMEOUT_SECS * 1000;
         }
     }
 
-    if (i >= num_targets)
+    if (target->query_attempts > 1)
     {
-        return;
+        timeout <<= target->query_attempts - 1;
     }
 
-    // Found a target to query.  Send a query; how to do this depends on
-    // the target type.
+    return timeout;
+}
 
-    switch (targets[i].type)
+static void SendTargetQuery(query_target_t *target, unsigned int now)
+{
+    // How to send a query depends on the target type.
+
+    switch (target->type)
     {
         case QUERY_TARGET_SERVER:
-            NET_Query_SendQuery(targets[i].addr);
+            NET_Query_SendQuery(target->addr);
             break;
 
         case QUERY_TARGET_BROADCAST:
@@ -471,16 +564,46 @@ static void SendOneQuery(void)
             break;
 
         case QUERY_TARGET_MASTER:
-            NET_Query_SendMasterQuery(targets[i].addr);
+            NET_Query_SendMasterQuery(target->addr);
             break;
     }
 
-    //printf("Queried %s\n", NET_AddrToString(targets[i].addr));
-    targets[i].state = QUERY_TARGET_QUERIED;
-    targets[i].query_time = now;
-    ++targets[i].query_attempts;
+    //printf("Queried %s\n", NET_AddrToString(target->addr));
+    target->state = QUERY_TARGET_QUERIED;
+    target->query_time = now;
+    ++target->query_attempts;
+}
+
+// [AP] Query targets not yet queried, or whose last query timed out
+// without a response, keeping up to query_window queries in flight.
+
+static void SendQueries(void)
+{
+    unsigned int now;
+    unsigned int i;
+    int in_flight = 0;
+
+    now = I_GetTimeMS();
+
+    for (i = 0; i < num_targets; ++i)
+    {
+        if (targets[i].state == QUERY_TARGET_QUERIED
+         && now - targets[i].query_time <= TargetTimeout(&targets[i]))
+        {
+            ++in_flight;
+        }
+    }
 
-    last_query_time = now;
+    for (i = 0; i < num_targets && in_flight < query_window; ++i)
+    {
+        if (targets[i].state == QUERY_TARGET_QUEUED
+         || (targets[i].state == QUERY_TARGET_QUERIED
+             && now - targets[i].query_time > TargetTimeout(&targets[i])))
+        {
+            SendTargetQuery(&targets[i], now);
+            ++in_flight;
+        }
+    }
 }
 
 // Time out servers that have been queried and not responded.
@@ -506,7 +629,7 @@ static void CheckTargetTimeouts(void)
 
         if (targets[i].state == QUERY_TARGET_QUERIED
          && targets[i].query_attempts >= QUERY_MAX_ATTEMPTS
-         && now - targets[i].query_time > QUERY_TIMEOUT_SECS * 1000)
+         && now - targets[i].query_time > TargetTimeout(&targets[i]))
         {
             targets[i].state = QUERY_TARGET_NO_RESPONSE;
 
@@ -546,13 +669,13 @@ int NET_Query_Poll(net_query_callback_t callback, void *user_data)
 {
     CheckTargetTimeouts();
 
-    // Send a query.  This will only send a single query at once.
+    // Send queries, as many as the window has room for.
 
-    SendOneQuery();
+    SendQueries();
 
-    // Check for a response
+    // [AP] Take every response waiting, each shown as it's parsed
 
-    NET_Query_GetResponse(callback, user_data);
+    while (NET_Query_GetResponse(callback, user_data));
 
     return !AllTargetsDone();
 }
@@ -581,6 +704,25 @@ static void NET_Query_QueryLoop(net_query_callback_t callback, void *user_data)
 
 void NET_Query_Init(void)
 {
+    int p;
+
+    //!
+    // @category net
+    // @arg <n>
+    //
+    // When searching for servers, wait for answers from up to n of them
+    // at once (default 16).
+    //
+
+    p = M_CheckParmWithArgs("-querywindow", 1);
+    query_window = p > 0 ? atoi(myargv[p + 1]) : QUERY_DEFAULT_WINDOW;
+    if (query_window < 1)
+    {
+        query_window = 1;
+    }
+
+    srtt_ms = -1;
+
     if (query_context == NULL)
     {
         query_context = NET_NewContext();
@@ -591,6 +733,7 @@ void NET_Query_Init(void)
     free(targets);
     targets = NULL;
     num_targets = 0;
+    ClearTargetIndex();
 
     printed_header = false;
 }
@@ -21,6 +21,7 @@
 
 #include "doomtype.h"
 #include "i_system.h"
+#include "i_timer.h"
 #include "m_argv.h"
 #include "m_misc.h"
 #include "net_defs.h"
@@ -45,15 +46,22 @@ static boolean initted = false;
 static int port = DEFAULT_PORT;
 static UDPsocket udpsocket;
 static UDPpacket *recvpacket;
+static SDLNet_SocketSet socketset = NULL; // [AP] for NET_SDL_WaitPacket
 
-typedef struct
+// [AP] The address table is a hash table chained through the entries,
+// keyed by host and port, so finding the sender of a packet doesn't scan
+// every peer seen. Entries go as their last reference is released.
+
+typedef struct addrpair_s
 {
     net_addr_t net_addr;
     IPaddress sdl_addr;
+    struct addrpair_s *next;
 } addrpair_t;
 
 static addrpair_t **addr_table;
 static int addr_table_size = -1;
+static int addr_table_count = 0;
 
 // Initializes the address table
 
@@ -72,58 +80,71 @@ static boolean AddressesEqual(IPaddress *a, IPaddress *b)
         && a->port == b->port;
 }
 
+static unsigned int AddressHash(IPaddress *addr)
+{
+    return ((addr->host * 2654435761u) ^ (addr->port * 40503u))
+         & (addr_table_size - 1);
+}
+
+// Doubles the number of chains once there are more entries than chains.
+
+static void NET_SDL_GrowAddrTable(void)
+{
+    addrpair_t **old_addr_table = addr_table;
+    int old_addr_table_size = addr_table_size;
+    addrpair_t *entry, *next;
+    unsigned int hash;
+    int i;
+
+    addr_table_size *= 2;
+    addr_table = Z_Malloc(sizeof(addrpair_t *) * addr_table_size,
+                          PU_STATIC, 0);
+    memset(addr_table, 0, sizeof(addrpair_t *) * addr_table_size);
+
+    for (i=0; i<old_addr_table_size; ++i)
+    {
+        for (entry = old_addr_table[i]; entry != NULL; entry = next)
+        {
+            next = entry->next;
+            hash = AddressHash(&entry->sdl_addr);
+            entry->next = addr_table[hash];
+            addr_table[hash] = entry;
+        }
+    }
+
+    Z_Free(old_addr_table);
+}
+
 // Finds an address by searching the table.  If the address is not found,
 // it is added to the table.
 
 static net_addr_t *NET_SDL_FindAddress(IPaddress *addr)
 {
     addrpair_t *new_entry;
-    int empty_entry = -1;
-    int i;
+    addrpair_t *entry;
+    unsigned int hash;
 
     if (addr_table_size < 0)
     {
         NET_SDL_InitAddrTable();
     }
 
-    for (i=0; i<addr_table_size; ++i)
+    hash = AddressHash(addr);
+
+    for (entry = addr_table[hash]; entry != NULL; entry = entry->next)
     {
-        if (addr_table[i] != NULL
-         && AddressesEqual(addr, &addr_table[i]->sdl_addr))
+        if (AddressesEqual(addr, &entry->sdl_addr))
         {
-            return &addr_table[i]->net_addr;
+            return &entry->net_addr;
         }
-
-        if (empty_entry < 0 && addr_table[i] == NULL)
-            empty_entry = i;
     }
 
     // Was not found in list.  We need to add it.
 
-    // Is there any space in the table? If not, increase the table size
-
-    if (empty_entry < 0)
+    if (addr_table_count >= addr_table_size)
     {
-        addrpair_t **new_addr_table;
-        int new_addr_table_size;
-
-        // after reallocing, we will add this in as the first entry
-        // in the new block of memory
-
-        empty_entry = addr_table_size;
-        
-        // allocate a new array twice the size, init to 0 and copy 
-        // the existing table in.  replace the old table.
-
-        new_addr_table_size = addr_table_size * 2;
-        new_addr_table = Z_Malloc(sizeof(addrpair_t *) * new_addr_table_size,
-                                  PU_STATIC, 0);
-        memset(new_addr_table, 0, sizeof(addrpair_t *) * new_addr_table_size);
-        memcpy(new_addr_table, addr_table, 
-               sizeof(addrpair_t *) * addr_table_size);
-        Z_Free(addr_table);
-        addr_table = new_addr_table;
-        addr_table_size = new_addr_table_size;
+        NET_SDL_GrowAddrTable();
+        hash = AddressHash(addr);
     }
 
     // Add a new entry
@@ -135,22 +156,32 @@ static net_addr_t *NET_SDL_FindAddress(IPaddress *addr)
     new_entry->net_addr.handle = &new_entry->sdl_addr;
     new_entry->net_addr.module = &net_sdl_module;
 
-    addr_table[empty_entry] = new_entry;
+    new_entry->next = addr_table[hash];
+    addr_table[hash] = new_entry;
+    ++addr_table_count;
 
     return &new_entry->net_addr;
 }
 
 static void NET_SDL_FreeAddress(net_addr_t *addr)
 {
-    int i;
-    
-    for (i=0; i<addr_table_size; ++i)
+    addrpair_t **link;
+
+    if (addr_table_size > 0)
     {
-        if (addr == &addr_table[i]->net_addr)
+        link = &addr_table[AddressHash(addr->handle)];
+
+        for (; *link != NULL; link = &(*link)->next)
         {
-            Z_Free(addr_table[i]);
-            addr_table[i] = NULL;
-            return;
+            if (addr == &(*link)->net_addr)
+            {
+                addrpair_t *entry = *link;
+
+                *link = entry->next;
+                Z_Free(entry);
+                --addr_table_count;
+                return;
+            }
         }
     }
 
@@ -216,6 +247,9 @@ static boolean NET_SDL_InitServer(void)
         I_Error("NET_SDL_InitServer: Unable to bind to port %i", port);
     }
 
+    socketset = SDLNet_AllocSocketSet(1);
+    SDLNet_UDP_AddSocket(socketset, udpsocket);
+
     recvpacket = SDLNet_AllocPacket(1500);
 #ifdef DROP_PACKETS
     srand(time(NULL));
@@ -369,6 +403,23 @@ net_addr_t *NET_SDL_ResolveAddress(const char *address)
 
 // Complete module
 
+// [AP] Block on the socket instead of polling it.
+
+static void NET_SDL_WaitPacket(int timeout_ms)
+{
+    if (socketset == NULL)
+    {
+        I_Sleep(1);
+        return;
+    }
+
+    if (SDLNet_CheckSockets(socketset, timeout_ms) < 0)
+    {
+        // select() can be interrupted; don't spin if it keeps failing.
+        I_Sleep(1);
+    }
+}
+
 net_module_t net_sdl_module =
 {
     NET_SDL_InitClient,
@@ -378,6 +429,7 @@ net_module_t net_sdl_module =
     NET_SDL_AddrToString,
     NET_SDL_FreeAddress,
     NET_SDL_ResolveAddress,
+    NET_SDL_WaitPacket,
 };
 
 
@@ -45,6 +45,13 @@
 // How often to re-resolve the address of the master server?
 #define MASTER_RESOLVE_PERIOD 8 * 60 * 60 /* 8 hours */
 
+// [AP] Most games that one server process can host at once.
+#define MAX_SESSIONS 64
+
+// [AP] Longest a dedicated server blocks waiting for a packet before it
+// runs its timers again.
+#define WAIT_TIMEOUT_MS 10
+
 typedef enum
 {
     // waiting for the game to be "launched" (key player to press the start
@@ -143,14 +150,41 @@ typedef struct
     net_ticdiff_t diff;
 } net_client_recv_t;
 
-static net_server_state_t server_state;
+// [AP] Everything about one game being hosted. A dedicated server run
+// with -sessions hosts several games at once, each in its own session.
+
+typedef struct
+{
+    net_server_state_t server_state;
+    net_client_t clients[MAXNETNODES];
+    net_client_t *sv_players[NET_MAXPLAYERS];
+    unsigned int sv_gamemode;
+    unsigned int sv_gamemission;
+    net_gamesettings_t sv_settings;
+
+    // receive window
+
+    unsigned int recvwindow_start;
+    net_client_recv_t recvwindow[BACKUPTICS][NET_MAXPLAYERS];
+
+    // statistics for the current game, reported when it ends
+
+    unsigned int start_time;
+    unsigned int num_players;
+    unsigned int tics_sent;
+    unsigned int packets_received, bytes_received;
+    unsigned int packets_sent, bytes_sent;
+} net_session_t;
+
 static boolean server_initialized = false;
-static net_client_t clients[MAXNETNODES];
-static net_client_t *sv_players[NET_MAXPLAYERS];
 static net_context_t *server_context;
-static unsigned int sv_gamemode;
-static unsigned int sv_gamemission;
-static net_gamesettings_t sv_settings;
+
+// The session being run; sessions[0] always exists, the others are
+// created when needed and freed when their game has ended.
+
+static net_session_t *session;
+static net_session_t *sessions[MAX_SESSIONS];
+static int max_sessions = 1;
 
 // For registration with master server:
 
@@ -158,12 +192,7 @@ static net_addr_t *master_server = NULL;
 static unsigned int master_refresh_time;
 static unsigned int master_resolve_time;
 
-// receive window
-
-static unsigned int recvwindow_start;
-static net_client_recv_t recvwindow[BACKUPTICS][NET_MAXPLAYERS];
-
-#define NET_SV_ExpandTicNum(b) NET_ExpandTicNum(recvwindow_start, (b))
+#define NET_SV_ExpandTicNum(b) NET_ExpandTicNum(session->recvwindow_start, (b))
 
 static void NET_SV_DisconnectClient(net_client_t *client)
 {
@@ -216,9 +245,9 @@ static void NET_SV_BroadcastMessage(const char *s, ...)
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]))
+        if (ClientConnected(&session->clients[i]))
         {
-            NET_SV_SendConsoleMessage(&clients[i], "%s", buf);
+            NET_SV_SendConsoleMessage(&session->clients[i], "%s", buf);
         }
     }
 
@@ -237,24 +266,24 @@ static void NET_SV_AssignPlayers(void)
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]))
+        if (ClientConnected(&session->clients[i]))
         {
-            if (!clients[i].drone)
+            if (!session->clients[i].drone)
             {
-                sv_players[pl] = &clients[i];
-                sv_players[pl]->player_number = pl;
+                session->sv_players[pl] = &session->clients[i];
+                session->sv_players[pl]->player_number = pl;
                 ++pl;
             }
             else
             {
-                clients[i].player_number = -1;
+                session->clients[i].player_number = -1;
             }
         }
     }
 
     for (; pl<NET_MAXPLAYERS; ++pl)
     {
-        sv_players[pl] = NULL;
+        session->sv_players[pl] = NULL;
     }
 }
 
@@ -269,7 +298,7 @@ static int NET_SV_NumPlayers(void)
 
     for (i=0; i<NET_MAXPLAYERS; ++i)
     {
-        if (sv_players[i] != NULL && ClientConnected(sv_players[i]))
+        if (session->sv_players[i] != NULL && ClientConnected(session->sv_players[i]))
         {
             result += 1;
         }
@@ -287,8 +316,8 @@ static int NET_SV_NumReadyPlayers(void)
 
     for (i = 0; i < MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i])
-         && !clients[i].drone && clients[i].ready)
+        if (ClientConnected(&session->clients[i])
+         && !session->clients[i].drone && session->clients[i].ready)
         {
             ++result;
         }
@@ -305,9 +334,9 @@ static int NET_SV_MaxPlayers(void)
 
     for (i = 0; i < MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]))
+        if (ClientConnected(&session->clients[i]))
         {
-            return clients[i].max_players;
+            return session->clients[i].max_players;
         }
     }
 
@@ -325,7 +354,7 @@ static int NET_SV_NumDrones(void)
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]) && clients[i].drone)
+        if (ClientConnected(&session->clients[i]) && session->clients[i].drone)
         {
             result += 1;
         }
@@ -345,7 +374,7 @@ static int NET_SV_NumClients(void)
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]))
+        if (ClientConnected(&session->clients[i]))
         {
             ++count;
         }
@@ -369,14 +398,14 @@ static net_client_t *NET_SV_Controller(void)
     {
         // Can't be controller?
 
-        if (!ClientConnected(&clients[i]) || clients[i].drone)
+        if (!ClientConnected(&session->clients[i]) || session->clients[i].drone)
         {
             continue;
         }
 
-        if (best == NULL || clients[i].connect_time < best->connect_time)
+        if (best == NULL || session->clients[i].connect_time < best->connect_time)
         {
-            best = &clients[i];
+            best = &session->clients[i];
         }
     }
 
@@ -421,10 +450,10 @@ static void NET_SV_SendWaitingData(net_client_t *client)
     for (i = 0; i < wait_data.num_players; ++i)
     {
         M_StringCopy(wait_data.player_names[i],
-                     sv_players[i]->name,
+                     session->sv_players[i]->name,
                      MAXPLAYERNAME);
         M_StringCopy(wait_data.player_addrs[i],
-                     NET_AddrToString(sv_players[i]->addr),
+                     NET_AddrToString(session->sv_players[i]->addr),
                      MAXPLAYERNAME);
     }
 
@@ -450,11 +479,11 @@ static unsigned int NET_SV_LatestAcknowledged(void)
 
     for (i=0; i<MAXNETNODES; ++i) 
     {
-        if (ClientConnected(&clients[i]))
+        if (ClientConnected(&session->clients[i]))
         {
-            if (clients[i].acknowledged < lowtic)
+            if (session->clients[i].acknowledged < lowtic)
             {
-                lowtic = clients[i].acknowledged;
+                lowtic = session->clients[i].acknowledged;
             }
         }
     }
@@ -480,7 +509,7 @@ static void NET_SV_AdvanceWindow(void)
 
     // Advance the recv window until it catches up with lowtic
 
-    while (recvwindow_start < lowtic)
+    while (session->recvwindow_start < lowtic)
     {
         boolean should_advance;
 
@@ -491,12 +520,12 @@ static void NET_SV_AdvanceWindow(void)
 
         for (i=0; i<NET_MAXPLAYERS; ++i)
         {
-            if (sv_players[i] == NULL || !ClientConnected(sv_players[i]))
+            if (session->sv_players[i] == NULL || !ClientConnected(session->sv_players[i]))
             {
                 continue;
             }
 
-            if (!recvwindow[0][i].active)
+            if (!session->recvwindow[0][i].active)
             {
                 should_advance = false;
                 break;
@@ -514,11 +543,11 @@ static void NET_SV_AdvanceWindow(void)
         
         // Advance the window
 
-        memmove(recvwindow, recvwindow + 1,
-                sizeof(*recvwindow) * (BACKUPTICS - 1));
-        memset(&recvwindow[BACKUPTICS-1], 0, sizeof(*recvwindow));
-        ++recvwindow_start;
-        NET_Log("server: advanced receive window to %d", recvwindow_start);
+        memmove(session->recvwindow, session->recvwindow + 1,
+                sizeof(*session->recvwindow) * (BACKUPTICS - 1));
+        memset(&session->recvwindow[BACKUPTICS-1], 0, sizeof(*session->recvwindow));
+        ++session->recvwindow_start;
+        NET_Log("server: advanced receive window to %d", session->recvwindow_start);
     }
 }
 
@@ -530,11 +559,11 @@ static net_client_t *NET_SV_FindClient(net_addr_t *addr)
 
     for (i=0; i<MAXNETNODES; ++i) 
     {
-        if (clients[i].active && clients[i].addr == addr)
+        if (session->clients[i].active && session->clients[i].addr == addr)
         {
             // found the client
 
-            return &clients[i];
+            return &session->clients[i];
         }
     }
 
@@ -675,10 +704,10 @@ static void NET_SV_ParseSYN(net_packet_t *packet, net_client_t *client,
     // At this point we have received a valid SYN.
 
     // Not accepting new connections?
-    if (server_state != SERVER_WAITING_LAUNCH)
+    if (session->server_state != SERVER_WAITING_LAUNCH)
     {
         NET_Log("server: error: not in waiting launch state, server_state=%d",
-                server_state);
+                session->server_state);
         NET_SV_SendReject(addr,
                           "Server is not currently accepting connections");
         return;
@@ -704,23 +733,23 @@ static void NET_SV_ParseSYN(net_packet_t *packet, net_client_t *client,
     // Adopt the game mode and mission of the first connecting client:
     if (num_players == 0 && !data.drone)
     {
-        sv_gamemode = data.gamemode;
-        sv_gamemission = data.gamemission;
+        session->sv_gamemode = data.gamemode;
+        session->sv_gamemission = data.gamemission;
         NET_Log("server: new game, mode=%d, mission=%d",
-                sv_gamemode, sv_gamemission);
+                session->sv_gamemode, session->sv_gamemission);
     }
 
     // Check the connecting client is playing the same game as all
     // the other clients
-    if (data.gamemode != sv_gamemode || data.gamemission != sv_gamemission)
+    if (data.gamemode != session->sv_gamemode || data.gamemission != session->sv_gamemission)
     {
         char msg[128];
         NET_Log("server: wrong mode/mission, %d != %d || %d != %d",
-                data.gamemode, sv_gamemode, data.gamemission, sv_gamemission);
+                data.gamemode, session->sv_gamemode, data.gamemission, session->sv_gamemission);
         M_snprintf(msg, sizeof(msg),
                    "Game mismatch: server is %s (%s), client is %s (%s)",
-                   D_GameMissionString(sv_gamemission),
-                   D_GameModeString(sv_gamemode),
+                   D_GameMissionString(session->sv_gamemission),
+                   D_GameModeString(session->sv_gamemode),
                    D_GameMissionString(data.gamemission),
                    D_GameModeString(data.gamemode));
 
@@ -735,9 +764,9 @@ static void NET_SV_ParseSYN(net_packet_t *packet, net_client_t *client,
 
         for (i=0; i<MAXNETNODES; ++i)
         {
-            if (!clients[i].active)
+            if (!session->clients[i].active)
             {
-                client = &clients[i];
+                client = &session->clients[i];
                 break;
             }
         }
@@ -807,10 +836,10 @@ static void NET_SV_ParseLaunch(net_packet_t *packet, net_client_t *client)
 
     // Can only launch when we are in the waiting state.
 
-    if (server_state != SERVER_WAITING_LAUNCH)
+    if (session->server_state != SERVER_WAITING_LAUNCH)
     {
         NET_Log("server: error: not in waiting launch state, state=%d",
-                server_state);
+                session->server_state);
         return;
     }
 
@@ -821,17 +850,17 @@ static void NET_SV_ParseLaunch(net_packet_t *packet, net_client_t *client)
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (!ClientConnected(&clients[i]))
+        if (!ClientConnected(&session->clients[i]))
             continue;
 
-        launchpacket = NET_Conn_NewReliable(&clients[i].connection,
+        launchpacket = NET_Conn_NewReliable(&session->clients[i].connection,
                                             NET_PACKET_TYPE_LAUNCH);
         NET_WriteInt8(launchpacket, num_players);
     }
 
     // Now in launch state.
 
-    server_state = SERVER_WAITING_START;
+    session->server_state = SERVER_WAITING_START;
 }
 
 // Transition to the in-game state and send all players the start game
@@ -850,29 +879,29 @@ static void StartGame(void)
 
     // Check if anyone is recording a demo and set lowres_turn if so.
 
-    sv_settings.lowres_turn = false;
+    session->sv_settings.lowres_turn = false;
 
     for (i = 0; i < NET_MAXPLAYERS; ++i)
     {
-        if (sv_players[i] != NULL && sv_players[i]->recording_lowres)
+        if (session->sv_players[i] != NULL && session->sv_players[i]->recording_lowres)
         {
-            sv_settings.lowres_turn = true;
+            session->sv_settings.lowres_turn = true;
         }
     }
 
-    sv_settings.num_players = NET_SV_NumPlayers();
+    session->sv_settings.num_players = NET_SV_NumPlayers();
 
     // Copy player classes:
 
     for (i = 0; i < NET_MAXPLAYERS; ++i)
     {
-        if (sv_players[i] != NULL)
+        if (session->sv_players[i] != NULL)
         {
-            sv_settings.player_classes[i] = sv_players[i]->player_class;
+            session->sv_settings.player_classes[i] = session->sv_players[i]->player_class;
         }
         else
         {
-            sv_settings.player_classes[i] = 0;
+            session->sv_settings.player_classes[i] = 0;
         }
     }
 
@@ -882,25 +911,33 @@ static void StartGame(void)
 
     for (i = 0; i < MAXNETNODES; ++i)
     {
-        if (!ClientConnected(&clients[i]))
+        if (!ClientConnected(&session->clients[i]))
             continue;
 
-        clients[i].last_gamedata_time = nowtime;
+        session->clients[i].last_gamedata_time = nowtime;
 
-        startpacket = NET_Conn_NewReliable(&clients[i].connection,
+        startpacket = NET_Conn_NewReliable(&session->clients[i].connection,
                                            NET_PACKET_TYPE_GAMESTART);
 
-        sv_settings.consoleplayer = clients[i].player_number;
+        session->sv_settings.consoleplayer = session->clients[i].player_number;
 
-        NET_WriteSettings(startpacket, &sv_settings);
+        NET_WriteSettings(startpacket, &session->sv_settings);
     }
 
     // Change server state
     NET_Log("server: beginning game state");
-    server_state = SERVER_IN_GAME;
-
-    memset(recvwindow, 0, sizeof(recvwindow));
-    recvwindow_start = 0;
+    session->server_state = SERVER_IN_GAME;
+
+    memset(session->recvwindow, 0, sizeof(session->recvwindow));
+    session->recvwindow_start = 0;
+
+    session->start_time = nowtime;
+    session->num_players = session->sv_settings.num_players;
+    session->tics_sent = 0;
+    session->packets_received = 0;
+    session->bytes_received = 0;
+    session->packets_sent = 0;
+    session->bytes_sent = 0;
 }
 
 // Returns true when all nodes have indicated readiness to start the game.
@@ -911,7 +948,7 @@ static boolean AllNodesReady(void)
 
     for (i = 0; i < MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]) && !clients[i].ready)
+        if (ClientConnected(&session->clients[i]) && !session->clients[i].ready)
         {
             return false;
         }
@@ -943,9 +980,9 @@ static void SendAllWaitingData(void)
 
     for (i = 0; i < MAXNETNODES; ++i)
     {
-        if (ClientConnected(&clients[i]) && clients[i].ready)
+        if (ClientConnected(&session->clients[i]) && session->clients[i].ready)
         {
-            NET_SV_SendWaitingData(&clients[i]);
+            NET_SV_SendWaitingData(&session->clients[i]);
         }
     }
 }
@@ -960,10 +997,10 @@ static void NET_SV_ParseGameStart(net_packet_t *packet, net_client_t *client)
 
     // Can only start a game if we are in the waiting start state.
 
-    if (server_state != SERVER_WAITING_START)
+    if (session->server_state != SERVER_WAITING_START)
     {
         NET_Log("server: error: not in waiting start state, server_state=%d",
-                server_state);
+                session->server_state);
         return;
     }
 
@@ -978,13 +1015,13 @@ static void NET_SV_ParseGameStart(net_packet_t *packet, net_client_t *client)
 
         // Check the game settings are valid
 
-        if (!NET_ValidGameSettings(sv_gamemode, sv_gamemission, &settings))
+        if (!NET_ValidGameSettings(session->sv_gamemode, session->sv_gamemission, &settings))
         {
             NET_Log("server: error: invalid game settings");
             return;
         }
 
-        sv_settings = settings;
+        session->sv_settings = settings;
     }
 
     client->ready = true;
@@ -1026,7 +1063,7 @@ static void NET_SV_SendResendRequest(net_client_t *client, int start, int end)
 
     for (i=start; i<=end; ++i)
     {
-        index = i - recvwindow_start;
+        index = i - session->recvwindow_start;
 
         if (index >= BACKUPTICS)
         {
@@ -1035,7 +1072,7 @@ static void NET_SV_SendResendRequest(net_client_t *client, int start, int end)
             continue;
         }
         
-        recvobj = &recvwindow[index][client->player_number];
+        recvobj = &session->recvwindow[index][client->player_number];
 
         recvobj->resend_time = nowtime;
     }
@@ -1061,7 +1098,7 @@ static void NET_SV_CheckResends(net_client_t *client)
         net_client_recv_t *recvobj;
         boolean need_resend;
 
-        recvobj = &recvwindow[i][player];
+        recvobj = &session->recvwindow[i][player];
 
         // if need_resend is true, this tic needs another retransmit
         // request (300ms timeout)
@@ -1084,12 +1121,12 @@ static void NET_SV_CheckResends(net_client_t *client)
             // End of a run of resend tics
             NET_Log("server: resend request to %s timed out for %d-%d (%d)",
                     NET_AddrToString(client->addr),
-                    recvwindow_start + resend_start,
-                    recvwindow_start + resend_end,
-                    &recvwindow[resend_start][player].resend_time);
+                    session->recvwindow_start + resend_start,
+                    session->recvwindow_start + resend_end,
+                    &session->recvwindow[resend_start][player].resend_time);
             NET_SV_SendResendRequest(client, 
-                                     recvwindow_start + resend_start,
-                                     recvwindow_start + resend_end);
+                                     session->recvwindow_start + resend_start,
+                                     session->recvwindow_start + resend_end);
 
             resend_start = -1;
         }
@@ -1099,12 +1136,12 @@ static void NET_SV_CheckResends(net_client_t *client)
     {
         NET_Log("server: resend request to %s timed out for %d-%d (%d)",
                 NET_AddrToString(client->addr),
-                recvwindow_start + resend_start,
-                recvwindow_start + resend_end,
-                &recvwindow[resend_start][player].resend_time);
+                session->recvwindow_start + resend_start,
+                session->recvwindow_start + resend_end,
+                &session->recvwindow[resend_start][player].resend_time);
         NET_SV_SendResendRequest(client,
-                                 recvwindow_start + resend_start,
-                                 recvwindow_start + resend_end);
+                                 session->recvwindow_start + resend_start,
+                                 session->recvwindow_start + resend_end);
     }
 }
 
@@ -1117,15 +1154,16 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
     unsigned int ackseq;
     unsigned int num_tics;
     unsigned int nowtime;
+    signed int latency;
     size_t i;
     int player;
     int resend_start, resend_end;
     int index;
 
-    if (server_state != SERVER_IN_GAME)
+    if (session->server_state != SERVER_IN_GAME)
     {
         NET_Log("server: error: not in game state: server_state=%d",
-                server_state);
+                session->server_state);
         return;
     }
 
@@ -1147,6 +1185,17 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
         return;
     }
 
+    // [AP] The compact encoding has the latency once, for every tic.
+
+    latency = 0;
+
+    if (client->connection.protocol == NET_PROTOCOL_APDOOM_0
+     && !NET_ReadSInt16(packet, &latency))
+    {
+        NET_Log("server: error: failed to read latency");
+        return;
+    }
+
     NET_Log("server: got game data, seq=%d, num_tics=%d, ackseq=%d",
             seq, num_tics, ackseq);
 
@@ -1162,15 +1211,15 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
     for (i=0; i<num_tics; ++i)
     {
         net_ticdiff_t diff;
-        signed int latency;
 
-        if (!NET_ReadSInt16(packet, &latency)
-         || !NET_ReadTiccmdDiff(packet, &diff, sv_settings.lowres_turn))
+        if ((client->connection.protocol != NET_PROTOCOL_APDOOM_0
+          && !NET_ReadSInt16(packet, &latency))
+         || !NET_ReadTiccmdDiff(packet, &diff, session->sv_settings.lowres_turn))
         {
             return;
         }
 
-        index = seq + i - recvwindow_start;
+        index = seq + i - session->recvwindow_start;
 
         if (index < 0 || index >= BACKUPTICS)
         {
@@ -1179,7 +1228,7 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
             continue;
         }
 
-        recvobj = &recvwindow[index][player];
+        recvobj = &session->recvwindow[index][player];
         recvobj->active = true;
         recvobj->diff = diff;
         recvobj->latency = latency;
@@ -1202,7 +1251,7 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
 
     //printf("SV: %p: %i\n", client, seq);
 
-    resend_end = seq - recvwindow_start;
+    resend_end = seq - session->recvwindow_start;
 
     if (resend_end <= 0)
         return;
@@ -1215,7 +1264,7 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
     
     while (index >= 0)
     {
-        recvobj = &recvwindow[index][player];
+        recvobj = &session->recvwindow[index][player];
 
         if (recvobj->active)
         {
@@ -1239,11 +1288,11 @@ static void NET_SV_ParseGameData(net_packet_t *packet, net_client_t *client)
     if (resend_start < resend_end)
     {
         NET_Log("server: request resend for %d-%d before %d",
-                recvwindow_start + resend_start,
-                recvwindow_start + resend_end - 1, seq);
+                session->recvwindow_start + resend_start,
+                session->recvwindow_start + resend_end - 1, seq);
         NET_SV_SendResendRequest(client, 
-                                 recvwindow_start + resend_start, 
-                                 recvwindow_start + resend_end - 1);
+                                 session->recvwindow_start + resend_start, 
+                                 session->recvwindow_start + resend_end - 1);
     }
 }
 
@@ -1253,10 +1302,10 @@ static void NET_SV_ParseGameDataACK(net_packet_t *packet, net_client_t *client)
 
     NET_Log("server: processing game data ack packet");
 
-    if (server_state != SERVER_IN_GAME)
+    if (session->server_state != SERVER_IN_GAME)
     {
         NET_Log("server: error: not in game state, server_state=%d",
-                server_state);
+                session->server_state);
         return;
     }
 
@@ -1285,6 +1334,7 @@ static void NET_SV_SendTics(net_client_t *client,
                             unsigned int start, unsigned int end)
 {
     net_packet_t *packet;
+    net_full_ticcmd_t *prev;
     unsigned int i;
 
     packet = NET_NewPacket(500);
@@ -1298,6 +1348,8 @@ static void NET_SV_SendTics(net_client_t *client,
 
     // Write the tics
 
+    prev = NULL;
+
     for (i=start; i<=end; ++i)
     {
         net_full_ticcmd_t *cmd;
@@ -1310,9 +1362,25 @@ static void NET_SV_SendTics(net_client_t *client,
         }
 
         // Add command
-       
-        NET_WriteFullTiccmd(packet, cmd, sv_settings.lowres_turn);
+
+        if (client->connection.protocol == NET_PROTOCOL_APDOOM_0)
+        {
+            NET_WriteCompactFullTiccmd(packet, cmd, prev,
+                                       session->sv_settings.lowres_turn);
+        }
+        else
+        {
+            NET_WriteFullTiccmd(packet, cmd, session->sv_settings.lowres_turn);
+        }
+
+        prev = cmd;
     }
+
+    NET_Log("server: sending %d tics in %d bytes", end - start + 1,
+            (int) packet->len);
+
+    ++session->packets_sent;
+    session->bytes_sent += packet->len;
     
     // Send packet
 
@@ -1383,7 +1451,7 @@ void NET_SV_SendQueryResponse(net_addr_t *addr)
 
     // Server state
 
-    querydata.server_state = server_state;
+    querydata.server_state = session->server_state;
 
     // Number of players/maximum players
 
@@ -1392,8 +1460,8 @@ void NET_SV_SendQueryResponse(net_addr_t *addr)
 
     // Game mode/mission
 
-    querydata.gamemode = sv_gamemode;
-    querydata.gamemission = sv_gamemission;
+    querydata.gamemode = session->sv_gamemode;
+    querydata.gamemission = session->sv_gamemission;
 
     //!
     // @category net
@@ -1477,6 +1545,158 @@ static void NET_SV_MasterPacket(net_packet_t *packet)
     }
 }
 
+// [AP] Allocate a new session, with no clients and waiting for a game to
+// be set up. It becomes the current session.
+
+static net_session_t *NET_SV_NewSession(void)
+{
+    session = calloc(1, sizeof(net_session_t));
+
+    if (session == NULL)
+    {
+        I_Error("NET_SV_NewSession: out of memory");
+    }
+
+    NET_SV_AssignPlayers();
+
+    session->server_state = SERVER_WAITING_LAUNCH;
+    session->sv_gamemode = indetermined;
+
+    return session;
+}
+
+static int NET_SV_SessionNumber(void)
+{
+    int i;
+
+    for (i = 0; i < max_sessions; ++i)
+    {
+        if (sessions[i] == session)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// [AP] Statistics for the game that just ended in the current session.
+
+static void NET_SV_ReportSession(void)
+{
+    unsigned int seconds;
+
+    seconds = (I_GetTimeMS() - session->start_time) / 1000;
+
+    NET_Log("server: session %d: game ended after %us, %u players, "
+            "%u tics sent, %u/%u packets and %u/%u bytes in/out",
+            NET_SV_SessionNumber(), seconds, session->num_players,
+            session->tics_sent,
+            session->packets_received, session->packets_sent,
+            session->bytes_received, session->bytes_sent);
+
+    if (max_sessions > 1)
+    {
+        printf("Session %d: game ended after %us, %u players, "
+               "%u tics sent, %u/%u packets and %u/%u bytes in/out\n",
+               NET_SV_SessionNumber(), seconds, session->num_players,
+               session->tics_sent,
+               session->packets_received, session->packets_sent,
+               session->bytes_received, session->bytes_sent);
+    }
+}
+
+// [AP] Find the client a packet came from in any session, and make its
+// session the current one.
+
+static net_client_t *NET_SV_FindSessionClient(net_addr_t *addr)
+{
+    net_client_t *client;
+    int i;
+
+    for (i = 0; i < max_sessions; ++i)
+    {
+        if (sessions[i] != NULL)
+        {
+            session = sessions[i];
+            client = NET_SV_FindClient(addr);
+
+            if (client != NULL)
+            {
+                return client;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// [AP] The session new players should join: the first one that is still
+// waiting for its game to be launched and has room. If there is none, a
+// new session is started if allowed, otherwise the first session gets to
+// turn the player away.
+
+static net_session_t *NET_SV_JoinableSession(boolean create)
+{
+    int i;
+
+    for (i = 0; i < max_sessions; ++i)
+    {
+        if (sessions[i] != NULL)
+        {
+            session = sessions[i];
+
+            if (session->server_state == SERVER_WAITING_LAUNCH
+             && NET_SV_NumClients() < MAXNETNODES
+             && NET_SV_NumPlayers() < NET_SV_MaxPlayers())
+            {
+                return session;
+            }
+        }
+    }
+
+    if (create)
+    {
+        for (i = 0; i < max_sessions; ++i)
+        {
+            if (sessions[i] == NULL)
+            {
+                sessions[i] = NET_SV_NewSession();
+                NET_Log("server: started session %d", i);
+                return sessions[i];
+            }
+        }
+    }
+
+    return sessions[0];
+}
+
+// [AP] Free a session that has no clients left. The first session is
+// kept to answer queries and new players.
+
+static void NET_SV_CheckFreeSession(int i)
+{
+    int j;
+
+    if (i == 0)
+    {
+        return;
+    }
+
+    for (j = 0; j < MAXNETNODES; ++j)
+    {
+        if (sessions[i]->clients[j].active)
+        {
+            return;
+        }
+    }
+
+    NET_Log("server: freeing session %d", i);
+    free(sessions[i]);
+    sessions[i] = NULL;
+    session = sessions[0];
+}
+
 // Process a packet received by the server
 
 static void NET_SV_Packet(net_packet_t *packet, net_addr_t *addr)
@@ -1492,10 +1712,6 @@ static void NET_SV_Packet(net_packet_t *packet, net_addr_t *addr)
         return;
     }
 
-    // Find which client this packet came from
-
-    client = NET_SV_FindClient(addr);
-
     // Read the packet type
 
     if (!NET_ReadInt16(packet, &packet_type))
@@ -1505,6 +1721,18 @@ static void NET_SV_Packet(net_packet_t *packet, net_addr_t *addr)
         return;
     }
 
+    // Find which client this packet came from
+
+    client = NET_SV_FindSessionClient(addr);
+
+    if (client == NULL)
+    {
+        session = NET_SV_JoinableSession(packet_type == NET_PACKET_TYPE_SYN);
+    }
+
+    ++session->packets_received;
+    session->bytes_received += packet->len;
+
     NET_Log("server: packet from %s; type %d", NET_AddrToString(addr),
             packet_type & ~NET_RELIABLE_PACKET);
     NET_LogPacket(packet);
@@ -1573,7 +1801,7 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
     
     // Work out the index into the receive window
    
-    recv_index = client->sendseq - recvwindow_start;
+    recv_index = client->sendseq - session->recvwindow_start;
 
     if (recv_index < 0 || recv_index >= BACKUPTICS)
     {
@@ -1587,19 +1815,19 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
 
     for (i=0; i<NET_MAXPLAYERS; ++i)
     {
-        if (sv_players[i] == client)
+        if (session->sv_players[i] == client)
         {
             // Client does not rely on itself for data
 
             continue;
         }
 
-        if (sv_players[i] == NULL || !ClientConnected(sv_players[i]))
+        if (session->sv_players[i] == NULL || !ClientConnected(session->sv_players[i]))
         {
             continue;
         }
 
-        if (!recvwindow[recv_index][i].active)
+        if (!session->recvwindow[recv_index][i].active)
         {
             // We do not have this player's ticcmd, so we cannot
             // generate a complete command yet.
@@ -1616,7 +1844,7 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
     // and never stopping. Don't let the server get too far ahead
     // of the client.
 
-    if (num_players == 0 && client->sendseq > recvwindow_start + 10)
+    if (num_players == 0 && client->sendseq > session->recvwindow_start + 10)
     {
         return;
     }
@@ -1633,7 +1861,7 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
     {
         net_client_recv_t *recvobj;
 
-        if (sv_players[i] == client)
+        if (session->sv_players[i] == client)
         {
             // Not the player we are sending to
 
@@ -1641,7 +1869,7 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
             continue;
         }
         
-        if (sv_players[i] == NULL || !recvwindow[recv_index][i].active)
+        if (session->sv_players[i] == NULL || !session->recvwindow[recv_index][i].active)
         {
             cmd.playeringame[i] = false;
             continue;
@@ -1649,7 +1877,7 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
 
         cmd.playeringame[i] = true;
 
-        recvobj = &recvwindow[recv_index][i];
+        recvobj = &session->recvwindow[recv_index][i];
 
         cmd.cmds[i] = recvobj->diff;
 
@@ -1662,10 +1890,11 @@ static void NET_SV_PumpSendQueue(net_client_t *client)
     // Add into the queue
 
     client->sendqueue[client->sendseq % BACKUPTICS] = cmd;
+    ++session->tics_sent;
 
     // Transmit the new tic to the client
 
-    starttic = client->sendseq - sv_settings.extratics;
+    starttic = client->sendseq - session->sv_settings.extratics;
     endtic = client->sendseq;
 
     if (starttic < 0)
@@ -1712,16 +1941,16 @@ void NET_SV_CheckDeadlock(net_client_t *client)
 
         for (i=0; i<BACKUPTICS; ++i)
         {
-            if (!recvwindow[i][client->player_number].active)
+            if (!session->recvwindow[i][client->player_number].active)
             {
                 NET_Log("server: deadlock: sending resend request for %d-%d",
-                        recvwindow_start + i, recvwindow_start + i + 5);
+                        session->recvwindow_start + i, session->recvwindow_start + i + 5);
 
                 // Found a tic we haven't received.  Send a resend request.
 
                 NET_SV_SendResendRequest(client,
-                                         recvwindow_start + i,
-                                         recvwindow_start + i + 5);
+                                         session->recvwindow_start + i,
+                                         session->recvwindow_start + i + 5);
 
                 client->last_gamedata_time = nowtime;
                 break;
@@ -1749,14 +1978,19 @@ static void NET_SV_GameEnded(void)
 {
     int i;
 
-    server_state = SERVER_WAITING_LAUNCH;
-    sv_gamemode = indetermined;
+    if (session->server_state == SERVER_IN_GAME)
+    {
+        NET_SV_ReportSession();
+    }
+
+    session->server_state = SERVER_WAITING_LAUNCH;
+    session->sv_gamemode = indetermined;
 
     for (i=0; i<MAXNETNODES; ++i)
     {
-        if (clients[i].active)
+        if (session->clients[i].active)
         {
-            NET_SV_DisconnectClient(&clients[i]);
+            NET_SV_DisconnectClient(&session->clients[i]);
         }
     }
 }
@@ -1787,7 +2021,7 @@ static void NET_SV_RunClient(net_client_t *client)
         // If we were about to start a game, any player disconnecting
         // should cause an abort.
 
-        if (server_state == SERVER_WAITING_START && !client->drone)
+        if (session->server_state == SERVER_WAITING_START && !client->drone)
         {
             NET_SV_BroadcastMessage("Game startup aborted because "
                                     "player '%s' disconnected.",
@@ -1817,7 +2051,7 @@ static void NET_SV_RunClient(net_client_t *client)
         return;
     }
 
-    if (server_state == SERVER_WAITING_LAUNCH)
+    if (session->server_state == SERVER_WAITING_LAUNCH)
     {
         // Waiting for the game to start
 
@@ -1831,7 +2065,7 @@ static void NET_SV_RunClient(net_client_t *client)
         }
     }
 
-    if (server_state == SERVER_IN_GAME)
+    if (session->server_state == SERVER_IN_GAME)
     {
         NET_SV_PumpSendQueue(client);
         NET_SV_CheckDeadlock(client);
@@ -1850,23 +2084,38 @@ void NET_SV_AddModule(net_module_t *module)
 
 void NET_SV_Init(void)
 {
-    int i;
+    int p;
 
     // initialize send/receive context
 
     server_context = NET_NewContext();
 
-    // no clients yet
-   
-    for (i=0; i<MAXNETNODES; ++i) 
+    //!
+    // @category net
+    // @arg <n>
+    //
+    // When running a server, host up to <n> separate games at once.
+    // Players who connect while every game is in progress start a new
+    // one. Statistics are printed as each game ends.
+    //
+
+    p = M_CheckParmWithArgs("-sessions", 1);
+
+    if (p > 0)
     {
-        clients[i].active = false;
+        max_sessions = atoi(myargv[p + 1]);
+
+        if (max_sessions < 1 || max_sessions > MAX_SESSIONS)
+        {
+            I_Error("NET_SV_Init: -sessions must be between 1 and %d",
+                    MAX_SESSIONS);
+        }
     }
 
-    NET_SV_AssignPlayers();
+    // no clients yet
+
+    sessions[0] = NET_SV_NewSession();
 
-    server_state = SERVER_WAITING_LAUNCH;
-    sv_gamemode = indetermined;
     server_initialized = true;
 }
 
@@ -1934,7 +2183,7 @@ void NET_SV_Run(void)
 {
     net_addr_t *addr;
     net_packet_t *packet;
-    int i;
+    int i, s;
 
     if (!server_initialized)
     {
@@ -1953,43 +2202,66 @@ void NET_SV_Run(void)
         UpdateMasterServer();
     }
 
-    // "Run" any clients that may have things to do, independent of responses
-    // to received packets
-
-    for (i=0; i<MAXNETNODES; ++i)
+    for (s = 0; s < max_sessions; ++s)
     {
-        if (clients[i].active)
+        if (sessions[s] == NULL)
         {
-            NET_SV_RunClient(&clients[i]);
+            continue;
         }
-    }
-
-    switch (server_state)
-    {
-        case SERVER_WAITING_LAUNCH:
-            break;
 
-        case SERVER_WAITING_START:
-            CheckStartGame();
-            break;
+        session = sessions[s];
 
-        case SERVER_IN_GAME:
-            NET_SV_AdvanceWindow();
+        // "Run" any clients that may have things to do, independent of
+        // responses to received packets
 
-            for (i = 0; i < NET_MAXPLAYERS; ++i)
+        for (i=0; i<MAXNETNODES; ++i)
+        {
+            if (session->clients[i].active)
             {
-                if (sv_players[i] != NULL && ClientConnected(sv_players[i]))
+                NET_SV_RunClient(&session->clients[i]);
+            }
+        }
+
+        switch (session->server_state)
+        {
+            case SERVER_WAITING_LAUNCH:
+                NET_SV_CheckFreeSession(s);
+                break;
+
+            case SERVER_WAITING_START:
+                CheckStartGame();
+                break;
+
+            case SERVER_IN_GAME:
+                NET_SV_AdvanceWindow();
+
+                for (i = 0; i < NET_MAXPLAYERS; ++i)
                 {
-                    NET_SV_CheckResends(sv_players[i]);
+                    if (session->sv_players[i] != NULL
+                     && ClientConnected(session->sv_players[i]))
+                    {
+                        NET_SV_CheckResends(session->sv_players[i]);
+                    }
                 }
-            }
-            break;
+                break;
+        }
     }
+
+    // [AP] The tic sets and resends above go out together
+    NET_FlushPackets(server_context);
+}
+
+// [AP] Block until a packet arrives for the server or it is time to run
+// its timers again, rather than sleeping and polling.
+
+void NET_SV_WaitForPacket(void)
+{
+    NET_WaitForPacket(server_context, WAIT_TIMEOUT_MS);
 }
 
 void NET_SV_Shutdown(void)
 {
-    int i;
+    int i, s;
     boolean running;
     int start_time;
 
@@ -2001,12 +2273,20 @@ void NET_SV_Shutdown(void)
     fprintf(stderr, "SV: Shutting down server...\n");
 
     // Disconnect all clients
-    
-    for (i=0; i<MAXNETNODES; ++i)
+
+    for (s = 0; s < max_sessions; ++s)
     {
-        if (clients[i].active)
+        if (sessions[s] == NULL)
         {
-            NET_SV_DisconnectClient(&clients[i]);
+            continue;
+        }
+
+        for (i=0; i<MAXNETNODES; ++i)
+        {
+            if (sessions[s]->clients[i].active)
+            {
+                NET_SV_DisconnectClient(&sessions[s]->clients[i]);
+            }
         }
     }
 
@@ -2021,11 +2301,14 @@ void NET_SV_Shutdown(void)
 
         running = false;
 
-        for (i=0; i<MAXNETNODES; ++i)
+        for (s = 0; s < max_sessions; ++s)
         {
-            if (clients[i].active)
+            for (i=0; sessions[s] != NULL && i<MAXNETNODES; ++i)
             {
-                running = true;
+                if (sessions[s]->clients[i].active)
+                {
+                    running = true;
+                }
             }
         }
 
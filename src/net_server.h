@@ -25,6 +25,10 @@ void NET_SV_Init(void);
 
 void NET_SV_Run(void);
 
+// [AP] Wait for the next packet, or until the server has timers to run.
+
+void NET_SV_WaitForPacket(void);
+
 // Shut down the server
 // Blocks until all clients disconnect, or until a 5 second timeout
 
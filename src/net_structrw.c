@@ -32,6 +32,7 @@ static struct
     const char *name;
 } protocol_names[] = {
     {NET_PROTOCOL_CHOCOLATE_DOOM_0, "CHOCOLATE_DOOM_0"},
+    {NET_PROTOCOL_APDOOM_0,         "APDOOM_0"},
 };
 
 void NET_WriteConnectData(net_packet_t *packet, net_connect_data_t *data)
@@ -457,6 +458,169 @@ void NET_WriteFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd, boolean l
     }
 }
 
+//
+// [AP] Compact net_full_ticcmd_t, for NET_PROTOCOL_APDOOM_0
+//
+// Each tic starts with a flags byte. The players-in-game bitfield and the
+// latency are only written when they differ from the previous tic in the
+// packet (prev, NULL for the first one), and players whose ticcmd did not
+// change at all are left out, rather than sent as an empty diff.
+//
+
+#define COMPACT_TIC_INGAME   (1 << 0)
+#define COMPACT_TIC_LATENCY  (1 << 1)
+#define COMPACT_TIC_CHANGED  (1 << 2)
+
+boolean NET_ReadCompactFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd,
+                                  net_full_ticcmd_t *prev, boolean lowres_turn)
+{
+    unsigned int flags;
+    unsigned int bitfield;
+    unsigned int changed;
+    int i;
+
+    if (!NET_ReadInt8(packet, &flags))
+    {
+        return false;
+    }
+
+    if (flags & COMPACT_TIC_INGAME)
+    {
+        if (!NET_ReadInt8(packet, &bitfield))
+        {
+            return false;
+        }
+
+        for (i=0; i<NET_MAXPLAYERS; ++i)
+        {
+            cmd->playeringame[i] = (bitfield & (1 << i)) != 0;
+        }
+    }
+    else if (prev != NULL)
+    {
+        memcpy(cmd->playeringame, prev->playeringame,
+               sizeof(cmd->playeringame));
+    }
+    else
+    {
+        return false;
+    }
+
+    if (flags & COMPACT_TIC_LATENCY)
+    {
+        if (!NET_ReadSInt16(packet, &cmd->latency))
+        {
+            return false;
+        }
+    }
+    else if (prev != NULL)
+    {
+        cmd->latency = prev->latency;
+    }
+    else
+    {
+        return false;
+    }
+
+    changed = 0;
+
+    if ((flags & COMPACT_TIC_CHANGED) && !NET_ReadInt8(packet, &changed))
+    {
+        return false;
+    }
+
+    for (i=0; i<NET_MAXPLAYERS; ++i)
+    {
+        if (!cmd->playeringame[i])
+        {
+            continue;
+        }
+
+        if (changed & (1 << i))
+        {
+            if (!NET_ReadTiccmdDiff(packet, &cmd->cmds[i], lowres_turn))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            memset(&cmd->cmds[i], 0, sizeof(net_ticdiff_t));
+        }
+    }
+
+    return true;
+}
+
+void NET_WriteCompactFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd,
+                                net_full_ticcmd_t *prev, boolean lowres_turn)
+{
+    unsigned int flags;
+    unsigned int bitfield;
+    unsigned int changed;
+    int i;
+
+    bitfield = 0;
+    changed = 0;
+
+    for (i=0; i<NET_MAXPLAYERS; ++i)
+    {
+        if (cmd->playeringame[i])
+        {
+            bitfield |= 1 << i;
+
+            if (cmd->cmds[i].diff != 0)
+            {
+                changed |= 1 << i;
+            }
+        }
+    }
+
+    flags = 0;
+
+    if (prev == NULL
+     || memcmp(cmd->playeringame, prev->playeringame,
+               sizeof(cmd->playeringame)) != 0)
+    {
+        flags |= COMPACT_TIC_INGAME;
+    }
+
+    if (prev == NULL || cmd->latency != prev->latency)
+    {
+        flags |= COMPACT_TIC_LATENCY;
+    }
+
+    if (changed != 0)
+    {
+        flags |= COMPACT_TIC_CHANGED;
+    }
+
+    NET_WriteInt8(packet, flags);
+
+    if (flags & COMPACT_TIC_INGAME)
+    {
+        NET_WriteInt8(packet, bitfield);
+    }
+
+    if (flags & COMPACT_TIC_LATENCY)
+    {
+        NET_WriteInt16(packet, cmd->latency);
+    }
+
+    if (flags & COMPACT_TIC_CHANGED)
+    {
+        NET_WriteInt8(packet, changed);
+    }
+
+    for (i=0; i<NET_MAXPLAYERS; ++i)
+    {
+        if (changed & (1 << i))
+        {
+            NET_WriteTiccmdDiff(packet, &cmd->cmds[i], lowres_turn);
+        }
+    }
+}
+
 void NET_WriteWaitData(net_packet_t *packet, net_waitdata_t *data)
 {
     int i;
@@ -36,6 +36,10 @@ extern void NET_TiccmdPatch(ticcmd_t *src, net_ticdiff_t *diff, ticcmd_t *dest);
 
 boolean NET_ReadFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd, boolean lowres_turn);
 void NET_WriteFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd, boolean lowres_turn);
+boolean NET_ReadCompactFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd,
+                                  net_full_ticcmd_t *prev, boolean lowres_turn);
+void NET_WriteCompactFullTiccmd(net_packet_t *packet, net_full_ticcmd_t *cmd,
+                                net_full_ticcmd_t *prev, boolean lowres_turn);
 
 boolean NET_ReadSHA1Sum(net_packet_t *packet, sha1_digest_t digest);
 void NET_WriteSHA1Sum(net_packet_t *packet, sha1_digest_t digest);
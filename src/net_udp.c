@@ -0,0 +1,792 @@
+//
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//     [AP] Networking module on the system's own sockets, for the
+//     dedicated server. One non-blocking socket for IPv6 and IPv4 both;
+//     on Linux, packets are received and sent in batches with
+//     recvmmsg/sendmmsg, so a busy server makes one syscall for many
+//     packets instead of one for each.
+//
+
+#ifdef __linux__
+#define _GNU_SOURCE // recvmmsg, sendmmsg
+#define HAVE_MMSG
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600 // inet_ntop
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef int socklen_t;
+#define SocketError() WSAGetLastError()
+#define SOCKET_WOULDBLOCK WSAEWOULDBLOCK
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+typedef int SOCKET;
+#define INVALID_SOCKET (-1)
+#define closesocket close
+#define SocketError() errno
+#define SOCKET_WOULDBLOCK EWOULDBLOCK
+#endif
+
+#include "doomtype.h"
+#include "i_system.h"
+#include "i_timer.h"
+#include "m_argv.h"
+#include "m_misc.h"
+#include "net_defs.h"
+#include "net_io.h"
+#include "net_packet.h"
+#include "net_udp.h"
+#include "z_zone.h"
+
+#define DEFAULT_PORT 2342
+
+// Packets received or sent per syscall, and the largest one batched;
+// bigger ones are sent on their own.
+#define UDP_BATCH 32
+#define UDP_MAX_PACKET 1500
+
+static boolean initted = false;
+static int port = DEFAULT_PORT;
+static SOCKET udpsocket = INVALID_SOCKET;
+static int udp_family;
+
+// Addresses are kept as IPv6, with IPv4 ones mapped (::ffff:a.b.c.d),
+// whatever the socket is, so each has one form to hash and compare.
+
+typedef struct
+{
+    struct in6_addr host;
+    uint16_t port;              // network byte order
+    uint32_t scope_id;
+} udpaddr_t;
+
+// Same as net_sdl.c: a hash table chained through the entries, which go
+// as their last reference is released.
+
+typedef struct addrpair_s
+{
+    net_addr_t net_addr;
+    udpaddr_t udp_addr;
+    struct addrpair_s *next;
+} addrpair_t;
+
+static addrpair_t **addr_table;
+static int addr_table_size = -1;
+static int addr_table_count = 0;
+
+static const byte v4mapped_prefix[12] =
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff };
+
+static void NET_UDP_InitAddrTable(void)
+{
+    addr_table_size = 16;
+
+    addr_table = Z_Malloc(sizeof(addrpair_t *) * addr_table_size,
+                          PU_STATIC, 0);
+    memset(addr_table, 0, sizeof(addrpair_t *) * addr_table_size);
+}
+
+static boolean AddressesEqual(const udpaddr_t *a, const udpaddr_t *b)
+{
+    return a->port == b->port
+        && a->scope_id == b->scope_id
+        && !memcmp(&a->host, &b->host, sizeof(a->host));
+}
+
+static unsigned int AddressHash(const udpaddr_t *addr)
+{
+    const byte *host = (const byte *) &addr->host;
+    unsigned int hash = 2166136261u;
+    int i;
+
+    for (i = 0; i < (int) sizeof(addr->host); ++i)
+    {
+        hash = (hash ^ host[i]) * 16777619u;
+    }
+
+    hash = (hash ^ addr->port) * 16777619u;
+
+    return hash & (addr_table_size - 1);
+}
+
+static void NET_UDP_GrowAddrTable(void)
+{
+    addrpair_t **old_addr_table = addr_table;
+    int old_addr_table_size = addr_table_size;
+    addrpair_t *entry, *next;
+    unsigned int hash;
+    int i;
+
+    addr_table_size *= 2;
+    addr_table = Z_Malloc(sizeof(addrpair_t *) * addr_table_size,
+                          PU_STATIC, 0);
+    memset(addr_table, 0, sizeof(addrpair_t *) * addr_table_size);
+
+    for (i=0; i<old_addr_table_size; ++i)
+    {
+        for (entry = old_addr_table[i]; entry != NULL; entry = next)
+        {
+            next = entry->next;
+            hash = AddressHash(&entry->udp_addr);
+            entry->next = addr_table[hash];
+            addr_table[hash] = entry;
+        }
+    }
+
+    Z_Free(old_addr_table);
+}
+
+static net_addr_t *NET_UDP_FindAddress(const udpaddr_t *addr)
+{
+    addrpair_t *new_entry;
+    addrpair_t *entry;
+    unsigned int hash;
+
+    if (addr_table_size < 0)
+    {
+        NET_UDP_InitAddrTable();
+    }
+
+    hash = AddressHash(addr);
+
+    for (entry = addr_table[hash]; entry != NULL; entry = entry->next)
+    {
+        if (AddressesEqual(addr, &entry->udp_addr))
+        {
+            return &entry->net_addr;
+        }
+    }
+
+    if (addr_table_count >= addr_table_size)
+    {
+        NET_UDP_GrowAddrTable();
+        hash = AddressHash(addr);
+    }
+
+    new_entry = Z_Malloc(sizeof(addrpair_t), PU_STATIC, 0);
+
+    new_entry->udp_addr = *addr;
+    new_entry->net_addr.refcount = 0;
+    new_entry->net_addr.handle = &new_entry->udp_addr;
+    new_entry->net_addr.module = &net_udp_module;
+
+    new_entry->next = addr_table[hash];
+    addr_table[hash] = new_entry;
+    ++addr_table_count;
+
+    return &new_entry->net_addr;
+}
+
+static void NET_UDP_FreeAddress(net_addr_t *addr)
+{
+    addrpair_t **link;
+
+    if (addr_table_size > 0)
+    {
+        link = &addr_table[AddressHash(addr->handle)];
+
+        for (; *link != NULL; link = &(*link)->next)
+        {
+            if (addr == &(*link)->net_addr)
+            {
+                addrpair_t *entry = *link;
+
+                *link = entry->next;
+                Z_Free(entry);
+                --addr_table_count;
+                return;
+            }
+        }
+    }
+
+    I_Error("NET_UDP_FreeAddress: Attempted to remove an unused address!");
+}
+
+static boolean IsMappedV4(const udpaddr_t *addr)
+{
+    return !memcmp(&addr->host, v4mapped_prefix, sizeof(v4mapped_prefix));
+}
+
+// Converts a socket address to the kept form. Returns false for other
+// families.
+
+static boolean FromSockaddr(const struct sockaddr *sa, udpaddr_t *addr)
+{
+    memset(addr, 0, sizeof(*addr));
+
+    if (sa->sa_family == AF_INET6)
+    {
+        const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *) sa;
+
+        addr->host = sin6->sin6_addr;
+        addr->port = sin6->sin6_port;
+        addr->scope_id = sin6->sin6_scope_id;
+        return true;
+    }
+    else if (sa->sa_family == AF_INET)
+    {
+        const struct sockaddr_in *sin = (const struct sockaddr_in *) sa;
+
+        memcpy(&addr->host, v4mapped_prefix, sizeof(v4mapped_prefix));
+        memcpy((byte *) &addr->host + 12, &sin->sin_addr, 4);
+        addr->port = sin->sin_port;
+        return true;
+    }
+
+    return false;
+}
+
+// Converts the kept form to an address for our socket. IPv6 addresses
+// can't be reached from an IPv4 only socket.
+
+static boolean ToSockaddr(const udpaddr_t *addr,
+                          struct sockaddr_storage *ss, socklen_t *len)
+{
+    memset(ss, 0, sizeof(*ss));
+
+    if (udp_family == AF_INET6)
+    {
+        struct sockaddr_in6 *sin6 = (struct sockaddr_in6 *) ss;
+
+        sin6->sin6_family = AF_INET6;
+        sin6->sin6_addr = addr->host;
+        sin6->sin6_port = addr->port;
+        sin6->sin6_scope_id = addr->scope_id;
+        *len = sizeof(*sin6);
+        return true;
+    }
+    else if (IsMappedV4(addr))
+    {
+        struct sockaddr_in *sin = (struct sockaddr_in *) ss;
+
+        sin->sin_family = AF_INET;
+        memcpy(&sin->sin_addr, (const byte *) &addr->host + 12, 4);
+        sin->sin_port = addr->port;
+        *len = sizeof(*sin);
+        return true;
+    }
+
+    return false;
+}
+
+static boolean SetNonBlocking(SOCKET s)
+{
+#ifdef _WIN32
+    u_long on = 1;
+
+    return ioctlsocket(s, FIONBIO, &on) == 0;
+#else
+    int flags = fcntl(s, F_GETFL, 0);
+
+    return flags >= 0 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+
+// Opens the socket on the given port, 0 for any. Prefers one IPv6 socket
+// that takes IPv4 too, and falls back to IPv4 where there's no IPv6.
+
+static boolean OpenSocket(int bind_port)
+{
+    struct sockaddr_storage ss;
+    socklen_t len;
+    int on = 1, off = 0;
+
+    memset(&ss, 0, sizeof(ss));
+
+    udpsocket = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (udpsocket != INVALID_SOCKET
+     && setsockopt(udpsocket, IPPROTO_IPV6, IPV6_V6ONLY,
+                   (const char *) &off, sizeof(off)) == 0)
+    {
+        struct sockaddr_in6 *sin6 = (struct sockaddr_in6 *) &ss;
+
+        udp_family = AF_INET6;
+        sin6->sin6_family = AF_INET6;
+        sin6->sin6_addr = in6addr_any;
+        sin6->sin6_port = htons(bind_port);
+        len = sizeof(*sin6);
+    }
+    else
+    {
+        struct sockaddr_in *sin = (struct sockaddr_in *) &ss;
+
+        if (udpsocket != INVALID_SOCKET)
+        {
+            closesocket(udpsocket);
+        }
+
+        udpsocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (udpsocket == INVALID_SOCKET)
+        {
+            return false;
+        }
+
+        udp_family = AF_INET;
+        sin->sin_family = AF_INET;
+        sin->sin_addr.s_addr = htonl(INADDR_ANY);
+        sin->sin_port = htons(bind_port);
+        len = sizeof(*sin);
+    }
+
+    // For the LAN search
+    setsockopt(udpsocket, SOL_SOCKET, SO_BROADCAST,
+               (const char *) &on, sizeof(on));
+
+    if (bind(udpsocket, (struct sockaddr *) &ss, len) != 0
+     || !SetNonBlocking(udpsocket))
+    {
+        closesocket(udpsocket);
+        udpsocket = INVALID_SOCKET;
+        return false;
+    }
+
+    return true;
+}
+
+static boolean NET_UDP_Init(int bind_port)
+{
+#ifdef _WIN32
+    WSADATA wsadata;
+
+    if (WSAStartup(MAKEWORD(2, 2), &wsadata) != 0)
+    {
+        return false;
+    }
+#endif
+
+    if (!OpenSocket(bind_port))
+    {
+        return false;
+    }
+
+    initted = true;
+
+    return true;
+}
+
+static boolean NET_UDP_InitClient(void)
+{
+    int p;
+
+    if (initted)
+        return true;
+
+    //!
+    // @category net
+    // @arg <n>
+    //
+    // Use the specified UDP port for communications, instead of
+    // the default (2342).
+    //
+
+    p = M_CheckParmWithArgs("-port", 1);
+    if (p > 0)
+        port = atoi(myargv[p+1]);
+
+    if (!NET_UDP_Init(0))
+    {
+        I_Error("NET_UDP_InitClient: Unable to open a socket");
+    }
+
+    return true;
+}
+
+static boolean NET_UDP_InitServer(void)
+{
+    int p;
+
+    if (initted)
+        return true;
+
+    p = M_CheckParmWithArgs("-port", 1);
+    if (p > 0)
+        port = atoi(myargv[p+1]);
+
+    if (!NET_UDP_Init(port))
+    {
+        I_Error("NET_UDP_InitServer: Unable to bind to port %i", port);
+    }
+
+    return true;
+}
+
+// Sending. Elsewhere packets go out as they're sent; with sendmmsg they
+// wait here until the batch fills or the caller is done sending, see
+// NET_UDP_FlushPackets.
+
+#ifdef HAVE_MMSG
+static byte send_data[UDP_BATCH][UDP_MAX_PACKET];
+static struct sockaddr_storage send_addrs[UDP_BATCH];
+static struct iovec send_iov[UDP_BATCH];
+static struct mmsghdr send_msgs[UDP_BATCH];
+static int send_count = 0;
+#endif
+
+static void NET_UDP_FlushPackets(void)
+{
+#ifdef HAVE_MMSG
+    int sent = 0;
+
+    while (sent < send_count)
+    {
+        int result = sendmmsg(udpsocket, send_msgs + sent,
+                              send_count - sent, 0);
+
+        if (result <= 0)
+        {
+            // A full socket buffer drops the rest, like the network would
+            break;
+        }
+
+        sent += result;
+    }
+
+    send_count = 0;
+#endif
+}
+
+static void NET_UDP_SendPacket(net_addr_t *addr, net_packet_t *packet)
+{
+    struct sockaddr_storage ss;
+    socklen_t len;
+
+    if (addr == &net_broadcast_addr)
+    {
+        udpaddr_t broadcast;
+
+        memset(&broadcast, 0, sizeof(broadcast));
+        memcpy(&broadcast.host, v4mapped_prefix, sizeof(v4mapped_prefix));
+        memset((byte *) &broadcast.host + 12, 0xff, 4);
+        broadcast.port = htons(port);
+
+        if (!ToSockaddr(&broadcast, &ss, &len))
+            return;
+    }
+    else if (!ToSockaddr(addr->handle, &ss, &len))
+    {
+        return;
+    }
+
+#ifdef HAVE_MMSG
+    if (packet->len <= UDP_MAX_PACKET)
+    {
+        struct mmsghdr *msg;
+
+        if (send_count == UDP_BATCH)
+        {
+            NET_UDP_FlushPackets();
+        }
+
+        memcpy(send_data[send_count], packet->data, packet->len);
+        send_addrs[send_count] = ss;
+        send_iov[send_count].iov_base = send_data[send_count];
+        send_iov[send_count].iov_len = packet->len;
+
+        msg = &send_msgs[send_count];
+        memset(msg, 0, sizeof(*msg));
+        msg->msg_hdr.msg_name = &send_addrs[send_count];
+        msg->msg_hdr.msg_namelen = len;
+        msg->msg_hdr.msg_iov = &send_iov[send_count];
+        msg->msg_hdr.msg_iovlen = 1;
+
+        ++send_count;
+        return;
+    }
+
+    // Too big to batch. Keep the order packets were sent in.
+    NET_UDP_FlushPackets();
+#endif
+
+    // Failures are dropped packets, which the protocol already copes with
+    sendto(udpsocket, (const char *) packet->data, (int) packet->len, 0,
+           (struct sockaddr *) &ss, len);
+}
+
+// Receiving. With recvmmsg one call fills a batch, which is then handed
+// out a packet at a time.
+
+#ifdef HAVE_MMSG
+static byte recv_data[UDP_BATCH][UDP_MAX_PACKET];
+static struct sockaddr_storage recv_addrs[UDP_BATCH];
+static struct iovec recv_iov[UDP_BATCH];
+static struct mmsghdr recv_msgs[UDP_BATCH];
+static int recv_count = 0, recv_next = 0;
+
+static boolean ReceiveBatch(void)
+{
+    int i, result;
+
+    // Replies to the last batch go out before reading the next
+    NET_UDP_FlushPackets();
+
+    for (i = 0; i < UDP_BATCH; ++i)
+    {
+        recv_iov[i].iov_base = recv_data[i];
+        recv_iov[i].iov_len = UDP_MAX_PACKET;
+        memset(&recv_msgs[i], 0, sizeof(recv_msgs[i]));
+        recv_msgs[i].msg_hdr.msg_name = &recv_addrs[i];
+        recv_msgs[i].msg_hdr.msg_namelen = sizeof(recv_addrs[i]);
+        recv_msgs[i].msg_hdr.msg_iov = &recv_iov[i];
+        recv_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    result = recvmmsg(udpsocket, recv_msgs, UDP_BATCH, 0, NULL);
+
+    if (result <= 0)
+    {
+        if (result < 0 && errno != EAGAIN && errno != EWOULDBLOCK
+         && errno != EINTR && errno != ECONNREFUSED)
+        {
+            I_Error("NET_UDP_RecvPacket: Error receiving packet: %s",
+                    strerror(errno));
+        }
+        return false;
+    }
+
+    recv_count = result;
+    recv_next = 0;
+
+    return true;
+}
+#endif
+
+static boolean NET_UDP_RecvPacket(net_addr_t **addr, net_packet_t **packet)
+{
+    udpaddr_t from;
+    const byte *data;
+    size_t len;
+
+    if (!initted)
+        return false;
+
+#ifdef HAVE_MMSG
+    do
+    {
+        if (recv_next >= recv_count && !ReceiveBatch())
+        {
+            return false;
+        }
+
+        data = recv_data[recv_next];
+        len = recv_msgs[recv_next].msg_len;
+        ++recv_next;
+    } while (!FromSockaddr((struct sockaddr *) &recv_addrs[recv_next - 1],
+                           &from));
+#else
+    {
+        static byte recv_buffer[UDP_MAX_PACKET];
+        struct sockaddr_storage ss;
+        socklen_t sslen;
+        int result;
+
+        do
+        {
+            sslen = sizeof(ss);
+            result = recvfrom(udpsocket, (char *) recv_buffer,
+                              sizeof(recv_buffer), 0,
+                              (struct sockaddr *) &ss, &sslen);
+
+            if (result < 0)
+            {
+                int error = SocketError();
+
+#ifdef _WIN32
+                // An earlier send was refused; nothing to read
+                if (error == WSAECONNRESET || error == WSAEMSGSIZE)
+                    return false;
+#endif
+                if (error != SOCKET_WOULDBLOCK && error != EINTR)
+                {
+                    I_Error("NET_UDP_RecvPacket: Error receiving packet: %i",
+                            error);
+                }
+                return false;
+            }
+        } while (!FromSockaddr((struct sockaddr *) &ss, &from));
+
+        data = recv_buffer;
+        len = result;
+    }
+#endif
+
+    // Put the data into a new packet structure
+
+    *packet = NET_NewPacket(len);
+    memcpy((*packet)->data, data, len);
+    (*packet)->len = len;
+
+    *addr = NET_UDP_FindAddress(&from);
+
+    return true;
+}
+
+static void NET_UDP_AddrToString(net_addr_t *addr, char *buffer,
+                                 int buffer_len)
+{
+    const udpaddr_t *udp_addr = addr->handle;
+    char host[INET6_ADDRSTRLEN];
+    int addr_port = ntohs(udp_addr->port);
+
+    if (IsMappedV4(udp_addr))
+    {
+        const byte *v4 = (const byte *) &udp_addr->host + 12;
+
+        M_snprintf(host, sizeof(host), "%i.%i.%i.%i",
+                   v4[0], v4[1], v4[2], v4[3]);
+    }
+    else if (inet_ntop(AF_INET6, (void *) &udp_addr->host,
+                       host, sizeof(host)) == NULL)
+    {
+        M_StringCopy(host, "?", sizeof(host));
+    }
+
+    // As net_sdl.c, the port is left out when it's the default. IPv6
+    // addresses go in brackets when it isn't, so the colons aren't
+    // mistaken for it.
+    if (addr_port == DEFAULT_PORT)
+    {
+        M_StringCopy(buffer, host, buffer_len);
+    }
+    else if (IsMappedV4(udp_addr))
+    {
+        M_snprintf(buffer, buffer_len, "%s:%i", host, addr_port);
+    }
+    else
+    {
+        M_snprintf(buffer, buffer_len, "[%s]:%i", host, addr_port);
+    }
+}
+
+// Accepts host, host:port, an IPv6 address, or [IPv6 address]:port.
+
+static net_addr_t *NET_UDP_ResolveAddress(const char *address)
+{
+    struct addrinfo hints, *result, *ai;
+    net_addr_t *found = NULL;
+    char *hostname;
+    char portstr[8];
+    int addr_port = port;
+    char *colon;
+    udpaddr_t udp_addr;
+
+    hostname = M_StringDuplicate(address);
+
+    if (hostname[0] == '[' && (colon = strchr(hostname, ']')) != NULL)
+    {
+        *colon = '\0';
+        if (colon[1] == ':')
+        {
+            addr_port = atoi(colon + 2);
+        }
+        memmove(hostname, hostname + 1, strlen(hostname));
+    }
+    else if ((colon = strchr(hostname, ':')) != NULL
+          && strchr(colon + 1, ':') == NULL)
+    {
+        *colon = '\0';
+        addr_port = atoi(colon + 1);
+    }
+
+    M_snprintf(portstr, sizeof(portstr), "%i", addr_port);
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = udp_family == AF_INET ? AF_INET : AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    if (getaddrinfo(hostname, portstr, &hints, &result) == 0)
+    {
+        // Prefer IPv4 addresses, which both kinds of socket can reach
+        for (ai = result; ai != NULL && found == NULL; ai = ai->ai_next)
+        {
+            if (ai->ai_family == AF_INET
+             && FromSockaddr(ai->ai_addr, &udp_addr))
+            {
+                found = NET_UDP_FindAddress(&udp_addr);
+            }
+        }
+        for (ai = result; ai != NULL && found == NULL; ai = ai->ai_next)
+        {
+            if (FromSockaddr(ai->ai_addr, &udp_addr))
+            {
+                found = NET_UDP_FindAddress(&udp_addr);
+            }
+        }
+
+        freeaddrinfo(result);
+    }
+
+    free(hostname);
+
+    return found;
+}
+
+static void NET_UDP_WaitPacket(int timeout_ms)
+{
+    struct timeval tv;
+    fd_set set;
+
+#ifdef HAVE_MMSG
+    if (recv_next < recv_count)
+    {
+        return;
+    }
+#endif
+
+    if (udpsocket == INVALID_SOCKET)
+    {
+        I_Sleep(1);
+        return;
+    }
+
+    FD_ZERO(&set);
+    FD_SET(udpsocket, &set);
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+
+    if (select((int) udpsocket + 1, &set, NULL, NULL, &tv) < 0)
+    {
+        // select() can be interrupted; don't spin if it keeps failing.
+        I_Sleep(1);
+    }
+}
+
+net_module_t net_udp_module =
+{
+    NET_UDP_InitClient,
+    NET_UDP_InitServer,
+    NET_UDP_SendPacket,
+    NET_UDP_RecvPacket,
+    NET_UDP_AddrToString,
+    NET_UDP_FreeAddress,
+    NET_UDP_ResolveAddress,
+    NET_UDP_WaitPacket,
+    NET_UDP_FlushPackets,
+};
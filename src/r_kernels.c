@@ -0,0 +1,323 @@
+//
+// Copyright(C) 1993-1996 Id Software, Inc.
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Column and span inner loops shared by the games' renderers.
+//
+
+#include <stddef.h>
+
+#include "r_kernels.h"
+
+// [AP] AVX2 gathers for spans, picked at run time. Spans write a row of
+// neighbouring pixels, so eight can be looked up and stored at once.
+// Columns step a whole row per pixel, and with no scatter to store them
+// the scalar loop is as quick; nor is there a gather on ARM to detect.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_KERNELS_AVX2
+#include <immintrin.h>
+#endif
+
+#define COLUMN_BRIGHT    1
+#define COLUMN_TRANSLATE 2
+#define COLUMN_BLEND     4
+#define COLUMN_BLENDSWAP 8
+
+static inline pixel_t BlendPixel (const byte *blend, const int flags,
+                                  const pixel_t bg, const pixel_t fg)
+{
+#ifndef CRISPY_TRUECOLOR
+    if (flags & COLUMN_BLEND)
+	return blend[(bg << 8) + fg];
+    if (flags & COLUMN_BLENDSWAP)
+	return blend[(fg << 8) + bg];
+#endif
+    return fg;
+}
+
+// Inlined for each combination of flags below, so every drawer gets its
+// own copy of the loops with only the lookups it needs. The parameters
+// are copied to locals, framebuffer stores could otherwise alias them and
+// force a reload every pixel.
+
+static inline void ColumnLoop (const r_column_t *column, const int flags)
+{
+    pixel_t *dest = column->dest;
+    const int pitch = column->pitch;
+    const int twin = column->twin;
+    const byte *const source = column->source;
+    const pixel_t *const colormap0 = column->colormap[0];
+    const pixel_t *const colormap1 = column->colormap[1];
+    const byte *const brightmap = column->brightmap;
+    const byte *const translation = column->translation;
+    const byte *const blend = column->blend;
+    fixed_t frac = column->frac;
+    const fixed_t fracstep = column->fracstep;
+    int heightmask = column->texheight - 1;
+    int count = column->count;
+
+#define COLUMN_PIXEL(index) \
+    { \
+	byte texel = source[index]; \
+	pixel_t pixel; \
+	if (flags & COLUMN_TRANSLATE) \
+	    texel = translation[texel]; \
+	/* [crispy] brightmaps */ \
+	pixel = (flags & COLUMN_BRIGHT) && brightmap[texel] ? \
+	        colormap1[texel] : colormap0[texel]; \
+	if (twin) \
+	    dest[twin] = BlendPixel(blend, flags, dest[twin], pixel); \
+	*dest = BlendPixel(blend, flags, *dest, pixel); \
+	dest += pitch; \
+    }
+
+    // heightmask is the Tutti-Frutti fix -- killough
+    if (column->texheight & heightmask) // not a power of 2 -- killough
+    {
+	heightmask++;
+	heightmask <<= FRACBITS;
+
+	if (frac < 0)
+	    while ((frac += heightmask) < 0);
+	else
+	    while (frac >= heightmask)
+		frac -= heightmask;
+
+	do
+	{
+	    COLUMN_PIXEL(frac >> FRACBITS);
+	    if ((frac += fracstep) >= heightmask)
+		frac -= heightmask;
+	} while (--count);
+    }
+    else // texture height is a power of 2, or no wrapping at all
+    {
+	do
+	{
+	    COLUMN_PIXEL((frac >> FRACBITS) & heightmask);
+	    frac += fracstep;
+	} while (--count);
+    }
+
+#undef COLUMN_PIXEL
+}
+
+void R_KernelColumn (const r_column_t *column)
+{
+    int flags = 0;
+
+    if (column->brightmap != NULL
+     && column->colormap[0] != column->colormap[1])
+	flags |= COLUMN_BRIGHT;
+    if (column->translation != NULL)
+	flags |= COLUMN_TRANSLATE;
+#ifndef CRISPY_TRUECOLOR
+    if (column->blend != NULL)
+	flags |= column->blendswap ? COLUMN_BLENDSWAP : COLUMN_BLEND;
+#endif
+
+#define COLUMN_CASE(f) case (f): ColumnLoop(column, (f)); break;
+    switch (flags)
+    {
+	COLUMN_CASE(0)
+	COLUMN_CASE(COLUMN_BRIGHT)
+	COLUMN_CASE(COLUMN_TRANSLATE)
+	COLUMN_CASE(COLUMN_BRIGHT | COLUMN_TRANSLATE)
+	COLUMN_CASE(COLUMN_BLEND)
+	COLUMN_CASE(COLUMN_BRIGHT | COLUMN_BLEND)
+	COLUMN_CASE(COLUMN_TRANSLATE | COLUMN_BLEND)
+	COLUMN_CASE(COLUMN_BRIGHT | COLUMN_TRANSLATE | COLUMN_BLEND)
+	COLUMN_CASE(COLUMN_BLENDSWAP)
+	COLUMN_CASE(COLUMN_BRIGHT | COLUMN_BLENDSWAP)
+	COLUMN_CASE(COLUMN_TRANSLATE | COLUMN_BLENDSWAP)
+	COLUMN_CASE(COLUMN_BRIGHT | COLUMN_TRANSLATE | COLUMN_BLENDSWAP)
+    }
+#undef COLUMN_CASE
+}
+
+// Flats are 64x64, x in the bottom six bits of the index and y above.
+// [crispy] fix flats getting more distorted the closer they are to the right
+#define SPAN_SPOT(xfrac, yfrac) \
+    ((((yfrac) >> 10) & 0x0fc0) | (((xfrac) >> 16) & 0x3f))
+
+static inline void SpanLoop (const r_span_t *span, const boolean bright)
+{
+    pixel_t *dest = span->dest;
+    const int step = span->step;
+    const int twin = span->twin;
+    const byte *const source = span->source;
+    const pixel_t *const colormap0 = span->colormap[0];
+    const pixel_t *const colormap1 = span->colormap[1];
+    const byte *const brightmap = span->brightmap;
+    fixed_t xfrac = span->xfrac, yfrac = span->yfrac;
+    const fixed_t xstep = span->xstep, ystep = span->ystep;
+    int count = span->count;
+
+    do
+    {
+	const byte texel = source[SPAN_SPOT(xfrac, yfrac)];
+	// [crispy] brightmaps
+	const pixel_t pixel = bright && brightmap[texel] ?
+	                      colormap1[texel] : colormap0[texel];
+
+	*dest = pixel;
+	if (twin)
+	    dest[twin] = pixel;
+	dest += step;
+	xfrac += xstep;
+	yfrac += ystep;
+    } while (--count);
+}
+
+static void SpanScalar (const r_span_t *span)
+{
+    if (span->brightmap != NULL && span->colormap[0] != span->colormap[1])
+	SpanLoop(span, true);
+    else
+	SpanLoop(span, false);
+}
+
+#ifdef HAVE_KERNELS_AVX2
+
+// The gathers load 32 bits at a time. Byte tables are read from three
+// bytes before the wanted one and shifted down, so they never read past
+// the end of a flat or colormap; what's before them is the zone block
+// header or the lump before in the WAD. Brightmaps can be plain arrays,
+// so they're widened into a table of their own instead.
+
+static int bright_wide[256];
+static const byte *bright_wide_map = NULL;
+
+__attribute__((target("avx2")))
+static inline __m256i GatherBytes (const byte *table, const __m256i index)
+{
+    return _mm256_srli_epi32(
+        _mm256_i32gather_epi32((const int *) (table - 3), index, 1), 24);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i GatherPixels (const pixel_t *colormap,
+                                    const __m256i index)
+{
+#ifndef CRISPY_TRUECOLOR
+    return GatherBytes(colormap, index);
+#else
+    return _mm256_i32gather_epi32((const int *) colormap, index, 4);
+#endif
+}
+
+__attribute__((target("avx2")))
+static inline void StorePixels (pixel_t *dest, const __m256i pixels)
+{
+#ifndef CRISPY_TRUECOLOR
+    // Narrow each 128 bit half to four bytes, then join the halves
+    const __m256i words = _mm256_packus_epi32(pixels, pixels);
+    const __m256i bytes = _mm256_packus_epi16(words, words);
+
+    _mm_storel_epi64((__m128i *) dest,
+        _mm_unpacklo_epi32(_mm256_castsi256_si128(bytes),
+                           _mm256_extracti128_si256(bytes, 1)));
+#else
+    _mm256_storeu_si256((__m256i *) dest, pixels);
+#endif
+}
+
+__attribute__((target("avx2")))
+static void SpanAVX2 (const r_span_t *span)
+{
+    const boolean bright = span->brightmap != NULL
+                        && span->colormap[0] != span->colormap[1];
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i ymask = _mm256_set1_epi32(0x0fc0);
+    const __m256i xmask = _mm256_set1_epi32(0x3f);
+    const __m256i xstep8 = _mm256_set1_epi32((int) ((unsigned) span->xstep << 3));
+    const __m256i ystep8 = _mm256_set1_epi32((int) ((unsigned) span->ystep << 3));
+    __m256i xfrac, yfrac;
+    r_span_t tail;
+    int i;
+
+    // Mirrored and low detail spans don't store eight neighbours
+    if (span->step != 1 || span->twin || span->count < 8)
+    {
+	SpanScalar(span);
+	return;
+    }
+
+    if (bright && span->brightmap != bright_wide_map)
+    {
+	for (i = 0; i < 256; ++i)
+	{
+	    bright_wide[i] = span->brightmap[i];
+	}
+	bright_wide_map = span->brightmap;
+    }
+
+    xfrac = _mm256_add_epi32(_mm256_set1_epi32(span->xfrac),
+        _mm256_mullo_epi32(_mm256_set1_epi32(span->xstep), lanes));
+    yfrac = _mm256_add_epi32(_mm256_set1_epi32(span->yfrac),
+        _mm256_mullo_epi32(_mm256_set1_epi32(span->ystep), lanes));
+
+    for (i = 0; i + 8 <= span->count; i += 8)
+    {
+	const __m256i spot = _mm256_or_si256(
+	    _mm256_and_si256(_mm256_srli_epi32(yfrac, 10), ymask),
+	    _mm256_and_si256(_mm256_srli_epi32(xfrac, 16), xmask));
+	const __m256i texel = GatherBytes(span->source, spot);
+	__m256i pixels = GatherPixels(span->colormap[0], texel);
+
+	if (bright)
+	{
+	    const __m256i lit = _mm256_cmpgt_epi32(
+	        _mm256_i32gather_epi32(bright_wide, texel, 4),
+	        _mm256_setzero_si256());
+
+	    pixels = _mm256_blendv_epi8(pixels,
+	        GatherPixels(span->colormap[1], texel), lit);
+	}
+
+	StorePixels(span->dest + i, pixels);
+
+	xfrac = _mm256_add_epi32(xfrac, xstep8);
+	yfrac = _mm256_add_epi32(yfrac, ystep8);
+    }
+
+    if (i < span->count)
+    {
+	tail = *span;
+	tail.dest += i;
+	tail.count -= i;
+	tail.xfrac = (fixed_t) ((unsigned) span->xfrac + (unsigned) span->xstep * i);
+	tail.yfrac = (fixed_t) ((unsigned) span->yfrac + (unsigned) span->ystep * i);
+	SpanScalar(&tail);
+    }
+}
+#endif
+
+static void (*span_kernel)(const r_span_t *span);
+
+void R_KernelSpan (const r_span_t *span)
+{
+    if (span_kernel == NULL)
+    {
+	span_kernel = SpanScalar;
+#ifdef HAVE_KERNELS_AVX2
+	if (__builtin_cpu_supports("avx2"))
+	{
+	    span_kernel = SpanAVX2;
+	}
+#endif
+    }
+
+    span_kernel(span);
+}
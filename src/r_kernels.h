@@ -0,0 +1,81 @@
+//
+// Copyright(C) 1993-1996 Id Software, Inc.
+// Copyright(C) 2005-2014 Simon Howard
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	[AP] Column and span inner loops shared by the games' renderers.
+//
+
+#ifndef __R_KERNELS__
+#define __R_KERNELS__
+
+#include "doomtype.h"
+#include "m_fixed.h"
+
+// [AP] The games' drawers fill one of these from their dc_* or ds_*
+// globals and hand it to a kernel, so the loops themselves live here once
+// and are picked for the CPU at run time. What differs between the games
+// is in the parameters: the colormap and brightmap, an optional
+// translation, and an optional 256x256 blend table (Heretic and Hexen's
+// tinttable, Strife's xlatab, Doom's tranmap), indexed one way round or
+// the other.
+
+typedef struct
+{
+    pixel_t *dest;              // first pixel, row dc_yl
+    int pitch;                  // pixels from one row to the next
+    int count;                  // pixels to draw, at least one
+    const byte *source;
+    fixed_t frac, fracstep;
+
+    // Non-zero wraps the texture coordinate to this height, with Lee
+    // Killough's tutti-frutti fix for heights that aren't powers of two.
+    // Zero indexes source with the coordinate as it is.
+    int texheight;
+
+    // Texel t is drawn as colormap[brightmap[t]][t]. NULL brightmap
+    // always uses colormap[0].
+    const pixel_t *colormap[2];
+    const byte *brightmap;
+
+    const byte *translation;    // applied to texels first, or NULL
+
+    // Paletted builds blend the colormapped pixel p with what's there, as
+    // blend[(dest << 8) + p], or blend[(p << 8) + dest] with blendswap.
+    // NULL draws opaque; true color builds always draw opaque.
+    const byte *blend;
+    boolean blendswap;
+
+    // Low detail: also write each pixel this far to the side, 0 for none
+    int twin;
+} r_column_t;
+
+typedef struct
+{
+    pixel_t *dest;              // first pixel, column ds_x1
+    int step;                   // pixels from one texel to the next
+    int count;                  // pixels to draw, at least one
+    const byte *source;         // 64x64 flat
+    fixed_t xfrac, yfrac;
+    fixed_t xstep, ystep;
+
+    const pixel_t *colormap[2]; // as for r_column_t
+    const byte *brightmap;
+
+    int twin;                   // as for r_column_t
+} r_span_t;
+
+void R_KernelColumn (const r_column_t *column);
+void R_KernelSpan (const r_span_t *span);
+
+#endif
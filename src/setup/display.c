@@ -73,6 +73,7 @@ static int aspect_ratio_correct = 1;
 static int integer_scaling = 0;
 static int vga_porch_flash = 0;
 static int force_software_renderer = 0;
+static int gpu_palette = 0; // [AP]
 static int fullscreen = 1;
 static int fullscreen_width = 0, fullscreen_height = 0;
 static int window_width = 800, window_height = 600;
@@ -269,6 +270,7 @@ void BindDisplayVariables(void)
     M_BindIntVariable("png_screenshots",           &png_screenshots);
     M_BindIntVariable("vga_porch_flash",           &vga_porch_flash);
     M_BindIntVariable("force_software_renderer",   &force_software_renderer);
+    M_BindIntVariable("gpu_palette",               &gpu_palette); // [AP]
     M_BindIntVariable("max_scaling_buffer_pixels", &max_scaling_buffer_pixels);
 
     if (gamemission == doom || gamemission == heretic
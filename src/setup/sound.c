@@ -64,6 +64,11 @@ int snd_cachesize = 64 * 1024 * 1024;
 int snd_maxslicetime_ms = 28;
 char *snd_musiccmd = "";
 int snd_pitchshift = 0;
+int snd_sfxdiskcache = 1;
+int snd_precachethread = 1;
+int snd_oplmusiccache = 0;
+int snd_softmixer = 0;
+int snd_mididiskcache = 0;
 char *snd_dmxoption = "-opl3"; // [crispy] default to OPL3 emulation
 
 static int numChannels = 8;
@@ -95,11 +100,13 @@ int winmm_chorus_level = -1;
 
 #ifdef HAVE_FLUIDSYNTH
 char *fsynth_sf_path = NULL;
+int fsynth_block_size = 256; // [AP]
 int fsynth_chorus_active = 1;
 float fsynth_chorus_depth = 5.0f;
 float fsynth_chorus_level = 0.35f;
 int fsynth_chorus_nr = 3;
 float fsynth_chorus_speed = 0.3f;
+int fsynth_latency = 40; // [AP]
 char *fsynth_midibankselect = "gs";
 int fsynth_polyphony = 256;
 int fsynth_reverb_active = 1;
@@ -369,11 +376,13 @@ void BindSoundVariables(void)
 #endif
 
 #ifdef HAVE_FLUIDSYNTH
+    M_BindIntVariable("fsynth_block_size",        &fsynth_block_size); // [AP]
     M_BindIntVariable("fsynth_chorus_active",     &fsynth_chorus_active);
     M_BindFloatVariable("fsynth_chorus_depth",    &fsynth_chorus_depth);
     M_BindFloatVariable("fsynth_chorus_level",    &fsynth_chorus_level);
     M_BindIntVariable("fsynth_chorus_nr",         &fsynth_chorus_nr);
     M_BindFloatVariable("fsynth_chorus_speed",    &fsynth_chorus_speed);
+    M_BindIntVariable("fsynth_latency",           &fsynth_latency); // [AP]
     M_BindStringVariable("fsynth_midibankselect", &fsynth_midibankselect);
     M_BindIntVariable("fsynth_polyphony",         &fsynth_polyphony);
     M_BindIntVariable("fsynth_reverb_active",     &fsynth_reverb_active);
@@ -396,6 +405,11 @@ void BindSoundVariables(void)
     M_BindIntVariable("opl_io_port",              &opl_io_port);
 
     M_BindIntVariable("snd_pitchshift",           &snd_pitchshift);
+    M_BindIntVariable("snd_sfxdiskcache",         &snd_sfxdiskcache);
+    M_BindIntVariable("snd_precachethread",       &snd_precachethread);
+    M_BindIntVariable("snd_oplmusiccache",        &snd_oplmusiccache);
+    M_BindIntVariable("snd_softmixer",            &snd_softmixer);
+    M_BindIntVariable("snd_mididiskcache",        &snd_mididiskcache);
 
     if (gamemission == strife)
     {
@@ -210,8 +210,16 @@ void SHA1_Update(sha1_context_t *hd, byte *inbuf, size_t inlen)
 	return;
     if (hd->count)
     {
-	for (; inlen && hd->count < 64; inlen--)
-	    hd->buf[hd->count++] = *inbuf++;
+        // [AP] Top up the partial block in one copy; W_Checksum feeds
+        // thousands of 4 byte updates through here.
+        size_t n = 64 - hd->count;
+
+        if (n > inlen)
+            n = inlen;
+        memcpy(hd->buf + hd->count, inbuf, n);
+        hd->count += n;
+        inbuf += n;
+        inlen -= n;
 	SHA1_Update(hd, NULL, 0);
 	if (!inlen)
 	    return;
@@ -225,8 +233,8 @@ void SHA1_Update(sha1_context_t *hd, byte *inbuf, size_t inlen)
 	inlen -= 64;
 	inbuf += 64;
     }
-    for (; inlen && hd->count < 64; inlen--)
-	hd->buf[hd->count++] = *inbuf++;
+    memcpy(hd->buf + hd->count, inbuf, inlen);
+    hd->count += inlen;
 }
 
 
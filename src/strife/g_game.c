@@ -1959,7 +1959,7 @@ boolean G_WriteSaveName(int slot, const char *charname)
     tmpname = M_SafeFilePath(savepathtemp, "name");
 
     // Write the "name" file under the directory
-    retval = M_WriteFile(tmpname, character_name, 32);
+    retval = M_SaveWriteFile(tmpname, character_name, 32); // [AP]
 
     Z_Free(tmpname);
 
@@ -2008,7 +2008,7 @@ void G_DoSaveGame (char *path)
     gamemapbytes[1] = (byte)((gamemap >>  8) & 0xff);
     gamemapbytes[2] = (byte)((gamemap >> 16) & 0xff);
     gamemapbytes[3] = (byte)((gamemap >> 24) & 0xff);
-    M_WriteFile(current_path, gamemapbytes, 4);
+    M_SaveWriteFile(current_path, gamemapbytes, 4); // [AP]
     Z_Free(current_path);
 
     // Open the savegame file for writing.  We write to a temporary file
@@ -20,9 +20,17 @@
 //
 
 #include <stdarg.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 #include "z_zone.h"
 #include "i_glob.h"
 #include "i_system.h"
@@ -105,6 +113,80 @@ void ClearSlot(void)
     I_EndGlob(glob);
 }
 
+//
+// [AP] LinkSaveFile
+//
+// Hard link dst to src, where the filesystem can, so that copying a save
+// slot doesn't read or write any of it.
+//
+static boolean LinkSaveFile(const char *src, const char *dst)
+{
+#ifdef _WIN32
+    wchar_t *wsrc = M_ConvertUtf8ToWide(src);
+    wchar_t *wdst = M_ConvertUtf8ToWide(dst);
+    boolean result = wsrc != NULL && wdst != NULL
+                  && CreateHardLinkW(wdst, wsrc, NULL);
+
+    free(wsrc);
+    free(wdst);
+
+    return result;
+#else
+    return link(src, dst) == 0;
+#endif
+}
+
+//
+// [AP] CopySaveFile
+//
+// Copy one file of a save slot. Links when it can; otherwise streams it
+// through a small buffer instead of reading it whole into the zone. Files
+// in the save folders are only ever replaced, never rewritten in place
+// (see M_SaveWriteFile), so a linked copy can't be changed through the
+// other name.
+//
+static void CopySaveFile(const char *src, const char *dst)
+{
+    static byte buffer[0x4000];
+    FILE *in, *out;
+    size_t len;
+
+    M_remove(dst);
+
+    if (LinkSaveFile(src, dst))
+        return;
+
+    in = M_fopen(src, "rb");
+    if (in == NULL)
+        I_Error("Couldn't read file %s", src);
+
+    out = M_fopen(dst, "wb");
+    if (out != NULL)
+    {
+        while ((len = fread(buffer, 1, sizeof(buffer), in)) > 0)
+        {
+            if (fwrite(buffer, 1, len, out) != len)
+                break;
+        }
+        fclose(out);
+    }
+
+    fclose(in);
+}
+
+//
+// [AP] M_SaveWriteFile
+//
+// M_WriteFile for the save folders. The old file is removed first, so if
+// it's linked into another slot that slot keeps its contents.
+//
+boolean M_SaveWriteFile(const char *path, const void *source, int length)
+{
+    M_remove(path);
+
+    return M_WriteFile(path, source, length);
+}
+
 //
 // FromCurr
 //
@@ -121,8 +203,6 @@ void FromCurr(void)
 
     for (;;)
     {
-        byte *filebuffer;
-        int filelen;
         const char *srcfilename;
         char *dstfilename;
 
@@ -134,10 +214,8 @@ void FromCurr(void)
 
         dstfilename = M_SafeFilePath(savepath, M_BaseName(srcfilename));
 
-        filelen = M_ReadFile(srcfilename, &filebuffer);
-        M_WriteFile(dstfilename, filebuffer, filelen);
+        CopySaveFile(srcfilename, dstfilename); // [AP]
 
-        Z_Free(filebuffer);
         Z_Free(dstfilename);
     }
 
@@ -163,8 +241,6 @@ void ToCurr(void)
 
     for (;;)
     {
-        byte *filebuffer;
-        int filelen;
         const char *srcfilename;
         char *dstfilename;
 
@@ -176,10 +252,8 @@ void ToCurr(void)
 
         dstfilename = M_SafeFilePath(savepathtemp, M_BaseName(srcfilename));
 
-        filelen = M_ReadFile(srcfilename, &filebuffer);
-        M_WriteFile(dstfilename, filebuffer, filelen);
+        CopySaveFile(srcfilename, dstfilename); // [AP]
 
-        Z_Free(filebuffer);
         Z_Free(dstfilename);
     }
 
@@ -254,7 +328,7 @@ boolean M_SaveMisObj(const char *path)
 
     // haleyjd 20110210: use M_SafeFilePath, not sprintf
     destpath = M_SafeFilePath(path, "mis_obj");
-    result   = M_WriteFile(destpath, mission_objective, OBJECTIVE_LEN);
+    result   = M_SaveWriteFile(destpath, mission_objective, OBJECTIVE_LEN);
 
     Z_Free(destpath);
     return result;
@@ -36,6 +36,7 @@ void FromCurr(void);
 void ToCurr(void);
 void M_SaveMoveMapToHere(void);
 void M_SaveMoveHereToMap(void);
+boolean M_SaveWriteFile(const char *path, const void *source, int length);
 
 boolean M_SaveMisObj(const char *path);
 void    M_ReadMisObj(void);
@@ -92,6 +92,13 @@ static mapdialog_t *script0dialogs;
 // Number of dialogs defined in the SCRIPT00 lump.
 static int numscript0dialogs;
 
+// [AP] Dialog index by speaker: the first dialog for each mobjtype, or -1,
+// and for the level dialogs the next dialog with the same speaker. Lets
+// P_DialogFind skip the linear scans of both scripts.
+static int leveldialogindex[NUMMOBJTYPES];
+static int *levelnextdialog;
+static int script0dialogindex[NUMMOBJTYPES];
+
 // The player engaged in dialog. This is always player 1, though, since Rogue
 // never completed the ability to use dialog outside of single-player mode.
 static player_t *dialogplayer;
@@ -437,6 +444,37 @@ static void P_ParseDialogLump(byte *lump, mapdialog_t **dialogs,
     }
 }
 
+//
+// P_IndexDialogs
+//
+// [AP] Builds the speaker index for a parsed dialog lump. next may be NULL
+// if only the first dialog of each speaker is ever wanted.
+//
+static void P_IndexDialogs(mapdialog_t *dialogs, int numdialogs,
+                           int *first, int *next)
+{
+    int i;
+
+    for(i = 0; i < NUMMOBJTYPES; i++)
+        first[i] = -1;
+
+    // walk backward so that the chains come out in lump order
+    for(i = numdialogs - 1; i >= 0; i--)
+    {
+        int speaker = dialogs[i].speakerid;
+
+        if(next)
+            next[i] = -1;
+
+        if(speaker < 0 || speaker >= NUMMOBJTYPES)
+            continue; // can never match a thing type
+
+        if(next)
+            next[i] = first[speaker];
+        first[speaker] = i;
+    }
+}
+
 //
 // P_DialogLoad
 //
@@ -462,6 +500,12 @@ void P_DialogLoad(void)
         Z_Free(leveldialogptr); // haleyjd: free the original lump
     }
 
+    // [AP] index the level dialogs by speaker
+    levelnextdialog = Z_Malloc((numleveldialogs + 1) * sizeof(int), 
+                               PU_LEVEL, NULL);
+    P_IndexDialogs(leveldialogs, numleveldialogs, leveldialogindex, 
+                   levelnextdialog);
+
     // also load SCRIPT00 if it has not been loaded yet
     if(!script0loaded)
     {
@@ -475,6 +519,8 @@ void P_DialogLoad(void)
         P_ParseDialogLump(script0ptr, &script0dialogs, numscript0dialogs,
                           PU_STATIC);
         Z_Free(script0ptr); // haleyjd: free the original lump
+        P_IndexDialogs(script0dialogs, numscript0dialogs, script0dialogindex,
+                       NULL);
     }
 }
 
@@ -524,22 +570,21 @@ mapdialog_t *P_DialogFind(mobjtype_t type, int jumptoconv)
 {
     int i;
 
-    // check the map-specific dialogs first
-    for(i = 0; i < numleveldialogs; i++)
+    // [AP] no dialog can have a speaker outside the index
+    if(type >= 0 && type < NUMMOBJTYPES)
     {
-        if(type == leveldialogs[i].speakerid)
+        // check the map-specific dialogs first
+        for(i = leveldialogindex[type]; i != -1; i = levelnextdialog[i])
         {
             if(jumptoconv <= 1)
                 return &leveldialogs[i];
             else
                 --jumptoconv;
         }
-    }
 
-    // check SCRIPT00 dialogs next
-    for(i = 0; i < numscript0dialogs; i++)
-    {
-        if(type == script0dialogs[i].speakerid)
+        // check SCRIPT00 dialogs next
+        i = script0dialogindex[type];
+        if(i != -1)
             return &script0dialogs[i];
     }
 
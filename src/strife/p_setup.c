@@ -27,6 +27,7 @@
 #include "i_swap.h"
 #include "m_argv.h"
 #include "m_bbox.h"
+#include "m_memory.h" // [AP] M_TrimMemory()
 
 #include "g_game.h"
 
@@ -918,6 +919,7 @@ P_SetupLevel
     else
 #endif
     Z_FreeTags (PU_LEVEL, PU_PURGELEVEL-1);
+    M_TrimMemory(); // [AP] -lowmem empties the caches between levels
 
 
     // UNUSED W_Profile ();
@@ -29,6 +29,7 @@
 #include "w_wad.h"
 
 #include "r_local.h"
+#include "r_kernels.h"
 
 // Needs access to LFB (guess what).
 #include "v_video.h"
@@ -108,18 +109,31 @@ int			dccount;
 // [crispy] replace R_DrawColumn() with Lee Killough's implementation
 // found in MBF to fix Tutti-Frutti, taken from mbfsrc/R_DRAW.C:99-1979
 
+// [AP] Fill in what every column drawer passes to the kernel, see
+// r_kernels.h.
+static void R_SetupColumn (r_column_t *column)
+{
+    column->dest = ylookup[dc_yl] + columnofs[dc_x];
+    column->pitch = SCREENWIDTH;
+    column->count = dc_yh - dc_yl + 1;
+    column->source = dc_source;
+    column->fracstep = dc_iscale;
+    column->frac = dc_texturemid + (dc_yl-centery)*dc_iscale;
+    column->texheight = dc_texheight;
+    column->colormap[0] = column->colormap[1] = dc_colormap;
+    column->brightmap = NULL;
+    column->translation = NULL;
+    column->blend = NULL;
+    column->blendswap = false;
+    column->twin = 0;
+}
+
 void R_DrawColumn (void) 
 { 
-    int			count; 
-    byte*		dest; 
-    fixed_t		frac;
-    fixed_t		fracstep;	 
-    int			heightmask = dc_texheight - 1;
- 
-    count = dc_yh - dc_yl; 
+    r_column_t		column;
 
     // Zero length, column does not exceed a pixel.
-    if (count < 0) 
+    if (dc_yh < dc_yl) 
 	return; 
 				 
 #ifdef RANGECHECK 
@@ -129,54 +143,8 @@ void R_DrawColumn (void)
 	I_Error ("R_DrawColumn: %i to %i at %i", dc_yl, dc_yh, dc_x); 
 #endif 
 
-    // Framebuffer destination address.
-    // Use ylookup LUT to avoid multiply with ScreenWidth.
-    // Use columnofs LUT for subwindows? 
-    dest = ylookup[dc_yl] + columnofs[dc_x];  
-
-    // Determine scaling,
-    //  which is the only mapping to be done.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
-
-    // Inner loop that does the actual texture mapping,
-    //  e.g. a DDA-lile scaling.
-    // This is as fast as it gets.
-
-  // heightmask is the Tutti-Frutti fix -- killough
-  if (dc_texheight & heightmask) // not a power of 2 -- killough
-  {
-    heightmask++;
-    heightmask <<= FRACBITS;
-
-    if (frac < 0)
-	while ((frac += heightmask) < 0);
-    else
-	while (frac >= heightmask)
-	    frac -= heightmask;
-
-    do
-    {
-	*dest = dc_colormap[dc_source[frac>>FRACBITS]];
-
-	dest += SCREENWIDTH;
-	if ((frac += fracstep) >= heightmask)
-	    frac -= heightmask;
-    } while (count--);
-  }
-  else // texture height is a power of 2 -- killough
-  {
-    do 
-    {
-	// Re-map color indices from wall texture column
-	//  using a lighting/special effects LUT.
-	*dest = dc_colormap[dc_source[(frac>>FRACBITS)&heightmask]];
-	
-	dest += SCREENWIDTH; 
-	frac += fracstep;
-	
-    } while (count--); 
-  }
+    R_SetupColumn(&column);
+    R_KernelColumn(&column);
 } 
 
 
@@ -255,10 +223,7 @@ void R_DrawColumn (void)
 //
 void R_DrawMVisTLColumn(void)
 {
-    int                 count; 
-    byte*               dest; 
-    fixed_t             frac;
-    fixed_t             fracstep;
+    r_column_t          column;
 
 // [crispy] Show transparent lines at top and bottom of screen.
 /*
@@ -271,10 +236,8 @@ void R_DrawMVisTLColumn(void)
         dc_yh = viewheight - 2; 
 */
 
-    count = dc_yh - dc_yl; 
-
     // Zero length.
-    if (count < 0) 
+    if (dc_yh < dc_yl) 
         return; 
 
 #ifdef RANGECHECK 
@@ -285,21 +248,12 @@ void R_DrawMVisTLColumn(void)
                  dc_yl, dc_yh, dc_x);
     }
 #endif
-    
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
 
-    do
-    {
-        byte src = dc_colormap[dc_source[(frac>>FRACBITS)&127]];
-        byte col = xlatab[*dest + (src << 8)];
-        *dest = col;
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    } while(count--);
+    R_SetupColumn(&column);
+    column.texheight = 128;
+    column.blend = xlatab;
+    column.blendswap = true;
+    R_KernelColumn(&column);
 }
 
 //
@@ -311,10 +265,7 @@ void R_DrawMVisTLColumn(void)
 //
 void R_DrawTLColumn(void)
 {
-    int                 count; 
-    byte*               dest; 
-    fixed_t             frac;
-    fixed_t             fracstep;	 
+    r_column_t          column;
 
 // [crispy] Show transparent lines at top and bottom of screen.
 /*
@@ -327,10 +278,8 @@ void R_DrawTLColumn(void)
         dc_yh = viewheight - 2; 
 */
 
-    count = dc_yh - dc_yl; 
-
     // Zero length.
-    if (count < 0) 
+    if (dc_yh < dc_yl) 
         return; 
 
 #ifdef RANGECHECK 
@@ -341,21 +290,11 @@ void R_DrawTLColumn(void)
                  dc_yl, dc_yh, dc_x);
     }
 #endif
-    
-    dest = ylookup[dc_yl] + columnofs[dc_x];
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
 
-    do
-    {
-        byte src = dc_colormap[dc_source[(frac>>FRACBITS)&127]];
-        byte col = xlatab[(*dest << 8) + src];
-        *dest = col;
-        dest += SCREENWIDTH;
-        frac += fracstep;
-    } while(count--);
+    R_SetupColumn(&column);
+    column.texheight = 128;
+    column.blend = xlatab;
+    R_KernelColumn(&column);
 }
   
  
@@ -374,13 +313,9 @@ byte*	translationtables;
 
 void R_DrawTranslatedColumn (void) 
 { 
-    int                 count; 
-    byte*               dest; 
-    fixed_t             frac;
-    fixed_t             fracstep;
+    r_column_t          column;
 
-    count = dc_yh - dc_yl; 
-    if (count < 0) 
+    if (dc_yh < dc_yl) 
         return; 
 
 #ifdef RANGECHECK 
@@ -394,24 +329,15 @@ void R_DrawTranslatedColumn (void)
 
 #endif 
 
-    dest = ylookup[dc_yl] + columnofs[dc_x]; 
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
-
-    // Here we do an additional index re-mapping.
-    do 
-    {
-        // Translation tables are used
-        //  to map certain colorramps to other ones,
-        //  used with PLAY sprites.
-        // Thus the "green" ramp of the player 0 sprite
-        //  is mapped to gray, red, black/indigo. 
-        *dest = dc_colormap[dc_translation[dc_source[frac>>FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += fracstep; 
-    } while (count--); 
+    // Translation tables are used
+    //  to map certain colorramps to other ones,
+    //  used with PLAY sprites.
+    // Thus the "green" ramp of the player 0 sprite
+    //  is mapped to gray, red, black/indigo. 
+    R_SetupColumn(&column);
+    column.texheight = 0;
+    column.translation = dc_translation;
+    R_KernelColumn(&column);
 } 
 
 // haleyjd 09/06/10 [STRIFE] Removed low detail
@@ -424,13 +350,9 @@ void R_DrawTranslatedColumn (void)
 //
 void R_DrawTRTLColumn(void)
 {
-    int                 count; 
-    byte*               dest; 
-    fixed_t             frac;
-    fixed_t             fracstep;
+    r_column_t          column;
 
-    count = dc_yh - dc_yl; 
-    if (count < 0) 
+    if (dc_yh < dc_yl) 
         return; 
 
 #ifdef RANGECHECK 
@@ -443,24 +365,13 @@ void R_DrawTRTLColumn(void)
     }
 #endif 
 
-    dest = ylookup[dc_yl] + columnofs[dc_x]; 
-
-    // Looks familiar.
-    fracstep = dc_iscale; 
-    frac = dc_texturemid + (dc_yl-centery)*fracstep; 
-
-    // Here we do an additional index re-mapping.
-    do 
-    {
-        byte src = dc_colormap[dc_translation[dc_source[frac>>FRACBITS&127]]];
-        byte col = xlatab[(*dest << 8) + src];
-        *dest = col;
-        dest += SCREENWIDTH;
-        frac += fracstep; 
-    } while (count--); 
+    R_SetupColumn(&column);
+    column.texheight = 128;
+    column.translation = dc_translation;
+    column.blend = xlatab;
+    R_KernelColumn(&column);
 }
 
-
 //
 // R_InitTranslationTables
 // Creates the translation tables to map
@@ -620,15 +531,28 @@ byte*			ds_source;
 int			dscount;
 
 
+//
+// [AP] Fill in what both span drawers pass to the kernel, see r_kernels.h.
+static void R_SetupSpan (r_span_t *span)
+{
+    span->dest = ylookup[ds_y] + columnofs[ds_x1];
+    span->step = 1;
+    span->count = ds_x2 - ds_x1 + 1;
+    span->source = ds_source;
+    span->xfrac = ds_xfrac;
+    span->yfrac = ds_yfrac;
+    span->xstep = ds_xstep;
+    span->ystep = ds_ystep;
+    span->colormap[0] = span->colormap[1] = ds_colormap;
+    span->brightmap = NULL;
+    span->twin = 0;
+}
+
 //
 // Draws the actual span.
 void R_DrawSpan (void) 
 { 
-//  unsigned int position, step;
-    byte *dest;
-    int count;
-    int spot;
-    unsigned int xtemp, ytemp;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1
@@ -642,44 +566,13 @@ void R_DrawSpan (void)
 //	dscount++;
 #endif
 
-    // Pack position and step variables into a single 32-bit integer,
-    // with x in the top 16 bits and y in the bottom 16 bits.  For
-    // each 16-bit part, the top 6 bits are the integer part and the
-    // bottom 10 bits are the fractional part of the pixel position.
-
-/*
-    position = ((ds_xfrac << 10) & 0xffff0000)
-             | ((ds_yfrac >> 6)  & 0x0000ffff);
-    step = ((ds_xstep << 10) & 0xffff0000)
-         | ((ds_ystep >> 6)  & 0x0000ffff);
-*/
-
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-
-    // We do not check for zero spans here?
-    count = ds_x2 - ds_x1;
-
-    do
-    {
-	// Calculate current texture index in u,v.
-        // [crispy] fix flats getting more distorted the closer they are to the right
-        ytemp = (ds_yfrac >> 10) & 0x0fc0;
-        xtemp = (ds_xfrac >> 16) & 0x3f;
-        spot = xtemp | ytemp;
-
-	// Lookup pixel from flat texture tile,
-	//  re-index using light/colormap.
-	*dest++ = ds_colormap[ds_source[spot]];
-
-//      position += step;
-        ds_xfrac += ds_xstep;
-        ds_yfrac += ds_ystep;
-
-    } while (count--);
+    // Lookup pixel from flat texture tile,
+    //  re-index using light/colormap.
+    R_SetupSpan(&span);
+    R_KernelSpan(&span);
 }
 
 
-
 // UNUSED.
 // Loop unrolled by 4.
 #if 0
@@ -758,11 +651,7 @@ void R_DrawSpan (void)
 //
 void R_DrawSpanLow (void)
 {
-//  unsigned int position, step;
-    unsigned int xtemp, ytemp;
-    byte *dest;
-    int count;
-    int spot;
+    r_span_t span;
 
 #ifdef RANGECHECK
     if (ds_x2 < ds_x1
@@ -776,39 +665,18 @@ void R_DrawSpanLow (void)
 //	dscount++; 
 #endif
 
-/*
-    position = ((ds_xfrac << 10) & 0xffff0000)
-             | ((ds_yfrac >> 6)  & 0x0000ffff);
-    step = ((ds_xstep << 10) & 0xffff0000)
-         | ((ds_ystep >> 6)  & 0x0000ffff);
-*/
-
-    count = (ds_x2 - ds_x1);
+    R_SetupSpan(&span);
 
     // Blocky mode, need to multiply by 2.
     ds_x1 <<= 1;
     ds_x2 <<= 1;
 
-    dest = ylookup[ds_y] + columnofs[ds_x1];
-
-    do
-    {
-	// Calculate current texture index in u,v.
-        // [crispy] fix flats getting more distorted the closer they are to the right
-        ytemp = (ds_yfrac >> 10) & 0x0fc0;
-        xtemp = (ds_xfrac >> 16) & 0x3f;
-        spot = xtemp | ytemp;
-
-	// Lowres/blocky mode does it twice,
-	//  while scale is adjusted appropriately.
-	*dest++ = ds_colormap[ds_source[spot]];
-	*dest++ = ds_colormap[ds_source[spot]];
-
-//	position += step;
-	ds_xfrac += ds_xstep;
-	ds_yfrac += ds_ystep;
-
-    } while (count--);
+    // Lowres/blocky mode does it twice,
+    //  while scale is adjusted appropriately.
+    span.dest = ylookup[ds_y] + columnofs[ds_x1];
+    span.step = 2;
+    span.twin = 1;
+    R_KernelSpan(&span);
 }
 
 //
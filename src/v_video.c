@@ -19,6 +19,7 @@
 //	Functions to blit a block to the screen.
 //
 
+#include "SDL.h" // [AP] screenshot thread
 #include "SDL_version.h" // [crispy]
 
 #include <stdio.h>
@@ -35,6 +36,7 @@
 #include "i_swap.h"
 #include "i_video.h"
 #include "m_bbox.h"
+#include "m_memory.h"
 #include "m_misc.h"
 #ifdef CRISPY_TRUECOLOR
 #include "v_trans.h"
@@ -199,6 +201,231 @@ static drawpatchpx_t *const drawpatchpx_a[2][2] = {{drawpatchpx11, drawpatchpx10
 
 static fixed_t dx, dxi, dy, dyi;
 
+// [AP] Cache of patches expanded to the current vertical scale. The menus,
+// intermission, level select and HUD draw the same patches every frame, so
+// V_DrawPatch keeps the scaled posts of each column as ready made spans
+// and no longer steps through the source with fixed point every time.
+//
+// Patches are mostly PU_CACHE lumps, which can be purged and their memory
+// handed to another lump. So an entry keeps a copy of the patch it was
+// built from, and is only used while the bytes still match.
+
+#define PATCH_CACHE_SIZE 64
+#define PATCH_CACHE_BUDGET (4 * 1024 * 1024)
+#define PATCH_CACHE_LOWMEM (1024 * 1024)
+
+typedef struct
+{
+    int topdelta; // Unscaled, the clipping uses it
+    int row; // Scaled, relative to the top of the patch
+    int count; // Scaled rows
+    int pixels; // Into the entry's pixels
+} patch_span_t;
+
+typedef struct
+{
+    const patch_t *patch;
+    fixed_t dy, dyi;
+    int copy_size; // Bytes of the patch
+    int size; // Bytes of the whole entry
+    unsigned last_used;
+    unsigned serial; // Tells the glyph cache when the entry was rebuilt
+    byte *copy;
+    int *column_spans; // width + 1, spans of column c are [c, c + 1)
+    patch_span_t *spans;
+    byte *pixels;
+} patch_cache_entry_t;
+
+static patch_cache_entry_t patch_cache[PATCH_CACHE_SIZE];
+static unsigned patch_cache_time = 0;
+static unsigned patch_cache_serial = 0;
+static int patch_cache_bytes = 0;
+static int patch_cache_budget = PATCH_CACHE_BUDGET;
+
+// Size of the patch, from the end of its last post
+static int V_PatchSize(const patch_t *patch, int *span_count, int *pixel_count)
+{
+    int w = SHORT(patch->width);
+    int size = 8 + w * 4;
+    int col;
+
+    *span_count = 0;
+    *pixel_count = 0;
+
+    for (col = 0; col < w; col++)
+    {
+        const column_t *column = (const column_t *)((const byte *)patch + LONG(patch->columnofs[col]));
+
+        while (column->topdelta != 0xff)
+        {
+            *span_count += 1;
+            *pixel_count += (column->length * dy) >> FRACBITS;
+            column = (const column_t *)((const byte *)column + column->length + 4);
+        }
+
+        if ((const byte *)column + 1 - (const byte *)patch > size)
+        {
+            size = (const byte *)column + 1 - (const byte *)patch;
+        }
+    }
+
+    return size;
+}
+
+static void V_FreePatchCacheEntry(patch_cache_entry_t *entry)
+{
+    if (entry->copy)
+    {
+        patch_cache_bytes -= entry->size;
+        free(entry->copy);
+    }
+    memset(entry, 0, sizeof(*entry));
+}
+
+static patch_cache_entry_t *V_BuildPatchCacheEntry(const patch_t *patch)
+{
+    patch_cache_entry_t *entry = NULL;
+    int w = SHORT(patch->width);
+    int span_count, pixel_count;
+    int size, offset, total;
+    int col, span;
+    int i;
+
+    size = V_PatchSize(patch, &span_count, &pixel_count);
+    offset = (size + sizeof(int) - 1) / sizeof(int) * sizeof(int);
+    total = offset + (w + 1) * sizeof(int) + span_count * sizeof(patch_span_t) + pixel_count;
+
+    if (total > patch_cache_budget)
+    {
+        return NULL;
+    }
+
+    // Least recently used goes first, until there's room
+    for (;;)
+    {
+        patch_cache_entry_t *oldest = NULL;
+
+        for (i = 0; i < PATCH_CACHE_SIZE; i++)
+        {
+            if (!patch_cache[i].copy)
+            {
+                entry = &patch_cache[i];
+            }
+            else if (!oldest || patch_cache[i].last_used < oldest->last_used)
+            {
+                oldest = &patch_cache[i];
+            }
+        }
+
+        if (entry && patch_cache_bytes + total <= patch_cache_budget)
+        {
+            break;
+        }
+
+        V_FreePatchCacheEntry(oldest);
+        entry = NULL;
+    }
+
+    // One block per entry, the copy first so it's what gets freed
+    entry->copy = malloc(total);
+    if (!entry->copy)
+    {
+        return NULL;
+    }
+
+    entry->column_spans = (int *)(entry->copy + offset);
+    entry->spans = (patch_span_t *)(entry->column_spans + w + 1);
+    entry->pixels = (byte *)(entry->spans + span_count);
+
+    memcpy(entry->copy, patch, size);
+    entry->patch = patch;
+    entry->dy = dy;
+    entry->dyi = dyi;
+    entry->copy_size = size;
+    entry->size = total;
+    entry->serial = ++patch_cache_serial;
+    patch_cache_bytes += total;
+
+    span = 0;
+    pixel_count = 0;
+    for (col = 0; col < w; col++)
+    {
+        const column_t *column = (const column_t *)((const byte *)patch + LONG(patch->columnofs[col]));
+        int topdelta = -1;
+
+        entry->column_spans[col] = span;
+
+        while (column->topdelta != 0xff)
+        {
+            const byte *source = (const byte *)column + 3;
+            patch_span_t *s = &entry->spans[span++];
+            int srccol = 0;
+
+            // [crispy] support for DeePsea tall patches
+            if (column->topdelta <= topdelta)
+            {
+                topdelta += column->topdelta;
+            }
+            else
+            {
+                topdelta = column->topdelta;
+            }
+
+            s->topdelta = topdelta;
+            s->row = (topdelta * dy) >> FRACBITS;
+            s->count = (column->length * dy) >> FRACBITS;
+            s->pixels = pixel_count;
+
+            for (i = 0; i < s->count; i++)
+            {
+                entry->pixels[pixel_count++] = source[srccol >> FRACBITS];
+                srccol += dyi;
+            }
+
+            column = (const column_t *)((const byte *)column + column->length + 4);
+        }
+    }
+    entry->column_spans[w] = span;
+
+    return entry;
+}
+
+static patch_cache_entry_t *V_GetPatchCacheEntry(const patch_t *patch)
+{
+    patch_cache_entry_t *entry = NULL;
+    int i;
+
+    for (i = 0; i < PATCH_CACHE_SIZE; i++)
+    {
+        if (patch_cache[i].patch == patch && patch_cache[i].copy)
+        {
+            entry = &patch_cache[i];
+            break;
+        }
+    }
+
+    if (entry)
+    {
+        if (entry->dy != dy || entry->dyi != dyi || memcmp(entry->copy, patch, entry->copy_size))
+        {
+            V_FreePatchCacheEntry(entry);
+            entry = NULL;
+        }
+    }
+
+    if (!entry)
+    {
+        entry = V_BuildPatchCacheEntry(patch);
+        if (!entry)
+        {
+            return NULL;
+        }
+    }
+
+    entry->last_used = ++patch_cache_time;
+    return entry;
+}
+
 void V_DrawPatch(int x, int y, patch_t *patch)
 { 
     int count;
@@ -208,6 +435,7 @@ void V_DrawPatch(int x, int y, patch_t *patch)
     pixel_t *dest;
     byte *source;
     int w;
+    patch_cache_entry_t *entry;
 
     // [crispy] four different rendering functions
     drawpatchpx_t *const drawpatchpx = drawpatchpx_a[!dp_translucent][!dp_translation];
@@ -251,6 +479,70 @@ void V_DrawPatch(int x, int y, patch_t *patch)
     // convert x to screen position
     x = (x * dx) >> FRACBITS;
 
+    // [AP] Blit the ready made spans, same clipping as the posts below
+    entry = V_GetPatchCacheEntry(patch);
+    if (entry)
+    {
+        for ( ; col<w << FRACBITS ; x++, col+=dxi, desttop++)
+        {
+            const patch_span_t *s, *end;
+
+            // [crispy] too far right / width
+            if (x >= SCREENWIDTH)
+            {
+                break;
+            }
+
+            s = entry->spans + entry->column_spans[col >> FRACBITS];
+            end = entry->spans + entry->column_spans[(col >> FRACBITS) + 1];
+
+            for ( ; s < end; s++)
+            {
+                const byte *pixels = entry->pixels + s->pixels;
+                int top = ((y + s->topdelta) * dy) >> FRACBITS;
+                int i = 0;
+
+                dest = desttop + s->row * SCREENWIDTH;
+                count = s->count;
+
+                // [crispy] too low / height
+                if (top + count > SCREENHEIGHT)
+                {
+                    count = SCREENHEIGHT - top;
+                }
+
+                // [crispy] nothing left to draw?
+                if (count < 1)
+                {
+                    break;
+                }
+
+                // [crispy] too high
+                if (top < 0)
+                {
+                    i = -top;
+                    dest += i * SCREENWIDTH;
+                }
+
+#ifndef CRISPY_TRUECOLOR
+                if (drawpatchpx == drawpatchpx00)
+                {
+                    for ( ; i < count; i++, dest += SCREENWIDTH)
+                    {
+                        *dest = pixels[i];
+                    }
+                    continue;
+                }
+#endif
+                for ( ; i < count; i++, dest += SCREENWIDTH)
+                {
+                    *dest = drawpatchpx(*dest, pixels[i]);
+                }
+            }
+        }
+        return;
+    }
+
     for ( ; col<w << FRACBITS ; x++, col+=dxi, desttop++)
     {
         int topdelta = -1;
@@ -465,6 +757,280 @@ void V_DrawPatchDirect(int x, int y, patch_t *patch)
     V_DrawPatch(x, y, patch); 
 } 
 
+// [AP] Glyph atlas. Font patches are drawn in every colour the HUD uses,
+// every frame, so each pair of patch and translation is kept ready
+// scaled and translated, as the runs of opaque pixels in each screen row.
+// Drawing one is then a copy per run. Glyphs are built from the patch
+// cache entries and go stale with them.
+
+#define GLYPH_CACHE_SIZE 1024 // Emptied when half full
+
+typedef struct
+{
+    short row, col, len; // Scaled, from the glyph's top left
+    int pixels;
+} glyph_run_t;
+
+typedef struct
+{
+    const patch_t *patch;
+    const byte *translation;
+    unsigned serial;
+    fixed_t dxi;
+    int width, height; // Scaled
+    int num_runs;
+    int size; // Bytes of runs and pixels
+    glyph_run_t *runs;
+    byte *pixels;
+} glyph_t;
+
+static glyph_t glyph_cache[GLYPH_CACHE_SIZE];
+static int glyph_cache_count = 0;
+static int glyph_cache_bytes = 0;
+
+static void V_ClearGlyphCache(void)
+{
+    int i;
+
+    for (i = 0; i < GLYPH_CACHE_SIZE; i++)
+    {
+        free(glyph_cache[i].runs);
+    }
+    memset(glyph_cache, 0, sizeof(glyph_cache));
+    glyph_cache_count = 0;
+    glyph_cache_bytes = 0;
+}
+
+// Lays out the glyph's pixels in rows, as V_DrawPatch would put them on
+// the screen, then gathers each row's runs. A screen column of the patch
+// doesn't depend on where it's drawn, only on the scale.
+static boolean V_BuildGlyph(glyph_t *glyph, const patch_cache_entry_t *entry)
+{
+    const int w = SHORT(glyph->patch->width);
+    int width, height;
+    byte *grid, *mask;
+    int col, row, i;
+    int num_runs, num_pixels;
+
+    width = 0;
+    height = 0;
+    for (col = 0; col < w << FRACBITS; col += dxi)
+    {
+        const patch_span_t *s = entry->spans + entry->column_spans[col >> FRACBITS];
+        const patch_span_t *end = entry->spans + entry->column_spans[(col >> FRACBITS) + 1];
+
+        for ( ; s < end; s++)
+        {
+            if (s->row + s->count > height)
+            {
+                height = s->row + s->count;
+            }
+        }
+        width++;
+    }
+
+    grid = calloc(2, width * height + 1);
+    if (!grid)
+    {
+        return false;
+    }
+    mask = grid + width * height + 1;
+
+    for (col = 0, i = 0; i < width; i++, col += dxi)
+    {
+        const patch_span_t *s = entry->spans + entry->column_spans[col >> FRACBITS];
+        const patch_span_t *end = entry->spans + entry->column_spans[(col >> FRACBITS) + 1];
+
+        for ( ; s < end; s++)
+        {
+            const byte *pixels = entry->pixels + s->pixels;
+
+            for (row = 0; row < s->count; row++)
+            {
+                const int spot = (s->row + row) * width + i;
+
+                grid[spot] = glyph->translation ? glyph->translation[pixels[row]] : pixels[row];
+                mask[spot] = 1;
+            }
+        }
+    }
+
+    num_runs = 0;
+    num_pixels = 0;
+    for (i = 0; i < width * height; i++)
+    {
+        if (mask[i])
+        {
+            num_pixels++;
+            if (i % width == 0 || !mask[i - 1])
+            {
+                num_runs++;
+            }
+        }
+    }
+
+    glyph->size = num_runs * sizeof(glyph_run_t) + num_pixels + 1;
+    glyph->runs = malloc(glyph->size);
+    if (!glyph->runs)
+    {
+        free(grid);
+        return false;
+    }
+    glyph_cache_bytes += glyph->size;
+    glyph->pixels = (byte *)(glyph->runs + num_runs);
+
+    num_runs = 0;
+    num_pixels = 0;
+    for (row = 0; row < height; row++)
+    {
+        for (col = 0; col < width; col++)
+        {
+            const int spot = row * width + col;
+
+            if (!mask[spot])
+            {
+                continue;
+            }
+            if (col == 0 || !mask[spot - 1])
+            {
+                glyph_run_t *run = &glyph->runs[num_runs++];
+
+                run->row = row;
+                run->col = col;
+                run->len = 0;
+                run->pixels = num_pixels;
+            }
+            glyph->runs[num_runs - 1].len++;
+            glyph->pixels[num_pixels++] = grid[spot];
+        }
+    }
+
+    free(grid);
+
+    glyph->serial = entry->serial;
+    glyph->dxi = dxi;
+    glyph->width = width;
+    glyph->height = height;
+    glyph->num_runs = num_runs;
+
+    return true;
+}
+
+static const glyph_t *V_GetGlyph(const patch_t *patch)
+{
+    const patch_cache_entry_t *entry;
+    glyph_t *glyph;
+    unsigned slot;
+
+    entry = V_GetPatchCacheEntry(patch);
+    if (!entry)
+    {
+        return NULL;
+    }
+
+    slot = ((unsigned)(uintptr_t) patch * 2654435761u
+            ^ (unsigned)(uintptr_t) dp_translation * 40503u) >> 4;
+
+    for (;;)
+    {
+        glyph = &glyph_cache[slot & (GLYPH_CACHE_SIZE - 1)];
+
+        if (!glyph->patch)
+        {
+            break;
+        }
+        if (glyph->patch == patch && glyph->translation == dp_translation)
+        {
+            if (glyph->serial == entry->serial && glyph->dxi == dxi)
+            {
+                return glyph;
+            }
+            if (glyph->runs)
+            {
+                glyph_cache_bytes -= glyph->size;
+                free(glyph->runs);
+                glyph->runs = NULL;
+            }
+            if (!V_BuildGlyph(glyph, entry))
+            {
+                // Leave the slot taken so the probing still works
+                glyph->serial = 0;
+                return NULL;
+            }
+            return glyph;
+        }
+        slot++;
+    }
+
+    if (glyph_cache_count >= GLYPH_CACHE_SIZE / 2)
+    {
+        V_ClearGlyphCache();
+        return V_GetGlyph(patch);
+    }
+
+    glyph->patch = patch;
+    glyph->translation = dp_translation;
+    glyph_cache_count++;
+
+    if (!V_BuildGlyph(glyph, entry))
+    {
+        glyph->serial = 0;
+        return NULL;
+    }
+
+    return glyph;
+}
+
+void V_DrawGlyph(int x, int y, patch_t *patch)
+{
+    const glyph_t *glyph;
+    pixel_t *desttop;
+    int sx, sy;
+    int i;
+
+    glyph = dp_translucent ? NULL : V_GetGlyph(patch);
+
+    if (glyph)
+    {
+        const int gx = x - SHORT(patch->leftoffset) + WIDESCREENDELTA;
+        const int gy = y - SHORT(patch->topoffset);
+
+        sx = (gx * dx) >> FRACBITS;
+        sy = (gy * dy) >> FRACBITS;
+
+        // Anything that needs clipping goes the long way
+        if (gx >= 0 && gy >= 0
+         && sx + glyph->width <= SCREENWIDTH
+         && sy + glyph->height <= SCREENHEIGHT)
+        {
+            V_MarkRect(gx, gy, SHORT(patch->width), SHORT(patch->height));
+
+            desttop = dest_screen + sy * SCREENWIDTH + sx;
+
+            for (i = 0; i < glyph->num_runs; i++)
+            {
+                const glyph_run_t *run = &glyph->runs[i];
+                pixel_t *dest = desttop + run->row * SCREENWIDTH + run->col;
+                const byte *source = glyph->pixels + run->pixels;
+#ifndef CRISPY_TRUECOLOR
+                memcpy(dest, source, run->len);
+#else
+                // Palette changes rebuild colormaps, so they're applied here
+                int j;
+
+                for (j = 0; j < run->len; j++)
+                {
+                    dest[j] = colormaps[source[j]];
+                }
+#endif
+            }
+            return;
+        }
+    }
+
+    V_DrawPatch(x, y, patch);
+}
+
 //
 // V_DrawTLPatch
 //
@@ -952,8 +1518,39 @@ void V_DrawFullscreenRawOrPatch(lumpindex_t index)
 //
 // V_Init
 // 
+// [AP] For the memory report and -lowmem
+static size_t V_PatchCacheBytes(void)
+{
+    return patch_cache_bytes + glyph_cache_bytes;
+}
+
+static void V_PurgePatchCache(void)
+{
+    int i;
+
+    V_ClearGlyphCache();
+
+    for (i = 0; i < PATCH_CACHE_SIZE; i++)
+    {
+        V_FreePatchCacheEntry(&patch_cache[i]);
+    }
+}
+
 void V_Init (void) 
 { 
+    static boolean reported = false;
+
+    if (!reported)
+    {
+        if (M_LowMemory())
+        {
+            patch_cache_budget = PATCH_CACHE_LOWMEM;
+        }
+        M_AddMemoryUser("patches and glyphs", V_PatchCacheBytes,
+                        V_PurgePatchCache);
+        reported = true;
+    }
+
     // [crispy] initialize resolution-agnostic patch drawing
     if (NONWIDEWIDTH && SCREENHEIGHT)
     {
@@ -1085,38 +1682,36 @@ static void warning_fn(png_structp p, png_const_charp s)
     printf("libpng warning: %s\n", s);
 }
 
-void WritePNGfile(char *filename, pixel_t *data,
-                  int width, int height,
-                  byte *palette)
+// [AP] PNG screenshots are encoded and written on a thread of their own.
+// The game thread only reads the frame back, into a pooled buffer, and
+// queues it; a burst of them doesn't wait for the encodes, unless the
+// queue is full.
+
+#define SHOT_QUEUE_SIZE 8
+
+typedef struct
+{
+    char filename[16];
+    byte *pixels;
+    int width, height, pitch;
+} shot_t;
+
+static shot_t shot_queue[SHOT_QUEUE_SIZE];
+static int shot_queue_head, shot_queue_count;
+static boolean shot_quit;
+static SDL_mutex *shot_mutex;
+static SDL_cond *shot_cond;     // a shot queued, one taken, or quitting
+static SDL_Thread *shot_thread;
+
+static void WritePNGfile(const shot_t *shot)
 {
     png_structp ppng;
     png_infop pinfo;
-//  png_colorp pcolor;
     FILE *handle;
-    int i, j;
-//  int w_factor, h_factor;
-    byte *rowbuf;
-
-    extern void I_RenderReadPixels(byte **data, int *w, int *h, int *p);
-
-/*
-    if (aspect_ratio_correct == 1)
-    {
-        // scale up to accommodate aspect ratio correction
-        w_factor = 5;
-        h_factor = 6;
-
-        width *= w_factor;
-        height *= h_factor;
-    }
-    else
-    {
-        w_factor = 1;
-        h_factor = 1;
-    }
-*/
+    const byte *rowbuf;
+    int i;
 
-    handle = M_fopen(filename, "wb");
+    handle = M_fopen(shot->filename, "wb");
     if (!handle)
     {
         return;
@@ -1140,76 +1735,115 @@ void WritePNGfile(char *filename, pixel_t *data,
 
     png_init_io(ppng, handle);
 
-    I_RenderReadPixels(&palette, &width, &height, &j);
-    rowbuf = palette; // [crispy] pointer abuse!
-
-    png_set_IHDR(ppng, pinfo, width, height,
+    png_set_IHDR(ppng, pinfo, shot->width, shot->height,
 #if SDL_VERSION_ATLEAST(2, 0, 5)
                  8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
 #else
                  8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE,
 #endif
                  PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-/*
-    png_set_IHDR(ppng, pinfo, width, height,
-                 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
-                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 
-    pcolor = malloc(sizeof(*pcolor) * 256);
-    if (!pcolor)
+    png_write_info(ppng, pinfo);
+
+    rowbuf = shot->pixels;
+    for (i = 0; i < shot->height; i++)
     {
-        fclose(handle);
-        png_destroy_write_struct(&ppng, &pinfo);
-        return;
+        png_write_row(ppng, rowbuf);
+        rowbuf += shot->pitch;
     }
 
-    for (i = 0; i < 256; i++)
+    png_write_end(ppng, pinfo);
+    png_destroy_write_struct(&ppng, &pinfo);
+    fclose(handle);
+}
+
+static int ScreenShotThread(void *arg)
+{
+    shot_t shot;
+
+    SDL_LockMutex(shot_mutex);
+
+    while (1)
     {
-        pcolor[i].red   = *(palette + 3 * i);
-        pcolor[i].green = *(palette + 3 * i + 1);
-        pcolor[i].blue  = *(palette + 3 * i + 2);
+        while (shot_queue_count == 0 && !shot_quit)
+        {
+            SDL_CondWait(shot_cond, shot_mutex);
+        }
+
+        if (shot_queue_count == 0)
+        {
+            break;
+        }
+
+        shot = shot_queue[shot_queue_head];
+        shot_queue_head = (shot_queue_head + 1) % SHOT_QUEUE_SIZE;
+        shot_queue_count--;
+        SDL_CondBroadcast(shot_cond);
+        SDL_UnlockMutex(shot_mutex);
+
+        WritePNGfile(&shot);
+        I_ReleaseReadPixels(shot.pixels);
+
+        SDL_LockMutex(shot_mutex);
     }
 
-    png_set_PLTE(ppng, pinfo, pcolor, 256);
-    free(pcolor);
-*/
+    SDL_UnlockMutex(shot_mutex);
 
-    png_write_info(ppng, pinfo);
+    return 0;
+}
 
-/*
-    rowbuf = malloc(width);
+// Lets the queued screenshots finish at exit.
 
-    if (rowbuf)
+static void FinishScreenShots(void)
+{
+    SDL_LockMutex(shot_mutex);
+    shot_quit = true;
+    SDL_CondBroadcast(shot_cond);
+    SDL_UnlockMutex(shot_mutex);
+
+    SDL_WaitThread(shot_thread, NULL);
+    shot_thread = NULL;
+}
+
+static void QueuePNGfile(const char *filename)
+{
+    shot_t shot;
+
+    M_StringCopy(shot.filename, filename, sizeof(shot.filename));
+    I_RenderReadPixels(&shot.pixels, &shot.width, &shot.height, &shot.pitch);
+
+    if (shot_thread == NULL && shot_mutex == NULL)
     {
-        for (i = 0; i < SCREENHEIGHT; i++)
-        {
-            // expand the row 5x
-            for (j = 0; j < SCREENWIDTH; j++)
-            {
-                memset(rowbuf + j * w_factor, *(data + i*SCREENWIDTH + j), w_factor);
-            }
+        shot_mutex = SDL_CreateMutex();
+        shot_cond = SDL_CreateCond();
+        shot_thread = SDL_CreateThread(ScreenShotThread, "screenshot", NULL);
 
-            // write the row 6 times
-            for (j = 0; j < h_factor; j++)
-            {
-                png_write_row(ppng, rowbuf);
-            }
+        if (shot_thread != NULL)
+        {
+            I_AtExit(FinishScreenShots, false);
         }
+    }
 
-        free(rowbuf);
+    if (shot_thread == NULL)
+    {
+        // No thread to hand it to; encode it here and now instead.
+        WritePNGfile(&shot);
+        I_ReleaseReadPixels(shot.pixels);
+        return;
     }
-*/
 
-    for (i = 0; i < height; i++)
+    SDL_LockMutex(shot_mutex);
+
+    while (shot_queue_count == SHOT_QUEUE_SIZE)
     {
-        png_write_row(ppng, rowbuf);
-        rowbuf += j;
+        SDL_CondWait(shot_cond, shot_mutex);
     }
-    free(palette);
 
-    png_write_end(ppng, pinfo);
-    png_destroy_write_struct(&ppng, &pinfo);
-    fclose(handle);
+    shot_queue[(shot_queue_head + shot_queue_count) % SHOT_QUEUE_SIZE] = shot;
+    shot_queue_count++;
+    SDL_CondBroadcast(shot_cond);
+
+    SDL_UnlockMutex(shot_mutex);
 }
 #endif
 
@@ -1217,7 +1851,17 @@ void WritePNGfile(char *filename, pixel_t *data,
 // V_ScreenShot
 //
 
-void V_ScreenShot(const char *format)
+// [AP] Where the search for a free file name starts: shots still in the
+// queue aren't on disk yet.
+
+static int shot_index = 0;
+
+// [AP] The rest of a burst, see V_ScreenShotBurstFrame()
+
+static const char *burst_format = NULL;
+static int burst_left = 0;
+
+static void ScreenShot(const char *format)
 {
     int i;
     char lbmname[16]; // haleyjd 20110213: BUG FIX - 12 is too small!
@@ -1236,7 +1880,7 @@ void V_ScreenShot(const char *format)
         ext = "pcx";
     }
 
-    for (i=0; i<=9999; i++) // [crispy] increase screenshot filename limit
+    for (i=shot_index; i<=9999; i++) // [crispy] increase screenshot filename limit
     {
         M_snprintf(lbmname, sizeof(lbmname), format, i, ext);
 
@@ -1260,12 +1904,12 @@ void V_ScreenShot(const char *format)
         }
     }
 
+    shot_index = i + 1;
+
 #ifdef HAVE_LIBPNG
     if (png_screenshots)
     {
-    WritePNGfile(lbmname, I_VideoBuffer,
-                 SCREENWIDTH, SCREENHEIGHT,
-                 W_CacheLumpName (DEH_String("PLAYPAL"), PU_CACHE));
+    QueuePNGfile(lbmname); // [AP]
     }
     else
 #endif
@@ -1277,6 +1921,30 @@ void V_ScreenShot(const char *format)
     }
 }
 
+void V_ScreenShot(const char *format)
+{
+    // [AP] with screenshot_burst, the frames after this one as well
+    burst_format = format;
+    burst_left = screenshot_burst - 1;
+
+    ScreenShot(format);
+}
+
+//
+// [AP] V_ScreenShotBurstFrame
+// Called once a frame has been drawn. Takes the next shot of a burst
+// started by V_ScreenShot, if there is one.
+//
+
+void V_ScreenShotBurstFrame(void)
+{
+    if (burst_left > 0)
+    {
+        burst_left--;
+        ScreenShot(burst_format);
+    }
+}
+
 #define MOUSE_SPEED_BOX_WIDTH  120
 #define MOUSE_SPEED_BOX_HEIGHT 9
 #define MOUSE_SPEED_BOX_X (SCREENWIDTH - MOUSE_SPEED_BOX_WIDTH - 10)
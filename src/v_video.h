@@ -65,6 +65,11 @@ void V_DrawAltTLPatch(int x, int y, patch_t * patch);
 void V_DrawShadowedPatch(int x, int y, patch_t *patch);
 void V_DrawXlaPatch(int x, int y, patch_t * patch);     // villsa [STRIFE]
 void V_DrawPatchDirect(int x, int y, patch_t *patch);
+
+// [AP] Draws like V_DrawPatch, dp_translation and all, from a cache of
+// ready translated glyphs. For font patches, drawn over and over in the
+// same few colours.
+void V_DrawGlyph(int x, int y, patch_t *patch);
 void V_DrawPatchFullScreen(patch_t *patch, boolean flipped);
 
 // Draw a linear block of pixels into the view buffer.
@@ -99,6 +104,7 @@ void V_RestoreBuffer(void);
 // "DOOM%02i.pcx"
 
 void V_ScreenShot(const char *format);
+void V_ScreenShotBurstFrame(void); // [AP] screenshot_burst
 
 // Load the lookup table for translucency calculations from the TINTTAB
 // lump.
@@ -17,11 +17,13 @@
 //
 
 #include <stdio.h>
+#include <string.h>
 
 #include "config.h"
 
 #include "doomtype.h"
 #include "m_argv.h"
+#include "m_misc.h"
 
 #include "w_file.h"
 
@@ -37,6 +39,31 @@ static wad_file_class_t *wad_file_classes[] =
     &stdc_wad_file,
 };
 
+// [AP] The archipelago resource WADs are merged on every launch; map
+// them even without -mmap so their lumps are never copied.
+
+static const char *const always_mapped_wads[] =
+{
+    "apdoom.wad",
+    "apheretic.wad",
+};
+
+static boolean W_AlwaysMapped(const char *path)
+{
+    const char *base = M_BaseName(path);
+    int i;
+
+    for (i = 0; i < arrlen(always_mapped_wads); ++i)
+    {
+        if (!strcasecmp(base, always_mapped_wads[i]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 wad_file_t *W_OpenFile(const char *path)
 {
     wad_file_t *result;
@@ -49,7 +76,7 @@ wad_file_t *W_OpenFile(const char *path)
     // directly into memory.
     //
 
-    if (!M_CheckParm("-mmap"))
+    if (!M_CheckParm("-mmap") && !W_AlwaysMapped(path))
     {
         return stdc_wad_file.OpenFile(path);
     }
@@ -82,3 +109,17 @@ size_t W_Read(wad_file_t *wad, unsigned int offset,
     return wad->file_class->Read(wad, offset, buffer, buffer_len);
 }
 
+void W_Prefetch(wad_file_t *wad, unsigned int offset, size_t len)
+{
+    if (wad->file_class->Prefetch == NULL || offset >= wad->length)
+    {
+        return;
+    }
+
+    if (len > wad->length - offset)
+    {
+        len = wad->length - offset;
+    }
+
+    wad->file_class->Prefetch(wad, offset, len);
+}
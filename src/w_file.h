@@ -37,6 +37,10 @@ typedef struct
     // provided buffer.  Returns the number of bytes read.
     size_t (*Read)(wad_file_t *file, unsigned int offset,
                    void *buffer, size_t buffer_len);
+
+    // [AP] Tell the OS a range of the file will be read soon, so it can
+    // start bringing it in. Optional, NULL if there's no way to.
+    void (*Prefetch)(wad_file_t *file, unsigned int offset, size_t len);
 } wad_file_class_t;
 
 
@@ -83,4 +87,9 @@ void W_CloseFile(wad_file_t *wad);
 size_t W_Read(wad_file_t *wad, unsigned int offset,
               void *buffer, size_t buffer_len);
 
+// [AP] Hint that a range of the file will be read soon. Returns at once;
+// does nothing where the file's class can't prefetch.
+
+void W_Prefetch(wad_file_t *wad, unsigned int offset, size_t len);
+
 #endif /* #ifndef __W_FILE__ */
@@ -163,12 +163,38 @@ size_t W_POSIX_Read(wad_file_t *wad, unsigned int offset,
     return bytes_read;
 }
 
+// [AP] madvise wants a page aligned start; a mapped file is read through
+// page faults, so without the hint each one waits on the disk in turn.
+
+static void W_POSIX_Prefetch(wad_file_t *wad, unsigned int offset, size_t len)
+{
+    posix_wad_file_t *posix_wad;
+    size_t page, start;
+
+    posix_wad = (posix_wad_file_t *) wad;
+
+    if (posix_wad->wad.mapped != NULL)
+    {
+        page = sysconf(_SC_PAGESIZE);
+        start = offset - offset % page;
+        madvise(posix_wad->wad.mapped + start, len + (offset - start),
+                MADV_WILLNEED);
+    }
+#ifdef POSIX_FADV_WILLNEED
+    else
+    {
+        posix_fadvise(posix_wad->handle, offset, len, POSIX_FADV_WILLNEED);
+    }
+#endif
+}
+
 
 wad_file_class_t posix_wad_file = 
 {
     W_POSIX_OpenFile,
     W_POSIX_CloseFile,
     W_POSIX_Read,
+    W_POSIX_Prefetch,
 };
 
 
@@ -17,6 +17,9 @@
 //
 
 #include <stdio.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
 
 #include "m_misc.h"
 #include "w_file.h"
@@ -85,12 +88,30 @@ size_t W_StdC_Read(wad_file_t *wad, unsigned int offset,
     return result;
 }
 
+#ifdef POSIX_FADV_WILLNEED
+// [AP] Start the reads into the page cache, for fread to find later.
+
+static void W_StdC_Prefetch(wad_file_t *wad, unsigned int offset, size_t len)
+{
+    stdc_wad_file_t *stdc_wad;
+
+    stdc_wad = (stdc_wad_file_t *) wad;
+
+    posix_fadvise(fileno(stdc_wad->fstream), offset, len, POSIX_FADV_WILLNEED);
+}
+#endif
+
 
 wad_file_class_t stdc_wad_file = 
 {
     W_StdC_OpenFile,
     W_StdC_CloseFile,
     W_StdC_Read,
+#ifdef POSIX_FADV_WILLNEED
+    W_StdC_Prefetch,
+#else
+    NULL,
+#endif
 };
 
 
@@ -122,6 +122,8 @@ static wad_file_t *W_Win32_OpenFile(const char *path)
     result->wad.length = GetFileLength(handle);
     result->wad.path = M_StringDuplicate(path);
     result->handle = handle;
+    result->handle_map = NULL;
+    result->wad.mapped = NULL;
 
     // Try to map the file into memory with mmap:
 
@@ -190,12 +192,51 @@ size_t W_Win32_Read(wad_file_t *wad, unsigned int offset,
     return bytes_read;
 }
 
+// [AP] PrefetchVirtualMemory is Windows 8 and later, so it's looked up
+// rather than linked; its range type is declared here for older headers.
+
+typedef struct
+{
+    PVOID VirtualAddress;
+    SIZE_T NumberOfBytes;
+} prefetch_range_t;
+
+typedef BOOL (WINAPI *prefetch_func_t)(HANDLE process, ULONG_PTR count,
+                                       prefetch_range_t *ranges, ULONG flags);
+
+static void W_Win32_Prefetch(wad_file_t *wad, unsigned int offset, size_t len)
+{
+    static prefetch_func_t prefetch_func = NULL;
+    static boolean prefetch_looked_up = false;
+    prefetch_range_t range;
+
+    if (wad->mapped == NULL)
+    {
+        return;
+    }
+
+    if (!prefetch_looked_up)
+    {
+        prefetch_looked_up = true;
+        prefetch_func = (prefetch_func_t) GetProcAddress(
+            GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory");
+    }
+
+    if (prefetch_func != NULL)
+    {
+        range.VirtualAddress = wad->mapped + offset;
+        range.NumberOfBytes = len;
+        prefetch_func(GetCurrentProcess(), 1, &range, 0);
+    }
+}
+
 
 wad_file_class_t win32_wad_file = 
 {
     W_Win32_OpenFile,
     W_Win32_CloseFile,
     W_Win32_Read,
+    W_Win32_Prefetch,
 };
 
 
@@ -59,8 +59,17 @@ typedef PACKED_STRUCT (
 lumpinfo_t **lumpinfo;
 unsigned int numlumps = 0;
 
-// Hash table for fast lookups
-static lumpindex_t *lumphash;
+// Hash table for fast lookups.
+// [AP] Open addressing, keyed by the upper-cased name packed into 64 bits.
+typedef struct
+{
+    uint64_t key;
+    lumpindex_t lump;
+} lumphashslot_t;
+
+static lumphashslot_t *lumphash;
+static unsigned int lumphashmask;
+static unsigned int lumphashsize; // [AP] numlumps the table was built for
 
 // Variables for the reload hack: filename of the PWAD to reload, and the
 // lumps from WADs before the reload file, so we can resent numlumps and
@@ -103,6 +112,27 @@ unsigned int W_LumpNameHash(const char *s)
     return result;
 }
 
+// [AP] Pack a lump name into a single integer, upper-cased and zero
+// padded, so that names compare with one integer compare.
+
+static inline uint64_t W_LumpNameKey(const char *s)
+{
+    uint64_t key = 0;
+    unsigned int i;
+
+    for (i = 0; i < 8 && s[i] != '\0'; ++i)
+    {
+        key |= (uint64_t) (byte) toupper(s[i]) << (i * 8);
+    }
+
+    return key;
+}
+
+static inline unsigned int W_LumpKeySlot(uint64_t key)
+{
+    return (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & lumphashmask;
+}
+
 //
 // LUMP BASED ROUTINES.
 //
@@ -281,21 +311,29 @@ lumpindex_t W_CheckNumForName(const char *name)
 {
     lumpindex_t i;
 
+    // [AP] (Re)build the hash table on demand, so lookups made while
+    // WADs are still being added don't fall back to a linear search.
+
+    if (lumphash == NULL || lumphashsize != numlumps)
+    {
+        W_GenerateHashTable();
+    }
+
     // Do we have a hash table yet?
 
     if (lumphash != NULL)
     {
-        int hash;
+        const uint64_t key = W_LumpNameKey(name);
+        unsigned int slot;
 
         // We do! Excellent.
 
-        hash = W_LumpNameHash(name) % numlumps;
-
-        for (i = lumphash[hash]; i != -1; i = lumpinfo[i]->next)
+        for (slot = W_LumpKeySlot(key); lumphash[slot].lump != -1;
+             slot = (slot + 1) & lumphashmask)
         {
-            if (!strncasecmp(lumpinfo[i]->name, name, 8))
+            if (lumphash[slot].key == key)
             {
-                return i;
+                return lumphash[slot].lump;
             }
         }
     }
@@ -502,6 +540,87 @@ void W_ReleaseLumpName(const char *name)
     W_ReleaseLumpNum(W_GetNumForName(name));
 }
 
+// [AP] Lumps closer together than this are hinted as one range, reading
+// the gap costs less than another trip to the disk.
+#define PREFETCH_GAP (64 * 1024)
+
+static int W_CompareLumpPositions(const void *a, const void *b)
+{
+    const lumpinfo_t *la = lumpinfo[*(const lumpindex_t *) a];
+    const lumpinfo_t *lb = lumpinfo[*(const lumpindex_t *) b];
+
+    if (la->wad_file != lb->wad_file)
+    {
+        return (uintptr_t) la->wad_file < (uintptr_t) lb->wad_file ? -1 : 1;
+    }
+
+    if (la->position != lb->position)
+    {
+        return la->position < lb->position ? -1 : 1;
+    }
+
+    return *(const lumpindex_t *) a - *(const lumpindex_t *) b;
+}
+
+//
+// W_SortLumps
+// [AP] Put lumps in file order, WAD by WAD, so reading them in turn is a
+// forward sweep over each file instead of a seek per lump.
+//
+
+void W_SortLumps(lumpindex_t *lumps, int count)
+{
+    qsort(lumps, count, sizeof(*lumps), W_CompareLumpPositions);
+}
+
+//
+// W_PrefetchLumps
+// [AP] Hint that lumps sorted by W_SortLumps will be read soon. Neighbours
+// are merged into one range, and lumps already in the zone are skipped.
+//
+
+void W_PrefetchLumps(const lumpindex_t *lumps, int count)
+{
+    wad_file_t *wad = NULL;
+    unsigned int start = 0, end = 0;
+    lumpinfo_t *lump;
+    int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        lump = lumpinfo[lumps[i]];
+
+        if (lump->size <= 0
+         || (lump->wad_file->mapped == NULL && lump->cache != NULL))
+        {
+            continue;
+        }
+
+        if (lump->wad_file == wad && lump->position <= end + PREFETCH_GAP)
+        {
+            if (lump->position + lump->size > end)
+            {
+                end = lump->position + lump->size;
+            }
+            continue;
+        }
+
+        if (wad != NULL)
+        {
+            W_Prefetch(wad, start, end - start);
+        }
+
+        wad = lump->wad_file;
+        start = lump->position;
+        end = lump->position + lump->size;
+    }
+
+    if (wad != NULL)
+    {
+        W_Prefetch(wad, start, end - start);
+    }
+}
+
 #if 0
 
 //
@@ -578,28 +697,49 @@ void W_GenerateHashTable(void)
     if (lumphash != NULL)
     {
         Z_Free(lumphash);
+        lumphash = NULL;
     }
 
+    lumphashsize = numlumps;
+
     // Generate hash table
     if (numlumps > 0)
     {
-        lumphash = Z_Malloc(sizeof(lumpindex_t) * numlumps, PU_STATIC, NULL);
+        unsigned int size = 1;
 
-        for (i = 0; i < numlumps; ++i)
+        // [AP] At most half full, so probe runs stay short.
+        while (size < 2 * numlumps)
         {
-            lumphash[i] = -1;
+            size <<= 1;
         }
 
-        for (i = 0; i < numlumps; ++i)
+        lumphash = Z_Malloc(sizeof(lumphashslot_t) * size, PU_STATIC, NULL);
+        lumphashmask = size - 1;
+
+        for (i = 0; i < size; ++i)
         {
-            unsigned int hash;
+            lumphash[i].lump = -1;
+        }
 
-            hash = W_LumpNameHash(lumpinfo[i]->name) % numlumps;
+        // Later lumps overwrite earlier ones with the same name, so PWAD
+        // lumps take precedence just like the backwards linear scan.
 
-            // Hook into the hash table
+        for (i = 0; i < numlumps; ++i)
+        {
+            const uint64_t key = W_LumpNameKey(lumpinfo[i]->name);
+            unsigned int slot;
+
+            for (slot = W_LumpKeySlot(key); lumphash[slot].lump != -1;
+                 slot = (slot + 1) & lumphashmask)
+            {
+                if (lumphash[slot].key == key)
+                {
+                    break;
+                }
+            }
 
-            lumpinfo[i]->next = lumphash[hash];
-            lumphash[hash] = i;
+            lumphash[slot].key = key;
+            lumphash[slot].lump = i;
         }
     }
 
@@ -44,9 +44,6 @@ struct lumpinfo_s
     int		position;
     int		size;
     void       *cache;
-
-    // Used for hash table lookups
-    lumpindex_t next;
 };
 
 
@@ -73,6 +70,9 @@ extern unsigned int W_LumpNameHash(const char *s);
 void W_ReleaseLumpNum(lumpindex_t lump);
 void W_ReleaseLumpName(const char *name);
 
+void W_SortLumps(lumpindex_t *lumps, int count);
+void W_PrefetchLumps(const lumpindex_t *lumps, int count);
+
 const char *W_WadNameForLump(const lumpinfo_t *lump);
 boolean W_IsIWADLump(const lumpinfo_t *lump);
 
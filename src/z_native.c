@@ -27,6 +27,13 @@
 #include "i_system.h"
 #include "doomtype.h"
 
+#ifdef ZONE_STATS
+// [AP] Telemetry is only implemented by the zone allocator (z_zone.c);
+// here the call-site entry points just forward.
+#undef Z_Malloc
+void *Z_Malloc(int size, int tag, void *user);
+#endif
+
 #define ZONEID	0x1d4a11
 
 typedef struct memblock_s memblock_t;
@@ -504,3 +511,13 @@ unsigned int Z_ZoneSize(void)
     return 0;
 }
 
+#ifdef ZONE_STATS
+void *Z_Malloc2(int size, int tag, void *user, const char *file, int line)
+{
+    return Z_Malloc(size, tag, user);
+}
+
+void Z_StatsLevel(const char *name)
+{
+}
+#endif
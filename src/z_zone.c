@@ -21,9 +21,22 @@
 #include "doomtype.h"
 #include "i_system.h"
 #include "m_argv.h"
+#include "m_memory.h"
 
 #include "z_zone.h"
 
+#ifdef ZONE_STATS
+#include <stdlib.h>
+
+#include "i_timer.h"
+#include "m_misc.h"
+
+// [AP] Z_Malloc records its call site in this build; the allocator
+// itself keeps its plain name.
+#undef Z_Malloc
+void *Z_Malloc(int size, int tag, void *user);
+#endif
+
 
 //
 // ZONE MEMORY ALLOCATION
@@ -47,6 +60,10 @@ typedef struct memblock_s
     int			id;	// should be ZONEID
     struct memblock_s*	next;
     struct memblock_s*	prev;
+#ifdef ZONE_STATS
+    int			site;	// [AP] index into zonesites, or -1
+    int			birth;	// [AP] I_GetTimeMS() at allocation
+#endif
 } memblock_t;
 
 
@@ -69,6 +86,89 @@ static boolean zero_on_free;
 static boolean scan_on_free;
 
 
+//
+// [AP] LEVEL ARENA AND SIZE-CLASS POOLS
+//
+// Owner-less PU_LEVEL and PU_LEVSPEC blocks never touch the rover.
+// They are bumped out of arena chunks (PU_STATIC zone blocks kept from
+// level to level), so tearing a level down is a single reset instead
+// of a walk over every block. Small ones (mobjs, thinkers and the like)
+// come from per-class free lists in slabs that themselves live in the
+// arena, so churn within a level is recycled. Every block keeps its own
+// memblock_t header so Z_Free and Z_ChangeTag work unchanged.
+//
+
+#define POOLID		0x1d4a12
+#define ARENAID		0x1d4a13
+#define POOLCHUNKS	64
+#define ARENACHUNK	(1024 * 1024)
+#define POISON		0xa5
+
+typedef struct memslab_s
+{
+    struct memslab_s*	next;
+    void*		pad;	// keep chunks MEM_ALIGN aligned
+} memslab_t;
+
+typedef struct
+{
+    int			size;	// chunk size, including the header
+    memblock_t*		freelist;
+    memslab_t*		slabs;
+    int			numslabs;
+    int			inuse;
+    int			peak;
+    unsigned int	allocs;
+} mempool_t;
+
+#define POOLSIZE(n)	((n) + (int) sizeof(memblock_t))
+
+static mempool_t mempools[] =
+{
+    {POOLSIZE(16)}, {POOLSIZE(32)}, {POOLSIZE(64)}, {POOLSIZE(96)},
+    {POOLSIZE(128)}, {POOLSIZE(192)}, {POOLSIZE(256)}, {POOLSIZE(384)},
+    {POOLSIZE(512)},
+};
+
+#define NUMMEMPOOLS	arrlen(mempools)
+#define POOLMAXSIZE	512
+
+typedef struct memarena_s
+{
+    struct memarena_s*	next;
+    int			size;	// usable bytes following this header
+    int			used;
+} memarena_t;
+
+static memarena_t *arenas, *arenacur;
+static int arenapeak;
+static unsigned int arenaresets;
+
+static boolean use_pools;
+
+// [AP] All the zones allocated, for the memory report
+static size_t zone_total_bytes;
+
+static size_t Z_TotalBytes(void)
+{
+    return zone_total_bytes;
+}
+static boolean poison_on_free;
+
+static void ScanForBlock(void *start, void *end);
+
+#ifdef ZONE_STATS
+static boolean stats_enabled;
+static void Z_StatsFree(memblock_t *block);
+static void Z_StatsRetag(memblock_t *block, int tag);
+static void Z_StatsReport(void);
+#define Z_StatsUntracked(block) ((block)->site = -1)
+#else
+#define Z_StatsFree(block)
+#define Z_StatsRetag(block, tag)
+#define Z_StatsUntracked(block)
+#endif
+
 //
 // Z_ClearZone
 //
@@ -106,6 +206,13 @@ void Z_Init (void)
     mainzone = (memzone_t *)I_ZoneBase (&size);
     mainzone->size = size;
 
+    // [AP]
+    if (zone_total_bytes == 0)
+    {
+        M_AddMemoryUser("zone heap", Z_TotalBytes, NULL);
+    }
+    zone_total_bytes += size;
+
     // set the entire zone to one free block
     mainzone->blocklist.next =
 	mainzone->blocklist.prev =
@@ -133,6 +240,329 @@ void Z_Init (void)
     // heap is scanned to look for remaining pointers to the freed block.
     //
     scan_on_free = M_ParmExists("-zonescan");
+
+    // [Deliberately undocumented]
+    // Zone memory debugging flag. If set, freed memory is filled with a
+    // recognisable byte pattern, including level arena memory on reset.
+    //
+    poison_on_free = M_ParmExists("-zonepoison");
+
+    // [Deliberately undocumented]
+    // Zone memory debugging flag. If set, level allocations go through
+    // the rover like everything else instead of the arena and pools.
+    //
+    use_pools = !M_ParmExists("-zonenopool");
+
+#ifdef ZONE_STATS
+    //!
+    // @category obscure
+    //
+    // Print zone allocation statistics per tag, call site and level
+    // on exit. Only available in builds configured with zone stats.
+    //
+
+    if (!stats_enabled && M_ParmExists("-zonestats"))
+    {
+        stats_enabled = true;
+        I_AtExit(Z_StatsReport, true);
+    }
+#endif
+}
+
+// [AP] Apply the -zonezero/-zonepoison/-zonescan debugging aids to a
+// block that is being freed.
+static void Z_ScrubFree(void *ptr, int len)
+{
+    if (poison_on_free)
+    {
+        memset(ptr, POISON, len);
+    }
+    else if (zero_on_free)
+    {
+        memset(ptr, 0, len);
+    }
+    if (scan_on_free)
+    {
+        ScanForBlock(ptr, (byte *) ptr + len);
+    }
+}
+
+static memblock_t *Z_ArenaMalloc(int size, int tag)
+{
+    memarena_t *arena;
+    memblock_t *block;
+
+    // Use the current chunk, then any chunk emptied by the last reset.
+    while (arenacur != NULL && arenacur->size - arenacur->used < size)
+    {
+        arenacur = arenacur->next;
+    }
+
+    if (arenacur == NULL)
+    {
+        int chunksize = size > ARENACHUNK ? size : ARENACHUNK;
+
+        arena = Z_Malloc(sizeof(memarena_t) + chunksize, PU_STATIC, NULL);
+        arena->size = chunksize;
+        arena->used = 0;
+        arena->next = NULL;
+
+        if (arenas == NULL)
+        {
+            arenas = arena;
+        }
+        else
+        {
+            memarena_t *last = arenas;
+
+            while (last->next != NULL)
+            {
+                last = last->next;
+            }
+            last->next = arena;
+        }
+
+        arenacur = arena;
+    }
+
+    arena = arenacur;
+    block = (memblock_t *) ((byte *) arena + sizeof(memarena_t) + arena->used);
+    arena->used += size;
+
+    block->size = size;
+    block->user = NULL;
+    block->tag = tag;
+    block->id = ARENAID;
+    block->next = NULL;
+    block->prev = (memblock_t *) arena;	// owning chunk
+    Z_StatsUntracked(block);
+
+    return block;
+}
+
+static void Z_ArenaFree(memblock_t *block)
+{
+    memarena_t *arena = (memarena_t *) block->prev;
+    byte *ptr = (byte *) block + sizeof(memblock_t);
+
+    Z_StatsFree(block);
+    Z_ScrubFree(ptr, block->size - sizeof(memblock_t));
+
+    block->tag = PU_FREE;
+    block->id = 0;
+
+    // Give the space back if this was the most recent allocation.
+    if ((byte *) block + block->size
+     == (byte *) arena + sizeof(memarena_t) + arena->used)
+    {
+        arena->used -= block->size;
+    }
+}
+
+// Pool serving blocks of the given size (header included), if any.
+static mempool_t *Z_PoolForSize(int size)
+{
+    int i;
+
+    for (i = 0; i < NUMMEMPOOLS; ++i)
+    {
+        if (size <= mempools[i].size)
+        {
+            return &mempools[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void Z_GrowPool(mempool_t *pool)
+{
+    memslab_t *slab;
+    byte *chunk;
+    int i;
+
+    // Slabs are tagged PU_STATIC within the arena so that partial
+    // Z_FreeTags sweeps skip them; the level reset reclaims them.
+    slab = (memslab_t *) ((byte *) Z_ArenaMalloc(sizeof(memblock_t)
+                                                + sizeof(memslab_t)
+                                                + POOLCHUNKS * pool->size,
+                                                PU_STATIC)
+                          + sizeof(memblock_t));
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->numslabs++;
+
+    chunk = (byte *) slab + sizeof(memslab_t);
+
+    for (i = 0; i < POOLCHUNKS; ++i, chunk += pool->size)
+    {
+        memblock_t *block = (memblock_t *) chunk;
+
+        block->size = pool->size;
+        block->user = NULL;
+        block->tag = PU_FREE;
+        block->id = 0;
+        block->prev = NULL;
+        block->next = pool->freelist;
+        pool->freelist = block;
+    }
+}
+
+static memblock_t *Z_PoolMalloc(mempool_t *pool, int tag)
+{
+    memblock_t *block;
+
+    if (pool->freelist == NULL)
+    {
+        Z_GrowPool(pool);
+    }
+
+    block = pool->freelist;
+    pool->freelist = block->next;
+
+    Z_StatsUntracked(block);
+    block->next = NULL;
+    block->user = NULL;
+    block->tag = tag;
+    block->id = POOLID;
+
+    pool->allocs++;
+    if (++pool->inuse > pool->peak)
+    {
+        pool->peak = pool->inuse;
+    }
+
+    return block;
+}
+
+static void Z_PoolFree(memblock_t *block)
+{
+    mempool_t *pool = Z_PoolForSize(block->size);
+
+    Z_StatsFree(block);
+    Z_ScrubFree((byte *) block + sizeof(memblock_t),
+                block->size - sizeof(memblock_t));
+
+    block->tag = PU_FREE;
+    block->id = 0;
+
+    block->next = pool->freelist;
+    pool->freelist = block;
+    pool->inuse--;
+}
+
+static void Z_ArenaFreeTags(int lowtag, int hightag);
+
+// Drop every arena and pool block at once.
+static void Z_ArenaReset(void)
+{
+    memarena_t *arena;
+    int i, used = 0;
+
+#ifdef ZONE_STATS
+    // Account for each block going away; only this build pays for it.
+    if (stats_enabled)
+        Z_ArenaFreeTags(PU_LEVEL, PU_LEVSPEC);
+#endif
+
+    for (arena = arenas; arena != NULL; arena = arena->next)
+    {
+        if (poison_on_free)
+        {
+            memset((byte *) arena + sizeof(memarena_t), POISON, arena->used);
+        }
+        used += arena->used;
+        arena->used = 0;
+    }
+
+    if (used > arenapeak)
+    {
+        arenapeak = used;
+    }
+    arenacur = arenas;
+    arenaresets++;
+
+    for (i = 0; i < NUMMEMPOOLS; ++i)
+    {
+        mempools[i].freelist = NULL;
+        mempools[i].slabs = NULL;
+        mempools[i].numslabs = 0;
+        mempools[i].inuse = 0;
+    }
+}
+
+// Free the arena and pool blocks within a tag range, without reclaiming
+// their space until the next reset.
+static void Z_ArenaFreeTags(int lowtag, int hightag)
+{
+    memarena_t *arena;
+    int i, j;
+
+    for (i = 0; i < NUMMEMPOOLS; ++i)
+    {
+        mempool_t *pool = &mempools[i];
+        memslab_t *slab;
+
+        for (slab = pool->slabs; slab != NULL && pool->inuse; slab = slab->next)
+        {
+            byte *chunk = (byte *) slab + sizeof(memslab_t);
+
+            for (j = 0; j < POOLCHUNKS; ++j, chunk += pool->size)
+            {
+                memblock_t *block = (memblock_t *) chunk;
+
+                if (block->tag != PU_FREE
+                 && block->tag >= lowtag && block->tag <= hightag)
+                {
+                    Z_PoolFree(block);
+                }
+            }
+        }
+    }
+
+    for (arena = arenas; arena != NULL; arena = arena->next)
+    {
+        byte *p = (byte *) arena + sizeof(memarena_t);
+        byte *end = p + arena->used;
+
+        while (p < end)
+        {
+            memblock_t *block = (memblock_t *) p;
+
+            p += block->size;
+
+            if (block->tag != PU_FREE
+             && block->tag >= lowtag && block->tag <= hightag)
+            {
+                Z_ArenaFree(block);
+            }
+        }
+    }
+}
+
+static void Z_PrintPoolStats(FILE *f)
+{
+    memarena_t *arena;
+    int i, chunks = 0, size = 0, used = 0;
+
+    for (arena = arenas; arena != NULL; arena = arena->next)
+    {
+        chunks++;
+        size += arena->size;
+        used += arena->used;
+    }
+
+    fprintf(f, "arena chunks:%4i    size:%9i    used:%9i    peak:%9i    "
+               "resets:%u\n", chunks, size, used, arenapeak, arenaresets);
+
+    for (i = 0; i < NUMMEMPOOLS; ++i)
+    {
+        const mempool_t *pool = &mempools[i];
+
+        fprintf(f, "pool:%4i    slabs:%4i    inuse:%6i    peak:%6i    "
+                   "allocs:%u\n", pool->size, pool->numslabs, pool->inuse,
+                   pool->peak, pool->allocs);
+    }
 }
 
 // Scan the zone heap for pointers within the specified range, and warn about
@@ -182,9 +612,22 @@ void Z_Free (void* ptr)
 
     block = (memblock_t *) ( (byte *)ptr - sizeof(memblock_t));
 
+    if (block->id == POOLID)
+    {
+        Z_PoolFree(block);
+        return;
+    }
+    if (block->id == ARENAID)
+    {
+        Z_ArenaFree(block);
+        return;
+    }
+
     if (block->id != ZONEID)
 	I_Error ("Z_Free: freed a pointer without ZONEID");
 
+    Z_StatsFree(block);
+
     if (block->tag != PU_FREE && block->user != NULL)
     {
     	// clear the user's mark
@@ -198,15 +641,7 @@ void Z_Free (void* ptr)
 
     // If the -zonezero flag is provided, we zero out the block on free
     // to break code that depends on reading freed memory.
-    if (zero_on_free)
-    {
-        memset(ptr, 0, block->size - sizeof(memblock_t));
-    }
-    if (scan_on_free)
-    {
-        ScanForBlock(ptr,
-                     (byte *) ptr + block->size - sizeof(memblock_t));
-    }
+    Z_ScrubFree(ptr, block->size - sizeof(memblock_t));
 
     other = block->prev;
 
@@ -259,6 +694,17 @@ Z_Malloc
     void *result;
 
     size = (size + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+
+    // [AP] owner-less level blocks come from the arena and its pools
+    if (use_pools && user == NULL && (tag == PU_LEVEL || tag == PU_LEVSPEC))
+    {
+        if (size <= POOLMAXSIZE)
+            base = Z_PoolMalloc(Z_PoolForSize(size + sizeof(memblock_t)), tag);
+        else
+            base = Z_ArenaMalloc(size + sizeof(memblock_t), tag);
+
+        return (byte *) base + sizeof(memblock_t);
+    }
     
     // scan through the block list,
     // looking for the first free block
@@ -344,6 +790,7 @@ Z_Malloc
 
     base->user = user;
     base->tag = tag;
+    Z_StatsUntracked(base);
 
     result  = (void *) ((byte *)base + sizeof(memblock_t));
 
@@ -387,6 +834,12 @@ Z_FreeTags
 	if (block->tag >= lowtag && block->tag <= hightag)
 	    Z_Free ( (byte *)block+sizeof(memblock_t));
     }
+
+    // [AP] the usual level teardown resets the arena in one go
+    if (lowtag <= PU_LEVEL && hightag >= PU_LEVSPEC)
+	Z_ArenaReset();
+    else
+	Z_ArenaFreeTags(lowtag, hightag);
 }
 
 
@@ -429,6 +882,8 @@ Z_DumpHeap
 	if (block->tag == PU_FREE && block->next->tag == PU_FREE)
 	    printf ("ERROR: two consecutive free blocks\n");
     }
+
+    Z_PrintPoolStats(stdout);
 }
 
 
@@ -461,6 +916,8 @@ void Z_FileDumpHeap (FILE* f)
 	if (block->tag == PU_FREE && block->next->tag == PU_FREE)
 	    fprintf (f,"ERROR: two consecutive free blocks\n");
     }
+
+    Z_PrintPoolStats(f);
 }
 
 
@@ -503,10 +960,19 @@ void Z_ChangeTag2(void *ptr, int tag, const char *file, int line)
 	
     block = (memblock_t *) ((byte *)ptr - sizeof(memblock_t));
 
-    if (block->id != ZONEID)
+    if (block->id == POOLID || block->id == ARENAID)
+    {
+        // [AP] arena blocks are reclaimed with the level
+        if (tag != PU_LEVEL && tag != PU_LEVSPEC)
+            I_Error("%s:%i: Z_ChangeTag: level arena block can't take "
+                    "tag %i", file, line, tag);
+    }
+    else if (block->id != ZONEID)
         I_Error("%s:%i: Z_ChangeTag: block without a ZONEID!",
                 file, line);
 
+    Z_StatsRetag(block, tag);
+
     if (tag >= PU_PURGELEVEL && block->user == NULL)
         I_Error("%s:%i: Z_ChangeTag: an owner is required "
                 "for purgable blocks", file, line);
@@ -557,3 +1023,234 @@ unsigned int Z_ZoneSize(void)
     return mainzone->size;
 }
 
+#ifdef ZONE_STATS
+
+//
+// [AP] ZONE TELEMETRY
+//
+// Instrumentation build only (ZONE_STATS). Z_Malloc records its call
+// site; counts, bytes and lifetimes are kept per site and per tag, and
+// live bytes are tracked per level. The report is printed at exit
+// when -zonestats is given.
+//
+
+#define MAXZONESITES	8192
+
+typedef struct
+{
+    const char*		file;
+    int			line;
+    int			tag;	// tag of the first allocation
+    unsigned int	allocs;
+    unsigned int	frees;
+    uint64_t		bytes;
+    int			livebytes;
+    int			peakbytes;
+    uint64_t		lifetime;	// ms, summed over freed blocks
+} zonesite_t;
+
+typedef struct
+{
+    unsigned int	allocs;
+    uint64_t		bytes;
+    int			livebytes;
+    int			peakbytes;
+} zonetag_t;
+
+typedef struct
+{
+    char		name[9];
+    int			basebytes;
+    int			peakbytes;
+} zonelevel_t;
+
+static zonesite_t	zonesites[MAXZONESITES];
+static int		numzonesites;
+static zonetag_t	zonetags[PU_NUM_TAGS];
+static zonelevel_t*	zonelevels;
+static int		numzonelevels;
+static int		zonelivebytes, zonepeakbytes;
+
+static int Z_StatsSite(const char *file, int line, int tag)
+{
+    unsigned int slot;
+
+    slot = ((uintptr_t) file * 31u + (unsigned int) line) % MAXZONESITES;
+
+    while (zonesites[slot].file != NULL)
+    {
+        if (zonesites[slot].file == file && zonesites[slot].line == line)
+        {
+            return slot;
+        }
+        slot = (slot + 1) % MAXZONESITES;
+    }
+
+    if (++numzonesites >= MAXZONESITES)
+    {
+        I_Error("Z_StatsSite: too many allocation sites");
+    }
+
+    zonesites[slot].file = file;
+    zonesites[slot].line = line;
+    zonesites[slot].tag = tag;
+
+    return slot;
+}
+
+static void Z_StatsLive(int tag, int delta)
+{
+    zonetags[tag].livebytes += delta;
+    if (zonetags[tag].livebytes > zonetags[tag].peakbytes)
+        zonetags[tag].peakbytes = zonetags[tag].livebytes;
+
+    zonelivebytes += delta;
+    if (zonelivebytes > zonepeakbytes)
+        zonepeakbytes = zonelivebytes;
+
+    if (numzonelevels > 0
+     && zonelivebytes > zonelevels[numzonelevels - 1].peakbytes)
+        zonelevels[numzonelevels - 1].peakbytes = zonelivebytes;
+}
+
+void *Z_Malloc2(int size, int tag, void *user, const char *file, int line)
+{
+    void *result = Z_Malloc(size, tag, user);
+    memblock_t *block;
+    zonesite_t *site;
+
+    if (!stats_enabled)
+    {
+        return result;
+    }
+
+    block = (memblock_t *) ((byte *) result - sizeof(memblock_t));
+    block->site = Z_StatsSite(file, line, tag);
+    block->birth = I_GetTimeMS();
+
+    site = &zonesites[block->site];
+    site->allocs++;
+    site->bytes += block->size;
+    site->livebytes += block->size;
+    if (site->livebytes > site->peakbytes)
+        site->peakbytes = site->livebytes;
+
+    zonetags[tag].allocs++;
+    zonetags[tag].bytes += block->size;
+    Z_StatsLive(tag, block->size);
+
+    return result;
+}
+
+static void Z_StatsFree(memblock_t *block)
+{
+    zonesite_t *site;
+
+    if (block->site < 0)
+    {
+        return;
+    }
+
+    site = &zonesites[block->site];
+    site->frees++;
+    site->livebytes -= block->size;
+    site->lifetime += I_GetTimeMS() - block->birth;
+
+    Z_StatsLive(block->tag, -block->size);
+    block->site = -1;
+}
+
+static void Z_StatsRetag(memblock_t *block, int tag)
+{
+    if (block->site < 0)
+    {
+        return;
+    }
+
+    Z_StatsLive(block->tag, -block->size);
+    Z_StatsLive(tag, block->size);
+}
+
+void Z_StatsLevel(const char *name)
+{
+    zonelevel_t *level;
+
+    if (!stats_enabled)
+    {
+        return;
+    }
+
+    zonelevels = I_Realloc(zonelevels, (numzonelevels + 1) * sizeof(*zonelevels));
+    level = &zonelevels[numzonelevels++];
+    M_StringCopy(level->name, name, sizeof(level->name));
+    level->basebytes = level->peakbytes = zonelivebytes;
+}
+
+static int Z_CompareSites(const void *a, const void *b)
+{
+    const zonesite_t *sa = *(const zonesite_t *const *) a;
+    const zonesite_t *sb = *(const zonesite_t *const *) b;
+
+    if (sa->bytes != sb->bytes)
+        return sa->bytes < sb->bytes ? 1 : -1;
+
+    return 0;
+}
+
+static void Z_StatsReport(void)
+{
+    static const char *const tagnames[PU_NUM_TAGS] =
+    {
+        "", "STATIC", "SOUND", "MUSIC", "FREE",
+        "LEVEL", "LEVSPEC", "PURGELEVEL", "CACHE",
+    };
+    zonesite_t **sorted;
+    int i, n;
+
+    printf("zone stats: size %u bytes, peak live %i bytes\n",
+           Z_ZoneSize(), zonepeakbytes);
+
+    printf("\n%-10s %10s %14s %12s %12s\n",
+           "tag", "allocs", "bytes", "live", "peak");
+    for (i = 1; i < PU_NUM_TAGS; ++i)
+    {
+        if (zonetags[i].allocs == 0 && zonetags[i].peakbytes == 0)
+            continue;
+        printf("%-10s %10u %14llu %12i %12i\n", tagnames[i],
+               zonetags[i].allocs, (unsigned long long) zonetags[i].bytes,
+               zonetags[i].livebytes, zonetags[i].peakbytes);
+    }
+
+    printf("\n%-8s %12s %12s\n", "level", "base", "peak");
+    for (i = 0; i < numzonelevels; ++i)
+    {
+        printf("%-8s %12i %12i\n", zonelevels[i].name,
+               zonelevels[i].basebytes, zonelevels[i].peakbytes);
+    }
+
+    sorted = malloc(numzonesites * sizeof(*sorted));
+    for (i = 0, n = 0; i < MAXZONESITES; ++i)
+    {
+        if (zonesites[i].file != NULL)
+            sorted[n++] = &zonesites[i];
+    }
+    qsort(sorted, n, sizeof(*sorted), Z_CompareSites);
+
+    printf("\n%-32s %-10s %10s %10s %14s %12s %10s\n", "site", "tag",
+           "allocs", "frees", "bytes", "peak", "avg ms");
+    for (i = 0; i < n; ++i)
+    {
+        const zonesite_t *site = sorted[i];
+        char where[64];
+
+        M_snprintf(where, sizeof(where), "%s:%i", site->file, site->line);
+        printf("%-32s %-10s %10u %10u %14llu %12i %10u\n", where,
+               tagnames[site->tag], site->allocs, site->frees,
+               (unsigned long long) site->bytes, site->peakbytes,
+               site->frees ? (unsigned int) (site->lifetime / site->frees) : 0);
+    }
+
+    free(sorted);
+}
+
+#endif // ZONE_STATS
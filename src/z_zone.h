@@ -26,6 +26,8 @@
 
 #include <stdio.h>
 
+#include "config.h"
+
 //
 // ZONE MEMORY
 // PU - purge tags.
@@ -69,5 +71,17 @@ unsigned int Z_ZoneSize(void);
 #define Z_ChangeTag(p,t)                                       \
     Z_ChangeTag2((p), (t), __FILE__, __LINE__)
 
+// [AP] Zone telemetry build: record the call site of each allocation
+// and mark level boundaries for -zonestats.
+#ifdef ZONE_STATS
+void   *Z_Malloc2 (int size, int tag, void *ptr, const char *file, int line);
+void    Z_StatsLevel (const char *name);
+
+#define Z_Malloc(s,t,p)                                        \
+    Z_Malloc2((s), (t), (p), __FILE__, __LINE__)
+#else
+#define Z_StatsLevel(name)
+#endif
+
 
 #endif
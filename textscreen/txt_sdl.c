@@ -56,6 +56,21 @@ static SDL_Surface *screenbuffer;
 static unsigned char *screendata;
 static SDL_Renderer *renderer;
 
+// Character and resolved colors of each cell as last drawn into
+// screenbuffer, so that only the cells which changed are drawn again.
+// The colors never resolve to 0xff, which marks a cell to be redrawn.
+static unsigned char *drawndata;
+
+// Persistent copy of screenbuffer on the GPU, and the 32-bit surface the
+// changed part is converted through before each upload.
+static SDL_Texture *screentx;
+static SDL_Surface *rgbbuffer;
+
+// Set when all of screenbuffer has to be uploaded to screentx, or when
+// the window needs presenting again even if no cell changed.
+static int screen_needs_upload;
+static int screen_needs_present;
+
 // Current input mode.
 static txt_input_mode_t input_mode = TXT_INPUT_NORMAL;
 
@@ -302,11 +317,23 @@ int TXT_Init(void)
     screendata = malloc(TXT_SCREEN_W * TXT_SCREEN_H * 2);
     memset(screendata, 0, TXT_SCREEN_W * TXT_SCREEN_H * 2);
 
+    drawndata = malloc(TXT_SCREEN_W * TXT_SCREEN_H * 2);
+    memset(drawndata, 0xff, TXT_SCREEN_W * TXT_SCREEN_H * 2);
+
     return 1;
 }
 
 void TXT_Shutdown(void)
 {
+    if (screentx != NULL)
+    {
+        SDL_DestroyTexture(screentx);
+        screentx = NULL;
+    }
+    SDL_FreeSurface(rgbbuffer);
+    rgbbuffer = NULL;
+    free(drawndata);
+    drawndata = NULL;
     free(screendata);
     screendata = NULL;
     SDL_FreeSurface(screenbuffer);
@@ -321,6 +348,9 @@ void TXT_SetColor(txt_color_t color, int r, int g, int b)
     SDL_LockSurface(screenbuffer);
     SDL_SetPaletteColors(screenbuffer->format->palette, &c, color, 1);
     SDL_UnlockSurface(screenbuffer);
+
+    // Every cell has to be converted again with the new palette.
+    screen_needs_upload = 1;
 }
 
 unsigned char *TXT_GetScreenData(void)
@@ -328,10 +358,14 @@ unsigned char *TXT_GetScreenData(void)
     return screendata;
 }
 
-static inline void UpdateCharacter(int x, int y)
+// Draws a character cell into screenbuffer, unless it already shows the
+// same thing. Returns true if the cell was drawn.
+
+static inline int UpdateCharacter(int x, int y)
 {
     unsigned char character;
     const uint8_t *p;
+    unsigned char *d;
     unsigned char *s, *s1;
     unsigned int bit;
     int bg, fg;
@@ -355,6 +389,16 @@ static inline void UpdateCharacter(int x, int y)
         }
     }
 
+    d = &drawndata[(y * TXT_SCREEN_W + x) * 2];
+
+    if (d[0] == character && d[1] == ((bg << 4) | fg))
+    {
+        return 0;
+    }
+
+    d[0] = character;
+    d[1] = (bg << 4) | fg;
+
     // How many bytes per line?
     p = &font->data[(character * font->w * font->h) / 8];
     bit = 0;
@@ -388,6 +432,8 @@ static inline void UpdateCharacter(int x, int y)
 
         s += screenbuffer->pitch;
     }
+
+    return 1;
 }
 
 static int LimitToRange(int val, int min, int max)
@@ -417,13 +463,38 @@ static void GetDestRect(SDL_Rect *rect)
     rect->h = screenbuffer->h;
 }
 
+static void CreateScreenTexture(void)
+{
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+
+    screentx = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                 SDL_TEXTUREACCESS_STREAMING,
+                                 screenbuffer->w, screenbuffer->h);
+
+    if (rgbbuffer == NULL)
+    {
+        rgbbuffer = SDL_CreateRGBSurfaceWithFormat(0, screenbuffer->w,
+                                                   screenbuffer->h, 32,
+                                                   SDL_PIXELFORMAT_ARGB8888);
+    }
+
+    // A new texture starts out blank.
+    screen_needs_upload = 1;
+}
+
 void TXT_UpdateScreenArea(int x, int y, int w, int h)
 {
-    SDL_Texture *screentx;
     SDL_Rect rect;
     int x1, y1;
     int x_end;
     int y_end;
+    int dirty_x1 = TXT_SCREEN_W, dirty_y1 = TXT_SCREEN_H;
+    int dirty_x2 = -1, dirty_y2 = -1;
+
+    if (screentx == NULL)
+    {
+        CreateScreenTexture();
+    }
 
     SDL_LockSurface(screenbuffer);
 
@@ -436,24 +507,62 @@ void TXT_UpdateScreenArea(int x, int y, int w, int h)
     {
         for (x1=x; x1<x_end; ++x1)
         {
-            UpdateCharacter(x1, y1);
+            if (UpdateCharacter(x1, y1))
+            {
+                if (x1 < dirty_x1) dirty_x1 = x1;
+                if (x1 > dirty_x2) dirty_x2 = x1;
+                if (y1 < dirty_y1) dirty_y1 = y1;
+                dirty_y2 = y1;
+            }
         }
     }
 
     SDL_UnlockSurface(screenbuffer);
 
-    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+    if (screen_needs_upload)
+    {
+        dirty_x1 = 0;
+        dirty_y1 = 0;
+        dirty_x2 = TXT_SCREEN_W - 1;
+        dirty_y2 = TXT_SCREEN_H - 1;
+        screen_needs_upload = 0;
+    }
+
+    // Convert and upload only the rectangle around the cells that changed.
+    // If none did and nothing happened to the window, the last frame is
+    // still on screen and there is nothing to do.
 
-    // TODO: This is currently creating a new texture every time we render
-    // the screen; find a more efficient way to do it.
-    screentx = SDL_CreateTextureFromSurface(renderer, screenbuffer);
+    if (dirty_x2 >= 0)
+    {
+        SDL_Rect src;
+        SDL_Rect dst;
+
+        src.x = dirty_x1 * font->w;
+        src.y = dirty_y1 * font->h;
+        src.w = (dirty_x2 - dirty_x1 + 1) * font->w;
+        src.h = (dirty_y2 - dirty_y1 + 1) * font->h;
+        dst = src;
+
+        SDL_BlitSurface(screenbuffer, &src, rgbbuffer, &dst);
+        SDL_UpdateTexture(screentx, &src,
+                          (unsigned char *) rgbbuffer->pixels
+                            + src.y * rgbbuffer->pitch + src.x * 4,
+                          rgbbuffer->pitch);
+
+        screen_needs_present = 1;
+    }
+
+    if (!screen_needs_present)
+    {
+        return;
+    }
 
     SDL_RenderClear(renderer);
     GetDestRect(&rect);
     SDL_RenderCopy(renderer, screentx, NULL, &rect);
     SDL_RenderPresent(renderer);
 
-    SDL_DestroyTexture(screentx);
+    screen_needs_present = 0;
 }
 
 void TXT_UpdateScreen(void)
@@ -624,6 +733,18 @@ signed int TXT_GetChar(void)
 
         switch (ev.type)
         {
+            case SDL_WINDOWEVENT:
+                // Exposed, resized, restored... present the screen again.
+                screen_needs_present = 1;
+                break;
+
+            case SDL_RENDER_DEVICE_RESET:
+                // Textures were lost along with the device.
+                SDL_DestroyTexture(screentx);
+                screentx = NULL;
+                screen_needs_present = 1;
+                break;
+
             case SDL_MOUSEBUTTONDOWN:
                 if (ev.button.button < TXT_MAX_MOUSE_BUTTONS)
                 {
@@ -843,8 +964,6 @@ int TXT_ScreenHasBlinkingChars(void)
 
 void TXT_Sleep(int timeout)
 {
-    unsigned int start_time;
-
     if (TXT_ScreenHasBlinkingChars())
     {
         int time_to_next_blink;
@@ -870,24 +989,10 @@ void TXT_Sleep(int timeout)
     }
     else
     {
-        // Sit in a busy loop until the timeout expires or we have to
-        // redraw the blinking screen
+        // Sleep until an event arrives, the timeout expires or we have
+        // to redraw the blinking screen, whichever comes first.
 
-        start_time = SDL_GetTicks();
-
-        while (SDL_GetTicks() < start_time + timeout)
-        {
-            if (SDL_PollEvent(NULL) != 0)
-            {
-                // Received an event, so stop waiting
-
-                break;
-            }
-
-            // Don't hog the CPU
-
-            SDL_Delay(1);
-        }
+        SDL_WaitEventTimeout(NULL, timeout);
     }
 }
 